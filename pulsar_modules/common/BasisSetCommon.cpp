@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
 #include "pulsar_modules/common/BasisSetCommon.hpp"
 
 using namespace pulsar;
@@ -45,6 +49,12 @@ static BasisShellInfo NormalizeShell_(const BasisShellInfo & shell, const CoordT
 
     BasisShellInfo newshell(shell);
 
+    // The unit shell (a single primitive with a zero exponent) is used to
+    // obtain 2- and 3-center integrals from the 4-center ERI modules.
+    // It can't be normalized and is left as is
+    if(nprim == 1 && alpha[0] <= 0.0)
+        return newshell;
+
     for(size_t n = 0; n < shell.n_general_contractions(); n++)
     {
         const int iam = shell.general_am(n);
@@ -107,3 +117,318 @@ std::shared_ptr<const BasisSet> NormalizeBasis(CacheData & cache,
     return cache.get<BasisSet>(cachekey,use_dist);
 }
 
+
+
+// Bound on the average of (r + d)^L over a gaussian exp(-p r^2),
+// where r is the distance from its center. This is the polynomial
+// part of a product of gaussians with total AM L, where d is the
+// larger distance from the product center to the two shell centers.
+static double PolynomialFactor_(int L, double d, double p)
+{
+    if(L <= 0)
+        return 1.0;
+
+    // <(r + d)^L>^(1/L) <= <r^L>^(1/L) + d
+    const double rl = pow(tgamma(0.5*(L+3)) / tgamma(1.5), 1.0/L) / sqrt(p);
+    return pow(rl + d, L);
+}
+
+
+static ShellPairData MakeShellPair_(const BasisSetShell & sh1, const BasisSetShell & sh2,
+                                    double screen_threshold, unsigned int screen_ops,
+                                    double sumcharge)
+{
+    // (pi)^(3/2)
+    static const double pi32 = 5.56832799683170785;
+    static const double twopi = 6.28318530717958648;
+
+    const size_t nprim1 = sh1.n_primitives();
+    const size_t nprim2 = sh2.n_primitives();
+    const size_t ngen1 = sh1.n_general_contractions();
+    const size_t ngen2 = sh2.n_general_contractions();
+
+    // The largest AM of each shell
+    const int am1 = std::abs(sh1.am());
+    const int am2 = std::abs(sh2.am());
+
+    const CoordType xyz1 = sh1.get_coords();
+    const CoordType xyz2 = sh2.get_coords();
+
+    ShellPairData sp;
+    sp.ngen = ngen1*ngen2;
+    sp.bound = 0.0;
+
+    for(int d = 0; d < 3; d++)
+        sp.AB[d] = xyz1[d] - xyz2[d];
+    sp.AB2 = sp.AB[0]*sp.AB[0] + sp.AB[1]*sp.AB[1] + sp.AB[2]*sp.AB[2];
+
+    // Find which primitive pairs are significant. The
+    // coefficient layout depends on how many there are,
+    // so this has to be done first
+    std::vector<std::pair<size_t, size_t>> prims;
+    prims.reserve(nprim1*nprim2);
+
+    for(size_t a = 0; a < nprim1; a++)
+    for(size_t b = 0; b < nprim2; b++)
+    {
+        const double a1 = sh1.alpha(a);
+        const double a2 = sh2.alpha(b);
+        const double p = a1 + a2;
+        const double oop = 1.0/p;
+        const double expfac = exp(-a1*a2*oop*sp.AB2);
+
+        double maxcoef = 0.0;
+        for(size_t g1 = 0; g1 < ngen1; g1++)
+        for(size_t g2 = 0; g2 < ngen2; g2++)
+            maxcoef = std::max(maxcoef, std::fabs(sh1.coef(g1, a) * sh2.coef(g2, b)));
+
+        // distances from the product center to the shells and the origin
+        double PA2 = 0.0, PB2 = 0.0, P2 = 0.0;
+        for(int d = 0; d < 3; d++)
+        {
+            const double P = (a1*xyz1[d] + a2*xyz2[d])*oop;
+            PA2 += (P - xyz1[d])*(P - xyz1[d]);
+            PB2 += (P - xyz2[d])*(P - xyz2[d]);
+            P2 += P*P;
+        }
+        const double dist = sqrt(std::max(PA2, PB2));
+
+        const int L = am1 + am2;
+        const double coef = maxcoef * expfac;
+        const double overlap = coef * pi32 * oop * sqrt(oop);
+
+        double primbound = 0.0;
+        if(screen_ops & ScreenOverlap)
+            primbound = std::max(primbound, overlap * PolynomialFactor_(L, dist, p));
+        if(screen_ops & ScreenKinetic)
+        {
+            // -1/2 nabla^2 acting on the second gaussian
+            const double t = am2*(am2-1)*PolynomialFactor_(L-2, dist, p)
+                           + 2.0*a2*(2*am2+3)*PolynomialFactor_(L, dist, p)
+                           + 4.0*a2*a2*PolynomialFactor_(L+2, dist, p);
+            primbound = std::max(primbound, 0.5 * overlap * t);
+        }
+        if(screen_ops & ScreenDipole)
+            primbound = std::max(primbound, overlap * PolynomialFactor_(L+1, std::max(dist, sqrt(P2)), p));
+        if(screen_ops & ScreenPotential)
+            primbound = std::max(primbound, coef * twopi * oop * sumcharge * PolynomialFactor_(L, dist, p));
+
+        if(primbound >= screen_threshold)
+        {
+            prims.emplace_back(a, b);
+            sp.bound += primbound;
+        }
+    }
+
+    // is the entire shell pair negligible?
+    if(sp.bound < screen_threshold)
+        prims.clear();
+
+    sp.nprim = prims.size();
+
+    sp.alpha1.resize(sp.nprim);
+    sp.alpha2.resize(sp.nprim);
+    sp.p.resize(sp.nprim);
+    sp.oop.resize(sp.nprim);
+    sp.mu.resize(sp.nprim);
+    for(int d = 0; d < 3; d++)
+    {
+        sp.P[d].resize(sp.nprim);
+        sp.PA[d].resize(sp.nprim);
+        sp.PB[d].resize(sp.nprim);
+    }
+    sp.coef.resize(sp.ngen*sp.nprim);
+
+    for(size_t idx = 0; idx < sp.nprim; idx++)
+    {
+        const size_t a = prims[idx].first;
+        const size_t b = prims[idx].second;
+
+        const double a1 = sh1.alpha(a);
+        const double a2 = sh2.alpha(b);
+        const double p = a1 + a2;
+        const double oop = 1.0/p;
+        const double mu = a1*a2*oop;
+        const double expfac = exp(-mu*sp.AB2);
+
+        sp.alpha1[idx] = a1;
+        sp.alpha2[idx] = a2;
+        sp.p[idx] = p;
+        sp.oop[idx] = oop;
+        sp.mu[idx] = mu;
+
+        for(int d = 0; d < 3; d++)
+        {
+            const double P = (a1*xyz1[d] + a2*xyz2[d])*oop;
+            sp.P[d][idx] = P;
+            sp.PA[d][idx] = P - xyz1[d];
+            sp.PB[d][idx] = P - xyz2[d];
+        }
+
+        for(size_t g1 = 0; g1 < ngen1; g1++)
+        for(size_t g2 = 0; g2 < ngen2; g2++)
+            sp.coef[(g1*ngen2 + g2)*sp.nprim + idx] = sh1.coef(g1, a) * sh2.coef(g2, b) * expfac;
+    }
+
+    return sp;
+}
+
+
+// Exact text for a double, for cache keys. std::to_string only
+// keeps six decimal places, so small thresholds would all be zero
+static std::string ExactString_(double x)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%a", x);
+    return buf;
+}
+
+
+std::shared_ptr<const ShellPairSet> ShellPairs(CacheData & cache,
+                                               OutputStream & out,
+                                               const BasisSet & bs1,
+                                               const BasisSet & bs2,
+                                               double screen_threshold,
+                                               unsigned int screen_ops,
+                                               double sumcharge)
+{
+    using bphash::hash_to_string;
+    const bool use_dist=false;
+    std::string cachekey = std::string("sp:") + hash_to_string(bs1.my_hash())
+                         + ":" + hash_to_string(bs2.my_hash())
+                         + ":" + ExactString_(screen_threshold)
+                         + ":" + std::to_string(screen_ops)
+                         + ":" + ExactString_(sumcharge);
+    auto ret=cache.get<ShellPairSet>(cachekey,use_dist);
+    if(ret)
+    {
+        out.debug("Found shell pair data in cache: %? %?\n",
+                  hash_to_string(bs1.my_hash()), hash_to_string(bs2.my_hash()));
+        return ret;
+    }
+
+    ShellPairSet sps;
+    sps.nshell1 = bs1.n_shell();
+    sps.nshell2 = bs2.n_shell();
+    sps.screen_threshold = screen_threshold;
+    sps.screen_ops = screen_ops;
+    sps.nprim_total = 0;
+    sps.nprim_screened = 0;
+    sps.npair_screened = 0;
+    sps.pairs.reserve(sps.nshell1*sps.nshell2);
+
+    for(size_t i = 0; i < sps.nshell1; i++)
+    for(size_t j = 0; j < sps.nshell2; j++)
+    {
+        const BasisSetShell & sh1 = bs1.shell(i);
+        const BasisSetShell & sh2 = bs2.shell(j);
+        const size_t nprim = sh1.n_primitives() * sh2.n_primitives();
+
+        sps.pairs.push_back(MakeShellPair_(sh1, sh2, screen_threshold, screen_ops, sumcharge));
+
+        sps.nprim_total += nprim;
+        sps.nprim_screened += nprim - sps.pairs.back().nprim;
+        if(sps.pairs.back().nprim == 0)
+            sps.npair_screened++;
+    }
+
+    out.output("Shell pair screening (threshold %?): skipped %? of %? primitive pairs, %? of %? shell pairs\n",
+               screen_threshold, sps.nprim_screened, sps.nprim_total,
+               sps.npair_screened, sps.nshell1*sps.nshell2);
+
+    // add to the cache
+    cache.set(cachekey, std::move(sps), CacheData::CheckpointLocal);
+
+    return cache.get<ShellPairSet>(cachekey,use_dist);
+}
+
+
+
+std::shared_ptr<const PackedBasis> PackBasis(CacheData & cache,
+                                             OutputStream & out,
+                                             const BasisSet & bs)
+{
+    using bphash::hash_to_string;
+    const bool use_dist=false;
+    std::string cachekey = std::string("pb:") + hash_to_string(bs.my_hash());
+    auto ret=cache.get<PackedBasis>(cachekey,use_dist);
+    if(ret)
+    {
+        out.debug("Found packed basis in cache: %?\n", hash_to_string(bs.my_hash()));
+        return ret;
+    }
+
+    // each shell starts on a cache line
+    const size_t linesize = CacheAlignedAllocator<double>::alignment / sizeof(double);
+    auto padded = [linesize](size_t n) { return linesize * ((n + linesize - 1) / linesize); };
+
+    PackedBasis pb;
+    pb.nshell = bs.n_shell();
+
+    // sort by AM, then number of primitives. Stable, so that
+    // shells within a class stay in the original order
+    pb.order.resize(pb.nshell);
+    for(size_t i = 0; i < pb.nshell; i++)
+        pb.order[i] = i;
+
+    auto shell_class = [&bs](size_t i)
+    {
+        const BasisSetShell & sh = bs.shell(i);
+        return std::make_pair(sh.am(), sh.n_primitives());
+    };
+
+    std::stable_sort(pb.order.begin(), pb.order.end(),
+                     [&shell_class](size_t a, size_t b) { return shell_class(a) < shell_class(b); });
+
+    pb.packed_index.resize(pb.nshell);
+    for(size_t i = 0; i < pb.nshell; i++)
+        pb.packed_index[pb.order[i]] = i;
+
+    size_t nalpha = 0, ncoef = 0;
+    for(size_t i = 0; i < pb.nshell; i++)
+    {
+        const BasisSetShell & sh = bs.shell(pb.order[i]);
+
+        if(i == 0 || shell_class(pb.order[i]) != shell_class(pb.order[i-1]))
+            pb.classstart.push_back(i);
+
+        pb.am.push_back(sh.am());
+        pb.nprim.push_back(sh.n_primitives());
+        pb.ngen.push_back(sh.n_general_contractions());
+        pb.primstart.push_back(nalpha);
+        pb.coefstart.push_back(ncoef);
+        pb.genstart.push_back(pb.general_am.size());
+
+        for(size_t g = 0; g < sh.n_general_contractions(); g++)
+            pb.general_am.push_back(sh.general_am(g));
+
+        const CoordType xyz = sh.get_coords();
+        for(int d = 0; d < 3; d++)
+            pb.xyz[d].push_back(xyz[d]);
+
+        nalpha += padded(sh.n_primitives());
+        ncoef += padded(sh.n_primitives() * sh.n_general_contractions());
+    }
+    pb.classstart.push_back(pb.nshell);
+
+    pb.alpha.assign(nalpha, 0.0);
+    pb.coef.assign(ncoef, 0.0);
+
+    for(size_t i = 0; i < pb.nshell; i++)
+    {
+        const BasisSetShell & sh = bs.shell(pb.order[i]);
+        const size_t nprim = sh.n_primitives();
+
+        for(size_t a = 0; a < nprim; a++)
+            pb.alpha[pb.primstart[i] + a] = sh.alpha(a);
+
+        for(size_t g = 0; g < sh.n_general_contractions(); g++)
+        for(size_t a = 0; a < nprim; a++)
+            pb.coef[pb.coefstart[i] + g*nprim + a] = sh.coef(g, a);
+    }
+
+    // add to the cache
+    cache.set(cachekey, std::move(pb), CacheData::CheckpointLocal);
+
+    return cache.get<PackedBasis>(cachekey,use_dist);
+}
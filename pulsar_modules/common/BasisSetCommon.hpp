@@ -1,6 +1,10 @@
 #ifndef _GUARD_INTEGRAL_COMMON_HPP_
 #define _GUARD_INTEGRAL_COMMON_HPP_
 
+#include <cstdlib>
+#include <new>
+#include <vector>
+
 #include <pulsar/system/BasisSet.hpp>
 #include <pulsar/datastore/CacheData.hpp>
 #include <pulsar/output/OutputStream.hpp>
@@ -12,5 +16,205 @@ NormalizeBasis(pulsar::CacheData & cache,
                const pulsar::BasisSet & bs);
 
 
+/*! \brief Primitive pair data for a single pair of shells
+ *
+ * Everything is stored as a structure of arrays, with one element
+ * for each primitive pair that was kept. They are in the order of
+ * the primitive of the first shell, then of the second.
+ *
+ * The contraction coefficients of the two shells and the
+ * exponential factor \f$ e^{-\mu |AB|^2} \f$ are already
+ * multiplied together in #coef.
+ *
+ * Primitive pairs that are negligible are not stored. If the entire
+ * shell pair is negligible, #nprim is zero.
+ */
+struct ShellPairData
+{
+    size_t nprim;    //!< Number of primitive pairs that were kept (zero if the shell pair is negligible)
+    size_t ngen;     //!< Number of pairs of general contractions (ngen1*ngen2)
+
+    double AB[3];    //!< A - B
+    double AB2;      //!< |A - B|^2
+    double bound;    //!< Estimate of the largest integral of the shell pair (see ShellPairs)
+
+    std::vector<double> alpha1;  //!< Exponent of the primitive on the first shell
+    std::vector<double> alpha2;  //!< Exponent of the primitive on the second shell
+    std::vector<double> p;       //!< alpha1 + alpha2
+    std::vector<double> oop;     //!< 1/p
+    std::vector<double> mu;      //!< alpha1*alpha2/p
+    std::vector<double> P[3];    //!< Gaussian product center
+    std::vector<double> PA[3];   //!< P - A
+    std::vector<double> PB[3];   //!< P - B
+
+    //! c1*c2*exp(-mu |AB|^2), stored as [g1*ngen2 + g2][primitive pair]
+    std::vector<double> coef;
+};
+
+
+/*! \brief Primitive pair data for all pairs of shells of two basis sets */
+struct ShellPairSet
+{
+    size_t nshell1;
+    size_t nshell2;
+    std::vector<ShellPairData> pairs;
+
+    double screen_threshold;     //!< Threshold used for screening
+    unsigned int screen_ops;     //!< Operators used for screening (see ScreenOperator)
+    size_t nprim_total;          //!< Total number of primitive pairs
+    size_t nprim_screened;       //!< Number of primitive pairs that were dropped
+    size_t npair_screened;       //!< Number of shell pairs that are negligible
+
+    const ShellPairData & pair(size_t shell1, size_t shell2) const
+    {
+        return pairs[shell1*nshell2 + shell2];
+    }
+};
+
+
+/*! \brief Operators whose integrals are estimated when screening shell pairs
+ *
+ * These are bit flags, and may be combined. The largest of the
+ * estimates is used.
+ */
+enum ScreenOperator : unsigned int
+{
+    ScreenOverlap   = 1,   //!< Overlap
+    ScreenKinetic   = 2,   //!< Kinetic energy
+    ScreenDipole    = 4,   //!< Dipole about the origin
+    ScreenPotential = 8    //!< Potential from point charges
+};
+
+
+/*! \brief Obtain the shell pair data for two (normalized) basis sets
+ *
+ * The data is built once and stored in the cache next to the
+ * normalized basis sets, so it can be shared between all modules
+ * using the same pair of basis sets and screening.
+ *
+ * A primitive pair is dropped if the estimate of its largest integral
+ * (maximum over the general contractions) is below \p screen_threshold.
+ * For s functions, the overlap is \f$ |c_1 c_2| (\pi/p)^{3/2} e^{-\mu |AB|^2} \f$
+ * and the potential is \f$ |c_1 c_2| (2\pi/p) e^{-\mu |AB|^2} \sum |q| \f$.
+ * For higher AM, these are scaled by a bound on the polynomial part
+ * of the product, and the kinetic energy and dipole include the extra
+ * terms of their operators. A shell pair is negligible if the sum of
+ * these over all remaining primitive pairs is below the threshold.
+ * The number of screened pairs is printed to \p out.
+ *
+ * \note The basis sets should be the ones returned from NormalizeBasis
+ *
+ * \param [in] screen_threshold Screening threshold. Zero disables screening
+ * \param [in] screen_ops Operators to estimate the integrals of (ScreenOperator flags)
+ * \param [in] sumcharge Sum of the absolute values of the point charges (for ScreenPotential)
+ */
+std::shared_ptr<const ShellPairSet>
+ShellPairs(pulsar::CacheData & cache,
+           pulsar::OutputStream & out,
+           const pulsar::BasisSet & bs1,
+           const pulsar::BasisSet & bs2,
+           double screen_threshold,
+           unsigned int screen_ops = ScreenOverlap,
+           double sumcharge = 0.0);
+
+
+
+/*! \brief Allocator for memory aligned to a cache line */
+template<typename T>
+struct CacheAlignedAllocator
+{
+    typedef T value_type;
+
+    static const size_t alignment = 64;
+
+    CacheAlignedAllocator() = default;
+
+    template<typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U> &) { }
+
+    T * allocate(size_t n)
+    {
+        // extra space for the alignment and for the original pointer
+        void * mem = std::malloc(n*sizeof(T) + alignment + sizeof(void *));
+        if(mem == nullptr)
+            throw std::bad_alloc();
+
+        size_t addr = reinterpret_cast<size_t>(mem) + sizeof(void *);
+        addr = (addr + alignment - 1) & ~(alignment - 1);
+
+        void ** ptr = reinterpret_cast<void **>(addr);
+        ptr[-1] = mem;
+        return reinterpret_cast<T *>(ptr);
+    }
+
+    void deallocate(T * p, size_t)
+    {
+        if(p != nullptr)
+            std::free(reinterpret_cast<void **>(p)[-1]);
+    }
+
+    template<typename U>
+    bool operator==(const CacheAlignedAllocator<U> &) const { return true; }
+
+    template<typename U>
+    bool operator!=(const CacheAlignedAllocator<U> &) const { return false; }
+};
+
+
+/*! \brief A vector of doubles starting on a cache line */
+typedef std::vector<double, CacheAlignedAllocator<double>> AlignedVector;
+
+
+/*! \brief Shells of a basis set, packed as a structure of arrays
+ *
+ * Shells are stored sorted by AM and then by number of primitives, so
+ * shells of the same class are next to each other. Everything indexed
+ * by shell uses this packed index; use #packed_index to convert from
+ * the index of the shell in the basis set.
+ *
+ * The exponents and coefficients of each shell start on a cache line.
+ * The coefficients of a shell are stored as [general contraction][primitive].
+ */
+struct PackedBasis
+{
+    size_t nshell;
+
+    std::vector<size_t> order;         //!< Index in the basis set for each packed shell
+    std::vector<size_t> packed_index;  //!< Packed index for each shell of the basis set
+
+    //! Start of each class of shells (same AM and number of primitives),
+    //! followed by the total number of shells
+    std::vector<size_t> classstart;
+
+    std::vector<int> am;            //!< AM of the shell (negative for combined AM)
+    std::vector<size_t> nprim;      //!< Number of primitives
+    std::vector<size_t> ngen;       //!< Number of general contractions
+    std::vector<size_t> primstart;  //!< Start of the exponents in #alpha
+    std::vector<size_t> coefstart;  //!< Start of the coefficients in #coef
+    std::vector<size_t> genstart;   //!< Start of the AM of each general contraction in #general_am
+    AlignedVector xyz[3];           //!< Center of the shell
+
+    std::vector<int> general_am;
+    AlignedVector alpha;
+    AlignedVector coef;
+
+    const double * alpha_ptr(size_t shell) const { return alpha.data() + primstart[shell]; }
+    const double * coef_ptr(size_t shell) const { return coef.data() + coefstart[shell]; }
+};
+
+
+/*! \brief Obtain the packed data for a (normalized) basis set
+ *
+ * The data is built once and stored in the cache next to
+ * the normalized basis set.
+ *
+ * \note The basis set should be the one returned from NormalizeBasis
+ */
+std::shared_ptr<const PackedBasis>
+PackBasis(pulsar::CacheData & cache,
+          pulsar::OutputStream & out,
+          const pulsar::BasisSet & bs);
+
+
 
 #endif
@@ -0,0 +1,46 @@
+#include "pulsar_modules/common/ParallelCommon.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+size_t ResolveNThreads(size_t nthread)
+{
+#ifdef _OPENMP
+    if(nthread == 0)
+        nthread = static_cast<size_t>(omp_get_max_threads());
+    return nthread;
+#else
+    (void)nthread;
+    return 1;
+#endif
+}
+
+
+size_t ThreadIndex(void)
+{
+#ifdef _OPENMP
+    return static_cast<size_t>(omp_get_thread_num());
+#else
+    return 0;
+#endif
+}
+
+
+void ParallelErrors::Rethrow(void) const
+{
+    if(error_)
+        std::rethrow_exception(error_);
+}
+
+
+void ParallelErrors::Store_(std::exception_ptr error)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Only the first one is kept
+    if(!error_)
+        error_ = error;
+    failed_.store(true, std::memory_order_relaxed);
+}
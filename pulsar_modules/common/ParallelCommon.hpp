@@ -0,0 +1,93 @@
+#ifndef PULSAR_GUARD_PARALLELCOMMON_HPP_
+#define PULSAR_GUARD_PARALLELCOMMON_HPP_
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+
+/*! \brief Number of threads to use
+ *
+ * \p nthread is the value of an NTHREADS option, where zero means
+ * all available OpenMP threads. Without OpenMP, this is always one.
+ */
+size_t ResolveNThreads(size_t nthread);
+
+
+/*! \brief Index of the calling thread within the current parallel region */
+size_t ThreadIndex(void);
+
+
+/*! \brief Collects exceptions thrown inside a parallel region
+ *
+ * Exceptions can't leave an OpenMP parallel region. Work done inside
+ * the region is wrapped in Run(), which keeps the first exception thrown
+ * by any thread. It is rethrown with Rethrow() after the region.
+ *
+ * Long-running loops may check Failed() to stop early once
+ * any thread has failed.
+ */
+class ParallelErrors
+{
+    public:
+        ParallelErrors(void) : failed_(false) { }
+
+        ParallelErrors(const ParallelErrors &) = delete;
+        ParallelErrors & operator=(const ParallelErrors &) = delete;
+
+        //! Call \p func, storing any exception it throws
+        template<typename Func>
+        void Run(Func && func)
+        {
+            try {
+                func();
+            }
+            catch(...)
+            {
+                Store_(std::current_exception());
+            }
+        }
+
+        //! Has any thread thrown an exception?
+        bool Failed(void) const { return failed_.load(std::memory_order_relaxed); }
+
+        //! Rethrow the stored exception, if there is one
+        void Rethrow(void) const;
+
+    private:
+        std::atomic<bool> failed_;
+        std::exception_ptr error_;
+        std::mutex mutex_;
+
+        void Store_(std::exception_ptr error);
+};
+
+
+/*! \brief Add instances of a module until there is one for each thread
+ *
+ * \p make creates and initializes a single instance. It is called
+ * serially, since the module manager and cache are not thread safe.
+ */
+template<typename ModPtr, typename Func>
+void AddThreadModules(std::vector<ModPtr> & mods, size_t nthread, Func make)
+{
+    while(mods.size() < nthread)
+        mods.push_back(make());
+}
+
+
+/*! \brief Create one instance of a module for each thread
+ *
+ * \copydetails AddThreadModules
+ */
+template<typename Func>
+auto MakeThreadModules(size_t nthread, Func make) -> std::vector<decltype(make())>
+{
+    std::vector<decltype(make())> mods;
+    AddThreadModules(mods, nthread, make);
+    return mods;
+}
+
+
+#endif
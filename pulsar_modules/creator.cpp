@@ -10,6 +10,10 @@
 //#include "methods/scf/HFIterate.hpp"
 //#include "methods/scf/CoreGuess.hpp"
 //#include "methods/scf/BasicFockBuild.hpp"
+//#include "methods/scf/SymmetricFockBuild.hpp"
+//#include "methods/scf/DirectFockBuild.hpp"
+//#include "methods/scf/RIFockBuild.hpp"
+//#include "methods/scf/DiskFockBuild.hpp"
 
 
 using pulsar::ModuleCreationFuncs;
@@ -24,6 +28,10 @@ ModuleCreationFuncs insert_supermodule(void){
 //    cf.add_cpp_creator<pulsarmethods::HFIterate>("HFIterate");
 //    cf.add_cpp_creator<pulsarmethods::CoreGuess>("CoreGuess");
 //    cf.add_cpp_creator<pulsarmethods::BasicFockBuild>("BasicFockBuild");
+//    cf.add_cpp_creator<pulsarmethods::SymmetricFockBuild>("SymmetricFockBuild");
+//    cf.add_cpp_creator<pulsarmethods::DirectFockBuild>("DirectFockBuild");
+//    cf.add_cpp_creator<pulsarmethods::RIFockBuild>("RIFockBuild");
+//    cf.add_cpp_creator<pulsarmethods::DiskFockBuild>("DiskFockBuild");
     cf.add_cpp_creator<Atomizer>("Atomizer");
     cf.add_cpp_creator<Bondizer>("Bondizer");
     cf.add_cpp_creator<CrystalFragger>("CrystalFragger");
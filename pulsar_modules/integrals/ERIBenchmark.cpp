@@ -0,0 +1,189 @@
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <map>
+
+#include <pulsar/system/BasisSet.hpp>
+#include <pulsar/modulebase/TwoElectronIntegral.hpp>
+#include <pulsar/util/StringUtil.hpp>
+
+#include "Integrals/ERIBenchmark.hpp"
+
+
+using namespace pulsar::exception;
+using namespace pulsar::system;
+using namespace pulsar::datastore;
+using namespace pulsar::modulebase;
+
+
+namespace {
+
+typedef std::array<int, 4> AMClass;
+typedef std::array<size_t, 4> ShellQuartet;
+
+// Letters for printing AM classes
+const char am_letters[] = "spdfghiklmnoqrtuvwxyz";
+
+std::string am_class_string(const AMClass & c)
+{
+    std::string ret = "(";
+    ret += am_letters[c[0]];
+    ret += am_letters[c[1]];
+    ret += "|";
+    ret += am_letters[c[2]];
+    ret += am_letters[c[3]];
+    ret += ")";
+    return ret;
+}
+
+} // close anonymous namespace
+
+
+namespace psr_modules {
+namespace integrals {
+
+
+std::vector<double>
+ERIBenchmark::calculate_(unsigned int deriv,
+                         const Wavefunction & wfn,
+                         const BasisSet & bs1,
+                         const BasisSet & bs2)
+
+{
+    using pulsar::util::line;
+    typedef std::chrono::steady_clock clock;
+
+    const auto keys = options().get<std::vector<std::string>>("KEY_ERI_MODULES");
+    if(keys.size() == 0)
+        throw PulsarException("No modules given to ERIBenchmark");
+
+    const size_t nrepeat = options().get<size_t>("NREPEAT");
+    if(nrepeat == 0)
+        throw PulsarException("NREPEAT must be at least 1");
+    const size_t nmod = keys.size();
+
+    const size_t nshell1 = bs1.n_shell();
+    const size_t nshell2 = bs2.n_shell();
+
+    // Group the shell quartets by AM class. The map keeps
+    // the classes sorted
+    std::map<AMClass, std::vector<ShellQuartet>> classes;
+
+    for(size_t i = 0; i < nshell1; i++)
+    for(size_t j = 0; j < nshell1; j++)
+    for(size_t k = 0; k < nshell2; k++)
+    for(size_t l = 0; l < nshell2; l++)
+    {
+        const AMClass c{{ std::abs(bs1.shell(i).am()), std::abs(bs1.shell(j).am()),
+                          std::abs(bs2.shell(k).am()), std::abs(bs2.shell(l).am()) }};
+        classes[c].push_back({{i, j, k, l}});
+    }
+
+    std::vector<pulsar::modulemanager::ModulePtr<TwoElectronIntegral>> mods;
+    for(const auto & key : keys)
+    {
+        auto mod = create_child<TwoElectronIntegral>(key);
+        mod->initialize(deriv, wfn, bs1, bs1, bs2, bs2);
+        mods.push_back(std::move(mod));
+    }
+
+    const size_t bufsize = bs1.max_n_functions() * bs1.max_n_functions()
+                         * bs2.max_n_functions() * bs2.max_n_functions();
+    std::vector<double> refbuf(bufsize);
+    std::vector<double> buf(bufsize);
+
+
+    // time per class and module, and maximum deviation from the first module
+    std::vector<std::vector<double>> times(classes.size(), std::vector<double>(nmod, 0.0));
+    std::vector<std::vector<double>> maxdiff(classes.size(), std::vector<double>(nmod, 0.0));
+    std::vector<double> totaltime(nmod, 0.0);
+
+    size_t cidx = 0;
+    for(const auto & it : classes)
+    {
+        const auto & quartets = it.second;
+
+        for(size_t m = 0; m < nmod; m++)
+        {
+            const auto start = clock::now();
+
+            for(size_t r = 0; r < nrepeat; r++)
+            for(const auto & q : quartets)
+                mods[m]->calculate(q[0], q[1], q[2], q[3], buf.data(), bufsize);
+
+            const std::chrono::duration<double> elapsed = clock::now() - start;
+            times[cidx][m] = elapsed.count();
+            totaltime[m] += elapsed.count();
+        }
+
+        // compare to the first module
+        for(const auto & q : quartets)
+        {
+            const uint64_t nref = mods[0]->calculate(q[0], q[1], q[2], q[3], refbuf.data(), bufsize);
+
+            for(size_t m = 1; m < nmod; m++)
+            {
+                const uint64_t n = mods[m]->calculate(q[0], q[1], q[2], q[3], buf.data(), bufsize);
+
+                if(n != nref)
+                    throw PulsarException("Inconsistent number of integrals returned by ERI modules",
+                                          "n", n, "nexpected", nref, "modulekey", keys[m]);
+
+                for(size_t i = 0; i < n; i++)
+                    maxdiff[cidx][m] = std::max(maxdiff[cidx][m], std::fabs(buf[i] - refbuf[i]));
+            }
+        }
+
+        cidx++;
+    }
+
+
+    // Print the results
+    out.output("ERI benchmark: %? shell quartets in %? AM classes, %? repetitions\n",
+               nshell1*nshell1*nshell2*nshell2, classes.size(), nrepeat);
+    out.output("Times are in microseconds per shell quartet. Deviations are from %?\n", keys[0]);
+    out.output(line('-'));
+
+    out.output("    %-8?  %10?", "Class", "nquartet");
+    for(const auto & key : keys)
+        out.output("  %14?", key);
+    for(size_t m = 1; m < nmod; m++)
+        out.output("  %14?", "MaxDiff");
+    out.output("  %-14?\n", "Fastest");
+    out.output(line('-'));
+
+    cidx = 0;
+    for(const auto & it : classes)
+    {
+        const double ncalc = static_cast<double>(it.second.size() * nrepeat);
+
+        out.output("    %-8?  %10?", am_class_string(it.first), it.second.size());
+
+        size_t fastest = 0;
+        for(size_t m = 0; m < nmod; m++)
+        {
+            out.output("  %14.3f", 1.0e6*times[cidx][m]/ncalc);
+            if(times[cidx][m] < times[cidx][fastest])
+                fastest = m;
+        }
+
+        for(size_t m = 1; m < nmod; m++)
+            out.output("  %14.3e", maxdiff[cidx][m]);
+
+        out.output("  %-14?\n", keys[fastest]);
+        cidx++;
+    }
+
+    out.output(line('-'));
+    out.output("    %-8?  %10?", "Total(s)", "");
+    for(size_t m = 0; m < nmod; m++)
+        out.output("  %14.6f", totaltime[m]);
+    out.output("\n");
+    out.output(line('-'));
+
+    return totaltime;
+}
+
+
+} // close namespace integrals
+} // close namespace psr_modules
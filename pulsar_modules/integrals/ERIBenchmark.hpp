@@ -0,0 +1,32 @@
+#pragma once
+
+#include <pulsar/modulebase/PropertyCalculator.hpp>
+
+namespace psr_modules {
+namespace integrals {
+
+
+/*! \brief Compares the timings of several electron repulsion integral modules
+ *
+ * All shell quartets (bs1 bs1 | bs2 bs2) are grouped by their angular momentum
+ * class, and each group is timed separately for every module. The table
+ * printed to the output shows the time per shell quartet for each module,
+ * the fastest module for each class (ie, where the crossover between
+ * modules occurs), and the maximum deviation from the first module.
+ *
+ * The returned vector contains the total time (in seconds) taken by each module.
+ */
+class ERIBenchmark : public pulsar::modulebase::PropertyCalculator
+{
+    public:
+        using pulsar::modulebase::PropertyCalculator::PropertyCalculator;
+
+        virtual std::vector<double> calculate_(unsigned int deriv,
+                                               const pulsar::datastore::Wavefunction & wfn,
+                                               const pulsar::system::BasisSet & bs1,
+                                               const pulsar::system::BasisSet & bs2);
+};
+
+
+} // close namespace integrals
+} // close namespace psr_modules
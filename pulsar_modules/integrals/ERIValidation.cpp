@@ -0,0 +1,310 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <pulsar/system/BasisSet.hpp>
+#include <pulsar/modulebase/TwoElectronIntegral.hpp>
+#include <pulsar/util/StringUtil.hpp>
+
+#include "Integrals/ERIValidation.hpp"
+#include "Integrals/IntegralWorkspace.hpp"
+#include "pulsar_modules/common/ParallelCommon.hpp"
+
+
+using namespace pulsar::exception;
+using namespace pulsar::system;
+using namespace pulsar::datastore;
+using namespace pulsar::modulebase;
+
+
+namespace {
+
+using psr_modules::integrals::IntegralWorkspace;
+using psr_modules::integrals::detail::ReentrantTwoElectron;
+
+typedef std::array<size_t, 4> ShellQuartet;
+
+// Letters for printing AM classes
+const char am_letters[] = "spdfghiklmnoqrtuvwxyz";
+
+
+// AM classes (ab|cd) are indexed as ((a*nam + b)*nam + c)*nam + d,
+// which keeps them sorted
+std::string am_class_string(size_t c, size_t nam)
+{
+    size_t am[4];
+    for(int i = 3; i >= 0; i--)
+    {
+        am[i] = c % nam;
+        c /= nam;
+    }
+
+    std::string ret = "(";
+    ret += am_letters[am[0]];
+    ret += am_letters[am[1]];
+    ret += "|";
+    ret += am_letters[am[2]];
+    ret += am_letters[am[3]];
+    ret += ")";
+    return ret;
+}
+
+
+// Pairs of shells of a basis set. If unique, only pairs
+// with i >= j, otherwise all ordered pairs
+std::vector<std::pair<size_t, size_t>> shell_pairs(size_t nshell, bool unique)
+{
+    std::vector<std::pair<size_t, size_t>> pairs;
+    for(size_t i = 0; i < nshell; i++)
+    for(size_t j = 0; j < (unique ? i+1 : nshell); j++)
+        pairs.emplace_back(i, j);
+    return pairs;
+}
+
+
+// Instances of a module. A reentrant module has a single
+// instance, otherwise there is one for each thread
+struct ModuleInstances
+{
+    std::vector<pulsar::modulemanager::ModulePtr<TwoElectronIntegral>> mods;
+    const ReentrantTwoElectron * reentrant;
+};
+
+
+// Deviations found by a single thread
+struct Deviations
+{
+    std::vector<size_t> nquartet;              // for each class
+    std::vector<double> maxdiff;               // for each class and module ([class*nmod + module])
+    std::vector<double> worst;                 // for each module
+    std::vector<ShellQuartet> worstquartet;    // for each module
+    std::vector<size_t> nbad;                  // for each module
+
+    Deviations(size_t nclass, size_t nmod)
+        : nquartet(nclass, 0), maxdiff(nclass*nmod, 0.0),
+          worst(nmod, 0.0), worstquartet(nmod, ShellQuartet{{0, 0, 0, 0}}),
+          nbad(nmod, 0)
+    { }
+};
+
+} // close anonymous namespace
+
+
+namespace psr_modules {
+namespace integrals {
+
+
+std::vector<double>
+ERIValidation::calculate_(unsigned int deriv,
+                          const Wavefunction & wfn,
+                          const BasisSet & bs1,
+                          const BasisSet & bs2)
+
+{
+    using pulsar::util::line;
+
+    const auto refkey = options().get<std::string>("KEY_REFERENCE_ERI");
+    const auto keys = options().get<std::vector<std::string>>("KEY_ERI_MODULES");
+    if(keys.size() == 0)
+        throw PulsarException("No modules given to ERIValidation");
+
+    const double tolerance = options().get<double>("TOLERANCE");
+    const bool allperm = options().get<bool>("ALL_PERMUTATIONS");
+    const size_t nmod = keys.size();
+
+    const size_t nthread = ResolveNThreads(options().get<size_t>("NTHREADS"));
+
+    // Unless all permutations are asked for, only the unique quartets
+    // are checked: i >= j, k >= l and, if both basis sets are the
+    // same, also ij >= kl. The work is split by bra pair.
+    const bool braket = !allperm && bs1 == bs2;
+    const auto brapairs = shell_pairs(bs1.n_shell(), !allperm);
+    const auto ketpairs = shell_pairs(bs2.n_shell(), !allperm);
+    const size_t nbra = brapairs.size();
+
+    // The AM class of a quartet is found from the AM of its shells
+    std::vector<size_t> am1, am2;
+    for(const auto & sh : bs1)
+        am1.push_back(static_cast<size_t>(std::abs(sh.am())));
+    for(const auto & sh : bs2)
+        am2.push_back(static_cast<size_t>(std::abs(sh.am())));
+
+    const size_t nam = static_cast<size_t>(std::max(bs1.max_am(), bs2.max_am())) + 1;
+    const size_t nclass = nam*nam*nam*nam;
+
+    // Create the modules. The reference is the first
+    std::vector<std::string> allkeys{refkey};
+    allkeys.insert(allkeys.end(), keys.begin(), keys.end());
+
+    std::vector<ModuleInstances> instances(allkeys.size());
+    for(size_t m = 0; m < allkeys.size(); m++)
+    {
+        ModuleInstances & inst = instances[m];
+
+        auto make_mod = [&](void)
+        {
+            auto mod = create_child<TwoElectronIntegral>(allkeys[m]);
+            mod->initialize(deriv, wfn, bs1, bs1, bs2, bs2);
+            return mod;
+        };
+
+        AddThreadModules(inst.mods, 1, make_mod);
+        inst.reentrant = dynamic_cast<const ReentrantTwoElectron *>(&(*inst.mods[0]));
+
+        if(!inst.reentrant)
+            AddThreadModules(inst.mods, nthread, make_mod);
+    }
+
+    const size_t bufsize = bs1.max_n_functions() * bs1.max_n_functions()
+                         * bs2.max_n_functions() * bs2.max_n_functions();
+
+    // Merged from all threads
+    Deviations dev(nclass, nmod);
+
+    ParallelErrors errors;
+
+    #pragma omp parallel num_threads(static_cast<int>(nthread))
+    {
+        const size_t ithread = ThreadIndex();
+
+        std::vector<IntegralWorkspace> ws(instances.size());
+        for(size_t m = 0; m < instances.size(); m++)
+            if(instances[m].reentrant)
+                ws[m] = instances[m].reentrant->make_workspace();
+
+        auto calc = [&](size_t m, const ShellQuartet & q, double * buf) -> uint64_t
+        {
+            const ModuleInstances & inst = instances[m];
+            if(inst.reentrant)
+                return inst.reentrant->calculate(q[0], q[1], q[2], q[3], buf, bufsize, ws[m]);
+            return inst.mods[ithread]->calculate(q[0], q[1], q[2], q[3], buf, bufsize);
+        };
+
+        std::vector<double> refbuf(bufsize);
+        std::vector<double> buf(bufsize);
+        Deviations mydev(nclass, nmod);
+
+        #pragma omp for schedule(dynamic)
+        for(size_t ij = 0; ij < nbra; ij++)
+        {
+            errors.Run([&](void)
+            {
+                const size_t i = brapairs[ij].first;
+                const size_t j = brapairs[ij].second;
+                const size_t nket = braket ? ij + 1 : ketpairs.size();
+
+                for(size_t kl = 0; kl < nket; kl++)
+                {
+                    if(errors.Failed())
+                        return;
+
+                    const size_t k = ketpairs[kl].first;
+                    const size_t l = ketpairs[kl].second;
+                    const ShellQuartet q{{i, j, k, l}};
+                    const size_t c = ((am1[i]*nam + am1[j])*nam + am2[k])*nam + am2[l];
+
+                    mydev.nquartet[c]++;
+
+                    const uint64_t nref = calc(0, q, refbuf.data());
+
+                    for(size_t m = 0; m < nmod; m++)
+                    {
+                        const uint64_t ncalc = calc(m+1, q, buf.data());
+
+                        if(ncalc != nref)
+                            throw PulsarException("Inconsistent number of integrals returned by ERI modules",
+                                                  "n", ncalc, "nexpected", nref, "modulekey", keys[m]);
+
+                        double & maxdiff = mydev.maxdiff[c*nmod + m];
+
+                        for(size_t n = 0; n < ncalc; n++)
+                        {
+                            const double diff = std::fabs(buf[n] - refbuf[n]);
+                            maxdiff = std::max(maxdiff, diff);
+
+                            if(diff > tolerance)
+                                mydev.nbad[m]++;
+
+                            if(diff > mydev.worst[m])
+                            {
+                                mydev.worst[m] = diff;
+                                mydev.worstquartet[m] = q;
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        #pragma omp critical
+        {
+            for(size_t c = 0; c < nclass; c++)
+                dev.nquartet[c] += mydev.nquartet[c];
+
+            for(size_t cm = 0; cm < nclass*nmod; cm++)
+                dev.maxdiff[cm] = std::max(dev.maxdiff[cm], mydev.maxdiff[cm]);
+
+            for(size_t m = 0; m < nmod; m++)
+            {
+                dev.nbad[m] += mydev.nbad[m];
+                if(mydev.worst[m] > dev.worst[m])
+                {
+                    dev.worst[m] = mydev.worst[m];
+                    dev.worstquartet[m] = mydev.worstquartet[m];
+                }
+            }
+        }
+    }
+
+    errors.Rethrow();
+
+
+    size_t nquartet = 0;
+    size_t nclass_used = 0;
+    for(size_t c = 0; c < nclass; c++)
+    {
+        nquartet += dev.nquartet[c];
+        if(dev.nquartet[c])
+            nclass_used++;
+    }
+
+    // Print the results
+    out.output("ERI validation: %? %? shell quartets in %? AM classes\n",
+               nquartet, allperm ? "(all permutations)" : "unique", nclass_used);
+    out.output("Maximum absolute deviations from %?\n", refkey);
+    out.output(line('-'));
+
+    out.output("    %-8?  %10?", "Class", "nquartet");
+    for(const auto & key : keys)
+        out.output("  %14?", key);
+    out.output("\n");
+    out.output(line('-'));
+
+    for(size_t c = 0; c < nclass; c++)
+    {
+        if(dev.nquartet[c] == 0)
+            continue;
+
+        out.output("    %-8?  %10?", am_class_string(c, nam), dev.nquartet[c]);
+        for(size_t m = 0; m < nmod; m++)
+            out.output("  %14.3e", dev.maxdiff[c*nmod + m]);
+        out.output("\n");
+    }
+
+    out.output(line('-'));
+    out.output("Tolerance: %?\n", tolerance);
+    for(size_t m = 0; m < nmod; m++)
+    {
+        const ShellQuartet & q = dev.worstquartet[m];
+        out.output("    %-14?  max %10.3e at (%? %?|%? %?)  %? integrals above tolerance  %?\n",
+                   keys[m], dev.worst[m], q[0], q[1], q[2], q[3], dev.nbad[m],
+                   dev.nbad[m] ? "FAILED" : "PASSED");
+    }
+    out.output(line('-'));
+
+    return dev.worst;
+}
+
+
+} // close namespace integrals
+} // close namespace psr_modules
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <pulsar/modulebase/PropertyCalculator.hpp>
+
+namespace psr_modules {
+namespace integrals {
+
+
+/*! \brief Validates electron repulsion integral modules against a reference
+ *
+ * Shell quartets (bs1 bs1 | bs2 bs2) are calculated with the reference
+ * module (usually ReferenceERI in FAST mode) and with every module to be
+ * validated. By default, only the permutationally-unique quartets are
+ * checked; ALL_PERMUTATIONS checks every ordering of the shells. The table
+ * printed to the output shows the maximum absolute deviation for each
+ * angular momentum class, followed by the worst shell quartet and the number
+ * of integrals deviating by more than the tolerance for each module.
+ *
+ * The bra shell pairs are split between threads, and the quartets are
+ * generated on the fly. Reentrant modules are shared by all threads (each
+ * with its own workspace); otherwise, each thread gets its own instance
+ * of the module.
+ *
+ * The returned vector contains the maximum absolute deviation of each module.
+ */
+class ERIValidation : public pulsar::modulebase::PropertyCalculator
+{
+    public:
+        using pulsar::modulebase::PropertyCalculator::PropertyCalculator;
+
+        virtual std::vector<double> calculate_(unsigned int deriv,
+                                               const pulsar::datastore::Wavefunction & wfn,
+                                               const pulsar::system::BasisSet & bs1,
+                                               const pulsar::system::BasisSet & bs2);
+};
+
+
+} // close namespace integrals
+} // close namespace psr_modules
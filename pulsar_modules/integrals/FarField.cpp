@@ -0,0 +1,349 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Integrals/FarField.hpp"
+
+
+namespace {
+
+// Maximum depth of the octree. Leaves at this depth
+// may contain more than leafsize charges
+const int max_depth = 20;
+
+} // close anonymous namespace
+
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+void coulomb_derivatives(int order, const double R[3], double * out, double * work)
+{
+    const size_t nmult = n_multipole(order);
+
+    const double R2 = R[0]*R[0] + R[1]*R[1] + R[2]*R[2];
+    const double oor2 = 1.0/R2;
+
+    ///////////////////////////////////////////////////////
+    // The auxiliary values R^{(n)}_{tuv} are stored in
+    // work[n*nmult + multipole_index(t,u,v)]. For a point
+    // charge,
+    //
+    //   R^{(n)}_{000} = (-1)^n (2n-1)!! / |R|^(2n+1)
+    //
+    // and the rest are formed via
+    //
+    //   R^{(n)}_{t+1,u,v} = t R^{(n+1)}_{t-1,u,v} + X R^{(n+1)}_{t,u,v}
+    //
+    // (and similarly for u and v). The derivatives are then R^{(0)}_{tuv}
+    ///////////////////////////////////////////////////////
+    double val = sqrt(oor2);
+    for(int n = 0; n <= order; n++)
+    {
+        work[n*nmult] = val;
+        val *= -(2*n+1)*oor2;
+    }
+
+    for(int n = order-1; n >= 0; n--)
+    {
+        double * const Rn = work + n*nmult;
+        double const * const Rn1 = Rn + nmult;
+
+        // all components with total order [1, order-n]
+        for(int l = 1; l <= order-n; l++)
+        for(int t = l; t >= 0; t--)
+        for(int u = l-t; u >= 0; u--)
+        {
+            const int v = l-t-u;
+            const size_t idx = multipole_index(t, u, v);
+
+            if(t > 0)
+            {
+                Rn[idx] = R[0]*Rn1[multipole_index(t-1, u, v)];
+                if(t > 1)
+                    Rn[idx] += (t-1)*Rn1[multipole_index(t-2, u, v)];
+            }
+            else if(u > 0)
+            {
+                Rn[idx] = R[1]*Rn1[multipole_index(t, u-1, v)];
+                if(u > 1)
+                    Rn[idx] += (u-1)*Rn1[multipole_index(t, u-2, v)];
+            }
+            else
+            {
+                Rn[idx] = R[2]*Rn1[multipole_index(t, u, v-1)];
+                if(v > 1)
+                    Rn[idx] += (v-1)*Rn1[multipole_index(t, u, v-2)];
+            }
+        }
+    }
+
+    std::copy(work, work + nmult, out);
+}
+
+
+
+void ChargeOctree::build(std::vector<double> * xyz, std::vector<double> & q,
+                         int order, size_t leafsize)
+{
+    order_ = order;
+    nmult_ = n_multipole(order);
+
+    // exponents and factorials of the multipole components
+    mindex_.clear();
+    invfac_.clear();
+
+    std::vector<double> fac(order+1, 1.0);
+    for(int i = 1; i <= order; i++)
+        fac[i] = fac[i-1]*i;
+
+    for(int l = 0; l <= order; l++)
+    for(int t = l; t >= 0; t--)
+    for(int u = l-t; u >= 0; u--)
+    {
+        const int v = l-t-u;
+        mindex_.push_back({{t, u, v}});
+        invfac_.push_back(1.0/(fac[t]*fac[u]*fac[v]));
+    }
+
+    // multipole to taylor translation
+    translation_.clear();
+    for(size_t j = 0; j < nmult_; j++)
+    for(size_t k = 0; k < nmult_; k++)
+    {
+        const auto & mj = mindex_[j];
+        const auto & mk = mindex_[k];
+
+        if(mj[0]+mj[1]+mj[2] + mk[0]+mk[1]+mk[2] <= order)
+            translation_.push_back({{j, k, multipole_index(mj[0]+mk[0], mj[1]+mk[1], mj[2]+mk[2])}});
+    }
+
+    nodes_.clear();
+    moments_.clear();
+
+    const size_t ncharge = q.size();
+    if(ncharge == 0)
+        return;
+
+    // bounding cube of all the charges
+    double minxyz[3], maxxyz[3];
+    for(int d = 0; d < 3; d++)
+    {
+        const auto mm = std::minmax_element(xyz[d].begin(), xyz[d].end());
+        minxyz[d] = *mm.first;
+        maxxyz[d] = *mm.second;
+    }
+
+    const double halfwidth = 0.5*std::max({ maxxyz[0]-minxyz[0],
+                                            maxxyz[1]-minxyz[1],
+                                            maxxyz[2]-minxyz[2] });
+
+    Node root;
+    for(int d = 0; d < 3; d++)
+        root.center[d] = 0.5*(minxyz[d] + maxxyz[d]);
+    root.radius = 0.0;
+    root.start = 0;
+    root.end = ncharge;
+    root.child = 0;
+    root.nchild = 0;
+    nodes_.push_back(root);
+
+    subdivide_(0, xyz, q, leafsize, halfwidth, 0);
+
+    moments_.resize(nodes_.size()*nmult_);
+    for(size_t i = 0; i < nodes_.size(); i++)
+        compute_moments_(i, xyz, q);
+}
+
+
+void ChargeOctree::subdivide_(size_t node, std::vector<double> * xyz, std::vector<double> & q,
+                              size_t leafsize, double halfwidth, int depth)
+{
+    const size_t start = nodes_[node].start;
+    const size_t end = nodes_[node].end;
+    const size_t count = end - start;
+
+    if(count <= leafsize || depth >= max_depth)
+        return;
+
+    const double center[3] = { nodes_[node].center[0],
+                               nodes_[node].center[1],
+                               nodes_[node].center[2] };
+
+    // find the octant of each charge, then sort
+    // the charges by octant (counting sort)
+    std::vector<int> octant(count);
+    size_t octcount[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    for(size_t i = 0; i < count; i++)
+    {
+        int oct = 0;
+        for(int d = 0; d < 3; d++)
+            if(xyz[d][start+i] >= center[d])
+                oct |= (1 << d);
+        octant[i] = oct;
+        octcount[oct]++;
+    }
+
+    size_t octstart[8];
+    octstart[0] = start;
+    for(int o = 1; o < 8; o++)
+        octstart[o] = octstart[o-1] + octcount[o-1];
+
+    size_t pos[8];
+    std::copy(octstart, octstart + 8, pos);
+
+    std::vector<double> tmp(count);
+    for(int d = 0; d < 4; d++)
+    {
+        std::vector<double> & v = (d < 3) ? xyz[d] : q;
+        std::copy(v.begin() + start, v.begin() + end, tmp.begin());
+
+        size_t p[8];
+        std::copy(pos, pos + 8, p);
+        for(size_t i = 0; i < count; i++)
+            v[p[octant[i]]++] = tmp[i];
+    }
+
+    // add the (nonempty) children. These are contiguous
+    const double childhalf = 0.5*halfwidth;
+    nodes_[node].child = nodes_.size();
+    nodes_[node].nchild = 0;
+
+    for(int o = 0; o < 8; o++)
+    {
+        if(octcount[o] == 0)
+            continue;
+
+        Node child;
+        for(int d = 0; d < 3; d++)
+            child.center[d] = center[d] + ((o & (1 << d)) ? childhalf : -childhalf);
+        child.radius = 0.0;
+        child.start = octstart[o];
+        child.end = octstart[o] + octcount[o];
+        child.child = 0;
+        child.nchild = 0;
+
+        nodes_.push_back(child);
+        nodes_[node].nchild++;
+    }
+
+    // nodes_ may be reallocated during recursion, so
+    // don't hold references
+    const size_t firstchild = nodes_[node].child;
+    const size_t nchild = nodes_[node].nchild;
+    for(size_t c = 0; c < nchild; c++)
+        subdivide_(firstchild + c, xyz, q, leafsize, childhalf, depth+1);
+}
+
+
+void ChargeOctree::compute_moments_(size_t node, const std::vector<double> * xyz,
+                                    const std::vector<double> & q)
+{
+    Node & nd = nodes_[node];
+    double * const M = moments_.data() + node*nmult_;
+    std::fill(M, M + nmult_, 0.0);
+
+    // powers of x, y, and z
+    std::vector<double> pw(3*(order_+1));
+
+    double maxr2 = 0.0;
+
+    for(size_t i = nd.start; i < nd.end; i++)
+    {
+        for(int d = 0; d < 3; d++)
+        {
+            double * const p = pw.data() + d*(order_+1);
+            const double r = xyz[d][i] - nd.center[d];
+            p[0] = 1.0;
+            for(int n = 1; n <= order_; n++)
+                p[n] = p[n-1]*r;
+        }
+
+        const double * const px = pw.data();
+        const double * const py = px + (order_+1);
+        const double * const pz = py + (order_+1);
+        maxr2 = std::max(maxr2, px[1]*px[1] + py[1]*py[1] + pz[1]*pz[1]);
+
+        for(size_t k = 0; k < nmult_; k++)
+        {
+            const auto & mk = mindex_[k];
+            M[k] += q[i] * px[mk[0]] * py[mk[1]] * pz[mk[2]];
+        }
+    }
+
+    for(size_t k = 0; k < nmult_; k++)
+    {
+        const auto & mk = mindex_[k];
+        const double sign = ((mk[0]+mk[1]+mk[2]) % 2) ? -1.0 : 1.0;
+        M[k] *= sign * invfac_[k];
+    }
+
+    nd.radius = sqrt(maxr2);
+}
+
+
+size_t ChargeOctree::far_field(const double X[3], double extent, double theta,
+                               double * D, std::vector<std::pair<size_t, size_t>> & near,
+                               double * work) const
+{
+    std::fill(D, D + nmult_, 0.0);
+    near.clear();
+
+    if(nodes_.size() == 0)
+        return 0;
+
+    double * const T = work;
+    double * const cdwork = work + nmult_;
+
+    size_t nfar = 0;
+
+    // Children are pushed in reverse so that the near
+    // ranges come out in order (and can be merged)
+    size_t stack[8*max_depth + 8];
+    size_t nstack = 0;
+    stack[nstack++] = 0;
+
+    while(nstack > 0)
+    {
+        const Node & nd = nodes_[stack[--nstack]];
+        const size_t nodeidx = &nd - nodes_.data();
+
+        const double R[3] = { X[0] - nd.center[0], X[1] - nd.center[1], X[2] - nd.center[2] };
+        const double dist = sqrt(R[0]*R[0] + R[1]*R[1] + R[2]*R[2]);
+
+        if(extent + nd.radius < theta*dist)
+        {
+            coulomb_derivatives(order_, R, T, cdwork);
+
+            double const * const Q = moments_.data() + nodeidx*nmult_;
+            for(const auto & tr : translation_)
+                D[tr[0]] += Q[tr[1]] * T[tr[2]];
+
+            nfar += nd.end - nd.start;
+        }
+        else if(nd.nchild == 0)
+        {
+            if(near.size() && near.back().second == nd.start)
+                near.back().second = nd.end;
+            else
+                near.emplace_back(nd.start, nd.end);
+        }
+        else
+        {
+            for(size_t c = nd.nchild; c > 0; c--)
+                stack[nstack++] = nd.child + c - 1;
+        }
+    }
+
+    for(size_t j = 0; j < nmult_; j++)
+        D[j] *= invfac_[j];
+
+    return nfar;
+}
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+/*! \brief Number of cartesian multipole components with total order [0, \p order] */
+inline size_t n_multipole(int order)
+{
+    return static_cast<size_t>((order+1)*(order+2)*(order+3)/6);
+}
+
+
+/*! \brief Index of the multipole component \f$ x^t y^u z^v \f$
+ *
+ * Components are ordered by total order, and then within
+ * an order the same way as cartesian gaussians.
+ */
+inline size_t multipole_index(int t, int u, int v)
+{
+    const int n = t + u + v;
+    const int uv = u + v;
+    return static_cast<size_t>(n*(n+1)*(n+2)/6 + uv*(uv+1)/2 + v);
+}
+
+
+/*! \brief Calculates all cartesian derivatives of \f$ 1/|R| \f$
+ *
+ * The derivative \f$ \partial_x^t \partial_y^u \partial_z^v |R|^{-1} \f$
+ * for all \f$ t+u+v \le \f$ \p order is stored in \p out[multipole_index(t,u,v)].
+ *
+ * This uses the McMurchie-Davidson recurrence for the Hermite Coulomb integrals
+ * in the limit of a point charge.
+ *
+ * \param [in] order Maximum total order of the derivatives
+ * \param [in] R The vector R
+ * \param [out] out Output buffer. Must hold n_multipole(order) elements
+ * \param [in] work Workspace. Must hold (order+1)*n_multipole(order) elements
+ */
+void coulomb_derivatives(int order, const double R[3], double * out, double * work);
+
+
+/*! \brief An octree of point charges, with multipole moments for each node
+ *
+ * The charges are sorted when the tree is built so that the charges belonging
+ * to any node are contiguous. Each node stores its moments
+ *
+ * \f[
+ *    Q_k = (-1)^{|k|} \sum_C q_C \frac{(C - Y)^k}{k!}
+ * \f]
+ *
+ * about the node center \f$ Y \f$, for all multi-indices \f$ |k| \le \f$ order.
+ * The potential of the node at a point \f$ X \f$ is then
+ * \f$ \sum_k Q_k \partial^k |X-Y|^{-1} \f$.
+ */
+class ChargeOctree
+{
+    public:
+        struct Node
+        {
+            double center[3];    //!< Center of the node (the moments are about this point)
+            double radius;       //!< Maximum distance of any charge in the node from the center
+            size_t start;        //!< Index of the first charge in the node
+            size_t end;          //!< Index of one past the last charge in the node
+            size_t child;        //!< Index of the first child node (children are contiguous)
+            size_t nchild;       //!< Number of child nodes (zero for a leaf)
+        };
+
+
+        /*! \brief Build the tree
+         *
+         * \p xyz and \p q are reordered so that the charges of each
+         * node are contiguous.
+         *
+         * \param [inout] xyz Coordinates of the charges (x, y, and z separately)
+         * \param [inout] q Values of the charges
+         * \param [in] order Maximum order of the multipole moments
+         * \param [in] leafsize Maximum number of charges in a leaf node
+         */
+        void build(std::vector<double> * xyz, std::vector<double> & q,
+                   int order, size_t leafsize);
+
+
+        /*! \brief Find the far-field potential about a point
+         *
+         * Nodes whose charges are well separated from a sphere of radius
+         * \p extent around \p X (ie, \f$ extent + radius < \theta |X - Y| \f$)
+         * are treated via their multipole moments. All other charges are
+         * returned in \p near as ranges [first, second) of charge indices.
+         *
+         * The far-field potential is returned as its Taylor expansion about \p X:
+         *
+         * \f[
+         *    \Phi(r) = \sum_j D_j (r - X)^j
+         * \f]
+         *
+         * for all \f$ |j| \le \f$ order, with \f$ D_j \f$ stored in \p D[multipole_index(j)].
+         *
+         * \param [in] X Point to expand about
+         * \param [in] extent Radius of the region the expansion should be valid in
+         * \param [in] theta Separation criterion
+         * \param [out] D Output buffer. Must hold n_multipole(order) elements
+         * \param [out] near Ranges of charges that must be treated exactly
+         * \param [in] work Workspace. Must hold far_field_worksize() elements
+         * \return The number of charges treated via the multipole expansion
+         */
+        size_t far_field(const double X[3], double extent, double theta,
+                         double * D, std::vector<std::pair<size_t, size_t>> & near,
+                         double * work) const;
+
+
+        /*! \brief Size of the workspace required by far_field */
+        size_t far_field_worksize(void) const { return (order_+2)*nmult_; }
+
+
+        /*! \brief Maximum order of the multipole moments */
+        int order(void) const { return order_; }
+
+        /*! \brief Exponents (t, u, v) of each multipole component, in order */
+        const std::vector<std::array<int, 3>> & multipole_components(void) const { return mindex_; }
+
+    private:
+        int order_;
+        size_t nmult_;
+
+        std::vector<Node> nodes_;
+        std::vector<double> moments_;  //!< Moments of node i start at i*nmult_
+
+        //! Exponents of each multipole component
+        std::vector<std::array<int, 3>> mindex_;
+
+        //! Multipole to Taylor translation. Each element is
+        //! the index of j, k, and j+k, for all |j|+|k| <= order
+        std::vector<std::array<size_t, 3>> translation_;
+
+        //! 1/(t! u! v!) for each multipole component
+        std::vector<double> invfac_;
+
+        void subdivide_(size_t node, std::vector<double> * xyz, std::vector<double> & q,
+                        size_t leafsize, double halfwidth, int depth);
+
+        void compute_moments_(size_t node, const std::vector<double> * xyz,
+                              const std::vector<double> & q);
+};
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
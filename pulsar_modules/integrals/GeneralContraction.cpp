@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cmath>
+
+#include <pulsar/math/EigenImpl.hpp>
+
+#include "Integrals/GeneralContraction.hpp"
+
+
+using namespace pulsar::system;
+
+
+namespace {
+
+typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrix;
+
+
+// Do all general contractions of a shell have the same (non-combined) AM?
+bool uniform_general_am(const BasisSetShell & sh)
+{
+    for(size_t g = 1; g < sh.n_general_contractions(); g++)
+        if(sh.general_am(g) != sh.general_am(0))
+            return false;
+    return sh.general_am(0) >= 0;
+}
+
+
+// Largest nprim*ncart over shells with uniform general contractions
+// (along with whether any shell has more than one general contraction)
+size_t max_primitive_cart(const BasisSet & bs, bool & general)
+{
+    size_t maxsize = 0;
+    for(size_t i = 0; i < bs.n_shell(); i++)
+    {
+        const BasisSetShell & sh = bs.shell(i);
+        if(!uniform_general_am(sh))
+            continue;
+
+        if(sh.n_general_contractions() > 1)
+            general = true;
+
+        maxsize = std::max(maxsize, sh.n_primitives() * n_cartesian_gaussian(sh.general_am(0)));
+    }
+    return maxsize;
+}
+
+} // close anonymous namespace
+
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+bool use_gemm_contraction(const BasisSetShell & sh1, const BasisSetShell & sh2)
+{
+    if(sh1.n_general_contractions() * sh2.n_general_contractions() == 1)
+        return false;
+
+    return uniform_general_am(sh1) && uniform_general_am(sh2);
+}
+
+
+
+size_t gemm_contraction_size(const BasisSet & bs1, const BasisSet & bs2)
+{
+    bool general = false;
+    const size_t max1 = max_primitive_cart(bs1, general);
+    const size_t max2 = max_primitive_cart(bs2, general);
+    return general ? max1*max2 : 0;
+}
+
+
+
+void contract_primitives(const ShellPairData & sp, const double * prim, size_t ncart,
+                         double scale, double * out)
+{
+    // coefficients are stored as [general contraction pair][primitive pair]
+    Eigen::Map<const RowMajorMatrix> C(sp.coef.data(), sp.ngen, sp.nprim);
+    Eigen::Map<const RowMajorMatrix> P(prim, sp.nprim, ncart);
+    Eigen::Map<RowMajorMatrix> O(out, sp.ngen, ncart);
+
+    O.noalias() = scale * C * P;
+}
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
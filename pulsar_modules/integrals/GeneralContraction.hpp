@@ -0,0 +1,52 @@
+#pragma once
+
+#include <pulsar/system/BasisSet.hpp>
+
+#include "Common/BasisSetCommon.hpp"
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+/*! \brief Should the general contraction of a pair of shells be done as a matrix product?
+ *
+ * This is the case if there is more than one pair of general contractions,
+ * and all general contractions of each shell have the same AM. The
+ * (cartesian) primitive integrals are then the same for each pair of
+ * general contractions, and only need to be formed once.
+ */
+bool use_gemm_contraction(const pulsar::system::BasisSetShell & sh1,
+                          const pulsar::system::BasisSetShell & sh2);
+
+
+/*! \brief Size of the primitive buffer (for a single component) for contract_primitives
+ *
+ * This is enough for any pair of shells for which use_gemm_contraction
+ * is true. Zero if the basis sets are not generally contracted.
+ */
+size_t gemm_contraction_size(const pulsar::system::BasisSet & bs1,
+                             const pulsar::system::BasisSet & bs2);
+
+
+/*! \brief Contract primitive integrals with the coefficients of all general contractions
+ *
+ * \p prim holds the primitive integrals (including all prefactors except for the
+ * contraction coefficients), stored as [primitive pair][cartesian pair]. For each
+ * pair of general contractions g,
+ *
+ *    out[g][n] = scale * sum_k coef[g][k] * prim[k][n]
+ *
+ * where coef are the coefficients stored in \p sp. This is done as a single
+ * matrix product, and \p out is the usual source layout (a block for each pair
+ * of general contractions).
+ *
+ * \param [in] ncart Number of cartesian pairs (for a single pair of general contractions)
+ */
+void contract_primitives(const ShellPairData & sp, const double * prim, size_t ncart,
+                         double scale, double * out);
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
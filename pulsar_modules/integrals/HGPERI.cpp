@@ -0,0 +1,375 @@
+#include <cmath>
+#include <algorithm>
+
+#include <pulsar/system/AOOrdering.hpp>
+#include <pulsar/constants.h>
+
+#include "Common/BasisSetCommon.hpp"
+#include "Integrals/HGPERI.hpp"
+#include "Integrals/HGPTerms.hpp"
+
+
+using namespace pulsar::exception;
+using namespace pulsar::system;
+using namespace pulsar::datastore;
+
+
+namespace {
+
+// Maximum degree of general contraction of any shell in a basis set
+size_t max_n_general_contractions(const BasisSet & bs)
+{
+    size_t ret = 0;
+    for(size_t i = 0; i < bs.n_shell(); i++)
+        ret = std::max(ret, bs.shell(i).n_general_contractions());
+    return ret;
+}
+
+// Number of contracted [e0|f0] for a single combination
+// of general contractions. Also fills in the offsets
+// if given.
+size_t contracted_size(int lab, int lcd, size_t * offsets)
+{
+    size_t total = 0;
+    for(int e = 0; e <= lab; e++)
+    for(int f = 0; f <= lcd; f++)
+    {
+        if(offsets != nullptr)
+            offsets[e*(lcd+1)+f] = total;
+        total += n_cartesian_gaussian(e) * n_cartesian_gaussian(f);
+    }
+    return total;
+}
+
+} // close anonymous namespace
+
+
+namespace psr_modules {
+namespace integrals {
+
+
+uint64_t HGPERI::calculate(size_t shell1, size_t shell2,
+                           size_t shell3, size_t shell4,
+                           double * outbuffer, size_t bufsize,
+                           IntegralWorkspace & ws) const
+{
+    detail::check_workspace(ws, worksize_, index_size_);
+
+    // partition the workspace
+    double * const boyswork = ws.data();
+    double * const vrrwork = ws.data() + vrrwork_offset_;
+    double * const contractedwork = ws.data() + contractedwork_offset_;
+    double * const ketwork = ws.data() + ketwork_offset_;
+    double * const hrrwork = ws.data() + hrrwork_offset_;
+    double * const transformwork = ws.data() + transformwork_offset_;
+    double * const sourcework = ws.data() + sourcework_offset_;
+
+    const BasisSetShell & sh1 = bs1_->shell(shell1);
+    const BasisSetShell & sh2 = bs2_->shell(shell2);
+    const BasisSetShell & sh3 = bs3_->shell(shell3);
+    const BasisSetShell & sh4 = bs4_->shell(shell4);
+
+    const size_t nfunc = sh1.n_functions() * sh2.n_functions() * sh3.n_functions() * sh4.n_functions();
+
+    if(bufsize < nfunc)
+        throw PulsarException("Buffer too small for ERI", "bufsize", bufsize, "nfunc", nfunc);
+
+    // degree of general contraction
+    const size_t ngen1 = sh1.n_general_contractions();
+    const size_t ngen2 = sh2.n_general_contractions();
+    const size_t ngen3 = sh3.n_general_contractions();
+    const size_t ngen4 = sh4.n_general_contractions();
+    const size_t ngen = ngen1*ngen2*ngen3*ngen4;
+
+    // The total AM of the shells. May be negative,
+    // so the absolute value is the maximum AM
+    const int lab = std::abs(sh1.am()) + std::abs(sh2.am());
+    const int lcd = std::abs(sh3.am()) + std::abs(sh4.am());
+    const int L = lab + lcd;
+
+    // Primitive data is read from the packed basis sets
+    const size_t p1 = packed1_->packed_index[shell1];
+    const size_t p2 = packed2_->packed_index[shell2];
+    const size_t p3 = packed3_->packed_index[shell3];
+    const size_t p4 = packed4_->packed_index[shell4];
+
+    // number of primitives
+    const size_t nprim1 = packed1_->nprim[p1];
+    const size_t nprim2 = packed2_->nprim[p2];
+    const size_t nprim3 = packed3_->nprim[p3];
+    const size_t nprim4 = packed4_->nprim[p4];
+
+    // exponents and coefficients ([g][primitive])
+    const double * const RESTRICT alpha1 = packed1_->alpha_ptr(p1);
+    const double * const RESTRICT alpha2 = packed2_->alpha_ptr(p2);
+    const double * const RESTRICT alpha3 = packed3_->alpha_ptr(p3);
+    const double * const RESTRICT alpha4 = packed4_->alpha_ptr(p4);
+    const double * const RESTRICT coef1 = packed1_->coef_ptr(p1);
+    const double * const RESTRICT coef2 = packed2_->coef_ptr(p2);
+    const double * const RESTRICT coef3 = packed3_->coef_ptr(p3);
+    const double * const RESTRICT coef4 = packed4_->coef_ptr(p4);
+
+    // AM of each general contraction
+    const int * const gam1 = packed1_->general_am.data() + packed1_->genstart[p1];
+    const int * const gam2 = packed2_->general_am.data() + packed2_->genstart[p2];
+    const int * const gam3 = packed3_->general_am.data() + packed3_->genstart[p3];
+    const int * const gam4 = packed4_->general_am.data() + packed4_->genstart[p4];
+
+    // coordinates
+    const double xyz1[3] = { packed1_->xyz[0][p1], packed1_->xyz[1][p1], packed1_->xyz[2][p1] };
+    const double xyz2[3] = { packed2_->xyz[0][p2], packed2_->xyz[1][p2], packed2_->xyz[2][p2] };
+    const double xyz3[3] = { packed3_->xyz[0][p3], packed3_->xyz[1][p3], packed3_->xyz[2][p3] };
+    const double xyz4[3] = { packed4_->xyz[0][p4], packed4_->xyz[1][p4], packed4_->xyz[2][p4] };
+
+    const double AB[3] = { xyz1[0] - xyz2[0], xyz1[1] - xyz2[1], xyz1[2] - xyz2[2] };
+    const double CD[3] = { xyz3[0] - xyz4[0], xyz3[1] - xyz4[1], xyz3[2] - xyz4[2] };
+    const double AB2 = AB[0]*AB[0] + AB[1]*AB[1] + AB[2]*AB[2];
+    const double CD2 = CD[0]*CD[0] + CD[1]*CD[1] + CD[2]*CD[2];
+
+    // Layout of the VRR workspace and the contracted integrals
+    size_t * const vrr_offsets = ws.index_data();
+    size_t * const con_offsets = vrr_offsets + index_size_/2;
+    detail::hgp_vrr_offsets(lab, lcd, vrr_offsets);
+    const size_t ncon = contracted_size(lab, lcd, con_offsets);
+
+    std::fill(contractedwork, contractedwork + ngen*ncon, 0.0);
+
+    // 2 * pi^(5/2)
+    const double twopi52 = 2.0*PI*PI*std::sqrt(PI);
+
+    for(size_t i = 0; i < nprim1; i++)
+    for(size_t j = 0; j < nprim2; j++)
+    {
+        const double a1 = alpha1[i];
+        const double a2 = alpha2[j];
+        const double p = a1 + a2;
+        const double oop = 1.0/p;
+        const double Kab = std::exp(-a1*a2*oop*AB2);
+
+        const double P[3] = { (a1*xyz1[0] + a2*xyz2[0])*oop,
+                              (a1*xyz1[1] + a2*xyz2[1])*oop,
+                              (a1*xyz1[2] + a2*xyz2[2])*oop };
+        const double PA[3] = { P[0] - xyz1[0], P[1] - xyz1[1], P[2] - xyz1[2] };
+
+        for(size_t k = 0; k < nprim3; k++)
+        for(size_t l = 0; l < nprim4; l++)
+        {
+            const double a3 = alpha3[k];
+            const double a4 = alpha4[l];
+            const double q = a3 + a4;
+            const double ooq = 1.0/q;
+            const double Kcd = std::exp(-a3*a4*ooq*CD2);
+
+            const double Q[3] = { (a3*xyz3[0] + a4*xyz4[0])*ooq,
+                                  (a3*xyz3[1] + a4*xyz4[1])*ooq,
+                                  (a3*xyz3[2] + a4*xyz4[2])*ooq };
+            const double QC[3] = { Q[0] - xyz3[0], Q[1] - xyz3[1], Q[2] - xyz3[2] };
+
+            const double oopq = 1.0/(p+q);
+            const double rho = p*q*oopq;
+
+            const double W[3] = { (p*P[0] + q*Q[0])*oopq,
+                                  (p*P[1] + q*Q[1])*oopq,
+                                  (p*P[2] + q*Q[2])*oopq };
+            const double WP[3] = { W[0] - P[0], W[1] - P[1], W[2] - P[2] };
+            const double WQ[3] = { W[0] - Q[0], W[1] - Q[1], W[2] - Q[2] };
+            const double PQ[3] = { P[0] - Q[0], P[1] - Q[1], P[2] - Q[2] };
+            const double PQ2 = PQ[0]*PQ[0] + PQ[1]*PQ[1] + PQ[2]*PQ[2];
+
+            // boys function, including the prefactor
+            detail::calculate_f(boyswork, L, rho*PQ2, boys_engine_);
+            const double prefac = twopi52 * oop * ooq * std::sqrt(oopq) * Kab * Kcd;
+            for(int m = 0; m <= L; m++)
+                boyswork[m] *= prefac;
+
+            detail::hgp_vrr(lab, lcd, boyswork, PA, WP, QC, WQ,
+                            0.5*oop, 0.5*ooq, 0.5*oopq, rho*oop, rho*ooq,
+                            vrr_offsets, vrrwork);
+
+            // accumulate into the contracted integrals
+            // for each combination of general contractions.
+            // Only the m = 0 values are needed (the start of each block)
+            double * conptr = contractedwork;
+            for(size_t g1 = 0; g1 < ngen1; g1++)
+            for(size_t g2 = 0; g2 < ngen2; g2++)
+            for(size_t g3 = 0; g3 < ngen3; g3++)
+            for(size_t g4 = 0; g4 < ngen4; g4++)
+            {
+                const double coef = coef1[g1*nprim1+i] * coef2[g2*nprim2+j]
+                                  * coef3[g3*nprim3+k] * coef4[g4*nprim4+l];
+
+                for(int e = gam1[g1]; e <= gam1[g1]+gam2[g2]; e++)
+                for(int f = gam3[g3]; f <= gam3[g3]+gam4[g4]; f++)
+                {
+                    const size_t n = n_cartesian_gaussian(e) * n_cartesian_gaussian(f);
+                    double * const RESTRICT dest = conptr + con_offsets[e*(lcd+1)+f];
+                    const double * const RESTRICT src = vrrwork + vrr_offsets[e*(lcd+1)+f];
+
+                    for(size_t n2 = 0; n2 < n; n2++)
+                        dest[n2] += coef * src[n2];
+                }
+
+                conptr += ncon;
+            }
+        } // end loop over primitives k, l
+    } // end loop over primitives i, j
+
+
+    // Horizontal recurrence for each combination of general contractions.
+    // Each block is transformed to spherical (if necessary) as soon
+    // as it is finished, directly into the output buffer
+    const bool spherical[4] = { detail::is_spherical(sh1), detail::is_spherical(sh2),
+                                detail::is_spherical(sh3), detail::is_spherical(sh4) };
+    const bool anyspherical = spherical[0] || spherical[1] || spherical[2] || spherical[3];
+
+    const double * src[PSR_MODULES_HGP_MAX_L+1];
+    const double * conptr = contractedwork;
+    double * outptr = outbuffer;
+
+    for(size_t g1 = 0; g1 < ngen1; g1++)
+    for(size_t g2 = 0; g2 < ngen2; g2++)
+    for(size_t g3 = 0; g3 < ngen3; g3++)
+    for(size_t g4 = 0; g4 < ngen4; g4++)
+    {
+        const int gam1 = sh1.general_am(g1);
+        const int gam2 = sh2.general_am(g2);
+        const int gam3 = sh3.general_am(g3);
+        const int gam4 = sh4.general_am(g4);
+
+        const size_t nket = n_cartesian_gaussian(gam3) * n_cartesian_gaussian(gam4);
+
+        // ket: [e0|f0] -> [e0|cd]
+        double * ketptr = ketwork;
+        const double * ketsrc[PSR_MODULES_HGP_MAX_L+1];
+
+        for(int e = gam1; e <= gam1+gam2; e++)
+        {
+            const size_t ncart_e = n_cartesian_gaussian(e);
+
+            for(int f = 0; f <= gam4; f++)
+                src[f] = conptr + con_offsets[e*(lcd+1)+gam3+f];
+
+            detail::hgp_hrr(gam3, gam4, CD, ncart_e, 1, src, ketptr, hrrwork);
+
+            ketsrc[e-gam1] = ketptr;
+            ketptr += ncart_e*nket;
+        }
+
+        // bra: [e0|cd] -> [ab|cd]. Cartesian integrals can go directly to the output
+        if(anyspherical)
+        {
+            detail::hgp_hrr(gam1, gam2, AB, 1, nket, ketsrc, sourcework, hrrwork);
+
+            const int gam[4] = { gam1, gam2, gam3, gam4 };
+            outptr += spherical_.transform_block(4, gam, spherical, sourcework, outptr, transformwork);
+        }
+        else
+        {
+            detail::hgp_hrr(gam1, gam2, AB, 1, nket, ketsrc, outptr, hrrwork);
+            outptr += n_cartesian_gaussian(gam1) * n_cartesian_gaussian(gam2) * nket;
+        }
+
+        conptr += ncon;
+    }
+
+    return nfunc;
+}
+
+
+
+uint64_t HGPERI::calculate_(size_t shell1, size_t shell2,
+                            size_t shell3, size_t shell4,
+                            double * outbuffer, size_t bufsize)
+{
+    return calculate(shell1, shell2, shell3, shell4, outbuffer, bufsize, work_);
+}
+
+
+
+void HGPERI::initialize_(unsigned int deriv,
+                         const Wavefunction & wfn,
+                         const BasisSet & bs1,
+                         const BasisSet & bs2,
+                         const BasisSet & bs3,
+                         const BasisSet & bs4)
+{
+    if(deriv != 0)
+        throw NotYetImplementedException("Not Yet Implemented: HGPERI integral with deriv != 0");
+
+    const std::string boysopt = options().get<std::string>("BOYS_ENGINE");
+    if(!boys_engine_from_string(boysopt, boys_engine_))
+        throw PulsarException("Unknown Boys function engine", "engine", boysopt);
+
+    // from common components
+    bs1_ = NormalizeBasis(cache(), out, bs1);
+    bs2_ = NormalizeBasis(cache(), out, bs2);
+    bs3_ = NormalizeBasis(cache(), out, bs3);
+    bs4_ = NormalizeBasis(cache(), out, bs4);
+
+    packed1_ = PackBasis(cache(), out, *bs1_);
+    packed2_ = PackBasis(cache(), out, *bs2_);
+    packed3_ = PackBasis(cache(), out, *bs3_);
+    packed4_ = PackBasis(cache(), out, *bs4_);
+
+    const int max1 = bs1_->max_am();
+    const int max2 = bs2_->max_am();
+    const int max3 = bs3_->max_am();
+    const int max4 = bs4_->max_am();
+    const int maxlab = max1 + max2;
+    const int maxlcd = max3 + max4;
+
+    spherical_ = detail::SphericalTransform(std::max(std::max(max1, max2), std::max(max3, max4)));
+
+    if(maxlab > PSR_MODULES_HGP_MAX_L || maxlcd > PSR_MODULES_HGP_MAX_L)
+        throw NotYetImplementedException("HGPERI does not support AM this high", "maxlab", maxlab, "maxlcd", maxlcd);
+
+    ///////////////////////////////////////
+    // Determine the size of the workspace
+    ///////////////////////////////////////
+    // offsets for the vrr and for the contracted integrals
+    const size_t noffsets = static_cast<size_t>((maxlab+1)*(maxlcd+1));
+    index_size_ = 2*noffsets;
+
+    std::vector<size_t> vrr_offsets(noffsets);
+    const size_t boyswork_size = static_cast<size_t>(maxlab + maxlcd + 1);
+    const size_t vrrwork_size = detail::hgp_vrr_offsets(maxlab, maxlcd, vrr_offsets.data());
+
+    const size_t maxngen = max_n_general_contractions(*bs1_) * max_n_general_contractions(*bs2_)
+                         * max_n_general_contractions(*bs3_) * max_n_general_contractions(*bs4_);
+    const size_t contractedwork_size = maxngen * contracted_size(maxlab, maxlcd, nullptr);
+
+    // [e0|cd] for all e, for the largest c and d
+    const size_t maxket = n_cartesian_gaussian(max3) * n_cartesian_gaussian(max4);
+    size_t ketwork_size = 0;
+    for(int e = 0; e <= maxlab; e++)
+        ketwork_size += n_cartesian_gaussian(e) * maxket;
+
+    // This overestimates a bit
+    const size_t hrrwork_size = std::max(detail::hgp_hrr_worksize(max3, max4, n_cartesian_gaussian(maxlab), 1),
+                                         detail::hgp_hrr_worksize(max1, max2, 1, maxket));
+
+    // Find the maximum number of cartesian functions, not including general contraction.
+    // Only a single block (combination of general contractions) is held
+    // in cartesian form at a time
+    const size_t maxsize1 = bs1_->max_property(n_cartesian_gaussian_for_shell_am);
+    const size_t maxsize2 = bs2_->max_property(n_cartesian_gaussian_for_shell_am);
+    const size_t maxsize3 = bs3_->max_property(n_cartesian_gaussian_for_shell_am);
+    const size_t maxsize4 = bs4_->max_property(n_cartesian_gaussian_for_shell_am);
+    const size_t sourcework_size = maxsize1*maxsize2*maxsize3*maxsize4;
+    const size_t transformwork_size = detail::SphericalTransform::worksize(4, sourcework_size);
+
+    // allocate all at once. The workspace is partitioned in calculate
+    vrrwork_offset_ = boyswork_size;
+    contractedwork_offset_ = vrrwork_offset_ + vrrwork_size;
+    ketwork_offset_ = contractedwork_offset_ + contractedwork_size;
+    hrrwork_offset_ = ketwork_offset_ + ketwork_size;
+    transformwork_offset_ = hrrwork_offset_ + hrrwork_size;
+    sourcework_offset_ = transformwork_offset_ + transformwork_size;
+    worksize_ = sourcework_offset_ + sourcework_size;
+
+    work_.resize(worksize_, index_size_);
+}
+
+
+} // close namespace integrals
+} // close namespace psr_modules
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <pulsar/modulebase/TwoElectronIntegral.hpp>
+
+#include "Common/BasisSetCommon.hpp"
+#include "Integrals/IntegralWorkspace.hpp"
+#include "Integrals/SphericalTransform.hpp"
+#include "Integrals/boys/Boys.hpp"
+
+namespace psr_modules {
+namespace integrals {
+
+
+/*! \brief Calculation of electron repulsion integrals via the
+ *         Head-Gordon-Pople algorithm
+ *
+ * The primitive integrals [e0|f0] are formed via the Obara-Saika vertical
+ * recurrence, and are contracted before angular momentum is transferred
+ * to the second and fourth centers via the horizontal recurrence.
+ */
+class HGPERI : public pulsar::modulebase::TwoElectronIntegral,
+               public detail::ReentrantTwoElectron
+{
+    public:
+        using pulsar::modulebase::TwoElectronIntegral::TwoElectronIntegral;
+
+        virtual void initialize_(unsigned int deriv,
+                                 const pulsar::datastore::Wavefunction & wfn,
+                                 const pulsar::system::BasisSet & bs1,
+                                 const pulsar::system::BasisSet & bs2,
+                                 const pulsar::system::BasisSet & bs3,
+                                 const pulsar::system::BasisSet & bs4);
+
+        virtual uint64_t calculate_(size_t shell1, size_t shell2,
+                                    size_t shell3, size_t shell4,
+                                    double * outbuffer, size_t bufsize);
+
+        using pulsar::modulebase::TwoElectronIntegral::calculate;
+
+        virtual size_t workspace_size(void) const { return worksize_; }
+
+        virtual size_t workspace_index_size(void) const { return index_size_; }
+
+        virtual uint64_t calculate(size_t shell1, size_t shell2,
+                                   size_t shell3, size_t shell4,
+                                   double * outbuffer, size_t bufsize,
+                                   IntegralWorkspace & ws) const;
+
+    private:
+        std::shared_ptr<const pulsar::system::BasisSet> bs1_, bs2_, bs3_, bs4_;
+        std::shared_ptr<const PackedBasis> packed1_, packed2_, packed3_, packed4_;
+        detail::SphericalTransform spherical_;
+
+        //! How the Boys function is evaluated
+        BoysEngine boys_engine_;
+
+        IntegralWorkspace work_;
+        size_t worksize_ = 0;
+        size_t index_size_ = 0;      //!< Offsets for the VRR and the contracted integrals
+
+        // Offsets of each part of the workspace. The Boys
+        // function values are at the beginning
+        size_t vrrwork_offset_;         //!< Primitive [e0|f0]^(m)
+        size_t contractedwork_offset_;  //!< Contracted [e0|f0], for all general contractions
+        size_t ketwork_offset_;         //!< [e0|cd], after the ket HRR
+        size_t hrrwork_offset_;         //!< Scratch space for the HRR
+        size_t transformwork_offset_;
+        size_t sourcework_offset_;
+};
+
+
+} // close namespace integrals
+} // close namespace psr_modules
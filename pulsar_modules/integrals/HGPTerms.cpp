@@ -0,0 +1,245 @@
+#include <cstring>
+
+#include "Integrals/HGPTerms.hpp"
+#include "Integrals/OSOneElectronPotential_LUT.hpp"
+
+// Number of cartesian functions for a given am
+#define NCART(am) ((((am)+1)*((am)+2))/2)
+
+using psr_modules::integrals::lut::am_recur_map;
+using psr_modules::integrals::lut::RecurInfo;
+
+
+namespace {
+
+// Index of a cartesian (given by its exponents on y and z) within
+// its shell. This is the ordering used by am_recur_map
+inline int cartesian_index(int j, int k)
+{
+    const int jk = j+k;
+    return (jk*(jk+1))/2 + k;
+}
+
+} // close anonymous namespace
+
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+size_t hgp_vrr_offsets(int lab, int lcd, size_t * offsets)
+{
+    const int L = lab + lcd;
+    size_t total = 0;
+
+    for(int e = 0; e <= lab; e++)
+    for(int f = 0; f <= lcd; f++)
+    {
+        offsets[e*(lcd+1)+f] = total;
+        total += static_cast<size_t>((L-e-f+1) * NCART(e) * NCART(f));
+    }
+
+    return total;
+}
+
+
+void hgp_vrr(int lab, int lcd, const double * F,
+             const double PA[3], const double WP[3],
+             const double QC[3], const double WQ[3],
+             double oo2p, double oo2q, double oo2pq,
+             double rop, double roq,
+             const size_t * offsets, double * work)
+{
+    const int L = lab + lcd;
+    const int nf = lcd + 1;
+
+    // [00|00]^(m)
+    std::memcpy(work + offsets[0], F, static_cast<size_t>(L+1)*sizeof(double));
+
+
+    ////////////////////////////////////////
+    // Bra side: [e0|00]^(m)
+    // Stored as [m][cartesian e]
+    ////////////////////////////////////////
+    for(int e = 1; e <= lab; e++)
+    {
+        const int ncart = NCART(e);
+        const int ncart1 = NCART(e-1);
+        const int ncart2 = (e > 1) ? NCART(e-2) : 0;
+        const int mmax = L - e;
+
+        double * const RESTRICT target = work + offsets[e*nf];
+        const double * const RESTRICT src1 = work + offsets[(e-1)*nf];
+        const double * const RESTRICT src2 = (e > 1) ? work + offsets[(e-2)*nf] : nullptr;
+
+        for(int c = 0; c < ncart; c++)
+        {
+            const RecurInfo & ri = am_recur_map[e][c];
+            const int d = ri.dir;
+            const int i1 = ri.idx[d][0];
+            const int i2 = ri.idx[d][1];
+
+            for(int m = 0; m <= mmax; m++)
+            {
+                double val = PA[d]*src1[m*ncart1+i1] + WP[d]*src1[(m+1)*ncart1+i1];
+
+                if(i2 >= 0)
+                {
+                    const double fac = (ri.ijk[d]-1) * oo2p;
+                    val += fac * (src2[m*ncart2+i2] - rop * src2[(m+1)*ncart2+i2]);
+                }
+
+                target[m*ncart+c] = val;
+            }
+        }
+    }
+
+
+    ////////////////////////////////////////
+    // Ket side: [e0|f0]^(m)
+    // Stored as [m][cartesian e][cartesian f]
+    ////////////////////////////////////////
+    for(int f = 1; f <= lcd; f++)
+    {
+        const int ncf = NCART(f);
+        const int ncf1 = NCART(f-1);
+        const int ncf2 = (f > 1) ? NCART(f-2) : 0;
+
+        for(int e = 0; e <= lab; e++)
+        {
+            const int nce = NCART(e);
+            const int nce1 = (e > 0) ? NCART(e-1) : 0;
+            const int mmax = L - e - f;
+
+            double * const RESTRICT target = work + offsets[e*nf+f];
+            const double * const RESTRICT src1 = work + offsets[e*nf+f-1];
+            const double * const RESTRICT src2 = (f > 1) ? work + offsets[e*nf+f-2] : nullptr;
+            const double * const RESTRICT src3 = (e > 0) ? work + offsets[(e-1)*nf+f-1] : nullptr;
+
+            for(int ce = 0; ce < nce; ce++)
+            {
+                const RecurInfo & rie = am_recur_map[e][ce];
+
+                for(int cf = 0; cf < ncf; cf++)
+                {
+                    const RecurInfo & rif = am_recur_map[f][cf];
+                    const int d = rif.dir;
+                    const int j1 = rif.idx[d][0];
+                    const int j2 = rif.idx[d][1];
+                    const int ed = rie.ijk[d];
+                    const int i1 = (ed > 0) ? rie.idx[d][0] : -1;
+
+                    const double fac2 = (rif.ijk[d]-1) * oo2q;
+                    const double fac3 = ed * oo2pq;
+
+                    for(int m = 0; m <= mmax; m++)
+                    {
+                        double val = QC[d]*src1[(m*nce+ce)*ncf1+j1]
+                                   + WQ[d]*src1[((m+1)*nce+ce)*ncf1+j1];
+
+                        if(j2 >= 0)
+                            val += fac2 * (src2[(m*nce+ce)*ncf2+j2] - roq * src2[((m+1)*nce+ce)*ncf2+j2]);
+
+                        if(i1 >= 0)
+                            val += fac3 * src3[((m+1)*nce1+i1)*ncf1+j1];
+
+                        target[(m*nce+ce)*ncf+cf] = val;
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+size_t hgp_hrr_worksize(int la, int lb, size_t outer, size_t inner)
+{
+    if(lb == 0)
+        return 0;
+
+    // Each level uses at most this much. Two levels are
+    // needed at any given time
+    size_t n = 0;
+    for(int k = 0; k <= lb; k++)
+        n += static_cast<size_t>(NCART(la+k) * NCART(lb));
+
+    return 2 * n * outer * inner;
+}
+
+
+void hgp_hrr(int la, int lb, const double AB[3],
+             size_t outer, size_t inner,
+             double const * const * src,
+             double * out, double * work)
+{
+    if(lb == 0)
+    {
+        std::memcpy(out, src[0], outer*static_cast<size_t>(NCART(la))*inner*sizeof(double));
+        return;
+    }
+
+    const size_t half = hgp_hrr_worksize(la, lb, outer, inner)/2;
+    double * const buf[2] = { work, work + half };
+
+    // Arrays of the previous and current levels
+    const double * prev[PSR_MODULES_HGP_MAX_L+1];
+    const double * cur[PSR_MODULES_HGP_MAX_L+1];
+
+    for(int k = 0; k <= lb; k++)
+        prev[k] = src[k];
+
+    for(int j = 1; j <= lb; j++)
+    {
+        const size_t nb = static_cast<size_t>(NCART(j));
+        const size_t nbm = static_cast<size_t>(NCART(j-1));
+        const std::vector<RecurInfo> & bmap = am_recur_map[j];
+
+        size_t off = 0;
+
+        for(int k = 0; k <= lb-j; k++)
+        {
+            const int lak = la + k;
+            const size_t na = static_cast<size_t>(NCART(lak));
+            const size_t nap = static_cast<size_t>(NCART(lak+1));
+            const std::vector<RecurInfo> & amap = am_recur_map[lak];
+
+            double * const RESTRICT dst = (j == lb) ? out : buf[j%2] + off;
+            const double * const RESTRICT hi = prev[k+1];
+            const double * const RESTRICT lo = prev[k];
+
+            for(size_t o = 0; o < outer; o++)
+            for(size_t a = 0; a < na; a++)
+            {
+                const int8_t * ijk = amap[a].ijk;
+
+                for(size_t b = 0; b < nb; b++)
+                {
+                    const int d = bmap[b].dir;
+                    const size_t bm = static_cast<size_t>(bmap[b].idx[d][0]);
+                    const size_t ap = static_cast<size_t>(cartesian_index(ijk[1] + (d == 1),
+                                                                          ijk[2] + (d == 2)));
+                    const double ab = AB[d];
+
+                    double * const RESTRICT dptr = dst + ((o*na+a)*nb+b)*inner;
+                    const double * const RESTRICT hptr = hi + ((o*nap+ap)*nbm+bm)*inner;
+                    const double * const RESTRICT lptr = lo + ((o*na+a)*nbm+bm)*inner;
+
+                    for(size_t i = 0; i < inner; i++)
+                        dptr[i] = hptr[i] + ab * lptr[i];
+                }
+            }
+
+            cur[k] = dst;
+            off += outer*na*nb*inner;
+        }
+
+        for(int k = 0; k <= lb-j; k++)
+            prev[k] = cur[k];
+    }
+}
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
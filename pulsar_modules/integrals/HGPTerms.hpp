@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+
+// Maximum value of am1+am2 (or am3+am4) supported by the recurrences.
+// This is limited by the size of lut::am_recur_map
+#define PSR_MODULES_HGP_MAX_L 12
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+/*! \brief Computes the storage offsets used by hgp_vrr
+ *
+ * The VRR produces \f$ [e0|f0]^{(m)} \f$ for all \f$ e \in [0, lab] \f$,
+ * \f$ f \in [0, lcd] \f$, and \f$ m \in [0, lab+lcd-e-f] \f$. The block for
+ * a given (e,f) starts at \p offsets[e*(lcd+1)+f] and is stored as
+ * [m][cartesian e][cartesian f]. Therefore, the \f$ m = 0 \f$ values
+ * (ie, the final [e0|f0] integrals) are the first ncart(e)*ncart(f) elements
+ * of each block.
+ *
+ * \param [in] lab Maximum AM on the bra side (ie, am1 + am2)
+ * \param [in] lcd Maximum AM on the ket side (ie, am3 + am4)
+ * \param [out] offsets Output buffer. Must hold (lab+1)*(lcd+1) elements
+ * \return The total size of the VRR workspace
+ */
+size_t hgp_vrr_offsets(int lab, int lcd, size_t * offsets);
+
+
+/*! \brief Obara-Saika vertical recurrence for a primitive quartet
+ *
+ * The recurrence is started from the (already scaled) Boys function values
+ * \f$ [00|00]^{(m)} \f$. The bra is then built via
+ *
+ * \f[
+ *   [e+1_i 0|00]^{(m)} = PA_i [e0|00]^{(m)} + WP_i [e0|00]^{(m+1)}
+ *                      + \frac{e_i}{2p} \left( [e-1_i 0|00]^{(m)} - \frac{\rho}{p} [e-1_i 0|00]^{(m+1)} \right)
+ * \f]
+ *
+ * and the ket via the equivalent equation, plus the cross term
+ * \f$ \frac{e_i}{2(p+q)} [e-1_i 0|f0]^{(m+1)} \f$.
+ *
+ * Cartesian indices are taken from lut::am_recur_map.
+ *
+ * \param [in] lab Maximum AM on the bra side
+ * \param [in] lcd Maximum AM on the ket side
+ * \param [in] F Scaled Boys function values. Must hold lab+lcd+1 elements
+ * \param [in] PA P - A
+ * \param [in] WP W - P
+ * \param [in] QC Q - C
+ * \param [in] WQ W - Q
+ * \param [in] oo2p 1/(2p)
+ * \param [in] oo2q 1/(2q)
+ * \param [in] oo2pq 1/(2(p+q))
+ * \param [in] rop rho/p
+ * \param [in] roq rho/q
+ * \param [in] offsets Offsets computed via hgp_vrr_offsets
+ * \param [out] work Output buffer, of the size returned by hgp_vrr_offsets
+ */
+void hgp_vrr(int lab, int lcd, const double * F,
+             const double PA[3], const double WP[3],
+             const double QC[3], const double WQ[3],
+             double oo2p, double oo2q, double oo2pq,
+             double rop, double roq,
+             const size_t * offsets, double * work);
+
+
+/*! \brief Workspace size needed for hgp_hrr
+ *
+ * \param [in] la AM of the first index of the result
+ * \param [in] lb AM of the second index of the result
+ * \param [in] outer Size of the dimension before the transformed indices
+ * \param [in] inner Size of the dimension after the transformed indices
+ */
+size_t hgp_hrr_worksize(int la, int lb, size_t outer, size_t inner);
+
+
+/*! \brief Horizontal recurrence relation
+ *
+ * Transfers angular momentum from the first to the second index via
+ *
+ * \f[
+ *   (a, b+1_i) = (a+1_i, b) + AB_i (a, b)
+ * \f]
+ *
+ * The source arrays \p src[k] (for \f$ k \in [0, lb] \f$) hold (a+k, 0) and
+ * are stored as [outer][cartesian a+k][inner]. The result is stored
+ * as [outer][cartesian a][cartesian b][inner].
+ *
+ * This is used for both the bra and the ket. For the ket, \p outer is the number
+ * of cartesians on the bra side and \p inner is 1. For the bra, \p outer is 1
+ * and \p inner is the number of cartesian pairs in the ket.
+ *
+ * \param [in] la AM of the first index of the result
+ * \param [in] lb AM of the second index of the result
+ * \param [in] AB Distance vector between the two centers (A - B)
+ * \param [in] outer Size of the dimension before the transformed indices
+ * \param [in] inner Size of the dimension after the transformed indices
+ * \param [in] src Pointers to the source arrays
+ * \param [out] out Output buffer
+ * \param [in] work Workspace, of the size given by hgp_hrr_worksize
+ */
+void hgp_hrr(int la, int lb, const double AB[3],
+             size_t outer, size_t inner,
+             double const * const * src,
+             double * out, double * work);
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
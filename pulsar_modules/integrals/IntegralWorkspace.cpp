@@ -0,0 +1,23 @@
+#include "Integrals/IntegralWorkspace.hpp"
+
+using namespace pulsar::exception;
+
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+void check_workspace(const IntegralWorkspace & ws, size_t required,
+                     size_t required_index)
+{
+    if(ws.size() < required || ws.index_size() < required_index)
+        throw PulsarException("Workspace is too small. Was it created by this module?",
+                              "size", ws.size(), "required", required,
+                              "index_size", ws.index_size(), "required_index", required_index);
+}
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
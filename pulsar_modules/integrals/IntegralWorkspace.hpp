@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Integrals/OneElectronBatch.hpp"
+
+namespace psr_modules {
+namespace integrals {
+
+
+/*! \brief Scratch space for calculating integrals with a module
+ *
+ * This holds all the memory a module modifies while calculating
+ * integrals. A single initialized module (with its normalized basis
+ * sets, shell pairs, etc) can be shared between threads, with each
+ * thread having its own workspace.
+ *
+ * Some modules also need integer scratch (offsets, indices), which
+ * is kept separately.
+ *
+ * Workspaces should be obtained from the module's make_workspace(),
+ * after the module has been initialized.
+ */
+class IntegralWorkspace
+{
+    public:
+        IntegralWorkspace() = default;
+
+        explicit IntegralWorkspace(size_t size, size_t index_size = 0)
+            : work_(size), index_(index_size) { }
+
+        double * data(void) { return work_.data(); }
+
+        size_t size(void) const { return work_.size(); }
+
+        size_t * index_data(void) { return index_.data(); }
+
+        size_t index_size(void) const { return index_.size(); }
+
+        void resize(size_t size, size_t index_size = 0)
+        {
+            work_.resize(size);
+            index_.resize(index_size);
+        }
+
+    private:
+        std::vector<double> work_;
+        std::vector<size_t> index_;
+};
+
+
+namespace detail {
+
+
+/*! \brief Interface for one-electron integral modules that can be
+ *         used from several threads at once
+ *
+ * The calculate functions here do not modify the module. All scratch
+ * space comes from the workspace passed in.
+ */
+class ReentrantOneElectron
+{
+    public:
+        virtual ~ReentrantOneElectron() = default;
+
+        /*! \brief Number of elements required in a workspace */
+        virtual size_t workspace_size(void) const = 0;
+
+        /*! \brief Create a workspace for use with this module */
+        IntegralWorkspace make_workspace(void) const
+        {
+            return IntegralWorkspace(workspace_size());
+        }
+
+        /*! \brief Calculate integrals for a pair of shells, using the given workspace
+         *
+         * The output is the same as for OneElectronIntegral::calculate
+         */
+        virtual uint64_t calculate(uint64_t shell1, uint64_t shell2,
+                                   double * outbuffer, size_t bufsize,
+                                   IntegralWorkspace & ws) const = 0;
+
+        /*! \brief Calculate integrals for a list of shell pairs, using the given workspace
+         *
+         * The output is the same as for OneElectronBatch::calculate_batch
+         */
+        virtual uint64_t calculate_batch(const ShellPairIndex * pairs, size_t npair,
+                                         double * outbuffer, size_t bufsize,
+                                         IntegralWorkspace & ws) const = 0;
+};
+
+
+/*! \brief Interface for two-electron integral modules that can be
+ *         used from several threads at once
+ *
+ * See ReentrantOneElectron
+ */
+class ReentrantTwoElectron
+{
+    public:
+        virtual ~ReentrantTwoElectron() = default;
+
+        /*! \brief Number of elements required in a workspace */
+        virtual size_t workspace_size(void) const = 0;
+
+        /*! \brief Number of integer elements required in a workspace */
+        virtual size_t workspace_index_size(void) const { return 0; }
+
+        /*! \brief Create a workspace for use with this module */
+        IntegralWorkspace make_workspace(void) const
+        {
+            return IntegralWorkspace(workspace_size(), workspace_index_size());
+        }
+
+        /*! \brief Calculate integrals for a shell quartet, using the given workspace
+         *
+         * The output is the same as for TwoElectronIntegral::calculate
+         */
+        virtual uint64_t calculate(size_t shell1, size_t shell2,
+                                   size_t shell3, size_t shell4,
+                                   double * outbuffer, size_t bufsize,
+                                   IntegralWorkspace & ws) const = 0;
+};
+
+
+/*! \brief Check that a workspace is large enough for a module
+ *
+ * \throw PulsarException if it isn't
+ */
+void check_workspace(const IntegralWorkspace & ws, size_t required,
+                     size_t required_index = 0);
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
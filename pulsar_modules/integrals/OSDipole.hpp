@@ -2,13 +2,19 @@
 
 #include <pulsar/modulebase/OneElectronIntegral.hpp>
 
+#include "Common/BasisSetCommon.hpp"
+#include "Integrals/IntegralWorkspace.hpp"
+#include "Integrals/SphericalTransform.hpp"
+
 namespace psr_modules {
 namespace integrals {
 
 
 /*! \brief Calculation of electronic dipole integrals via Obara-Saika recurrence
  */
-class OSDipole : public pulsar::modulebase::OneElectronIntegral
+class OSDipole : public pulsar::modulebase::OneElectronIntegral,
+                 public detail::OneElectronBatch,
+                 public detail::ReentrantOneElectron
 {
     public:
         using pulsar::modulebase::OneElectronIntegral::OneElectronIntegral;
@@ -23,14 +29,34 @@ class OSDipole : public pulsar::modulebase::OneElectronIntegral
         virtual uint64_t calculate_(uint64_t shell1, uint64_t shell2,
                                     double * outbuffer, size_t bufsize);
 
+        virtual uint64_t calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                         double * outbuffer, size_t bufsize);
+
+        using pulsar::modulebase::OneElectronIntegral::calculate;
+
+        virtual size_t workspace_size(void) const { return worksize_; }
+
+        virtual uint64_t calculate(uint64_t shell1, uint64_t shell2,
+                                   double * outbuffer, size_t bufsize,
+                                   IntegralWorkspace & ws) const;
+
+        virtual uint64_t calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                         double * outbuffer, size_t bufsize,
+                                         IntegralWorkspace & ws) const;
+
     private:
-        std::vector<double> work_;
+        //! Workspace used by calculate_
+        IntegralWorkspace work_;
 
-        double * transformwork_;
-        double * sourcework_;
-        double * xyzwork_[3];
+        // Partitioning of a workspace
+        size_t worksize_;            //!< Total size of a workspace
+        size_t xyzwork_size_;        //!< Size of the terms for each direction
+        size_t transformwork_size_;  //!< Size of the workspace for the spherical transform
+        size_t sourcework_size_;     //!< Size of the cartesian integrals
 
         std::shared_ptr<const pulsar::system::BasisSet> bs1_, bs2_;
+        std::shared_ptr<const ShellPairSet> shellpairs_;
+        detail::SphericalTransform spherical_;
 };
 
 
@@ -1,8 +1,11 @@
+#include <algorithm>
+
 #include <pulsar/system/AOOrdering.hpp>
-#include <pulsar/system/SphericalTransformIntegral.hpp>
 #include <pulsar/constants.h>
 
 #include "Common/BasisSetCommon.hpp"
+#include "Integrals/GeneralContraction.hpp"
+#include "Integrals/OSOneElectronKernels.hpp"
 #include "Integrals/OSKineticEnergy.hpp"
 
 
@@ -17,9 +20,20 @@ using namespace pulsar::datastore;
 namespace psr_modules {
 namespace integrals {
 
-uint64_t OSKineticEnergy::calculate_(uint64_t shell1, uint64_t shell2,
-                                     double * outbuffer, size_t bufsize)
+uint64_t OSKineticEnergy::calculate(uint64_t shell1, uint64_t shell2,
+                                    double * outbuffer, size_t bufsize,
+                                    IntegralWorkspace & ws) const
 {
+    detail::check_workspace(ws, worksize_);
+
+    // partition the workspace
+    double * xyzwork[6];
+    for(int d = 0; d < 6; d++)
+        xyzwork[d] = ws.data() + d*xyzwork_size_;
+    double * const transformwork = ws.data() + 6*xyzwork_size_;
+    double * const sourcework = transformwork + transformwork_size_;
+    double * const primwork = sourcework + sourcework_size_;
+
     const BasisSetShell & sh1 = bs1_->shell(shell1);
     const BasisSetShell & sh2 = bs2_->shell(shell2);
 
@@ -28,11 +42,40 @@ uint64_t OSKineticEnergy::calculate_(uint64_t shell1, uint64_t shell2,
     if(bufsize < nfunc)
         throw PulsarException("Buffer is too small", "size", bufsize, "required", nfunc);
 
+    // precomputed primitive pair data
+    const ShellPairData & sp = shellpairs_->pair(shell1, shell2);
+
+    // shell pair is negligible
+    if(sp.nprim == 0)
+    {
+        std::fill(outbuffer, outbuffer + nfunc, 0.0);
+        return nfunc;
+    }
 
     // degree of general contraction
     size_t ngen1 = sh1.n_general_contractions();
     size_t ngen2 = sh2.n_general_contractions();
 
+    // Use the AM-specialized kernel if there is one. These only handle
+    // a single (non-combined) contraction on each shell
+    if(ngen1 == 1 && ngen2 == 1)
+    {
+        const detail::OneElectronKernel kernel = detail::kinetic_kernel(sh1.am(), sh2.am());
+        if(kernel)
+        {
+            // cartesian integrals can go directly to the output
+            if(!detail::is_spherical(sh1) && !detail::is_spherical(sh2))
+            {
+                kernel(sp, outbuffer);
+                return nfunc;
+            }
+
+            kernel(sp, sourcework);
+            spherical_.transform_2center(sh1, sh2, sourcework, outbuffer, transformwork, 1);
+            return nfunc;
+        }
+    }
+
     ////////////////////////////////////////
     // These vectors store the ordering of
     // cartesian basis functions for each
@@ -53,21 +96,32 @@ uint64_t OSKineticEnergy::calculate_(uint64_t shell1, uint64_t shell2,
     const int am2 = sh2.am();
 
 
-    // coordinates from each shell
-    const CoordType xyz1 = sh1.get_coords();
-    const CoordType xyz2 = sh2.get_coords();
-
-    const double AB[3] = { xyz1[0] - xyz2[0], xyz1[1] - xyz2[1], xyz1[2] - xyz2[2] };
-    const double AB2[3] = { AB[0]*AB[0], AB[1]*AB[1], AB[2]*AB[2] };
-
     // Used for dimensioning and loops. Storage goes from
     // [0, am], so we need to add one.
     const int nam1 = std::abs(am1) + 1;
     const int nam2 = std::abs(am2) + 1;
 
-    // We need to zero the workspace. Actually, not all of it,
-    // but this is easier
-    std::fill(work_.begin(), work_.end(), 0.0);
+    // number of cartesian functions, including general contraction
+    size_t ncart1 = 0, ncart2 = 0;
+    for(const auto & ord : sh1_ordering)
+        ncart1 += ord->size();
+    for(const auto & ord : sh2_ordering)
+        ncart2 += ord->size();
+
+    // For general contractions of a single AM, the primitive integrals
+    // are only formed once for each primitive pair (in primwork), and are
+    // contracted with the coefficients afterwards as a matrix product
+    const bool gemm = detail::use_gemm_contraction(sh1, sh2);
+    const size_t nloop1 = gemm ? 1 : ngen1;
+    const size_t nloop2 = gemm ? 1 : ngen2;
+    const size_t nprimcart = sh1_ordering[0]->size() * sh2_ordering[0]->size();
+
+    // Only the part of the buffer used by this pair needs
+    // to be zeroed. The recurrence terms are always overwritten.
+    if(gemm)
+        std::fill(primwork, primwork + sp.nprim*nprimcart, 0.0);
+    else
+        std::fill(sourcework, sourcework + ncart1*ncart2, 0.0);
 
     /////////////////////////////////////////////////////////
     // General notes about the following
@@ -86,118 +140,143 @@ uint64_t OSKineticEnergy::calculate_(uint64_t shell1, uint64_t shell2,
     //
     // Also note that we build the OS overlap cartesian terms directly here, rather
     // than a call to os_overlap_terms.
+    //
+    // Like os_overlap_terms, S_00 is taken to be 1 in each direction. The
+    // remaining prefactor (pi/p)^(3/2)*exp(-mu*AB2) is applied with the
+    // coefficients (since T_ij is linear in S_00).
     /////////////////////////////////////////////////////////
-    // loop over primitives
-    const size_t nprim1 = sh1.n_primitives();
-    const size_t nprim2 = sh2.n_primitives();
 
-    for(size_t a = 0; a < nprim1; a++)
+    // loop over primitive pairs
+    for(size_t k = 0; k < sp.nprim; k++)
     {
-        const double a1 = sh1.alpha(a);
-        const double a1xyz[3] = { a1*xyz1[0], a1*xyz1[1], a1*xyz1[2] };
+        const double a1 = sp.alpha1[k];
+        const double a2 = sp.alpha2[k];
         const double a1sq = 2.0*a1*a1;
+        const double oop = sp.oop[k];  // = 1/p = 1/(a1 + a2)
+        const double mu = sp.mu[k];    // (a1*a2)/(a1+a2)
+        const double oo2p = 0.5*oop;
 
-        for(size_t b = 0; b < nprim2; b++)
-        {
-            const double a2 = sh2.alpha(b);
-            const double oop = 1.0/(a1 + a2); // = 1/p = 1/(a1 + a2)
-            const double mu = a1*a2*oop;   // (a1*a2)/(a1+a2)
+        const double PA[3] = { sp.PA[0][k], sp.PA[1][k], sp.PA[2][k] };
+        const double PB[3] = { sp.PB[0][k], sp.PB[1][k], sp.PB[2][k] };
+        const double PA2[3] = { PA[0]*PA[0], PA[1]*PA[1], PA[2]*PA[2] };
 
+        // (pi/p)^(3/2). exp(-mu*AB2) is included in the coefficients
+        const double pfac = PI * oop * sqrt(PI * oop);
 
-            const double oo2p = 0.5*oop;
-            const double a2xyz[3] = { a2*xyz2[0], a2*xyz2[1], a2*xyz2[2] };
+        // three cartesian directions
+        for(int d = 0; d < 3; d++)
+        {
+            // the workspace for this direction
+            // THSE ARE THEN ACCESSED THROUGH THE S_IJ AND T_IJ MACROS
+            double * const RESTRICT s_ij = xyzwork[d];
+            double * const RESTRICT t_ij = xyzwork[d+3];
 
-            const double P[3] = { (a1xyz[0]+a2xyz[0])*oop,
-                                  (a1xyz[1]+a2xyz[1])*oop,
-                                  (a1xyz[2]+a2xyz[2])*oop };
+            S_IJ(0,0) = 1.0;
+            T_IJ(0,0) = S_IJ(0,0)*(a1 - a1sq*(PA2[d] + oo2p));
 
-            const double PA[3] = { P[0] - xyz1[0], P[1] - xyz1[1], P[2] - xyz1[2] };
-            const double PB[3] = { P[0] - xyz2[0], P[1] - xyz2[1], P[2] - xyz2[2] };
-            const double PA2[3] = { PA[0]*PA[0], PA[1]*PA[1], PA[2]*PA[2] };
+            // do j = 0 for all remaining i
+            for(int i = 1; i < nam1; i++)
+            {
+                S_IJ(i,0) = PA[d]*S_IJ(i-1,0);
+                if(i > 1)
+                    S_IJ(i,0) += (i-1)*oo2p*S_IJ(i-2,0);
 
+                T_IJ(i,0) = PA[d]*T_IJ(i-1,0) + 2*mu*S_IJ(i,0);
+                if(i > 1)
+                    T_IJ(i,0) += (i-1)*oo2p*T_IJ(i-2,0) - a2*oop*(i-1)*S_IJ(i-2,0);
+            }
 
-            // three cartesian directions
-            for(int d = 0; d < 3; d++)
+            // now do i = 0 for all remaining j
+            for(int j = 1; j < nam2; j++)
             {
-                // the workspace for this direction
-                // THSE ARE THEN ACCESSED THROUGH THE S_IJ AND T_IJ MACROS
-                double * const RESTRICT s_ij = xyzwork_[d];
-                double * const RESTRICT t_ij = xyzwork_[d+3];
-
-                S_IJ(0,0) = sqrt(PI * oop) * exp(-mu * AB2[d]);
-                T_IJ(0,0) = S_IJ(0,0)*(a1 - a1sq*(PA2[d] + oo2p));
-
-                // do j = 0 for all remaining i
-                for(int i = 1; i < nam1; i++)
-                {
-                    S_IJ(i,0) = PA[d]*S_IJ(i-1,0);
-                    if(i > 1)
-                        S_IJ(i,0) += (i-1)*oo2p*S_IJ(i-2,0);
-
-                    T_IJ(i,0) = PA[d]*T_IJ(i-1,0) + 2*mu*S_IJ(i,0);
-                    if(i > 1)
-                        T_IJ(i,0) += (i-1)*oo2p*T_IJ(i-2,0) - a2*oop*(i-1)*S_IJ(i-2,0);
-                }
-
-                // now do i = 0 for all remaining j
-                for(int j = 1; j < nam2; j++)
-                {
-                    S_IJ(0,j) = PB[d]*S_IJ(0,j-1);
-                    if(j > 1)
-                        S_IJ(0,j) += (j-1)*oo2p*S_IJ(0,j-2);
-                    T_IJ(0,j) = PB[d]*T_IJ(0,j-1) + 2*mu*S_IJ(0,j); 
-                    if(j > 1)
-                        T_IJ(0,j) += (j-1)*oo2p*T_IJ(0,j-2) - a1*oop*(j-1)*S_IJ(0,j-2);
-                }
-
-                // now all the rest
-                for(int i = 1; i < nam1; i++)
-                for(int j = 1; j < nam2; j++)
-                {
-                    S_IJ(i,j) = PB[d]*S_IJ(i,j-1) + oo2p*i*S_IJ(i-1,j-1);
-                    if(j > 1)
-                        S_IJ(i,j) += oo2p*(j-1)*S_IJ(i,j-2);
-                    T_IJ(i,j) = PB[d]*T_IJ(i,j-1) + oo2p*i*T_IJ(i-1,j-1) + 2*mu*S_IJ(i,j);
-                    if(j > 1)
-                        T_IJ(i,j) += oo2p*(j-1)*T_IJ(i,j-2) - a1*oop*(j-1)*S_IJ(i,j-2);
-                }
+                S_IJ(0,j) = PB[d]*S_IJ(0,j-1);
+                if(j > 1)
+                    S_IJ(0,j) += (j-1)*oo2p*S_IJ(0,j-2);
+                T_IJ(0,j) = PB[d]*T_IJ(0,j-1) + 2*mu*S_IJ(0,j); 
+                if(j > 1)
+                    T_IJ(0,j) += (j-1)*oo2p*T_IJ(0,j-2) - a1*oop*(j-1)*S_IJ(0,j-2);
             }
 
-            // general contraction and combined am
-            size_t outidx = 0;
-            for(size_t g1 = 0; g1 < ngen1; g1++)
-            for(size_t g2 = 0; g2 < ngen2; g2++)
+            // now all the rest
+            for(int i = 1; i < nam1; i++)
+            for(int j = 1; j < nam2; j++)
             {
-                const double prefac = sh1.coef(g1, a) * sh2.coef(g2, b);
-
-                // go over the orderings for this AM
-                for(const IJK & ijk1 : *(sh1_ordering[g1]))
-                for(const IJK & ijk2 : *(sh2_ordering[g2]))
-                {
-                    const int xidx = ijk1[0]*nam2 + ijk2[0];
-                    const int yidx = ijk1[1]*nam2 + ijk2[1];
-                    const int zidx = ijk1[2]*nam2 + ijk2[2];
-
-                                                                                              // vv from MEST vv
-                    const double val = xyzwork_[3][xidx]*xyzwork_[1][yidx]*xyzwork_[2][zidx]  // Tij*Skl*Smn
-                                     + xyzwork_[0][xidx]*xyzwork_[4][yidx]*xyzwork_[2][zidx]  // Sij*Tkl*Smn
-                                     + xyzwork_[0][xidx]*xyzwork_[1][yidx]*xyzwork_[5][zidx]; // Sij*Skl*Tmn
-
-                    // remember: a and b are indices of primitives
-                    sourcework_[outidx++] += prefac * val;
-                }
+                S_IJ(i,j) = PB[d]*S_IJ(i,j-1) + oo2p*i*S_IJ(i-1,j-1);
+                if(j > 1)
+                    S_IJ(i,j) += oo2p*(j-1)*S_IJ(i,j-2);
+                T_IJ(i,j) = PB[d]*T_IJ(i,j-1) + oo2p*i*T_IJ(i-1,j-1) + 2*mu*S_IJ(i,j);
+                if(j > 1)
+                    T_IJ(i,j) += oo2p*(j-1)*T_IJ(i,j-2) - a1*oop*(j-1)*S_IJ(i,j-2);
+            }
+        }
+
+        // general contraction and combined am
+        size_t outidx = 0;
+        double * const dest = gemm ? primwork + k*nprimcart : sourcework;
+        for(size_t g1 = 0; g1 < nloop1; g1++)
+        for(size_t g2 = 0; g2 < nloop2; g2++)
+        {
+            const double prefac = gemm ? pfac : pfac * sp.coef[(g1*ngen2 + g2)*sp.nprim + k];
+
+            // go over the orderings for this AM
+            for(const IJK & ijk1 : *(sh1_ordering[g1]))
+            for(const IJK & ijk2 : *(sh2_ordering[g2]))
+            {
+                const int xidx = ijk1[0]*nam2 + ijk2[0];
+                const int yidx = ijk1[1]*nam2 + ijk2[1];
+                const int zidx = ijk1[2]*nam2 + ijk2[2];
+
+                                                                                          // vv from MEST vv
+                const double val = xyzwork[3][xidx]*xyzwork[1][yidx]*xyzwork[2][zidx]  // Tij*Skl*Smn
+                                 + xyzwork[0][xidx]*xyzwork[4][yidx]*xyzwork[2][zidx]  // Sij*Tkl*Smn
+                                 + xyzwork[0][xidx]*xyzwork[1][yidx]*xyzwork[5][zidx]; // Sij*Skl*Tmn
+
+                // remember: k is the index of the primitive pair
+                dest[outidx++] += prefac * val;
             }
         }
     }
 
-    // performs the spherical transform, if necessary
-    CartesianToSpherical_2Center(sh1, sh2, sourcework_, outbuffer, transformwork_, 1);
+    if(gemm)
+        detail::contract_primitives(sp, primwork, nprimcart, 1.0, sourcework);
+
+    // performs the spherical transform of each block, if necessary
+    spherical_.transform_2center(sh1, sh2, sourcework, outbuffer, transformwork, 1);
 
     return nfunc;
 }
 
 
 
+uint64_t OSKineticEnergy::calculate_(uint64_t shell1, uint64_t shell2,
+                                     double * outbuffer, size_t bufsize)
+{
+    return calculate(shell1, shell2, outbuffer, bufsize, work_);
+}
+
+
+
+uint64_t OSKineticEnergy::calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                          double * outbuffer, size_t bufsize)
+{
+    return calculate_batch(pairs, npair, outbuffer, bufsize, work_);
+}
+
+
+
+uint64_t OSKineticEnergy::calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                          double * outbuffer, size_t bufsize,
+                                          IntegralWorkspace & ws) const
+{
+    // calls calculate directly, bypassing the module base
+    auto calc = [this, &ws](uint64_t shell1, uint64_t shell2, double * buf, size_t size)
+                { return OSKineticEnergy::calculate(shell1, shell2, buf, size, ws); };
+
+    return detail::batch_loop(calc, 1, pairs, npair, outbuffer, bufsize);
+}
+
+
+
 void OSKineticEnergy::initialize_(unsigned int deriv,
                                   const Wavefunction & wfn,
                                   const BasisSet & bs1,
@@ -209,6 +288,9 @@ void OSKineticEnergy::initialize_(unsigned int deriv,
     // from common components
     bs1_ = NormalizeBasis(cache(), out, bs1);
     bs2_ = NormalizeBasis(cache(), out, bs2);
+    shellpairs_ = ShellPairs(cache(), out, *bs1_, *bs2_,
+                             options().get<double>("SCREEN_THRESHOLD"), ScreenKinetic);
+    spherical_ = detail::SphericalTransform(std::max(bs1_->max_am(), bs2_->max_am()));
 
     ///////////////////////////////////////
     // Determine the size of the workspace
@@ -229,16 +311,15 @@ void OSKineticEnergy::initialize_(unsigned int deriv,
     maxsize2 = bs2_->max_property(n_cartesian_gaussian_in_shell);
     size_t sourcework_size = maxsize1 * maxsize2;
 
-    // allocate all at once, then partition
-    work_.resize(6*worksize + transformwork_size + sourcework_size);
-    xyzwork_[0] = work_.data();
-    xyzwork_[1] = xyzwork_[0] + worksize;
-    xyzwork_[2] = xyzwork_[1] + worksize;
-    xyzwork_[3] = xyzwork_[2] + worksize;
-    xyzwork_[4] = xyzwork_[3] + worksize;
-    xyzwork_[5] = xyzwork_[4] + worksize;
-    transformwork_ = xyzwork_[5] + worksize;
-    sourcework_ = transformwork_ + transformwork_size;
+    // primitive integrals for the general contraction via matrix products
+    size_t primwork_size = detail::gemm_contraction_size(*bs1_, *bs2_);
+
+    // allocate all at once. The workspace is partitioned in calculate
+    xyzwork_size_ = worksize;
+    transformwork_size_ = transformwork_size;
+    sourcework_size_ = sourcework_size;
+    worksize_ = 6*worksize + transformwork_size + sourcework_size + primwork_size;
+    work_.resize(worksize_);
 }
 
 } // close namespace integrals
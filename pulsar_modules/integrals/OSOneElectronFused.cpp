@@ -0,0 +1,296 @@
+#include <algorithm>
+#include <cmath>
+
+#include <pulsar/system/AOOrdering.hpp>
+#include <pulsar/constants.h>
+
+#include "Common/BasisSetCommon.hpp"
+#include "Integrals/GeneralContraction.hpp"
+#include "Integrals/OSOverlapTerms.hpp"
+#include "Integrals/OSOneElectronFused.hpp"
+#include "Integrals/OSOneElectronPotential_LUT.hpp"
+
+
+using namespace pulsar::exception;
+using namespace pulsar::system;
+using namespace pulsar::datastore;
+
+
+namespace psr_modules {
+namespace integrals {
+
+
+uint64_t OSOneElectronFused::calculate(uint64_t shell1, uint64_t shell2,
+                                       double * outbuffer, size_t bufsize,
+                                       IntegralWorkspace & ws) const
+{
+    detail::check_workspace(ws, workspace_size());
+
+    // partition the workspace. The first part is used by the potential
+    PairWork pw = pair_work_(ws);
+
+    double * sterms[3];
+    double * tterms[3];
+    double * ptr = ws.data() + OSOneElectronPotential::workspace_size();
+    for(int d = 0; d < 3; d++)
+    {
+        sterms[d] = ptr;
+        ptr += sterms_size_;
+    }
+    for(int d = 0; d < 3; d++)
+    {
+        tterms[d] = ptr;
+        ptr += tterms_size_;
+    }
+    double * const fusedsource = ptr;
+    double * const primwork = fusedsource + source_size_;
+
+    const BasisSetShell & sh1 = bs1_->shell(shell1);
+    const BasisSetShell & sh2 = bs2_->shell(shell2);
+
+    const size_t nfunc = sh1.n_functions() * sh2.n_functions();
+    const unsigned int ncomp = n_components_();
+
+    if(bufsize < ncomp*nfunc)
+        throw PulsarException("Buffer is too small", "size", bufsize, "required", ncomp*nfunc);
+
+    // precomputed primitive pair data
+    const ShellPairData & sp = shellpairs_->pair(shell1, shell2);
+
+    // shell pair is negligible
+    if(sp.nprim == 0)
+    {
+        std::fill(outbuffer, outbuffer + ncomp*nfunc, 0.0);
+        return nfunc;
+    }
+
+    // degree of general contraction
+    const size_t ngen1 = sh1.n_general_contractions();
+    const size_t ngen2 = sh2.n_general_contractions();
+
+    // used for loops
+    const int absam1 = std::abs(sh1.am());
+    const int absam2 = std::abs(sh2.am());
+
+    // Dimensions of the overlap terms. The kinetic energy terms
+    // need up to j+2 (which also covers j+1 for the dipole)
+    const int nam1 = absam1 + 1;
+    const int nam2 = absam2 + 1;
+    const int nams2 = absam2 + 3;
+
+    // number of cartesian functions in the (cartesian) source buffer
+    size_t ncart1 = 0, ncart2 = 0;
+    for(size_t g1 = 0; g1 < ngen1; g1++)
+        ncart1 += n_cartesian_gaussian(sh1.general_am(g1));
+    for(size_t g2 = 0; g2 < ngen2; g2++)
+        ncart2 += n_cartesian_gaussian(sh2.general_am(g2));
+
+    const size_t ncart = ncart1*ncart2;
+
+    // For general contractions of a single AM, the primitive integrals
+    // are only formed once for each primitive pair (in primwork, a plane
+    // for each component), and are contracted with the coefficients
+    // afterwards as a matrix product
+    const bool gemm = detail::use_gemm_contraction(sh1, sh2);
+    const size_t nloop1 = gemm ? 1 : ngen1;
+    const size_t nloop2 = gemm ? 1 : ngen2;
+    const size_t nprimcart = n_cartesian_gaussian(sh1.general_am(0))
+                           * n_cartesian_gaussian(sh2.general_am(0));
+
+    const size_t plane = gemm ? sp.nprim*nprimcart : ncart;
+    double * const planebase = gemm ? primwork : fusedsource;
+    std::fill(planebase, planebase + ncomp*plane, 0.0);
+
+    // coordinates of the second shell (for the dipole
+    // terms, which are shifted from the origin)
+    const double * xyz2 = sh2.coords_ptr();
+
+    prepare_pair_(sh1, sh2, sp, pw);
+
+    /////////////////////////////////////////////////////////
+    // General notes about the following
+    //
+    // The overlap terms S_ij for each direction are formed once
+    // per primitive pair. The kinetic energy terms are then
+    //
+    //   T_ij = a2(2j+1) S_ij - 2 a2^2 S_i,j+2 - j(j-1)/2 S_i,j-2
+    //
+    // and the dipole terms are S_i,j+1 + B S_ij. The potential
+    // integrals (summed over point charges) come from primitive_pair_.
+    //
+    // As in the separate modules, S_00 is taken to be 1 and the
+    // prefactors are applied with the coefficients.
+    /////////////////////////////////////////////////////////
+    for(size_t k = 0; k < sp.nprim; k++)
+    {
+        // charge-weighted potential integrals, in pw.acc
+        primitive_pair_(sp, k, pw);
+
+        const double PA[3] = { sp.PA[0][k], sp.PA[1][k], sp.PA[2][k] };
+        const double PB[3] = { sp.PB[0][k], sp.PB[1][k], sp.PB[2][k] };
+        const double oop = sp.oop[k];
+        const double a2 = sp.alpha2[k];
+
+        // (pi/p)^(3/2) for the overlap-like terms, 2*pi/p for the potential
+        // exp(-mu*AB2) is included in the coefficients
+        const double pfac = PI * oop * sqrt(PI * oop);
+        const double vfac = 2.0 * PI * oop;
+
+        detail::os_overlap_terms(PA, PB, 0.5*oop, nam1, nams2, sterms);
+
+        for(int d = 0; d < 3; d++)
+        {
+            double const * const RESTRICT s_ij = sterms[d];
+            double * const RESTRICT t_ij = tterms[d];
+
+            for(int i = 0; i < nam1; i++)
+            for(int j = 0; j < nam2; j++)
+            {
+                double val = a2*(2*j+1)*s_ij[i*nams2+j] - 2.0*a2*a2*s_ij[i*nams2+j+2];
+                if(j > 1)
+                    val -= 0.5*j*(j-1)*s_ij[i*nams2+j-2];
+                t_ij[i*nam2+j] = val;
+            }
+        }
+
+        // where the integrals of this primitive pair go
+        double * const RESTRICT splane = planebase + (gemm ? k*nprimcart : 0);
+        double * const RESTRICT tplane = splane + plane;
+        double * const RESTRICT vplane = tplane + plane;
+        double * const RESTRICT dplane[3] = { vplane + plane, vplane + 2*plane, vplane + 3*plane };
+
+        // general contraction and combined am
+        size_t outidx = 0;
+        for(size_t g1 = 0; g1 < nloop1; g1++)
+        for(size_t g2 = 0; g2 < nloop2; g2++)
+        {
+            const int gam1 = sh1.general_am(g1);
+            const int gam2 = sh2.general_am(g2);
+
+            // coefficients are applied afterwards for the matrix product
+            const double coef = gemm ? 1.0 : sp.coef[(g1*ngen2 + g2)*sp.nprim + k];
+            const double scoef = pfac * coef;
+            const double vcoef = vfac * coef;
+
+            double const * const RESTRICT accptr = pw.acc(gam1, gam2);
+            size_t accidx = 0;
+
+            for(const auto & cart1 : lut::am_recur_map[gam1])
+            for(const auto & cart2 : lut::am_recur_map[gam2])
+            {
+                const int xs = cart1.ijk[0]*nams2 + cart2.ijk[0];
+                const int ys = cart1.ijk[1]*nams2 + cart2.ijk[1];
+                const int zs = cart1.ijk[2]*nams2 + cart2.ijk[2];
+
+                const int xt = cart1.ijk[0]*nam2 + cart2.ijk[0];
+                const int yt = cart1.ijk[1]*nam2 + cart2.ijk[1];
+                const int zt = cart1.ijk[2]*nam2 + cart2.ijk[2];
+
+                const double Sx = sterms[0][xs];
+                const double Sy = sterms[1][ys];
+                const double Sz = sterms[2][zs];
+
+                splane[outidx] += scoef * Sx*Sy*Sz;
+                tplane[outidx] += scoef * (tterms[0][xt]*Sy*Sz +
+                                           Sx*tterms[1][yt]*Sz +
+                                           Sx*Sy*tterms[2][zt]);
+
+                // the subtraction takes care of the minus sign
+                vplane[outidx] -= vcoef * accptr[accidx++];
+
+                if(dipole_)
+                {
+                    dplane[0][outidx] -= scoef * (sterms[0][xs+1] + Sx*xyz2[0]) * Sy * Sz;
+                    dplane[1][outidx] -= scoef * Sx * (sterms[1][ys+1] + Sy*xyz2[1]) * Sz;
+                    dplane[2][outidx] -= scoef * Sx * Sy * (sterms[2][zs+1] + Sz*xyz2[2]);
+                }
+
+                outidx++;
+            }
+        }
+    }
+
+    if(gemm)
+    {
+        for(unsigned int c = 0; c < ncomp; c++)
+            detail::contract_primitives(sp, primwork + c*plane, nprimcart,
+                                        1.0, fusedsource + c*ncart);
+    }
+
+    // performs the spherical transform of each block, if necessary
+    spherical_.transform_2center(sh1, sh2, fusedsource, outbuffer, pw.transformwork, ncomp);
+
+    return nfunc;
+}
+
+
+
+uint64_t OSOneElectronFused::calculate_(uint64_t shell1, uint64_t shell2,
+                                        double * outbuffer, size_t bufsize)
+{
+    return calculate(shell1, shell2, outbuffer, bufsize, work_);
+}
+
+
+
+uint64_t OSOneElectronFused::calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                             double * outbuffer, size_t bufsize)
+{
+    return calculate_batch(pairs, npair, outbuffer, bufsize, work_);
+}
+
+
+
+uint64_t OSOneElectronFused::calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                             double * outbuffer, size_t bufsize,
+                                             IntegralWorkspace & ws) const
+{
+    // calls calculate directly, bypassing the module base
+    auto calc = [this, &ws](uint64_t shell1, uint64_t shell2, double * buf, size_t size)
+                { return OSOneElectronFused::calculate(shell1, shell2, buf, size, ws); };
+
+    return detail::batch_loop(calc, n_components_(), pairs, npair, outbuffer, bufsize);
+}
+
+
+
+void OSOneElectronFused::initialize_(unsigned int deriv,
+                                     const Wavefunction & wfn,
+                                     const BasisSet & bs1,
+                                     const BasisSet & bs2)
+{
+    if(deriv != 0)
+        throw NotYetImplementedException("Not Yet Implemented: OSOneElectronFused integral with deriv != 0");
+
+    // needed for screening the shell pairs
+    dipole_ = options().get<bool>("DIPOLE");
+
+    // point charges, potential workspace, and shell pairs
+    OSOneElectronPotential::initialize_(deriv, wfn, bs1, bs2);
+
+    ///////////////////////////////////////
+    // Determine the size of the workspace
+    ///////////////////////////////////////
+
+    // storage size for each x,y,z component
+    int max1 = bs1_->max_am();
+    int max2 = bs2_->max_am();
+    sterms_size_ = (max1+1)*(max2+3);  // for each component, we store [0, am+2]
+    tterms_size_ = (max1+1)*(max2+1);
+
+    // find the maximum number of cartesian functions, including general contraction
+    size_t maxsize1 = bs1_->max_property(n_cartesian_gaussian_in_shell);
+    size_t maxsize2 = bs2_->max_property(n_cartesian_gaussian_in_shell);
+    source_size_ = n_components_() * maxsize1 * maxsize2;
+
+    // primitive integrals for the general contraction via matrix products
+    prim_size_ = n_components_() * detail::gemm_contraction_size(*bs1_, *bs2_);
+
+    // the workspace holds the potential part followed by ours.
+    // It is partitioned in calculate
+    work_.resize(workspace_size());
+}
+
+
+} // close namespace integrals
+} // close namespace psr_modules
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Integrals/OSOneElectronPotential.hpp"
+
+namespace psr_modules {
+namespace integrals {
+
+
+/*! \brief Calculation of overlap, kinetic energy, potential, and (optionally) dipole
+ *         integrals in a single pass via Obara-Saika recurrence
+ *
+ * All integrals are formed in the same loop over primitive pairs, sharing
+ * the overlap terms (the kinetic energy and dipole terms are formed from
+ * them directly). The point charges for the potential are set up the same
+ * way as OSOneElectronPotential, and the same options apply.
+ *
+ * Each type of integral is written to a separate plane of the output
+ * buffer (each plane holding the integrals for the pair of shells), in
+ * the order overlap, kinetic, potential, and then the x, y, and z dipole
+ * components if the DIPOLE option is set.
+ */
+class OSOneElectronFused : public OSOneElectronPotential
+{
+    public:
+        using OSOneElectronPotential::OSOneElectronPotential;
+
+        virtual void initialize_(unsigned int deriv,
+                                 const pulsar::datastore::Wavefunction & wfn,
+                                 const pulsar::system::BasisSet & bs1,
+                                 const pulsar::system::BasisSet & bs2);
+
+        virtual unsigned int n_components_(void) const { return dipole_ ? 6 : 3; }
+
+        virtual uint64_t calculate_(uint64_t shell1, uint64_t shell2,
+                                    double * outbuffer, size_t bufsize);
+
+        virtual uint64_t calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                         double * outbuffer, size_t bufsize);
+
+        using OSOneElectronPotential::calculate;
+
+        virtual size_t workspace_size(void) const
+        {
+            return OSOneElectronPotential::workspace_size() + 3*sterms_size_ + 3*tterms_size_ + source_size_ + prim_size_;
+        }
+
+        virtual uint64_t calculate(uint64_t shell1, uint64_t shell2,
+                                   double * outbuffer, size_t bufsize,
+                                   IntegralWorkspace & ws) const;
+
+        virtual uint64_t calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                         double * outbuffer, size_t bufsize,
+                                         IntegralWorkspace & ws) const;
+
+    protected:
+        virtual unsigned int screen_operators_(void) const
+        {
+            return ScreenOverlap | ScreenKinetic | ScreenPotential | (dipole_ ? ScreenDipole : 0u);
+        }
+
+    private:
+        //! Calculate the dipole integrals as well
+        bool dipole_ = false;
+
+        // Sizes of the parts of the workspace, which follow
+        // the workspace of the potential
+        size_t sterms_size_ = 0;  //!< Overlap terms for each direction
+        size_t tterms_size_ = 0;  //!< Kinetic energy terms for each direction
+        size_t source_size_ = 0;  //!< Cartesian integrals, one plane for each component
+        size_t prim_size_ = 0;    //!< Primitive integrals for the general contraction via matrix products
+};
+
+
+} // close namespace integrals
+} // close namespace psr_modules
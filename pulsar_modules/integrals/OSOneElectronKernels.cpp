@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <cmath>
+
+#include <pulsar/constants.h>
+
+#include "Integrals/OSOneElectronKernels.hpp"
+
+
+namespace {
+
+using psr_modules::integrals::detail::max_kernel_am;
+
+// Exponents of the cartesian gaussians for each AM, in the
+// same order as lut::am_recur_map. Unlike am_recur_map, this
+// is a plain array so that indexing it with the (unrolled)
+// loop indices below is resolved at compile time.
+const int cart_exp[max_kernel_am+1][15][3] = {
+    { {0,0,0} },
+    { {1,0,0}, {0,1,0}, {0,0,1} },
+    { {2,0,0}, {1,1,0}, {1,0,1}, {0,2,0}, {0,1,1}, {0,0,2} },
+    { {3,0,0}, {2,1,0}, {2,0,1}, {1,2,0}, {1,1,1}, {1,0,2},
+      {0,3,0}, {0,2,1}, {0,1,2}, {0,0,3} },
+    { {4,0,0}, {3,1,0}, {3,0,1}, {2,2,0}, {2,1,1}, {2,0,2},
+      {1,3,0}, {1,2,1}, {1,1,2}, {1,0,3}, {0,4,0}, {0,3,1},
+      {0,2,2}, {0,1,3}, {0,0,4} }
+};
+
+
+/*! \brief One-dimensional overlap terms (see os_overlap_terms)
+ *
+ * Same recurrence as os_overlap_terms, but with the number of
+ * terms known at compile time, so the branches disappear when unrolled.
+ */
+template<int NAM1, int NAM2>
+inline void overlap_terms_1d(const double PA, const double PB, const double oo2p,
+                             double * RESTRICT s_ij)
+{
+    s_ij[0] = 1.0;
+
+    for(int i = 1; i < NAM1; i++)
+    {
+        s_ij[i*NAM2] = PA*s_ij[(i-1)*NAM2];
+        if(i > 1)
+            s_ij[i*NAM2] += (i-1)*oo2p*s_ij[(i-2)*NAM2];
+    }
+
+    for(int j = 1; j < NAM2; j++)
+    {
+        s_ij[j] = PB*s_ij[j-1];
+        if(j > 1)
+            s_ij[j] += (j-1)*oo2p*s_ij[j-2];
+    }
+
+    for(int i = 1; i < NAM1; i++)
+    for(int j = 1; j < NAM2; j++)
+    {
+        s_ij[i*NAM2+j] = PB*s_ij[i*NAM2+j-1] + oo2p*i*s_ij[(i-1)*NAM2+j-1];
+        if(j > 1)
+            s_ij[i*NAM2+j] += oo2p*(j-1)*s_ij[i*NAM2+j-2];
+    }
+}
+
+
+/*! \brief One-dimensional overlap and kinetic energy terms
+ *
+ * Same recurrence as in OSKineticEnergy::calculate_
+ */
+template<int NAM1, int NAM2>
+inline void kinetic_terms_1d(const double PA, const double PB, const double oo2p,
+                             const double a1, const double a2, const double mu,
+                             double * RESTRICT s_ij, double * RESTRICT t_ij)
+{
+    const double oop = 2.0*oo2p;
+
+    overlap_terms_1d<NAM1, NAM2>(PA, PB, oo2p, s_ij);
+
+    t_ij[0] = a1 - 2.0*a1*a1*(PA*PA + oo2p);
+
+    for(int i = 1; i < NAM1; i++)
+    {
+        t_ij[i*NAM2] = PA*t_ij[(i-1)*NAM2] + 2*mu*s_ij[i*NAM2];
+        if(i > 1)
+            t_ij[i*NAM2] += (i-1)*oo2p*t_ij[(i-2)*NAM2] - a2*oop*(i-1)*s_ij[(i-2)*NAM2];
+    }
+
+    for(int j = 1; j < NAM2; j++)
+    {
+        t_ij[j] = PB*t_ij[j-1] + 2*mu*s_ij[j];
+        if(j > 1)
+            t_ij[j] += (j-1)*oo2p*t_ij[j-2] - a1*oop*(j-1)*s_ij[j-2];
+    }
+
+    for(int i = 1; i < NAM1; i++)
+    for(int j = 1; j < NAM2; j++)
+    {
+        t_ij[i*NAM2+j] = PB*t_ij[i*NAM2+j-1] + oo2p*i*t_ij[(i-1)*NAM2+j-1] + 2*mu*s_ij[i*NAM2+j];
+        if(j > 1)
+            t_ij[i*NAM2+j] += oo2p*(j-1)*t_ij[i*NAM2+j-2] - a1*oop*(j-1)*s_ij[i*NAM2+j-2];
+    }
+}
+
+
+template<int L1, int L2>
+void overlap_kernel_(const ShellPairData & sp, double * RESTRICT out)
+{
+    const int nam1 = L1+1;
+    const int nam2 = L2+1;
+    const int ncart1 = (L1+1)*(L1+2)/2;
+    const int ncart2 = (L2+1)*(L2+2)/2;
+
+    double s_ij[3][nam1*nam2];
+
+    std::fill(out, out + ncart1*ncart2, 0.0);
+
+    for(size_t k = 0; k < sp.nprim; k++)
+    {
+        const double oop = sp.oop[k];
+        const double oo2p = 0.5*oop;
+
+        // (pi/p)^(3/2). exp(-mu*AB2) is included in the coefficients
+        const double prefac = PI * oop * sqrt(PI * oop) * sp.coef[k];
+
+        for(int d = 0; d < 3; d++)
+            overlap_terms_1d<nam1, nam2>(sp.PA[d][k], sp.PB[d][k], oo2p, s_ij[d]);
+
+        for(int c1 = 0; c1 < ncart1; c1++)
+        for(int c2 = 0; c2 < ncart2; c2++)
+        {
+            const int * const ijk1 = cart_exp[L1][c1];
+            const int * const ijk2 = cart_exp[L2][c2];
+
+            out[c1*ncart2 + c2] += prefac * s_ij[0][ijk1[0]*nam2 + ijk2[0]]
+                                          * s_ij[1][ijk1[1]*nam2 + ijk2[1]]
+                                          * s_ij[2][ijk1[2]*nam2 + ijk2[2]];
+        }
+    }
+}
+
+
+template<int L1, int L2>
+void kinetic_kernel_(const ShellPairData & sp, double * RESTRICT out)
+{
+    const int nam1 = L1+1;
+    const int nam2 = L2+1;
+    const int ncart1 = (L1+1)*(L1+2)/2;
+    const int ncart2 = (L2+1)*(L2+2)/2;
+
+    double s_ij[3][nam1*nam2];
+    double t_ij[3][nam1*nam2];
+
+    std::fill(out, out + ncart1*ncart2, 0.0);
+
+    for(size_t k = 0; k < sp.nprim; k++)
+    {
+        const double oop = sp.oop[k];
+        const double oo2p = 0.5*oop;
+
+        // (pi/p)^(3/2). exp(-mu*AB2) is included in the coefficients
+        const double prefac = PI * oop * sqrt(PI * oop) * sp.coef[k];
+
+        for(int d = 0; d < 3; d++)
+            kinetic_terms_1d<nam1, nam2>(sp.PA[d][k], sp.PB[d][k], oo2p,
+                                         sp.alpha1[k], sp.alpha2[k], sp.mu[k],
+                                         s_ij[d], t_ij[d]);
+
+        for(int c1 = 0; c1 < ncart1; c1++)
+        for(int c2 = 0; c2 < ncart2; c2++)
+        {
+            const int * const ijk1 = cart_exp[L1][c1];
+            const int * const ijk2 = cart_exp[L2][c2];
+
+            const int xidx = ijk1[0]*nam2 + ijk2[0];
+            const int yidx = ijk1[1]*nam2 + ijk2[1];
+            const int zidx = ijk1[2]*nam2 + ijk2[2];
+
+            const double val = t_ij[0][xidx]*s_ij[1][yidx]*s_ij[2][zidx]
+                             + s_ij[0][xidx]*t_ij[1][yidx]*s_ij[2][zidx]
+                             + s_ij[0][xidx]*s_ij[1][yidx]*t_ij[2][zidx];
+
+            out[c1*ncart2 + c2] += prefac * val;
+        }
+    }
+}
+
+
+// Dispatch tables, indexed by [am1][am2]
+#define KERNEL_ROW(kernel, L1) \
+    { kernel<L1, 0>, kernel<L1, 1>, kernel<L1, 2>, kernel<L1, 3>, kernel<L1, 4> }
+
+const psr_modules::integrals::detail::OneElectronKernel
+overlap_kernels[max_kernel_am+1][max_kernel_am+1] = {
+    KERNEL_ROW(overlap_kernel_, 0),
+    KERNEL_ROW(overlap_kernel_, 1),
+    KERNEL_ROW(overlap_kernel_, 2),
+    KERNEL_ROW(overlap_kernel_, 3),
+    KERNEL_ROW(overlap_kernel_, 4)
+};
+
+const psr_modules::integrals::detail::OneElectronKernel
+kinetic_kernels[max_kernel_am+1][max_kernel_am+1] = {
+    KERNEL_ROW(kinetic_kernel_, 0),
+    KERNEL_ROW(kinetic_kernel_, 1),
+    KERNEL_ROW(kinetic_kernel_, 2),
+    KERNEL_ROW(kinetic_kernel_, 3),
+    KERNEL_ROW(kinetic_kernel_, 4)
+};
+
+#undef KERNEL_ROW
+
+} // close anonymous namespace
+
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+OneElectronKernel overlap_kernel(int am1, int am2)
+{
+    if(am1 < 0 || am2 < 0 || am1 > max_kernel_am || am2 > max_kernel_am)
+        return nullptr;
+    return overlap_kernels[am1][am2];
+}
+
+
+OneElectronKernel kinetic_kernel(int am1, int am2)
+{
+    if(am1 < 0 || am2 < 0 || am1 > max_kernel_am || am2 > max_kernel_am)
+        return nullptr;
+    return kinetic_kernels[am1][am2];
+}
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
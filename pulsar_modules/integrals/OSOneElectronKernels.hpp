@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Common/BasisSetCommon.hpp"
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+/*! \brief Maximum angular momentum with a specialized one-electron kernel */
+const int max_kernel_am = 4;
+
+
+/*! \brief A specialized kernel for a pair of shells
+ *
+ * The kernel calculates all primitive pairs of \p sp and contracts them
+ * into the cartesian buffer \p out, which is overwritten. The cartesian
+ * functions are in the same order as lut::am_recur_map.
+ *
+ * Kernels only handle shells with a single (non-combined) general
+ * contraction, so the coefficients of the pair are sp.coef[k].
+ *
+ * \param [in] sp The precomputed data for the pair of shells
+ * \param [out] out Cartesian integrals. Must hold ncart(am1)*ncart(am2) elements
+ */
+typedef void (*OneElectronKernel)(const ShellPairData & sp, double * out);
+
+
+/*! \brief Get the specialized overlap kernel for a pair of angular momenta
+ *
+ * \return The kernel, or nullptr if there isn't one (ie, combined AM
+ *         or angular momentum greater than max_kernel_am)
+ */
+OneElectronKernel overlap_kernel(int am1, int am2);
+
+
+/*! \brief Get the specialized kinetic energy kernel for a pair of angular momenta
+ *
+ * \return The kernel, or nullptr if there isn't one (ie, combined AM
+ *         or angular momentum greater than max_kernel_am)
+ */
+OneElectronKernel kinetic_kernel(int am1, int am2);
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
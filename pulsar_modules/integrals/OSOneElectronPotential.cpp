@@ -1,10 +1,15 @@
+#include <algorithm>
+#include <cmath>
+
 #include <pulsar/system/AOOrdering.hpp>
-#include <pulsar/system/SphericalTransformIntegral.hpp>
 #include <pulsar/math/Factorial.hpp>
 #include <pulsar/constants.h>
 
 #include "Common/BasisSetCommon.hpp"
+#include "Integrals/GeneralContraction.hpp"
 #include "Integrals/boys/Boys.hpp"
+#include "Integrals/boys/Boys_batch.hpp"
+#include "Integrals/OSOverlapTerms.hpp"
 #include "Integrals/OSOneElectronPotential.hpp"
 #include "Integrals/OSOneElectronPotential_LUT.hpp"
 
@@ -15,16 +20,36 @@ using namespace pulsar::datastore;
 using namespace pulsar::math;
 
 
+namespace {
+
+// Maximum number of point charges processed at once in the
+// recurrence. The workspace scales with this.
+const size_t max_charge_block = 8;
+
+// Maximum number of charges in a leaf of the octree
+// used for the far-field approximation
+const size_t farfield_leafsize = 32;
+
+// Maximum order of the far-field multipole expansion
+const int farfield_max_order = 16;
+
+// The charge distribution of a primitive pair is taken to extend
+// to where exp(-p r^2) falls below exp(-farfield_logtol)
+const double farfield_logtol = 30.0;
+
+} // close anonymous namespace
+
+
 namespace psr_modules {
 namespace integrals {
 
 
-uint64_t OSOneElectronPotential::calculate_with_grid_(uint64_t shell1, uint64_t shell2,
-                                                      const Grid & grid,
-                                                      double * outbuffer, size_t bufsize)
+uint64_t OSOneElectronPotential::calculate(uint64_t shell1, uint64_t shell2,
+                                           double * outbuffer, size_t bufsize,
+                                           IntegralWorkspace & ws) const
 {
-    if(!sys_)
-        throw PulsarException("No system given");
+    detail::check_workspace(ws, worksize_);
+    PairWork pw = pair_work_(ws);
 
     const BasisSetShell & sh1 = bs1_->shell(shell1);
     const BasisSetShell & sh2 = bs2_->shell(shell2);
@@ -34,306 +59,777 @@ uint64_t OSOneElectronPotential::calculate_with_grid_(uint64_t shell1, uint64_t
     if(bufsize < nfunc)
         throw PulsarException("Buffer is too small", "size", bufsize, "required", nfunc);
 
+    // precomputed primitive pair data
+    const ShellPairData & sp = shellpairs_->pair(shell1, shell2);
+
+    // shell pair is negligible
+    if(sp.nprim == 0)
+    {
+        std::fill(outbuffer, outbuffer + nfunc, 0.0);
+        return nfunc;
+    }
+
     // degree of general contraction
     size_t ngen1 = sh1.n_general_contractions();
     size_t ngen2 = sh2.n_general_contractions();
 
+    // number of cartesian functions in the (cartesian) source buffer
+    size_t ncart1 = 0, ncart2 = 0;
+    for(size_t g1 = 0; g1 < ngen1; g1++)
+        ncart1 += n_cartesian_gaussian(sh1.general_am(g1));
+    for(size_t g2 = 0; g2 < ngen2; g2++)
+        ncart2 += n_cartesian_gaussian(sh2.general_am(g2));
+
+    // For general contractions of a single AM, the charge-weighted integrals
+    // of each primitive pair are stored (in pw.primwork) and contracted with
+    // the coefficients afterwards as a matrix product
+    const bool gemm = detail::use_gemm_contraction(sh1, sh2);
+    const int gemmam1 = sh1.general_am(0);
+    const int gemmam2 = sh2.general_am(0);
+    const size_t nprimcart = n_cartesian_gaussian(gemmam1)*n_cartesian_gaussian(gemmam2);
+
+    if(!gemm)
+        std::fill(pw.sourcework, pw.sourcework + ncart1*ncart2, 0.0);
+
+    prepare_pair_(sh1, sh2, sp, pw);
+
+    for(size_t k = 0; k < sp.nprim; k++)
+    {
+        // charge-weighted integrals for this primitive pair, in pw.acc
+        primitive_pair_(sp, k, pw);
+
+        const double oop = sp.oop[k];
+
+        // general contraction and combined am
+        // The prefactor includes 2*pi/p (the exp(-mu*AB2) is in the coefficients)
+        const double pfac = 2*PI*oop;
+
+        if(gemm)
+        {
+            // the minus sign is applied in the matrix product
+            double const * const RESTRICT accptr = pw.acc(gemmam1, gemmam2);
+            double * const RESTRICT dest = pw.primwork + k*nprimcart;
+            for(size_t n = 0; n < nprimcart; n++)
+                dest[n] = pfac * accptr[n];
+            continue;
+        }
+
+        size_t outidx = 0;
+        for(size_t g1 = 0; g1 < ngen1; g1++)
+        for(size_t g2 = 0; g2 < ngen2; g2++)
+        {
+            const int gam1 = sh1.general_am(g1);
+            const int gam2 = sh2.general_am(g2);
+
+            const size_t ncart = n_cartesian_gaussian(gam1)*n_cartesian_gaussian(gam2);
+            double const * const accptr = pw.acc(gam1, gam2);
+            const double coef = pfac * sp.coef[(g1*ngen2 + g2)*sp.nprim + k];
+
+            // remember: k is the index of the primitive pair
+            // Also, the subtraction takes care of the minus sign
+            for(size_t n = 0; n < ncart; n++)
+                pw.sourcework[outidx++] -= coef * accptr[n];
+        }
+    } // end loop over primitive pairs
+
+    if(gemm)
+        detail::contract_primitives(sp, pw.primwork, nprimcart, -1.0, pw.sourcework);
+
+    // performs the spherical transform of each block, if necessary
+    spherical_.transform_2center(sh1, sh2, pw.sourcework, outbuffer, pw.transformwork, 1);
+
+    return nfunc;
+}
+
+
+void OSOneElectronPotential::prepare_pair_(const BasisSetShell & sh1,
+                                           const BasisSetShell & sh2,
+                                           const ShellPairData & sp,
+                                           PairWork & pw) const
+{
     // The total AM of the shell. May be negative
     const int am1 = sh1.am();
     const int am2 = sh2.am();
 
-    // used for loops
-    const int absam1 = std::abs(am1);
-    const int absam2 = std::abs(am2);
-    const int absam12 = absam1 + absam2;
+    pw.absam1 = std::abs(am1);
+    pw.absam2 = std::abs(am2);
+    const int absam12 = pw.absam1 + pw.absam2;
 
-    // coordinates
-    const CoordType xyz1 = sh1.get_coords();
-    const CoordType xyz2 = sh2.get_coords();
+    // Unrolled kernel (generated by potential/gen_potential.py) for shells
+    // with a single (non-combined) contraction. Otherwise, the general recurrence
+    // in primitive_pair_ forms all (i,j) up to the AM of the shells
+    const bool single = (sh1.n_general_contractions() == 1 && sh2.n_general_contractions() == 1);
+    pw.kernel = single ? detail::potential_kernel(am1, am2) : nullptr;
 
-    // number of primitives
-    const size_t nprim1 = sh1.n_primitives();
-    const size_t nprim2 = sh2.n_primitives();
+    const size_t nb = chargeblock_;
 
-    const double AB[3] = { xyz1[0] - xyz2[0], xyz1[1] - xyz2[1], xyz1[2] - xyz2[2] };
-    const double AB2 = AB[0]*AB[0] + AB[1]*AB[1] + AB[2]*AB[2];
-    
-    std::fill(work_.begin(), work_.end(), 0.0);
+    // all the charges, unless some are treated via the far-field approximation
+    for(int d = 0; d < 3; d++)
+        pw.xyz[d] = chargexyz_[d].data();
+    pw.q = chargeq_.data();
+    pw.ncharge = chargeq_.size();
+    pw.nfar = 0;
 
-    for(const auto & gridpt : grid)
+    if(farfield_)
     {
-        for(size_t a = 0; a < nprim1; a++)
+        // The expansion is about the midpoint of the two centers
+        // (A = P - PA, B = P - PB)
+        for(int d = 0; d < 3; d++)
+            pw.farcenter[d] = sp.P[d][0] - 0.5*(sp.PA[d][0] + sp.PB[d][0]);
+
+        // radius around the center containing the charge distributions of all primitive pairs
+        double extent = 0.0;
+        for(size_t k = 0; k < sp.nprim; k++)
         {
-            const double a1 = sh1.alpha(a);
-            const double a1xyz[3] = { a1*xyz1[0], a1*xyz1[1], a1*xyz1[2] };
+            const double PX[3] = { sp.P[0][k] - pw.farcenter[0], sp.P[1][k] - pw.farcenter[1], sp.P[2][k] - pw.farcenter[2] };
+            const double r = sqrt(PX[0]*PX[0] + PX[1]*PX[1] + PX[2]*PX[2]);
+            extent = std::max(extent, r + sqrt((farfield_logtol + absam12) * sp.oop[k]));
+        }
 
-            for(size_t b = 0; b < nprim2; b++)
-            {
-                const double a2 = sh2.alpha(b);
-                const double p = a1 + a2;
-                const double oop = 1.0/(a1 + a2); // = 1/p = 1/(a1 + a2)
-                const double mu = a1*a2*oop; // (a1+a2)/(a1*a2)
-
-                const double oo2p = 0.5*oop;
-                const double a2xyz[3] = { a2*xyz2[0], a2*xyz2[1], a2*xyz2[2] };
-
-                const double P[3] = { (a1xyz[0]+a2xyz[0])*oop,
-                                      (a1xyz[1]+a2xyz[1])*oop,
-                                      (a1xyz[2]+a2xyz[2])*oop };
-
-                const double PA[3] = { P[0] - xyz1[0], P[1] - xyz1[1], P[2] - xyz1[2] };
-                const double PB[3] = { P[0] - xyz2[0], P[1] - xyz2[1], P[2] - xyz2[2] };
-                const double PC[3] = { P[0] - gridpt.coords[0], P[1] - gridpt.coords[1], P[2] - gridpt.coords[2] };
-                const double PC2 = PC[0]*PC[0] + PC[1]*PC[1] + PC[2]*PC[2];
-
-                // boys function
-                const double T = PC2 * p;
-                detail::calculate_f(amwork_[0][0], absam12, T); 
-                for(int i = 0; i <= absam12; i++)
-                    amwork_[0][0][i] *= 2*PI*oop*exp(-mu*AB2);
-
-                // nested recurrence
-                // we skip (0,0) since that is the boys function
-                for(int i = 0; i <= absam1; i++)
-                {
-                    // vector of recurrence info
-                    const auto & am1info = lut::am_recur_map[i];
+        std::vector<std::pair<size_t, size_t>> nearranges;
+        pw.nfar = octree_.far_field(pw.farcenter, extent, farfield_theta_, pw.fartaylor, nearranges, pw.farfieldwork);
 
-                    // number of cartesians in the previous two shells
-                    const size_t incart   = n_cartesian_gaussian(i);
-                    const size_t incart_1 = (i > 0) ? n_cartesian_gaussian(i-1) : 0;
-                    const size_t incart_2 = (i > 1) ? n_cartesian_gaussian(i-2) : 0;
+        // gather the charges that must be done exactly
+        size_t nnear = 0;
+        for(const auto & range : nearranges)
+        {
+            for(int d = 0; d < 3; d++)
+                std::copy(chargexyz_[d].begin() + range.first, chargexyz_[d].begin() + range.second,
+                          pw.nearxyz[d] + nnear);
+            std::copy(chargeq_.begin() + range.first, chargeq_.begin() + range.second,
+                      pw.nearq + nnear);
+            nnear += range.second - range.first;
+        }
+
+        // pad with zero charges. This fits, since the workspace holds all the (padded) charges
+        const size_t npadded = nb * ((nnear + nb - 1) / nb);
+        for(int d = 0; d < 3; d++)
+        {
+            std::fill(pw.nearxyz[d] + nnear, pw.nearxyz[d] + npadded, 0.0);
+            pw.xyz[d] = pw.nearxyz[d];
+        }
+        std::fill(pw.nearq + nnear, pw.nearq + npadded, 0.0);
+        pw.q = pw.nearq;
+        pw.ncharge = npadded;
+    }
+}
 
-                    // only form if i != 0 (ie, don't do (0,0)
-                    if(i > 0)
-                    {
-                        // form (i,0)
-                        double * iwork = amwork_[i][0];
-                        double * iwork14 = amwork_[i-1][0];                      // location of the 1st and 4th terms
-                        double * iwork25 = (i > 1) ? amwork_[i-2][0] : nullptr;  // location of the 2nd and 5th terms
-
-     
-                        // maximum value of (m) to calculate
-                        // we need [0, absam12-i] inclusive
-                        const int max_m = absam12 - i; 
-                        size_t idx = 0;
-                        for(int m = 0; m <= max_m; m++)
-                        {
-                            // commonly used in dimensioning
-                            const size_t offset_1 = m*incart_1;
-                            const size_t offset_4 = offset_1 + incart_1;  // (m+1)*incart_1
-                            const size_t offset_2 = m*incart_2;
-                            const size_t offset_5 = offset_2 + incart_2;  // (m+1)*incart_1
 
-                            for(const auto & inf : am1info)
-                            {
-                                // get the recurrence information for this cartesian
-                                const auto d = inf.dir;
-                                const auto i_ijk = inf.ijk[d];
-                                const size_t idx1 = offset_1 + inf.idx[d][0]; // index for 1st term
-                                const size_t idx4 = offset_4 + inf.idx[d][0]; // index for 4th term
-                                const size_t idx2 = offset_2 + inf.idx[d][1]; // index for 2nd term
-                                const size_t idx5 = offset_5 + inf.idx[d][1]; // index for 5th term
+void OSOneElectronPotential::primitive_pair_(const ShellPairData & sp, size_t k,
+                                             PairWork & pw) const
+{
+    const int absam1 = pw.absam1;
+    const int absam2 = pw.absam2;
+    const int absam12 = absam1 + absam2;
+
+    /////////////////////////////////////////////////////////
+    // General notes about the following
+    //
+    // The primitive pair is the outer loop, and the point charges
+    // are processed in blocks of nb (padded with zero charges in
+    // build_charges_). Everything for a block is stored with the charge
+    // as the fastest index, so the Boys function and the recurrence
+    // can run over the block in SIMD lanes. For example, the (i,j) integrals
+    // are stored as pw.am(i, j)[(m*ncart_i*ncart_j + cart)*nb + lane].
+    //
+    // The m = 0 integrals are then summed over the block (weighted by
+    // the charges) into pw.acc, and the general contraction is only
+    // done once per primitive pair.
+    /////////////////////////////////////////////////////////
+
+    const double p = sp.p[k];
+    const double oop = sp.oop[k]; // = 1/p = 1/(a1 + a2)
+    const double oo2p = 0.5*oop;
+
+    const double P[3] = { sp.P[0][k], sp.P[1][k], sp.P[2][k] };
+    const double PA[3] = { sp.PA[0][k], sp.PA[1][k], sp.PA[2][k] };
+    const double PB[3] = { sp.PB[0][k], sp.PB[1][k], sp.PB[2][k] };
+
+    const size_t nb = chargeblock_;
+    double * const RESTRICT T = pw.blockwork;
+    double * const RESTRICT PC[3] = { T + nb, T + 2*nb, T + 3*nb };
+
+    // zero the charge-weighted sums
+    for(int i = 0; i <= absam1; i++)
+    for(int j = 0; j <= absam2; j++)
+        std::fill(pw.acc(i, j), pw.acc(i, j) + n_cartesian_gaussian(i)*n_cartesian_gaussian(j), 0.0);
+
+    for(size_t c0 = 0; c0 < pw.ncharge; c0 += nb)
+    {
+        double const * const RESTRICT chargex = pw.xyz[0] + c0;
+        double const * const RESTRICT chargey = pw.xyz[1] + c0;
+        double const * const RESTRICT chargez = pw.xyz[2] + c0;
+        double const * const RESTRICT chargeq = pw.q + c0;
 
-                                iwork[idx] = PA[d]*iwork14[idx1] - PC[d]*iwork14[idx4];  // 1st and 4th terms
+        for(size_t l = 0; l < nb; l++)
+        {
+            PC[0][l] = P[0] - chargex[l];
+            PC[1][l] = P[1] - chargey[l];
+            PC[2][l] = P[2] - chargez[l];
+            T[l] = p * (PC[0][l]*PC[0][l] + PC[1][l]*PC[1][l] + PC[2][l]*PC[2][l]);
+        }
 
-                                if(i_ijk > 1)
-                                    iwork[idx] += oo2p*(i_ijk-1)*(iwork25[idx2] - iwork25[idx5]); // 2nd and 5th terms
+        // boys function, stored as [m][lane]
+        // The prefactor 2*pi/p * exp(-mu*AB2) is applied with the coefficients
+        detail::calculate_f_batch(pw.am(0, 0), absam12, T, nb, boys_engine_);
 
-                                idx++;
-                            }
+        if(pw.kernel)
+        {
+            pw.kernel(nb, pw.am(0, 0), PC[0], PC[1], PC[2], chargeq, PA, PB, oo2p,
+                        pw.acc(absam1, absam2));
+            continue;
+        }
+
+        // nested recurrence
+        // we skip (0,0) since that is the boys function
+        for(int i = 0; i <= absam1; i++)
+        {
+            // vector of recurrence info
+            const auto & am1info = lut::am_recur_map[i];
+
+            // number of cartesians in the previous two shells
+            const size_t incart   = n_cartesian_gaussian(i);
+            const size_t incart_1 = (i > 0) ? n_cartesian_gaussian(i-1) : 0;
+            const size_t incart_2 = (i > 1) ? n_cartesian_gaussian(i-2) : 0;
+
+            // only form if i != 0 (ie, don't do (0,0)
+            if(i > 0)
+            {
+                // form (i,0)
+                double * const RESTRICT iwork = pw.am(i, 0);
+                double const * const RESTRICT iwork14 = pw.am(i-1, 0);                      // location of the 1st and 4th terms
+                double const * const RESTRICT iwork25 = (i > 1) ? pw.am(i-2, 0) : nullptr;  // location of the 2nd and 5th terms
+
+                // maximum value of (m) to calculate
+                // we need [0, absam12-i] inclusive
+                const int max_m = absam12 - i;
+                size_t idx = 0;
+                for(int m = 0; m <= max_m; m++)
+                {
+                    // commonly used in dimensioning
+                    const size_t offset_1 = m*incart_1;
+                    const size_t offset_4 = offset_1 + incart_1;  // (m+1)*incart_1
+                    const size_t offset_2 = m*incart_2;
+                    const size_t offset_5 = offset_2 + incart_2;  // (m+1)*incart_1
+
+                    for(const auto & inf : am1info)
+                    {
+                        // get the recurrence information for this cartesian
+                        const auto d = inf.dir;
+                        const auto i_ijk = inf.ijk[d];
+                        double * const RESTRICT out = iwork + idx*nb;
+                        double const * const RESTRICT t1 = iwork14 + (offset_1 + inf.idx[d][0])*nb; // 1st term
+                        double const * const RESTRICT t4 = iwork14 + (offset_4 + inf.idx[d][0])*nb; // 4th term
+                        double const * const RESTRICT pc = PC[d];
+
+                        for(size_t l = 0; l < nb; l++)
+                            out[l] = PA[d]*t1[l] - pc[l]*t4[l];  // 1st and 4th terms
+
+                        if(i_ijk > 1)
+                        {
+                            double const * const RESTRICT t2 = iwork25 + (offset_2 + inf.idx[d][1])*nb; // 2nd term
+                            double const * const RESTRICT t5 = iwork25 + (offset_5 + inf.idx[d][1])*nb; // 5th term
+                            const double fac = oo2p*(i_ijk-1);
+
+                            for(size_t l = 0; l < nb; l++)
+                                out[l] += fac*(t2[l] - t5[l]); // 2nd and 5th terms
                         }
+
+                        idx++;
                     }
+                }
+            }
 
-                    // now (i,j) via second vertical recurrence
-                    for(int j = 1; j <= absam2; j++)
-                    {
-                        // vector of recurrence info
-                        const auto & am2info = lut::am_recur_map[j];
+            // now (i,j) via second vertical recurrence
+            for(int j = 1; j <= absam2; j++)
+            {
+                // vector of recurrence info
+                const auto & am2info = lut::am_recur_map[j];
 
-                        // number of cartesians in the previous two shells
-                        //const size_t jncart   = n_cartesian_gaussian(j);
-                        const size_t jncart_1 = n_cartesian_gaussian(j-1);   // j can't be zero (loop starts at 1)
-                        const size_t jncart_2 = (j > 1) ? n_cartesian_gaussian(j-2) : 0;
+                // number of cartesians in the previous two shells
+                const size_t jncart_1 = n_cartesian_gaussian(j-1);   // j can't be zero (loop starts at 1)
+                const size_t jncart_2 = (j > 1) ? n_cartesian_gaussian(j-2) : 0;
 
-                        double * jwork = amwork_[i][j];
+                double * const RESTRICT jwork = pw.am(i, j);
 
-                        double * jwork14 = amwork_[i][j-1];                        // location of the 1st and 4th terms
-                        double * jwork36 = (j > 1) ? amwork_[i][j-2] : nullptr;    // location of the 3rd and 6th terms
-                        double * jwork25 = (i > 0) ? amwork_[i-1][j-1] : nullptr;  // location of the 2nd and 5th terms
+                double const * const RESTRICT jwork14 = pw.am(i, j-1);                        // location of the 1st and 4th terms
+                double const * const RESTRICT jwork36 = (j > 1) ? pw.am(i, j-2) : nullptr;    // location of the 3rd and 6th terms
+                double const * const RESTRICT jwork25 = (i > 0) ? pw.am(i-1, j-1) : nullptr;  // location of the 2nd and 5th terms
 
-                        const int max_m2 = absam2 - j + 1; // need [0, absam2-1] inclusive
+                const int max_m2 = absam2 - j; // need [0, absam2-j] inclusive
 
-                        size_t cartidx = 0; // index of the pair of cartesians
-                        for(int m = 0; m <= max_m2; m++)
+                size_t cartidx = 0; // index of the pair of cartesians
+                for(int m = 0; m <= max_m2; m++)
+                {
+                    size_t cartidx_1 = 0;  // index of just the first cartesian
+                    for(const auto & cart1 : am1info)
+                    {
+                        // precompute some of the offsets
+                        // storage is  m, cart1, cart2, lane
+                        const size_t offset1 = jncart_1*(m*incart + cartidx_1);
+                        const size_t offset4 = jncart_1*((m+1)*incart + cartidx_1);
+                        const size_t offset3 = jncart_2*(m*incart + cartidx_1);
+                        const size_t offset6 = jncart_2*((m+1)*incart + cartidx_1);
+
+                        for(const auto & cart2 : am2info)
                         {
-                            size_t cartidx_1 = 0;  // index of just the first cartesian
-                            for(const auto & cart1 : am1info)
+                            const auto d = cart2.dir; // direction we should recurse
+                            const auto i_ijk = cart1.ijk[d];  // values of i and j in that direction
+                            const auto j_ijk = cart2.ijk[d];
+
+                            double * const RESTRICT out = jwork + cartidx*nb;
+                            double const * const RESTRICT t1 = jwork14 + (offset1 + cart2.idx[d][0])*nb;  // 1st term
+                            double const * const RESTRICT t4 = jwork14 + (offset4 + cart2.idx[d][0])*nb;  // 4th term
+                            double const * const RESTRICT pc = PC[d];
+
+                            for(size_t l = 0; l < nb; l++)
+                                out[l] = PB[d]*t1[l] - pc[l]*t4[l]; // terms 1 & 4
+
+                            if(i_ijk > 0)
                             {
-                                // precompute some of the offsets
-                                // storage is  m, cart1, cart2
-                                // so total index would be (m*ncart1*ncart2 + cart1*ncart2 + cart2)
-                                const size_t offset1 = jncart_1*(m*incart + cartidx_1);                     // m*incart*jncart_1 + cartidx_1*jncart_1 
-                                const size_t offset4 = jncart_1*((m+1)*incart + cartidx_1);                 // (m+1)*incart*jncart_1 + cartidx_1*jncart_1
-                                const size_t offset3 = jncart_2*(m*incart + cartidx_1);                     // m*incart*jncart_2 + cartidx_1*jncart_2
-                                const size_t offset6 = jncart_2*((m+1)*incart + cartidx_1);                 // (m+1)*incart*jncart_2 + cartidx_1*jncart_2
-                                const size_t offset2[3] = { jncart_1*(m*incart_1 + cart1.idx[0][0]),        // m*incart_1*jncart_1 + cart1.idx[0][0]*jncart_1 
-                                                            jncart_1*(m*incart_1 + cart1.idx[1][0]),        // m*incart_1*jncart_1 + cart1.idx[1][0]*jncart_1 
-                                                            jncart_1*(m*incart_1 + cart1.idx[2][0]) };      // m*incart_1*jncart_1 + cart1.idx[2][0]*jncart_1 
-                                const size_t offset5[3] = { jncart_1*((m+1)*incart_1 + cart1.idx[0][0]),    // (m+1)*incart_1*jncart_1 + cart1.idx[0][0]*jncart_1 
-                                                            jncart_1*((m+1)*incart_1 + cart1.idx[1][0]),    // (m+1)*incart_1*jncart_1 + cart1.idx[1][0]*jncart_1 
-                                                            jncart_1*((m+1)*incart_1 + cart1.idx[2][0]) };  // (m+1)*incart_1*jncart_1 + cart1.idx[2][0]*jncart_1 
-
-                                for(const auto & cart2 : am2info)
-                                {
-                                    const auto d = cart2.dir; // direction we should recurse
-                                    const auto i_ijk = cart1.ijk[d];  // values of i and j in that direction
-                                    const auto j_ijk = cart2.ijk[d];
-                                    const size_t idx1 = offset1 + cart2.idx[d][0];     // 1st term
-                                    const size_t idx4 = offset4 + cart2.idx[d][0];     // 4th term
-                                    const size_t idx3 = offset3 + cart2.idx[d][1];     // 3rd term
-                                    const size_t idx6 = offset6 + cart2.idx[d][1];     // 6th term
-                                    const size_t idx2 = offset2[d] + cart2.idx[d][0];  // 2nd term
-                                    const size_t idx5 = offset5[d] + cart2.idx[d][0];  // 5th term
-
-
-                                    jwork[cartidx] = PB[d]*jwork14[idx1] - PC[d]*jwork14[idx4]; // terms 1 & 4
-
-                                    if(i_ijk > 0)
-                                        jwork[cartidx] += oo2p*(i_ijk)*jwork25[idx2] - oo2p*(i_ijk)*jwork25[idx5]; // terms 2 & 5
-
-                                    if(j_ijk > 1)
-                                        jwork[cartidx] += oo2p*(j_ijk-1)*(jwork36[idx3] - jwork36[idx6]); // terms 3 & 6
-
-                                    cartidx++;
-                                }
-
-                                cartidx_1++;
+                                const size_t offset2 = jncart_1*(m*incart_1 + cart1.idx[d][0]);
+                                const size_t offset5 = jncart_1*((m+1)*incart_1 + cart1.idx[d][0]);
+                                double const * const RESTRICT t2 = jwork25 + (offset2 + cart2.idx[d][0])*nb;  // 2nd term
+                                double const * const RESTRICT t5 = jwork25 + (offset5 + cart2.idx[d][0])*nb;  // 5th term
+                                const double fac = oo2p*i_ijk;
+
+                                for(size_t l = 0; l < nb; l++)
+                                    out[l] += fac*(t2[l] - t5[l]); // terms 2 & 5
                             }
-                        } // end loop over m
-                    } // end loop over j
-                } // end loop over i
-
-                // general contraction and combined am
-                size_t outidx = 0;
-                for(size_t g1 = 0; g1 < ngen1; g1++)
-                for(size_t g2 = 0; g2 < ngen2; g2++)
-                {
-                    const int gam1 = sh1.general_am(g1);
-                    const int gam2 = sh2.general_am(g2);
 
-                    const size_t ncart1 = n_cartesian_gaussian(gam1);
-                    const size_t ncart2 = n_cartesian_gaussian(gam2);
-                    double const * const amptr = amwork_[gam1][gam2];
+                            if(j_ijk > 1)
+                            {
+                                double const * const RESTRICT t3 = jwork36 + (offset3 + cart2.idx[d][1])*nb;  // 3rd term
+                                double const * const RESTRICT t6 = jwork36 + (offset6 + cart2.idx[d][1])*nb;  // 6th term
+                                const double fac = oo2p*(j_ijk-1);
 
+                                for(size_t l = 0; l < nb; l++)
+                                    out[l] += fac*(t3[l] - t6[l]); // terms 3 & 6
+                            }
 
-                    size_t cartidx = 0;
-                    // go over the orderings for this AM
-                    for(size_t i = 0; i < ncart1; i++)
-                    for(size_t j = 0; j < ncart2; j++)
-                    {
-                        const double val = amptr[cartidx++];
+                            cartidx++;
+                        }
 
-                        // remember: a and b are indices of primitives
-                        // Also, the subtraction takes care of the minus sign
-                        sourcework_[outidx++] -= val * sh1.coef(g1, a) * sh2.coef(g2, b) * gridpt.value;
+                        cartidx_1++;
                     }
+                } // end loop over m
+            } // end loop over j
+        } // end loop over i
+
+        // sum the m = 0 integrals over the block, weighted by the charges
+        for(int i = 0; i <= absam1; i++)
+        for(int j = 0; j <= absam2; j++)
+        {
+            const size_t ncart = n_cartesian_gaussian(i)*n_cartesian_gaussian(j);
+            double const * const RESTRICT src = pw.am(i, j);
+            double * const RESTRICT acc = pw.acc(i, j);
+
+            for(size_t n = 0; n < ncart; n++)
+            {
+                double sum = 0.0;
+                for(size_t l = 0; l < nb; l++)
+                    sum += chargeq[l] * src[n*nb + l];
+                acc[n] += sum;
+            }
+        }
+    } // end loop over blocks of point charges
+
+    /////////////////////////////////////////////////////////
+    // Far-field contribution
+    //
+    // The far-field potential is a polynomial about X,
+    // sum_t D_t (r-X)^t, so the integrals factor into
+    // one-dimensional moments
+    //
+    //   M_d[i][j][e] = <(d-A_d)^i | (d-X_d)^e | (d-B_d)^j>
+    //
+    // These are formed from the overlap terms by expanding
+    // (d-X_d)^e = sum_s binom(e,s) (B_d-X_d)^(e-s) (d-B_d)^s.
+    // The moments are relative to S_00 = 1, so the prefactor
+    // (pi/p)^(3/2) is divided by the 2*pi/p applied in the contraction.
+    /////////////////////////////////////////////////////////
+    if(pw.nfar > 0)
+    {
+        const int order = octree_.order();
+        const int nam2 = absam2 + order + 1;
+        const size_t norder = order + 1;
+
+        detail::os_overlap_terms(PA, PB, oo2p, absam1+1, nam2, pw.faroverlap);
+
+        for(int d = 0; d < 3; d++)
+        {
+            // B - X = P - PB - X
+            const double BX = P[d] - PB[d] - pw.farcenter[d];
+            double const * const RESTRICT s_ij = pw.faroverlap[d];
+            double * const RESTRICT mom = pw.farmoment[d];
+
+            for(int i = 0; i <= absam1; i++)
+            for(int j = 0; j <= absam2; j++)
+            {
+                double * const RESTRICT m_ij = mom + (i*(absam2+1) + j)*norder;
+                for(int e = 0; e <= order; e++)
+                {
+                    double const * const binom = binomial_.data() + e*norder;
+                    double sum = 0.0;
+                    double bxpow = 1.0;
+                    for(int s = e; s >= 0; s--)
+                    {
+                        sum += binom[s] * bxpow * s_ij[i*nam2 + j + s];
+                        bxpow *= BX;
+                    }
+                    m_ij[e] = sum;
                 }
-            } // end loop over primitive a
-        } // end loop over primitive b
-    } // close loop over atoms
+            }
+        }
 
-    // performs the spherical transform, if necessary
-    CartesianToSpherical_2Center(sh1, sh2, sourcework_, outbuffer, transformwork_, 1);
+        const double farfac = 0.5*sqrt(PI*oop);
+        const auto & components = octree_.multipole_components();
+        const size_t nmult = components.size();
 
-    return nfunc;
+        for(int i = 0; i <= absam1; i++)
+        for(int j = 0; j <= absam2; j++)
+        {
+            double * const RESTRICT acc = pw.acc(i, j);
+            size_t cartidx = 0;
+
+            for(const auto & cart1 : lut::am_recur_map[i])
+            for(const auto & cart2 : lut::am_recur_map[j])
+            {
+                double const * const RESTRICT mx = pw.farmoment[0] + (cart1.ijk[0]*(absam2+1) + cart2.ijk[0])*norder;
+                double const * const RESTRICT my = pw.farmoment[1] + (cart1.ijk[1]*(absam2+1) + cart2.ijk[1])*norder;
+                double const * const RESTRICT mz = pw.farmoment[2] + (cart1.ijk[2]*(absam2+1) + cart2.ijk[2])*norder;
+
+                double sum = 0.0;
+                for(size_t n = 0; n < nmult; n++)
+                {
+                    const auto & tuv = components[n];
+                    sum += pw.fartaylor[n] * mx[tuv[0]] * my[tuv[1]] * mz[tuv[2]];
+                }
+
+                acc[cartidx++] += farfac * sum;
+            }
+        }
+    }
 }
 
 
-uint64_t OSOneElectronPotential::calculate_(uint64_t shell1, uint64_t shell2,
-                                            double * outbuffer, size_t bufsize)
+void OSOneElectronPotential::build_charges_(void)
 {
     // what grid are we using?
     std::string gridopt = options().get<std::string>("grid");
 
-    GridUniverse gu;
+    const bool use_atoms = (gridopt == "ATOMS" || gridopt == "ALL");
+    const bool use_external = (gridopt == "EXTERNAL" || gridopt == "ALL");
 
-    if(gridopt == "ATOMS")
+    if(!use_atoms && !use_external)
+        throw PulsarException("Unknown grid", "gridopt", gridopt);
+
+    for(int d = 0; d < 3; d++)
+        chargexyz_[d].clear();
+    chargeq_.clear();
+
+    if(use_atoms)
     {
+        if(!sys_)
+            throw PulsarException("No system given");
+
         // create the grid from the system
         for(const auto & atom : *sys_)
+        {
             if(atom.Z != 0)
-                gu.insert({atom.get_coords(), numeric_cast<double>(atom.Z)});
-        
+            {
+                const CoordType xyz = atom.get_coords();
+                for(int d = 0; d < 3; d++)
+                    chargexyz_[d].push_back(xyz[d]);
+                chargeq_.push_back(numeric_cast<double>(atom.Z));
+            }
+        }
     }
-    else
-        throw PulsarException("Unknown grid", "gridopt", gridopt);
 
-    Grid grid(std::make_shared<GridUniverse>(std::move(gu)), true);
+    if(use_external)
+    {
+        // from the options, then from set_external_charges
+        const auto optcharges = options().get<std::vector<double>>("EXTERNAL_CHARGES");
+        if(optcharges.size() % 4 != 0)
+            throw PulsarException("EXTERNAL_CHARGES must have four elements (x, y, z, q) for each charge",
+                                  "size", optcharges.size());
+
+        auto add_charges = [this](const std::vector<double> & charges)
+        {
+            for(size_t i = 0; i < charges.size(); i += 4)
+            {
+                for(int d = 0; d < 3; d++)
+                    chargexyz_[d].push_back(charges[i+d]);
+                chargeq_.push_back(charges[i+3]);
+            }
+        };
+
+        add_charges(optcharges);
+        add_charges(extcharges_);
+    }
+
+    // The octree sorts the charges, so it must be built before padding
+    farfield_ = options().get<bool>("FAR_FIELD");
+    if(farfield_)
+    {
+        const int order = options().get<int>("FAR_FIELD_ORDER");
+        if(order < 0 || order > farfield_max_order)
+            throw PulsarException("FAR_FIELD_ORDER is out of range", "order", order,
+                                  "max", farfield_max_order);
+
+        farfield_theta_ = options().get<double>("FAR_FIELD_THETA");
+        if(farfield_theta_ <= 0.0 || farfield_theta_ >= 1.0)
+            throw PulsarException("FAR_FIELD_THETA must be between 0 and 1",
+                                  "theta", farfield_theta_);
+
+        octree_.build(chargexyz_, chargeq_, order, farfield_leafsize);
+    }
+
+    // The charges are processed in blocks (see calculate_). The block
+    // is a multiple of the SIMD width used for the Boys function, and the
+    // arrays are padded to a multiple of the block size with zero charges
+    const size_t ncharge = chargeq_.size();
+    const size_t width = detail::boys_batch_width();
+
+    chargeblock_ = width * ((ncharge + width - 1) / width);
+    chargeblock_ = std::max(std::min(chargeblock_, max_charge_block), static_cast<size_t>(1));
 
-    // will check sizes of buffer, etc
-    return calculate_with_grid_(shell1, shell2, grid, outbuffer, bufsize);
+    const size_t npadded = chargeblock_ * ((ncharge + chargeblock_ - 1) / chargeblock_);
+    for(int d = 0; d < 3; d++)
+        chargexyz_[d].resize(npadded, 0.0);
+    chargeq_.resize(npadded, 0.0);
+
+    out.debug("OSOneElectronPotential: %? point charges, processed in blocks of %?\n",
+              ncharge, chargeblock_);
 }
 
 
+void OSOneElectronPotential::set_external_charges(const Grid & charges)
+{
+    extcharges_.clear();
+    for(const auto & gridpt : charges)
+    {
+        extcharges_.push_back(gridpt.coords[0]);
+        extcharges_.push_back(gridpt.coords[1]);
+        extcharges_.push_back(gridpt.coords[2]);
+        extcharges_.push_back(gridpt.value);
+    }
 
-void OSOneElectronPotential::initialize_(unsigned int deriv,
-                                         const Wavefunction & wfn,
-                                         const BasisSet & bs1,
-                                         const BasisSet & bs2)
+    // rebuild if we have already been initialized. The size of
+    // the workspace depends on the number of charges
+    if(bs1_)
+    {
+        build_charges_();
+        setup_shellpairs_();
+        setup_workspace_();
+    }
+}
+
+
+void OSOneElectronPotential::setup_shellpairs_(void)
 {
-    if(deriv != 0)
-        throw NotYetImplementedException("Not Yet Implemented: OSOneElectronPotential integral with deriv != 0");
+    // The padding charges are zero
+    double sumcharge = 0.0;
+    for(double q : chargeq_)
+        sumcharge += std::fabs(q);
+
+    shellpairs_ = ShellPairs(cache(), out, *bs1_, *bs2_,
+                             options().get<double>("SCREEN_THRESHOLD"),
+                             screen_operators_(), sumcharge);
+}
+
+
+
+uint64_t OSOneElectronPotential::calculate_(uint64_t shell1, uint64_t shell2,
+                                            double * outbuffer, size_t bufsize)
+{
+    return calculate(shell1, shell2, outbuffer, bufsize, work_);
+}
+
+
+
+uint64_t OSOneElectronPotential::calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                                 double * outbuffer, size_t bufsize)
+{
+    return calculate_batch(pairs, npair, outbuffer, bufsize, work_);
+}
+
+
+
+uint64_t OSOneElectronPotential::calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                                 double * outbuffer, size_t bufsize,
+                                                 IntegralWorkspace & ws) const
+{
+    // calls calculate directly, bypassing the module base
+    auto calc = [this, &ws](uint64_t shell1, uint64_t shell2, double * buf, size_t size)
+                { return OSOneElectronPotential::calculate(shell1, shell2, buf, size, ws); };
+
+    return detail::batch_loop(calc, 1, pairs, npair, outbuffer, bufsize);
+}
 
-    sys_ = wfn.system;
 
-    // from common components
-    bs1_ = NormalizeBasis(cache(), out, bs1);
-    bs2_ = NormalizeBasis(cache(), out, bs2);
 
-    ///////////////////////////////////////
-    // Determine the size of the workspace
-    ///////////////////////////////////////
+OSOneElectronPotential::PairWork OSOneElectronPotential::pair_work_(IntegralWorkspace & ws) const
+{
+    PairWork pw;
+
+    pw.base = ws.data();
+    pw.amoffset = amoffset_.data();
+    pw.accoffset = accoffset_.data();
+    pw.amstride = amstride_;
+
+    pw.blockwork = pw.base + blockwork_offset_;
+    pw.transformwork = pw.base + transformwork_offset_;
+    pw.sourcework = pw.base + sourcework_offset_;
+    pw.primwork = pw.base + primwork_offset_;
+
+    pw.fartaylor = pw.farfieldwork = nullptr;
+    for(int d = 0; d < 3; d++)
+        pw.faroverlap[d] = pw.farmoment[d] = pw.nearxyz[d] = nullptr;
+    pw.nearq = nullptr;
+
+    if(farfield_)
+    {
+        pw.fartaylor = pw.base + farwork_offset_;
+        pw.farfieldwork = pw.fartaylor + detail::n_multipole(octree_.order());
+
+        double * ptr = pw.farfieldwork + octree_.far_field_worksize();
+        for(int d = 0; d < 3; d++)
+        {
+            pw.faroverlap[d] = ptr;
+            ptr += faroverlap_size_;
+        }
+        for(int d = 0; d < 3; d++)
+        {
+            pw.farmoment[d] = ptr;
+            ptr += farmoment_size_;
+        }
+
+        ptr = pw.base + nearwork_offset_;
+        for(int d = 0; d < 3; d++)
+        {
+            pw.nearxyz[d] = ptr;
+            ptr += nearwork_size_;
+        }
+        pw.nearq = ptr;
+    }
+
+    return pw;
+}
+
 
+
+void OSOneElectronPotential::setup_workspace_(void)
+{
     // storage size for each x,y,z component
     int max1 = bs1_->max_am();
     int max2 = bs2_->max_am();
-    size_t worksize = 0;
+    int maxm = max1+max2;
+
+    // Offsets for the work for each am pair (all values of m for each point
+    // charge in a block) and the summed integrals. This overestimates a bit
+    amstride_ = max2+1;
+    amoffset_.resize((max1+1)*amstride_);
+    accoffset_.resize((max1+1)*amstride_);
 
-    // This overestimates a bit
+    size_t offset = 0;
     for(int i = 0; i <= max1; i++)
     for(int j = 0; j <= max2; j++)
-        worksize += n_cartesian_gaussian(i)*n_cartesian_gaussian(j);
-    int maxm = max1+max2;
-    worksize *= (maxm+1);
+    {
+        amoffset_[i*amstride_ + j] = offset;
+        offset += n_cartesian_gaussian(i)*n_cartesian_gaussian(j)*(maxm+1)*max_charge_block;
+    }
+
+    for(int i = 0; i <= max1; i++)
+    for(int j = 0; j <= max2; j++)
+    {
+        accoffset_[i*amstride_ + j] = offset;
+        offset += n_cartesian_gaussian(i)*n_cartesian_gaussian(j);
+    }
+
+    // T and PC for a block
+    blockwork_offset_ = offset;
+    offset += 4 * max_charge_block;
 
     // find the maximum number of cartesian functions, not including general contraction
     size_t maxsize1 = bs1_->max_property(n_cartesian_gaussian_for_shell_am);
     size_t maxsize2 = bs2_->max_property(n_cartesian_gaussian_for_shell_am);
-    size_t transformwork_size = maxsize1 * maxsize2; 
+    transformwork_offset_ = offset;
+    offset += maxsize1 * maxsize2;
 
     // find the maximum number of cartesian functions, including general contraction
     maxsize1 = bs1_->max_property(n_cartesian_gaussian_in_shell);
     maxsize2 = bs2_->max_property(n_cartesian_gaussian_in_shell);
-    size_t sourcework_size = maxsize1 * maxsize2;
+    sourcework_offset_ = offset;
+    offset += maxsize1 * maxsize2;
+
+    // primitive integrals for the general contraction via matrix products
+    primwork_offset_ = offset;
+    offset += detail::gemm_contraction_size(*bs1_, *bs2_);
+
+    // far-field approximation: taylor expansion, octree workspace,
+    // overlap terms, and moments. Then the charges gathered
+    // for each pair (which may be all of them)
+    farwork_offset_ = nearwork_offset_ = offset;
+    faroverlap_size_ = farmoment_size_ = nearwork_size_ = 0;
+    if(farfield_)
+    {
+        const int order = octree_.order();
+        faroverlap_size_ = (max1+1)*(max2+order+1);
+        farmoment_size_ = (max1+1)*(max2+1)*(order+1);
+        offset += detail::n_multipole(order) + octree_.far_field_worksize()
+                + 3*faroverlap_size_ + 3*farmoment_size_;
+
+        nearwork_offset_ = offset;
+        nearwork_size_ = chargeq_.size();
+        offset += 4*nearwork_size_;
+    }
 
-    // allocate all at once, then partition
-    work_.resize(worksize + transformwork_size + sourcework_size);
+    worksize_ = offset;
 
-    amwork_.resize(max1+1);
-    for(auto & it : amwork_)
-        it.resize(max2+1);
+    // Use the (virtual) workspace_size, since derived classes
+    // may need additional space
+    work_.resize(workspace_size());
+}
 
-    double * ptr = work_.data();
-    for(int i = 0; i <= max1; i++)
-    for(int j = 0; j <= max2; j++)
+
+
+void OSOneElectronPotential::initialize_(unsigned int deriv,
+                                         const Wavefunction & wfn,
+                                         const BasisSet & bs1,
+                                         const BasisSet & bs2)
+{
+    if(deriv != 0)
+        throw NotYetImplementedException("Not Yet Implemented: OSOneElectronPotential integral with deriv != 0");
+
+    sys_ = wfn.system;
+    build_charges_();
+
+    const std::string boysopt = options().get<std::string>("BOYS_ENGINE");
+    if(!boys_engine_from_string(boysopt, boys_engine_))
+        throw PulsarException("Unknown Boys function engine", "engine", boysopt);
+
+    // from common components
+    bs1_ = NormalizeBasis(cache(), out, bs1);
+    bs2_ = NormalizeBasis(cache(), out, bs2);
+    setup_shellpairs_();
+    spherical_ = detail::SphericalTransform(std::max(bs1_->max_am(), bs2_->max_am()));
+
+    // binomial coefficients for the far-field moments
+    if(farfield_)
     {
-        amwork_[i][j] = ptr;
-        ptr += n_cartesian_gaussian(i)*n_cartesian_gaussian(j)*(maxm+1);
+        const int order = octree_.order();
+        binomial_.assign((order+1)*(order+1), 0.0);
+        for(int n = 0; n <= order; n++)
+        {
+            binomial_[n*(order+1)] = 1.0;
+            for(int k = 1; k <= n; k++)
+                binomial_[n*(order+1) + k] = binomial_[(n-1)*(order+1) + k-1]
+                                           + ((k < n) ? binomial_[(n-1)*(order+1) + k] : 0.0);
+        }
     }
 
-    transformwork_ = ptr;
-    sourcework_ = transformwork_ + transformwork_size;
+    setup_workspace_();
 }
 
 
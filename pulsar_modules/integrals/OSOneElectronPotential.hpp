@@ -3,13 +3,37 @@
 #include <pulsar/modulebase/OneElectronIntegral.hpp>
 #include <pulsar/math/Grid.hpp>
 
+#include "Common/BasisSetCommon.hpp"
+#include "Integrals/IntegralWorkspace.hpp"
+#include "Integrals/SphericalTransform.hpp"
+#include "Integrals/boys/Boys.hpp"
+#include "Integrals/FarField.hpp"
+#include "Integrals/potential/Potential_kernels.hpp"
+
 namespace psr_modules {
 namespace integrals {
 
 
 /*! \brief Calculation of one-electron potential integrals via Obara-Saika recurrence
+ *
+ * The point charges are determined by the GRID option:
+ *   - ATOMS: The nuclei of the system (charge = Z)
+ *   - EXTERNAL: External point charges only
+ *   - ALL: Both the nuclei and the external point charges
+ *
+ * External point charges are taken from the EXTERNAL_CHARGES option
+ * (a flat list of x, y, z, charge for each point) as well as any
+ * charges given through set_external_charges().
+ *
+ * For many point charges, the FAR_FIELD option enables an approximation
+ * where the point charges are placed into an octree. For each shell pair,
+ * nodes of the tree that are well separated from the charge distribution
+ * (controlled by FAR_FIELD_THETA) are treated via their multipole
+ * expansion (up to order FAR_FIELD_ORDER). The rest are done exactly.
  */
-class OSOneElectronPotential : public pulsar::modulebase::OneElectronIntegral
+class OSOneElectronPotential : public pulsar::modulebase::OneElectronIntegral,
+                               public detail::OneElectronBatch,
+                               public detail::ReentrantOneElectron
 {
     public:
         using pulsar::modulebase::OneElectronIntegral::OneElectronIntegral;
@@ -22,21 +46,172 @@ class OSOneElectronPotential : public pulsar::modulebase::OneElectronIntegral
         virtual uint64_t calculate_(uint64_t shell1, uint64_t shell2,
                                     double * outbuffer, size_t bufsize);
 
+        virtual uint64_t calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                         double * outbuffer, size_t bufsize);
+
+        using pulsar::modulebase::OneElectronIntegral::calculate;
+
+        virtual size_t workspace_size(void) const { return worksize_; }
+
+        virtual uint64_t calculate(uint64_t shell1, uint64_t shell2,
+                                   double * outbuffer, size_t bufsize,
+                                   IntegralWorkspace & ws) const;
+
+        virtual uint64_t calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                         double * outbuffer, size_t bufsize,
+                                         IntegralWorkspace & ws) const;
+
+        /*! \brief Set external point charges
+         *
+         * The value of each grid point is its charge. These
+         * replace any charges given previously through this function.
+         * If the module has already been initialized, the point
+         * charges are rebuilt.
+         */
+        void set_external_charges(const pulsar::math::Grid & charges);
+
+    protected:
+        /*! \brief Pointers into a workspace, and the state for a pair of shells
+         *
+         * Obtained from a workspace via pair_work_, then
+         * filled in for a pair of shells by prepare_pair_.
+         */
+        struct PairWork
+        {
+            double * base;
+            const size_t * amoffset;
+            const size_t * accoffset;
+            size_t amstride;
+
+            //! Work for am pair i,j (for a block of point charges)
+            double * am(int i, int j) const { return base + amoffset[i*amstride + j]; }
+
+            //! Integrals for am pair i,j, summed over all point charges
+            double * acc(int i, int j) const { return base + accoffset[i*amstride + j]; }
+
+            double * blockwork;      //!< T and PC for a block of point charges
+            double * transformwork;
+            double * sourcework;
+            double * primwork;       //!< Primitive integrals, for the general contraction via matrix products
+
+            double * fartaylor;      //!< Taylor expansion of the far-field potential
+            double * farfieldwork;   //!< Workspace for ChargeOctree::far_field
+            double * faroverlap[3];  //!< Overlap terms for a primitive pair
+            double * farmoment[3];   //!< Moments of the primitive pair about the expansion center
+
+            //! Charges close to the current shell pair, gathered from chargexyz_ and chargeq_
+            //! (padded with zero charges to a multiple of chargeblock_)
+            double * nearxyz[3];
+            double * nearq;
+
+            ///////////////////////////////
+            // Set by prepare_pair_
+            ///////////////////////////////
+            int absam1, absam2;
+
+            //! Unrolled kernel for the pair (or nullptr)
+            detail::PotentialKernel kernel;
+
+            //! Charges to treat exactly for the pair (padded to a multiple of chargeblock_)
+            double const * xyz[3];
+            double const * q;
+            size_t ncharge;
+
+            //! Number of charges treated via the far-field approximation
+            size_t nfar;
+
+            //! Center of the far-field expansion
+            double farcenter[3];
+        };
+
+        //! Workspace used by calculate_
+        IntegralWorkspace work_;
+
+        std::shared_ptr<const pulsar::system::BasisSet> bs1_, bs2_;
+        std::shared_ptr<const ShellPairSet> shellpairs_;
+        detail::SphericalTransform spherical_;
+
+        //! Partition a workspace (which must be at least worksize_)
+        PairWork pair_work_(IntegralWorkspace & ws) const;
+
+        /*! \brief Set up for calculating the integrals of a pair of shells
+         *
+         * This splits the point charges into those treated exactly and
+         * via the far-field approximation, and selects the unrolled kernel.
+         */
+        void prepare_pair_(const pulsar::system::BasisSetShell & sh1,
+                           const pulsar::system::BasisSetShell & sh2,
+                           const ShellPairData & sp, PairWork & pw) const;
+
+        /*! \brief Calculate the integrals of a primitive pair, summed over all point charges
+         *
+         * The results for each am pair (i,j) are placed in pw.acc(i,j). These
+         * do not include the 2*pi/p prefactor, the contraction coefficient, or the
+         * minus sign. prepare_pair_ must be called first for the pair of shells.
+         *
+         * If the unrolled kernel is used, only pw.acc(am1, am2) is formed.
+         */
+        void primitive_pair_(const ShellPairData & sp, size_t k, PairWork & pw) const;
+
+        //! Operators whose integrals are estimated when screening shell pairs
+        virtual unsigned int screen_operators_(void) const { return ScreenPotential; }
+
     private:
-        std::vector<double> work_;
+        /////////////////////////////////////
+        // Partitioning of a workspace
+        /////////////////////////////////////
+        size_t worksize_ = 0;                  //!< Total size of a workspace
+        size_t amstride_;                      //!< Stride of the am pairs in amoffset_ and accoffset_
+        std::vector<size_t> amoffset_;         //!< Offset of the work for each am pair
+        std::vector<size_t> accoffset_;        //!< Offset of the summed integrals for each am pair
+        size_t blockwork_offset_;
+        size_t transformwork_offset_;
+        size_t sourcework_offset_;
+        size_t primwork_offset_;
+        size_t farwork_offset_;
+        size_t faroverlap_size_;
+        size_t farmoment_size_;
+        size_t nearwork_offset_;
+        size_t nearwork_size_;                 //!< Size of the gathered charges (each of x, y, z, q)
 
-        // amwork_[i][j] = work for am pair i,j
-        std::vector<std::vector<double *>> amwork_;
+        //! Number of point charges processed at once
+        size_t chargeblock_;
         std::shared_ptr<const pulsar::system::System> sys_;
 
-        double * transformwork_;
-        double * sourcework_;
+        //! How the Boys function is evaluated
+        BoysEngine boys_engine_;
 
-        std::shared_ptr<const pulsar::system::BasisSet> bs1_, bs2_;
+        //! Coordinates of all point charges (x, y, and z separately)
+        std::vector<double> chargexyz_[3];
+
+        //! Values of all point charges
+        //! (padded with zero charges to a multiple of chargeblock_)
+        std::vector<double> chargeq_;
+
+        //! Charges given by set_external_charges, stored as x, y, z, q for each
+        std::vector<double> extcharges_;
+
+        //! Build chargexyz_ and chargeq_ from the system and external charges
+        void build_charges_(void);
+
+        //! Determine the layout of a workspace, and allocate work_
+        void setup_workspace_(void);
+
+        //! Obtain shellpairs_, screened using the current point charges
+        void setup_shellpairs_(void);
+
+
+        /////////////////////////
+        // Far-field approximation
+        /////////////////////////
+        bool farfield_;
+        double farfield_theta_;
+
+        //! Octree of the point charges. Built in build_charges_
+        detail::ChargeOctree octree_;
 
-        uint64_t calculate_with_grid_(uint64_t shell1, uint64_t shell2,
-                                      const pulsar::math::Grid & grid,
-                                      double * outbuffer, size_t bufsize);
+        //! Binomial coefficients, stored as [n*(order+1) + k]
+        std::vector<double> binomial_;
 };
 
 
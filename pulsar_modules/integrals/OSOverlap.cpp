@@ -1,7 +1,12 @@
+#include <algorithm>
+#include <cmath>
+
 #include <pulsar/system/AOOrdering.hpp>
-#include <pulsar/system/SphericalTransformIntegral.hpp>
+#include <pulsar/constants.h>
 
 #include "Common/BasisSetCommon.hpp"
+#include "Integrals/GeneralContraction.hpp"
+#include "Integrals/OSOneElectronKernels.hpp"
 #include "Integrals/OSOverlapTerms.hpp"
 #include "Integrals/OSOverlap.hpp"
 
@@ -14,9 +19,20 @@ namespace psr_modules {
 namespace integrals {
 
 
-uint64_t OSOverlap::calculate_(uint64_t shell1, uint64_t shell2,
-                               double * outbuffer, size_t bufsize)
+uint64_t OSOverlap::calculate(uint64_t shell1, uint64_t shell2,
+                              double * outbuffer, size_t bufsize,
+                              IntegralWorkspace & ws) const
 {
+    detail::check_workspace(ws, worksize_);
+
+    // partition the workspace
+    double * xyzwork[3];
+    for(int d = 0; d < 3; d++)
+        xyzwork[d] = ws.data() + d*xyzwork_size_;
+    double * const transformwork = ws.data() + 3*xyzwork_size_;
+    double * const sourcework = transformwork + transformwork_size_;
+    double * const primwork = sourcework + sourcework_size_;
+
     const BasisSetShell & sh1 = bs1_->shell(shell1);
     const BasisSetShell & sh2 = bs2_->shell(shell2);
 
@@ -25,11 +41,41 @@ uint64_t OSOverlap::calculate_(uint64_t shell1, uint64_t shell2,
     if(bufsize < nfunc)
         throw PulsarException("Buffer is too small", "size", bufsize, "required", nfunc);
 
+    // precomputed primitive pair data
+    const ShellPairData & sp = shellpairs_->pair(shell1, shell2);
+
+    // shell pair is negligible
+    if(sp.nprim == 0)
+    {
+        std::fill(outbuffer, outbuffer + nfunc, 0.0);
+        return nfunc;
+    }
+
 
     // degree of general contraction
     const size_t ngen1 = sh1.n_general_contractions();
     const size_t ngen2 = sh2.n_general_contractions();
 
+    // Use the AM-specialized kernel if there is one. These only handle
+    // a single (non-combined) contraction on each shell
+    if(ngen1 == 1 && ngen2 == 1)
+    {
+        const detail::OneElectronKernel kernel = detail::overlap_kernel(sh1.am(), sh2.am());
+        if(kernel)
+        {
+            // cartesian integrals can go directly to the output
+            if(!detail::is_spherical(sh1) && !detail::is_spherical(sh2))
+            {
+                kernel(sp, outbuffer);
+                return nfunc;
+            }
+
+            kernel(sp, sourcework);
+            spherical_.transform_2center(sh1, sh2, sourcework, outbuffer, transformwork, 1);
+            return nfunc;
+        }
+    }
+
     ////////////////////////////////////////
     // These vectors store the ordering of
     // cartesian basis functions for each
@@ -54,32 +100,48 @@ uint64_t OSOverlap::calculate_(uint64_t shell1, uint64_t shell2,
     const int nam1 = std::abs(am1) + 1;
     const int nam2 = std::abs(am2) + 1;
 
-    // coordinates from each shell
-    const double * xyz1 = sh1.coords_ptr();
-    const double * xyz2 = sh2.coords_ptr();
-
-    // We need to zero the workspace. Actually, not all of it,
-    // but this is easier
-    std::fill(work_.begin(), work_.end(), 0.0);
+    // number of cartesian functions, including general contraction
+    size_t ncart1 = 0, ncart2 = 0;
+    for(const auto & ord : sh1_ordering)
+        ncart1 += ord->size();
+    for(const auto & ord : sh2_ordering)
+        ncart2 += ord->size();
+
+    // For general contractions of a single AM, the primitive integrals
+    // are only formed once for each primitive pair (in primwork), and are
+    // contracted with the coefficients afterwards as a matrix product
+    const bool gemm = detail::use_gemm_contraction(sh1, sh2);
+    const size_t nloop1 = gemm ? 1 : ngen1;
+    const size_t nloop2 = gemm ? 1 : ngen2;
+    const size_t nprimcart = sh1_ordering[0]->size() * sh2_ordering[0]->size();
+
+    // Only the part of the buffer used by this pair needs
+    // to be zeroed. The recurrence terms are always overwritten.
+    if(gemm)
+        std::fill(primwork, primwork + sp.nprim*nprimcart, 0.0);
+    else
+        std::fill(sourcework, sourcework + ncart1*ncart2, 0.0);
+
+    // loop over primitive pairs
+    for(size_t k = 0; k < sp.nprim; k++)
+    {
+        const double PA[3] = { sp.PA[0][k], sp.PA[1][k], sp.PA[2][k] };
+        const double PB[3] = { sp.PB[0][k], sp.PB[1][k], sp.PB[2][k] };
+        const double oop = sp.oop[k];
 
-    // loop over primitives
-    const size_t nprim1 = sh1.n_primitives();
-    const size_t nprim2 = sh2.n_primitives();
+        // (pi/p)^(3/2). exp(-mu*AB2) is included in the coefficients
+        const double pfac = PI * oop * sqrt(PI * oop);
 
-    for(size_t a = 0; a < nprim1; a++)
-    for(size_t b = 0; b < nprim2; b++)
-    {
         // Calculate all the S_ij terms
-        detail::os_overlap_terms(sh1.alpha(a), xyz1,
-                                 sh2.alpha(b), xyz2,
-                                 nam1, nam2, xyzwork_);
+        detail::os_overlap_terms(PA, PB, 0.5*oop, nam1, nam2, xyzwork);
 
         // general contraction and combined am
         size_t outidx = 0;
-        for(size_t g1 = 0; g1 < ngen1; g1++)
-        for(size_t g2 = 0; g2 < ngen2; g2++)
+        double * const dest = gemm ? primwork + k*nprimcart : sourcework;
+        for(size_t g1 = 0; g1 < nloop1; g1++)
+        for(size_t g2 = 0; g2 < nloop2; g2++)
         {
-            const double prefac = sh1.coef(g1, a) * sh2.coef(g2, b);
+            const double prefac = gemm ? pfac : pfac * sp.coef[(g1*ngen2 + g2)*sp.nprim + k];
 
             // go over the orderings for this AM
             for(const IJK & ijk1 : *(sh1_ordering[g1]))
@@ -89,24 +151,56 @@ uint64_t OSOverlap::calculate_(uint64_t shell1, uint64_t shell2,
                 const int yidx = ijk1[1]*nam2 + ijk2[1];
                 const int zidx = ijk1[2]*nam2 + ijk2[2];
 
-                const double val = xyzwork_[0][xidx] *
-                                   xyzwork_[1][yidx] *
-                                   xyzwork_[2][zidx];
+                const double val = xyzwork[0][xidx] *
+                                   xyzwork[1][yidx] *
+                                   xyzwork[2][zidx];
 
-                // remember: a and b are indices of primitives
-                sourcework_[outidx++] += prefac * val;
+                // remember: k is the index of the primitive pair
+                dest[outidx++] += prefac * val;
             }
         }
     }
 
-    // performs the spherical transform, if necessary
-    CartesianToSpherical_2Center(sh1, sh2, sourcework_, outbuffer, transformwork_, 1);
+    if(gemm)
+        detail::contract_primitives(sp, primwork, nprimcart, 1.0, sourcework);
+
+    // performs the spherical transform of each block, if necessary
+    spherical_.transform_2center(sh1, sh2, sourcework, outbuffer, transformwork, 1);
 
     return nfunc;
 }
 
 
 
+uint64_t OSOverlap::calculate_(uint64_t shell1, uint64_t shell2,
+                               double * outbuffer, size_t bufsize)
+{
+    return calculate(shell1, shell2, outbuffer, bufsize, work_);
+}
+
+
+
+uint64_t OSOverlap::calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                    double * outbuffer, size_t bufsize)
+{
+    return calculate_batch(pairs, npair, outbuffer, bufsize, work_);
+}
+
+
+
+uint64_t OSOverlap::calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                    double * outbuffer, size_t bufsize,
+                                    IntegralWorkspace & ws) const
+{
+    // calls calculate directly, bypassing the module base
+    auto calc = [this, &ws](uint64_t shell1, uint64_t shell2, double * buf, size_t size)
+                { return OSOverlap::calculate(shell1, shell2, buf, size, ws); };
+
+    return detail::batch_loop(calc, 1, pairs, npair, outbuffer, bufsize);
+}
+
+
+
 void OSOverlap::initialize_(unsigned int deriv,
                            const Wavefunction & wfn,
                            const BasisSet & bs1,
@@ -118,6 +212,9 @@ void OSOverlap::initialize_(unsigned int deriv,
     // from common components
     bs1_ = NormalizeBasis(cache(), out, bs1);
     bs2_ = NormalizeBasis(cache(), out, bs2);
+    shellpairs_ = ShellPairs(cache(), out, *bs1_, *bs2_,
+                             options().get<double>("SCREEN_THRESHOLD"));
+    spherical_ = detail::SphericalTransform(std::max(bs1_->max_am(), bs2_->max_am()));
 
     ///////////////////////////////////////
     // Determine the size of the workspace
@@ -138,13 +235,15 @@ void OSOverlap::initialize_(unsigned int deriv,
     maxsize2 = bs2_->max_property(n_cartesian_gaussian_in_shell);
     size_t sourcework_size = maxsize1 * maxsize2;
 
-    // allocate all at once, then partition
-    work_.resize(3*worksize + transformwork_size + sourcework_size);
-    xyzwork_[0] = work_.data();
-    xyzwork_[1] = xyzwork_[0] + worksize;
-    xyzwork_[2] = xyzwork_[1] + worksize;
-    transformwork_ = xyzwork_[2] + worksize;
-    sourcework_ = transformwork_ + transformwork_size;
+    // primitive integrals for the general contraction via matrix products
+    size_t primwork_size = detail::gemm_contraction_size(*bs1_, *bs2_);
+
+    // allocate all at once. The workspace is partitioned in calculate
+    xyzwork_size_ = worksize;
+    transformwork_size_ = transformwork_size;
+    sourcework_size_ = sourcework_size;
+    worksize_ = 3*worksize + transformwork_size + sourcework_size + primwork_size;
+    work_.resize(worksize_);
 }
 
 
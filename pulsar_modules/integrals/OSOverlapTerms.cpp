@@ -1,7 +1,3 @@
-#include <cmath>
-
-#include <pulsar/constants.h>
-
 // Get a value of S_IJ
 #define S_IJ(i,j) (s_ij[((i)*(nam2) + j)])
 
@@ -9,15 +5,10 @@ namespace psr_modules {
 namespace integrals {
 namespace detail {
 
-void os_overlap_terms(const double alpha1, const double xyz1[3],
-                      const double alpha2, const double xyz2[3],
+void os_overlap_terms(const double PA[3], const double PB[3], const double oo2p,
                       int nam1, int nam2,
                       double ** outbuffer)
 {
-    const double AB[3] = { xyz1[0] - xyz2[0], xyz1[1] - xyz2[1], xyz1[2] - xyz2[2] };
-    const double AB2[3] = { AB[0]*AB[0], AB[1]*AB[1], AB[2]*AB[2] };
-
-
     /////////////////////////////////////////////////////////
     // General notes about the following
     //
@@ -29,21 +20,10 @@ void os_overlap_terms(const double alpha1, const double xyz1[3],
     // The indexing of these arrays is pretty straightforward.
     // Sij = ptr[i*nam2+j]. This is in the S_IJ macro, hopefully
     // to make the code clearer.
+    //
+    // The prefactor (pi/p)^(3/2) * exp(-mu*AB2) is left
+    // to the caller.
     /////////////////////////////////////////////////////////
-    const double a1xyz[3] = { alpha1*xyz1[0], alpha1*xyz1[1], alpha1*xyz1[2] };
-    const double oop = 1.0/(alpha1 + alpha2); // = 1/p = 1/(a1 + a2)
-    const double mu = alpha1*alpha2*oop;      // (a1*a2)/(a1+a2)
-
-    const double oo2p = 0.5*oop;
-    const double a2xyz[3] = { alpha2*xyz2[0], alpha2*xyz2[1], alpha2*xyz2[2] };
-
-    const double P[3] = { (a1xyz[0]+a2xyz[0])*oop,
-                          (a1xyz[1]+a2xyz[1])*oop,
-                          (a1xyz[2]+a2xyz[2])*oop };
-
-    const double PA[3] = { P[0] - xyz1[0], P[1] - xyz1[1], P[2] - xyz1[2] };
-    const double PB[3] = { P[0] - xyz2[0], P[1] - xyz2[1], P[2] - xyz2[2] };
-
 
     // three cartesian directions
     for(int d = 0; d < 3; d++)
@@ -52,7 +32,7 @@ void os_overlap_terms(const double alpha1, const double xyz1[3],
         // THIS IS THEN ACCESSED THROUGH THE S_IJ MACRO
         double * const s_ij = outbuffer[d];
 
-        S_IJ(0,0) = sqrt(PI * oop) * exp(-mu * AB2[d]);
+        S_IJ(0,0) = 1.0;
 
         // do j = 0 for all remaining i
         for(int i = 1; i < nam1; i++)
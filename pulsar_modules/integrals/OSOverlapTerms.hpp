@@ -20,20 +20,23 @@ namespace detail {
  * All pairs of i, j are calculated, with i in the range [0, \p nam1)
  * and j in the range [0, \p nam2).
  *
+ * The terms are calculated relative to \f$ S_{00} = 1 \f$. That is,
+ * the product of the three directions must still be multiplied by
+ * \f$ (\pi/p)^{3/2} e^{-\mu |AB|^2} \f$ (which is typically
+ * folded into the contraction coefficients, see ShellPairData).
+ *
  * The results are stored as \p outbuffer[d][i*nam2+j]
  *
- * \param [in] alpha1 The exponent parameter of the first gaussian
- * \param [in] xyz1   The coordinates of the first gaussian
- * \param [in] alpha2 The exponent parameter of the second gaussian
- * \param [in] xyz2   The coordinates of the second gaussian
+ * \param [in] PA     P - A for the primitive pair
+ * \param [in] PB     P - B for the primitive pair
+ * \param [in] oo2p   1/(2p) for the primitive pair
  * \param [in] nam1   Number of angular momentum terms to calculate
  *                    (for each direction) for the first center
  * \param [in] nam2   Number of angular momentum terms to calculate
  *                    (for each direction) for the second center
  * \param [out] outbuffer Results buffer. Dimentions should be [3][nam1*nam2] 
  */
-void os_overlap_terms(const double alpha1, const double xyz1[3],
-                      const double alpha2, const double xyz2[3],
+void os_overlap_terms(const double PA[3], const double PB[3], const double oo2p,
                       int nam1, int nam2,
                       double ** outbuffer);
 
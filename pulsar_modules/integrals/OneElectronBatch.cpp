@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <tuple>
+
+#include "Integrals/OneElectronBatch.hpp"
+
+using namespace pulsar::exception;
+using namespace pulsar::system;
+using namespace pulsar::modulebase;
+
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+uint64_t calculate_batch(OneElectronIntegral & mod,
+                         const ShellPairIndex * pairs, size_t npair,
+                         double * outbuffer, size_t bufsize)
+{
+    OneElectronBatch * batchmod = dynamic_cast<OneElectronBatch *>(&mod);
+    if(batchmod)
+        return batchmod->calculate_batch(pairs, npair, outbuffer, bufsize);
+
+    // module doesn't support batches (for example, a python module)
+    auto calc = [&mod](uint64_t shell1, uint64_t shell2, double * buf, size_t size)
+                { return mod.calculate(shell1, shell2, buf, size); };
+
+    return batch_loop(calc, mod.n_components(), pairs, npair, outbuffer, bufsize);
+}
+
+
+
+std::vector<ShellPairIndex> sorted_shell_pairs(const BasisSet & bs1,
+                                               const BasisSet & bs2,
+                                               bool upper_triangle)
+{
+    const size_t nshell1 = bs1.n_shell();
+    const size_t nshell2 = bs2.n_shell();
+
+    std::vector<ShellPairIndex> pairs;
+    pairs.reserve(nshell1*nshell2);
+
+    for(size_t n1 = 0; n1 < nshell1; n1++)
+    for(size_t n2 = (upper_triangle ? n1 : 0); n2 < nshell2; n2++)
+        pairs.emplace_back(n1, n2);
+
+    auto pair_class = [&bs1, &bs2](const ShellPairIndex & p)
+    {
+        const BasisSetShell & sh1 = bs1.shell(p.first);
+        const BasisSetShell & sh2 = bs2.shell(p.second);
+        return std::make_tuple(sh1.am(), sh2.am(),
+                               sh1.n_general_contractions(), sh2.n_general_contractions(),
+                               sh1.n_primitives()*sh2.n_primitives());
+    };
+
+    // stable, so that pairs within a class stay in the original order
+    std::stable_sort(pairs.begin(), pairs.end(),
+                     [&pair_class](const ShellPairIndex & a, const ShellPairIndex & b)
+                     { return pair_class(a) < pair_class(b); });
+
+    return pairs;
+}
+
+
+
+ShellBlocks shell_blocks(const BasisSet & bs)
+{
+    const size_t nshell = bs.n_shell();
+
+    ShellBlocks ret;
+    ret.start.resize(nshell);
+    ret.nfunc.resize(nshell);
+    ret.gensize.resize(nshell);
+
+    for(size_t n = 0; n < nshell; n++)
+    {
+        const BasisSetShell & sh = bs.shell(n);
+        ret.start[n] = bs.shell_start(n);
+        ret.nfunc[n] = sh.n_functions();
+        for(size_t g = 0; g < sh.n_general_contractions(); g++)
+            ret.gensize[n].push_back(sh.general_n_functions(g));
+    }
+
+    return ret;
+}
+
+
+
+std::vector<size_t> split_batches(const std::vector<ShellPairIndex> & pairs,
+                                  const BasisSet & bs1,
+                                  const BasisSet & bs2,
+                                  unsigned int ncomp, size_t maxsize)
+{
+    std::vector<size_t> ret{0};
+    size_t cursize = 0;
+
+    for(size_t i = 0; i < pairs.size(); i++)
+    {
+        const size_t n = ncomp * bs1.shell(pairs[i].first).n_functions()
+                               * bs2.shell(pairs[i].second).n_functions();
+
+        if(n > maxsize)
+            throw PulsarException("Batch buffer is too small for a single shell pair",
+                                  "maxsize", maxsize, "required", n);
+
+        if(cursize + n > maxsize)
+        {
+            ret.push_back(i);
+            cursize = 0;
+        }
+
+        cursize += n;
+    }
+
+    if(pairs.size() > 0)
+        ret.push_back(pairs.size());
+
+    return ret;
+}
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <pulsar/modulebase/OneElectronIntegral.hpp>
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+/*! \brief Default size (number of elements) of the output buffer for batches */
+const size_t default_batch_bufsize = 65536;
+
+
+/*! \brief Indices of a pair of shells (shell on the first basis, shell on the second) */
+typedef std::pair<uint64_t, uint64_t> ShellPairIndex;
+
+
+/*! \brief Interface for one-electron integral modules that can calculate
+ *         many shell pairs in a single call
+ *
+ * Modules implementing this (in addition to OneElectronIntegral) avoid
+ * going through the module base for every shell pair.
+ * Consumers should go through calculate_batch(OneElectronIntegral &, ...),
+ * which falls back to calling calculate() for modules that do not
+ * implement it.
+ */
+class OneElectronBatch
+{
+    public:
+        virtual ~OneElectronBatch() = default;
+
+        /*! \brief Calculate integrals for a list of shell pairs
+         *
+         * The integrals for each pair are written contiguously, in the order
+         * of \p pairs. Each pair takes ncomp*nfunc elements (nfunc being the
+         * number of functions in the pair), laid out the same as for a single
+         * call to calculate().
+         *
+         * \return The total number of functions (sum of nfunc over all pairs)
+         */
+        virtual uint64_t calculate_batch(const ShellPairIndex * pairs, size_t npair,
+                                         double * outbuffer, size_t bufsize) = 0;
+};
+
+
+/*! \brief Loop over a batch of shell pairs, calling \p calc for each
+ *
+ * Used to implement OneElectronBatch::calculate_batch. \p calc
+ * should have the same signature as OneElectronIntegral::calculate_
+ * (and is usually the module's calculate_, called non-virtually).
+ */
+template<typename Calc>
+uint64_t batch_loop(Calc calc, unsigned int ncomp,
+                    const ShellPairIndex * pairs, size_t npair,
+                    double * outbuffer, size_t bufsize)
+{
+    uint64_t ntotal = 0;
+
+    for(size_t i = 0; i < npair; i++)
+    {
+        const uint64_t n = calc(pairs[i].first, pairs[i].second, outbuffer, bufsize);
+        outbuffer += ncomp*n;
+        bufsize -= ncomp*n;
+        ntotal += n;
+    }
+
+    return ntotal;
+}
+
+
+/*! \brief Calculate integrals for a list of shell pairs with any one-electron module
+ *
+ * Uses the module's OneElectronBatch interface if it has one, otherwise
+ * calls calculate() for each pair. The layout of the output is as described
+ * in OneElectronBatch::calculate_batch.
+ */
+uint64_t calculate_batch(pulsar::modulebase::OneElectronIntegral & mod,
+                         const ShellPairIndex * pairs, size_t npair,
+                         double * outbuffer, size_t bufsize);
+
+
+/*! \brief All pairs of shells of two basis sets, sorted by AM class
+ *
+ * Pairs are sorted by the angular momentum of the first shell, then
+ * of the second, then by the number of primitives, so that consecutive
+ * pairs go through the same code path in the integral modules.
+ *
+ * \param [in] upper_triangle Only include pairs with shell1 <= shell2
+ *                            (for symmetric operators with bs1 == bs2)
+ */
+std::vector<ShellPairIndex> sorted_shell_pairs(const pulsar::system::BasisSet & bs1,
+                                               const pulsar::system::BasisSet & bs2,
+                                               bool upper_triangle = false);
+
+
+/*! \brief Where the integrals of each shell of a basis set go in a full matrix
+ *
+ * The integrals for a pair of shells come as a row-major block
+ * for each pair of general contractions (not as a single row-major
+ * block for the whole pair).
+ */
+struct ShellBlocks
+{
+    std::vector<size_t> start;                 //!< Index of the first function of each shell
+    std::vector<size_t> nfunc;                 //!< Number of functions in each shell
+    std::vector<std::vector<size_t>> gensize;  //!< Number of functions in each general contraction
+};
+
+
+/*! \brief Obtain the ShellBlocks for a basis set */
+ShellBlocks shell_blocks(const pulsar::system::BasisSet & bs);
+
+
+/*! \brief Split a list of shell pairs into batches that fit in a buffer
+ *
+ * \return The start of each batch, followed by the end of the last
+ *         batch (ie, batch i is [ret[i], ret[i+1]))
+ *
+ * \param [in] maxsize Maximum number of elements in the output of a batch.
+ *                     Must be at least ncomp*max_n_functions of each basis.
+ */
+std::vector<size_t> split_batches(const std::vector<ShellPairIndex> & pairs,
+                                  const pulsar::system::BasisSet & bs1,
+                                  const pulsar::system::BasisSet & bs2,
+                                  unsigned int ncomp, size_t maxsize);
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
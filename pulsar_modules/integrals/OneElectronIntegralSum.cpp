@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "Integrals/OneElectronIntegralSum.hpp"
 
 #include <pulsar/util/StringUtil.hpp>
@@ -21,16 +23,50 @@ uint64_t OneElectronIntegralSum::calculate_(uint64_t shell1, uint64_t shell2,
     uint64_t n_initial = it->second->calculate(shell1, shell2,
                                                outbuffer, bufsize);
 
-    // now allocate the buffer and loop over the rest
-    std::vector<double> tmpbuf(n_initial, 0.0);
-
-    // loop over the rest
+    // loop over the rest. The temporary buffer is allocated in initialize_
     ++it;
     while(it != modules_.end())
     {
         uint64_t n = it->second->calculate(shell1, shell2,
-                                           tmpbuf.data(),
-                                           n_initial);
+                                           tmpbuf_.data(),
+                                           tmpbuf_.size());
+
+        if(n != n_initial)
+            throw PulsarException("Error - inconsistent number of values returned by OneElectronIntegrals",
+                                   "n", n, "nexpected", n_initial,
+                                   "modulekey", it->second->key(),
+                                   "modulename", it->second->name());
+
+        for(size_t i = 0; i < n; i++)
+            outbuffer[i] += tmpbuf_[i];
+
+        ++it;
+    }
+
+    return n_initial;
+}
+
+
+
+uint64_t OneElectronIntegralSum::calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                                 double * outbuffer, size_t bufsize)
+{
+    // Same as calculate_, but each module does the whole batch at once
+    auto it = modules_.begin();
+
+    uint64_t n_initial = detail::calculate_batch(*(it->second), pairs, npair,
+                                                 outbuffer, bufsize);
+
+    // The temporary buffer only grows, so this only
+    // allocates for the first (largest) batches
+    if(tmpbuf_.size() < bufsize)
+        tmpbuf_.resize(bufsize);
+
+    ++it;
+    while(it != modules_.end())
+    {
+        uint64_t n = detail::calculate_batch(*(it->second), pairs, npair,
+                                             tmpbuf_.data(), tmpbuf_.size());
 
         if(n != n_initial)
             throw PulsarException("Error - inconsistent number of values returned by OneElectronIntegrals",
@@ -39,7 +75,7 @@ uint64_t OneElectronIntegralSum::calculate_(uint64_t shell1, uint64_t shell2,
                                    "modulename", it->second->name());
 
         for(size_t i = 0; i < n; i++)
-            outbuffer[i] += tmpbuf[i];
+            outbuffer[i] += tmpbuf_[i];
 
         ++it;
     }
@@ -61,13 +97,18 @@ void OneElectronIntegralSum::initialize_(unsigned int deriv,
         throw PulsarException("No modules given to OneElectronIntegralSum");
 
 
+    unsigned int maxcomp = 1;
     for(const auto & a : mods)
     {
         auto mod_add = create_child<OneElectronIntegral>(a);
         mod_add->initialize(deriv, wfn, bs1, bs2);
+        maxcomp = std::max(maxcomp, mod_add->n_components());
         modules_.emplace(a, std::move(mod_add));
     }
 
+    // Buffer for the results of all modules except the first
+    tmpbuf_.resize(maxcomp * bs1.max_n_functions() * bs2.max_n_functions());
+
 
     // Print out my info
     out.output("%? initialized with %? modules\n",
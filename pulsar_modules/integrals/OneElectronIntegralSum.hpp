@@ -2,6 +2,8 @@
 
 #include <pulsar/modulebase/OneElectronIntegral.hpp>
 
+#include "Integrals/OneElectronBatch.hpp"
+
 namespace psr_modules {
 namespace integrals {
 
@@ -11,7 +13,8 @@ namespace integrals {
  * to calculate() will in turn call these modules and sum the results into
  * the output buffer.
  */
-class OneElectronIntegralSum : public pulsar::modulebase::OneElectronIntegral
+class OneElectronIntegralSum : public pulsar::modulebase::OneElectronIntegral,
+                               public detail::OneElectronBatch
 {
     public:
         using pulsar::modulebase::OneElectronIntegral::OneElectronIntegral;
@@ -24,11 +27,17 @@ class OneElectronIntegralSum : public pulsar::modulebase::OneElectronIntegral
         virtual uint64_t calculate_(uint64_t shell1, uint64_t shell2,
                                     double * outbuffer, size_t bufsize);
 
+        virtual uint64_t calculate_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                                         double * outbuffer, size_t bufsize);
+
     private:
         typedef pulsar::modulemanager::ModulePtr<pulsar::modulebase::OneElectronIntegral> OneInt;
 
         //! The modules to use in constructing the core hamiltonian
         std::map<std::string, OneInt> modules_;
+
+        //! Results for a term, before being added to the output buffer
+        std::vector<double> tmpbuf_;
 };
 
 } // close namespace integrals
@@ -1,9 +1,14 @@
+#include <algorithm>
+
 #include <pulsar/system/BasisSet.hpp>
-#include <pulsar/system/AOIterator.hpp>
 #include <pulsar/modulebase/OneElectronIntegral.hpp>
+#include <pulsar/math/EigenImpl.hpp>
 
 #include "Integrals/OneElectronProperty.hpp"
+#include "Integrals/OneElectronBatch.hpp"
+
 
+using Eigen::MatrixXd;
 
 using namespace pulsar::exception;
 using namespace pulsar::system;
@@ -12,6 +17,77 @@ using namespace pulsar::modulebase;
 using namespace pulsar::math;
 
 
+namespace {
+
+using namespace psr_modules::integrals;
+
+// Integrals for a single component of a pair of general contractions, as returned from the module
+typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrix;
+
+
+/* Contracts the integrals for a batch of shell pairs with several densities
+ *
+ * For each density d and component c, sum_ij D_d(i,j) I_c(i,j) is
+ * added to result[d*ncomp + c]. Each block of integrals is contracted
+ * with the matching tile of each density while it is still in cache.
+ *
+ * If symmetric, the batch only contains pairs with shell1 <= shell2,
+ * and pairs off the diagonal also account for I_c(j,i) = I_c(i,j).
+ */
+void contract_batch(const detail::ShellPairIndex * pairs, size_t npair,
+                    const double * ints, unsigned int ncomp,
+                    const detail::ShellBlocks & blocks1,
+                    const detail::ShellBlocks & blocks2,
+                    const std::vector<std::shared_ptr<const MatrixXd>> & dens,
+                    bool symmetric, double * result)
+{
+    const size_t ndens = dens.size();
+
+    for(size_t p = 0; p < npair; p++)
+    {
+        const size_t n1 = pairs[p].first;
+        const size_t n2 = pairs[p].second;
+        const size_t nfunc = blocks1.nfunc[n1] * blocks2.nfunc[n2];
+        const bool offdiag = symmetric && n1 != n2;
+
+        const double * genbuf = ints;
+
+        // Each component is a separate block of nfunc integrals. Within
+        // a component, the integrals are a row-major block for each
+        // pair of general contractions
+        for(unsigned int c = 0; c < ncomp; c++)
+        {
+            size_t row = blocks1.start[n1];
+            for(size_t ng1 : blocks1.gensize[n1])
+            {
+                size_t col = blocks2.start[n2];
+                for(size_t ng2 : blocks2.gensize[n2])
+                {
+                    Eigen::Map<const RowMajorMatrix> block(genbuf, ng1, ng2);
+
+                    for(size_t d = 0; d < ndens; d++)
+                    {
+                        const MatrixXd & D = *dens[d];
+                        double val = block.cwiseProduct(D.block(row, col, ng1, ng2)).sum();
+                        if(offdiag)
+                            val += block.cwiseProduct(D.block(col, row, ng2, ng1).transpose()).sum();
+                        result[d*ncomp + c] += val;
+                    }
+
+                    genbuf += ng1*ng2;
+                    col += ng2;
+                }
+                row += ng1;
+            }
+        }
+
+        ints += ncomp*nfunc;
+    }
+}
+
+} // close anonymous namespace
+
+
 namespace psr_modules {
 namespace integrals {
 
@@ -23,55 +99,80 @@ OneElectronProperty::calculate_(unsigned int deriv,
                                 const BasisSet & bs2)
 
 {
-    const size_t nshell1 = bs1.n_shell();
-    const size_t nshell2 = bs2.n_shell();
+    if(!wfn.opdm)
+        throw PulsarException("Wavefunction does not have a density matrix");
 
     auto mod = create_child_from_option<OneElectronIntegral>("KEY_ONEEL_MOD");
     mod->initialize(deriv, wfn, bs1, bs2);
-    const unsigned int ncomp = mod->n_components(); 
+    const unsigned int ncomp = mod->n_components();
+
+    // The density for each spin. These are contracted with the integrals
+    // in a single pass, and the results summed afterwards
+    std::vector<std::shared_ptr<const MatrixXd>> dens;
+    for(auto s : wfn.opdm->get_spins(Irrep::A))
+    {
+        dens.push_back(convert_to_eigen(wfn.opdm->get(Irrep::A, s)));
+
+        const MatrixXd & D = *dens.back();
+        if(static_cast<size_t>(D.rows()) < bs1.n_functions() ||
+           static_cast<size_t>(D.cols()) < bs2.n_functions())
+            throw PulsarException("Density matrix is too small for the basis sets",
+                                  "rows", D.rows(), "cols", D.cols(),
+                                  "nfunc1", bs1.n_functions(), "nfunc2", bs2.n_functions());
+    }
+
+    // For a symmetric operator on a single basis set, only the upper
+    // triangle (by shell) needs to be calculated. Nothing tells us whether
+    // an arbitrary module is symmetric, so this has to be asked for
+    const bool symmetric = options().get<bool>("SYMMETRIC") && bs1 == bs2;
+
+    // All shell pairs, sorted by AM class, and split into
+    // batches that are calculated with a single call
+    const std::vector<detail::ShellPairIndex> pairs = detail::sorted_shell_pairs(bs1, bs2, symmetric);
 
     // size of the workspace depends on the number of components
-    size_t worksize = ncomp*bs1.max_n_functions()*bs2.max_n_functions();
+    const size_t worksize = std::max(detail::default_batch_bufsize,
+                                     ncomp*bs1.max_n_functions()*bs2.max_n_functions());
     std::vector<double> work(worksize);
 
-    std::vector<double> val(ncomp);
-    std::fill(val.begin(), val.end(), 0.0);
+    const std::vector<size_t> batches = detail::split_batches(pairs, bs1, bs2, ncomp, worksize);
 
-    for(size_t n1 = 0; n1 < nshell1; n1++)
-    {
-        const auto & sh1 = bs1.shell(n1);
-        const size_t rowstart = bs1.shell_start(n1);
-
-        for(size_t n2 = 0; n2 < nshell2; n2++)
-        {
-            const auto & sh2  = bs2.shell(n2);
-            const size_t colstart = bs2.shell_start(n2);
+    // Where the integrals for each shell go in the density
+    const detail::ShellBlocks blocks1 = detail::shell_blocks(bs1);
+    const detail::ShellBlocks blocks2 = detail::shell_blocks(bs2);
 
-            // calculate
-            size_t ncalc = mod->calculate(n1, n2, work.data(), worksize);
+    // values for each density and component
+    std::vector<double> densval(dens.size()*ncomp, 0.0);
 
-            // iterate and fill in the matrix
-            AOIterator<2> aoit({sh1, sh2}, false);
+    for(size_t b = 0; b+1 < batches.size(); b++)
+    {
+        const size_t pstart = batches[b];
+        const size_t pend = batches[b+1];
 
-            // make sure the right number of integrals was returned
-            if(ncalc != aoit.n_functions())
-                throw PulsarException("Bad number of integrals returned",
-                                       "ncalc", ncalc, "expected", aoit.n_functions());
+        // calculate
+        const size_t ncalc = detail::calculate_batch(*mod, pairs.data() + pstart, pend - pstart,
+                                                     work.data(), worksize);
 
+        // make sure the right number of integrals was returned
+        size_t nexpected = 0;
+        for(size_t p = pstart; p < pend; p++)
+            nexpected += blocks1.nfunc[pairs[p].first] * blocks2.nfunc[pairs[p].second];
 
-            do {
-                const size_t i = rowstart+aoit.shell_function_idx<0>();
-                const size_t j = colstart+aoit.shell_function_idx<1>();
+        if(ncalc != nexpected)
+            throw PulsarException("Bad number of integrals returned",
+                                   "ncalc", ncalc, "expected", nexpected);
 
-                for(auto s : wfn.opdm->get_spins(Irrep::A))
-                {
-                    for(unsigned int c = 0; c < ncomp; c++)
-                        val[c] += wfn.opdm->get(Irrep::A, s)->get_value({i,j}) * work[aoit.total_idx() + c*ncalc];
-                }
-            } while(aoit.next());
-        }
+        // contract with the densities
+        contract_batch(pairs.data() + pstart, pend - pstart, work.data(), ncomp,
+                       blocks1, blocks2, dens, symmetric, densval.data());
     }
 
+    // sum over spins
+    std::vector<double> val(ncomp, 0.0);
+    for(size_t d = 0; d < dens.size(); d++)
+    for(unsigned int c = 0; c < ncomp; c++)
+        val[c] += densval[d*ncomp + c];
+
     return val;
 }
 
@@ -1,7 +1,11 @@
-#include <pulsar/system/AOIterator.hpp>
+#include <algorithm>
+
 #include <pulsar/modulebase/OneElectronIntegral.hpp>
 #include <pulsar/math/EigenImpl.hpp>
 #include "Integrals/OneElectron_Eigen.hpp"
+#include "Integrals/OneElectronBatch.hpp"
+#include "Integrals/IntegralWorkspace.hpp"
+#include "pulsar_modules/common/ParallelCommon.hpp"
 
 using Eigen::MatrixXd;
 
@@ -54,54 +58,133 @@ OneElectron_Eigen::calculate_(const std::string & key,
 
     out.debug("integrals not found or cache is not being used. Calculating\n");
 
-    const size_t nshell1 = bs1.n_shell();
-    const size_t nshell2 = bs2.n_shell();
     const size_t nfunc1 = bs1.n_functions();
     const size_t nfunc2 = bs2.n_functions();
 
-    // actually create the module
-    auto mod = create_child<OneElectronIntegral>(key);
-    mod->initialize(deriv, wfn, bs1, bs2);
-    const unsigned int ncomp = mod->n_components(); 
+    const size_t nthread = ResolveNThreads(options().get<size_t>("NTHREADS"));
 
-    const size_t bufsize = ncomp * bs1.max_n_functions() * bs2.max_n_functions();
-    std::unique_ptr<double []> buffer(new double[bufsize]);
+    // actually create the modules. A reentrant module is shared by all
+    // threads, each with its own workspace. Otherwise, each thread gets
+    // its own instance of the module.
+    auto make_mod = [&](void)
+    {
+        auto mod = create_child<OneElectronIntegral>(key);
+        mod->initialize(deriv, wfn, bs1, bs2);
+        return mod;
+    };
 
-    // vector of ncomp elements, each created with the proper size
-    std::vector<MatrixXd> mats(ncomp, MatrixXd(nfunc1, nfunc2));
+    auto mods = MakeThreadModules(1, make_mod);
 
-    for(size_t n1 = 0; n1 < nshell1; n1++)
-    {
-        const auto & sh1 = bs1.shell(n1);
-        const size_t rowstart = bs1.shell_start(n1);
+    const detail::ReentrantOneElectron * reentrant =
+            dynamic_cast<const detail::ReentrantOneElectron *>(&(*mods[0]));
 
-        for(size_t n2 = 0; n2 < nshell2; n2++)
-        {
-            const auto & sh2  = bs2.shell(n2);
-            const size_t colstart = bs2.shell_start(n2);
+    if(!reentrant)
+        AddThreadModules(mods, nthread, make_mod);
+
+    const unsigned int ncomp = mods[0]->n_components(); 
 
-            // calculate
-            size_t ncalc = mod->calculate(n1, n2, buffer.get(), bufsize);
+    // For a symmetric operator on a single basis set, only the upper
+    // triangle (by shell) needs to be calculated. Nothing tells us whether
+    // an arbitrary module is symmetric, so this has to be asked for
+    const bool symmetric = options().get<bool>("SYMMETRIC") && bs1 == bs2;
 
-            // iterate and fill in the matrix
-            AOIterator<2> aoit({sh1, sh2}, false);
+    // All shell pairs, sorted by AM class, and split into
+    // batches that are calculated with a single call
+    const std::vector<detail::ShellPairIndex> pairs = detail::sorted_shell_pairs(bs1, bs2, symmetric);
 
-            // make sure the right number of integrals was returned
-            if(ncalc != aoit.n_functions() * ncomp)
-                throw PulsarException("Bad number of integrals returned",
-                                       "ncalc", ncalc, "expected", ncomp * aoit.n_functions());
+    const size_t bufsize = std::max(detail::default_batch_bufsize,
+                                    ncomp * bs1.max_n_functions() * bs2.max_n_functions());
 
-            do {
-                const size_t i = rowstart+aoit.shell_function_idx<0>();
-                const size_t j = colstart+aoit.shell_function_idx<1>();
+    const std::vector<size_t> batches = detail::split_batches(pairs, bs1, bs2, ncomp, bufsize);
+    const size_t nbatch = batches.size() - 1;
 
-                for(unsigned int c = 0; c < ncomp; c++)
-                    mats[c](i,j) = buffer[aoit.total_idx()];
+    // Where the integrals for each shell go in the matrices
+    const detail::ShellBlocks blocks1 = detail::shell_blocks(bs1);
+    const detail::ShellBlocks blocks2 = detail::shell_blocks(bs2);
 
-            } while(aoit.next());
+    // vector of ncomp elements, each created with the proper size
+    std::vector<MatrixXd> mats(ncomp, MatrixXd(nfunc1, nfunc2));
+
+    // Integrals for a single component of a pair, as returned from the module
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrix;
+
+    ParallelErrors errors;
+
+    #pragma omp parallel num_threads(static_cast<int>(nthread))
+    {
+        OneElectronIntegral & mod = *mods[reentrant ? 0 : ThreadIndex()];
+        IntegralWorkspace ws;
+        if(reentrant)
+            ws = reentrant->make_workspace();
+
+        std::vector<double> buffer(bufsize);
+
+        #pragma omp for schedule(dynamic)
+        for(size_t b = 0; b < nbatch; b++)
+        {
+            errors.Run([&](void)
+            {
+                const size_t pstart = batches[b];
+                const size_t pend = batches[b+1];
+
+                // calculate
+                const size_t ncalc = reentrant ?
+                                     reentrant->calculate_batch(pairs.data() + pstart, pend - pstart,
+                                                                buffer.data(), bufsize, ws) :
+                                     detail::calculate_batch(mod, pairs.data() + pstart, pend - pstart,
+                                                             buffer.data(), bufsize);
+
+                // go through the pairs of the batch and copy
+                // whole shell blocks into the matrices
+                const double * pairbuf = buffer.data();
+                size_t nexpected = 0;
+
+                for(size_t p = pstart; p < pend; p++)
+                {
+                    const size_t n1 = pairs[p].first;
+                    const size_t n2 = pairs[p].second;
+                    const size_t nfunc = blocks1.nfunc[n1] * blocks2.nfunc[n2];
+
+                    // each component is a separate block of nfunc integrals
+                    for(unsigned int c = 0; c < ncomp; c++)
+                    {
+                        const double * genbuf = pairbuf + c*nfunc;
+
+                        size_t row = blocks1.start[n1];
+                        for(size_t ng1 : blocks1.gensize[n1])
+                        {
+                            size_t col = blocks2.start[n2];
+                            for(size_t ng2 : blocks2.gensize[n2])
+                            {
+                                Eigen::Map<const RowMajorMatrix> block(genbuf, ng1, ng2);
+                                mats[c].block(row, col, ng1, ng2) = block;
+
+                                // fill in the other triangle. Each thread has different
+                                // pairs, so none of these blocks overlap
+                                if(symmetric && n1 != n2)
+                                    mats[c].block(col, row, ng2, ng1) = block.transpose();
+
+                                genbuf += ng1*ng2;
+                                col += ng2;
+                            }
+                            row += ng1;
+                        }
+                    }
+
+                    pairbuf += ncomp*nfunc;
+                    nexpected += nfunc;
+                }
+
+                // make sure the right number of integrals was returned
+                if(ncalc != nexpected)
+                    throw PulsarException("Bad number of integrals returned",
+                                           "ncalc", ncalc, "expected", nexpected);
+            });
         }
     }
 
+    errors.Rethrow();
+
 
     // std::shared_ptr<const ...> is not serializable, so we actually store
     // non-const version in cache
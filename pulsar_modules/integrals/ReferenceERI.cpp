@@ -1,30 +1,35 @@
+#include <algorithm>
+#include <cmath>
 #include <pulsar/output/OutputStream.hpp>
 #include <pulsar/system/AOOrdering.hpp>
-#include <pulsar/system/SphericalTransformIntegral.hpp>
+#include <pulsar/math/Factorial.hpp>
+#include <pulsar/constants.h>
 
 #include "Common/BasisSetCommon.hpp"
 #include "Integrals/ReferenceERI.hpp"
+#include "Integrals/ValeevRef.hpp"
 
 using namespace pulsar::output;
 using namespace pulsar::exception;
 using namespace pulsar::system;
 using namespace pulsar::datastore;
+using psr_modules::integrals::IntegralWorkspace;
+using psr_modules::integrals::detail::SphericalTransform;
 
-////////////////////////////////////////////////////////////////////////////////////////
-// In ValeevRef.cpp
-double ValeevRef_eri(int l1, int m1, int n1, double alpha1, const double* A,
-                     int l2, int m2, int n2, double alpha2, const double* B,
-                     int l3, int m3, int n3, double alpha3, const double* C,
-                     int l4, int m4, int n4, double alpha4, const double* D);
-////////////////////////////////////////////////////////////////////////////////////////
 
 
+uint64_t ReferenceERI::calculate(size_t shell1, size_t shell2,
+                                 size_t shell3, size_t shell4,
+                                 double * outbuffer, size_t bufsize,
+                                 IntegralWorkspace & ws) const
+{
+    psr_modules::integrals::detail::check_workspace(ws, worksize_);
 
+    // partition the workspace
+    double * const sourcework = ws.data();
+    double * const transformwork = sourcework + sourcework_size_;
+    double * const fastwork = transformwork + transformwork_size_;
 
-uint64_t ReferenceERI::calculate_(size_t shell1, size_t shell2,
-                                  size_t shell3, size_t shell4,
-                                  double * outbuffer, size_t bufsize)
-{
     const BasisSetShell & sh1 = bs1_->shell(shell1);
     const BasisSetShell & sh2 = bs2_->shell(shell2);
     const BasisSetShell & sh3 = bs3_->shell(shell3);
@@ -35,6 +40,36 @@ uint64_t ReferenceERI::calculate_(size_t shell1, size_t shell2,
     if(bufsize < nfunc)
         throw PulsarException("Buffer to small for ERI", "bufsize", bufsize, "nfunc", nfunc);
 
+    if(fast_)
+        calculate_fast_(shell1, shell2, shell3, shell4, sourcework, fastwork);
+    else
+        calculate_reference_(shell1, shell2, shell3, shell4, sourcework);
+
+    spherical_.transform_4center(sh1, sh2, sh3, sh4, sourcework, outbuffer, transformwork);
+
+    return nfunc;
+}
+
+
+
+uint64_t ReferenceERI::calculate_(size_t shell1, size_t shell2,
+                                  size_t shell3, size_t shell4,
+                                  double * outbuffer, size_t bufsize)
+{
+    return calculate(shell1, shell2, shell3, shell4, outbuffer, bufsize, work_);
+}
+
+
+
+void ReferenceERI::calculate_reference_(size_t shell1, size_t shell2,
+                                        size_t shell3, size_t shell4,
+                                        double * sourcework) const
+{
+    const BasisSetShell & sh1 = bs1_->shell(shell1);
+    const BasisSetShell & sh2 = bs2_->shell(shell2);
+    const BasisSetShell & sh3 = bs3_->shell(shell3);
+    const BasisSetShell & sh4 = bs4_->shell(shell4);
+
     // lots of loops. This isn't really meant to be fast....
     size_t idx = 0;
 
@@ -77,17 +112,153 @@ uint64_t ReferenceERI::calculate_(size_t shell1, size_t shell2,
                             myint += val * sh1.get_coef(ng1, i) * sh2.get_coef(ng2, j) * sh3.get_coef(ng3, k) * sh4.get_coef(ng4, l);
                         }
 
-                        sourcework_[idx++] = myint;
+                        sourcework[idx++] = myint;
                     }
                 }
             }
         }
     }
+}
 
 
-    CartesianToSpherical_4Center(sh1, sh2, sh3, sh4, sourcework_, outbuffer, transformwork_, 1);
 
-    return nfunc;
+void ReferenceERI::calculate_fast_(size_t shell1, size_t shell2,
+                                   size_t shell3, size_t shell4,
+                                   double * sourcework, double * work) const
+{
+    const BasisSetShell & sh1 = bs1_->shell(shell1);
+    const BasisSetShell & sh2 = bs2_->shell(shell2);
+    const BasisSetShell & sh3 = bs3_->shell(shell3);
+    const BasisSetShell & sh4 = bs4_->shell(shell4);
+
+    // Primitive pair data. This includes exp(-mu |AB|^2)
+    // in the coefficients
+    const ShellPairData & bra = shellpairs12_->pair(shell1, shell2);
+    const ShellPairData & ket = shellpairs34_->pair(shell3, shell4);
+
+    const size_t ngen2 = sh2.n_general_contractions();
+    const size_t ngen4 = sh4.n_general_contractions();
+
+    // maximum AM on each center (for combined AM, the
+    // absolute value is the maximum)
+    const int am1 = std::abs(sh1.am());
+    const int am2 = std::abs(sh2.am());
+    const int am3 = std::abs(sh3.am());
+    const int am4 = std::abs(sh4.am());
+    const int L = am1 + am2 + am3 + am4;
+    const size_t stride = static_cast<size_t>(L + 1);
+
+    // partition the workspace
+    double * const F = work;
+    double * const oogp = F + table_size_;
+    double * const oogq = oogp + table_size_;
+    double * const gpqpow = oogq + table_size_;
+    double * const oogpq = gpqpow + table_size_;
+    double * const oofour = oogpq + table_size_;
+    double * const expansionwork = oofour + table_size_;
+    double * const B[3] = { expansionwork + table_size_ + 1,
+                            expansionwork + table_size_ + 1 + expansion_size_,
+                            expansionwork + table_size_ + 1 + 2*expansion_size_ };
+
+    const ValeevRefTables tables{ factorial_.data(), oogp, oogq, gpqpow, oogpq, oofour };
+
+    oofour[0] = 1.0;
+    for(int n = 1; n <= L; n++)
+        oofour[n] = 0.25 * oofour[n-1];
+
+    // number of cartesian integrals
+    size_t ncart = 1;
+    for(const BasisSetShell * sh : { &sh1, &sh2, &sh3, &sh4 })
+    {
+        size_t n = 0;
+        for(size_t g = 0; g < sh->n_general_contractions(); g++)
+            n += n_cartesian_gaussian(sh->general_am(g));
+        ncart *= n;
+    }
+
+    std::fill(sourcework, sourcework + ncart, 0.0);
+
+    // 2 * pi^(5/2)
+    const double twopi52 = 2.0*PI*PI*std::sqrt(PI);
+
+    for(size_t i = 0; i < bra.nprim; i++)
+    for(size_t j = 0; j < ket.nprim; j++)
+    {
+        const double gammap = bra.p[i];
+        const double gammaq = ket.p[j];
+        const double gammapq = gammap * gammaq / (gammap + gammaq);
+
+        const double PQ[3] = { bra.P[0][i] - ket.P[0][j],
+                               bra.P[1][i] - ket.P[1][j],
+                               bra.P[2][i] - ket.P[2][j] };
+        const double PQ2 = PQ[0]*PQ[0] + PQ[1]*PQ[1] + PQ[2]*PQ[2];
+
+        oogp[0] = oogq[0] = gpqpow[0] = oogpq[0] = 1.0;
+        for(int n = 1; n <= L; n++)
+        {
+            oogp[n] = oogp[n-1] * bra.oop[i];
+            oogq[n] = oogq[n-1] * ket.oop[j];
+            gpqpow[n] = gpqpow[n-1] * gammapq;
+            oogpq[n] = oogpq[n-1] / gammapq;
+        }
+
+        // The Boys function is the same for all cartesian components
+        Valeev_F(F, L, PQ2 * gammapq);
+
+        const double pfac = twopi52 / (gammap * gammaq * std::sqrt(gammap + gammaq));
+
+        // terms for each direction and each combination of exponents
+        for(int d = 0; d < 3; d++)
+        {
+            double * Bptr = B[d];
+            for(int e1 = 0; e1 <= am1; e1++)
+            for(int e2 = 0; e2 <= am2; e2++)
+            for(int e3 = 0; e3 <= am3; e3++)
+            for(int e4 = 0; e4 <= am4; e4++)
+            {
+                ValeevRef_expansion(e1, e2, e3, e4,
+                                    bra.PA[d][i], bra.PB[d][i], ket.PA[d][j], ket.PB[d][j], PQ[d],
+                                    tables, expansionwork, Bptr);
+                Bptr += stride;
+            }
+        }
+
+        size_t idx = 0;
+        for(size_t g1 = 0; g1 < sh1.n_general_contractions(); g1++)
+        for(size_t g2 = 0; g2 < ngen2; g2++)
+        for(size_t g3 = 0; g3 < sh3.n_general_contractions(); g3++)
+        for(size_t g4 = 0; g4 < ngen4; g4++)
+        {
+            const double coef = pfac * bra.coef[(g1*ngen2 + g2)*bra.nprim + i]
+                                     * ket.coef[(g3*ngen4 + g4)*ket.nprim + j];
+
+            for(const auto & c1 : cartesian_ordering(sh1.general_am(g1)))
+            for(const auto & c2 : cartesian_ordering(sh2.general_am(g2)))
+            for(const auto & c3 : cartesian_ordering(sh3.general_am(g3)))
+            for(const auto & c4 : cartesian_ordering(sh4.general_am(g4)))
+            {
+                const double * Bd[3];
+                int nd[3];
+                for(int d = 0; d < 3; d++)
+                {
+                    const size_t e = ((c1[d]*(am2+1) + c2[d])*(am3+1) + c3[d])*(am4+1) + c4[d];
+                    Bd[d] = B[d] + e*stride;
+                    nd[d] = c1[d] + c2[d] + c3[d] + c4[d];
+                }
+
+                double val = 0.0;
+                for(int x = 0; x <= nd[0]; x++)
+                for(int y = 0; y <= nd[1]; y++)
+                {
+                    const double Bxy = Bd[0][x] * Bd[1][y];
+                    for(int z = 0; z <= nd[2]; z++)
+                        val += Bxy * Bd[2][z] * F[x+y+z];
+                }
+
+                sourcework[idx++] += coef * val;
+            }
+        }
+    }
 }
 
 
@@ -108,20 +279,52 @@ void ReferenceERI::initialize_(unsigned int deriv,
     bs3_ = NormalizeBasis(cache(), out, bs3);
     bs4_ = NormalizeBasis(cache(), out, bs4);
 
+    spherical_ = SphericalTransform(std::max(std::max(bs1_->max_am(), bs2_->max_am()),
+                                             std::max(bs3_->max_am(), bs4_->max_am())));
+
     size_t maxsize1 = bs1_->max_property(n_cartesian_gaussian_for_shell_am);
     size_t maxsize2 = bs2_->max_property(n_cartesian_gaussian_for_shell_am);
     size_t maxsize3 = bs3_->max_property(n_cartesian_gaussian_for_shell_am);
     size_t maxsize4 = bs4_->max_property(n_cartesian_gaussian_for_shell_am);
-    size_t transformwork_size = maxsize1*maxsize2*maxsize3*maxsize4;
-    
+    size_t transformwork_size = SphericalTransform::worksize(4, maxsize1*maxsize2*maxsize3*maxsize4);
+
     maxsize1 =  bs1_->max_property(n_cartesian_gaussian_in_shell);
     maxsize2 =  bs2_->max_property(n_cartesian_gaussian_in_shell);
     maxsize3 =  bs3_->max_property(n_cartesian_gaussian_in_shell);
     maxsize4 =  bs4_->max_property(n_cartesian_gaussian_in_shell);
     size_t sourcework_size = maxsize1*maxsize2*maxsize3*maxsize4;
 
-    work_.resize(sourcework_size+transformwork_size);
-    sourcework_ = work_.data();
-    transformwork_ = sourcework_ + sourcework_size;   
+    sourcework_size_ = sourcework_size;
+    transformwork_size_ = transformwork_size;
+    worksize_ = sourcework_size + transformwork_size;
+
+    fast_ = options().get<bool>("FAST");
+    if(fast_)
+    {
+        // All primitive pairs are kept (no screening)
+        shellpairs12_ = ShellPairs(cache(), out, *bs1_, *bs2_, 0.0);
+        shellpairs34_ = ShellPairs(cache(), out, *bs3_, *bs4_, 0.0);
+
+        maxam_[0] = bs1_->max_am();
+        maxam_[1] = bs2_->max_am();
+        maxam_[2] = bs3_->max_am();
+        maxam_[3] = bs4_->max_am();
+        maxl_ = maxam_[0] + maxam_[1] + maxam_[2] + maxam_[3];
+
+        factorial_.resize(maxl_+1);
+        for(int n = 0; n <= maxl_; n++)
+            factorial_[n] = pulsar::math::factorial_d(n);
+
+        // Boys function and the other tables, the workspace for the expansion,
+        // and the expansion for each direction and combination of exponents
+        table_size_ = static_cast<size_t>(maxl_ + 1);
+        expansion_size_ = table_size_;
+        for(int i = 0; i < 4; i++)
+            expansion_size_ *= static_cast<size_t>(maxam_[i] + 1);
+
+        worksize_ += 6*table_size_ + (table_size_ + 1) + 3*expansion_size_;
+    }
+
+    work_.resize(worksize_);
 }
 
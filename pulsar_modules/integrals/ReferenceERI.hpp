@@ -3,7 +3,21 @@
 
 #include <pulsar/modulebase/TwoElectronIntegral.hpp>
 
-class ReferenceERI : public pulsar::modulebase::TwoElectronIntegral
+#include "Common/BasisSetCommon.hpp"
+#include "Integrals/IntegralWorkspace.hpp"
+#include "Integrals/SphericalTransform.hpp"
+
+/*! \brief Reference calculation of ERI
+ *
+ * By default, every integral is calculated from the closed-form
+ * expression for each primitive quartet (ValeevRef_eri). With the FAST
+ * option, the same expression is evaluated for all cartesian components
+ * of a primitive quartet at once, using precomputed shell pair data
+ * and tables for the factorials and powers. This is fast enough for
+ * validating other modules over whole basis sets.
+ */
+class ReferenceERI : public pulsar::modulebase::TwoElectronIntegral,
+                     public psr_modules::integrals::detail::ReentrantTwoElectron
 {
 public:
     using pulsar::modulebase::TwoElectronIntegral::TwoElectronIntegral;
@@ -20,14 +34,48 @@ public:
                                 size_t shell3, size_t shell4,
                                 double * outbuffer, size_t bufsize);
 
+    using pulsar::modulebase::TwoElectronIntegral::calculate;
+
+    virtual size_t workspace_size(void) const { return worksize_; }
+
+    virtual uint64_t calculate(size_t shell1, size_t shell2,
+                               size_t shell3, size_t shell4,
+                               double * outbuffer, size_t bufsize,
+                               psr_modules::integrals::IntegralWorkspace & ws) const;
+
 
 private:
     std::shared_ptr<const pulsar::system::BasisSet> bs1_, bs2_, bs3_, bs4_;
+    psr_modules::integrals::detail::SphericalTransform spherical_;
+
+    psr_modules::integrals::IntegralWorkspace work_;
+
+    // Partitioning of a workspace
+    size_t worksize_ = 0;
+    size_t sourcework_size_;
+    size_t transformwork_size_;
+
+    /////////////////////////////
+    // Used in FAST mode
+    /////////////////////////////
+    bool fast_ = false;
+    std::shared_ptr<const ShellPairSet> shellpairs12_, shellpairs34_;
+
+    int maxam_[4];             //!< Maximum AM on each center
+    int maxl_;                 //!< Maximum total AM of a quartet
+    size_t table_size_;        //!< Size of each table (maxl_+1)
+    size_t expansion_size_;    //!< Size of the expansion for each direction
+    std::vector<double> factorial_;
 
-    std::vector<double> work_;
-    double * sourcework_;
-    double * transformwork_;
+    //! Calculate the cartesian integrals in FAST mode
+    void calculate_fast_(size_t shell1, size_t shell2,
+                         size_t shell3, size_t shell4,
+                         double * sourcework, double * work) const;
 
+    //! Calculate the cartesian integrals one at a time
+    void calculate_reference_(size_t shell1, size_t shell2,
+                              size_t shell3, size_t shell4,
+                              double * sourcework) const;
 };
 
 
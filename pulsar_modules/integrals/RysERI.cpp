@@ -0,0 +1,405 @@
+#include <cmath>
+#include <algorithm>
+
+#include <pulsar/system/AOOrdering.hpp>
+#include <pulsar/constants.h>
+
+#include "Common/BasisSetCommon.hpp"
+#include "Integrals/RysERI.hpp"
+#include "Integrals/rys/Rys.hpp"
+
+
+using namespace pulsar::exception;
+using namespace pulsar::system;
+using namespace pulsar::datastore;
+
+
+namespace {
+
+// Builds the integrals I(a,b,c,d) in a single direction for a single root.
+//
+// First, the 2D integrals I(a,0,c,0) are formed for a in [0, lab] and c in [0, lcd]
+// via the Rys recurrence relations. Then angular momentum is transferred
+// from a to b, and then from c to d, via the horizontal recurrence.
+//
+// n1-n4 are the maximum AM of each shell, plus one. The result is
+// stored in out[(((a*n2+b)*n3+c)*n4+d)*stride].
+//
+// twod and bra are workspaces, of size (lab+1)*(lcd+1) and n1*n2*(lcd+1), respectively.
+void rys_1d(int n1, int n2, int n3, int n4,
+            double C00, double D00, double B00, double B10, double B01,
+            double AB, double CD, double scale,
+            double * RESTRICT twod, double * RESTRICT bra,
+            double * RESTRICT out, size_t stride)
+{
+    const int lab = n1 + n2 - 2;
+    const int lcd = n3 + n4 - 2;
+    const int nc = lcd + 1;
+
+    // I(a,0)
+    twod[0] = scale;
+    if(lab > 0)
+        twod[nc] = C00*scale;
+    for(int a = 1; a < lab; a++)
+        twod[(a+1)*nc] = C00*twod[a*nc] + a*B10*twod[(a-1)*nc];
+
+    // I(a,c+1)
+    for(int c = 0; c < lcd; c++)
+    for(int a = 0; a <= lab; a++)
+    {
+        double val = D00*twod[a*nc+c];
+        if(c > 0)
+            val += c*B01*twod[a*nc+c-1];
+        if(a > 0)
+            val += a*B00*twod[(a-1)*nc+c];
+        twod[a*nc+c+1] = val;
+    }
+
+    // bra HRR. This is done in-place in the 2D integrals,
+    // with I(a,b+1) = I(a+1,b) + AB I(a,b)
+    for(int b = 0; b < n2; b++)
+    {
+        if(b > 0)
+        {
+            for(int a = 0; a <= lab-b; a++)
+            for(int c = 0; c <= lcd; c++)
+                twod[a*nc+c] = twod[(a+1)*nc+c] + AB*twod[a*nc+c];
+        }
+
+        for(int a = 0; a < n1; a++)
+        for(int c = 0; c <= lcd; c++)
+            bra[(a*n2+b)*nc+c] = twod[a*nc+c];
+    }
+
+    // ket HRR, for each (a,b)
+    double ket[2*PSR_MODULES_RYS_MAXROOTS];
+
+    for(int a = 0; a < n1; a++)
+    for(int b = 0; b < n2; b++)
+    {
+        const double * braptr = bra + (a*n2+b)*nc;
+        std::copy(braptr, braptr + nc, ket);
+
+        for(int d = 0; d < n4; d++)
+        {
+            if(d > 0)
+            {
+                for(int c = 0; c <= lcd-d; c++)
+                    ket[c] = ket[c+1] + CD*ket[c];
+            }
+
+            for(int c = 0; c < n3; c++)
+                out[static_cast<size_t>(((a*n2+b)*n3+c)*n4+d)*stride] = ket[c];
+        }
+    }
+}
+
+} // close anonymous namespace
+
+
+namespace psr_modules {
+namespace integrals {
+
+
+uint64_t RysERI::calculate(size_t shell1, size_t shell2,
+                           size_t shell3, size_t shell4,
+                           double * outbuffer, size_t bufsize,
+                           IntegralWorkspace & ws) const
+{
+    detail::check_workspace(ws, worksize_, index_size_);
+
+    // partition the workspace
+    double * const rootwork = ws.data();
+    double * const weightwork = rootwork + maxroots_;
+    double * const twodwork = ws.data() + twodwork_offset_;
+    double * const brawork = ws.data() + brawork_offset_;
+    double * xyzwork[3];
+    for(int d = 0; d < 3; d++)
+        xyzwork[d] = ws.data() + xyzwork_offset_ + d*xyzwork_size_;
+    double * const transformwork = ws.data() + transformwork_offset_;
+    double * const sourcework = ws.data() + sourcework_offset_;
+    size_t * const cartidx = ws.index_data();
+
+    const BasisSetShell & sh1 = bs1_->shell(shell1);
+    const BasisSetShell & sh2 = bs2_->shell(shell2);
+    const BasisSetShell & sh3 = bs3_->shell(shell3);
+    const BasisSetShell & sh4 = bs4_->shell(shell4);
+
+    const size_t nfunc = sh1.n_functions() * sh2.n_functions() * sh3.n_functions() * sh4.n_functions();
+
+    if(bufsize < nfunc)
+        throw PulsarException("Buffer too small for ERI", "bufsize", bufsize, "nfunc", nfunc);
+
+    // degree of general contraction
+    const size_t ngen1 = sh1.n_general_contractions();
+    const size_t ngen2 = sh2.n_general_contractions();
+    const size_t ngen3 = sh3.n_general_contractions();
+    const size_t ngen4 = sh4.n_general_contractions();
+
+    // The total AM of the shells. May be negative,
+    // so the absolute value is the maximum AM
+    const int n1 = std::abs(sh1.am()) + 1;
+    const int n2 = std::abs(sh2.am()) + 1;
+    const int n3 = std::abs(sh3.am()) + 1;
+    const int n4 = std::abs(sh4.am()) + 1;
+    const int L = n1 + n2 + n3 + n4 - 4;
+    const int nroots = L/2 + 1;
+    const size_t unroots = static_cast<size_t>(nroots);
+
+    // Primitive data is read from the packed basis sets
+    const size_t p1 = packed1_->packed_index[shell1];
+    const size_t p2 = packed2_->packed_index[shell2];
+    const size_t p3 = packed3_->packed_index[shell3];
+    const size_t p4 = packed4_->packed_index[shell4];
+
+    // number of primitives
+    const size_t nprim1 = packed1_->nprim[p1];
+    const size_t nprim2 = packed2_->nprim[p2];
+    const size_t nprim3 = packed3_->nprim[p3];
+    const size_t nprim4 = packed4_->nprim[p4];
+
+    // exponents and coefficients ([g][primitive])
+    const double * const RESTRICT alpha1 = packed1_->alpha_ptr(p1);
+    const double * const RESTRICT alpha2 = packed2_->alpha_ptr(p2);
+    const double * const RESTRICT alpha3 = packed3_->alpha_ptr(p3);
+    const double * const RESTRICT alpha4 = packed4_->alpha_ptr(p4);
+    const double * const RESTRICT coef1 = packed1_->coef_ptr(p1);
+    const double * const RESTRICT coef2 = packed2_->coef_ptr(p2);
+    const double * const RESTRICT coef3 = packed3_->coef_ptr(p3);
+    const double * const RESTRICT coef4 = packed4_->coef_ptr(p4);
+
+    // coordinates
+    const double xyz1[3] = { packed1_->xyz[0][p1], packed1_->xyz[1][p1], packed1_->xyz[2][p1] };
+    const double xyz2[3] = { packed2_->xyz[0][p2], packed2_->xyz[1][p2], packed2_->xyz[2][p2] };
+    const double xyz3[3] = { packed3_->xyz[0][p3], packed3_->xyz[1][p3], packed3_->xyz[2][p3] };
+    const double xyz4[3] = { packed4_->xyz[0][p4], packed4_->xyz[1][p4], packed4_->xyz[2][p4] };
+
+    const double AB[3] = { xyz1[0] - xyz2[0], xyz1[1] - xyz2[1], xyz1[2] - xyz2[2] };
+    const double CD[3] = { xyz3[0] - xyz4[0], xyz3[1] - xyz4[1], xyz3[2] - xyz4[2] };
+    const double AB2 = AB[0]*AB[0] + AB[1]*AB[1] + AB[2]*AB[2];
+    const double CD2 = CD[0]*CD[0] + CD[1]*CD[1] + CD[2]*CD[2];
+
+
+    // Where each cartesian quartet can be found in the
+    // x, y, and z integrals
+    size_t ncartquartet = 0;
+    for(size_t g1 = 0; g1 < ngen1; g1++)
+    for(size_t g2 = 0; g2 < ngen2; g2++)
+    for(size_t g3 = 0; g3 < ngen3; g3++)
+    for(size_t g4 = 0; g4 < ngen4; g4++)
+    {
+        for(const auto & c1 : cartesian_ordering(sh1.general_am(g1)))
+        for(const auto & c2 : cartesian_ordering(sh2.general_am(g2)))
+        for(const auto & c3 : cartesian_ordering(sh3.general_am(g3)))
+        for(const auto & c4 : cartesian_ordering(sh4.general_am(g4)))
+        {
+            for(int d = 0; d < 3; d++)
+                cartidx[3*ncartquartet+d] = static_cast<size_t>(((c1[d]*n2 + c2[d])*n3 + c3[d])*n4 + c4[d]) * unroots;
+            ncartquartet++;
+        }
+    }
+
+    // Cartesian integrals are accumulated directly in the output
+    // buffer if no transformation is needed
+    const bool anyspherical = detail::is_spherical(sh1) || detail::is_spherical(sh2) ||
+                              detail::is_spherical(sh3) || detail::is_spherical(sh4);
+    double * const cartwork = anyspherical ? sourcework : outbuffer;
+
+    std::fill(cartwork, cartwork + ncartquartet, 0.0);
+
+    // 2 * pi^(5/2)
+    const double twopi52 = 2.0*PI*PI*std::sqrt(PI);
+
+    for(size_t i = 0; i < nprim1; i++)
+    for(size_t j = 0; j < nprim2; j++)
+    {
+        const double a1 = alpha1[i];
+        const double a2 = alpha2[j];
+        const double p = a1 + a2;
+        const double oop = 1.0/p;
+        const double Kab = std::exp(-a1*a2*oop*AB2);
+
+        const double P[3] = { (a1*xyz1[0] + a2*xyz2[0])*oop,
+                              (a1*xyz1[1] + a2*xyz2[1])*oop,
+                              (a1*xyz1[2] + a2*xyz2[2])*oop };
+        const double PA[3] = { P[0] - xyz1[0], P[1] - xyz1[1], P[2] - xyz1[2] };
+
+        for(size_t k = 0; k < nprim3; k++)
+        for(size_t l = 0; l < nprim4; l++)
+        {
+            const double a3 = alpha3[k];
+            const double a4 = alpha4[l];
+            const double q = a3 + a4;
+            const double ooq = 1.0/q;
+            const double Kcd = std::exp(-a3*a4*ooq*CD2);
+
+            const double Q[3] = { (a3*xyz3[0] + a4*xyz4[0])*ooq,
+                                  (a3*xyz3[1] + a4*xyz4[1])*ooq,
+                                  (a3*xyz3[2] + a4*xyz4[2])*ooq };
+            const double QC[3] = { Q[0] - xyz3[0], Q[1] - xyz3[1], Q[2] - xyz3[2] };
+
+            const double oopq = 1.0/(p+q);
+            const double rho = p*q*oopq;
+
+            const double W[3] = { (p*P[0] + q*Q[0])*oopq,
+                                  (p*P[1] + q*Q[1])*oopq,
+                                  (p*P[2] + q*Q[2])*oopq };
+            const double WP[3] = { W[0] - P[0], W[1] - P[1], W[2] - P[2] };
+            const double WQ[3] = { W[0] - Q[0], W[1] - Q[1], W[2] - Q[2] };
+            const double PQ[3] = { P[0] - Q[0], P[1] - Q[1], P[2] - Q[2] };
+            const double PQ2 = PQ[0]*PQ[0] + PQ[1]*PQ[1] + PQ[2]*PQ[2];
+
+            detail::rys_roots(nroots, rho*PQ2, rootwork, weightwork);
+            const double prefac = twopi52 * oop * ooq * std::sqrt(oopq) * Kab * Kcd;
+
+            for(int r = 0; r < nroots; r++)
+            {
+                const double u = rootwork[r];
+                const double B00 = 0.5*oopq*u;
+                const double B10 = 0.5*oop*(1.0 - rho*oop*u);
+                const double B01 = 0.5*ooq*(1.0 - rho*ooq*u);
+
+                // The prefactor and weight are put into the z integrals
+                for(int d = 0; d < 3; d++)
+                {
+                    const double scale = (d == 2) ? prefac*weightwork[r] : 1.0;
+                    rys_1d(n1, n2, n3, n4,
+                           PA[d] + WP[d]*u, QC[d] + WQ[d]*u, B00, B10, B01,
+                           AB[d], CD[d], scale,
+                           twodwork, brawork, xyzwork[d] + r, unroots);
+                }
+            }
+
+            // sum over the roots and contract
+            const double * const RESTRICT Ix = xyzwork[0];
+            const double * const RESTRICT Iy = xyzwork[1];
+            const double * const RESTRICT Iz = xyzwork[2];
+            const size_t * idx = cartidx;
+            double * outptr = cartwork;
+
+            for(size_t g1 = 0; g1 < ngen1; g1++)
+            for(size_t g2 = 0; g2 < ngen2; g2++)
+            for(size_t g3 = 0; g3 < ngen3; g3++)
+            for(size_t g4 = 0; g4 < ngen4; g4++)
+            {
+                const double coef = coef1[g1*nprim1+i] * coef2[g2*nprim2+j]
+                                  * coef3[g3*nprim3+k] * coef4[g4*nprim4+l];
+
+                const size_t ncart = n_cartesian_gaussian(sh1.general_am(g1))
+                                   * n_cartesian_gaussian(sh2.general_am(g2))
+                                   * n_cartesian_gaussian(sh3.general_am(g3))
+                                   * n_cartesian_gaussian(sh4.general_am(g4));
+
+                for(size_t n = 0; n < ncart; n++)
+                {
+                    const double * const RESTRICT x = Ix + idx[0];
+                    const double * const RESTRICT y = Iy + idx[1];
+                    const double * const RESTRICT z = Iz + idx[2];
+
+                    double sum = 0.0;
+                    for(int r = 0; r < nroots; r++)
+                        sum += x[r]*y[r]*z[r];
+
+                    *outptr += coef*sum;
+                    outptr++;
+                    idx += 3;
+                }
+            }
+        } // end loop over primitives k, l
+    } // end loop over primitives i, j
+
+
+    // performs the spherical transform of each block, if necessary
+    if(anyspherical)
+        spherical_.transform_4center(sh1, sh2, sh3, sh4, sourcework, outbuffer, transformwork);
+
+    return nfunc;
+}
+
+
+
+uint64_t RysERI::calculate_(size_t shell1, size_t shell2,
+                            size_t shell3, size_t shell4,
+                            double * outbuffer, size_t bufsize)
+{
+    return calculate(shell1, shell2, shell3, shell4, outbuffer, bufsize, work_);
+}
+
+
+
+void RysERI::initialize_(unsigned int deriv,
+                         const Wavefunction & wfn,
+                         const BasisSet & bs1,
+                         const BasisSet & bs2,
+                         const BasisSet & bs3,
+                         const BasisSet & bs4)
+{
+    if(deriv != 0)
+        throw NotYetImplementedException("Not Yet Implemented: RysERI integral with deriv != 0");
+
+    // from common components
+    bs1_ = NormalizeBasis(cache(), out, bs1);
+    bs2_ = NormalizeBasis(cache(), out, bs2);
+    bs3_ = NormalizeBasis(cache(), out, bs3);
+    bs4_ = NormalizeBasis(cache(), out, bs4);
+
+    packed1_ = PackBasis(cache(), out, *bs1_);
+    packed2_ = PackBasis(cache(), out, *bs2_);
+    packed3_ = PackBasis(cache(), out, *bs3_);
+    packed4_ = PackBasis(cache(), out, *bs4_);
+
+    const size_t n1 = static_cast<size_t>(bs1_->max_am() + 1);
+    const size_t n2 = static_cast<size_t>(bs2_->max_am() + 1);
+    const size_t n3 = static_cast<size_t>(bs3_->max_am() + 1);
+    const size_t n4 = static_cast<size_t>(bs4_->max_am() + 1);
+    const size_t maxlab = n1 + n2 - 2;
+    const size_t maxlcd = n3 + n4 - 2;
+    const size_t maxroots = (maxlab + maxlcd)/2 + 1;
+
+    spherical_ = detail::SphericalTransform(std::max(std::max(bs1_->max_am(), bs2_->max_am()),
+                                                     std::max(bs3_->max_am(), bs4_->max_am())));
+
+    if(maxroots > PSR_MODULES_RYS_MAXROOTS)
+        throw NotYetImplementedException("RysERI does not support AM this high", "nroots", maxroots,
+                                         "maxroots", PSR_MODULES_RYS_MAXROOTS);
+
+    ///////////////////////////////////////
+    // Determine the size of the workspace
+    ///////////////////////////////////////
+    const size_t twodwork_size = (maxlab+1)*(maxlcd+1);
+    const size_t brawork_size = n1*n2*(maxlcd+1);
+    const size_t xyzwork_size = n1*n2*n3*n4*maxroots;
+
+    // find the maximum number of cartesian functions, not including general contraction
+    size_t maxsize1 = bs1_->max_property(n_cartesian_gaussian_for_shell_am);
+    size_t maxsize2 = bs2_->max_property(n_cartesian_gaussian_for_shell_am);
+    size_t maxsize3 = bs3_->max_property(n_cartesian_gaussian_for_shell_am);
+    size_t maxsize4 = bs4_->max_property(n_cartesian_gaussian_for_shell_am);
+    const size_t transformwork_size = detail::SphericalTransform::worksize(4, maxsize1*maxsize2*maxsize3*maxsize4);
+
+    // find the maximum number of cartesian functions, including general contraction
+    maxsize1 = bs1_->max_property(n_cartesian_gaussian_in_shell);
+    maxsize2 = bs2_->max_property(n_cartesian_gaussian_in_shell);
+    maxsize3 = bs3_->max_property(n_cartesian_gaussian_in_shell);
+    maxsize4 = bs4_->max_property(n_cartesian_gaussian_in_shell);
+    const size_t sourcework_size = maxsize1*maxsize2*maxsize3*maxsize4;
+
+    // index into the x, y, and z integrals for each cartesian quartet
+    index_size_ = 3*sourcework_size;
+
+    // allocate all at once. The workspace is partitioned in calculate
+    maxroots_ = maxroots;
+    twodwork_offset_ = 2*maxroots;
+    brawork_offset_ = twodwork_offset_ + twodwork_size;
+    xyzwork_offset_ = brawork_offset_ + brawork_size;
+    xyzwork_size_ = xyzwork_size;
+    transformwork_offset_ = xyzwork_offset_ + 3*xyzwork_size;
+    sourcework_offset_ = transformwork_offset_ + transformwork_size;
+    worksize_ = sourcework_offset_ + sourcework_size;
+
+    work_.resize(worksize_, index_size_);
+}
+
+
+} // close namespace integrals
+} // close namespace psr_modules
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <pulsar/modulebase/TwoElectronIntegral.hpp>
+
+#include "Common/BasisSetCommon.hpp"
+#include "Integrals/IntegralWorkspace.hpp"
+#include "Integrals/SphericalTransform.hpp"
+
+namespace psr_modules {
+namespace integrals {
+
+
+/*! \brief Calculation of electron repulsion integrals via Rys quadrature
+ *
+ * For each primitive quartet, the 2D integrals I(a,c) are built for each
+ * cartesian direction at each Rys root, and angular momentum is transferred
+ * to the second and fourth centers via the horizontal recurrence. The
+ * cartesian integrals are then formed as a sum over the roots of
+ * the product of the x, y, and z integrals.
+ *
+ * This scales better than the recurrence-based methods for high
+ * angular momentum.
+ */
+class RysERI : public pulsar::modulebase::TwoElectronIntegral,
+               public detail::ReentrantTwoElectron
+{
+    public:
+        using pulsar::modulebase::TwoElectronIntegral::TwoElectronIntegral;
+
+        virtual void initialize_(unsigned int deriv,
+                                 const pulsar::datastore::Wavefunction & wfn,
+                                 const pulsar::system::BasisSet & bs1,
+                                 const pulsar::system::BasisSet & bs2,
+                                 const pulsar::system::BasisSet & bs3,
+                                 const pulsar::system::BasisSet & bs4);
+
+        virtual uint64_t calculate_(size_t shell1, size_t shell2,
+                                    size_t shell3, size_t shell4,
+                                    double * outbuffer, size_t bufsize);
+
+        using pulsar::modulebase::TwoElectronIntegral::calculate;
+
+        virtual size_t workspace_size(void) const { return worksize_; }
+
+        virtual size_t workspace_index_size(void) const { return index_size_; }
+
+        virtual uint64_t calculate(size_t shell1, size_t shell2,
+                                   size_t shell3, size_t shell4,
+                                   double * outbuffer, size_t bufsize,
+                                   IntegralWorkspace & ws) const;
+
+    private:
+        std::shared_ptr<const pulsar::system::BasisSet> bs1_, bs2_, bs3_, bs4_;
+        std::shared_ptr<const PackedBasis> packed1_, packed2_, packed3_, packed4_;
+        detail::SphericalTransform spherical_;
+
+        IntegralWorkspace work_;
+        size_t worksize_ = 0;
+        size_t index_size_ = 0;  //!< Index into the x, y, and z integrals for each cartesian quartet
+
+        // Offsets of each part of the workspace. The Rys roots
+        // and weights (maxroots_ each) are at the beginning
+        size_t maxroots_;
+        size_t twodwork_offset_;       //!< 2D integrals I(a,c) for a single root and direction
+        size_t brawork_offset_;        //!< Integrals I(a,b,c) after the bra HRR
+        size_t xyzwork_offset_;        //!< Final integrals I(a,b,c,d) for all roots in each direction
+        size_t xyzwork_size_;
+        size_t transformwork_offset_;
+        size_t sourcework_offset_;
+};
+
+
+} // close namespace integrals
+} // close namespace psr_modules
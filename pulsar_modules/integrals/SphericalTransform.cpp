@@ -0,0 +1,192 @@
+#include <algorithm>
+
+#include <pulsar/system/SphericalTransform.hpp>
+
+#include "Integrals/SphericalTransform.hpp"
+
+
+using namespace pulsar::exception;
+using namespace pulsar::system;
+
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+bool is_spherical(const BasisSetShell & sh)
+{
+    return sh.get_type() == ShellType::SphericalGaussian;
+}
+
+
+
+SphericalTransform::SphericalTransform(int maxam)
+    : am_(static_cast<size_t>(maxam+1))
+{
+    for(int l = 0; l <= maxam; l++)
+    {
+        SphericalTransformAM & tr = am_[l];
+        const size_t nsph = n_spherical_gaussian(l);
+
+        // group the coefficients by spherical function
+        std::vector<std::vector<std::pair<size_t, double>>> bysph(nsph);
+        for(const auto & c : spherical_transform_coefficients(l))
+            bysph.at(static_cast<size_t>(c.sphidx)).emplace_back(static_cast<size_t>(c.cartidx), c.coef);
+
+        tr.start.push_back(0);
+        for(auto & s : bysph)
+        {
+            // in order of the cartesian functions, for better locality
+            std::sort(s.begin(), s.end());
+
+            for(const auto & it : s)
+            {
+                tr.cartidx.push_back(it.first);
+                tr.coef.push_back(it.second);
+            }
+            tr.start.push_back(tr.cartidx.size());
+        }
+    }
+}
+
+
+
+void SphericalTransform::transform_index_(const SphericalTransformAM & tr, size_t nouter,
+                                          size_t ncart, size_t ninner,
+                                          const double * src, double * dest) const
+{
+    const size_t nsph = tr.start.size() - 1;
+
+    for(size_t o = 0; o < nouter; o++)
+    {
+        const double * srcblock = src + o*ncart*ninner;
+        double * destblock = dest + o*nsph*ninner;
+
+        for(size_t s = 0; s < nsph; s++)
+        {
+            double * const RESTRICT destrow = destblock + s*ninner;
+            std::fill(destrow, destrow + ninner, 0.0);
+
+            for(size_t t = tr.start[s]; t < tr.start[s+1]; t++)
+            {
+                const double coef = tr.coef[t];
+                const double * const RESTRICT srcrow = srcblock + tr.cartidx[t]*ninner;
+
+                for(size_t i = 0; i < ninner; i++)
+                    destrow[i] += coef * srcrow[i];
+            }
+        }
+    }
+}
+
+
+
+size_t SphericalTransform::transform_block(int nidx, const int * am, const bool * spherical,
+                                           const double * src, double * out, double * work) const
+{
+    // current dimension of each index
+    size_t dim[4];
+    size_t total = 1;
+    int nactive = 0;
+
+    for(int k = 0; k < nidx; k++)
+    {
+        dim[k] = n_cartesian_gaussian(am[k]);
+        total *= dim[k];
+        if(spherical[k])
+            nactive++;
+    }
+
+    if(nactive == 0)
+    {
+        std::copy(src, src + total, out);
+        return total;
+    }
+
+    // Transform each spherical index, starting with the last. Intermediate
+    // results alternate between the two halves of the workspace,
+    // and the final step writes to the output
+    const double * in = src;
+    int step = 0;
+
+    for(int k = nidx-1; k >= 0; k--)
+    {
+        if(!spherical[k])
+            continue;
+
+        step++;
+        double * dest = (step == nactive) ? out : work + ((step-1) % 2)*total;
+
+        size_t nouter = 1, ninner = 1;
+        for(int i = 0; i < k; i++)
+            nouter *= dim[i];
+        for(int i = k+1; i < nidx; i++)
+            ninner *= dim[i];
+
+        transform_index_(am_[am[k]], nouter, dim[k], ninner, in, dest);
+
+        dim[k] = n_spherical_gaussian(am[k]);
+        in = dest;
+    }
+
+    size_t nout = 1;
+    for(int k = 0; k < nidx; k++)
+        nout *= dim[k];
+    return nout;
+}
+
+
+
+void SphericalTransform::transform_2center(const BasisSetShell & sh1,
+                                           const BasisSetShell & sh2,
+                                           const double * src, double * out, double * work,
+                                           unsigned int ncomp) const
+{
+    const bool spherical[2] = { is_spherical(sh1), is_spherical(sh2) };
+
+    const size_t ngen1 = sh1.n_general_contractions();
+    const size_t ngen2 = sh2.n_general_contractions();
+
+    for(unsigned int c = 0; c < ncomp; c++)
+    {
+        for(size_t g1 = 0; g1 < ngen1; g1++)
+        for(size_t g2 = 0; g2 < ngen2; g2++)
+        {
+            const int am[2] = { sh1.general_am(g1), sh2.general_am(g2) };
+
+            out += transform_block(2, am, spherical, src, out, work);
+            src += n_cartesian_gaussian(am[0]) * n_cartesian_gaussian(am[1]);
+        }
+    }
+}
+
+
+
+void SphericalTransform::transform_4center(const BasisSetShell & sh1,
+                                           const BasisSetShell & sh2,
+                                           const BasisSetShell & sh3,
+                                           const BasisSetShell & sh4,
+                                           const double * src, double * out, double * work) const
+{
+    const bool spherical[4] = { is_spherical(sh1), is_spherical(sh2),
+                                is_spherical(sh3), is_spherical(sh4) };
+
+    for(size_t g1 = 0; g1 < sh1.n_general_contractions(); g1++)
+    for(size_t g2 = 0; g2 < sh2.n_general_contractions(); g2++)
+    for(size_t g3 = 0; g3 < sh3.n_general_contractions(); g3++)
+    for(size_t g4 = 0; g4 < sh4.n_general_contractions(); g4++)
+    {
+        const int am[4] = { sh1.general_am(g1), sh2.general_am(g2),
+                            sh3.general_am(g3), sh4.general_am(g4) };
+
+        out += transform_block(4, am, spherical, src, out, work);
+        src += n_cartesian_gaussian(am[0]) * n_cartesian_gaussian(am[1])
+             * n_cartesian_gaussian(am[2]) * n_cartesian_gaussian(am[3]);
+    }
+}
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
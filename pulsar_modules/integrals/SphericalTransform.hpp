@@ -0,0 +1,111 @@
+#pragma once
+
+#include <vector>
+
+#include <pulsar/system/BasisSet.hpp>
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+/*! \brief Sparse cartesian-to-spherical transformation coefficients for a single AM
+ *
+ * Stored by spherical function. The cartesian functions (and coefficients)
+ * contributing to spherical function s are in [start[s], start[s+1]).
+ */
+struct SphericalTransformAM
+{
+    std::vector<size_t> start;
+    std::vector<size_t> cartidx;
+    std::vector<double> coef;
+};
+
+
+/*! \brief Precomputed cartesian-to-spherical transformations
+ *
+ * The coefficients for each AM are collected once (usually when a module
+ * is initialized) and then applied to each block of integrals
+ * (ie, for a single combination of general contractions) as it is
+ * finished, writing directly to the output buffer.
+ *
+ * Transforming a block does not modify this object, so it can
+ * be shared between threads.
+ */
+class SphericalTransform
+{
+    public:
+        SphericalTransform() = default;
+
+        /*! \brief Build the transformations for all AM up to \p maxam */
+        explicit SphericalTransform(int maxam);
+
+        /*! \brief Size of the workspace needed by transform_block
+         *
+         * \param [in] nidx Number of shells (centers) in a block
+         * \param [in] maxblock Maximum number of cartesian integrals in a block
+         */
+        static size_t worksize(int nidx, size_t maxblock)
+        {
+            return (nidx > 2 ? 2 : 1) * maxblock;
+        }
+
+        /*! \brief Transform a block of integrals
+         *
+         * \p src holds the cartesian integrals for a single combination
+         * of general contractions, row-major over the \p nidx shells. The indices
+         * of spherical shells are transformed one at a time (starting with the
+         * last), with the final step writing to \p out. If no shell is spherical,
+         * the block is copied.
+         *
+         * \param [in] nidx Number of shells in the block
+         * \param [in] am AM of each shell (for this general contraction)
+         * \param [in] spherical Whether each shell is spherical
+         * \param [in] src The cartesian integrals
+         * \param [out] out Where to put the transformed integrals
+         * \param [in] work Workspace of at least worksize(nidx, block size) elements
+         *
+         * \return Number of elements written to \p out
+         */
+        size_t transform_block(int nidx, const int * am, const bool * spherical,
+                               const double * src, double * out, double * work) const;
+
+        /*! \brief Transform all blocks of a pair of shells
+         *
+         * \p src holds ncomp planes, each with the cartesian integrals for all
+         * combinations of general contractions (in order), as a block for each.
+         * Output is the same layout, with nfunc integrals in each plane.
+         */
+        void transform_2center(const pulsar::system::BasisSetShell & sh1,
+                               const pulsar::system::BasisSetShell & sh2,
+                               const double * src, double * out, double * work,
+                               unsigned int ncomp) const;
+
+        /*! \brief Transform all blocks of a quartet of shells
+         *
+         * See transform_2center (with a single component)
+         */
+        void transform_4center(const pulsar::system::BasisSetShell & sh1,
+                               const pulsar::system::BasisSetShell & sh2,
+                               const pulsar::system::BasisSetShell & sh3,
+                               const pulsar::system::BasisSetShell & sh4,
+                               const double * src, double * out, double * work) const;
+
+    private:
+        std::vector<SphericalTransformAM> am_;
+
+        // Transform a single index of a block.
+        // dest[o][s][i] = sum_c coef(s,c) * src[o][c][i]
+        void transform_index_(const SphericalTransformAM & tr, size_t nouter,
+                              size_t ncart, size_t ninner,
+                              const double * src, double * dest) const;
+};
+
+
+/*! \brief Is a shell spherical (ie, needs transforming)? */
+bool is_spherical(const pulsar::system::BasisSetShell & sh);
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
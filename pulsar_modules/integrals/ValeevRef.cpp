@@ -32,6 +32,8 @@
 #include <pulsar/math/Binomial.hpp>
 #include <pulsar/constants.h>
 
+#include "Integrals/ValeevRef.hpp"
+
 
 #define EPS 1.0e-17
 #define MAXFAC 100
@@ -57,7 +59,7 @@ static void free_array(double* array)
 }
 
 
-static void Valeev_F(double *F, int n, double x)
+void Valeev_F(double *F, int n, double x)
 {
     int i, m;
     int m2;
@@ -339,3 +341,69 @@ double ValeevRef_eri(int l1, int m1, int n1, double alpha1, const double* A,
 }
 
 
+
+///////////////////////////////////////////
+// Faster evaluation of the same formula,
+// used by ReferenceERI in FAST mode. Signs,
+// factorials, and powers come from tables,
+// and nothing is allocated.
+///////////////////////////////////////////
+
+static double int_pow(double x, int n)
+{
+    double ret = 1.0;
+    for(int i = 0; i < n; i++)
+        ret *= x;
+    return ret;
+}
+
+
+// flp, flq, etc from ValeevRef_eri
+static void binomial_expansion(int l1, int l2, double PA, double PB, double * f)
+{
+    for(int k = 0; k <= l1 + l2; k++)
+        f[k] = 0.0;
+
+    for(int i = 0; i <= l1; i++)
+    for(int j = 0; j <= l2; j++)
+        f[i+j] += binomial_coefficient(l1,i) * binomial_coefficient(l2,j)
+                * int_pow(PA, l1 - i) * int_pow(PB, l2 - j);
+}
+
+
+void ValeevRef_expansion(int l1, int l2, int l3, int l4,
+                         double PA, double PB, double QC, double QD, double PQ,
+                         const ValeevRefTables & t, double * work, double * B)
+{
+    const int lab = l1 + l2;
+    const int lcd = l3 + l4;
+    const double * const fac = t.fac;
+
+    double * const fp = work;
+    double * const fq = fp + lab + 1;
+    binomial_expansion(l1, l2, PA, PB, fp);
+    binomial_expansion(l3, l4, QC, QD, fq);
+
+    for(int n = 0; n <= lab + lcd; n++)
+        B[n] = 0.0;
+
+    for(int lp = 0; lp <= lab; lp++)
+    for(int lq = 0; lq <= lcd; lq++)
+    for(int u1 = 0; u1 <= lp/2; u1++)
+    for(int u2 = 0; u2 <= lq/2; u2++)
+    {
+        const int n = lp + lq - 2*u1 - 2*u2;
+
+        // Gx from ValeevRef_eri
+        const double G = ((lp % 2) ? -1.0 : 1.0) * fp[lp] * fq[lq] * fac[lp] * fac[lq]
+                       * t.oogp[lp - u1] * t.oogq[lq - u2] * fac[n] * t.gpq[n]
+                       / (fac[u1] * fac[u2] * fac[lp - 2*u1] * fac[lq - 2*u2]);
+
+        for(int tx = 0; tx <= n/2; tx++)
+        {
+            B[n - tx] += G * ((tx % 2) ? -1.0 : 1.0) * int_pow(PQ, n - 2*tx)
+                       * t.oofour[u1 + u2 + tx] * t.oogpq[tx]
+                       / (fac[n - 2*tx] * fac[tx]);
+        }
+    }
+}
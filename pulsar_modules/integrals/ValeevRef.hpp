@@ -0,0 +1,59 @@
+#pragma once
+
+/*! \file
+ * \brief Reference calculation of ERI (in ValeevRef.cpp)
+ */
+
+
+/*! \brief ERI of a single primitive quartet of cartesian gaussians
+ *
+ * This is the straightforward implementation of the closed-form
+ * expression, used as the ground truth.
+ */
+double ValeevRef_eri(int l1, int m1, int n1, double alpha1, const double* A,
+                     int l2, int m2, int n2, double alpha2, const double* B,
+                     int l3, int m3, int n3, double alpha3, const double* C,
+                     int l4, int m4, int n4, double alpha4, const double* D);
+
+
+/*! \brief Boys function used by ValeevRef_eri
+ *
+ * Fills \p F with F_m(x) for m = 0 to \p n
+ */
+void Valeev_F(double *F, int n, double x);
+
+
+/*! \brief Tables for a primitive quartet, used by ValeevRef_expansion
+ *
+ * Each table holds at least as many elements as the total AM of
+ * the quartet, plus one.
+ */
+struct ValeevRefTables
+{
+    const double * fac;     //!< n!
+    const double * oogp;    //!< gammap^(-n)
+    const double * oogq;    //!< gammaq^(-n)
+    const double * gpq;     //!< gammapq^n
+    const double * oogpq;   //!< gammapq^(-n)
+    const double * oofour;  //!< 4^(-n)
+};
+
+
+/*! \brief Terms of ValeevRef_eri for a single cartesian direction
+ *
+ * The formula used by ValeevRef_eri is a product of sums over each
+ * direction, coupled only through the index of the Boys function. This
+ * collects the terms for one direction (with exponents \p l1 through \p l4)
+ * by that index, so that the ERI is
+ *
+ *   pfac * sum_{i,j,k} Bx[i] By[j] Bz[k] F[i+j+k]
+ *
+ * (where pfac includes exp(-mu |AB|^2) and exp(-mu |CD|^2)).
+ *
+ * \param [in] PA, PB, QC, QD, PQ The component of the distances for this direction
+ * \param [in] work Workspace of at least l1+l2+l3+l4+2 elements
+ * \param [out] B The terms, l1+l2+l3+l4+1 elements
+ */
+void ValeevRef_expansion(int l1, int l2, int l3, int l4,
+                         double PA, double PB, double QC, double QD, double PQ,
+                         const ValeevRefTables & t, double * work, double * B);
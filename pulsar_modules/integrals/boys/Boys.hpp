@@ -2,11 +2,58 @@
 
 #include "Integrals/boys/Boys_longfac.hpp"
 #include "Integrals/boys/Boys_shortgrid.hpp"
+#include "Integrals/boys/Boys_piecewise.hpp"
 
 #include <cmath>
+#include <string>
+
+// Which engine to use by default. May be set at build time
+// via -DPSR_MODULES_BOYS_DEFAULT_ENGINE=Piecewise
+#ifndef PSR_MODULES_BOYS_DEFAULT_ENGINE
+#define PSR_MODULES_BOYS_DEFAULT_ENGINE ShortGrid
+#endif
 
 namespace psr_modules {
 namespace integrals {
+
+/*! \brief Methods for evaluating the Boys function
+ *
+ * - ShortGrid uses a Taylor series around points of a dense grid containing all orders
+ * - Piecewise uses piecewise polynomial fits of only a few orders and
+ *   obtains the rest via downward recursion. The table is much smaller
+ *   and the results are more accurate, but it can only be used for
+ *   n <= PSR_MODULES_BOYS_PIECEWISE_N. It is not faster than ShortGrid
+ *   when the short grid stays in cache, so ShortGrid is the default
+ */
+enum class BoysEngine
+{
+    ShortGrid,
+    Piecewise,
+    Default = PSR_MODULES_BOYS_DEFAULT_ENGINE
+};
+
+
+/*! \brief Obtain a BoysEngine from its name
+ *
+ * Valid names are "DEFAULT", "SHORTGRID", and "PIECEWISE"
+ *
+ * \param [in] name The name of the engine
+ * \param [out] engine The engine corresponding to \p name
+ * \return False if \p name is not a valid engine
+ */
+inline bool boys_engine_from_string(const std::string & name, BoysEngine & engine)
+{
+    if(name == "DEFAULT")
+        engine = BoysEngine::Default;
+    else if(name == "SHORTGRID")
+        engine = BoysEngine::ShortGrid;
+    else if(name == "PIECEWISE")
+        engine = BoysEngine::Piecewise;
+    else
+        return false;
+    return true;
+}
+
 namespace detail {
 
 /*! \brief Calculate the value of the Boys function for a small value of x
@@ -91,6 +138,79 @@ inline void boys_f_long(double * const RESTRICT F, int n, double x)
 
 
 
+/*! \brief Calculate the value of the Boys function from piecewise fits of
+ *         a few orders
+ *
+ * For x < PSR_MODULES_BOYS_PIECEWISE_MAXX, F(m, x) is evaluated from the fit
+ * of the lowest fitted order m >= n (see lut::boys_piecewise_start) and the
+ * lower orders are obtained via downward recursion
+ *
+ *  \f[
+ *   F(n, x) = \frac{2x F(n+1, x) + e^{-x}}{2n+1}
+ *  \f]
+ *
+ * For larger values of x, F(0, x) is obtained from the asymptotic formula
+ * and the higher orders via upward recursion, which is stable there.
+ *
+ * \warning The output buffer \p F must be large enough to hold \p n + 1 elements,
+ *          since the output includes F(0, x) and F(n, x)
+ *
+ * \warning \p n must not be larger than PSR_MODULES_BOYS_PIECEWISE_N
+ *
+ * \param [out] F Output buffer. Size must be n+1 elements
+ * \param [in] n Maximum order of the Boys function
+ * \param [in] x The value of x for the Boys function
+ */
+inline void boys_f_piecewise(double * const RESTRICT F, int n, double x)
+{
+    const double x2 = 2.0*x;
+
+    if(x < PSR_MODULES_BOYS_PIECEWISE_MAXX)
+    {
+        // the fitted order to start from
+        const int anchor = lut::boys_piecewise_start[n];
+        const int order = lut::boys_piecewise_order[anchor];
+
+        // index of the segment and distance from its center
+        const int seg = (int)(x*PSR_MODULES_BOYS_PIECEWISE_LOOKUPFAC);
+        const double u = x - ((double)seg + 0.5)*PSR_MODULES_BOYS_PIECEWISE_SPACE;
+        double const * const RESTRICT c = &(lut::boys_piecewise[anchor][seg][0]);
+
+        double f = c[PSR_MODULES_BOYS_PIECEWISE_ORDER];
+        for(int k = PSR_MODULES_BOYS_PIECEWISE_ORDER-1; k >= 0; k--)
+            f = f*u + c[k];
+
+        // only the recursion needs the exponential, and there is none
+        // if the requested order was fitted directly and is zero
+        if(order == 0)
+        {
+            F[0] = f;
+            return;
+        }
+
+        const double ex = exp(-x);
+
+        // recurse down to the highest order requested
+        for(int i = order-1; i >= n; i--)
+            f = (x2*f + ex) * lut::boys_piecewise_inv2np1[i];
+
+        F[n] = f;
+        for(int i = n-1; i >= 0; i--)
+            F[i] = (x2*F[i+1] + ex) * lut::boys_piecewise_inv2np1[i];
+    }
+    else
+    {
+        const double ex = exp(-x);
+        const double oox2 = 1.0/x2;
+        F[0] = lut::boys_longfac[0] * sqrt(1.0/x);
+
+        for(int i = 0; i < n; i++)
+            F[i+1] = ((2*i+1)*F[i] - ex) * oox2;
+    }
+}
+
+
+
 /*! \brief Calculate the value of the Boys function for a given value
  *
  * Depending on the magnitude of \p x, the value may be calculated via a 
@@ -112,6 +232,29 @@ inline void calculate_f(double * const RESTRICT F, int n, double x)
 }
 
 
+/*! \brief Calculate the value of the Boys function for a given value
+ *         using a particular engine
+ *
+ * If the piecewise engine is requested but \p n is larger than
+ * what it supports, the short grid is used instead.
+ *
+ * \warning The output buffer \p F must be large enough to hold \p n + 1 elements,
+ *          since the output includes F(0, x) and F(n, x)
+
+ * \param [out] F Output buffer. Size must be n+1 elements
+ * \param [in] n Maximum order of the Boys function
+ * \param [in] x The value of x for the Boys function
+ * \param [in] engine Which method to use
+ */
+inline void calculate_f(double * const RESTRICT F, int n, double x, BoysEngine engine)
+{
+    if(engine == BoysEngine::Piecewise && n <= PSR_MODULES_BOYS_PIECEWISE_N)
+        detail::boys_f_piecewise(F, n, x);
+    else
+        calculate_f(F, n, x);
+}
+
+
 } // close namespace detail
 } // close namespace integrals
 } // close namespace psr_modules
@@ -0,0 +1,265 @@
+#include "Integrals/boys/Boys_batch.hpp"
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+/////////////////////////////////////////////////////////////////
+// General notes about the following
+//
+// Each kernel evaluates a whole SIMD vector of x values at once.
+// Both the Taylor series (using the short grid) and the asymptotic
+// formula are evaluated for every lane, and the correct one is
+// selected at the end with a mask. Lanes that use the asymptotic
+// formula have their x value clamped to zero for the table lookup,
+// so the gathers always stay within the table.
+//
+// The Taylor series for order i needs the grid values for orders
+// [i, i+7]. Order i+1 needs [i+1, i+8], so we keep a sliding window
+// of 8 gathered vectors and only gather one new vector per order.
+/////////////////////////////////////////////////////////////////
+
+// Coefficients of the Taylor series (1/k!)
+#define BOYS_TAYLOR_C2 (1.0/2.0)
+#define BOYS_TAYLOR_C3 (1.0/6.0)
+#define BOYS_TAYLOR_C4 (1.0/24.0)
+#define BOYS_TAYLOR_C5 (1.0/120.0)
+#define BOYS_TAYLOR_C6 (1.0/720.0)
+#define BOYS_TAYLOR_C7 (1.0/5040.0)
+
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+#if defined(__AVX512F__)
+
+#define BOYS_BATCH_WIDTH 8
+
+static void boys_batch_kernel(double * const RESTRICT F, int n,
+                              const double * const RESTRICT x,
+                              size_t nx, size_t nvec)
+{
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d maxx = _mm512_set1_pd(PSR_MODULES_BOYS_SHORTGRID_MAXX);
+    const __m512d space = _mm512_set1_pd(PSR_MODULES_BOYS_SHORTGRID_SPACE);
+    const __m512d halfspace = _mm512_set1_pd(PSR_MODULES_BOYS_SHORTGRID_SPACE/2.0);
+    const __m512d lookupfac = _mm512_set1_pd(1.0/PSR_MODULES_BOYS_SHORTGRID_SPACE);
+    const __m256i rowlen = _mm256_set1_epi32(PSR_MODULES_BOYS_SHORTGRID_MAXN+1);
+
+    const __m512d c2 = _mm512_set1_pd(BOYS_TAYLOR_C2);
+    const __m512d c3 = _mm512_set1_pd(BOYS_TAYLOR_C3);
+    const __m512d c4 = _mm512_set1_pd(BOYS_TAYLOR_C4);
+    const __m512d c5 = _mm512_set1_pd(BOYS_TAYLOR_C5);
+    const __m512d c6 = _mm512_set1_pd(BOYS_TAYLOR_C6);
+    const __m512d c7 = _mm512_set1_pd(BOYS_TAYLOR_C7);
+
+    double const * const grid = &(lut::boys_shortgrid[0][0]);
+
+    for(size_t k = 0; k < nvec; k += BOYS_BATCH_WIDTH)
+    {
+        const __m512d xv = _mm512_loadu_pd(x + k);
+        const __mmask8 isshort = _mm512_cmp_pd_mask(xv, maxx, _CMP_LT_OQ);
+
+        // Taylor series setup. x is zero for the lanes using the asymptotic formula
+        const __m512d xs = _mm512_mask_blend_pd(isshort, zero, xv);
+        const __m256i lookup_idx = _mm512_cvttpd_epi32(_mm512_mul_pd(lookupfac, _mm512_add_pd(xs, halfspace)));
+        const __m512d dx = _mm512_sub_pd(_mm512_mul_pd(_mm512_cvtepi32_pd(lookup_idx), space), xs);
+        const __m256i rowstart = _mm256_mullo_epi32(lookup_idx, rowlen);
+
+        // asymptotic setup. x is at least maxx, so there are no divisions by zero
+        const __m512d x1 = _mm512_div_pd(one, _mm512_max_pd(xv, maxx));
+        __m512d x2 = _mm512_sqrt_pd(x1);
+
+        // initial window of grid points
+        __m512d g0 = _mm512_mask_i32gather_pd(zero, 0xFF, rowstart, grid, 8);
+        __m512d g1 = _mm512_mask_i32gather_pd(zero, 0xFF, _mm256_add_epi32(rowstart, _mm256_set1_epi32(1)), grid, 8);
+        __m512d g2 = _mm512_mask_i32gather_pd(zero, 0xFF, _mm256_add_epi32(rowstart, _mm256_set1_epi32(2)), grid, 8);
+        __m512d g3 = _mm512_mask_i32gather_pd(zero, 0xFF, _mm256_add_epi32(rowstart, _mm256_set1_epi32(3)), grid, 8);
+        __m512d g4 = _mm512_mask_i32gather_pd(zero, 0xFF, _mm256_add_epi32(rowstart, _mm256_set1_epi32(4)), grid, 8);
+        __m512d g5 = _mm512_mask_i32gather_pd(zero, 0xFF, _mm256_add_epi32(rowstart, _mm256_set1_epi32(5)), grid, 8);
+        __m512d g6 = _mm512_mask_i32gather_pd(zero, 0xFF, _mm256_add_epi32(rowstart, _mm256_set1_epi32(6)), grid, 8);
+        __m512d g7 = _mm512_mask_i32gather_pd(zero, 0xFF, _mm256_add_epi32(rowstart, _mm256_set1_epi32(7)), grid, 8);
+
+        for(int i = 0; i <= n; i++)
+        {
+            __m512d taylor = _mm512_mul_pd(c7, g7);
+            taylor = _mm512_fmadd_pd(dx, taylor, _mm512_mul_pd(c6, g6));
+            taylor = _mm512_fmadd_pd(dx, taylor, _mm512_mul_pd(c5, g5));
+            taylor = _mm512_fmadd_pd(dx, taylor, _mm512_mul_pd(c4, g4));
+            taylor = _mm512_fmadd_pd(dx, taylor, _mm512_mul_pd(c3, g3));
+            taylor = _mm512_fmadd_pd(dx, taylor, _mm512_mul_pd(c2, g2));
+            taylor = _mm512_fmadd_pd(dx, taylor, g1);
+            taylor = _mm512_fmadd_pd(dx, taylor, g0);
+
+            const __m512d asym = _mm512_mul_pd(_mm512_set1_pd(lut::boys_longfac[i]), x2);
+            x2 = _mm512_mul_pd(x2, x1);
+
+            _mm512_storeu_pd(F + static_cast<size_t>(i)*nx + k,
+                             _mm512_mask_blend_pd(isshort, asym, taylor));
+
+            if(i < n)
+            {
+                g0 = g1; g1 = g2; g2 = g3; g3 = g4;
+                g4 = g5; g5 = g6; g6 = g7;
+                g7 = _mm512_mask_i32gather_pd(zero, 0xFF, _mm256_add_epi32(rowstart, _mm256_set1_epi32(i+8)), grid, 8);
+            }
+        }
+    }
+}
+
+#elif defined(__AVX2__)
+
+#define BOYS_BATCH_WIDTH 4
+
+#if defined(__FMA__)
+    #define BOYS_FMADD(a, b, c) _mm256_fmadd_pd(a, b, c)
+#else
+    #define BOYS_FMADD(a, b, c) _mm256_add_pd(_mm256_mul_pd(a, b), c)
+#endif
+
+static void boys_batch_kernel(double * const RESTRICT F, int n,
+                              const double * const RESTRICT x,
+                              size_t nx, size_t nvec)
+{
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d allmask = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    const __m256d maxx = _mm256_set1_pd(PSR_MODULES_BOYS_SHORTGRID_MAXX);
+    const __m256d space = _mm256_set1_pd(PSR_MODULES_BOYS_SHORTGRID_SPACE);
+    const __m256d halfspace = _mm256_set1_pd(PSR_MODULES_BOYS_SHORTGRID_SPACE/2.0);
+    const __m256d lookupfac = _mm256_set1_pd(1.0/PSR_MODULES_BOYS_SHORTGRID_SPACE);
+    const __m128i rowlen = _mm_set1_epi32(PSR_MODULES_BOYS_SHORTGRID_MAXN+1);
+
+    const __m256d c2 = _mm256_set1_pd(BOYS_TAYLOR_C2);
+    const __m256d c3 = _mm256_set1_pd(BOYS_TAYLOR_C3);
+    const __m256d c4 = _mm256_set1_pd(BOYS_TAYLOR_C4);
+    const __m256d c5 = _mm256_set1_pd(BOYS_TAYLOR_C5);
+    const __m256d c6 = _mm256_set1_pd(BOYS_TAYLOR_C6);
+    const __m256d c7 = _mm256_set1_pd(BOYS_TAYLOR_C7);
+
+    double const * const grid = &(lut::boys_shortgrid[0][0]);
+
+    for(size_t k = 0; k < nvec; k += BOYS_BATCH_WIDTH)
+    {
+        const __m256d xv = _mm256_loadu_pd(x + k);
+        const __m256d isshort = _mm256_cmp_pd(xv, maxx, _CMP_LT_OQ);
+
+        // Taylor series setup. x is zero for the lanes using the asymptotic formula
+        const __m256d xs = _mm256_and_pd(isshort, xv);
+        const __m128i lookup_idx = _mm256_cvttpd_epi32(_mm256_mul_pd(lookupfac, _mm256_add_pd(xs, halfspace)));
+        const __m256d dx = _mm256_sub_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(lookup_idx), space), xs);
+        const __m128i rowstart = _mm_mullo_epi32(lookup_idx, rowlen);
+
+        // asymptotic setup. x is at least maxx, so there are no divisions by zero
+        const __m256d x1 = _mm256_div_pd(one, _mm256_max_pd(xv, maxx));
+        __m256d x2 = _mm256_sqrt_pd(x1);
+
+        // initial window of grid points
+        __m256d g0 = _mm256_mask_i32gather_pd(zero, grid, rowstart, allmask, 8);
+        __m256d g1 = _mm256_mask_i32gather_pd(zero, grid, _mm_add_epi32(rowstart, _mm_set1_epi32(1)), allmask, 8);
+        __m256d g2 = _mm256_mask_i32gather_pd(zero, grid, _mm_add_epi32(rowstart, _mm_set1_epi32(2)), allmask, 8);
+        __m256d g3 = _mm256_mask_i32gather_pd(zero, grid, _mm_add_epi32(rowstart, _mm_set1_epi32(3)), allmask, 8);
+        __m256d g4 = _mm256_mask_i32gather_pd(zero, grid, _mm_add_epi32(rowstart, _mm_set1_epi32(4)), allmask, 8);
+        __m256d g5 = _mm256_mask_i32gather_pd(zero, grid, _mm_add_epi32(rowstart, _mm_set1_epi32(5)), allmask, 8);
+        __m256d g6 = _mm256_mask_i32gather_pd(zero, grid, _mm_add_epi32(rowstart, _mm_set1_epi32(6)), allmask, 8);
+        __m256d g7 = _mm256_mask_i32gather_pd(zero, grid, _mm_add_epi32(rowstart, _mm_set1_epi32(7)), allmask, 8);
+
+        for(int i = 0; i <= n; i++)
+        {
+            __m256d taylor = _mm256_mul_pd(c7, g7);
+            taylor = BOYS_FMADD(dx, taylor, _mm256_mul_pd(c6, g6));
+            taylor = BOYS_FMADD(dx, taylor, _mm256_mul_pd(c5, g5));
+            taylor = BOYS_FMADD(dx, taylor, _mm256_mul_pd(c4, g4));
+            taylor = BOYS_FMADD(dx, taylor, _mm256_mul_pd(c3, g3));
+            taylor = BOYS_FMADD(dx, taylor, _mm256_mul_pd(c2, g2));
+            taylor = BOYS_FMADD(dx, taylor, g1);
+            taylor = BOYS_FMADD(dx, taylor, g0);
+
+            const __m256d asym = _mm256_mul_pd(_mm256_set1_pd(lut::boys_longfac[i]), x2);
+            x2 = _mm256_mul_pd(x2, x1);
+
+            _mm256_storeu_pd(F + static_cast<size_t>(i)*nx + k,
+                             _mm256_blendv_pd(asym, taylor, isshort));
+
+            if(i < n)
+            {
+                g0 = g1; g1 = g2; g2 = g3; g3 = g4;
+                g4 = g5; g5 = g6; g6 = g7;
+                g7 = _mm256_mask_i32gather_pd(zero, grid, _mm_add_epi32(rowstart, _mm_set1_epi32(i+8)), allmask, 8);
+            }
+        }
+    }
+}
+
+#undef BOYS_FMADD
+
+#else
+
+#define BOYS_BATCH_WIDTH 1
+
+// No SIMD available - everything is handled by the scalar remainder loop
+static void boys_batch_kernel(double * const RESTRICT, int,
+                              const double * const RESTRICT,
+                              size_t, size_t)
+{
+}
+
+#endif
+
+
+size_t boys_batch_width(void)
+{
+    return BOYS_BATCH_WIDTH;
+}
+
+
+void calculate_f_batch(double * const RESTRICT F, int n,
+                       const double * const RESTRICT x, size_t nx)
+{
+    // number of elements that can be handled by full SIMD vectors
+    const size_t nvec = (BOYS_BATCH_WIDTH > 1) ? nx - (nx % BOYS_BATCH_WIDTH) : 0;
+
+    boys_batch_kernel(F, n, x, nx, nvec);
+
+    // remainder (or everything, if there is no SIMD kernel)
+    double tmp[PSR_MODULES_BOYS_SHORTGRID_MAXN+1];
+
+    for(size_t k = nvec; k < nx; k++)
+    {
+        calculate_f(tmp, n, x[k]);
+        for(int i = 0; i <= n; i++)
+            F[static_cast<size_t>(i)*nx + k] = tmp[i];
+    }
+}
+
+
+
+void calculate_f_batch(double * const RESTRICT F, int n,
+                       const double * const RESTRICT x, size_t nx,
+                       BoysEngine engine)
+{
+    if(engine != BoysEngine::Piecewise || n > PSR_MODULES_BOYS_PIECEWISE_N)
+    {
+        calculate_f_batch(F, n, x, nx);
+        return;
+    }
+
+    double tmp[PSR_MODULES_BOYS_PIECEWISE_N+1];
+
+    for(size_t k = 0; k < nx; k++)
+    {
+        boys_f_piecewise(tmp, n, x[k]);
+        for(int i = 0; i <= n; i++)
+            F[static_cast<size_t>(i)*nx + k] = tmp[i];
+    }
+}
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
+
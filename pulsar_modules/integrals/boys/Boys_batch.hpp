@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Integrals/boys/Boys.hpp"
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+/*! \brief Calculate the value of the Boys function for many values of x
+ *
+ * This is the batched equivalent of calculate_f. All orders [0, n] are
+ * evaluated for each of the \p nx values in \p x. Rather than branching on
+ * each element, the Taylor series and asymptotic branches are both evaluated
+ * for a whole SIMD vector and the results are selected with a mask.
+ *
+ * The kernel used depends on how the module is compiled. If AVX-512F is
+ * available (ie, compiling with -mavx512f or -march=native on a supporting
+ * machine), 8-wide kernels are used. If only AVX2 is available, 4-wide kernels
+ * are used. Otherwise, a scalar fallback is used. The instruction set is
+ * chosen with the PSR_MODULES_SIMD CMake option (NONE by default).
+ *
+ * The output is stored in struct-of-arrays format, so that
+ * F(i, x[k]) is stored in \p F[i*nx + k]
+ *
+ * \warning The output buffer \p F must be large enough to hold (\p n + 1) * \p nx
+ *          elements, since the output includes F(0, x) and F(n, x)
+ *
+ * \param [out] F Output buffer. Size must be (n+1)*nx elements
+ * \param [in] n Maximum order of the Boys function
+ * \param [in] x The values of x for the Boys function. Must be nonnegative
+ * \param [in] nx The number of elements in \p x
+ */
+void calculate_f_batch(double * const RESTRICT F, int n,
+                       const double * const RESTRICT x, size_t nx);
+
+
+/*! \brief Calculate the value of the Boys function for many values of x
+ *         using a particular engine
+ *
+ * The SIMD kernels are only available for the short grid. Other engines
+ * are evaluated element by element (with the same output layout).
+ *
+ * \param [out] F Output buffer. Size must be (n+1)*nx elements
+ * \param [in] n Maximum order of the Boys function
+ * \param [in] x The values of x for the Boys function. Must be nonnegative
+ * \param [in] nx The number of elements in \p x
+ * \param [in] engine Which method to use
+ */
+void calculate_f_batch(double * const RESTRICT F, int n,
+                       const double * const RESTRICT x, size_t nx,
+                       BoysEngine engine);
+
+
+/*! \brief Returns the SIMD width (in doubles) used by calculate_f_batch
+ *
+ * Callers may use this to size their batches. Batches do not have to be
+ * a multiple of this, but any remainder is handled by the scalar code.
+ */
+size_t boys_batch_width(void);
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
+
@@ -0,0 +1,206 @@
+/*
+ Generated with:
+   ./gen_piecewise.py --filename Boys_piecewise --max-n 16 --anchors 0,2,4,6,8,16 --max-x 36 --spacing 2.0 --order 14 --dps 64
+------------------------------------
+Options for piecewise fit of Boys function Fn(x):
+    Max n: 16
+  Anchors: 0,2,4,6,8,16
+    Max x: 36.0
+  Spacing: 2.0
+ Segments: 18
+    Order: 14
+      DPS: 64
+  Max rel. error of fit: 4.557e-16
+------------------------------------
+*/
+
+namespace psr_modules {
+namespace integrals {
+namespace lut {
+
+extern const double boys_piecewise[6][18][15] = 
+{
+/* n =    0 */
+{
+/* x = 0.0         */  {0.746824132812427025            , -0.189472345820492361           , 0.0501343990725086841           , -0.0111220457961367087          , 0.00206763504721484457          , -0.000328040537615975642        , 0.0000452319919980465097        , -5.5051591026983343e-6          , 5.99089635539378434e-7          , -5.89183610926716092e-8         , 5.28354965459872091e-9          , -4.35253295755411935e-10        , 3.31606202864782202e-11         , -2.38581671771392168e-12        , 1.57635905863283285e-13         , },
+/* x = 2.0         */  {0.504343560231438807            , -0.0757594153105958121          , 0.0147909314636602908           , -0.0027256179519093639          , 0.000449228372307854748         , -0.0000656198056264387238       , 8.52571181908265996e-6          , -9.92513034985663908e-7         , 1.04360603674565355e-7          , -9.98763506579904899e-9         , 8.76085861663021133e-10         , -7.08674655544035709e-11        , 5.31723248199470502e-12         , -3.77498940416545634e-13        , 2.46667281191905958e-14         , },
+/* x = 4.0         */  {0.395712309610513542            , -0.0388974362611428077          , 0.00549771808921714778          , -0.000803987231551425343        , 0.000112622986358644283         , -0.0000146571817120730147       , 1.75132400844040419e-6          , -1.91556462276060254e-7         , 1.92056586582729207e-8          , -1.7709389906519942e-9          , 1.50798515813506273e-10         , -1.19074775678044589e-11        , 8.7578183426770182e-13          , -6.1121283055453907e-14         , 3.93789252928692686e-15         , },
+/* x = 6.0         */  {0.334901058176559283            , -0.0238563697293574834          , 0.00252347240080421192          , -0.000289557643362946339        , 0.0000334807709990751794        , -3.76188367277953405e-6         , 4.02163143105536972e-7          , -4.04246747325931425e-8         , 3.79858178710267731e-9          , -3.33014215037418926e-10        , 2.7245471518557349e-11          , -2.08331944844589775e-12        , 1.49254154772844212e-13         , -1.01874326062071891e-14        , 6.44562261614117632e-16         , },
+/* x = 8.0         */  {0.295402449419840411            , -0.0164043910897640962          , 0.00136360454070015581          , -0.000125116996323285694        , 0.0000118784815775262119        , -1.13071398919632825e-6         , 1.05642952287890732e-7          , -9.53933232264402995e-9         , 8.23638282489872214e-10         , -6.75376309718370675e-11        , 5.23961336590592288e-12         , -3.83920845153855348e-13        , 2.65689662917169747e-14         , -1.76156603505721768e-15        , 1.08868610385031345e-16         , },
+/* x = 10.0        */  {0.267206743351862277            , -0.0121450018932305469          , 0.000827688726793213522         , -0.0000625771633874385199       , 4.94609689674653915e-6          , -3.98354253374269609e-7         , 3.21417874787629909e-8          , -2.56263915762928535e-9         , 1.99578169619093014e-10         , -1.5043440018114849e-11         , 1.08999962456027926e-12         , -7.55618248352116162e-14        , 4.99834100740759024e-15         , -3.19111987751651233e-16        , 1.9130470254081067e-17          , },
+/* x = 12.0        */  {0.245795040805641159            , -0.0094535684798551607          , 0.000545354713656894251         , -0.0000349441461997561565       , 2.34838751760060509e-6          , -1.61856209741979033e-7         , 1.12921937741670737e-8          , -7.89336113203826122e-10        , 5.4767132896547393e-11          , -3.73923802808254372e-12        , 2.49294831744247531e-13         , -1.61258420332070994e-14        , 1.00729307168836972e-15         , -6.1276546916792699e-17         , 3.53257556330901415e-18         , },
+/* x = 14.0        */  {0.228822798329737351            , -0.00762741641424722832         , 0.000381365722340353052         , -0.000021185285117127936        , 1.23538343416509929e-6          , -7.40380331831134749e-8         , 4.51038432783356701e-9          , -2.77191104353451693e-10        , 1.70715485858997858e-11         , -1.04677594645483409e-12        , 6.34858587236089656e-14         , -3.78435221582861362e-15        , 2.20493188002567764e-16         , -1.26347845066927717e-17        , 6.9347190561178758e-19          , },
+/* x = 16.0        */  {0.21494160010412462             , -0.00632181055013963037         , 0.000278902797809436813         , -0.0000136715028368489227       , 7.03629558542238849e-7          , -3.72408297225359959e-8         , 2.00639280459801206e-9          , -1.09351291267651043e-10        , 6.00020296652931489e-12         , -3.29989182601240382e-13        , 1.81050259120340433e-14         , -9.86046639188319486e-16        , 5.30442536663661597e-17         , -2.83241558775398861e-18        , 1.46482548380838928e-19         , },
+/* x = 18.0        */  {0.203314400334762091            , -0.00535037880873593826         , 0.000211199089781728648         , -9.26309339921424969e-6         , 4.26583684178246655e-7          , -2.02053668829093048e-8         , 9.7461555149863733e-10          , -4.76023327331439667e-11        , 2.34514251657807639e-12         , -1.16165107851657303e-13        , 5.7676243029661541e-15          , -2.86058306361144025e-16        , 1.41206034807822485e-17         , -6.96922102856393094e-19        , 3.36536243240302256e-20         , },
+/* x = 20.0        */  {0.193390569924979533            , -0.00460453736111246404         , 0.000164447753870016064         , -6.52570150969888032e-6         , 2.7190347733264899e-7           , -1.16528557237718433e-8         , 5.08631326036244795e-10         , -2.24869187240956925e-11        , 1.00343253938715027e-12         , -4.50781688538568326e-14        , 2.03427537350592471e-15         , -9.2012664007833386e-17         , 4.16130416858376306e-18         , -1.89046649526779941e-19        , 8.47066407916551169e-21         , },
+/* x = 22.0        */  {0.184791088080199504            , -0.00401719756473001537         , 0.000130995571647513585         , -4.74621599223311424e-6         , 1.80562471970103697e-7          , -7.0654694432511374e-9          , 2.81591698257704882e-10         , -1.13681663080417775e-11        , 4.63321015620451971e-13         , -1.90191119045313543e-14        , 7.84957252686966174e-16         , -3.25208461842201622e-17        , 1.35037833940027458e-18         , -5.64582221647633161e-20        , 2.34111543002425517e-21         , },
+/* x = 24.0        */  {0.177245385090279095            , -0.00354490770152782302         , 0.000106347230906955252         , -3.54490765060536219e-6         , 1.24071756197901122e-7          , -4.46658090846713961e-9         , 1.6377424753424333e-10          , -6.08298836890719146e-12        , 2.28105174972939418e-13         , -8.61654129787787396e-15        , 3.27352026448822435e-16         , -1.24917842147075928e-17        , 4.78271869451384576e-19         , -1.84523985229621417e-20        , 7.08517327964024744e-22         , },
+/* x = 26.0        */  {0.170554451324380554            , -0.00315841576523150046         , 0.0000877337712390275238        , -2.70783243984798278e-6         , 8.77538276188938736e-8          , -2.92512729724572224e-9         , 9.93098290338358286e-11         , -3.41541049464985167e-12        , 1.18589778929068286e-13         , -4.14810626313386942e-15        , 1.45942295428707267e-16         , -5.15865730151682579e-18        , 1.83027818188972275e-19         , -6.54371777199306994e-21        , 2.33303834065295373e-22         , },
+/* x = 28.0        */  {0.164568208623554517            , -0.00283738290729827846         , 0.0000733805924279350759        , -2.10863771271547182e-6         , 6.36226894250598073e-8          , -1.97449722147217827e-9         , 6.24122624036568642e-11         , -1.99842132502136426e-12        , 6.46040288917278335e-14         , -2.10395055298055146e-15        , 6.89213095594630736e-17         , -2.26844435499338708e-18        , 7.49537998451224657e-20         , -2.49485203188694092e-21        , 8.29073981039854532e-23         , },
+/* x = 30.0        */  {0.159171054610202181            , -0.00256727507435754446         , 0.0000621114937341791016        , -1.66966380996603829e-6         , 4.71276075162290573e-8          , -1.36822085874740699e-9         , 4.04581429014741524e-11         , -1.21187974632772392e-12        , 3.66495753318614821e-14         , -1.11656259714873923e-15        , 3.42170878740288041e-17         , -1.05358590719593221e-18        , 3.25693712126728504e-20         , -1.01381240226617173e-21        , 3.15297008520605268e-23         , },
+/* x = 32.0        */  {0.154272305827641016            , -0.00233745917920661146         , 0.0000531240722546604205        , -1.34151697611602353e-6         , 3.55705258789230443e-8          , -9.70105250655112692e-10        , 2.69473679757125972e-11         , -7.5825925803741493e-13         , 2.15414544435203175e-14         , -6.16506079030186956e-16        , 1.77478828235206675e-17         , -5.13364645262056964e-19        , 1.49081687079993918e-20         , -4.35774365882337546e-22        , 1.27330333139635606e-23         , },
+/* x = 34.0        */  {0.149799691340274055            , -0.00213999559057533463         , 0.0000458570483694669527        , -1.09183448498580718e-6         , 2.72958621242698749e-8          , -7.01893597406164497e-10        , 1.83829275386036798e-11         , -4.87710320665322783e-13        , 1.30636690801396205e-14         , -3.52511681158971733e-16        , 9.56817172105627465e-18         , -2.60949069662851441e-19        , 7.14501499759567045e-21         , -1.96851861836031058e-22        , 5.42343637427740916e-24         , },
+},
+/* n =    2 */
+{
+/* x = 0.0         */  {0.100268798145017367            , -0.0667322747768222647          , 0.0248116205665783695           , -0.00656081075224706619         , 0.00135695975993505452          , -0.00023121668303775767         , 0.0000335490196465815516        , -4.24211896310879575e-6         , 4.75519247406945024e-7          , -4.78839334381608242e-8         , 4.37762720204504637e-9          , -3.6644782088182092e-10         , 2.82987632714806302e-11         , -2.0603098977091614e-12         , 1.37488204909509099e-13         , },
+/* x = 2.0         */  {0.0295818629273205815           , -0.0163537077114564953          , 0.00539074046769429304          , -0.00131239611251754768         , 0.000255771354571505454         , -0.00004168554758165989         , 5.84419381443861272e-6          , -7.19109254326580626e-7         , 7.88476935123422502e-8          , -7.79636199901834055e-9         , 7.01940043978536992e-10         , -5.80003894858826376e-11        , 4.42926690845296833e-12         , -3.19279685236980129e-13        , 2.11267509700653155e-14         , },
+/* x = 4.0         */  {0.0109954361784342955           , -0.00482392338930860125         , 0.00135147583630373703          , -0.00029314363423968972         , 0.0000525397202530600645        , -8.04537143329935705e-6         , 1.07551688621526369e-6          , -1.275075331384312e-7           , 1.35718611112054076e-8          , -1.3099709042459407e-9          , 1.1561340190104119e-10          , -9.3946455671060997e-12         , 7.07320492019031414e-13         , -5.03536908502444395e-14        , 3.29712246697244162e-15         , },
+/* x = 6.0         */  {0.00504694480160842384          , -0.00173734586017768596         , 0.000401769251988903048         , -0.000075237673455305322        , 0.0000120648942931419225        , -1.69783634162235675e-6         , 2.12720580292792904e-7          , -2.39770115258957585e-8         , 2.45209159175577724e-9          , -2.29189052102269517e-10        , 1.97031707774472719e-11         , -1.56663170552860419e-12        , 1.15819021457959638e-13         , -8.11541084970554359e-15        , 5.24430100023118443e-16         , },
+/* x = 8.0         */  {0.00272720908140031162          , -0.000750701977939715478        , 0.000142541778930314688         , -0.0000226142797838793142       , 3.16928856863278345e-6          , -4.00651958023533955e-7         , 4.61237438544498144e-8          , -4.86270745011568452e-9         , 4.71565065348582701e-10         , -4.22352525478912318e-11        , 3.50736772749719727e-12         , -2.7106080344214341e-13         , 1.95712479845793534e-14         , -1.34378724255927283e-15        , 8.53960862396854374e-17         , },
+/* x = 10.0        */  {0.00165537745358642704          , -0.000375462980324631344        , 0.0000593531627609584943        , -7.96708506747729874e-6         , 9.64253624362229374e-7          , -1.0763084470136049e-7          , 1.11763775045403071e-8          , -1.08312734217996777e-9         , 9.80999431427569214e-11         , -8.31247895870953356e-12        , 6.59825305773904821e-13         , -4.9140254862899836e-14         , 3.44103042555611799e-15         , -2.30174463751856711e-16        , 1.43177619661791851e-17         , },
+/* x = 12.0        */  {0.0010907094273137885           , -0.000209664877198536979        , 0.0000281806502112072654        , -3.23712419483813435e-6         , 3.38765813224897386e-7          , -3.31521167690230535e-8         , 3.06695944322753648e-9          , -2.69225077420001199e-10        , 2.2436530845932976e-11          , -1.77396382383829925e-12        , 1.32970387156142399e-13         , -9.44455501234339053e-15        , 6.35849155024651067e-16         , -4.11326350921080299e-17        , 2.48958589861128366e-18         , },
+/* x = 14.0        */  {0.000762731444680706105         , -0.000127111710702767623        , 0.0000148246012099811923        , -1.48076066366199711e-6         , 1.35311529834986121e-7          , -1.1642026385568743e-8          , 9.56006720996105396e-10         , -7.53678567312387752e-11        , 5.71372655544502464e-12         , -4.16301570106315013e-13        , 2.91065018839913658e-14         , -1.94944561520989767e-15        , 1.24923991392902758e-16         , -7.74678137628571091e-18        , 4.52896144671679742e-19         , },
+/* x = 16.0        */  {0.000557805595618873625         , -0.0000820290170210935375       , 8.44355470250686634e-6          , -7.44816594450665243e-7         , 6.01917841379363458e-8          , -4.59275423378807637e-9         , 3.36011366161346567e-10         , -2.37592188562920767e-11        , 1.62945219180007938e-12         , -1.08469712184078865e-13        , 7.00211084210392041e-15         , -4.37524975596949607e-16        , 2.6412223828143541e-17          , -1.55499543985183836e-18        , 8.70698912977839992e-20         , },
+/* x = 18.0        */  {0.000422398179563457296         , -0.0000555785603952854985       , 5.1190042101389599e-6           , -4.04107337658174271e-7         , 2.92384665449582952e-8          , -1.99929797491030719e-9         , 1.31327980935704208e-10         , -8.36388726976541909e-12        , 5.1908615846036959e-13          , -3.1467404783761006e-14         , 1.86397497090350309e-15         , -1.07782842167244827e-16        , 6.07411625876907884e-18         , -3.3635522859979485e-19         , 1.78793205112938625e-20         , },
+/* x = 20.0        */  {0.000328895507740032127         , -0.000039154209058193282        , 3.26284172799178789e-6          , -2.33057114475434084e-7         , 1.52589397810871612e-8          , -9.44450586439833921e-10        , 5.61922222073043667e-11         , -3.24562804092327177e-12        , 1.83084777235208257e-13         , -1.01216261447064904e-14        , 5.49304401038283482e-16         , -2.92708922339309133e-17        , 1.53039973088627074e-18         , -7.91113670002275777e-20        , 3.9600253053921551e-21          , },
+/* x = 22.0        */  {0.00026199114329502717          , -0.0000284772959533986855       , 2.16674966364124436e-6          , -1.41309388865022033e-7         , 8.44775094773110251e-9          , -4.77462984944905127e-10        , 2.59459768751360884e-11         , -1.36937602716304803e-12        , 7.0646151206516847e-14          , -3.57735300555077291e-15        , 1.78252888716844537e-16         , -8.75082692926617603e-18        , 4.2337324135619319e-19          , -2.03376749396688895e-20        , 9.52899455119119591e-22         , },
+/* x = 24.0        */  {0.000212694461813910504         , -0.0000212694459036321731       , 1.48886107437481347e-6          , -8.93316181693425912e-8         , 4.91322742602728838e-9          , -2.55485511496112148e-10        , 1.27738897985871064e-11         , -6.20390965024068552e-13        , 2.94616819776938239e-14         , -1.3741131096160797e-15         , 6.31326599799108822e-17         , -2.86264726681368662e-18        , 1.28239407790350457e-19         , -5.71728113303170951e-21        , 2.49935958819838483e-22         , },
+/* x = 26.0        */  {0.000175467542478055048         , -0.0000162469946390878967       , 1.05304593142672648e-6          , -5.85025459449143831e-8         , 2.97929487101507157e-9          , -1.43447240775909364e-10        , 6.64102762005710014e-12         , -2.98663648366049149e-13        , 1.31348064735638353e-14         , -5.67457462271316893e-16        , 2.41598928460130689e-17         , -1.015942333220195e-18          , 4.2258294937927077e-20          , -1.75092908105103326e-21        , 7.13864588938921257e-23         , },
+/* x = 28.0        */  {0.000146761184855870152         , -0.0000126518262762928309       , 7.63472273100717688e-7          , -3.94899444294435449e-8         , 1.87236787210970491e-9          , -8.39336956511013417e-11        , 3.61782561794582387e-12         , -1.51484438959575394e-13        , 6.2029178247366639e-15          , -2.49530589076320728e-16        , 9.89396996228851711e-18         , -3.87580181389850227e-19        , 1.50262885505351619e-20         , -5.80361308325595246e-22        , 2.21041060808004909e-23         , },
+/* x = 30.0        */  {0.000124222987468358203         , -0.0000100179828597962298       , 5.65531290194748687e-7          , -2.73644171749481325e-8         , 1.21374428704422423e-9          , -5.08989493458370421e-11        , 2.05237621858726633e-12         , -8.0392506690327741e-14         , 3.07953789678470974e-15         , -1.15895058547772133e-16        , 4.29917980616778072e-18         , -1.57579188817192198e-19        , 5.71744206869061283e-21         , -2.06604572274321635e-22        , 7.37184227617614155e-24         , },
+/* x = 32.0        */  {0.000106248144509320841         , -8.0491018566961412e-6          , 4.26846310547076532e-7          , -1.94021050131022511e-8         , 8.08421039271377795e-10         , -3.18468888375989877e-11        , 1.20632144883821602e-12         , -4.43884375746825686e-14        , 1.59730944988074107e-15         , -5.64703419583477737e-17        , 1.96788640298122665e-18         , -6.77624222496971894e-20        , 2.30993569514935126e-21         , -7.83918426223947819e-23        , 2.62907357490048639e-24         , },
+/* x = 34.0        */  {0.0000917140967389339055        , -6.55100690991484308e-6         , 3.27550345491238499e-7          , -1.40378719481232888e-8         , 5.51487826158110349e-10         , -2.0483833467954625e-11         , 7.31565468488227111e-13         , -2.53808409970658212e-14        , 8.61135453290733067e-16         , -2.87044904223923277e-17        , 9.43145060058998633e-19         , -3.06211912224873859e-20        , 9.84233930271417038e-22         , -3.14815736584724554e-23        , 9.95695847100697708e-25         , },
+},
+/* n =    4 */
+{
+/* x = 0.0         */  {0.0496232411331567381           , -0.0393648645134841679          , 0.0162835171192208623           , -0.00462433366069141166         , 0.00100647058939182492          , -0.000178168997087952277        , 0.0000266290779047714733        , -3.4476405367287707e-6          , 3.93986251798536517e-7          , -4.031460173640829e-8           , 3.73581383978455235e-9          , -3.1635841450020883e-10         , 2.46762218302525199e-11         , -1.81274639782473953e-12        , 1.21895694573687335e-13         , },
+/* x = 2.0         */  {0.0107814809353885859           , -0.00787437667510555615         , 0.00306925625485809698          , -0.000833710951623476508        , 0.000175325814432306694         , -0.0000302025887789240949       , 4.41547084426360194e-6          , -5.61337656600635103e-7         , 6.31745742053942945e-8          , -6.38085747096683959e-9         , 5.84720361207525089e-10         , -4.90374614950380898e-11        , 3.79255360623349849e-12         , -2.7646371454808355e-13         , 1.84673340151881682e-14         , },
+/* x = 4.0         */  {0.00270295167260747403          , -0.00175886180543818008         , 0.00063047664303672561          , -0.000160907428664483958        , 0.0000322655065863272756        , -5.35531640684514798e-6         , 7.60024223388987435e-7          , -9.43178421212289402e-8         , 1.04052016075406651e-8          , -1.0335369767933281e-9          , 9.33750675974271318e-11         , -7.73608578510398219e-12        , 5.92021385036397326e-13         , -4.2749132208837051e-14         , 2.83256876112418194e-15         , },
+/* x = 6.0         */  {0.000803538503977806093         , -0.000451426040731838498        , 0.000144778731517703823         , -0.0000339567268322107755       , 6.38161740876344952e-6          , -1.00703448645109481e-6         , 1.37317129319145694e-7          , -1.65016018477070359e-8         , 1.77328465950897692e-9          , -1.72349294219337451e-10        , 1.52894750144302651e-11         , -1.24727840340836199e-12        , 9.41922801650526746e-14         , -6.72186945777701434e-15        , 4.40977837446193616e-16         , },
+/* x = 8.0         */  {0.000285083557860629376         , -0.000135685678703276939        , 0.0000380314628235935207        , -8.0130391604327431e-6          , 1.38371231563027041e-6          , -2.04233713284199428e-7         , 2.64076436881853738e-8          , -3.04093659389606984e-9         , 3.15662982849516344e-10         , -2.9819867372815967e-11         , 2.58362098937132607e-12         , -2.06625303385920526e-13        , 1.53432992426204968e-14         , -1.07887265414607398e-15        , 6.99054171925029001e-17         , },
+/* x = 10.0        */  {0.000118706325521916988         , -0.0000478025104048639659       , 0.0000115710434923467718        , -2.15261689402096465e-6         , 3.35291325135686658e-7          , -4.54913484340071549e-8         , 5.49359682064039315e-9          , -5.98498223348650878e-10        , 5.93842592653148488e-11         , -5.40595137419662305e-12        , 4.54251066864348035e-13         , -3.54124369259177e-14           , 2.57361306521063396e-15         , -1.7760879153649989e-16         , 1.13302558329249058e-17         , },
+/* x = 12.0        */  {0.0000563613004224145308        , -0.0000194227451690288356       , 4.06518975869877185e-6          , -6.63042335379400119e-7         , 9.20087832967390486e-8          , -1.13074532622490585e-8         , 1.25644572814615935e-9          , -1.27725350861289766e-10        , 1.1967331803330959e-11          , -1.03898995861172032e-12        , 8.39379270308912842e-14         , -6.3326356130453694e-15         , 4.47737659408255736e-16         , -3.01730456008386509e-17        , 1.88733315063781274e-18         , },
+/* x = 14.0        */  {0.0000296492024199623846        , -8.88456398197198786e-6         , 1.62373835801983401e-6          , -2.32840527711187459e-7         , 2.86802016298681638e-8          , -3.16544998458594685e-9         , 3.19968687238266236e-10         , -2.99737051953362489e-11        , 2.61958464564637109e-12         , -2.14454721823877471e-13        , 1.64909728397497423e-14         , -1.19365072293826419e-15        , 8.15023786539511431e-17         , -5.32963424716916101e-18        , 3.25183692205778412e-19         , },
+/* x = 16.0        */  {0.0000168871094050137327        , -4.46889956670399243e-6         , 7.2230140965523625e-7           , -9.18550846757268033e-8         , 1.00803409848377032e-8          , -9.97887192311492795e-10        , 9.12493227647541431e-11         , -7.80981782226415853e-12        , 6.3018988169133059e-13          , -4.81306572096937307e-14        , 3.48659422432205502e-15         , -2.39828184108986266e-16        , 1.56806355897712873e-17         , -9.87555039941971682e-19        , 5.84046742730400965e-20         , },
+/* x = 18.0        */  {0.0000102380084202779198        , -2.42464402594904581e-6         , 3.50861598539499561e-7          , -3.99859594981993274e-8         , 3.9398394280706174e-9           , -3.51283265398308678e-10        , 2.90688248783047458e-11         , -2.26565285881274624e-12        , 1.67757729606503982e-13         , -1.18566838589521988e-14        , 8.0181747571443235e-16          , -5.1931365024411483e-17         , 3.22266366444282408e-18         , -1.93860504745149757e-19        , 1.10323761987669867e-20         , },
+/* x = 20.0        */  {6.52568345598357578e-6          , -1.39834268685260454e-6         , 1.83107277373045938e-7          , -1.88890117287952468e-8         , 1.68576666621902895e-9          , -1.36316377733092919e-10        , 1.0252747526078983e-11          , -7.28757022431879506e-13        , 4.94373925286438892e-14         , -3.2199181167143331e-15         , 2.02019609253229308e-16         , -1.22279485374326772e-17        , 7.14432746133500584e-19         , -4.07158269466968432e-20        , 2.21256461341634303e-21         , },
+/* x = 22.0        */  {4.33349932728248872e-6          , -8.47856333190132206e-7         , 1.01373011372773231e-7          , -9.54925969889777812e-9         , 7.78379306254060726e-10         , -5.75137931440920592e-11        , 3.95618446775987173e-12         , -2.57569402805942853e-13        , 1.60427592186618011e-14         , -9.62618149031354027e-16        , 5.58867383692985425e-17         , -3.14697388647403634e-18        , 1.72075981048953747e-19         , -9.22671192610710433e-21        , 4.75338409530578112e-22         , },
+/* x = 24.0        */  {2.97772214874962694e-6          , -5.35989709016055549e-7         , 5.89587291123274608e-8          , -5.10971022992216321e-9         , 3.83216693957608109e-10         , -2.60564205318084506e-11        , 1.64985419079603092e-12         , -9.89361405502345831e-14        , 5.68193922069826022e-15         , -3.14897883461027423e-16        , 1.69279426309659313e-17         , -8.8557644098739804e-19         , 4.51750733877647801e-20         , -2.26847503102798155e-21        , 1.10163025771551661e-22         , },
+/* x = 26.0        */  {2.10609186285345297e-6          , -3.51015275669486299e-7         , 3.57515384521808588e-8          , -2.86894481551816598e-9         , 1.99230828601711729e-10         , -1.25438732315871609e-11        , 7.35549162530913683e-13         , -4.08569363905775712e-14        , 2.17439031159243943e-15         , -1.117554425367888e-16          , 5.57818046868095757e-18         , -2.7145649139643511e-19         , 1.29137088996586519e-20         , -6.06100689531261758e-22        , 2.76493146863078888e-23         , },
+/* x = 28.0        */  {1.52694454620143538e-6          , -2.3693966657666127e-7          , 2.24684144653164589e-8          , -1.67867391302202066e-9         , 1.08534768538374369e-10         , -6.36234643636391057e-12        , 3.47363398188336059e-13         , -1.79662021547632117e-14        , 8.90457284493917153e-16         , -4.26343374084749708e-17        , 1.98349334460322149e-18         , -9.00471398949872769e-20        , 4.00157020261283373e-21         , -1.75616933201299719e-22        , 7.51731859241825461e-24         , },
+/* x = 30.0        */  {1.13106258038949737e-6          , -1.64186503049688795e-7         , 1.45649314445306908e-8          , -1.01797898691673891e-9         , 6.1571286557617888e-11          , -3.37648528101307172e-12        , 1.72454122220849047e-13         , -8.34444413453709592e-15        , 3.86926178998369374e-16         , -1.73338725726288347e-17        , 7.54709182198369741e-19         , -3.20773379473043372e-20        , 1.33539789769238047e-21         , -5.4913664254849329e-23         , 2.20746095949665172e-24         , },
+/* x = 32.0        */  {8.53692621094153064e-7          , -1.16412630078613507e-7         , 9.70105247125653354e-9          , -6.36937776751979107e-10        , 3.61896434651464486e-11         , -1.86431437814314165e-12        , 8.9449329193607171e-14          , -4.06586459387327416e-15        , 1.77109775145978551e-16         , -7.45392070232665532e-18        , 3.04913666695162035e-19         , -1.21778324821067055e-20        , 4.76510559314836596e-22         , -1.84134126480487073e-23        , 6.96563022846023875e-25         , },
+/* x = 34.0        */  {6.55100690982476998e-7          , -8.4227231688739733e-8          , 6.61785391389732419e-9          , -4.09676669359092269e-10        , 2.19469640546468025e-11         , -1.06599532187907679e-12        , 4.82235853843773304e-14         , -2.06672330072274254e-15        , 8.4883055027055975e-17          , -3.36835041327018309e-18        , 1.29919605060843875e-19         , -4.89280389027557364e-21        , 1.80549057598609247e-22         , -6.57693219839804799e-24        , 2.34757808906059329e-25         , },
+},
+/* n =    6 */
+{
+/* x = 0.0         */  {0.0325670342384417239           , -0.0277460019641500506          , 0.0120776470727020859           , -0.00356337994170214537         , 0.00079887233713809551          , -0.000144800903111578837        , 0.000022063230145606662         , -2.90264894087153948e-6         , 3.36223069209338383e-7          , -3.48041937157580032e-8         , 3.25759993962108391e-9          , -2.78280539874842915e-10        , 2.18737108351102012e-11         , -1.61817577534905881e-12        , 1.09473098535024641e-13         , },
+/* x = 2.0         */  {0.00613851250971619383          , -0.00500226570974109709         , 0.00210390977318770832          , -0.000604051775569912959        , 0.000132464125327151801         , -0.0000235761816629113906       , 3.53777616222605776e-6          , -4.59421378865850009e-7         , 5.2624806089619095e-8           , -5.39483882529873834e-9         , 5.00667804352464177e-10         , -4.2449466932151077e-11         , 3.31442366389394252e-12         , -2.43691262067783939e-13        , 1.63982049317482775e-14         , },
+/* x = 4.0         */  {0.0012609532860734512           , -0.000965444571986939995        , 0.000387186079035931543         , -0.000107106328135598105        , 0.0000228007267015551974        , -3.96134938213946225e-6         , 5.82691291039647142e-7          , -7.44146076548355749e-8         , 8.40375208644434669e-9          , -8.51078780915841747e-10        , 7.81544982464589237e-11         , -6.5654875307085533e-12         , 5.08472021252746721e-13         , -3.71087373656017633e-14        , 2.48111932816317432e-15         , },
+/* x = 6.0         */  {0.000289557463035407643         , -0.000203740360993270246        , 0.0000765794089051620428        , -0.0000201406897288205397       , 4.11951387955684977e-6          , -6.9306727961715254e-7          , 9.93039410882836254e-8          , -1.24091407468145904e-8         , 1.37605213922461766e-9          , -1.37217497719984216e-10        , 1.24345562486065928e-11         , -1.03265914307723929e-12        , 7.91776241503079995e-14         , -5.72638537274260188e-15        , 3.79910663797319099e-16         , },
+/* x = 8.0         */  {0.000076062925647187041         , -0.0000480782349625973357       , 0.0000166045477875633457        , -4.08467426565241441e-6         , 7.92229310642839707e-7          , -1.2771933725936009e-7          , 1.76771270637699328e-8          , -2.1470291278603821e-9          , 2.32525793971837618e-10         , -2.2731429243174363e-11         , 2.02549805038647612e-12         , -1.65802658780920775e-13        , 1.25549800037325677e-14         , -8.97942323745835705e-16        , 5.90102191219703681e-17         , },
+/* x = 10.0        */  {0.0000231420869846935436        , -0.0000129157013641259281       , 4.02349590162825582e-6          , -9.09826968675094455e-7         , 1.64807904618781696e-7          , -2.51369254311271868e-8         , 3.32551852268163686e-9          , -3.89228287399605193e-10        , 4.08825809930734062e-11         , -3.89579113224881107e-12        , 3.3974577406937801e-13          , -2.73069894174239949e-14        , 2.03558726774096493e-15         , -1.43579682304784534e-16        , 9.3257049935512975e-18          , },
+/* x = 12.0        */  {8.13037951739754369e-6          , -3.97825401227642368e-6         , 1.10410539956087115e-6          , -2.26149065244154364e-7         , 3.7693371844315363e-8           , -5.36446474444182159e-9         , 6.70170581603721193e-10         , -7.48072423760530452e-11        , 7.55441100782513307e-12         , -6.96659203073113282e-13        , 5.91060272713302132e-14         , -4.64149056767741744e-15        , 3.39214491291788659e-16         , -2.35138752070179443e-17        , 1.50514259055903003e-18         , },
+/* x = 14.0        */  {3.24747671603966802e-6          , -1.39704316626712863e-6         , 3.44162419558418391e-7          , -6.33089996915794915e-8         , 9.59906061713649086e-9          , -1.2588956195985102e-9          , 1.46696740258408417e-10         , -1.54407341283996528e-11        , 1.48418715398514515e-12         , -1.31313264980224935e-13        , 1.07590850903544812e-14         , -8.20375179835098534e-16        , 5.84746077891901275e-17         , -3.9657694456835833e-18         , 2.49262915081018185e-19         , },
+/* x = 16.0        */  {1.4446028193104725e-6           , -5.51130508054361497e-7         , 1.20964091818052511e-7          , -1.99577438462054727e-8         , 2.73747968294065938e-9          , -3.28012348778915801e-10        , 3.52906333921841612e-11         , -3.46540629740965707e-12        , 3.13793411550543777e-13         , -2.63831435645459687e-14        , 2.06997569201881484e-15         , -1.52126778322519881e-16        , 1.05085019828928298e-17         , -6.93453736219400093e-19        , 4.26027506409738654e-20         , },
+/* x = 18.0        */  {7.01723197078999123e-7          , -2.39915756989196088e-7         , 4.72780731368474217e-8          , -7.02566530796171807e-9         , 8.72064746348793358e-10         , -9.5157420114688213e-11         , 9.3944328610672233e-12          , -8.53681051153469386e-13        , 7.2163560622637119e-14          , -5.71282352376493522e-15        , 4.25415013116129239e-16         , -2.98892422370937259e-17        , 1.9863739474045963e-18          , -1.2671396004199817e-19         , 7.56712167563994435e-21         , },
+/* x = 20.0        */  {3.66214554746091876e-7          , -1.13334070372771505e-7         , 2.02291999946283498e-8          , -2.72632755466100013e-9         , 3.07582425782304549e-10         , -3.06077949507211721e-11        , 2.76849398218141054e-12         , -2.31834068440991576e-13        , 1.8181762564389856e-14          , -1.34514626199451101e-15        , 9.4309478068735664e-17          , -6.28367079636820222e-18        , 3.98683009214517556e-19         , -2.44091193515136943e-20        , 1.40794202107825414e-21         , },
+/* x = 22.0        */  {2.02746022745546462e-7          , -5.72955581933866736e-8         , 9.34055167504872919e-9          , -1.15027586288166534e-9         , 1.18685534032783387e-10         , -1.08179149196079324e-11        , 8.98394516358546918e-13         , -6.93084993622346062e-14        , 5.02980600735668621e-15         , -3.46181863178037997e-16        , 2.27148856342514343e-17         , -1.42543546215548461e-18        , 8.572461222102875e-20           , -5.00099302085712548e-21        , 2.76745095986793179e-22         , },
+/* x = 24.0        */  {1.17917458224654922e-7          , -3.06582613795329803e-8         , 4.59860032749129741e-9          , -5.21128410636130392e-10        , 4.94956257238782552e-11         , -4.1553179034960356e-12         , 3.18188596382861575e-13         , -2.2672645990948582e-14         , 1.52351474343986231e-15         , -9.74166449231845353e-17        , 5.96328892241792849e-18         , -3.50822282960499963e-19        , 1.98849142415404367e-20         , -1.09837882865029676e-21        , 5.79373902650741021e-23         , },
+/* x = 26.0        */  {7.15030769043617177e-8          , -1.72136688931089961e-8         , 2.39076994322054077e-9          , -2.50877464631734074e-10        , 2.20664748759268106e-11         , -1.71599132849569188e-12        , 1.21765857454510136e-13         , -8.04639147950703067e-15        , 5.02036221226477408e-16         , -2.98609803208316982e-17        , 1.70464980980113335e-18         , -9.38272497817695856e-20        , 4.99519054615532898e-21         , -2.60057754468536607e-22        , 1.30058345487439592e-23         , },
+/* x = 28.0        */  {4.49368289306329178e-8          , -1.0072043478132124e-8          , 1.30241722246049244e-9          , -1.27246928727275872e-10        , 1.04209019456499368e-11         , -7.54580490523448604e-13        , 4.98656079329485896e-14         , -3.06967219538164547e-15        , 1.78514395949097902e-16         , -9.90538144181531541e-18        , 5.2821699230967279e-19          , -2.72108850238470226e-20        , 1.35921210540708601e-21         , -6.65373301913213315e-23        , 3.14374076279913874e-24         , },
+/* x = 30.0        */  {2.91298628890613816e-8          , -6.10787392150043348e-9         , 7.38855438691414658e-10         , -6.75297056202607882e-11        , 5.17362366662543361e-12         , -3.50466653657020408e-13        , 2.16678660242446307e-14         , -1.2480387981493847e-15         , 6.79238250779811791e-17         , -3.52856133306467093e-18        , 1.76275056742507014e-19         , -8.51532761968953559e-21        , 3.99428384180890251e-22         , -1.83806975999158825e-23        , 8.19179566805938465e-25         , },
+/* x = 32.0        */  {1.94021049425130671e-8          , -3.82162666051187465e-9         , 4.34275721581757384e-10         , -3.72862875628626409e-11        , 2.68347987580820453e-12         , -1.70766312944598186e-13        , 9.91814740826900144e-15         , -5.36682282519140626e-16        , 2.7442229632461681e-17          , -1.33957766954455388e-18        , 6.29001044504078408e-20         , -2.8572740473606292e-21         , 1.26121260412419384e-22         , -5.46292857100478902e-24        , 2.29702907332396963e-25         , },
+/* x = 34.0        */  {1.32357078277946484e-8          , -2.45806001615455361e-9         , 2.6336356865576163e-10          , -2.13199064375814747e-11        , 1.44670756153131673e-12         , -8.68023786309661849e-14        , 4.75345108154344898e-15         , -2.42521227195120886e-16        , 1.16927643442351289e-17         , -5.38213548525449383e-19        , 2.38326891916590314e-20         , -1.02116018857806212e-21        , 4.25295888187373541e-23         , -1.73786190310049285e-24        , 6.90407134323280322e-26         , },
+},
+/* n =    8 */
+{
+/* x = 0.0         */  {0.0241552941454041711           , -0.0213802796502142996          , 0.0095864680456573157           , -0.00289601806218019431         , 0.000661896904363618307         , -0.000121911256030400379        , 0.0000188284919164582632        , -2.50589979458368312e-6         , 2.9318383451313465e-7           , -3.0615165124873003e-8          , 2.88763715459215621e-9          , -2.48364671350520336e-10        , 1.96416011863041506e-11         , -1.46125454335956128e-12        , 9.93443761340947953e-14         , },
+/* x = 2.0         */  {0.00420781954637541653          , -0.00362431065341969052         , 0.00158956950392584678          , -0.000471523633250568619        , 0.000106133284866101793         , -0.0000192956979889534119       , 2.94698914706411171e-6          , -3.88428074496990122e-7         , 4.50600786386514666e-8          , -4.67008318745965149e-9         , 4.37549532923882936e-10         , -3.74090398908331533e-11        , 2.94254773940845291e-12         , -2.17818621126321338e-13        , 1.4743458517950851e-14          , },
+/* x = 4.0         */  {0.000774372158071863069         , -0.000642637968813620635        , 0.000273608720418666135         , -0.0000792269876416370827       , 0.0000174807387310876617        , -3.12541353302408999e-6         , 4.70610117745577577e-7          , -6.12776239496359457e-8         , 7.03390128756325115e-9          , -7.22300177395446293e-10        , 6.71251321754913156e-11         , -5.69768319607350725e-12        , 4.45289615708707875e-13         , -3.27662347942411688e-14        , 2.20633770867875024e-15         , },
+/* x = 6.0         */  {0.000153158817810324083         , -0.000120844138372928105        , 0.0000494341665546827664        , -0.0000138613455921678561       , 2.97911823263313207e-6          , -5.21183913118065441e-7         , 7.70589199332942811e-8          , -9.87965249506578836e-9         , 1.11910952520809488e-9          , -1.13607186744880487e-10        , 1.04524778227932875e-11         , -8.79436325898908086e-13        , 6.81956127298262449e-14         , -4.98235657179270736e-15        , 3.33416659146650064e-16         , },
+/* x = 8.0         */  {0.0000332090955751266909        , -0.000024508045593915236        , 9.5067517277141635e-6           , -2.55438674516021844e-6         , 5.3031381191074727e-7           , -9.01752236399552337e-8         , 1.3021444483323286e-8           , -1.63666177488684065e-9         , 1.82294742415713446e-10         , -1.82405536273604742e-11        , 1.65741504046829494e-12         , -1.37941242722386292e-13        , 1.05949154706189204e-14         , -7.67380757482049356e-16        , 5.09708185080309027e-17         , },
+/* x = 10.0        */  {8.04699180325651158e-6          , -5.45896181205068397e-6         , 1.97769485542539384e-6          , -5.02738508618323323e-7         , 9.97655556800847513e-8          , -1.63475881129853546e-8         , 2.28942453885160134e-9          , -2.80496784683262942e-10        , 3.05771069380808312e-11         , -3.00412250061668367e-12        , 2.68721959149538787e-13         , -2.20640666271657242e-14        , 1.67481248099299211e-15         , -1.2002493096690315e-16         , 7.90027828125233427e-18         , },
+/* x = 12.0        */  {2.2082107991217423e-6           , -1.35689439146494487e-6         , 4.52320462131786481e-7          , -1.0728929488816392e-7          , 2.01051174480542183e-8          , -3.14190418651899671e-9         , 4.23047016948706676e-10         , -5.01594344424600716e-11        , 5.31954044864063006e-12         , -5.10620318086010945e-13        , 4.47801642146647006e-14         , -3.6148844087655827e-15         , 2.70395661094241182e-16         , -1.91257137781578256e-17        , 1.2449692930914508e-18          , },
+/* x = 14.0        */  {6.88324839116836781e-7          , -3.79853998149479994e-7         , 1.15188727405638232e-7          , -2.51779123918605861e-8         , 4.40090220774302105e-9          , -6.48510834488910089e-10        , 8.31144807052445832e-11         , -9.45455048547924057e-12        , 9.68317335649957459e-13         , -9.02504556633512664e-14        , 7.71926743567844591e-15         , -6.0997545013762849e-16         , 4.4796656813229593e-17          , -3.11746580400395637e-18        , 2.00161069179291162e-19         , },
+/* x = 16.0        */  {2.41928183636105022e-7          , -1.19746463077233346e-7         , 3.28497561952879689e-8          , -6.56024697555994769e-9         , 1.05871900176400403e-9          , -1.45547064674879944e-10        , 1.75724310603517625e-11         , -1.89958556699474478e-12        , 1.86297759156051972e-13         , -1.67354848698959779e-14        , 1.38722426972933921e-15         , -1.06723528345720287e-16        , 7.65993198253776522e-18         , -5.22386562576307387e-19        , 3.29743917647282668e-20         , },
+/* x = 18.0        */  {9.45561462736948433e-8          , -4.21539918477703968e-8         , 1.04647769561855298e-8          , -1.90314840229058086e-9         , 2.81832985831758627e-10         , -3.58546041802782755e-11        , 4.04115939716214796e-12         , -4.11323160322552592e-13        , 3.82873421654476973e-14         , -3.2880834146765783e-15         , 2.62218670972691363e-16         , -1.95151669461726119e-17        , 1.36130440138506885e-18         , -9.0535136538688016e-20         , 5.59547057649529239e-21         , },
+/* x = 20.0        */  {4.04583999892566995e-8          , -1.63579653279660167e-8         , 3.69098910938765627e-9          , -6.12155899013848762e-10        , 8.3054819465396923e-11          , -9.73703088026819179e-12        , 1.0181787040094122e-12          , -9.6850506783713802e-14         , 8.48785144052076823e-15         , -6.91251945929474715e-16        , 5.2629201880735554e-17          , -3.76229227057447993e-18        , 2.53446714168563529e-19         , -1.63438697143477736e-20        , 9.8419236623163652e-22          , },
+/* x = 22.0        */  {1.86811033500974584e-8          , -6.90165517728999508e-9         , 1.42422640839340095e-9          , -2.16358298392049733e-10        , 2.6951835490748072e-11          , -2.910956974302955e-12          , 2.81669136486082734e-13         , -2.49250895851203438e-14        , 2.04433941591294041e-15         , -1.56807027974323325e-16        , 1.13162078915466678e-17         , -7.71525825594686745e-19        , 4.9853689234087012e-20          , -3.09755656563836931e-21        , 1.8072238638545373e-22          , },
+/* x = 24.0        */  {9.19720065498259482e-9          , -3.12677046381678296e-9         , 5.93947508686539122e-10         , -8.31063580698988661e-11        , 9.54565789148423699e-12         , -9.52251131838289937e-13        , 8.53168256469482348e-14         , -7.01399751909097569e-15        , 5.36695946770969191e-16         , -3.85922818337663216e-17        , 2.624916679352324e-18           , -1.69616284783366555e-19        , 1.04453295372399163e-20         , -6.21305355544245873e-22        , 3.49107681360311572e-23         , },
+/* x = 26.0        */  {4.78153988644108153e-9          , -1.50526478779040457e-9         , 2.64797698511121739e-10         , -3.43198265699091662e-11        , 3.65297572363497437e-12         , -3.37948442186007822e-13        , 2.81140283916138992e-14         , -2.14999038735785159e-15        , 1.53418471365780102e-16         , -1.03213889505011559e-17        , 6.59387264555407473e-19         , -4.01988959913858182e-20        , 2.3467356719238724e-21          , -1.32858977155234695e-22        , 7.14781454328179986e-24         , },
+/* x = 28.0        */  {2.60483444492098487e-9          , -7.63481572363655261e-10        , 1.25050823347799244e-10         , -1.50916098104679012e-11        , 1.49596823798838568e-12         , -1.28926232216737413e-13        , 9.99680617378965844e-15         , -7.13187418939010026e-16        , 4.75395267926862546e-17         , -2.99328709401157694e-18        , 1.79420827293491017e-19         , -1.02949787042222738e-20        , 5.67721567723740225e-22         , -3.045661793178247e-23          , 1.56108228692000425e-24         , },
+/* x = 30.0        */  {1.47771087738282932e-9          , -4.05178233721564737e-10        , 6.2083483999505204e-11          , -7.00933307314014422e-12        , 6.50035980727322072e-13         , -5.24176295249134265e-14        , 3.80373420451673832e-15         , -2.54056404921128477e-16        , 1.58647545183116512e-17         , -9.36708156776251529e-19        , 5.27256767068959062e-20         , -2.84647704112896598e-21        , 1.48051972369831501e-22         , -7.50668477377297613e-24        , 3.65265981306547826e-25         , },
+/* x = 32.0        */  {8.68551443163514767e-10         , -2.23717725377175848e-10        , 3.22017585096984545e-11         , -3.41532625889189377e-12        , 2.97544422248065812e-13         , -2.25406558665033347e-14        , 1.53676485945546996e-15         , -9.64495892763333055e-17        , 5.66100925275018924e-18         , -3.14306006852561541e-19        , 1.66482901355087585e-20         , -8.46675025181757777e-22        , 4.15450922252888028e-23         , -1.98934938717175621e-24        , 9.17241765074794882e-26         , },
+/* x = 34.0        */  {5.2672713731152326e-10          , -1.27919438625488849e-10        , 1.73604907383758008e-11         , -1.73604757261930382e-12        , 1.4260353244630233e-13          , -1.01858915423938861e-14        , 6.54794803287296261e-16         , -3.87513746607445576e-17        , 2.14494198745420513e-18         , -1.12329286892025109e-19        , 5.61398213334413559e-21         , -2.69531210999484649e-22        , 1.24951735951060377e-23         , -5.65466194265214433e-25        , 2.46987792177836763e-26         , },
+},
+/* n =   16 */
+{
+/* x = 0.0         */  {0.0118211722343218805           , -0.011109621280589872           , 0.00523932591230076216          , -0.00165255636156767878         , 0.000392057238238153641         , -0.0000746036718971820302       , 0.000011857990145333345         , -1.61899200906259309e-6         , 1.93792011870853271e-7          , -2.06563827631796514e-8         , 1.98487020984561715e-9          , -1.73625862493842418e-10        , 1.39445373482429096e-11         , -1.05263747169786156e-12        , 7.24964992363976749e-14         , },
+/* x = 2.0         */  {0.00181682237465016242          , -0.00169467833259857008         , 0.000793889439423832403         , -0.000248909726374967293        , 0.0000587347750269694129        , -0.0000111221531372978678       , 1.76000968041066161e-6          , -2.3932689289491159e-7          , 2.85411966118495055e-8          , -3.03186057566220623e-9         , 2.90415644387496199e-10         , -2.53301347314846129e-11        , 2.0288609496597098e-12          , -1.52756738457422718e-13        , 1.04960112402985499e-14         , },
+/* x = 4.0         */  {0.000283606900498828687         , -0.000262108071737588048        , 0.000121791775586505578         , -0.0000379107399052624121       , 8.888192244777797e-6            , -1.6733618081828307e-6          , 2.63416657078795577e-7          , -3.56498547924178043e-8         , 4.23311170801694799e-9          , -4.47897013788040175e-10        , 4.27475318756904878e-11         , -3.71599930721787589e-12        , 2.96720013039255625e-13         , -2.22747285408575597e-14        , 1.52646186189458116e-15         , },
+/* x = 6.0         */  {0.000045122496143749399         , -0.0000412257433706581529       , 0.0000189649661578042396        , -5.85149440622567302e-6         , 1.36121346875712939e-6          , -2.5449529030438509e-7          , 3.98128702769985346e-8          , -5.35792275570999753e-9         , 6.32976867031645365e-10         , -6.6664714992963188e-11         , 6.3356829767490815e-12          , -5.48626366505514557e-13        , 4.36516492250207888e-14         , -3.2658524327795488e-15         , 2.23129562408448907e-16         , },
+/* x = 8.0         */  {7.35012402738805108e-6          , -6.61912715650700948e-6         , 3.00721239975182554e-6          , -9.17814013842109442e-7         , 2.11478414704603991e-7          , -3.9205998140889104e-8          , 6.0874341293925561e-9           , -8.13746267319002495e-10        , 9.55555726767186461e-11         , -1.00090462619328367e-11        , 9.46537011272797041e-13         , -8.15943352207772579e-14        , 6.46530486514443052e-15         , -4.81824534743477131e-16        , 3.28050579478724046e-17         , },
+/* x = 10.0        */  {1.23286895375631469e-6          , -1.09013521289603326e-6         , 4.87568901388988536e-7          , -1.46806044791955312e-7         , 3.34297607785492729e-8          , -6.13378174854075613e-9         , 9.43725570185945394e-10         , -1.2513535014026264e-10         , 1.45882497413281704e-11         , -1.51816065875055777e-12        , 1.42730606787613993e-13         , -1.22386721485216979e-14        , 9.65083340208718344e-16         , -7.15967254748404269e-17        , 4.8551126609534943e-18          , },
+/* x = 12.0        */  {2.14483871200574935e-7          , -1.85293782409150755e-7         , 8.12490957180619375e-8          , -2.40519466420210573e-8         , 5.3971572231605465e-9           , -9.7771580149413116e-10         , 1.48754494052367519e-10         , -1.9530801203849187e-11         , 2.25706539627096069e-12         , -2.33061937909262494e-13        , 2.17588075062262145e-14         , -1.85404397500004105e-15        , 1.45371028702687352e-16         , -1.0727460945869251e-17         , 7.24049393933295844e-19         , },
+/* x = 14.0        */  {3.90425550223492089e-8          , -3.27500665078566098e-8         , 1.40058334545525893e-8          , -4.05849641741679811e-9         , 8.94147001630208025e-10         , -1.59427313642058662e-10        , 2.39232693463603416e-11         , -3.1032513524892938e-12         , 3.5482462125097219e-13          , -3.62946344572202673e-14        , 3.36013530036457369e-15         , -2.84169450692621849e-16        , 2.21308807224233142e-17         , -1.62290211316367861e-18        , 1.0893663035419297e-19          , },
+/* x = 16.0        */  {7.51152565701356939e-9          , -6.07296969098812222e-9         , 2.5169788528931262e-9           , -7.10083617285453198e-10        , 1.52892388795283041e-10         , -2.67271405363400026e-11        , 3.94251094682360335e-12         , -5.03839736093377638e-13        , 5.68614173246585323e-14         , -5.74980570464891812e-15        , 5.26924611659628343e-16         , -4.41611232998766197e-17        , 3.41151990413535745e-18         , -2.48313889017161465e-19        , 1.65598226925757451e-20         , },
+/* x = 18.0        */  {1.54374563739661198e-9          , -1.19317919990923509e-9         , 4.7576941525376258e-10          , -1.2984272057561373e-10         , 2.7171491422321625e-11          , -4.63463840401176164e-12        , 6.69295969552470996e-13         , -8.39723941241138191e-14        , 9.32577819778041807e-15         , -9.2983953096492153e-16         , 8.41631356431323629e-17         , -6.97677674930653857e-18        , 5.33741248523095158e-19         , -3.85038884707757105e-20        , 2.54795405012151443e-21         , },
+/* x = 20.0        */  {3.42230170298596546e-10         , -2.50841418501488007e-10        , 9.54904000566772486e-11         , -2.5031879211915535e-11         , 5.05873382221943587e-12         , -8.37209928237759286e-13        , 1.17782645068944511e-13         , -1.44458694648718341e-14        , 1.57294118599372303e-15         , -1.54148689146994977e-16        , 1.37429284910819557e-17         , -1.1241480395374241e-18         , 8.49916025170138981e-20         , -6.06567827697005837e-21        , 3.97676354619655455e-22         , },
+/* x = 22.0        */  {8.24277652874166744e-11         , -5.69021186558202503e-11        , 2.05321234417031495e-11         , -5.13318238539484731e-12        , 9.95059675602715388e-13         , -1.58789841392010288e-13        , 2.16406034197201634e-14         , -2.58168026618608653e-15        , 2.7439701195725392e-16          , -2.63293512168144143e-17        , 2.30436220405905936e-18         , -1.85456984625019452e-19        , 1.38221360113733017e-20         , -9.73718962519400206e-22        , 6.31280775811210967e-23         , },
+/* x = 24.0        */  {2.16395805806685697e-11         , -1.40043643059419761e-11        , 4.76264806843005127e-12         , -1.12849337732951153e-12        , 2.08482922025120971e-13         , -3.18765419015198903e-14        , 4.18319478739365164e-15         , -4.82728440371586679e-16        , 4.98317307650974012e-17         , -4.66069543821024347e-18        , 3.98847914995088672e-19         , -3.14725206135109511e-20        , 2.30523076626150069e-21         , -1.59860861362472329e-22        , 1.02249451477789564e-23         , },
+/* x = 26.0        */  {6.18583276677421767e-12         , -3.74542504605574268e-12        , 1.19639210921677693e-12         , -2.67449034770065723e-13        , 4.6839155339241397e-14          , -6.82256173418447022e-15        , 8.57121649478965688e-16         , -9.51323213491461254e-17        , 9.48679797036595788e-18         , -8.60572043135062967e-19        , 7.16846068653634316e-20         , -5.52356825781414007e-21        , 3.96173779396484646e-22         , -2.69568084530082037e-23        , 1.69629956062422067e-24         , },
+/* x = 28.0        */  {1.91679372054340993e-12         , -1.08620390022749718e-12        , 3.25541120200213004e-13         , -6.84933227875800837e-14        , 1.13312291433592945e-14         , -1.56545444143265143e-15        , 1.87341435657016793e-16         , -1.98942800419664355e-17        , 1.90638277178898985e-18         , -1.66866090350936354e-19        , 1.34641434024249643e-20         , -1.00853028321396035e-21        , 7.05435518226071699e-23         , -4.69201648089419366e-24        , 2.89521700152055209e-25         , },
+/* x = 30.0        */  {6.39666902234268643e-13         , -3.39912629074938155e-13        , 9.56654616656301258e-14         , -1.8937686538096485e-14         , 2.95496900458998186e-15         , -3.86191495892454475e-16        , 4.38692506209098749e-17         , -4.43848869504831628e-18        , 4.06811808562669551e-19         , -3.41935423971095343e-20        , 2.65968549081657311e-21         , -1.92764777717717048e-22        , 1.30912488472075069e-23         , -8.47603644287530351e-25        , 5.10954696394796267e-26         , },
+/* x = 32.0        */  {2.28251893083613099e-13         , -1.14055357357789832e-13        , 3.02066562225571265e-14         , -5.63291331900029518e-15        , 8.29193706124348706e-16         , -1.02432793015503024e-16        , 1.10247122435686799e-17         , -1.05982981674130792e-18        , 9.25901879405410626e-20         , -7.44338850544100715e-21        , 5.55718388963489326e-22         , -3.87976235113342025e-23        , 2.54696002962444276e-24         , -1.59829637369896465e-25        , 9.37489321830643005e-27         , },
+/* x = 34.0        */  {8.64840609372475931e-14         , -4.07620499893307983e-14        , 1.01860088425040231e-14         , -1.79317653016495623e-15        , 2.4938856927534854e-16          , -2.91390286299083836e-17        , 2.97077135028215906e-18         , -2.71038775546166577e-19        , 2.25245016620270454e-20         , -1.72708437289274301e-21        , 1.23348250981207318e-22         , -8.26400381885099026e-24        , 5.22298650513899487e-25         , -3.16345958450698585e-26        , 1.79813956128477587e-27         , },
+},
+};
+
+extern const int boys_piecewise_order[6] = 
+{
+  0,
+  2,
+  4,
+  6,
+  8,
+  16,
+};
+
+extern const int boys_piecewise_start[17] = 
+{
+/* n =    0 */  0,
+/* n =    1 */  1,
+/* n =    2 */  1,
+/* n =    3 */  2,
+/* n =    4 */  2,
+/* n =    5 */  3,
+/* n =    6 */  3,
+/* n =    7 */  4,
+/* n =    8 */  4,
+/* n =    9 */  5,
+/* n =   10 */  5,
+/* n =   11 */  5,
+/* n =   12 */  5,
+/* n =   13 */  5,
+/* n =   14 */  5,
+/* n =   15 */  5,
+/* n =   16 */  5,
+};
+
+extern const double boys_piecewise_inv2np1[17] = 
+{
+/* n =    0 */  1.0                             ,
+/* n =    1 */  0.333333333333333333            ,
+/* n =    2 */  0.2                             ,
+/* n =    3 */  0.142857142857142857            ,
+/* n =    4 */  0.111111111111111111            ,
+/* n =    5 */  0.0909090909090909091           ,
+/* n =    6 */  0.0769230769230769231           ,
+/* n =    7 */  0.0666666666666666667           ,
+/* n =    8 */  0.0588235294117647059           ,
+/* n =    9 */  0.0526315789473684211           ,
+/* n =   10 */  0.047619047619047619            ,
+/* n =   11 */  0.0434782608695652174           ,
+/* n =   12 */  0.04                            ,
+/* n =   13 */  0.037037037037037037            ,
+/* n =   14 */  0.0344827586206896552           ,
+/* n =   15 */  0.0322580645161290323           ,
+/* n =   16 */  0.030303030303030303            ,
+};
+
+} // closing namespace lut
+} // closing namespace integrals
+} // closing namespace psr_modules
+
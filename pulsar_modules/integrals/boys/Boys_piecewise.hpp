@@ -0,0 +1,34 @@
+#pragma once
+
+#define PSR_MODULES_BOYS_PIECEWISE_N 16
+#define PSR_MODULES_BOYS_PIECEWISE_NANCHOR 6
+#define PSR_MODULES_BOYS_PIECEWISE_MAXX 36.0
+#define PSR_MODULES_BOYS_PIECEWISE_SPACE 2.0
+#define PSR_MODULES_BOYS_PIECEWISE_NSEG 18
+#define PSR_MODULES_BOYS_PIECEWISE_ORDER 14
+#define PSR_MODULES_BOYS_PIECEWISE_LOOKUPFAC 0.5
+
+namespace psr_modules {
+namespace integrals {
+namespace lut {
+
+/*! Piecewise polynomial fits of F(n, x) for the anchor orders
+ *
+ * Stored as [anchor][segment][coefficient]. Segment s covers [s*SPACE, (s+1)*SPACE).
+ * The coefficients are in the power basis of u = x - (s+0.5)*SPACE, lowest power first.
+ */
+extern const double boys_piecewise[PSR_MODULES_BOYS_PIECEWISE_NANCHOR][PSR_MODULES_BOYS_PIECEWISE_NSEG][PSR_MODULES_BOYS_PIECEWISE_ORDER+1];
+
+/*! The order n of each anchor */
+extern const int boys_piecewise_order[PSR_MODULES_BOYS_PIECEWISE_NANCHOR];
+
+/*! For each n, the anchor to start the downward recursion from */
+extern const int boys_piecewise_start[PSR_MODULES_BOYS_PIECEWISE_N+1];
+
+/*! Values of 1/(2n+1), used in the downward recursion */
+extern const double boys_piecewise_inv2np1[PSR_MODULES_BOYS_PIECEWISE_N+1];
+
+} // closing namespace lut
+} // closing namespace integrals
+} // closing namespace psr_modules
+
@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+
+#######################################
+# Generates piecewise polynomial fits
+# of the boys function to arbitrary precision
+#
+# Only a few orders (the anchors) are fitted. The
+# orders in between are obtained via downward
+# recursion (Eqn. 9.8.13 from Helgaker et al)
+# from the next anchor above
+#
+#   Fn(x) = (2x F(n+1)(x) + exp(-x)) / (2n+1)
+#
+# The range [0, max-x) is split into segments of equal
+# width. On each segment, each anchor is interpolated at
+# the Chebyshev nodes, and the resulting polynomial
+# is stored in the power basis of u = x - (segment center),
+# so that it can be evaluated with Horner's rule.
+#######################################
+
+import argparse
+import sys
+from mpmath import mp # arbitrary-precision math
+
+
+# A slow but accurate way of calculating the boys function
+# via the incomplete gamma function
+def BoysValue(n, x):
+    if x == mp.mpf("0"):
+        return mp.mpf(1.0)/(mp.mpf(2.0*n+1))
+    else:
+        N = n+mp.mpf("0.5")
+        return mp.gammainc(N, 0, x) * 1.0/(2.0 * mp.power(x, N))
+
+
+# Coefficients of the Chebyshev polynomials T_j in the power basis
+def ChebyshevPowerCoefficients(order):
+    T = [ [mp.mpf(1)], [mp.mpf(0), mp.mpf(1)] ]
+    for j in range(2, order+1):
+        p = [mp.mpf(0)]*(j+1)
+        for i,v in enumerate(T[j-1]):
+            p[i+1] += 2*v
+        for i,v in enumerate(T[j-2]):
+            p[i] -= v
+        T.append(p)
+    return T[:order+1]
+
+
+# Fit one segment [center-halfwidth, center+halfwidth]
+# Returns the coefficients in the power basis of u = x - center
+def FitSegment(n, center, halfwidth, order, T):
+    npts = order+1
+    nodes = [ mp.cos(mp.pi*(k+mp.mpf("0.5"))/npts) for k in range(npts) ]
+    vals = [ BoysValue(n, center + halfwidth*t) for t in nodes ]
+
+    cheb = []
+    for j in range(npts):
+        cheb.append(2*mp.fsum(vals[k]*mp.cos(mp.pi*j*(k+mp.mpf("0.5"))/npts) for k in range(npts))/npts)
+    cheb[0] /= 2
+
+    # convert to power basis in t = u/halfwidth, then in u
+    power = [mp.mpf(0)]*npts
+    for j in range(npts):
+        for i,v in enumerate(T[j]):
+            power[i] += cheb[j]*v
+
+    return [ power[i]/mp.power(halfwidth, i) for i in range(npts) ]
+
+
+
+# Note that types are being stored as a string. This is so mpmath
+# can parse it without turning it into a (possibly) lesser-precision float
+parser = argparse.ArgumentParser()
+parser.add_argument("--filename", type=str, required=True,               help="Output file name base (no extension)")
+parser.add_argument("--max-n",    type=int, required=True,               help="Maximum n value to go to")
+parser.add_argument("--anchors",  type=str, required=False, default=None, help="Comma-separated orders to fit (default: only max-n)")
+parser.add_argument("--max-x",    type=str, required=True,               help="Cutoff for the x value")
+parser.add_argument("--spacing",  type=str, required=True,               help="Width of each segment")
+parser.add_argument("--order",    type=int, required=True,               help="Order of the polynomial on each segment")
+parser.add_argument("--dps",      type=int, required=False, default=256, help="Decimal precision/sig figs to use/calculate")
+parser.add_argument("--ncheck",   type=int, required=False, default=20,  help="Number of points per segment to check the fit at")
+args = parser.parse_args()
+
+# Set the dps option
+mp.dps = args.dps
+
+# Convert stuff to mpmath
+inc = mp.mpf(args.spacing)
+maxx = mp.mpf(args.max_x)
+maxn = args.max_n
+order = args.order
+nseg = int(mp.ceil(maxx / inc))
+T = ChebyshevPowerCoefficients(order)
+
+anchors = [maxn]
+if args.anchors:
+    anchors = sorted(set(int(a) for a in args.anchors.split(",")))
+if anchors[-1] != maxn or anchors[0] < 0:
+    raise RuntimeError("The anchors must be in [0, max-n] and include max-n")
+
+# For each n, the anchor that the recursion starts from
+# (the lowest one at or above n)
+startanchor = [ min(a for a in range(len(anchors)) if anchors[a] >= n) for n in range(maxn+1) ]
+
+coefs = []
+worst = mp.mpf(0)
+
+for n in anchors:
+    anchorcoefs = []
+    for s in range(nseg):
+        center = inc*s + inc/2
+        c = FitSegment(n, center, inc/2, order, T)
+        anchorcoefs.append(c)
+
+        # check the fit, using the coefficients as they will be stored (ie, as doubles)
+        cd = [ mp.mpf(float(v)) for v in c ]
+        for k in range(args.ncheck+1):
+            u = -inc/2 + inc*k/args.ncheck
+            val = mp.mpf(0)
+            for v in reversed(cd):
+                val = val*u + v
+            ref = BoysValue(n, center+u)
+            worst = max(worst, abs((val-ref)/ref))
+    coefs.append(anchorcoefs)
+
+
+# Output to file
+with open(args.filename + ".cpp", 'w') as f:
+  f.write("/*\n")
+  f.write(" Generated with:\n")
+  f.write("   " + " ".join(sys.argv[:]))
+  f.write("\n")
+  f.write("------------------------------------\n")
+  f.write("Options for piecewise fit of Boys function Fn(x):\n")
+  f.write("    Max n: {}\n".format(maxn))
+  f.write("  Anchors: {}\n".format(",".join(str(a) for a in anchors)))
+  f.write("    Max x: {}\n".format(maxx))
+  f.write("  Spacing: {}\n".format(inc))
+  f.write(" Segments: {}\n".format(nseg))
+  f.write("    Order: {}\n".format(order))
+  f.write("      DPS: {}\n".format(args.dps))
+  f.write("  Max rel. error of fit: {}\n".format(mp.nstr(worst, 4)))
+  f.write("------------------------------------\n")
+  f.write("*/\n\n")
+
+  f.write("namespace psr_modules {\n")
+  f.write("namespace integrals {\n")
+  f.write("namespace lut {\n")
+
+  f.write("\n")
+  f.write("extern const double boys_piecewise[{}][{}][{}] = \n".format(len(anchors), nseg, order+1))
+  f.write("{\n")
+
+  for a,anchorcoefs in enumerate(coefs):
+    f.write("/* n = {:4} */\n".format(anchors[a]))
+    f.write("{\n")
+    for s,c in enumerate(anchorcoefs):
+      f.write("/* x = {:12}*/  {{".format(mp.nstr(inc*s, 4)))
+      for v in c:
+        f.write("{:32}, ".format(mp.nstr(v, 18)))
+      f.write("},\n")
+    f.write("},\n")
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("extern const int boys_piecewise_order[{}] = \n".format(len(anchors)))
+  f.write("{\n")
+  for a in anchors:
+      f.write("  {},\n".format(a))
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("extern const int boys_piecewise_start[{}] = \n".format(maxn+1))
+  f.write("{\n")
+  for n in range(maxn+1):
+      f.write("/* n = {:4} */  {},\n".format(n, startanchor[n]))
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("extern const double boys_piecewise_inv2np1[{}] = \n".format(maxn+1))
+  f.write("{\n")
+  for i in range(maxn+1):
+      f.write("/* n = {:4} */  {:32},\n".format(i, mp.nstr(mp.mpf(1)/(2*i+1), 18)))
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("} // closing namespace lut\n")
+  f.write("} // closing namespace integrals\n")
+  f.write("} // closing namespace psr_modules\n")
+  f.write("\n")
+
+with open(args.filename + ".hpp", 'w') as f:
+  f.write("#pragma once\n")
+  f.write("\n")
+  f.write("#define PSR_MODULES_BOYS_PIECEWISE_N {}\n".format(maxn))
+  f.write("#define PSR_MODULES_BOYS_PIECEWISE_NANCHOR {}\n".format(len(anchors)))
+  f.write("#define PSR_MODULES_BOYS_PIECEWISE_MAXX {}\n".format(maxx))
+  f.write("#define PSR_MODULES_BOYS_PIECEWISE_SPACE {}\n".format(inc))
+  f.write("#define PSR_MODULES_BOYS_PIECEWISE_NSEG {}\n".format(nseg))
+  f.write("#define PSR_MODULES_BOYS_PIECEWISE_ORDER {}\n".format(order))
+  f.write("#define PSR_MODULES_BOYS_PIECEWISE_LOOKUPFAC {}\n".format(1.0/inc))
+  f.write("\n")
+
+  f.write("namespace psr_modules {\n")
+  f.write("namespace integrals {\n")
+  f.write("namespace lut {\n")
+  f.write("\n")
+
+  f.write("/*! Piecewise polynomial fits of F(n, x) for the anchor orders\n")
+  f.write(" *\n")
+  f.write(" * Stored as [anchor][segment][coefficient]. Segment s covers [s*SPACE, (s+1)*SPACE).\n")
+  f.write(" * The coefficients are in the power basis of u = x - (s+0.5)*SPACE, lowest power first.\n")
+  f.write(" */\n")
+  f.write("extern const double boys_piecewise[PSR_MODULES_BOYS_PIECEWISE_NANCHOR][PSR_MODULES_BOYS_PIECEWISE_NSEG][PSR_MODULES_BOYS_PIECEWISE_ORDER+1];\n")
+  f.write("\n")
+  f.write("/*! The order n of each anchor */\n")
+  f.write("extern const int boys_piecewise_order[PSR_MODULES_BOYS_PIECEWISE_NANCHOR];\n")
+  f.write("\n")
+  f.write("/*! For each n, the anchor to start the downward recursion from */\n")
+  f.write("extern const int boys_piecewise_start[PSR_MODULES_BOYS_PIECEWISE_N+1];\n")
+  f.write("\n")
+  f.write("/*! Values of 1/(2n+1), used in the downward recursion */\n")
+  f.write("extern const double boys_piecewise_inv2np1[PSR_MODULES_BOYS_PIECEWISE_N+1];\n")
+
+  f.write("\n")
+  f.write("} // closing namespace lut\n")
+  f.write("} // closing namespace integrals\n")
+  f.write("} // closing namespace psr_modules\n")
+  f.write("\n")
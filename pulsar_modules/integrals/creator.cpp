@@ -2,10 +2,15 @@
 #include "Integrals/OSDipole.hpp"
 #include "Integrals/OSKineticEnergy.hpp"
 #include "Integrals/OSOneElectronPotential.hpp"
+#include "Integrals/OSOneElectronFused.hpp"
 
 #include "Integrals/OneElectronIntegralSum.hpp"
 #include "Integrals/OneElectronProperty.hpp"
 #include "Integrals/ReferenceERI.hpp"
+#include "Integrals/HGPERI.hpp"
+#include "Integrals/RysERI.hpp"
+#include "Integrals/ERIBenchmark.hpp"
+#include "Integrals/ERIValidation.hpp"
 #include "Integrals/OneElectron_Eigen.hpp"
 #include "Integrals/NuclearRepulsion.hpp"
 #include "Integrals/NuclearDipole.hpp"
@@ -19,10 +24,15 @@ ModuleCreationFuncs insert_supermodule(void)
 {
     ModuleCreationFuncs cf;
     cf.add_cpp_creator<ReferenceERI>("ReferenceERI");
+    cf.add_cpp_creator<HGPERI>("HGPERI");
+    cf.add_cpp_creator<RysERI>("RysERI");
+    cf.add_cpp_creator<ERIBenchmark>("ERIBenchmark");
+    cf.add_cpp_creator<ERIValidation>("ERIValidation");
     cf.add_cpp_creator<OSOverlap>("OSOverlap");
     cf.add_cpp_creator<OSDipole>("OSDipole");
     cf.add_cpp_creator<OSKineticEnergy>("OSKineticEnergy");
     cf.add_cpp_creator<OSOneElectronPotential>("OSOneElectronPotential");
+    cf.add_cpp_creator<OSOneElectronFused>("OSOneElectronFused");
     cf.add_cpp_creator<OneElectronIntegralSum>("OneElectronIntegralSum");
     cf.add_cpp_creator<OneElectronProperty>("OneElectronProperty");
     cf.add_cpp_creator<OneElectron_Eigen>("OneElectron_Eigen");
@@ -0,0 +1,10297 @@
+/*
+ Generated with:
+   ./gen_potential.py --filename Potential_kernels --max-am 4
+------------------------------------
+Unrolled Obara-Saika kernels for the
+potential integrals
+    Max AM: 4
+------------------------------------
+*/
+
+#include "Integrals/potential/Potential_kernels.hpp"
+
+namespace {
+
+void potential_kernel_0_0(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+
+        sum_0 += q[l]*v_000_000_0;
+    }
+
+    acc[0] += sum_0;
+}
+
+
+void potential_kernel_0_1(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+
+        sum_0 += q[l]*v_000_100_0;
+        sum_1 += q[l]*v_000_010_0;
+        sum_2 += q[l]*v_000_001_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+}
+
+
+void potential_kernel_0_2(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_000_100_1 = PB[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_000_200_0 = PB[0]*v_000_100_0 - PC0[l]*v_000_100_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_010_1 = PB[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_000_110_0 = PB[0]*v_000_010_0 - PC0[l]*v_000_010_1;
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_000_001_1 = PB[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_000_101_0 = PB[0]*v_000_001_0 - PC0[l]*v_000_001_1;
+        const double v_000_020_0 = PB[1]*v_000_010_0 - PC1[l]*v_000_010_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_011_0 = PB[1]*v_000_001_0 - PC1[l]*v_000_001_1;
+        const double v_000_002_0 = PB[2]*v_000_001_0 - PC2[l]*v_000_001_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+
+        sum_0 += q[l]*v_000_200_0;
+        sum_1 += q[l]*v_000_110_0;
+        sum_2 += q[l]*v_000_101_0;
+        sum_3 += q[l]*v_000_020_0;
+        sum_4 += q[l]*v_000_011_0;
+        sum_5 += q[l]*v_000_002_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+}
+
+
+void potential_kernel_0_3(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_000_100_1 = PB[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_000_200_0 = PB[0]*v_000_100_0 - PC0[l]*v_000_100_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_000_100_2 = PB[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_000_200_1 = PB[0]*v_000_100_1 - PC0[l]*v_000_100_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_300_0 = PB[0]*v_000_200_0 - PC0[l]*v_000_200_1 + 2*oo2p*(v_000_100_0 - v_000_100_1);
+        const double v_000_210_0 = PB[1]*v_000_200_0 - PC1[l]*v_000_200_1;
+        const double v_000_201_0 = PB[2]*v_000_200_0 - PC2[l]*v_000_200_1;
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_010_1 = PB[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_000_020_0 = PB[1]*v_000_010_0 - PC1[l]*v_000_010_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_010_2 = PB[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_000_020_1 = PB[1]*v_000_010_1 - PC1[l]*v_000_010_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_120_0 = PB[0]*v_000_020_0 - PC0[l]*v_000_020_1;
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_000_001_1 = PB[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_000_011_0 = PB[1]*v_000_001_0 - PC1[l]*v_000_001_1;
+        const double v_000_001_2 = PB[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_000_011_1 = PB[1]*v_000_001_1 - PC1[l]*v_000_001_2;
+        const double v_000_111_0 = PB[0]*v_000_011_0 - PC0[l]*v_000_011_1;
+        const double v_000_002_0 = PB[2]*v_000_001_0 - PC2[l]*v_000_001_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_002_1 = PB[2]*v_000_001_1 - PC2[l]*v_000_001_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_102_0 = PB[0]*v_000_002_0 - PC0[l]*v_000_002_1;
+        const double v_000_030_0 = PB[1]*v_000_020_0 - PC1[l]*v_000_020_1 + 2*oo2p*(v_000_010_0 - v_000_010_1);
+        const double v_000_021_0 = PB[2]*v_000_020_0 - PC2[l]*v_000_020_1;
+        const double v_000_012_0 = PB[1]*v_000_002_0 - PC1[l]*v_000_002_1;
+        const double v_000_003_0 = PB[2]*v_000_002_0 - PC2[l]*v_000_002_1 + 2*oo2p*(v_000_001_0 - v_000_001_1);
+
+        sum_0 += q[l]*v_000_300_0;
+        sum_1 += q[l]*v_000_210_0;
+        sum_2 += q[l]*v_000_201_0;
+        sum_3 += q[l]*v_000_120_0;
+        sum_4 += q[l]*v_000_111_0;
+        sum_5 += q[l]*v_000_102_0;
+        sum_6 += q[l]*v_000_030_0;
+        sum_7 += q[l]*v_000_021_0;
+        sum_8 += q[l]*v_000_012_0;
+        sum_9 += q[l]*v_000_003_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+}
+
+
+void potential_kernel_0_4(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_000_100_1 = PB[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_000_200_0 = PB[0]*v_000_100_0 - PC0[l]*v_000_100_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_000_100_2 = PB[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_000_200_1 = PB[0]*v_000_100_1 - PC0[l]*v_000_100_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_300_0 = PB[0]*v_000_200_0 - PC0[l]*v_000_200_1 + 2*oo2p*(v_000_100_0 - v_000_100_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_000_100_3 = PB[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_000_200_2 = PB[0]*v_000_100_2 - PC0[l]*v_000_100_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_300_1 = PB[0]*v_000_200_1 - PC0[l]*v_000_200_2 + 2*oo2p*(v_000_100_1 - v_000_100_2);
+        const double v_000_400_0 = PB[0]*v_000_300_0 - PC0[l]*v_000_300_1 + 3*oo2p*(v_000_200_0 - v_000_200_1);
+        const double v_000_310_0 = PB[1]*v_000_300_0 - PC1[l]*v_000_300_1;
+        const double v_000_301_0 = PB[2]*v_000_300_0 - PC2[l]*v_000_300_1;
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_010_1 = PB[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_000_020_0 = PB[1]*v_000_010_0 - PC1[l]*v_000_010_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_010_2 = PB[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_000_020_1 = PB[1]*v_000_010_1 - PC1[l]*v_000_010_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_120_0 = PB[0]*v_000_020_0 - PC0[l]*v_000_020_1;
+        const double v_000_010_3 = PB[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_000_020_2 = PB[1]*v_000_010_2 - PC1[l]*v_000_010_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_120_1 = PB[0]*v_000_020_1 - PC0[l]*v_000_020_2;
+        const double v_000_220_0 = PB[0]*v_000_120_0 - PC0[l]*v_000_120_1 + 1*oo2p*(v_000_020_0 - v_000_020_1);
+        const double v_000_201_0 = PB[2]*v_000_200_0 - PC2[l]*v_000_200_1;
+        const double v_000_201_1 = PB[2]*v_000_200_1 - PC2[l]*v_000_200_2;
+        const double v_000_211_0 = PB[1]*v_000_201_0 - PC1[l]*v_000_201_1;
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_000_001_1 = PB[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_000_002_0 = PB[2]*v_000_001_0 - PC2[l]*v_000_001_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_001_2 = PB[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_000_002_1 = PB[2]*v_000_001_1 - PC2[l]*v_000_001_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_102_0 = PB[0]*v_000_002_0 - PC0[l]*v_000_002_1;
+        const double v_000_001_3 = PB[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_000_002_2 = PB[2]*v_000_001_2 - PC2[l]*v_000_001_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_102_1 = PB[0]*v_000_002_1 - PC0[l]*v_000_002_2;
+        const double v_000_202_0 = PB[0]*v_000_102_0 - PC0[l]*v_000_102_1 + 1*oo2p*(v_000_002_0 - v_000_002_1);
+        const double v_000_030_0 = PB[1]*v_000_020_0 - PC1[l]*v_000_020_1 + 2*oo2p*(v_000_010_0 - v_000_010_1);
+        const double v_000_030_1 = PB[1]*v_000_020_1 - PC1[l]*v_000_020_2 + 2*oo2p*(v_000_010_1 - v_000_010_2);
+        const double v_000_130_0 = PB[0]*v_000_030_0 - PC0[l]*v_000_030_1;
+        const double v_000_021_0 = PB[2]*v_000_020_0 - PC2[l]*v_000_020_1;
+        const double v_000_021_1 = PB[2]*v_000_020_1 - PC2[l]*v_000_020_2;
+        const double v_000_121_0 = PB[0]*v_000_021_0 - PC0[l]*v_000_021_1;
+        const double v_000_012_0 = PB[1]*v_000_002_0 - PC1[l]*v_000_002_1;
+        const double v_000_012_1 = PB[1]*v_000_002_1 - PC1[l]*v_000_002_2;
+        const double v_000_112_0 = PB[0]*v_000_012_0 - PC0[l]*v_000_012_1;
+        const double v_000_003_0 = PB[2]*v_000_002_0 - PC2[l]*v_000_002_1 + 2*oo2p*(v_000_001_0 - v_000_001_1);
+        const double v_000_003_1 = PB[2]*v_000_002_1 - PC2[l]*v_000_002_2 + 2*oo2p*(v_000_001_1 - v_000_001_2);
+        const double v_000_103_0 = PB[0]*v_000_003_0 - PC0[l]*v_000_003_1;
+        const double v_000_040_0 = PB[1]*v_000_030_0 - PC1[l]*v_000_030_1 + 3*oo2p*(v_000_020_0 - v_000_020_1);
+        const double v_000_031_0 = PB[2]*v_000_030_0 - PC2[l]*v_000_030_1;
+        const double v_000_022_0 = PB[1]*v_000_012_0 - PC1[l]*v_000_012_1 + 1*oo2p*(v_000_002_0 - v_000_002_1);
+        const double v_000_013_0 = PB[1]*v_000_003_0 - PC1[l]*v_000_003_1;
+        const double v_000_004_0 = PB[2]*v_000_003_0 - PC2[l]*v_000_003_1 + 3*oo2p*(v_000_002_0 - v_000_002_1);
+
+        sum_0 += q[l]*v_000_400_0;
+        sum_1 += q[l]*v_000_310_0;
+        sum_2 += q[l]*v_000_301_0;
+        sum_3 += q[l]*v_000_220_0;
+        sum_4 += q[l]*v_000_211_0;
+        sum_5 += q[l]*v_000_202_0;
+        sum_6 += q[l]*v_000_130_0;
+        sum_7 += q[l]*v_000_121_0;
+        sum_8 += q[l]*v_000_112_0;
+        sum_9 += q[l]*v_000_103_0;
+        sum_10 += q[l]*v_000_040_0;
+        sum_11 += q[l]*v_000_031_0;
+        sum_12 += q[l]*v_000_022_0;
+        sum_13 += q[l]*v_000_013_0;
+        sum_14 += q[l]*v_000_004_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+}
+
+
+void potential_kernel_1_0(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+
+        sum_0 += q[l]*v_100_000_0;
+        sum_1 += q[l]*v_010_000_0;
+        sum_2 += q[l]*v_001_000_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+}
+
+
+void potential_kernel_1_1(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+
+        sum_0 += q[l]*v_100_100_0;
+        sum_1 += q[l]*v_100_010_0;
+        sum_2 += q[l]*v_100_001_0;
+        sum_3 += q[l]*v_010_100_0;
+        sum_4 += q[l]*v_010_010_0;
+        sum_5 += q[l]*v_010_001_0;
+        sum_6 += q[l]*v_001_100_0;
+        sum_7 += q[l]*v_001_010_0;
+        sum_8 += q[l]*v_001_001_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+}
+
+
+void potential_kernel_1_2(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_100_100_1 = PB[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_100_1 = PB[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_200_0 = PB[0]*v_100_100_0 - PC0[l]*v_100_100_1 + 1*oo2p*(v_000_100_0 - v_000_100_1) + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_110_0 = PB[1]*v_100_100_0 - PC1[l]*v_100_100_1;
+        const double v_100_101_0 = PB[2]*v_100_100_0 - PC2[l]*v_100_100_1;
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_010_1 = PB[1]*v_100_000_1 - PC1[l]*v_100_000_2;
+        const double v_100_020_0 = PB[1]*v_100_010_0 - PC1[l]*v_100_010_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_100_001_1 = PB[2]*v_100_000_1 - PC2[l]*v_100_000_2;
+        const double v_100_011_0 = PB[1]*v_100_001_0 - PC1[l]*v_100_001_1;
+        const double v_100_002_0 = PB[2]*v_100_001_0 - PC2[l]*v_100_001_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_010_100_1 = PB[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_010_200_0 = PB[0]*v_010_100_0 - PC0[l]*v_010_100_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_010_1 = PB[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_010_110_0 = PB[0]*v_010_010_0 - PC0[l]*v_010_010_1;
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_010_001_1 = PB[2]*v_010_000_1 - PC2[l]*v_010_000_2;
+        const double v_010_101_0 = PB[0]*v_010_001_0 - PC0[l]*v_010_001_1;
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_010_1 = PB[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_010_020_0 = PB[1]*v_010_010_0 - PC1[l]*v_010_010_1 + 1*oo2p*(v_000_010_0 - v_000_010_1) + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_011_0 = PB[2]*v_010_010_0 - PC2[l]*v_010_010_1;
+        const double v_010_002_0 = PB[2]*v_010_001_0 - PC2[l]*v_010_001_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_001_100_1 = PB[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_001_200_0 = PB[0]*v_001_100_0 - PC0[l]*v_001_100_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_010_1 = PB[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_001_110_0 = PB[0]*v_001_010_0 - PC0[l]*v_001_010_1;
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_001_1 = PB[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_001_101_0 = PB[0]*v_001_001_0 - PC0[l]*v_001_001_1;
+        const double v_001_020_0 = PB[1]*v_001_010_0 - PC1[l]*v_001_010_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_011_0 = PB[1]*v_001_001_0 - PC1[l]*v_001_001_1;
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_000_001_1 = PB[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_001_002_0 = PB[2]*v_001_001_0 - PC2[l]*v_001_001_1 + 1*oo2p*(v_000_001_0 - v_000_001_1) + 1*oo2p*(v_001_000_0 - v_001_000_1);
+
+        sum_0 += q[l]*v_100_200_0;
+        sum_1 += q[l]*v_100_110_0;
+        sum_2 += q[l]*v_100_101_0;
+        sum_3 += q[l]*v_100_020_0;
+        sum_4 += q[l]*v_100_011_0;
+        sum_5 += q[l]*v_100_002_0;
+        sum_6 += q[l]*v_010_200_0;
+        sum_7 += q[l]*v_010_110_0;
+        sum_8 += q[l]*v_010_101_0;
+        sum_9 += q[l]*v_010_020_0;
+        sum_10 += q[l]*v_010_011_0;
+        sum_11 += q[l]*v_010_002_0;
+        sum_12 += q[l]*v_001_200_0;
+        sum_13 += q[l]*v_001_110_0;
+        sum_14 += q[l]*v_001_101_0;
+        sum_15 += q[l]*v_001_020_0;
+        sum_16 += q[l]*v_001_011_0;
+        sum_17 += q[l]*v_001_002_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+}
+
+
+void potential_kernel_1_3(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_100_100_1 = PB[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_100_1 = PB[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_200_0 = PB[0]*v_100_100_0 - PC0[l]*v_100_100_1 + 1*oo2p*(v_000_100_0 - v_000_100_1) + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_100_100_2 = PB[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_100_2 = PB[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_100_200_1 = PB[0]*v_100_100_1 - PC0[l]*v_100_100_2 + 1*oo2p*(v_000_100_1 - v_000_100_2) + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_000_200_0 = PB[0]*v_000_100_0 - PC0[l]*v_000_100_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_200_1 = PB[0]*v_000_100_1 - PC0[l]*v_000_100_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_100_300_0 = PB[0]*v_100_200_0 - PC0[l]*v_100_200_1 + 1*oo2p*(v_000_200_0 - v_000_200_1) + 2*oo2p*(v_100_100_0 - v_100_100_1);
+        const double v_100_210_0 = PB[1]*v_100_200_0 - PC1[l]*v_100_200_1;
+        const double v_100_201_0 = PB[2]*v_100_200_0 - PC2[l]*v_100_200_1;
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_010_1 = PB[1]*v_100_000_1 - PC1[l]*v_100_000_2;
+        const double v_100_020_0 = PB[1]*v_100_010_0 - PC1[l]*v_100_010_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_010_2 = PB[1]*v_100_000_2 - PC1[l]*v_100_000_3;
+        const double v_100_020_1 = PB[1]*v_100_010_1 - PC1[l]*v_100_010_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_010_1 = PB[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_000_020_0 = PB[1]*v_000_010_0 - PC1[l]*v_000_010_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_010_2 = PB[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_000_020_1 = PB[1]*v_000_010_1 - PC1[l]*v_000_010_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_100_120_0 = PB[0]*v_100_020_0 - PC0[l]*v_100_020_1 + 1*oo2p*(v_000_020_0 - v_000_020_1);
+        const double v_100_101_0 = PB[2]*v_100_100_0 - PC2[l]*v_100_100_1;
+        const double v_100_101_1 = PB[2]*v_100_100_1 - PC2[l]*v_100_100_2;
+        const double v_100_111_0 = PB[1]*v_100_101_0 - PC1[l]*v_100_101_1;
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_100_001_1 = PB[2]*v_100_000_1 - PC2[l]*v_100_000_2;
+        const double v_100_002_0 = PB[2]*v_100_001_0 - PC2[l]*v_100_001_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_001_2 = PB[2]*v_100_000_2 - PC2[l]*v_100_000_3;
+        const double v_100_002_1 = PB[2]*v_100_001_1 - PC2[l]*v_100_001_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_000_001_1 = PB[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_000_002_0 = PB[2]*v_000_001_0 - PC2[l]*v_000_001_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_001_2 = PB[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_000_002_1 = PB[2]*v_000_001_1 - PC2[l]*v_000_001_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_100_102_0 = PB[0]*v_100_002_0 - PC0[l]*v_100_002_1 + 1*oo2p*(v_000_002_0 - v_000_002_1);
+        const double v_100_030_0 = PB[1]*v_100_020_0 - PC1[l]*v_100_020_1 + 2*oo2p*(v_100_010_0 - v_100_010_1);
+        const double v_100_021_0 = PB[2]*v_100_020_0 - PC2[l]*v_100_020_1;
+        const double v_100_012_0 = PB[1]*v_100_002_0 - PC1[l]*v_100_002_1;
+        const double v_100_003_0 = PB[2]*v_100_002_0 - PC2[l]*v_100_002_1 + 2*oo2p*(v_100_001_0 - v_100_001_1);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_010_100_1 = PB[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_010_200_0 = PB[0]*v_010_100_0 - PC0[l]*v_010_100_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_010_100_2 = PB[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_010_200_1 = PB[0]*v_010_100_1 - PC0[l]*v_010_100_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_300_0 = PB[0]*v_010_200_0 - PC0[l]*v_010_200_1 + 2*oo2p*(v_010_100_0 - v_010_100_1);
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_010_1 = PB[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_010_110_0 = PB[0]*v_010_010_0 - PC0[l]*v_010_010_1;
+        const double v_010_010_2 = PB[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_010_110_1 = PB[0]*v_010_010_1 - PC0[l]*v_010_010_2;
+        const double v_010_210_0 = PB[0]*v_010_110_0 - PC0[l]*v_010_110_1 + 1*oo2p*(v_010_010_0 - v_010_010_1);
+        const double v_010_201_0 = PB[2]*v_010_200_0 - PC2[l]*v_010_200_1;
+        const double v_010_020_0 = PB[1]*v_010_010_0 - PC1[l]*v_010_010_1 + 1*oo2p*(v_000_010_0 - v_000_010_1) + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_020_1 = PB[1]*v_010_010_1 - PC1[l]*v_010_010_2 + 1*oo2p*(v_000_010_1 - v_000_010_2) + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_120_0 = PB[0]*v_010_020_0 - PC0[l]*v_010_020_1;
+        const double v_010_011_0 = PB[2]*v_010_010_0 - PC2[l]*v_010_010_1;
+        const double v_010_011_1 = PB[2]*v_010_010_1 - PC2[l]*v_010_010_2;
+        const double v_010_111_0 = PB[0]*v_010_011_0 - PC0[l]*v_010_011_1;
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_010_001_1 = PB[2]*v_010_000_1 - PC2[l]*v_010_000_2;
+        const double v_010_002_0 = PB[2]*v_010_001_0 - PC2[l]*v_010_001_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_001_2 = PB[2]*v_010_000_2 - PC2[l]*v_010_000_3;
+        const double v_010_002_1 = PB[2]*v_010_001_1 - PC2[l]*v_010_001_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_102_0 = PB[0]*v_010_002_0 - PC0[l]*v_010_002_1;
+        const double v_010_030_0 = PB[1]*v_010_020_0 - PC1[l]*v_010_020_1 + 1*oo2p*(v_000_020_0 - v_000_020_1) + 2*oo2p*(v_010_010_0 - v_010_010_1);
+        const double v_010_021_0 = PB[2]*v_010_020_0 - PC2[l]*v_010_020_1;
+        const double v_010_012_0 = PB[1]*v_010_002_0 - PC1[l]*v_010_002_1 + 1*oo2p*(v_000_002_0 - v_000_002_1);
+        const double v_010_003_0 = PB[2]*v_010_002_0 - PC2[l]*v_010_002_1 + 2*oo2p*(v_010_001_0 - v_010_001_1);
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_001_100_1 = PB[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_001_200_0 = PB[0]*v_001_100_0 - PC0[l]*v_001_100_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_001_100_2 = PB[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_001_200_1 = PB[0]*v_001_100_1 - PC0[l]*v_001_100_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_300_0 = PB[0]*v_001_200_0 - PC0[l]*v_001_200_1 + 2*oo2p*(v_001_100_0 - v_001_100_1);
+        const double v_001_210_0 = PB[1]*v_001_200_0 - PC1[l]*v_001_200_1;
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_001_1 = PB[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_001_101_0 = PB[0]*v_001_001_0 - PC0[l]*v_001_001_1;
+        const double v_001_001_2 = PB[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_001_101_1 = PB[0]*v_001_001_1 - PC0[l]*v_001_001_2;
+        const double v_001_201_0 = PB[0]*v_001_101_0 - PC0[l]*v_001_101_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_010_1 = PB[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_001_020_0 = PB[1]*v_001_010_0 - PC1[l]*v_001_010_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_010_2 = PB[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_001_020_1 = PB[1]*v_001_010_1 - PC1[l]*v_001_010_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_120_0 = PB[0]*v_001_020_0 - PC0[l]*v_001_020_1;
+        const double v_001_011_0 = PB[1]*v_001_001_0 - PC1[l]*v_001_001_1;
+        const double v_001_011_1 = PB[1]*v_001_001_1 - PC1[l]*v_001_001_2;
+        const double v_001_111_0 = PB[0]*v_001_011_0 - PC0[l]*v_001_011_1;
+        const double v_001_002_0 = PB[2]*v_001_001_0 - PC2[l]*v_001_001_1 + 1*oo2p*(v_000_001_0 - v_000_001_1) + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_002_1 = PB[2]*v_001_001_1 - PC2[l]*v_001_001_2 + 1*oo2p*(v_000_001_1 - v_000_001_2) + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_102_0 = PB[0]*v_001_002_0 - PC0[l]*v_001_002_1;
+        const double v_001_030_0 = PB[1]*v_001_020_0 - PC1[l]*v_001_020_1 + 2*oo2p*(v_001_010_0 - v_001_010_1);
+        const double v_001_021_0 = PB[1]*v_001_011_0 - PC1[l]*v_001_011_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_001_012_0 = PB[1]*v_001_002_0 - PC1[l]*v_001_002_1;
+        const double v_001_003_0 = PB[2]*v_001_002_0 - PC2[l]*v_001_002_1 + 1*oo2p*(v_000_002_0 - v_000_002_1) + 2*oo2p*(v_001_001_0 - v_001_001_1);
+
+        sum_0 += q[l]*v_100_300_0;
+        sum_1 += q[l]*v_100_210_0;
+        sum_2 += q[l]*v_100_201_0;
+        sum_3 += q[l]*v_100_120_0;
+        sum_4 += q[l]*v_100_111_0;
+        sum_5 += q[l]*v_100_102_0;
+        sum_6 += q[l]*v_100_030_0;
+        sum_7 += q[l]*v_100_021_0;
+        sum_8 += q[l]*v_100_012_0;
+        sum_9 += q[l]*v_100_003_0;
+        sum_10 += q[l]*v_010_300_0;
+        sum_11 += q[l]*v_010_210_0;
+        sum_12 += q[l]*v_010_201_0;
+        sum_13 += q[l]*v_010_120_0;
+        sum_14 += q[l]*v_010_111_0;
+        sum_15 += q[l]*v_010_102_0;
+        sum_16 += q[l]*v_010_030_0;
+        sum_17 += q[l]*v_010_021_0;
+        sum_18 += q[l]*v_010_012_0;
+        sum_19 += q[l]*v_010_003_0;
+        sum_20 += q[l]*v_001_300_0;
+        sum_21 += q[l]*v_001_210_0;
+        sum_22 += q[l]*v_001_201_0;
+        sum_23 += q[l]*v_001_120_0;
+        sum_24 += q[l]*v_001_111_0;
+        sum_25 += q[l]*v_001_102_0;
+        sum_26 += q[l]*v_001_030_0;
+        sum_27 += q[l]*v_001_021_0;
+        sum_28 += q[l]*v_001_012_0;
+        sum_29 += q[l]*v_001_003_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+}
+
+
+void potential_kernel_1_4(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_100_100_1 = PB[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_100_1 = PB[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_200_0 = PB[0]*v_100_100_0 - PC0[l]*v_100_100_1 + 1*oo2p*(v_000_100_0 - v_000_100_1) + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_100_100_2 = PB[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_100_2 = PB[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_100_200_1 = PB[0]*v_100_100_1 - PC0[l]*v_100_100_2 + 1*oo2p*(v_000_100_1 - v_000_100_2) + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_000_200_0 = PB[0]*v_000_100_0 - PC0[l]*v_000_100_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_200_1 = PB[0]*v_000_100_1 - PC0[l]*v_000_100_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_100_300_0 = PB[0]*v_100_200_0 - PC0[l]*v_100_200_1 + 1*oo2p*(v_000_200_0 - v_000_200_1) + 2*oo2p*(v_100_100_0 - v_100_100_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_100_100_3 = PB[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_000_100_3 = PB[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_100_200_2 = PB[0]*v_100_100_2 - PC0[l]*v_100_100_3 + 1*oo2p*(v_000_100_2 - v_000_100_3) + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_000_200_2 = PB[0]*v_000_100_2 - PC0[l]*v_000_100_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_100_300_1 = PB[0]*v_100_200_1 - PC0[l]*v_100_200_2 + 1*oo2p*(v_000_200_1 - v_000_200_2) + 2*oo2p*(v_100_100_1 - v_100_100_2);
+        const double v_000_300_0 = PB[0]*v_000_200_0 - PC0[l]*v_000_200_1 + 2*oo2p*(v_000_100_0 - v_000_100_1);
+        const double v_000_300_1 = PB[0]*v_000_200_1 - PC0[l]*v_000_200_2 + 2*oo2p*(v_000_100_1 - v_000_100_2);
+        const double v_100_400_0 = PB[0]*v_100_300_0 - PC0[l]*v_100_300_1 + 1*oo2p*(v_000_300_0 - v_000_300_1) + 3*oo2p*(v_100_200_0 - v_100_200_1);
+        const double v_100_310_0 = PB[1]*v_100_300_0 - PC1[l]*v_100_300_1;
+        const double v_100_301_0 = PB[2]*v_100_300_0 - PC2[l]*v_100_300_1;
+        const double v_100_210_0 = PB[1]*v_100_200_0 - PC1[l]*v_100_200_1;
+        const double v_100_210_1 = PB[1]*v_100_200_1 - PC1[l]*v_100_200_2;
+        const double v_100_220_0 = PB[1]*v_100_210_0 - PC1[l]*v_100_210_1 + 1*oo2p*(v_100_200_0 - v_100_200_1);
+        const double v_100_201_0 = PB[2]*v_100_200_0 - PC2[l]*v_100_200_1;
+        const double v_100_201_1 = PB[2]*v_100_200_1 - PC2[l]*v_100_200_2;
+        const double v_100_211_0 = PB[1]*v_100_201_0 - PC1[l]*v_100_201_1;
+        const double v_100_202_0 = PB[2]*v_100_201_0 - PC2[l]*v_100_201_1 + 1*oo2p*(v_100_200_0 - v_100_200_1);
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_010_1 = PB[1]*v_100_000_1 - PC1[l]*v_100_000_2;
+        const double v_100_020_0 = PB[1]*v_100_010_0 - PC1[l]*v_100_010_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_010_2 = PB[1]*v_100_000_2 - PC1[l]*v_100_000_3;
+        const double v_100_020_1 = PB[1]*v_100_010_1 - PC1[l]*v_100_010_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_100_030_0 = PB[1]*v_100_020_0 - PC1[l]*v_100_020_1 + 2*oo2p*(v_100_010_0 - v_100_010_1);
+        const double v_100_010_3 = PB[1]*v_100_000_3 - PC1[l]*v_100_000_4;
+        const double v_100_020_2 = PB[1]*v_100_010_2 - PC1[l]*v_100_010_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_100_030_1 = PB[1]*v_100_020_1 - PC1[l]*v_100_020_2 + 2*oo2p*(v_100_010_1 - v_100_010_2);
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_010_1 = PB[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_000_020_0 = PB[1]*v_000_010_0 - PC1[l]*v_000_010_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_010_2 = PB[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_000_020_1 = PB[1]*v_000_010_1 - PC1[l]*v_000_010_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_030_0 = PB[1]*v_000_020_0 - PC1[l]*v_000_020_1 + 2*oo2p*(v_000_010_0 - v_000_010_1);
+        const double v_000_010_3 = PB[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_000_020_2 = PB[1]*v_000_010_2 - PC1[l]*v_000_010_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_030_1 = PB[1]*v_000_020_1 - PC1[l]*v_000_020_2 + 2*oo2p*(v_000_010_1 - v_000_010_2);
+        const double v_100_130_0 = PB[0]*v_100_030_0 - PC0[l]*v_100_030_1 + 1*oo2p*(v_000_030_0 - v_000_030_1);
+        const double v_100_120_0 = PB[0]*v_100_020_0 - PC0[l]*v_100_020_1 + 1*oo2p*(v_000_020_0 - v_000_020_1);
+        const double v_100_120_1 = PB[0]*v_100_020_1 - PC0[l]*v_100_020_2 + 1*oo2p*(v_000_020_1 - v_000_020_2);
+        const double v_100_121_0 = PB[2]*v_100_120_0 - PC2[l]*v_100_120_1;
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_100_001_1 = PB[2]*v_100_000_1 - PC2[l]*v_100_000_2;
+        const double v_100_002_0 = PB[2]*v_100_001_0 - PC2[l]*v_100_001_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_001_2 = PB[2]*v_100_000_2 - PC2[l]*v_100_000_3;
+        const double v_100_002_1 = PB[2]*v_100_001_1 - PC2[l]*v_100_001_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_000_001_1 = PB[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_000_002_0 = PB[2]*v_000_001_0 - PC2[l]*v_000_001_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_001_2 = PB[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_000_002_1 = PB[2]*v_000_001_1 - PC2[l]*v_000_001_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_100_102_0 = PB[0]*v_100_002_0 - PC0[l]*v_100_002_1 + 1*oo2p*(v_000_002_0 - v_000_002_1);
+        const double v_100_001_3 = PB[2]*v_100_000_3 - PC2[l]*v_100_000_4;
+        const double v_100_002_2 = PB[2]*v_100_001_2 - PC2[l]*v_100_001_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_000_001_3 = PB[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_000_002_2 = PB[2]*v_000_001_2 - PC2[l]*v_000_001_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_100_102_1 = PB[0]*v_100_002_1 - PC0[l]*v_100_002_2 + 1*oo2p*(v_000_002_1 - v_000_002_2);
+        const double v_100_112_0 = PB[1]*v_100_102_0 - PC1[l]*v_100_102_1;
+        const double v_100_003_0 = PB[2]*v_100_002_0 - PC2[l]*v_100_002_1 + 2*oo2p*(v_100_001_0 - v_100_001_1);
+        const double v_100_003_1 = PB[2]*v_100_002_1 - PC2[l]*v_100_002_2 + 2*oo2p*(v_100_001_1 - v_100_001_2);
+        const double v_000_003_0 = PB[2]*v_000_002_0 - PC2[l]*v_000_002_1 + 2*oo2p*(v_000_001_0 - v_000_001_1);
+        const double v_000_003_1 = PB[2]*v_000_002_1 - PC2[l]*v_000_002_2 + 2*oo2p*(v_000_001_1 - v_000_001_2);
+        const double v_100_103_0 = PB[0]*v_100_003_0 - PC0[l]*v_100_003_1 + 1*oo2p*(v_000_003_0 - v_000_003_1);
+        const double v_100_040_0 = PB[1]*v_100_030_0 - PC1[l]*v_100_030_1 + 3*oo2p*(v_100_020_0 - v_100_020_1);
+        const double v_100_031_0 = PB[2]*v_100_030_0 - PC2[l]*v_100_030_1;
+        const double v_100_012_0 = PB[1]*v_100_002_0 - PC1[l]*v_100_002_1;
+        const double v_100_012_1 = PB[1]*v_100_002_1 - PC1[l]*v_100_002_2;
+        const double v_100_022_0 = PB[1]*v_100_012_0 - PC1[l]*v_100_012_1 + 1*oo2p*(v_100_002_0 - v_100_002_1);
+        const double v_100_013_0 = PB[1]*v_100_003_0 - PC1[l]*v_100_003_1;
+        const double v_100_004_0 = PB[2]*v_100_003_0 - PC2[l]*v_100_003_1 + 3*oo2p*(v_100_002_0 - v_100_002_1);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_010_100_1 = PB[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_010_200_0 = PB[0]*v_010_100_0 - PC0[l]*v_010_100_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_010_100_2 = PB[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_010_200_1 = PB[0]*v_010_100_1 - PC0[l]*v_010_100_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_300_0 = PB[0]*v_010_200_0 - PC0[l]*v_010_200_1 + 2*oo2p*(v_010_100_0 - v_010_100_1);
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_010_100_3 = PB[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_010_200_2 = PB[0]*v_010_100_2 - PC0[l]*v_010_100_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_010_300_1 = PB[0]*v_010_200_1 - PC0[l]*v_010_200_2 + 2*oo2p*(v_010_100_1 - v_010_100_2);
+        const double v_010_400_0 = PB[0]*v_010_300_0 - PC0[l]*v_010_300_1 + 3*oo2p*(v_010_200_0 - v_010_200_1);
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_010_1 = PB[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_010_110_0 = PB[0]*v_010_010_0 - PC0[l]*v_010_010_1;
+        const double v_010_010_2 = PB[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_010_110_1 = PB[0]*v_010_010_1 - PC0[l]*v_010_010_2;
+        const double v_010_210_0 = PB[0]*v_010_110_0 - PC0[l]*v_010_110_1 + 1*oo2p*(v_010_010_0 - v_010_010_1);
+        const double v_010_010_3 = PB[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_010_110_2 = PB[0]*v_010_010_2 - PC0[l]*v_010_010_3;
+        const double v_010_210_1 = PB[0]*v_010_110_1 - PC0[l]*v_010_110_2 + 1*oo2p*(v_010_010_1 - v_010_010_2);
+        const double v_010_310_0 = PB[0]*v_010_210_0 - PC0[l]*v_010_210_1 + 2*oo2p*(v_010_110_0 - v_010_110_1);
+        const double v_010_301_0 = PB[2]*v_010_300_0 - PC2[l]*v_010_300_1;
+        const double v_010_020_0 = PB[1]*v_010_010_0 - PC1[l]*v_010_010_1 + 1*oo2p*(v_000_010_0 - v_000_010_1) + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_020_1 = PB[1]*v_010_010_1 - PC1[l]*v_010_010_2 + 1*oo2p*(v_000_010_1 - v_000_010_2) + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_120_0 = PB[0]*v_010_020_0 - PC0[l]*v_010_020_1;
+        const double v_010_020_2 = PB[1]*v_010_010_2 - PC1[l]*v_010_010_3 + 1*oo2p*(v_000_010_2 - v_000_010_3) + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_010_120_1 = PB[0]*v_010_020_1 - PC0[l]*v_010_020_2;
+        const double v_010_220_0 = PB[0]*v_010_120_0 - PC0[l]*v_010_120_1 + 1*oo2p*(v_010_020_0 - v_010_020_1);
+        const double v_010_211_0 = PB[2]*v_010_210_0 - PC2[l]*v_010_210_1;
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_010_001_1 = PB[2]*v_010_000_1 - PC2[l]*v_010_000_2;
+        const double v_010_002_0 = PB[2]*v_010_001_0 - PC2[l]*v_010_001_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_001_2 = PB[2]*v_010_000_2 - PC2[l]*v_010_000_3;
+        const double v_010_002_1 = PB[2]*v_010_001_1 - PC2[l]*v_010_001_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_102_0 = PB[0]*v_010_002_0 - PC0[l]*v_010_002_1;
+        const double v_010_001_3 = PB[2]*v_010_000_3 - PC2[l]*v_010_000_4;
+        const double v_010_002_2 = PB[2]*v_010_001_2 - PC2[l]*v_010_001_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_010_102_1 = PB[0]*v_010_002_1 - PC0[l]*v_010_002_2;
+        const double v_010_202_0 = PB[0]*v_010_102_0 - PC0[l]*v_010_102_1 + 1*oo2p*(v_010_002_0 - v_010_002_1);
+        const double v_010_030_0 = PB[1]*v_010_020_0 - PC1[l]*v_010_020_1 + 1*oo2p*(v_000_020_0 - v_000_020_1) + 2*oo2p*(v_010_010_0 - v_010_010_1);
+        const double v_010_030_1 = PB[1]*v_010_020_1 - PC1[l]*v_010_020_2 + 1*oo2p*(v_000_020_1 - v_000_020_2) + 2*oo2p*(v_010_010_1 - v_010_010_2);
+        const double v_010_130_0 = PB[0]*v_010_030_0 - PC0[l]*v_010_030_1;
+        const double v_010_021_0 = PB[2]*v_010_020_0 - PC2[l]*v_010_020_1;
+        const double v_010_021_1 = PB[2]*v_010_020_1 - PC2[l]*v_010_020_2;
+        const double v_010_121_0 = PB[0]*v_010_021_0 - PC0[l]*v_010_021_1;
+        const double v_010_012_0 = PB[1]*v_010_002_0 - PC1[l]*v_010_002_1 + 1*oo2p*(v_000_002_0 - v_000_002_1);
+        const double v_010_012_1 = PB[1]*v_010_002_1 - PC1[l]*v_010_002_2 + 1*oo2p*(v_000_002_1 - v_000_002_2);
+        const double v_010_112_0 = PB[0]*v_010_012_0 - PC0[l]*v_010_012_1;
+        const double v_010_003_0 = PB[2]*v_010_002_0 - PC2[l]*v_010_002_1 + 2*oo2p*(v_010_001_0 - v_010_001_1);
+        const double v_010_003_1 = PB[2]*v_010_002_1 - PC2[l]*v_010_002_2 + 2*oo2p*(v_010_001_1 - v_010_001_2);
+        const double v_010_103_0 = PB[0]*v_010_003_0 - PC0[l]*v_010_003_1;
+        const double v_010_040_0 = PB[1]*v_010_030_0 - PC1[l]*v_010_030_1 + 1*oo2p*(v_000_030_0 - v_000_030_1) + 3*oo2p*(v_010_020_0 - v_010_020_1);
+        const double v_010_031_0 = PB[2]*v_010_030_0 - PC2[l]*v_010_030_1;
+        const double v_010_022_0 = PB[2]*v_010_021_0 - PC2[l]*v_010_021_1 + 1*oo2p*(v_010_020_0 - v_010_020_1);
+        const double v_010_013_0 = PB[1]*v_010_003_0 - PC1[l]*v_010_003_1 + 1*oo2p*(v_000_003_0 - v_000_003_1);
+        const double v_010_004_0 = PB[2]*v_010_003_0 - PC2[l]*v_010_003_1 + 3*oo2p*(v_010_002_0 - v_010_002_1);
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_001_100_1 = PB[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_001_200_0 = PB[0]*v_001_100_0 - PC0[l]*v_001_100_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_001_100_2 = PB[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_001_200_1 = PB[0]*v_001_100_1 - PC0[l]*v_001_100_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_300_0 = PB[0]*v_001_200_0 - PC0[l]*v_001_200_1 + 2*oo2p*(v_001_100_0 - v_001_100_1);
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_001_100_3 = PB[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_001_200_2 = PB[0]*v_001_100_2 - PC0[l]*v_001_100_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_300_1 = PB[0]*v_001_200_1 - PC0[l]*v_001_200_2 + 2*oo2p*(v_001_100_1 - v_001_100_2);
+        const double v_001_400_0 = PB[0]*v_001_300_0 - PC0[l]*v_001_300_1 + 3*oo2p*(v_001_200_0 - v_001_200_1);
+        const double v_001_310_0 = PB[1]*v_001_300_0 - PC1[l]*v_001_300_1;
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_001_1 = PB[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_001_101_0 = PB[0]*v_001_001_0 - PC0[l]*v_001_001_1;
+        const double v_001_001_2 = PB[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_001_101_1 = PB[0]*v_001_001_1 - PC0[l]*v_001_001_2;
+        const double v_001_201_0 = PB[0]*v_001_101_0 - PC0[l]*v_001_101_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_001_001_3 = PB[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_001_101_2 = PB[0]*v_001_001_2 - PC0[l]*v_001_001_3;
+        const double v_001_201_1 = PB[0]*v_001_101_1 - PC0[l]*v_001_101_2 + 1*oo2p*(v_001_001_1 - v_001_001_2);
+        const double v_001_301_0 = PB[0]*v_001_201_0 - PC0[l]*v_001_201_1 + 2*oo2p*(v_001_101_0 - v_001_101_1);
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_010_1 = PB[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_001_020_0 = PB[1]*v_001_010_0 - PC1[l]*v_001_010_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_010_2 = PB[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_001_020_1 = PB[1]*v_001_010_1 - PC1[l]*v_001_010_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_120_0 = PB[0]*v_001_020_0 - PC0[l]*v_001_020_1;
+        const double v_001_010_3 = PB[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_001_020_2 = PB[1]*v_001_010_2 - PC1[l]*v_001_010_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_120_1 = PB[0]*v_001_020_1 - PC0[l]*v_001_020_2;
+        const double v_001_220_0 = PB[0]*v_001_120_0 - PC0[l]*v_001_120_1 + 1*oo2p*(v_001_020_0 - v_001_020_1);
+        const double v_001_211_0 = PB[1]*v_001_201_0 - PC1[l]*v_001_201_1;
+        const double v_001_002_0 = PB[2]*v_001_001_0 - PC2[l]*v_001_001_1 + 1*oo2p*(v_000_001_0 - v_000_001_1) + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_002_1 = PB[2]*v_001_001_1 - PC2[l]*v_001_001_2 + 1*oo2p*(v_000_001_1 - v_000_001_2) + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_102_0 = PB[0]*v_001_002_0 - PC0[l]*v_001_002_1;
+        const double v_001_002_2 = PB[2]*v_001_001_2 - PC2[l]*v_001_001_3 + 1*oo2p*(v_000_001_2 - v_000_001_3) + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_102_1 = PB[0]*v_001_002_1 - PC0[l]*v_001_002_2;
+        const double v_001_202_0 = PB[0]*v_001_102_0 - PC0[l]*v_001_102_1 + 1*oo2p*(v_001_002_0 - v_001_002_1);
+        const double v_001_030_0 = PB[1]*v_001_020_0 - PC1[l]*v_001_020_1 + 2*oo2p*(v_001_010_0 - v_001_010_1);
+        const double v_001_030_1 = PB[1]*v_001_020_1 - PC1[l]*v_001_020_2 + 2*oo2p*(v_001_010_1 - v_001_010_2);
+        const double v_001_130_0 = PB[0]*v_001_030_0 - PC0[l]*v_001_030_1;
+        const double v_001_011_0 = PB[1]*v_001_001_0 - PC1[l]*v_001_001_1;
+        const double v_001_011_1 = PB[1]*v_001_001_1 - PC1[l]*v_001_001_2;
+        const double v_001_021_0 = PB[1]*v_001_011_0 - PC1[l]*v_001_011_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_001_011_2 = PB[1]*v_001_001_2 - PC1[l]*v_001_001_3;
+        const double v_001_021_1 = PB[1]*v_001_011_1 - PC1[l]*v_001_011_2 + 1*oo2p*(v_001_001_1 - v_001_001_2);
+        const double v_001_121_0 = PB[0]*v_001_021_0 - PC0[l]*v_001_021_1;
+        const double v_001_012_0 = PB[1]*v_001_002_0 - PC1[l]*v_001_002_1;
+        const double v_001_012_1 = PB[1]*v_001_002_1 - PC1[l]*v_001_002_2;
+        const double v_001_112_0 = PB[0]*v_001_012_0 - PC0[l]*v_001_012_1;
+        const double v_001_003_0 = PB[2]*v_001_002_0 - PC2[l]*v_001_002_1 + 1*oo2p*(v_000_002_0 - v_000_002_1) + 2*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_001_003_1 = PB[2]*v_001_002_1 - PC2[l]*v_001_002_2 + 1*oo2p*(v_000_002_1 - v_000_002_2) + 2*oo2p*(v_001_001_1 - v_001_001_2);
+        const double v_001_103_0 = PB[0]*v_001_003_0 - PC0[l]*v_001_003_1;
+        const double v_001_040_0 = PB[1]*v_001_030_0 - PC1[l]*v_001_030_1 + 3*oo2p*(v_001_020_0 - v_001_020_1);
+        const double v_001_031_0 = PB[1]*v_001_021_0 - PC1[l]*v_001_021_1 + 2*oo2p*(v_001_011_0 - v_001_011_1);
+        const double v_001_022_0 = PB[1]*v_001_012_0 - PC1[l]*v_001_012_1 + 1*oo2p*(v_001_002_0 - v_001_002_1);
+        const double v_001_013_0 = PB[1]*v_001_003_0 - PC1[l]*v_001_003_1;
+        const double v_001_004_0 = PB[2]*v_001_003_0 - PC2[l]*v_001_003_1 + 1*oo2p*(v_000_003_0 - v_000_003_1) + 3*oo2p*(v_001_002_0 - v_001_002_1);
+
+        sum_0 += q[l]*v_100_400_0;
+        sum_1 += q[l]*v_100_310_0;
+        sum_2 += q[l]*v_100_301_0;
+        sum_3 += q[l]*v_100_220_0;
+        sum_4 += q[l]*v_100_211_0;
+        sum_5 += q[l]*v_100_202_0;
+        sum_6 += q[l]*v_100_130_0;
+        sum_7 += q[l]*v_100_121_0;
+        sum_8 += q[l]*v_100_112_0;
+        sum_9 += q[l]*v_100_103_0;
+        sum_10 += q[l]*v_100_040_0;
+        sum_11 += q[l]*v_100_031_0;
+        sum_12 += q[l]*v_100_022_0;
+        sum_13 += q[l]*v_100_013_0;
+        sum_14 += q[l]*v_100_004_0;
+        sum_15 += q[l]*v_010_400_0;
+        sum_16 += q[l]*v_010_310_0;
+        sum_17 += q[l]*v_010_301_0;
+        sum_18 += q[l]*v_010_220_0;
+        sum_19 += q[l]*v_010_211_0;
+        sum_20 += q[l]*v_010_202_0;
+        sum_21 += q[l]*v_010_130_0;
+        sum_22 += q[l]*v_010_121_0;
+        sum_23 += q[l]*v_010_112_0;
+        sum_24 += q[l]*v_010_103_0;
+        sum_25 += q[l]*v_010_040_0;
+        sum_26 += q[l]*v_010_031_0;
+        sum_27 += q[l]*v_010_022_0;
+        sum_28 += q[l]*v_010_013_0;
+        sum_29 += q[l]*v_010_004_0;
+        sum_30 += q[l]*v_001_400_0;
+        sum_31 += q[l]*v_001_310_0;
+        sum_32 += q[l]*v_001_301_0;
+        sum_33 += q[l]*v_001_220_0;
+        sum_34 += q[l]*v_001_211_0;
+        sum_35 += q[l]*v_001_202_0;
+        sum_36 += q[l]*v_001_130_0;
+        sum_37 += q[l]*v_001_121_0;
+        sum_38 += q[l]*v_001_112_0;
+        sum_39 += q[l]*v_001_103_0;
+        sum_40 += q[l]*v_001_040_0;
+        sum_41 += q[l]*v_001_031_0;
+        sum_42 += q[l]*v_001_022_0;
+        sum_43 += q[l]*v_001_013_0;
+        sum_44 += q[l]*v_001_004_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+}
+
+
+void potential_kernel_2_0(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+
+        sum_0 += q[l]*v_200_000_0;
+        sum_1 += q[l]*v_110_000_0;
+        sum_2 += q[l]*v_101_000_0;
+        sum_3 += q[l]*v_020_000_0;
+        sum_4 += q[l]*v_011_000_0;
+        sum_5 += q[l]*v_002_000_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+}
+
+
+void potential_kernel_2_1(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_100_0 = PB[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_200_010_0 = PB[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_200_001_0 = PB[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_100_0 = PB[0]*v_110_000_0 - PC0[l]*v_110_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_110_010_0 = PB[1]*v_110_000_0 - PC1[l]*v_110_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_110_001_0 = PB[2]*v_110_000_0 - PC2[l]*v_110_000_1;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_100_0 = PB[0]*v_101_000_0 - PC0[l]*v_101_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_101_010_0 = PB[1]*v_101_000_0 - PC1[l]*v_101_000_1;
+        const double v_101_001_0 = PB[2]*v_101_000_0 - PC2[l]*v_101_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_020_100_0 = PB[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_010_0 = PB[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_020_001_0 = PB[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_011_100_0 = PB[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_010_0 = PB[1]*v_011_000_0 - PC1[l]*v_011_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_011_001_0 = PB[2]*v_011_000_0 - PC2[l]*v_011_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_002_100_0 = PB[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_010_0 = PB[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_002_001_0 = PB[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+
+        sum_0 += q[l]*v_200_100_0;
+        sum_1 += q[l]*v_200_010_0;
+        sum_2 += q[l]*v_200_001_0;
+        sum_3 += q[l]*v_110_100_0;
+        sum_4 += q[l]*v_110_010_0;
+        sum_5 += q[l]*v_110_001_0;
+        sum_6 += q[l]*v_101_100_0;
+        sum_7 += q[l]*v_101_010_0;
+        sum_8 += q[l]*v_101_001_0;
+        sum_9 += q[l]*v_020_100_0;
+        sum_10 += q[l]*v_020_010_0;
+        sum_11 += q[l]*v_020_001_0;
+        sum_12 += q[l]*v_011_100_0;
+        sum_13 += q[l]*v_011_010_0;
+        sum_14 += q[l]*v_011_001_0;
+        sum_15 += q[l]*v_002_100_0;
+        sum_16 += q[l]*v_002_010_0;
+        sum_17 += q[l]*v_002_001_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+}
+
+
+void potential_kernel_2_2(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_100_0 = PB[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_200_100_1 = PB[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_100_100_1 = PB[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_200_0 = PB[0]*v_200_100_0 - PC0[l]*v_200_100_1 + 2*oo2p*(v_100_100_0 - v_100_100_1) + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_110_0 = PB[1]*v_200_100_0 - PC1[l]*v_200_100_1;
+        const double v_200_101_0 = PB[2]*v_200_100_0 - PC2[l]*v_200_100_1;
+        const double v_200_010_0 = PB[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_200_010_1 = PB[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_200_020_0 = PB[1]*v_200_010_0 - PC1[l]*v_200_010_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_001_0 = PB[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_200_001_1 = PB[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_200_011_0 = PB[1]*v_200_001_0 - PC1[l]*v_200_001_1;
+        const double v_200_002_0 = PB[2]*v_200_001_0 - PC2[l]*v_200_001_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_100_0 = PB[0]*v_110_000_0 - PC0[l]*v_110_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_110_000_2 = PA[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_110_100_1 = PB[0]*v_110_000_1 - PC0[l]*v_110_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_100_1 = PB[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_200_0 = PB[0]*v_110_100_0 - PC0[l]*v_110_100_1 + 1*oo2p*(v_010_100_0 - v_010_100_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_010_0 = PB[1]*v_110_000_0 - PC1[l]*v_110_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_110_010_1 = PB[1]*v_110_000_1 - PC1[l]*v_110_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_010_1 = PB[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_110_110_0 = PB[0]*v_110_010_0 - PC0[l]*v_110_010_1 + 1*oo2p*(v_010_010_0 - v_010_010_1);
+        const double v_110_101_0 = PB[2]*v_110_100_0 - PC2[l]*v_110_100_1;
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_010_1 = PB[1]*v_100_000_1 - PC1[l]*v_100_000_2;
+        const double v_110_020_0 = PB[1]*v_110_010_0 - PC1[l]*v_110_010_1 + 1*oo2p*(v_100_010_0 - v_100_010_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_011_0 = PB[2]*v_110_010_0 - PC2[l]*v_110_010_1;
+        const double v_110_001_0 = PB[2]*v_110_000_0 - PC2[l]*v_110_000_1;
+        const double v_110_001_1 = PB[2]*v_110_000_1 - PC2[l]*v_110_000_2;
+        const double v_110_002_0 = PB[2]*v_110_001_0 - PC2[l]*v_110_001_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_100_0 = PB[0]*v_101_000_0 - PC0[l]*v_101_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_101_000_2 = PA[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_101_100_1 = PB[0]*v_101_000_1 - PC0[l]*v_101_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_100_1 = PB[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_200_0 = PB[0]*v_101_100_0 - PC0[l]*v_101_100_1 + 1*oo2p*(v_001_100_0 - v_001_100_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_110_0 = PB[1]*v_101_100_0 - PC1[l]*v_101_100_1;
+        const double v_101_001_0 = PB[2]*v_101_000_0 - PC2[l]*v_101_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_101_001_1 = PB[2]*v_101_000_1 - PC2[l]*v_101_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_001_1 = PB[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_101_101_0 = PB[0]*v_101_001_0 - PC0[l]*v_101_001_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_101_010_0 = PB[1]*v_101_000_0 - PC1[l]*v_101_000_1;
+        const double v_101_010_1 = PB[1]*v_101_000_1 - PC1[l]*v_101_000_2;
+        const double v_101_020_0 = PB[1]*v_101_010_0 - PC1[l]*v_101_010_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_011_0 = PB[1]*v_101_001_0 - PC1[l]*v_101_001_1;
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_100_001_1 = PB[2]*v_100_000_1 - PC2[l]*v_100_000_2;
+        const double v_101_002_0 = PB[2]*v_101_001_0 - PC2[l]*v_101_001_1 + 1*oo2p*(v_100_001_0 - v_100_001_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_020_100_0 = PB[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_020_100_1 = PB[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_020_200_0 = PB[0]*v_020_100_0 - PC0[l]*v_020_100_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_010_0 = PB[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_020_010_1 = PB[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_020_110_0 = PB[0]*v_020_010_0 - PC0[l]*v_020_010_1;
+        const double v_020_001_0 = PB[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_020_001_1 = PB[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_020_101_0 = PB[0]*v_020_001_0 - PC0[l]*v_020_001_1;
+        const double v_020_020_0 = PB[1]*v_020_010_0 - PC1[l]*v_020_010_1 + 2*oo2p*(v_010_010_0 - v_010_010_1) + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_011_0 = PB[2]*v_020_010_0 - PC2[l]*v_020_010_1;
+        const double v_020_002_0 = PB[2]*v_020_001_0 - PC2[l]*v_020_001_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_011_100_0 = PB[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_011_100_1 = PB[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_011_200_0 = PB[0]*v_011_100_0 - PC0[l]*v_011_100_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_010_0 = PB[1]*v_011_000_0 - PC1[l]*v_011_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_011_010_1 = PB[1]*v_011_000_1 - PC1[l]*v_011_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_011_110_0 = PB[0]*v_011_010_0 - PC0[l]*v_011_010_1;
+        const double v_011_001_0 = PB[2]*v_011_000_0 - PC2[l]*v_011_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_011_001_1 = PB[2]*v_011_000_1 - PC2[l]*v_011_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_011_101_0 = PB[0]*v_011_001_0 - PC0[l]*v_011_001_1;
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_010_1 = PB[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_011_020_0 = PB[1]*v_011_010_0 - PC1[l]*v_011_010_1 + 1*oo2p*(v_001_010_0 - v_001_010_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_011_0 = PB[1]*v_011_001_0 - PC1[l]*v_011_001_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_010_001_1 = PB[2]*v_010_000_1 - PC2[l]*v_010_000_2;
+        const double v_011_002_0 = PB[2]*v_011_001_0 - PC2[l]*v_011_001_1 + 1*oo2p*(v_010_001_0 - v_010_001_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_002_100_0 = PB[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_002_100_1 = PB[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_002_200_0 = PB[0]*v_002_100_0 - PC0[l]*v_002_100_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_010_0 = PB[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_002_010_1 = PB[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_002_110_0 = PB[0]*v_002_010_0 - PC0[l]*v_002_010_1;
+        const double v_002_001_0 = PB[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_002_001_1 = PB[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_002_101_0 = PB[0]*v_002_001_0 - PC0[l]*v_002_001_1;
+        const double v_002_020_0 = PB[1]*v_002_010_0 - PC1[l]*v_002_010_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_011_0 = PB[1]*v_002_001_0 - PC1[l]*v_002_001_1;
+        const double v_002_002_0 = PB[2]*v_002_001_0 - PC2[l]*v_002_001_1 + 2*oo2p*(v_001_001_0 - v_001_001_1) + 1*oo2p*(v_002_000_0 - v_002_000_1);
+
+        sum_0 += q[l]*v_200_200_0;
+        sum_1 += q[l]*v_200_110_0;
+        sum_2 += q[l]*v_200_101_0;
+        sum_3 += q[l]*v_200_020_0;
+        sum_4 += q[l]*v_200_011_0;
+        sum_5 += q[l]*v_200_002_0;
+        sum_6 += q[l]*v_110_200_0;
+        sum_7 += q[l]*v_110_110_0;
+        sum_8 += q[l]*v_110_101_0;
+        sum_9 += q[l]*v_110_020_0;
+        sum_10 += q[l]*v_110_011_0;
+        sum_11 += q[l]*v_110_002_0;
+        sum_12 += q[l]*v_101_200_0;
+        sum_13 += q[l]*v_101_110_0;
+        sum_14 += q[l]*v_101_101_0;
+        sum_15 += q[l]*v_101_020_0;
+        sum_16 += q[l]*v_101_011_0;
+        sum_17 += q[l]*v_101_002_0;
+        sum_18 += q[l]*v_020_200_0;
+        sum_19 += q[l]*v_020_110_0;
+        sum_20 += q[l]*v_020_101_0;
+        sum_21 += q[l]*v_020_020_0;
+        sum_22 += q[l]*v_020_011_0;
+        sum_23 += q[l]*v_020_002_0;
+        sum_24 += q[l]*v_011_200_0;
+        sum_25 += q[l]*v_011_110_0;
+        sum_26 += q[l]*v_011_101_0;
+        sum_27 += q[l]*v_011_020_0;
+        sum_28 += q[l]*v_011_011_0;
+        sum_29 += q[l]*v_011_002_0;
+        sum_30 += q[l]*v_002_200_0;
+        sum_31 += q[l]*v_002_110_0;
+        sum_32 += q[l]*v_002_101_0;
+        sum_33 += q[l]*v_002_020_0;
+        sum_34 += q[l]*v_002_011_0;
+        sum_35 += q[l]*v_002_002_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+}
+
+
+void potential_kernel_2_3(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+    double sum_45 = 0.0;
+    double sum_46 = 0.0;
+    double sum_47 = 0.0;
+    double sum_48 = 0.0;
+    double sum_49 = 0.0;
+    double sum_50 = 0.0;
+    double sum_51 = 0.0;
+    double sum_52 = 0.0;
+    double sum_53 = 0.0;
+    double sum_54 = 0.0;
+    double sum_55 = 0.0;
+    double sum_56 = 0.0;
+    double sum_57 = 0.0;
+    double sum_58 = 0.0;
+    double sum_59 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_100_0 = PB[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_200_100_1 = PB[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_100_100_1 = PB[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_200_0 = PB[0]*v_200_100_0 - PC0[l]*v_200_100_1 + 2*oo2p*(v_100_100_0 - v_100_100_1) + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_200_000_3 = PA[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_200_100_2 = PB[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_100_100_2 = PB[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_200_200_1 = PB[0]*v_200_100_1 - PC0[l]*v_200_100_2 + 2*oo2p*(v_100_100_1 - v_100_100_2) + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_100_1 = PB[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_200_0 = PB[0]*v_100_100_0 - PC0[l]*v_100_100_1 + 1*oo2p*(v_000_100_0 - v_000_100_1) + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_100_2 = PB[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_100_200_1 = PB[0]*v_100_100_1 - PC0[l]*v_100_100_2 + 1*oo2p*(v_000_100_1 - v_000_100_2) + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_200_300_0 = PB[0]*v_200_200_0 - PC0[l]*v_200_200_1 + 2*oo2p*(v_100_200_0 - v_100_200_1) + 2*oo2p*(v_200_100_0 - v_200_100_1);
+        const double v_200_210_0 = PB[1]*v_200_200_0 - PC1[l]*v_200_200_1;
+        const double v_200_201_0 = PB[2]*v_200_200_0 - PC2[l]*v_200_200_1;
+        const double v_200_010_0 = PB[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_200_010_1 = PB[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_200_020_0 = PB[1]*v_200_010_0 - PC1[l]*v_200_010_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_010_2 = PB[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_200_020_1 = PB[1]*v_200_010_1 - PC1[l]*v_200_010_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_010_1 = PB[1]*v_100_000_1 - PC1[l]*v_100_000_2;
+        const double v_100_020_0 = PB[1]*v_100_010_0 - PC1[l]*v_100_010_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_010_2 = PB[1]*v_100_000_2 - PC1[l]*v_100_000_3;
+        const double v_100_020_1 = PB[1]*v_100_010_1 - PC1[l]*v_100_010_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_200_120_0 = PB[0]*v_200_020_0 - PC0[l]*v_200_020_1 + 2*oo2p*(v_100_020_0 - v_100_020_1);
+        const double v_200_101_0 = PB[2]*v_200_100_0 - PC2[l]*v_200_100_1;
+        const double v_200_101_1 = PB[2]*v_200_100_1 - PC2[l]*v_200_100_2;
+        const double v_200_111_0 = PB[1]*v_200_101_0 - PC1[l]*v_200_101_1;
+        const double v_200_001_0 = PB[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_200_001_1 = PB[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_200_002_0 = PB[2]*v_200_001_0 - PC2[l]*v_200_001_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_001_2 = PB[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_200_002_1 = PB[2]*v_200_001_1 - PC2[l]*v_200_001_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_100_001_1 = PB[2]*v_100_000_1 - PC2[l]*v_100_000_2;
+        const double v_100_002_0 = PB[2]*v_100_001_0 - PC2[l]*v_100_001_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_001_2 = PB[2]*v_100_000_2 - PC2[l]*v_100_000_3;
+        const double v_100_002_1 = PB[2]*v_100_001_1 - PC2[l]*v_100_001_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_200_102_0 = PB[0]*v_200_002_0 - PC0[l]*v_200_002_1 + 2*oo2p*(v_100_002_0 - v_100_002_1);
+        const double v_200_030_0 = PB[1]*v_200_020_0 - PC1[l]*v_200_020_1 + 2*oo2p*(v_200_010_0 - v_200_010_1);
+        const double v_200_021_0 = PB[2]*v_200_020_0 - PC2[l]*v_200_020_1;
+        const double v_200_012_0 = PB[1]*v_200_002_0 - PC1[l]*v_200_002_1;
+        const double v_200_003_0 = PB[2]*v_200_002_0 - PC2[l]*v_200_002_1 + 2*oo2p*(v_200_001_0 - v_200_001_1);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_100_0 = PB[0]*v_110_000_0 - PC0[l]*v_110_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_110_000_2 = PA[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_110_100_1 = PB[0]*v_110_000_1 - PC0[l]*v_110_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_100_1 = PB[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_200_0 = PB[0]*v_110_100_0 - PC0[l]*v_110_100_1 + 1*oo2p*(v_010_100_0 - v_010_100_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_110_000_3 = PA[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_110_100_2 = PB[0]*v_110_000_2 - PC0[l]*v_110_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_010_100_2 = PB[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_110_200_1 = PB[0]*v_110_100_1 - PC0[l]*v_110_100_2 + 1*oo2p*(v_010_100_1 - v_010_100_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_010_200_0 = PB[0]*v_010_100_0 - PC0[l]*v_010_100_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_200_1 = PB[0]*v_010_100_1 - PC0[l]*v_010_100_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_110_300_0 = PB[0]*v_110_200_0 - PC0[l]*v_110_200_1 + 1*oo2p*(v_010_200_0 - v_010_200_1) + 2*oo2p*(v_110_100_0 - v_110_100_1);
+        const double v_110_210_0 = PB[1]*v_110_200_0 - PC1[l]*v_110_200_1 + 1*oo2p*(v_100_200_0 - v_100_200_1);
+        const double v_110_201_0 = PB[2]*v_110_200_0 - PC2[l]*v_110_200_1;
+        const double v_110_010_0 = PB[1]*v_110_000_0 - PC1[l]*v_110_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_110_010_1 = PB[1]*v_110_000_1 - PC1[l]*v_110_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_110_020_0 = PB[1]*v_110_010_0 - PC1[l]*v_110_010_1 + 1*oo2p*(v_100_010_0 - v_100_010_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_010_2 = PB[1]*v_110_000_2 - PC1[l]*v_110_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_110_020_1 = PB[1]*v_110_010_1 - PC1[l]*v_110_010_2 + 1*oo2p*(v_100_010_1 - v_100_010_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_010_1 = PB[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_010_1 = PB[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_010_020_0 = PB[1]*v_010_010_0 - PC1[l]*v_010_010_1 + 1*oo2p*(v_000_010_0 - v_000_010_1) + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_010_2 = PB[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_010_2 = PB[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_010_020_1 = PB[1]*v_010_010_1 - PC1[l]*v_010_010_2 + 1*oo2p*(v_000_010_1 - v_000_010_2) + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_110_120_0 = PB[0]*v_110_020_0 - PC0[l]*v_110_020_1 + 1*oo2p*(v_010_020_0 - v_010_020_1);
+        const double v_110_110_0 = PB[0]*v_110_010_0 - PC0[l]*v_110_010_1 + 1*oo2p*(v_010_010_0 - v_010_010_1);
+        const double v_110_110_1 = PB[0]*v_110_010_1 - PC0[l]*v_110_010_2 + 1*oo2p*(v_010_010_1 - v_010_010_2);
+        const double v_110_111_0 = PB[2]*v_110_110_0 - PC2[l]*v_110_110_1;
+        const double v_110_001_0 = PB[2]*v_110_000_0 - PC2[l]*v_110_000_1;
+        const double v_110_001_1 = PB[2]*v_110_000_1 - PC2[l]*v_110_000_2;
+        const double v_110_002_0 = PB[2]*v_110_001_0 - PC2[l]*v_110_001_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_001_2 = PB[2]*v_110_000_2 - PC2[l]*v_110_000_3;
+        const double v_110_002_1 = PB[2]*v_110_001_1 - PC2[l]*v_110_001_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_010_001_1 = PB[2]*v_010_000_1 - PC2[l]*v_010_000_2;
+        const double v_010_002_0 = PB[2]*v_010_001_0 - PC2[l]*v_010_001_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_001_2 = PB[2]*v_010_000_2 - PC2[l]*v_010_000_3;
+        const double v_010_002_1 = PB[2]*v_010_001_1 - PC2[l]*v_010_001_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_110_102_0 = PB[0]*v_110_002_0 - PC0[l]*v_110_002_1 + 1*oo2p*(v_010_002_0 - v_010_002_1);
+        const double v_110_030_0 = PB[1]*v_110_020_0 - PC1[l]*v_110_020_1 + 1*oo2p*(v_100_020_0 - v_100_020_1) + 2*oo2p*(v_110_010_0 - v_110_010_1);
+        const double v_110_021_0 = PB[2]*v_110_020_0 - PC2[l]*v_110_020_1;
+        const double v_110_012_0 = PB[1]*v_110_002_0 - PC1[l]*v_110_002_1 + 1*oo2p*(v_100_002_0 - v_100_002_1);
+        const double v_110_003_0 = PB[2]*v_110_002_0 - PC2[l]*v_110_002_1 + 2*oo2p*(v_110_001_0 - v_110_001_1);
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_100_0 = PB[0]*v_101_000_0 - PC0[l]*v_101_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_101_000_2 = PA[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_101_100_1 = PB[0]*v_101_000_1 - PC0[l]*v_101_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_100_1 = PB[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_200_0 = PB[0]*v_101_100_0 - PC0[l]*v_101_100_1 + 1*oo2p*(v_001_100_0 - v_001_100_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_101_000_3 = PA[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_101_100_2 = PB[0]*v_101_000_2 - PC0[l]*v_101_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_100_2 = PB[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_101_200_1 = PB[0]*v_101_100_1 - PC0[l]*v_101_100_2 + 1*oo2p*(v_001_100_1 - v_001_100_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_001_200_0 = PB[0]*v_001_100_0 - PC0[l]*v_001_100_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_200_1 = PB[0]*v_001_100_1 - PC0[l]*v_001_100_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_101_300_0 = PB[0]*v_101_200_0 - PC0[l]*v_101_200_1 + 1*oo2p*(v_001_200_0 - v_001_200_1) + 2*oo2p*(v_101_100_0 - v_101_100_1);
+        const double v_101_210_0 = PB[1]*v_101_200_0 - PC1[l]*v_101_200_1;
+        const double v_101_201_0 = PB[2]*v_101_200_0 - PC2[l]*v_101_200_1 + 1*oo2p*(v_100_200_0 - v_100_200_1);
+        const double v_101_010_0 = PB[1]*v_101_000_0 - PC1[l]*v_101_000_1;
+        const double v_101_010_1 = PB[1]*v_101_000_1 - PC1[l]*v_101_000_2;
+        const double v_101_020_0 = PB[1]*v_101_010_0 - PC1[l]*v_101_010_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_010_2 = PB[1]*v_101_000_2 - PC1[l]*v_101_000_3;
+        const double v_101_020_1 = PB[1]*v_101_010_1 - PC1[l]*v_101_010_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_010_1 = PB[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_001_020_0 = PB[1]*v_001_010_0 - PC1[l]*v_001_010_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_010_2 = PB[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_001_020_1 = PB[1]*v_001_010_1 - PC1[l]*v_001_010_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_101_120_0 = PB[0]*v_101_020_0 - PC0[l]*v_101_020_1 + 1*oo2p*(v_001_020_0 - v_001_020_1);
+        const double v_101_001_0 = PB[2]*v_101_000_0 - PC2[l]*v_101_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_101_001_1 = PB[2]*v_101_000_1 - PC2[l]*v_101_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_001_1 = PB[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_101_101_0 = PB[0]*v_101_001_0 - PC0[l]*v_101_001_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_101_001_2 = PB[2]*v_101_000_2 - PC2[l]*v_101_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_001_001_2 = PB[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_101_101_1 = PB[0]*v_101_001_1 - PC0[l]*v_101_001_2 + 1*oo2p*(v_001_001_1 - v_001_001_2);
+        const double v_101_111_0 = PB[1]*v_101_101_0 - PC1[l]*v_101_101_1;
+        const double v_101_002_0 = PB[2]*v_101_001_0 - PC2[l]*v_101_001_1 + 1*oo2p*(v_100_001_0 - v_100_001_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_002_1 = PB[2]*v_101_001_1 - PC2[l]*v_101_001_2 + 1*oo2p*(v_100_001_1 - v_100_001_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_000_001_1 = PB[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_001_002_0 = PB[2]*v_001_001_0 - PC2[l]*v_001_001_1 + 1*oo2p*(v_000_001_0 - v_000_001_1) + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_000_001_2 = PB[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_001_002_1 = PB[2]*v_001_001_1 - PC2[l]*v_001_001_2 + 1*oo2p*(v_000_001_1 - v_000_001_2) + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_101_102_0 = PB[0]*v_101_002_0 - PC0[l]*v_101_002_1 + 1*oo2p*(v_001_002_0 - v_001_002_1);
+        const double v_101_030_0 = PB[1]*v_101_020_0 - PC1[l]*v_101_020_1 + 2*oo2p*(v_101_010_0 - v_101_010_1);
+        const double v_101_011_0 = PB[1]*v_101_001_0 - PC1[l]*v_101_001_1;
+        const double v_101_011_1 = PB[1]*v_101_001_1 - PC1[l]*v_101_001_2;
+        const double v_101_021_0 = PB[1]*v_101_011_0 - PC1[l]*v_101_011_1 + 1*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_101_012_0 = PB[1]*v_101_002_0 - PC1[l]*v_101_002_1;
+        const double v_101_003_0 = PB[2]*v_101_002_0 - PC2[l]*v_101_002_1 + 1*oo2p*(v_100_002_0 - v_100_002_1) + 2*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_020_100_0 = PB[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_020_100_1 = PB[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_020_200_0 = PB[0]*v_020_100_0 - PC0[l]*v_020_100_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_000_3 = PA[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_020_100_2 = PB[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_020_200_1 = PB[0]*v_020_100_1 - PC0[l]*v_020_100_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_300_0 = PB[0]*v_020_200_0 - PC0[l]*v_020_200_1 + 2*oo2p*(v_020_100_0 - v_020_100_1);
+        const double v_020_010_0 = PB[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_020_010_1 = PB[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_020_110_0 = PB[0]*v_020_010_0 - PC0[l]*v_020_010_1;
+        const double v_020_010_2 = PB[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_020_110_1 = PB[0]*v_020_010_1 - PC0[l]*v_020_010_2;
+        const double v_020_210_0 = PB[0]*v_020_110_0 - PC0[l]*v_020_110_1 + 1*oo2p*(v_020_010_0 - v_020_010_1);
+        const double v_020_201_0 = PB[2]*v_020_200_0 - PC2[l]*v_020_200_1;
+        const double v_020_020_0 = PB[1]*v_020_010_0 - PC1[l]*v_020_010_1 + 2*oo2p*(v_010_010_0 - v_010_010_1) + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_020_1 = PB[1]*v_020_010_1 - PC1[l]*v_020_010_2 + 2*oo2p*(v_010_010_1 - v_010_010_2) + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_120_0 = PB[0]*v_020_020_0 - PC0[l]*v_020_020_1;
+        const double v_020_011_0 = PB[2]*v_020_010_0 - PC2[l]*v_020_010_1;
+        const double v_020_011_1 = PB[2]*v_020_010_1 - PC2[l]*v_020_010_2;
+        const double v_020_111_0 = PB[0]*v_020_011_0 - PC0[l]*v_020_011_1;
+        const double v_020_001_0 = PB[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_020_001_1 = PB[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_020_002_0 = PB[2]*v_020_001_0 - PC2[l]*v_020_001_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_001_2 = PB[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_020_002_1 = PB[2]*v_020_001_1 - PC2[l]*v_020_001_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_102_0 = PB[0]*v_020_002_0 - PC0[l]*v_020_002_1;
+        const double v_020_030_0 = PB[1]*v_020_020_0 - PC1[l]*v_020_020_1 + 2*oo2p*(v_010_020_0 - v_010_020_1) + 2*oo2p*(v_020_010_0 - v_020_010_1);
+        const double v_020_021_0 = PB[2]*v_020_020_0 - PC2[l]*v_020_020_1;
+        const double v_020_012_0 = PB[1]*v_020_002_0 - PC1[l]*v_020_002_1 + 2*oo2p*(v_010_002_0 - v_010_002_1);
+        const double v_020_003_0 = PB[2]*v_020_002_0 - PC2[l]*v_020_002_1 + 2*oo2p*(v_020_001_0 - v_020_001_1);
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_011_100_0 = PB[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_011_100_1 = PB[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_011_200_0 = PB[0]*v_011_100_0 - PC0[l]*v_011_100_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_000_3 = PA[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_011_100_2 = PB[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_011_200_1 = PB[0]*v_011_100_1 - PC0[l]*v_011_100_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_300_0 = PB[0]*v_011_200_0 - PC0[l]*v_011_200_1 + 2*oo2p*(v_011_100_0 - v_011_100_1);
+        const double v_011_010_0 = PB[1]*v_011_000_0 - PC1[l]*v_011_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_011_010_1 = PB[1]*v_011_000_1 - PC1[l]*v_011_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_011_110_0 = PB[0]*v_011_010_0 - PC0[l]*v_011_010_1;
+        const double v_011_010_2 = PB[1]*v_011_000_2 - PC1[l]*v_011_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_011_110_1 = PB[0]*v_011_010_1 - PC0[l]*v_011_010_2;
+        const double v_011_210_0 = PB[0]*v_011_110_0 - PC0[l]*v_011_110_1 + 1*oo2p*(v_011_010_0 - v_011_010_1);
+        const double v_011_001_0 = PB[2]*v_011_000_0 - PC2[l]*v_011_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_011_001_1 = PB[2]*v_011_000_1 - PC2[l]*v_011_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_011_101_0 = PB[0]*v_011_001_0 - PC0[l]*v_011_001_1;
+        const double v_011_001_2 = PB[2]*v_011_000_2 - PC2[l]*v_011_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_011_101_1 = PB[0]*v_011_001_1 - PC0[l]*v_011_001_2;
+        const double v_011_201_0 = PB[0]*v_011_101_0 - PC0[l]*v_011_101_1 + 1*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_011_020_0 = PB[1]*v_011_010_0 - PC1[l]*v_011_010_1 + 1*oo2p*(v_001_010_0 - v_001_010_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_020_1 = PB[1]*v_011_010_1 - PC1[l]*v_011_010_2 + 1*oo2p*(v_001_010_1 - v_001_010_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_120_0 = PB[0]*v_011_020_0 - PC0[l]*v_011_020_1;
+        const double v_011_011_0 = PB[1]*v_011_001_0 - PC1[l]*v_011_001_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_011_011_1 = PB[1]*v_011_001_1 - PC1[l]*v_011_001_2 + 1*oo2p*(v_001_001_1 - v_001_001_2);
+        const double v_011_111_0 = PB[0]*v_011_011_0 - PC0[l]*v_011_011_1;
+        const double v_011_002_0 = PB[2]*v_011_001_0 - PC2[l]*v_011_001_1 + 1*oo2p*(v_010_001_0 - v_010_001_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_002_1 = PB[2]*v_011_001_1 - PC2[l]*v_011_001_2 + 1*oo2p*(v_010_001_1 - v_010_001_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_102_0 = PB[0]*v_011_002_0 - PC0[l]*v_011_002_1;
+        const double v_011_030_0 = PB[1]*v_011_020_0 - PC1[l]*v_011_020_1 + 1*oo2p*(v_001_020_0 - v_001_020_1) + 2*oo2p*(v_011_010_0 - v_011_010_1);
+        const double v_011_021_0 = PB[2]*v_011_020_0 - PC2[l]*v_011_020_1 + 1*oo2p*(v_010_020_0 - v_010_020_1);
+        const double v_011_012_0 = PB[1]*v_011_002_0 - PC1[l]*v_011_002_1 + 1*oo2p*(v_001_002_0 - v_001_002_1);
+        const double v_011_003_0 = PB[2]*v_011_002_0 - PC2[l]*v_011_002_1 + 1*oo2p*(v_010_002_0 - v_010_002_1) + 2*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_002_100_0 = PB[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_002_100_1 = PB[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_002_200_0 = PB[0]*v_002_100_0 - PC0[l]*v_002_100_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_000_3 = PA[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_002_100_2 = PB[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_002_200_1 = PB[0]*v_002_100_1 - PC0[l]*v_002_100_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_300_0 = PB[0]*v_002_200_0 - PC0[l]*v_002_200_1 + 2*oo2p*(v_002_100_0 - v_002_100_1);
+        const double v_002_210_0 = PB[1]*v_002_200_0 - PC1[l]*v_002_200_1;
+        const double v_002_001_0 = PB[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_002_001_1 = PB[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_002_101_0 = PB[0]*v_002_001_0 - PC0[l]*v_002_001_1;
+        const double v_002_001_2 = PB[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_002_101_1 = PB[0]*v_002_001_1 - PC0[l]*v_002_001_2;
+        const double v_002_201_0 = PB[0]*v_002_101_0 - PC0[l]*v_002_101_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_002_010_0 = PB[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_002_010_1 = PB[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_002_020_0 = PB[1]*v_002_010_0 - PC1[l]*v_002_010_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_010_2 = PB[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_002_020_1 = PB[1]*v_002_010_1 - PC1[l]*v_002_010_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_120_0 = PB[0]*v_002_020_0 - PC0[l]*v_002_020_1;
+        const double v_002_011_0 = PB[1]*v_002_001_0 - PC1[l]*v_002_001_1;
+        const double v_002_011_1 = PB[1]*v_002_001_1 - PC1[l]*v_002_001_2;
+        const double v_002_111_0 = PB[0]*v_002_011_0 - PC0[l]*v_002_011_1;
+        const double v_002_002_0 = PB[2]*v_002_001_0 - PC2[l]*v_002_001_1 + 2*oo2p*(v_001_001_0 - v_001_001_1) + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_002_1 = PB[2]*v_002_001_1 - PC2[l]*v_002_001_2 + 2*oo2p*(v_001_001_1 - v_001_001_2) + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_102_0 = PB[0]*v_002_002_0 - PC0[l]*v_002_002_1;
+        const double v_002_030_0 = PB[1]*v_002_020_0 - PC1[l]*v_002_020_1 + 2*oo2p*(v_002_010_0 - v_002_010_1);
+        const double v_002_021_0 = PB[1]*v_002_011_0 - PC1[l]*v_002_011_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_002_012_0 = PB[1]*v_002_002_0 - PC1[l]*v_002_002_1;
+        const double v_002_003_0 = PB[2]*v_002_002_0 - PC2[l]*v_002_002_1 + 2*oo2p*(v_001_002_0 - v_001_002_1) + 2*oo2p*(v_002_001_0 - v_002_001_1);
+
+        sum_0 += q[l]*v_200_300_0;
+        sum_1 += q[l]*v_200_210_0;
+        sum_2 += q[l]*v_200_201_0;
+        sum_3 += q[l]*v_200_120_0;
+        sum_4 += q[l]*v_200_111_0;
+        sum_5 += q[l]*v_200_102_0;
+        sum_6 += q[l]*v_200_030_0;
+        sum_7 += q[l]*v_200_021_0;
+        sum_8 += q[l]*v_200_012_0;
+        sum_9 += q[l]*v_200_003_0;
+        sum_10 += q[l]*v_110_300_0;
+        sum_11 += q[l]*v_110_210_0;
+        sum_12 += q[l]*v_110_201_0;
+        sum_13 += q[l]*v_110_120_0;
+        sum_14 += q[l]*v_110_111_0;
+        sum_15 += q[l]*v_110_102_0;
+        sum_16 += q[l]*v_110_030_0;
+        sum_17 += q[l]*v_110_021_0;
+        sum_18 += q[l]*v_110_012_0;
+        sum_19 += q[l]*v_110_003_0;
+        sum_20 += q[l]*v_101_300_0;
+        sum_21 += q[l]*v_101_210_0;
+        sum_22 += q[l]*v_101_201_0;
+        sum_23 += q[l]*v_101_120_0;
+        sum_24 += q[l]*v_101_111_0;
+        sum_25 += q[l]*v_101_102_0;
+        sum_26 += q[l]*v_101_030_0;
+        sum_27 += q[l]*v_101_021_0;
+        sum_28 += q[l]*v_101_012_0;
+        sum_29 += q[l]*v_101_003_0;
+        sum_30 += q[l]*v_020_300_0;
+        sum_31 += q[l]*v_020_210_0;
+        sum_32 += q[l]*v_020_201_0;
+        sum_33 += q[l]*v_020_120_0;
+        sum_34 += q[l]*v_020_111_0;
+        sum_35 += q[l]*v_020_102_0;
+        sum_36 += q[l]*v_020_030_0;
+        sum_37 += q[l]*v_020_021_0;
+        sum_38 += q[l]*v_020_012_0;
+        sum_39 += q[l]*v_020_003_0;
+        sum_40 += q[l]*v_011_300_0;
+        sum_41 += q[l]*v_011_210_0;
+        sum_42 += q[l]*v_011_201_0;
+        sum_43 += q[l]*v_011_120_0;
+        sum_44 += q[l]*v_011_111_0;
+        sum_45 += q[l]*v_011_102_0;
+        sum_46 += q[l]*v_011_030_0;
+        sum_47 += q[l]*v_011_021_0;
+        sum_48 += q[l]*v_011_012_0;
+        sum_49 += q[l]*v_011_003_0;
+        sum_50 += q[l]*v_002_300_0;
+        sum_51 += q[l]*v_002_210_0;
+        sum_52 += q[l]*v_002_201_0;
+        sum_53 += q[l]*v_002_120_0;
+        sum_54 += q[l]*v_002_111_0;
+        sum_55 += q[l]*v_002_102_0;
+        sum_56 += q[l]*v_002_030_0;
+        sum_57 += q[l]*v_002_021_0;
+        sum_58 += q[l]*v_002_012_0;
+        sum_59 += q[l]*v_002_003_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+    acc[45] += sum_45;
+    acc[46] += sum_46;
+    acc[47] += sum_47;
+    acc[48] += sum_48;
+    acc[49] += sum_49;
+    acc[50] += sum_50;
+    acc[51] += sum_51;
+    acc[52] += sum_52;
+    acc[53] += sum_53;
+    acc[54] += sum_54;
+    acc[55] += sum_55;
+    acc[56] += sum_56;
+    acc[57] += sum_57;
+    acc[58] += sum_58;
+    acc[59] += sum_59;
+}
+
+
+void potential_kernel_2_4(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+    double sum_45 = 0.0;
+    double sum_46 = 0.0;
+    double sum_47 = 0.0;
+    double sum_48 = 0.0;
+    double sum_49 = 0.0;
+    double sum_50 = 0.0;
+    double sum_51 = 0.0;
+    double sum_52 = 0.0;
+    double sum_53 = 0.0;
+    double sum_54 = 0.0;
+    double sum_55 = 0.0;
+    double sum_56 = 0.0;
+    double sum_57 = 0.0;
+    double sum_58 = 0.0;
+    double sum_59 = 0.0;
+    double sum_60 = 0.0;
+    double sum_61 = 0.0;
+    double sum_62 = 0.0;
+    double sum_63 = 0.0;
+    double sum_64 = 0.0;
+    double sum_65 = 0.0;
+    double sum_66 = 0.0;
+    double sum_67 = 0.0;
+    double sum_68 = 0.0;
+    double sum_69 = 0.0;
+    double sum_70 = 0.0;
+    double sum_71 = 0.0;
+    double sum_72 = 0.0;
+    double sum_73 = 0.0;
+    double sum_74 = 0.0;
+    double sum_75 = 0.0;
+    double sum_76 = 0.0;
+    double sum_77 = 0.0;
+    double sum_78 = 0.0;
+    double sum_79 = 0.0;
+    double sum_80 = 0.0;
+    double sum_81 = 0.0;
+    double sum_82 = 0.0;
+    double sum_83 = 0.0;
+    double sum_84 = 0.0;
+    double sum_85 = 0.0;
+    double sum_86 = 0.0;
+    double sum_87 = 0.0;
+    double sum_88 = 0.0;
+    double sum_89 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_100_0 = PB[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_200_100_1 = PB[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_100_100_1 = PB[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_200_0 = PB[0]*v_200_100_0 - PC0[l]*v_200_100_1 + 2*oo2p*(v_100_100_0 - v_100_100_1) + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_200_000_3 = PA[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_200_100_2 = PB[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_100_100_2 = PB[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_200_200_1 = PB[0]*v_200_100_1 - PC0[l]*v_200_100_2 + 2*oo2p*(v_100_100_1 - v_100_100_2) + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_100_1 = PB[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_200_0 = PB[0]*v_100_100_0 - PC0[l]*v_100_100_1 + 1*oo2p*(v_000_100_0 - v_000_100_1) + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_100_2 = PB[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_100_200_1 = PB[0]*v_100_100_1 - PC0[l]*v_100_100_2 + 1*oo2p*(v_000_100_1 - v_000_100_2) + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_200_300_0 = PB[0]*v_200_200_0 - PC0[l]*v_200_200_1 + 2*oo2p*(v_100_200_0 - v_100_200_1) + 2*oo2p*(v_200_100_0 - v_200_100_1);
+        const double v_000_000_6 = F[6*nb + l];
+        const double v_100_000_5 = PA[0]*v_000_000_5 - PC0[l]*v_000_000_6;
+        const double v_200_000_4 = PA[0]*v_100_000_4 - PC0[l]*v_100_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_200_100_3 = PB[0]*v_200_000_3 - PC0[l]*v_200_000_4 + 2*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_100_100_3 = PB[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_200_200_2 = PB[0]*v_200_100_2 - PC0[l]*v_200_100_3 + 2*oo2p*(v_100_100_2 - v_100_100_3) + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_000_100_3 = PB[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_100_200_2 = PB[0]*v_100_100_2 - PC0[l]*v_100_100_3 + 1*oo2p*(v_000_100_2 - v_000_100_3) + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_200_300_1 = PB[0]*v_200_200_1 - PC0[l]*v_200_200_2 + 2*oo2p*(v_100_200_1 - v_100_200_2) + 2*oo2p*(v_200_100_1 - v_200_100_2);
+        const double v_000_200_0 = PB[0]*v_000_100_0 - PC0[l]*v_000_100_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_200_1 = PB[0]*v_000_100_1 - PC0[l]*v_000_100_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_100_300_0 = PB[0]*v_100_200_0 - PC0[l]*v_100_200_1 + 1*oo2p*(v_000_200_0 - v_000_200_1) + 2*oo2p*(v_100_100_0 - v_100_100_1);
+        const double v_000_200_2 = PB[0]*v_000_100_2 - PC0[l]*v_000_100_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_100_300_1 = PB[0]*v_100_200_1 - PC0[l]*v_100_200_2 + 1*oo2p*(v_000_200_1 - v_000_200_2) + 2*oo2p*(v_100_100_1 - v_100_100_2);
+        const double v_200_400_0 = PB[0]*v_200_300_0 - PC0[l]*v_200_300_1 + 2*oo2p*(v_100_300_0 - v_100_300_1) + 3*oo2p*(v_200_200_0 - v_200_200_1);
+        const double v_200_310_0 = PB[1]*v_200_300_0 - PC1[l]*v_200_300_1;
+        const double v_200_301_0 = PB[2]*v_200_300_0 - PC2[l]*v_200_300_1;
+        const double v_200_210_0 = PB[1]*v_200_200_0 - PC1[l]*v_200_200_1;
+        const double v_200_210_1 = PB[1]*v_200_200_1 - PC1[l]*v_200_200_2;
+        const double v_200_220_0 = PB[1]*v_200_210_0 - PC1[l]*v_200_210_1 + 1*oo2p*(v_200_200_0 - v_200_200_1);
+        const double v_200_201_0 = PB[2]*v_200_200_0 - PC2[l]*v_200_200_1;
+        const double v_200_201_1 = PB[2]*v_200_200_1 - PC2[l]*v_200_200_2;
+        const double v_200_211_0 = PB[1]*v_200_201_0 - PC1[l]*v_200_201_1;
+        const double v_200_202_0 = PB[2]*v_200_201_0 - PC2[l]*v_200_201_1 + 1*oo2p*(v_200_200_0 - v_200_200_1);
+        const double v_200_010_0 = PB[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_200_010_1 = PB[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_200_020_0 = PB[1]*v_200_010_0 - PC1[l]*v_200_010_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_010_2 = PB[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_200_020_1 = PB[1]*v_200_010_1 - PC1[l]*v_200_010_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_200_030_0 = PB[1]*v_200_020_0 - PC1[l]*v_200_020_1 + 2*oo2p*(v_200_010_0 - v_200_010_1);
+        const double v_200_010_3 = PB[1]*v_200_000_3 - PC1[l]*v_200_000_4;
+        const double v_200_020_2 = PB[1]*v_200_010_2 - PC1[l]*v_200_010_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_200_030_1 = PB[1]*v_200_020_1 - PC1[l]*v_200_020_2 + 2*oo2p*(v_200_010_1 - v_200_010_2);
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_010_1 = PB[1]*v_100_000_1 - PC1[l]*v_100_000_2;
+        const double v_100_020_0 = PB[1]*v_100_010_0 - PC1[l]*v_100_010_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_010_2 = PB[1]*v_100_000_2 - PC1[l]*v_100_000_3;
+        const double v_100_020_1 = PB[1]*v_100_010_1 - PC1[l]*v_100_010_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_100_030_0 = PB[1]*v_100_020_0 - PC1[l]*v_100_020_1 + 2*oo2p*(v_100_010_0 - v_100_010_1);
+        const double v_100_010_3 = PB[1]*v_100_000_3 - PC1[l]*v_100_000_4;
+        const double v_100_020_2 = PB[1]*v_100_010_2 - PC1[l]*v_100_010_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_100_030_1 = PB[1]*v_100_020_1 - PC1[l]*v_100_020_2 + 2*oo2p*(v_100_010_1 - v_100_010_2);
+        const double v_200_130_0 = PB[0]*v_200_030_0 - PC0[l]*v_200_030_1 + 2*oo2p*(v_100_030_0 - v_100_030_1);
+        const double v_200_120_0 = PB[0]*v_200_020_0 - PC0[l]*v_200_020_1 + 2*oo2p*(v_100_020_0 - v_100_020_1);
+        const double v_200_120_1 = PB[0]*v_200_020_1 - PC0[l]*v_200_020_2 + 2*oo2p*(v_100_020_1 - v_100_020_2);
+        const double v_200_121_0 = PB[2]*v_200_120_0 - PC2[l]*v_200_120_1;
+        const double v_200_001_0 = PB[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_200_001_1 = PB[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_200_002_0 = PB[2]*v_200_001_0 - PC2[l]*v_200_001_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_001_2 = PB[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_200_002_1 = PB[2]*v_200_001_1 - PC2[l]*v_200_001_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_100_001_1 = PB[2]*v_100_000_1 - PC2[l]*v_100_000_2;
+        const double v_100_002_0 = PB[2]*v_100_001_0 - PC2[l]*v_100_001_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_001_2 = PB[2]*v_100_000_2 - PC2[l]*v_100_000_3;
+        const double v_100_002_1 = PB[2]*v_100_001_1 - PC2[l]*v_100_001_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_200_102_0 = PB[0]*v_200_002_0 - PC0[l]*v_200_002_1 + 2*oo2p*(v_100_002_0 - v_100_002_1);
+        const double v_200_001_3 = PB[2]*v_200_000_3 - PC2[l]*v_200_000_4;
+        const double v_200_002_2 = PB[2]*v_200_001_2 - PC2[l]*v_200_001_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_100_001_3 = PB[2]*v_100_000_3 - PC2[l]*v_100_000_4;
+        const double v_100_002_2 = PB[2]*v_100_001_2 - PC2[l]*v_100_001_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_200_102_1 = PB[0]*v_200_002_1 - PC0[l]*v_200_002_2 + 2*oo2p*(v_100_002_1 - v_100_002_2);
+        const double v_200_112_0 = PB[1]*v_200_102_0 - PC1[l]*v_200_102_1;
+        const double v_200_003_0 = PB[2]*v_200_002_0 - PC2[l]*v_200_002_1 + 2*oo2p*(v_200_001_0 - v_200_001_1);
+        const double v_200_003_1 = PB[2]*v_200_002_1 - PC2[l]*v_200_002_2 + 2*oo2p*(v_200_001_1 - v_200_001_2);
+        const double v_100_003_0 = PB[2]*v_100_002_0 - PC2[l]*v_100_002_1 + 2*oo2p*(v_100_001_0 - v_100_001_1);
+        const double v_100_003_1 = PB[2]*v_100_002_1 - PC2[l]*v_100_002_2 + 2*oo2p*(v_100_001_1 - v_100_001_2);
+        const double v_200_103_0 = PB[0]*v_200_003_0 - PC0[l]*v_200_003_1 + 2*oo2p*(v_100_003_0 - v_100_003_1);
+        const double v_200_040_0 = PB[1]*v_200_030_0 - PC1[l]*v_200_030_1 + 3*oo2p*(v_200_020_0 - v_200_020_1);
+        const double v_200_031_0 = PB[2]*v_200_030_0 - PC2[l]*v_200_030_1;
+        const double v_200_012_0 = PB[1]*v_200_002_0 - PC1[l]*v_200_002_1;
+        const double v_200_012_1 = PB[1]*v_200_002_1 - PC1[l]*v_200_002_2;
+        const double v_200_022_0 = PB[1]*v_200_012_0 - PC1[l]*v_200_012_1 + 1*oo2p*(v_200_002_0 - v_200_002_1);
+        const double v_200_013_0 = PB[1]*v_200_003_0 - PC1[l]*v_200_003_1;
+        const double v_200_004_0 = PB[2]*v_200_003_0 - PC2[l]*v_200_003_1 + 3*oo2p*(v_200_002_0 - v_200_002_1);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_100_0 = PB[0]*v_110_000_0 - PC0[l]*v_110_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_110_000_2 = PA[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_110_100_1 = PB[0]*v_110_000_1 - PC0[l]*v_110_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_100_1 = PB[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_200_0 = PB[0]*v_110_100_0 - PC0[l]*v_110_100_1 + 1*oo2p*(v_010_100_0 - v_010_100_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_110_000_3 = PA[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_110_100_2 = PB[0]*v_110_000_2 - PC0[l]*v_110_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_010_100_2 = PB[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_110_200_1 = PB[0]*v_110_100_1 - PC0[l]*v_110_100_2 + 1*oo2p*(v_010_100_1 - v_010_100_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_010_200_0 = PB[0]*v_010_100_0 - PC0[l]*v_010_100_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_200_1 = PB[0]*v_010_100_1 - PC0[l]*v_010_100_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_110_300_0 = PB[0]*v_110_200_0 - PC0[l]*v_110_200_1 + 1*oo2p*(v_010_200_0 - v_010_200_1) + 2*oo2p*(v_110_100_0 - v_110_100_1);
+        const double v_010_000_5 = PA[1]*v_000_000_5 - PC1[l]*v_000_000_6;
+        const double v_110_000_4 = PA[0]*v_010_000_4 - PC0[l]*v_010_000_5;
+        const double v_110_100_3 = PB[0]*v_110_000_3 - PC0[l]*v_110_000_4 + 1*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_010_100_3 = PB[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_110_200_2 = PB[0]*v_110_100_2 - PC0[l]*v_110_100_3 + 1*oo2p*(v_010_100_2 - v_010_100_3) + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_010_200_2 = PB[0]*v_010_100_2 - PC0[l]*v_010_100_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_110_300_1 = PB[0]*v_110_200_1 - PC0[l]*v_110_200_2 + 1*oo2p*(v_010_200_1 - v_010_200_2) + 2*oo2p*(v_110_100_1 - v_110_100_2);
+        const double v_010_300_0 = PB[0]*v_010_200_0 - PC0[l]*v_010_200_1 + 2*oo2p*(v_010_100_0 - v_010_100_1);
+        const double v_010_300_1 = PB[0]*v_010_200_1 - PC0[l]*v_010_200_2 + 2*oo2p*(v_010_100_1 - v_010_100_2);
+        const double v_110_400_0 = PB[0]*v_110_300_0 - PC0[l]*v_110_300_1 + 1*oo2p*(v_010_300_0 - v_010_300_1) + 3*oo2p*(v_110_200_0 - v_110_200_1);
+        const double v_110_310_0 = PB[1]*v_110_300_0 - PC1[l]*v_110_300_1 + 1*oo2p*(v_100_300_0 - v_100_300_1);
+        const double v_110_301_0 = PB[2]*v_110_300_0 - PC2[l]*v_110_300_1;
+        const double v_110_010_0 = PB[1]*v_110_000_0 - PC1[l]*v_110_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_110_010_1 = PB[1]*v_110_000_1 - PC1[l]*v_110_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_110_020_0 = PB[1]*v_110_010_0 - PC1[l]*v_110_010_1 + 1*oo2p*(v_100_010_0 - v_100_010_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_010_2 = PB[1]*v_110_000_2 - PC1[l]*v_110_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_110_020_1 = PB[1]*v_110_010_1 - PC1[l]*v_110_010_2 + 1*oo2p*(v_100_010_1 - v_100_010_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_010_1 = PB[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_010_1 = PB[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_010_020_0 = PB[1]*v_010_010_0 - PC1[l]*v_010_010_1 + 1*oo2p*(v_000_010_0 - v_000_010_1) + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_010_2 = PB[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_010_2 = PB[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_010_020_1 = PB[1]*v_010_010_1 - PC1[l]*v_010_010_2 + 1*oo2p*(v_000_010_1 - v_000_010_2) + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_110_120_0 = PB[0]*v_110_020_0 - PC0[l]*v_110_020_1 + 1*oo2p*(v_010_020_0 - v_010_020_1);
+        const double v_110_010_3 = PB[1]*v_110_000_3 - PC1[l]*v_110_000_4 + 1*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_110_020_2 = PB[1]*v_110_010_2 - PC1[l]*v_110_010_3 + 1*oo2p*(v_100_010_2 - v_100_010_3) + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_010_010_3 = PB[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_000_010_3 = PB[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_010_020_2 = PB[1]*v_010_010_2 - PC1[l]*v_010_010_3 + 1*oo2p*(v_000_010_2 - v_000_010_3) + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_110_120_1 = PB[0]*v_110_020_1 - PC0[l]*v_110_020_2 + 1*oo2p*(v_010_020_1 - v_010_020_2);
+        const double v_010_120_0 = PB[0]*v_010_020_0 - PC0[l]*v_010_020_1;
+        const double v_010_120_1 = PB[0]*v_010_020_1 - PC0[l]*v_010_020_2;
+        const double v_110_220_0 = PB[0]*v_110_120_0 - PC0[l]*v_110_120_1 + 1*oo2p*(v_010_120_0 - v_010_120_1) + 1*oo2p*(v_110_020_0 - v_110_020_1);
+        const double v_110_210_0 = PB[1]*v_110_200_0 - PC1[l]*v_110_200_1 + 1*oo2p*(v_100_200_0 - v_100_200_1);
+        const double v_110_210_1 = PB[1]*v_110_200_1 - PC1[l]*v_110_200_2 + 1*oo2p*(v_100_200_1 - v_100_200_2);
+        const double v_110_211_0 = PB[2]*v_110_210_0 - PC2[l]*v_110_210_1;
+        const double v_110_201_0 = PB[2]*v_110_200_0 - PC2[l]*v_110_200_1;
+        const double v_110_201_1 = PB[2]*v_110_200_1 - PC2[l]*v_110_200_2;
+        const double v_110_202_0 = PB[2]*v_110_201_0 - PC2[l]*v_110_201_1 + 1*oo2p*(v_110_200_0 - v_110_200_1);
+        const double v_110_030_0 = PB[1]*v_110_020_0 - PC1[l]*v_110_020_1 + 1*oo2p*(v_100_020_0 - v_100_020_1) + 2*oo2p*(v_110_010_0 - v_110_010_1);
+        const double v_110_030_1 = PB[1]*v_110_020_1 - PC1[l]*v_110_020_2 + 1*oo2p*(v_100_020_1 - v_100_020_2) + 2*oo2p*(v_110_010_1 - v_110_010_2);
+        const double v_000_020_0 = PB[1]*v_000_010_0 - PC1[l]*v_000_010_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_020_1 = PB[1]*v_000_010_1 - PC1[l]*v_000_010_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_010_030_0 = PB[1]*v_010_020_0 - PC1[l]*v_010_020_1 + 1*oo2p*(v_000_020_0 - v_000_020_1) + 2*oo2p*(v_010_010_0 - v_010_010_1);
+        const double v_000_020_2 = PB[1]*v_000_010_2 - PC1[l]*v_000_010_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_010_030_1 = PB[1]*v_010_020_1 - PC1[l]*v_010_020_2 + 1*oo2p*(v_000_020_1 - v_000_020_2) + 2*oo2p*(v_010_010_1 - v_010_010_2);
+        const double v_110_130_0 = PB[0]*v_110_030_0 - PC0[l]*v_110_030_1 + 1*oo2p*(v_010_030_0 - v_010_030_1);
+        const double v_110_121_0 = PB[2]*v_110_120_0 - PC2[l]*v_110_120_1;
+        const double v_110_001_0 = PB[2]*v_110_000_0 - PC2[l]*v_110_000_1;
+        const double v_110_001_1 = PB[2]*v_110_000_1 - PC2[l]*v_110_000_2;
+        const double v_110_002_0 = PB[2]*v_110_001_0 - PC2[l]*v_110_001_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_001_2 = PB[2]*v_110_000_2 - PC2[l]*v_110_000_3;
+        const double v_110_002_1 = PB[2]*v_110_001_1 - PC2[l]*v_110_001_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_110_012_0 = PB[1]*v_110_002_0 - PC1[l]*v_110_002_1 + 1*oo2p*(v_100_002_0 - v_100_002_1);
+        const double v_110_001_3 = PB[2]*v_110_000_3 - PC2[l]*v_110_000_4;
+        const double v_110_002_2 = PB[2]*v_110_001_2 - PC2[l]*v_110_001_3 + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_110_012_1 = PB[1]*v_110_002_1 - PC1[l]*v_110_002_2 + 1*oo2p*(v_100_002_1 - v_100_002_2);
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_010_001_1 = PB[2]*v_010_000_1 - PC2[l]*v_010_000_2;
+        const double v_010_002_0 = PB[2]*v_010_001_0 - PC2[l]*v_010_001_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_001_2 = PB[2]*v_010_000_2 - PC2[l]*v_010_000_3;
+        const double v_010_002_1 = PB[2]*v_010_001_1 - PC2[l]*v_010_001_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_000_001_1 = PB[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_000_002_0 = PB[2]*v_000_001_0 - PC2[l]*v_000_001_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_001_2 = PB[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_000_002_1 = PB[2]*v_000_001_1 - PC2[l]*v_000_001_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_010_012_0 = PB[1]*v_010_002_0 - PC1[l]*v_010_002_1 + 1*oo2p*(v_000_002_0 - v_000_002_1);
+        const double v_010_001_3 = PB[2]*v_010_000_3 - PC2[l]*v_010_000_4;
+        const double v_010_002_2 = PB[2]*v_010_001_2 - PC2[l]*v_010_001_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_000_001_3 = PB[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_000_002_2 = PB[2]*v_000_001_2 - PC2[l]*v_000_001_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_010_012_1 = PB[1]*v_010_002_1 - PC1[l]*v_010_002_2 + 1*oo2p*(v_000_002_1 - v_000_002_2);
+        const double v_110_112_0 = PB[0]*v_110_012_0 - PC0[l]*v_110_012_1 + 1*oo2p*(v_010_012_0 - v_010_012_1);
+        const double v_110_003_0 = PB[2]*v_110_002_0 - PC2[l]*v_110_002_1 + 2*oo2p*(v_110_001_0 - v_110_001_1);
+        const double v_110_003_1 = PB[2]*v_110_002_1 - PC2[l]*v_110_002_2 + 2*oo2p*(v_110_001_1 - v_110_001_2);
+        const double v_010_003_0 = PB[2]*v_010_002_0 - PC2[l]*v_010_002_1 + 2*oo2p*(v_010_001_0 - v_010_001_1);
+        const double v_010_003_1 = PB[2]*v_010_002_1 - PC2[l]*v_010_002_2 + 2*oo2p*(v_010_001_1 - v_010_001_2);
+        const double v_110_103_0 = PB[0]*v_110_003_0 - PC0[l]*v_110_003_1 + 1*oo2p*(v_010_003_0 - v_010_003_1);
+        const double v_110_040_0 = PB[1]*v_110_030_0 - PC1[l]*v_110_030_1 + 1*oo2p*(v_100_030_0 - v_100_030_1) + 3*oo2p*(v_110_020_0 - v_110_020_1);
+        const double v_110_031_0 = PB[2]*v_110_030_0 - PC2[l]*v_110_030_1;
+        const double v_110_021_0 = PB[2]*v_110_020_0 - PC2[l]*v_110_020_1;
+        const double v_110_021_1 = PB[2]*v_110_020_1 - PC2[l]*v_110_020_2;
+        const double v_110_022_0 = PB[2]*v_110_021_0 - PC2[l]*v_110_021_1 + 1*oo2p*(v_110_020_0 - v_110_020_1);
+        const double v_110_013_0 = PB[1]*v_110_003_0 - PC1[l]*v_110_003_1 + 1*oo2p*(v_100_003_0 - v_100_003_1);
+        const double v_110_004_0 = PB[2]*v_110_003_0 - PC2[l]*v_110_003_1 + 3*oo2p*(v_110_002_0 - v_110_002_1);
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_100_0 = PB[0]*v_101_000_0 - PC0[l]*v_101_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_101_000_2 = PA[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_101_100_1 = PB[0]*v_101_000_1 - PC0[l]*v_101_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_100_1 = PB[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_200_0 = PB[0]*v_101_100_0 - PC0[l]*v_101_100_1 + 1*oo2p*(v_001_100_0 - v_001_100_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_101_000_3 = PA[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_101_100_2 = PB[0]*v_101_000_2 - PC0[l]*v_101_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_100_2 = PB[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_101_200_1 = PB[0]*v_101_100_1 - PC0[l]*v_101_100_2 + 1*oo2p*(v_001_100_1 - v_001_100_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_001_200_0 = PB[0]*v_001_100_0 - PC0[l]*v_001_100_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_200_1 = PB[0]*v_001_100_1 - PC0[l]*v_001_100_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_101_300_0 = PB[0]*v_101_200_0 - PC0[l]*v_101_200_1 + 1*oo2p*(v_001_200_0 - v_001_200_1) + 2*oo2p*(v_101_100_0 - v_101_100_1);
+        const double v_001_000_5 = PA[2]*v_000_000_5 - PC2[l]*v_000_000_6;
+        const double v_101_000_4 = PA[0]*v_001_000_4 - PC0[l]*v_001_000_5;
+        const double v_101_100_3 = PB[0]*v_101_000_3 - PC0[l]*v_101_000_4 + 1*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_001_100_3 = PB[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_101_200_2 = PB[0]*v_101_100_2 - PC0[l]*v_101_100_3 + 1*oo2p*(v_001_100_2 - v_001_100_3) + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_001_200_2 = PB[0]*v_001_100_2 - PC0[l]*v_001_100_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_101_300_1 = PB[0]*v_101_200_1 - PC0[l]*v_101_200_2 + 1*oo2p*(v_001_200_1 - v_001_200_2) + 2*oo2p*(v_101_100_1 - v_101_100_2);
+        const double v_001_300_0 = PB[0]*v_001_200_0 - PC0[l]*v_001_200_1 + 2*oo2p*(v_001_100_0 - v_001_100_1);
+        const double v_001_300_1 = PB[0]*v_001_200_1 - PC0[l]*v_001_200_2 + 2*oo2p*(v_001_100_1 - v_001_100_2);
+        const double v_101_400_0 = PB[0]*v_101_300_0 - PC0[l]*v_101_300_1 + 1*oo2p*(v_001_300_0 - v_001_300_1) + 3*oo2p*(v_101_200_0 - v_101_200_1);
+        const double v_101_310_0 = PB[1]*v_101_300_0 - PC1[l]*v_101_300_1;
+        const double v_101_301_0 = PB[2]*v_101_300_0 - PC2[l]*v_101_300_1 + 1*oo2p*(v_100_300_0 - v_100_300_1);
+        const double v_101_210_0 = PB[1]*v_101_200_0 - PC1[l]*v_101_200_1;
+        const double v_101_210_1 = PB[1]*v_101_200_1 - PC1[l]*v_101_200_2;
+        const double v_101_220_0 = PB[1]*v_101_210_0 - PC1[l]*v_101_210_1 + 1*oo2p*(v_101_200_0 - v_101_200_1);
+        const double v_101_201_0 = PB[2]*v_101_200_0 - PC2[l]*v_101_200_1 + 1*oo2p*(v_100_200_0 - v_100_200_1);
+        const double v_101_201_1 = PB[2]*v_101_200_1 - PC2[l]*v_101_200_2 + 1*oo2p*(v_100_200_1 - v_100_200_2);
+        const double v_101_211_0 = PB[1]*v_101_201_0 - PC1[l]*v_101_201_1;
+        const double v_101_001_0 = PB[2]*v_101_000_0 - PC2[l]*v_101_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_101_001_1 = PB[2]*v_101_000_1 - PC2[l]*v_101_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_101_002_0 = PB[2]*v_101_001_0 - PC2[l]*v_101_001_1 + 1*oo2p*(v_100_001_0 - v_100_001_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_001_2 = PB[2]*v_101_000_2 - PC2[l]*v_101_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_101_002_1 = PB[2]*v_101_001_1 - PC2[l]*v_101_001_2 + 1*oo2p*(v_100_001_1 - v_100_001_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_001_1 = PB[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_001_002_0 = PB[2]*v_001_001_0 - PC2[l]*v_001_001_1 + 1*oo2p*(v_000_001_0 - v_000_001_1) + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_001_2 = PB[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_001_002_1 = PB[2]*v_001_001_1 - PC2[l]*v_001_001_2 + 1*oo2p*(v_000_001_1 - v_000_001_2) + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_101_102_0 = PB[0]*v_101_002_0 - PC0[l]*v_101_002_1 + 1*oo2p*(v_001_002_0 - v_001_002_1);
+        const double v_101_001_3 = PB[2]*v_101_000_3 - PC2[l]*v_101_000_4 + 1*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_101_002_2 = PB[2]*v_101_001_2 - PC2[l]*v_101_001_3 + 1*oo2p*(v_100_001_2 - v_100_001_3) + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_001_001_3 = PB[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_001_002_2 = PB[2]*v_001_001_2 - PC2[l]*v_001_001_3 + 1*oo2p*(v_000_001_2 - v_000_001_3) + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_101_102_1 = PB[0]*v_101_002_1 - PC0[l]*v_101_002_2 + 1*oo2p*(v_001_002_1 - v_001_002_2);
+        const double v_001_102_0 = PB[0]*v_001_002_0 - PC0[l]*v_001_002_1;
+        const double v_001_102_1 = PB[0]*v_001_002_1 - PC0[l]*v_001_002_2;
+        const double v_101_202_0 = PB[0]*v_101_102_0 - PC0[l]*v_101_102_1 + 1*oo2p*(v_001_102_0 - v_001_102_1) + 1*oo2p*(v_101_002_0 - v_101_002_1);
+        const double v_101_010_0 = PB[1]*v_101_000_0 - PC1[l]*v_101_000_1;
+        const double v_101_010_1 = PB[1]*v_101_000_1 - PC1[l]*v_101_000_2;
+        const double v_101_020_0 = PB[1]*v_101_010_0 - PC1[l]*v_101_010_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_010_2 = PB[1]*v_101_000_2 - PC1[l]*v_101_000_3;
+        const double v_101_020_1 = PB[1]*v_101_010_1 - PC1[l]*v_101_010_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_101_030_0 = PB[1]*v_101_020_0 - PC1[l]*v_101_020_1 + 2*oo2p*(v_101_010_0 - v_101_010_1);
+        const double v_101_010_3 = PB[1]*v_101_000_3 - PC1[l]*v_101_000_4;
+        const double v_101_020_2 = PB[1]*v_101_010_2 - PC1[l]*v_101_010_3 + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_101_030_1 = PB[1]*v_101_020_1 - PC1[l]*v_101_020_2 + 2*oo2p*(v_101_010_1 - v_101_010_2);
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_010_1 = PB[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_001_020_0 = PB[1]*v_001_010_0 - PC1[l]*v_001_010_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_010_2 = PB[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_001_020_1 = PB[1]*v_001_010_1 - PC1[l]*v_001_010_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_030_0 = PB[1]*v_001_020_0 - PC1[l]*v_001_020_1 + 2*oo2p*(v_001_010_0 - v_001_010_1);
+        const double v_001_010_3 = PB[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_001_020_2 = PB[1]*v_001_010_2 - PC1[l]*v_001_010_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_030_1 = PB[1]*v_001_020_1 - PC1[l]*v_001_020_2 + 2*oo2p*(v_001_010_1 - v_001_010_2);
+        const double v_101_130_0 = PB[0]*v_101_030_0 - PC0[l]*v_101_030_1 + 1*oo2p*(v_001_030_0 - v_001_030_1);
+        const double v_101_011_0 = PB[1]*v_101_001_0 - PC1[l]*v_101_001_1;
+        const double v_101_011_1 = PB[1]*v_101_001_1 - PC1[l]*v_101_001_2;
+        const double v_101_021_0 = PB[1]*v_101_011_0 - PC1[l]*v_101_011_1 + 1*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_101_011_2 = PB[1]*v_101_001_2 - PC1[l]*v_101_001_3;
+        const double v_101_021_1 = PB[1]*v_101_011_1 - PC1[l]*v_101_011_2 + 1*oo2p*(v_101_001_1 - v_101_001_2);
+        const double v_001_011_0 = PB[1]*v_001_001_0 - PC1[l]*v_001_001_1;
+        const double v_001_011_1 = PB[1]*v_001_001_1 - PC1[l]*v_001_001_2;
+        const double v_001_021_0 = PB[1]*v_001_011_0 - PC1[l]*v_001_011_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_001_011_2 = PB[1]*v_001_001_2 - PC1[l]*v_001_001_3;
+        const double v_001_021_1 = PB[1]*v_001_011_1 - PC1[l]*v_001_011_2 + 1*oo2p*(v_001_001_1 - v_001_001_2);
+        const double v_101_121_0 = PB[0]*v_101_021_0 - PC0[l]*v_101_021_1 + 1*oo2p*(v_001_021_0 - v_001_021_1);
+        const double v_101_112_0 = PB[1]*v_101_102_0 - PC1[l]*v_101_102_1;
+        const double v_101_003_0 = PB[2]*v_101_002_0 - PC2[l]*v_101_002_1 + 1*oo2p*(v_100_002_0 - v_100_002_1) + 2*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_101_003_1 = PB[2]*v_101_002_1 - PC2[l]*v_101_002_2 + 1*oo2p*(v_100_002_1 - v_100_002_2) + 2*oo2p*(v_101_001_1 - v_101_001_2);
+        const double v_001_003_0 = PB[2]*v_001_002_0 - PC2[l]*v_001_002_1 + 1*oo2p*(v_000_002_0 - v_000_002_1) + 2*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_001_003_1 = PB[2]*v_001_002_1 - PC2[l]*v_001_002_2 + 1*oo2p*(v_000_002_1 - v_000_002_2) + 2*oo2p*(v_001_001_1 - v_001_001_2);
+        const double v_101_103_0 = PB[0]*v_101_003_0 - PC0[l]*v_101_003_1 + 1*oo2p*(v_001_003_0 - v_001_003_1);
+        const double v_101_040_0 = PB[1]*v_101_030_0 - PC1[l]*v_101_030_1 + 3*oo2p*(v_101_020_0 - v_101_020_1);
+        const double v_101_031_0 = PB[1]*v_101_021_0 - PC1[l]*v_101_021_1 + 2*oo2p*(v_101_011_0 - v_101_011_1);
+        const double v_101_012_0 = PB[1]*v_101_002_0 - PC1[l]*v_101_002_1;
+        const double v_101_012_1 = PB[1]*v_101_002_1 - PC1[l]*v_101_002_2;
+        const double v_101_022_0 = PB[1]*v_101_012_0 - PC1[l]*v_101_012_1 + 1*oo2p*(v_101_002_0 - v_101_002_1);
+        const double v_101_013_0 = PB[1]*v_101_003_0 - PC1[l]*v_101_003_1;
+        const double v_101_004_0 = PB[2]*v_101_003_0 - PC2[l]*v_101_003_1 + 1*oo2p*(v_100_003_0 - v_100_003_1) + 3*oo2p*(v_101_002_0 - v_101_002_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_020_100_0 = PB[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_020_100_1 = PB[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_020_200_0 = PB[0]*v_020_100_0 - PC0[l]*v_020_100_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_000_3 = PA[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_020_100_2 = PB[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_020_200_1 = PB[0]*v_020_100_1 - PC0[l]*v_020_100_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_300_0 = PB[0]*v_020_200_0 - PC0[l]*v_020_200_1 + 2*oo2p*(v_020_100_0 - v_020_100_1);
+        const double v_020_000_4 = PA[1]*v_010_000_4 - PC1[l]*v_010_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_020_100_3 = PB[0]*v_020_000_3 - PC0[l]*v_020_000_4;
+        const double v_020_200_2 = PB[0]*v_020_100_2 - PC0[l]*v_020_100_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_020_300_1 = PB[0]*v_020_200_1 - PC0[l]*v_020_200_2 + 2*oo2p*(v_020_100_1 - v_020_100_2);
+        const double v_020_400_0 = PB[0]*v_020_300_0 - PC0[l]*v_020_300_1 + 3*oo2p*(v_020_200_0 - v_020_200_1);
+        const double v_020_010_0 = PB[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_020_010_1 = PB[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_020_110_0 = PB[0]*v_020_010_0 - PC0[l]*v_020_010_1;
+        const double v_020_010_2 = PB[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_020_110_1 = PB[0]*v_020_010_1 - PC0[l]*v_020_010_2;
+        const double v_020_210_0 = PB[0]*v_020_110_0 - PC0[l]*v_020_110_1 + 1*oo2p*(v_020_010_0 - v_020_010_1);
+        const double v_020_010_3 = PB[1]*v_020_000_3 - PC1[l]*v_020_000_4 + 2*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_020_110_2 = PB[0]*v_020_010_2 - PC0[l]*v_020_010_3;
+        const double v_020_210_1 = PB[0]*v_020_110_1 - PC0[l]*v_020_110_2 + 1*oo2p*(v_020_010_1 - v_020_010_2);
+        const double v_020_310_0 = PB[0]*v_020_210_0 - PC0[l]*v_020_210_1 + 2*oo2p*(v_020_110_0 - v_020_110_1);
+        const double v_020_301_0 = PB[2]*v_020_300_0 - PC2[l]*v_020_300_1;
+        const double v_020_020_0 = PB[1]*v_020_010_0 - PC1[l]*v_020_010_1 + 2*oo2p*(v_010_010_0 - v_010_010_1) + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_020_1 = PB[1]*v_020_010_1 - PC1[l]*v_020_010_2 + 2*oo2p*(v_010_010_1 - v_010_010_2) + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_120_0 = PB[0]*v_020_020_0 - PC0[l]*v_020_020_1;
+        const double v_020_020_2 = PB[1]*v_020_010_2 - PC1[l]*v_020_010_3 + 2*oo2p*(v_010_010_2 - v_010_010_3) + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_020_120_1 = PB[0]*v_020_020_1 - PC0[l]*v_020_020_2;
+        const double v_020_220_0 = PB[0]*v_020_120_0 - PC0[l]*v_020_120_1 + 1*oo2p*(v_020_020_0 - v_020_020_1);
+        const double v_020_211_0 = PB[2]*v_020_210_0 - PC2[l]*v_020_210_1;
+        const double v_020_001_0 = PB[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_020_001_1 = PB[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_020_002_0 = PB[2]*v_020_001_0 - PC2[l]*v_020_001_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_001_2 = PB[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_020_002_1 = PB[2]*v_020_001_1 - PC2[l]*v_020_001_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_102_0 = PB[0]*v_020_002_0 - PC0[l]*v_020_002_1;
+        const double v_020_001_3 = PB[2]*v_020_000_3 - PC2[l]*v_020_000_4;
+        const double v_020_002_2 = PB[2]*v_020_001_2 - PC2[l]*v_020_001_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_020_102_1 = PB[0]*v_020_002_1 - PC0[l]*v_020_002_2;
+        const double v_020_202_0 = PB[0]*v_020_102_0 - PC0[l]*v_020_102_1 + 1*oo2p*(v_020_002_0 - v_020_002_1);
+        const double v_020_030_0 = PB[1]*v_020_020_0 - PC1[l]*v_020_020_1 + 2*oo2p*(v_010_020_0 - v_010_020_1) + 2*oo2p*(v_020_010_0 - v_020_010_1);
+        const double v_020_030_1 = PB[1]*v_020_020_1 - PC1[l]*v_020_020_2 + 2*oo2p*(v_010_020_1 - v_010_020_2) + 2*oo2p*(v_020_010_1 - v_020_010_2);
+        const double v_020_130_0 = PB[0]*v_020_030_0 - PC0[l]*v_020_030_1;
+        const double v_020_021_0 = PB[2]*v_020_020_0 - PC2[l]*v_020_020_1;
+        const double v_020_021_1 = PB[2]*v_020_020_1 - PC2[l]*v_020_020_2;
+        const double v_020_121_0 = PB[0]*v_020_021_0 - PC0[l]*v_020_021_1;
+        const double v_020_012_0 = PB[1]*v_020_002_0 - PC1[l]*v_020_002_1 + 2*oo2p*(v_010_002_0 - v_010_002_1);
+        const double v_020_012_1 = PB[1]*v_020_002_1 - PC1[l]*v_020_002_2 + 2*oo2p*(v_010_002_1 - v_010_002_2);
+        const double v_020_112_0 = PB[0]*v_020_012_0 - PC0[l]*v_020_012_1;
+        const double v_020_003_0 = PB[2]*v_020_002_0 - PC2[l]*v_020_002_1 + 2*oo2p*(v_020_001_0 - v_020_001_1);
+        const double v_020_003_1 = PB[2]*v_020_002_1 - PC2[l]*v_020_002_2 + 2*oo2p*(v_020_001_1 - v_020_001_2);
+        const double v_020_103_0 = PB[0]*v_020_003_0 - PC0[l]*v_020_003_1;
+        const double v_020_040_0 = PB[1]*v_020_030_0 - PC1[l]*v_020_030_1 + 2*oo2p*(v_010_030_0 - v_010_030_1) + 3*oo2p*(v_020_020_0 - v_020_020_1);
+        const double v_020_031_0 = PB[2]*v_020_030_0 - PC2[l]*v_020_030_1;
+        const double v_020_022_0 = PB[2]*v_020_021_0 - PC2[l]*v_020_021_1 + 1*oo2p*(v_020_020_0 - v_020_020_1);
+        const double v_020_013_0 = PB[1]*v_020_003_0 - PC1[l]*v_020_003_1 + 2*oo2p*(v_010_003_0 - v_010_003_1);
+        const double v_020_004_0 = PB[2]*v_020_003_0 - PC2[l]*v_020_003_1 + 3*oo2p*(v_020_002_0 - v_020_002_1);
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_011_100_0 = PB[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_011_100_1 = PB[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_011_200_0 = PB[0]*v_011_100_0 - PC0[l]*v_011_100_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_000_3 = PA[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_011_100_2 = PB[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_011_200_1 = PB[0]*v_011_100_1 - PC0[l]*v_011_100_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_300_0 = PB[0]*v_011_200_0 - PC0[l]*v_011_200_1 + 2*oo2p*(v_011_100_0 - v_011_100_1);
+        const double v_011_000_4 = PA[1]*v_001_000_4 - PC1[l]*v_001_000_5;
+        const double v_011_100_3 = PB[0]*v_011_000_3 - PC0[l]*v_011_000_4;
+        const double v_011_200_2 = PB[0]*v_011_100_2 - PC0[l]*v_011_100_3 + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_011_300_1 = PB[0]*v_011_200_1 - PC0[l]*v_011_200_2 + 2*oo2p*(v_011_100_1 - v_011_100_2);
+        const double v_011_400_0 = PB[0]*v_011_300_0 - PC0[l]*v_011_300_1 + 3*oo2p*(v_011_200_0 - v_011_200_1);
+        const double v_011_010_0 = PB[1]*v_011_000_0 - PC1[l]*v_011_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_011_010_1 = PB[1]*v_011_000_1 - PC1[l]*v_011_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_011_110_0 = PB[0]*v_011_010_0 - PC0[l]*v_011_010_1;
+        const double v_011_010_2 = PB[1]*v_011_000_2 - PC1[l]*v_011_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_011_110_1 = PB[0]*v_011_010_1 - PC0[l]*v_011_010_2;
+        const double v_011_210_0 = PB[0]*v_011_110_0 - PC0[l]*v_011_110_1 + 1*oo2p*(v_011_010_0 - v_011_010_1);
+        const double v_011_010_3 = PB[1]*v_011_000_3 - PC1[l]*v_011_000_4 + 1*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_011_110_2 = PB[0]*v_011_010_2 - PC0[l]*v_011_010_3;
+        const double v_011_210_1 = PB[0]*v_011_110_1 - PC0[l]*v_011_110_2 + 1*oo2p*(v_011_010_1 - v_011_010_2);
+        const double v_011_310_0 = PB[0]*v_011_210_0 - PC0[l]*v_011_210_1 + 2*oo2p*(v_011_110_0 - v_011_110_1);
+        const double v_011_001_0 = PB[2]*v_011_000_0 - PC2[l]*v_011_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_011_001_1 = PB[2]*v_011_000_1 - PC2[l]*v_011_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_011_101_0 = PB[0]*v_011_001_0 - PC0[l]*v_011_001_1;
+        const double v_011_001_2 = PB[2]*v_011_000_2 - PC2[l]*v_011_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_011_101_1 = PB[0]*v_011_001_1 - PC0[l]*v_011_001_2;
+        const double v_011_201_0 = PB[0]*v_011_101_0 - PC0[l]*v_011_101_1 + 1*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_011_001_3 = PB[2]*v_011_000_3 - PC2[l]*v_011_000_4 + 1*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_011_101_2 = PB[0]*v_011_001_2 - PC0[l]*v_011_001_3;
+        const double v_011_201_1 = PB[0]*v_011_101_1 - PC0[l]*v_011_101_2 + 1*oo2p*(v_011_001_1 - v_011_001_2);
+        const double v_011_301_0 = PB[0]*v_011_201_0 - PC0[l]*v_011_201_1 + 2*oo2p*(v_011_101_0 - v_011_101_1);
+        const double v_011_020_0 = PB[1]*v_011_010_0 - PC1[l]*v_011_010_1 + 1*oo2p*(v_001_010_0 - v_001_010_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_020_1 = PB[1]*v_011_010_1 - PC1[l]*v_011_010_2 + 1*oo2p*(v_001_010_1 - v_001_010_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_120_0 = PB[0]*v_011_020_0 - PC0[l]*v_011_020_1;
+        const double v_011_020_2 = PB[1]*v_011_010_2 - PC1[l]*v_011_010_3 + 1*oo2p*(v_001_010_2 - v_001_010_3) + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_011_120_1 = PB[0]*v_011_020_1 - PC0[l]*v_011_020_2;
+        const double v_011_220_0 = PB[0]*v_011_120_0 - PC0[l]*v_011_120_1 + 1*oo2p*(v_011_020_0 - v_011_020_1);
+        const double v_011_011_0 = PB[1]*v_011_001_0 - PC1[l]*v_011_001_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_011_011_1 = PB[1]*v_011_001_1 - PC1[l]*v_011_001_2 + 1*oo2p*(v_001_001_1 - v_001_001_2);
+        const double v_011_111_0 = PB[0]*v_011_011_0 - PC0[l]*v_011_011_1;
+        const double v_011_011_2 = PB[1]*v_011_001_2 - PC1[l]*v_011_001_3 + 1*oo2p*(v_001_001_2 - v_001_001_3);
+        const double v_011_111_1 = PB[0]*v_011_011_1 - PC0[l]*v_011_011_2;
+        const double v_011_211_0 = PB[0]*v_011_111_0 - PC0[l]*v_011_111_1 + 1*oo2p*(v_011_011_0 - v_011_011_1);
+        const double v_011_002_0 = PB[2]*v_011_001_0 - PC2[l]*v_011_001_1 + 1*oo2p*(v_010_001_0 - v_010_001_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_002_1 = PB[2]*v_011_001_1 - PC2[l]*v_011_001_2 + 1*oo2p*(v_010_001_1 - v_010_001_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_102_0 = PB[0]*v_011_002_0 - PC0[l]*v_011_002_1;
+        const double v_011_002_2 = PB[2]*v_011_001_2 - PC2[l]*v_011_001_3 + 1*oo2p*(v_010_001_2 - v_010_001_3) + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_011_102_1 = PB[0]*v_011_002_1 - PC0[l]*v_011_002_2;
+        const double v_011_202_0 = PB[0]*v_011_102_0 - PC0[l]*v_011_102_1 + 1*oo2p*(v_011_002_0 - v_011_002_1);
+        const double v_011_030_0 = PB[1]*v_011_020_0 - PC1[l]*v_011_020_1 + 1*oo2p*(v_001_020_0 - v_001_020_1) + 2*oo2p*(v_011_010_0 - v_011_010_1);
+        const double v_011_030_1 = PB[1]*v_011_020_1 - PC1[l]*v_011_020_2 + 1*oo2p*(v_001_020_1 - v_001_020_2) + 2*oo2p*(v_011_010_1 - v_011_010_2);
+        const double v_011_130_0 = PB[0]*v_011_030_0 - PC0[l]*v_011_030_1;
+        const double v_011_021_0 = PB[2]*v_011_020_0 - PC2[l]*v_011_020_1 + 1*oo2p*(v_010_020_0 - v_010_020_1);
+        const double v_011_021_1 = PB[2]*v_011_020_1 - PC2[l]*v_011_020_2 + 1*oo2p*(v_010_020_1 - v_010_020_2);
+        const double v_011_121_0 = PB[0]*v_011_021_0 - PC0[l]*v_011_021_1;
+        const double v_011_012_0 = PB[1]*v_011_002_0 - PC1[l]*v_011_002_1 + 1*oo2p*(v_001_002_0 - v_001_002_1);
+        const double v_011_012_1 = PB[1]*v_011_002_1 - PC1[l]*v_011_002_2 + 1*oo2p*(v_001_002_1 - v_001_002_2);
+        const double v_011_112_0 = PB[0]*v_011_012_0 - PC0[l]*v_011_012_1;
+        const double v_011_003_0 = PB[2]*v_011_002_0 - PC2[l]*v_011_002_1 + 1*oo2p*(v_010_002_0 - v_010_002_1) + 2*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_011_003_1 = PB[2]*v_011_002_1 - PC2[l]*v_011_002_2 + 1*oo2p*(v_010_002_1 - v_010_002_2) + 2*oo2p*(v_011_001_1 - v_011_001_2);
+        const double v_011_103_0 = PB[0]*v_011_003_0 - PC0[l]*v_011_003_1;
+        const double v_011_040_0 = PB[1]*v_011_030_0 - PC1[l]*v_011_030_1 + 1*oo2p*(v_001_030_0 - v_001_030_1) + 3*oo2p*(v_011_020_0 - v_011_020_1);
+        const double v_011_031_0 = PB[2]*v_011_030_0 - PC2[l]*v_011_030_1 + 1*oo2p*(v_010_030_0 - v_010_030_1);
+        const double v_001_012_0 = PB[1]*v_001_002_0 - PC1[l]*v_001_002_1;
+        const double v_001_012_1 = PB[1]*v_001_002_1 - PC1[l]*v_001_002_2;
+        const double v_011_022_0 = PB[1]*v_011_012_0 - PC1[l]*v_011_012_1 + 1*oo2p*(v_001_012_0 - v_001_012_1) + 1*oo2p*(v_011_002_0 - v_011_002_1);
+        const double v_011_013_0 = PB[1]*v_011_003_0 - PC1[l]*v_011_003_1 + 1*oo2p*(v_001_003_0 - v_001_003_1);
+        const double v_011_004_0 = PB[2]*v_011_003_0 - PC2[l]*v_011_003_1 + 1*oo2p*(v_010_003_0 - v_010_003_1) + 3*oo2p*(v_011_002_0 - v_011_002_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_002_100_0 = PB[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_002_100_1 = PB[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_002_200_0 = PB[0]*v_002_100_0 - PC0[l]*v_002_100_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_000_3 = PA[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_002_100_2 = PB[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_002_200_1 = PB[0]*v_002_100_1 - PC0[l]*v_002_100_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_300_0 = PB[0]*v_002_200_0 - PC0[l]*v_002_200_1 + 2*oo2p*(v_002_100_0 - v_002_100_1);
+        const double v_002_000_4 = PA[2]*v_001_000_4 - PC2[l]*v_001_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_002_100_3 = PB[0]*v_002_000_3 - PC0[l]*v_002_000_4;
+        const double v_002_200_2 = PB[0]*v_002_100_2 - PC0[l]*v_002_100_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_002_300_1 = PB[0]*v_002_200_1 - PC0[l]*v_002_200_2 + 2*oo2p*(v_002_100_1 - v_002_100_2);
+        const double v_002_400_0 = PB[0]*v_002_300_0 - PC0[l]*v_002_300_1 + 3*oo2p*(v_002_200_0 - v_002_200_1);
+        const double v_002_310_0 = PB[1]*v_002_300_0 - PC1[l]*v_002_300_1;
+        const double v_002_001_0 = PB[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_002_001_1 = PB[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_002_101_0 = PB[0]*v_002_001_0 - PC0[l]*v_002_001_1;
+        const double v_002_001_2 = PB[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_002_101_1 = PB[0]*v_002_001_1 - PC0[l]*v_002_001_2;
+        const double v_002_201_0 = PB[0]*v_002_101_0 - PC0[l]*v_002_101_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_002_001_3 = PB[2]*v_002_000_3 - PC2[l]*v_002_000_4 + 2*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_002_101_2 = PB[0]*v_002_001_2 - PC0[l]*v_002_001_3;
+        const double v_002_201_1 = PB[0]*v_002_101_1 - PC0[l]*v_002_101_2 + 1*oo2p*(v_002_001_1 - v_002_001_2);
+        const double v_002_301_0 = PB[0]*v_002_201_0 - PC0[l]*v_002_201_1 + 2*oo2p*(v_002_101_0 - v_002_101_1);
+        const double v_002_010_0 = PB[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_002_010_1 = PB[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_002_020_0 = PB[1]*v_002_010_0 - PC1[l]*v_002_010_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_010_2 = PB[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_002_020_1 = PB[1]*v_002_010_1 - PC1[l]*v_002_010_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_120_0 = PB[0]*v_002_020_0 - PC0[l]*v_002_020_1;
+        const double v_002_010_3 = PB[1]*v_002_000_3 - PC1[l]*v_002_000_4;
+        const double v_002_020_2 = PB[1]*v_002_010_2 - PC1[l]*v_002_010_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_002_120_1 = PB[0]*v_002_020_1 - PC0[l]*v_002_020_2;
+        const double v_002_220_0 = PB[0]*v_002_120_0 - PC0[l]*v_002_120_1 + 1*oo2p*(v_002_020_0 - v_002_020_1);
+        const double v_002_211_0 = PB[1]*v_002_201_0 - PC1[l]*v_002_201_1;
+        const double v_002_002_0 = PB[2]*v_002_001_0 - PC2[l]*v_002_001_1 + 2*oo2p*(v_001_001_0 - v_001_001_1) + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_002_1 = PB[2]*v_002_001_1 - PC2[l]*v_002_001_2 + 2*oo2p*(v_001_001_1 - v_001_001_2) + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_102_0 = PB[0]*v_002_002_0 - PC0[l]*v_002_002_1;
+        const double v_002_002_2 = PB[2]*v_002_001_2 - PC2[l]*v_002_001_3 + 2*oo2p*(v_001_001_2 - v_001_001_3) + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_002_102_1 = PB[0]*v_002_002_1 - PC0[l]*v_002_002_2;
+        const double v_002_202_0 = PB[0]*v_002_102_0 - PC0[l]*v_002_102_1 + 1*oo2p*(v_002_002_0 - v_002_002_1);
+        const double v_002_030_0 = PB[1]*v_002_020_0 - PC1[l]*v_002_020_1 + 2*oo2p*(v_002_010_0 - v_002_010_1);
+        const double v_002_030_1 = PB[1]*v_002_020_1 - PC1[l]*v_002_020_2 + 2*oo2p*(v_002_010_1 - v_002_010_2);
+        const double v_002_130_0 = PB[0]*v_002_030_0 - PC0[l]*v_002_030_1;
+        const double v_002_011_0 = PB[1]*v_002_001_0 - PC1[l]*v_002_001_1;
+        const double v_002_011_1 = PB[1]*v_002_001_1 - PC1[l]*v_002_001_2;
+        const double v_002_021_0 = PB[1]*v_002_011_0 - PC1[l]*v_002_011_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_002_011_2 = PB[1]*v_002_001_2 - PC1[l]*v_002_001_3;
+        const double v_002_021_1 = PB[1]*v_002_011_1 - PC1[l]*v_002_011_2 + 1*oo2p*(v_002_001_1 - v_002_001_2);
+        const double v_002_121_0 = PB[0]*v_002_021_0 - PC0[l]*v_002_021_1;
+        const double v_002_012_0 = PB[1]*v_002_002_0 - PC1[l]*v_002_002_1;
+        const double v_002_012_1 = PB[1]*v_002_002_1 - PC1[l]*v_002_002_2;
+        const double v_002_112_0 = PB[0]*v_002_012_0 - PC0[l]*v_002_012_1;
+        const double v_002_003_0 = PB[2]*v_002_002_0 - PC2[l]*v_002_002_1 + 2*oo2p*(v_001_002_0 - v_001_002_1) + 2*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_002_003_1 = PB[2]*v_002_002_1 - PC2[l]*v_002_002_2 + 2*oo2p*(v_001_002_1 - v_001_002_2) + 2*oo2p*(v_002_001_1 - v_002_001_2);
+        const double v_002_103_0 = PB[0]*v_002_003_0 - PC0[l]*v_002_003_1;
+        const double v_002_040_0 = PB[1]*v_002_030_0 - PC1[l]*v_002_030_1 + 3*oo2p*(v_002_020_0 - v_002_020_1);
+        const double v_002_031_0 = PB[1]*v_002_021_0 - PC1[l]*v_002_021_1 + 2*oo2p*(v_002_011_0 - v_002_011_1);
+        const double v_002_022_0 = PB[1]*v_002_012_0 - PC1[l]*v_002_012_1 + 1*oo2p*(v_002_002_0 - v_002_002_1);
+        const double v_002_013_0 = PB[1]*v_002_003_0 - PC1[l]*v_002_003_1;
+        const double v_002_004_0 = PB[2]*v_002_003_0 - PC2[l]*v_002_003_1 + 2*oo2p*(v_001_003_0 - v_001_003_1) + 3*oo2p*(v_002_002_0 - v_002_002_1);
+
+        sum_0 += q[l]*v_200_400_0;
+        sum_1 += q[l]*v_200_310_0;
+        sum_2 += q[l]*v_200_301_0;
+        sum_3 += q[l]*v_200_220_0;
+        sum_4 += q[l]*v_200_211_0;
+        sum_5 += q[l]*v_200_202_0;
+        sum_6 += q[l]*v_200_130_0;
+        sum_7 += q[l]*v_200_121_0;
+        sum_8 += q[l]*v_200_112_0;
+        sum_9 += q[l]*v_200_103_0;
+        sum_10 += q[l]*v_200_040_0;
+        sum_11 += q[l]*v_200_031_0;
+        sum_12 += q[l]*v_200_022_0;
+        sum_13 += q[l]*v_200_013_0;
+        sum_14 += q[l]*v_200_004_0;
+        sum_15 += q[l]*v_110_400_0;
+        sum_16 += q[l]*v_110_310_0;
+        sum_17 += q[l]*v_110_301_0;
+        sum_18 += q[l]*v_110_220_0;
+        sum_19 += q[l]*v_110_211_0;
+        sum_20 += q[l]*v_110_202_0;
+        sum_21 += q[l]*v_110_130_0;
+        sum_22 += q[l]*v_110_121_0;
+        sum_23 += q[l]*v_110_112_0;
+        sum_24 += q[l]*v_110_103_0;
+        sum_25 += q[l]*v_110_040_0;
+        sum_26 += q[l]*v_110_031_0;
+        sum_27 += q[l]*v_110_022_0;
+        sum_28 += q[l]*v_110_013_0;
+        sum_29 += q[l]*v_110_004_0;
+        sum_30 += q[l]*v_101_400_0;
+        sum_31 += q[l]*v_101_310_0;
+        sum_32 += q[l]*v_101_301_0;
+        sum_33 += q[l]*v_101_220_0;
+        sum_34 += q[l]*v_101_211_0;
+        sum_35 += q[l]*v_101_202_0;
+        sum_36 += q[l]*v_101_130_0;
+        sum_37 += q[l]*v_101_121_0;
+        sum_38 += q[l]*v_101_112_0;
+        sum_39 += q[l]*v_101_103_0;
+        sum_40 += q[l]*v_101_040_0;
+        sum_41 += q[l]*v_101_031_0;
+        sum_42 += q[l]*v_101_022_0;
+        sum_43 += q[l]*v_101_013_0;
+        sum_44 += q[l]*v_101_004_0;
+        sum_45 += q[l]*v_020_400_0;
+        sum_46 += q[l]*v_020_310_0;
+        sum_47 += q[l]*v_020_301_0;
+        sum_48 += q[l]*v_020_220_0;
+        sum_49 += q[l]*v_020_211_0;
+        sum_50 += q[l]*v_020_202_0;
+        sum_51 += q[l]*v_020_130_0;
+        sum_52 += q[l]*v_020_121_0;
+        sum_53 += q[l]*v_020_112_0;
+        sum_54 += q[l]*v_020_103_0;
+        sum_55 += q[l]*v_020_040_0;
+        sum_56 += q[l]*v_020_031_0;
+        sum_57 += q[l]*v_020_022_0;
+        sum_58 += q[l]*v_020_013_0;
+        sum_59 += q[l]*v_020_004_0;
+        sum_60 += q[l]*v_011_400_0;
+        sum_61 += q[l]*v_011_310_0;
+        sum_62 += q[l]*v_011_301_0;
+        sum_63 += q[l]*v_011_220_0;
+        sum_64 += q[l]*v_011_211_0;
+        sum_65 += q[l]*v_011_202_0;
+        sum_66 += q[l]*v_011_130_0;
+        sum_67 += q[l]*v_011_121_0;
+        sum_68 += q[l]*v_011_112_0;
+        sum_69 += q[l]*v_011_103_0;
+        sum_70 += q[l]*v_011_040_0;
+        sum_71 += q[l]*v_011_031_0;
+        sum_72 += q[l]*v_011_022_0;
+        sum_73 += q[l]*v_011_013_0;
+        sum_74 += q[l]*v_011_004_0;
+        sum_75 += q[l]*v_002_400_0;
+        sum_76 += q[l]*v_002_310_0;
+        sum_77 += q[l]*v_002_301_0;
+        sum_78 += q[l]*v_002_220_0;
+        sum_79 += q[l]*v_002_211_0;
+        sum_80 += q[l]*v_002_202_0;
+        sum_81 += q[l]*v_002_130_0;
+        sum_82 += q[l]*v_002_121_0;
+        sum_83 += q[l]*v_002_112_0;
+        sum_84 += q[l]*v_002_103_0;
+        sum_85 += q[l]*v_002_040_0;
+        sum_86 += q[l]*v_002_031_0;
+        sum_87 += q[l]*v_002_022_0;
+        sum_88 += q[l]*v_002_013_0;
+        sum_89 += q[l]*v_002_004_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+    acc[45] += sum_45;
+    acc[46] += sum_46;
+    acc[47] += sum_47;
+    acc[48] += sum_48;
+    acc[49] += sum_49;
+    acc[50] += sum_50;
+    acc[51] += sum_51;
+    acc[52] += sum_52;
+    acc[53] += sum_53;
+    acc[54] += sum_54;
+    acc[55] += sum_55;
+    acc[56] += sum_56;
+    acc[57] += sum_57;
+    acc[58] += sum_58;
+    acc[59] += sum_59;
+    acc[60] += sum_60;
+    acc[61] += sum_61;
+    acc[62] += sum_62;
+    acc[63] += sum_63;
+    acc[64] += sum_64;
+    acc[65] += sum_65;
+    acc[66] += sum_66;
+    acc[67] += sum_67;
+    acc[68] += sum_68;
+    acc[69] += sum_69;
+    acc[70] += sum_70;
+    acc[71] += sum_71;
+    acc[72] += sum_72;
+    acc[73] += sum_73;
+    acc[74] += sum_74;
+    acc[75] += sum_75;
+    acc[76] += sum_76;
+    acc[77] += sum_77;
+    acc[78] += sum_78;
+    acc[79] += sum_79;
+    acc[80] += sum_80;
+    acc[81] += sum_81;
+    acc[82] += sum_82;
+    acc[83] += sum_83;
+    acc[84] += sum_84;
+    acc[85] += sum_85;
+    acc[86] += sum_86;
+    acc[87] += sum_87;
+    acc[88] += sum_88;
+    acc[89] += sum_89;
+}
+
+
+void potential_kernel_3_0(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_210_000_0 = PA[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_111_000_0 = PA[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+
+        sum_0 += q[l]*v_300_000_0;
+        sum_1 += q[l]*v_210_000_0;
+        sum_2 += q[l]*v_201_000_0;
+        sum_3 += q[l]*v_120_000_0;
+        sum_4 += q[l]*v_111_000_0;
+        sum_5 += q[l]*v_102_000_0;
+        sum_6 += q[l]*v_030_000_0;
+        sum_7 += q[l]*v_021_000_0;
+        sum_8 += q[l]*v_012_000_0;
+        sum_9 += q[l]*v_003_000_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+}
+
+
+void potential_kernel_3_1(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_300_000_1 = PA[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_300_100_0 = PB[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_300_010_0 = PB[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_300_001_0 = PB[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_210_000_0 = PA[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_210_000_1 = PA[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_210_100_0 = PB[0]*v_210_000_0 - PC0[l]*v_210_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_210_010_0 = PB[1]*v_210_000_0 - PC1[l]*v_210_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_210_001_0 = PB[2]*v_210_000_0 - PC2[l]*v_210_000_1;
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_201_000_1 = PA[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_201_100_0 = PB[0]*v_201_000_0 - PC0[l]*v_201_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_201_010_0 = PB[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_201_001_0 = PB[2]*v_201_000_0 - PC2[l]*v_201_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_120_000_1 = PA[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_120_100_0 = PB[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_120_010_0 = PB[1]*v_120_000_0 - PC1[l]*v_120_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_120_001_0 = PB[2]*v_120_000_0 - PC2[l]*v_120_000_1;
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_111_000_0 = PA[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_111_000_1 = PA[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_111_100_0 = PB[0]*v_111_000_0 - PC0[l]*v_111_000_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_111_010_0 = PB[1]*v_111_000_0 - PC1[l]*v_111_000_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_111_001_0 = PB[2]*v_111_000_0 - PC2[l]*v_111_000_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_102_000_1 = PA[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_102_100_0 = PB[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_102_010_0 = PB[1]*v_102_000_0 - PC1[l]*v_102_000_1;
+        const double v_102_001_0 = PB[2]*v_102_000_0 - PC2[l]*v_102_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_030_000_1 = PA[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_030_100_0 = PB[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_010_0 = PB[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_030_001_0 = PB[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_021_000_1 = PA[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_021_100_0 = PB[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_010_0 = PB[1]*v_021_000_0 - PC1[l]*v_021_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_021_001_0 = PB[2]*v_021_000_0 - PC2[l]*v_021_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_012_000_1 = PA[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_012_100_0 = PB[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_010_0 = PB[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_012_001_0 = PB[2]*v_012_000_0 - PC2[l]*v_012_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_003_000_1 = PA[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_003_100_0 = PB[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_010_0 = PB[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_003_001_0 = PB[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+
+        sum_0 += q[l]*v_300_100_0;
+        sum_1 += q[l]*v_300_010_0;
+        sum_2 += q[l]*v_300_001_0;
+        sum_3 += q[l]*v_210_100_0;
+        sum_4 += q[l]*v_210_010_0;
+        sum_5 += q[l]*v_210_001_0;
+        sum_6 += q[l]*v_201_100_0;
+        sum_7 += q[l]*v_201_010_0;
+        sum_8 += q[l]*v_201_001_0;
+        sum_9 += q[l]*v_120_100_0;
+        sum_10 += q[l]*v_120_010_0;
+        sum_11 += q[l]*v_120_001_0;
+        sum_12 += q[l]*v_111_100_0;
+        sum_13 += q[l]*v_111_010_0;
+        sum_14 += q[l]*v_111_001_0;
+        sum_15 += q[l]*v_102_100_0;
+        sum_16 += q[l]*v_102_010_0;
+        sum_17 += q[l]*v_102_001_0;
+        sum_18 += q[l]*v_030_100_0;
+        sum_19 += q[l]*v_030_010_0;
+        sum_20 += q[l]*v_030_001_0;
+        sum_21 += q[l]*v_021_100_0;
+        sum_22 += q[l]*v_021_010_0;
+        sum_23 += q[l]*v_021_001_0;
+        sum_24 += q[l]*v_012_100_0;
+        sum_25 += q[l]*v_012_010_0;
+        sum_26 += q[l]*v_012_001_0;
+        sum_27 += q[l]*v_003_100_0;
+        sum_28 += q[l]*v_003_010_0;
+        sum_29 += q[l]*v_003_001_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+}
+
+
+void potential_kernel_3_2(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+    double sum_45 = 0.0;
+    double sum_46 = 0.0;
+    double sum_47 = 0.0;
+    double sum_48 = 0.0;
+    double sum_49 = 0.0;
+    double sum_50 = 0.0;
+    double sum_51 = 0.0;
+    double sum_52 = 0.0;
+    double sum_53 = 0.0;
+    double sum_54 = 0.0;
+    double sum_55 = 0.0;
+    double sum_56 = 0.0;
+    double sum_57 = 0.0;
+    double sum_58 = 0.0;
+    double sum_59 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_300_000_1 = PA[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_300_100_0 = PB[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_200_000_3 = PA[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_300_000_2 = PA[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_300_100_1 = PB[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_200_100_0 = PB[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_200_100_1 = PB[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_300_200_0 = PB[0]*v_300_100_0 - PC0[l]*v_300_100_1 + 3*oo2p*(v_200_100_0 - v_200_100_1) + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_110_0 = PB[1]*v_300_100_0 - PC1[l]*v_300_100_1;
+        const double v_300_101_0 = PB[2]*v_300_100_0 - PC2[l]*v_300_100_1;
+        const double v_300_010_0 = PB[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_300_010_1 = PB[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_300_020_0 = PB[1]*v_300_010_0 - PC1[l]*v_300_010_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_001_0 = PB[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_300_001_1 = PB[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_300_011_0 = PB[1]*v_300_001_0 - PC1[l]*v_300_001_1;
+        const double v_300_002_0 = PB[2]*v_300_001_0 - PC2[l]*v_300_001_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_210_000_0 = PA[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_210_000_1 = PA[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_210_100_0 = PB[0]*v_210_000_0 - PC0[l]*v_210_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_210_000_2 = PA[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_110_000_2 = PA[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_210_100_1 = PB[0]*v_210_000_1 - PC0[l]*v_210_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_110_100_0 = PB[0]*v_110_000_0 - PC0[l]*v_110_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_110_100_1 = PB[0]*v_110_000_1 - PC0[l]*v_110_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_210_200_0 = PB[0]*v_210_100_0 - PC0[l]*v_210_100_1 + 2*oo2p*(v_110_100_0 - v_110_100_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_010_0 = PB[1]*v_210_000_0 - PC1[l]*v_210_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_210_010_1 = PB[1]*v_210_000_1 - PC1[l]*v_210_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_110_010_0 = PB[1]*v_110_000_0 - PC1[l]*v_110_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_110_010_1 = PB[1]*v_110_000_1 - PC1[l]*v_110_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_210_110_0 = PB[0]*v_210_010_0 - PC0[l]*v_210_010_1 + 2*oo2p*(v_110_010_0 - v_110_010_1);
+        const double v_210_101_0 = PB[2]*v_210_100_0 - PC2[l]*v_210_100_1;
+        const double v_200_010_0 = PB[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_200_010_1 = PB[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_210_020_0 = PB[1]*v_210_010_0 - PC1[l]*v_210_010_1 + 1*oo2p*(v_200_010_0 - v_200_010_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_011_0 = PB[2]*v_210_010_0 - PC2[l]*v_210_010_1;
+        const double v_210_001_0 = PB[2]*v_210_000_0 - PC2[l]*v_210_000_1;
+        const double v_210_001_1 = PB[2]*v_210_000_1 - PC2[l]*v_210_000_2;
+        const double v_210_002_0 = PB[2]*v_210_001_0 - PC2[l]*v_210_001_1 + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_201_000_1 = PA[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_201_100_0 = PB[0]*v_201_000_0 - PC0[l]*v_201_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_201_000_2 = PA[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_101_000_2 = PA[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_201_100_1 = PB[0]*v_201_000_1 - PC0[l]*v_201_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_101_100_0 = PB[0]*v_101_000_0 - PC0[l]*v_101_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_101_100_1 = PB[0]*v_101_000_1 - PC0[l]*v_101_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_201_200_0 = PB[0]*v_201_100_0 - PC0[l]*v_201_100_1 + 2*oo2p*(v_101_100_0 - v_101_100_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_110_0 = PB[1]*v_201_100_0 - PC1[l]*v_201_100_1;
+        const double v_201_001_0 = PB[2]*v_201_000_0 - PC2[l]*v_201_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_201_001_1 = PB[2]*v_201_000_1 - PC2[l]*v_201_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_101_001_0 = PB[2]*v_101_000_0 - PC2[l]*v_101_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_101_001_1 = PB[2]*v_101_000_1 - PC2[l]*v_101_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_201_101_0 = PB[0]*v_201_001_0 - PC0[l]*v_201_001_1 + 2*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_201_010_0 = PB[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_201_010_1 = PB[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_201_020_0 = PB[1]*v_201_010_0 - PC1[l]*v_201_010_1 + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_011_0 = PB[1]*v_201_001_0 - PC1[l]*v_201_001_1;
+        const double v_200_001_0 = PB[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_200_001_1 = PB[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_201_002_0 = PB[2]*v_201_001_0 - PC2[l]*v_201_001_1 + 1*oo2p*(v_200_001_0 - v_200_001_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_120_000_1 = PA[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_120_100_0 = PB[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_020_000_3 = PA[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_120_000_2 = PA[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_120_100_1 = PB[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_100_0 = PB[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_100_1 = PB[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_120_200_0 = PB[0]*v_120_100_0 - PC0[l]*v_120_100_1 + 1*oo2p*(v_020_100_0 - v_020_100_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_010_0 = PB[1]*v_120_000_0 - PC1[l]*v_120_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_120_010_1 = PB[1]*v_120_000_1 - PC1[l]*v_120_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_020_010_0 = PB[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_020_010_1 = PB[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_120_110_0 = PB[0]*v_120_010_0 - PC0[l]*v_120_010_1 + 1*oo2p*(v_020_010_0 - v_020_010_1);
+        const double v_120_101_0 = PB[2]*v_120_100_0 - PC2[l]*v_120_100_1;
+        const double v_120_020_0 = PB[1]*v_120_010_0 - PC1[l]*v_120_010_1 + 2*oo2p*(v_110_010_0 - v_110_010_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_011_0 = PB[2]*v_120_010_0 - PC2[l]*v_120_010_1;
+        const double v_120_001_0 = PB[2]*v_120_000_0 - PC2[l]*v_120_000_1;
+        const double v_120_001_1 = PB[2]*v_120_000_1 - PC2[l]*v_120_000_2;
+        const double v_120_002_0 = PB[2]*v_120_001_0 - PC2[l]*v_120_001_1 + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_111_000_0 = PA[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_111_000_1 = PA[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_111_100_0 = PB[0]*v_111_000_0 - PC0[l]*v_111_000_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_011_000_3 = PA[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_111_000_2 = PA[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_111_100_1 = PB[0]*v_111_000_1 - PC0[l]*v_111_000_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_100_0 = PB[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_100_1 = PB[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_111_200_0 = PB[0]*v_111_100_0 - PC0[l]*v_111_100_1 + 1*oo2p*(v_011_100_0 - v_011_100_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_111_010_0 = PB[1]*v_111_000_0 - PC1[l]*v_111_000_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_111_010_1 = PB[1]*v_111_000_1 - PC1[l]*v_111_000_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_011_010_0 = PB[1]*v_011_000_0 - PC1[l]*v_011_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_011_010_1 = PB[1]*v_011_000_1 - PC1[l]*v_011_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_111_110_0 = PB[0]*v_111_010_0 - PC0[l]*v_111_010_1 + 1*oo2p*(v_011_010_0 - v_011_010_1);
+        const double v_111_001_0 = PB[2]*v_111_000_0 - PC2[l]*v_111_000_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_111_001_1 = PB[2]*v_111_000_1 - PC2[l]*v_111_000_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_011_001_0 = PB[2]*v_011_000_0 - PC2[l]*v_011_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_011_001_1 = PB[2]*v_011_000_1 - PC2[l]*v_011_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_111_101_0 = PB[0]*v_111_001_0 - PC0[l]*v_111_001_1 + 1*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_101_010_0 = PB[1]*v_101_000_0 - PC1[l]*v_101_000_1;
+        const double v_101_010_1 = PB[1]*v_101_000_1 - PC1[l]*v_101_000_2;
+        const double v_111_020_0 = PB[1]*v_111_010_0 - PC1[l]*v_111_010_1 + 1*oo2p*(v_101_010_0 - v_101_010_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_111_011_0 = PB[1]*v_111_001_0 - PC1[l]*v_111_001_1 + 1*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_110_001_0 = PB[2]*v_110_000_0 - PC2[l]*v_110_000_1;
+        const double v_110_001_1 = PB[2]*v_110_000_1 - PC2[l]*v_110_000_2;
+        const double v_111_002_0 = PB[2]*v_111_001_0 - PC2[l]*v_111_001_1 + 1*oo2p*(v_110_001_0 - v_110_001_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_102_000_1 = PA[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_102_100_0 = PB[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_000_3 = PA[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_102_000_2 = PA[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_102_100_1 = PB[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_100_0 = PB[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_100_1 = PB[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_102_200_0 = PB[0]*v_102_100_0 - PC0[l]*v_102_100_1 + 1*oo2p*(v_002_100_0 - v_002_100_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_110_0 = PB[1]*v_102_100_0 - PC1[l]*v_102_100_1;
+        const double v_102_001_0 = PB[2]*v_102_000_0 - PC2[l]*v_102_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_102_001_1 = PB[2]*v_102_000_1 - PC2[l]*v_102_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_002_001_0 = PB[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_002_001_1 = PB[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_102_101_0 = PB[0]*v_102_001_0 - PC0[l]*v_102_001_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_102_010_0 = PB[1]*v_102_000_0 - PC1[l]*v_102_000_1;
+        const double v_102_010_1 = PB[1]*v_102_000_1 - PC1[l]*v_102_000_2;
+        const double v_102_020_0 = PB[1]*v_102_010_0 - PC1[l]*v_102_010_1 + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_011_0 = PB[1]*v_102_001_0 - PC1[l]*v_102_001_1;
+        const double v_102_002_0 = PB[2]*v_102_001_0 - PC2[l]*v_102_001_1 + 2*oo2p*(v_101_001_0 - v_101_001_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_030_000_1 = PA[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_030_100_0 = PB[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_000_2 = PA[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_030_100_1 = PB[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_030_200_0 = PB[0]*v_030_100_0 - PC0[l]*v_030_100_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_010_0 = PB[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_030_010_1 = PB[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_030_110_0 = PB[0]*v_030_010_0 - PC0[l]*v_030_010_1;
+        const double v_030_001_0 = PB[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_030_001_1 = PB[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_030_101_0 = PB[0]*v_030_001_0 - PC0[l]*v_030_001_1;
+        const double v_030_020_0 = PB[1]*v_030_010_0 - PC1[l]*v_030_010_1 + 3*oo2p*(v_020_010_0 - v_020_010_1) + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_011_0 = PB[2]*v_030_010_0 - PC2[l]*v_030_010_1;
+        const double v_030_002_0 = PB[2]*v_030_001_0 - PC2[l]*v_030_001_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_021_000_1 = PA[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_021_100_0 = PB[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_000_2 = PA[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_021_100_1 = PB[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_021_200_0 = PB[0]*v_021_100_0 - PC0[l]*v_021_100_1 + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_010_0 = PB[1]*v_021_000_0 - PC1[l]*v_021_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_021_010_1 = PB[1]*v_021_000_1 - PC1[l]*v_021_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_021_110_0 = PB[0]*v_021_010_0 - PC0[l]*v_021_010_1;
+        const double v_021_001_0 = PB[2]*v_021_000_0 - PC2[l]*v_021_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_021_001_1 = PB[2]*v_021_000_1 - PC2[l]*v_021_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_021_101_0 = PB[0]*v_021_001_0 - PC0[l]*v_021_001_1;
+        const double v_021_020_0 = PB[1]*v_021_010_0 - PC1[l]*v_021_010_1 + 2*oo2p*(v_011_010_0 - v_011_010_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_011_0 = PB[1]*v_021_001_0 - PC1[l]*v_021_001_1 + 2*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_020_001_0 = PB[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_020_001_1 = PB[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_021_002_0 = PB[2]*v_021_001_0 - PC2[l]*v_021_001_1 + 1*oo2p*(v_020_001_0 - v_020_001_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_012_000_1 = PA[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_012_100_0 = PB[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_000_2 = PA[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_012_100_1 = PB[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_012_200_0 = PB[0]*v_012_100_0 - PC0[l]*v_012_100_1 + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_010_0 = PB[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_012_010_1 = PB[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_012_110_0 = PB[0]*v_012_010_0 - PC0[l]*v_012_010_1;
+        const double v_012_001_0 = PB[2]*v_012_000_0 - PC2[l]*v_012_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_012_001_1 = PB[2]*v_012_000_1 - PC2[l]*v_012_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_012_101_0 = PB[0]*v_012_001_0 - PC0[l]*v_012_001_1;
+        const double v_002_010_0 = PB[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_002_010_1 = PB[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_012_020_0 = PB[1]*v_012_010_0 - PC1[l]*v_012_010_1 + 1*oo2p*(v_002_010_0 - v_002_010_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_011_0 = PB[1]*v_012_001_0 - PC1[l]*v_012_001_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_012_002_0 = PB[2]*v_012_001_0 - PC2[l]*v_012_001_1 + 2*oo2p*(v_011_001_0 - v_011_001_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_003_000_1 = PA[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_003_100_0 = PB[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_000_2 = PA[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_003_100_1 = PB[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_003_200_0 = PB[0]*v_003_100_0 - PC0[l]*v_003_100_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_010_0 = PB[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_003_010_1 = PB[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_003_110_0 = PB[0]*v_003_010_0 - PC0[l]*v_003_010_1;
+        const double v_003_001_0 = PB[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_003_001_1 = PB[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_003_101_0 = PB[0]*v_003_001_0 - PC0[l]*v_003_001_1;
+        const double v_003_020_0 = PB[1]*v_003_010_0 - PC1[l]*v_003_010_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_011_0 = PB[1]*v_003_001_0 - PC1[l]*v_003_001_1;
+        const double v_003_002_0 = PB[2]*v_003_001_0 - PC2[l]*v_003_001_1 + 3*oo2p*(v_002_001_0 - v_002_001_1) + 1*oo2p*(v_003_000_0 - v_003_000_1);
+
+        sum_0 += q[l]*v_300_200_0;
+        sum_1 += q[l]*v_300_110_0;
+        sum_2 += q[l]*v_300_101_0;
+        sum_3 += q[l]*v_300_020_0;
+        sum_4 += q[l]*v_300_011_0;
+        sum_5 += q[l]*v_300_002_0;
+        sum_6 += q[l]*v_210_200_0;
+        sum_7 += q[l]*v_210_110_0;
+        sum_8 += q[l]*v_210_101_0;
+        sum_9 += q[l]*v_210_020_0;
+        sum_10 += q[l]*v_210_011_0;
+        sum_11 += q[l]*v_210_002_0;
+        sum_12 += q[l]*v_201_200_0;
+        sum_13 += q[l]*v_201_110_0;
+        sum_14 += q[l]*v_201_101_0;
+        sum_15 += q[l]*v_201_020_0;
+        sum_16 += q[l]*v_201_011_0;
+        sum_17 += q[l]*v_201_002_0;
+        sum_18 += q[l]*v_120_200_0;
+        sum_19 += q[l]*v_120_110_0;
+        sum_20 += q[l]*v_120_101_0;
+        sum_21 += q[l]*v_120_020_0;
+        sum_22 += q[l]*v_120_011_0;
+        sum_23 += q[l]*v_120_002_0;
+        sum_24 += q[l]*v_111_200_0;
+        sum_25 += q[l]*v_111_110_0;
+        sum_26 += q[l]*v_111_101_0;
+        sum_27 += q[l]*v_111_020_0;
+        sum_28 += q[l]*v_111_011_0;
+        sum_29 += q[l]*v_111_002_0;
+        sum_30 += q[l]*v_102_200_0;
+        sum_31 += q[l]*v_102_110_0;
+        sum_32 += q[l]*v_102_101_0;
+        sum_33 += q[l]*v_102_020_0;
+        sum_34 += q[l]*v_102_011_0;
+        sum_35 += q[l]*v_102_002_0;
+        sum_36 += q[l]*v_030_200_0;
+        sum_37 += q[l]*v_030_110_0;
+        sum_38 += q[l]*v_030_101_0;
+        sum_39 += q[l]*v_030_020_0;
+        sum_40 += q[l]*v_030_011_0;
+        sum_41 += q[l]*v_030_002_0;
+        sum_42 += q[l]*v_021_200_0;
+        sum_43 += q[l]*v_021_110_0;
+        sum_44 += q[l]*v_021_101_0;
+        sum_45 += q[l]*v_021_020_0;
+        sum_46 += q[l]*v_021_011_0;
+        sum_47 += q[l]*v_021_002_0;
+        sum_48 += q[l]*v_012_200_0;
+        sum_49 += q[l]*v_012_110_0;
+        sum_50 += q[l]*v_012_101_0;
+        sum_51 += q[l]*v_012_020_0;
+        sum_52 += q[l]*v_012_011_0;
+        sum_53 += q[l]*v_012_002_0;
+        sum_54 += q[l]*v_003_200_0;
+        sum_55 += q[l]*v_003_110_0;
+        sum_56 += q[l]*v_003_101_0;
+        sum_57 += q[l]*v_003_020_0;
+        sum_58 += q[l]*v_003_011_0;
+        sum_59 += q[l]*v_003_002_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+    acc[45] += sum_45;
+    acc[46] += sum_46;
+    acc[47] += sum_47;
+    acc[48] += sum_48;
+    acc[49] += sum_49;
+    acc[50] += sum_50;
+    acc[51] += sum_51;
+    acc[52] += sum_52;
+    acc[53] += sum_53;
+    acc[54] += sum_54;
+    acc[55] += sum_55;
+    acc[56] += sum_56;
+    acc[57] += sum_57;
+    acc[58] += sum_58;
+    acc[59] += sum_59;
+}
+
+
+void potential_kernel_3_3(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+    double sum_45 = 0.0;
+    double sum_46 = 0.0;
+    double sum_47 = 0.0;
+    double sum_48 = 0.0;
+    double sum_49 = 0.0;
+    double sum_50 = 0.0;
+    double sum_51 = 0.0;
+    double sum_52 = 0.0;
+    double sum_53 = 0.0;
+    double sum_54 = 0.0;
+    double sum_55 = 0.0;
+    double sum_56 = 0.0;
+    double sum_57 = 0.0;
+    double sum_58 = 0.0;
+    double sum_59 = 0.0;
+    double sum_60 = 0.0;
+    double sum_61 = 0.0;
+    double sum_62 = 0.0;
+    double sum_63 = 0.0;
+    double sum_64 = 0.0;
+    double sum_65 = 0.0;
+    double sum_66 = 0.0;
+    double sum_67 = 0.0;
+    double sum_68 = 0.0;
+    double sum_69 = 0.0;
+    double sum_70 = 0.0;
+    double sum_71 = 0.0;
+    double sum_72 = 0.0;
+    double sum_73 = 0.0;
+    double sum_74 = 0.0;
+    double sum_75 = 0.0;
+    double sum_76 = 0.0;
+    double sum_77 = 0.0;
+    double sum_78 = 0.0;
+    double sum_79 = 0.0;
+    double sum_80 = 0.0;
+    double sum_81 = 0.0;
+    double sum_82 = 0.0;
+    double sum_83 = 0.0;
+    double sum_84 = 0.0;
+    double sum_85 = 0.0;
+    double sum_86 = 0.0;
+    double sum_87 = 0.0;
+    double sum_88 = 0.0;
+    double sum_89 = 0.0;
+    double sum_90 = 0.0;
+    double sum_91 = 0.0;
+    double sum_92 = 0.0;
+    double sum_93 = 0.0;
+    double sum_94 = 0.0;
+    double sum_95 = 0.0;
+    double sum_96 = 0.0;
+    double sum_97 = 0.0;
+    double sum_98 = 0.0;
+    double sum_99 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_300_000_1 = PA[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_300_100_0 = PB[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_200_000_3 = PA[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_300_000_2 = PA[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_300_100_1 = PB[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_200_100_0 = PB[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_200_100_1 = PB[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_300_200_0 = PB[0]*v_300_100_0 - PC0[l]*v_300_100_1 + 3*oo2p*(v_200_100_0 - v_200_100_1) + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_000_000_6 = F[6*nb + l];
+        const double v_100_000_5 = PA[0]*v_000_000_5 - PC0[l]*v_000_000_6;
+        const double v_200_000_4 = PA[0]*v_100_000_4 - PC0[l]*v_100_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_300_000_3 = PA[0]*v_200_000_3 - PC0[l]*v_200_000_4 + 2*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_300_100_2 = PB[0]*v_300_000_2 - PC0[l]*v_300_000_3 + 3*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_200_100_2 = PB[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_300_200_1 = PB[0]*v_300_100_1 - PC0[l]*v_300_100_2 + 3*oo2p*(v_200_100_1 - v_200_100_2) + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_100_100_1 = PB[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_200_0 = PB[0]*v_200_100_0 - PC0[l]*v_200_100_1 + 2*oo2p*(v_100_100_0 - v_100_100_1) + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_100_100_2 = PB[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_200_200_1 = PB[0]*v_200_100_1 - PC0[l]*v_200_100_2 + 2*oo2p*(v_100_100_1 - v_100_100_2) + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_300_300_0 = PB[0]*v_300_200_0 - PC0[l]*v_300_200_1 + 3*oo2p*(v_200_200_0 - v_200_200_1) + 2*oo2p*(v_300_100_0 - v_300_100_1);
+        const double v_300_210_0 = PB[1]*v_300_200_0 - PC1[l]*v_300_200_1;
+        const double v_300_201_0 = PB[2]*v_300_200_0 - PC2[l]*v_300_200_1;
+        const double v_300_010_0 = PB[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_300_010_1 = PB[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_300_020_0 = PB[1]*v_300_010_0 - PC1[l]*v_300_010_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_010_2 = PB[1]*v_300_000_2 - PC1[l]*v_300_000_3;
+        const double v_300_020_1 = PB[1]*v_300_010_1 - PC1[l]*v_300_010_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_200_010_0 = PB[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_200_010_1 = PB[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_200_020_0 = PB[1]*v_200_010_0 - PC1[l]*v_200_010_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_010_2 = PB[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_200_020_1 = PB[1]*v_200_010_1 - PC1[l]*v_200_010_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_300_120_0 = PB[0]*v_300_020_0 - PC0[l]*v_300_020_1 + 3*oo2p*(v_200_020_0 - v_200_020_1);
+        const double v_300_101_0 = PB[2]*v_300_100_0 - PC2[l]*v_300_100_1;
+        const double v_300_101_1 = PB[2]*v_300_100_1 - PC2[l]*v_300_100_2;
+        const double v_300_111_0 = PB[1]*v_300_101_0 - PC1[l]*v_300_101_1;
+        const double v_300_001_0 = PB[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_300_001_1 = PB[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_300_002_0 = PB[2]*v_300_001_0 - PC2[l]*v_300_001_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_001_2 = PB[2]*v_300_000_2 - PC2[l]*v_300_000_3;
+        const double v_300_002_1 = PB[2]*v_300_001_1 - PC2[l]*v_300_001_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_200_001_0 = PB[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_200_001_1 = PB[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_200_002_0 = PB[2]*v_200_001_0 - PC2[l]*v_200_001_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_001_2 = PB[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_200_002_1 = PB[2]*v_200_001_1 - PC2[l]*v_200_001_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_300_102_0 = PB[0]*v_300_002_0 - PC0[l]*v_300_002_1 + 3*oo2p*(v_200_002_0 - v_200_002_1);
+        const double v_300_030_0 = PB[1]*v_300_020_0 - PC1[l]*v_300_020_1 + 2*oo2p*(v_300_010_0 - v_300_010_1);
+        const double v_300_021_0 = PB[2]*v_300_020_0 - PC2[l]*v_300_020_1;
+        const double v_300_012_0 = PB[1]*v_300_002_0 - PC1[l]*v_300_002_1;
+        const double v_300_003_0 = PB[2]*v_300_002_0 - PC2[l]*v_300_002_1 + 2*oo2p*(v_300_001_0 - v_300_001_1);
+        const double v_210_000_0 = PA[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_210_000_1 = PA[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_210_100_0 = PB[0]*v_210_000_0 - PC0[l]*v_210_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_210_000_2 = PA[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_110_000_2 = PA[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_210_100_1 = PB[0]*v_210_000_1 - PC0[l]*v_210_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_110_100_0 = PB[0]*v_110_000_0 - PC0[l]*v_110_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_110_100_1 = PB[0]*v_110_000_1 - PC0[l]*v_110_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_210_200_0 = PB[0]*v_210_100_0 - PC0[l]*v_210_100_1 + 2*oo2p*(v_110_100_0 - v_110_100_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_000_3 = PA[1]*v_200_000_3 - PC1[l]*v_200_000_4;
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_110_000_3 = PA[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_210_100_2 = PB[0]*v_210_000_2 - PC0[l]*v_210_000_3 + 2*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_110_100_2 = PB[0]*v_110_000_2 - PC0[l]*v_110_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_210_200_1 = PB[0]*v_210_100_1 - PC0[l]*v_210_100_2 + 2*oo2p*(v_110_100_1 - v_110_100_2) + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_100_1 = PB[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_200_0 = PB[0]*v_110_100_0 - PC0[l]*v_110_100_1 + 1*oo2p*(v_010_100_0 - v_010_100_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_010_100_2 = PB[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_110_200_1 = PB[0]*v_110_100_1 - PC0[l]*v_110_100_2 + 1*oo2p*(v_010_100_1 - v_010_100_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_210_300_0 = PB[0]*v_210_200_0 - PC0[l]*v_210_200_1 + 2*oo2p*(v_110_200_0 - v_110_200_1) + 2*oo2p*(v_210_100_0 - v_210_100_1);
+        const double v_210_210_0 = PB[1]*v_210_200_0 - PC1[l]*v_210_200_1 + 1*oo2p*(v_200_200_0 - v_200_200_1);
+        const double v_210_201_0 = PB[2]*v_210_200_0 - PC2[l]*v_210_200_1;
+        const double v_210_010_0 = PB[1]*v_210_000_0 - PC1[l]*v_210_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_210_010_1 = PB[1]*v_210_000_1 - PC1[l]*v_210_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_210_020_0 = PB[1]*v_210_010_0 - PC1[l]*v_210_010_1 + 1*oo2p*(v_200_010_0 - v_200_010_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_010_2 = PB[1]*v_210_000_2 - PC1[l]*v_210_000_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_210_020_1 = PB[1]*v_210_010_1 - PC1[l]*v_210_010_2 + 1*oo2p*(v_200_010_1 - v_200_010_2) + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_110_010_0 = PB[1]*v_110_000_0 - PC1[l]*v_110_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_110_010_1 = PB[1]*v_110_000_1 - PC1[l]*v_110_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_010_1 = PB[1]*v_100_000_1 - PC1[l]*v_100_000_2;
+        const double v_110_020_0 = PB[1]*v_110_010_0 - PC1[l]*v_110_010_1 + 1*oo2p*(v_100_010_0 - v_100_010_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_010_2 = PB[1]*v_110_000_2 - PC1[l]*v_110_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_100_010_2 = PB[1]*v_100_000_2 - PC1[l]*v_100_000_3;
+        const double v_110_020_1 = PB[1]*v_110_010_1 - PC1[l]*v_110_010_2 + 1*oo2p*(v_100_010_1 - v_100_010_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_210_120_0 = PB[0]*v_210_020_0 - PC0[l]*v_210_020_1 + 2*oo2p*(v_110_020_0 - v_110_020_1);
+        const double v_210_110_0 = PB[0]*v_210_010_0 - PC0[l]*v_210_010_1 + 2*oo2p*(v_110_010_0 - v_110_010_1);
+        const double v_210_110_1 = PB[0]*v_210_010_1 - PC0[l]*v_210_010_2 + 2*oo2p*(v_110_010_1 - v_110_010_2);
+        const double v_210_111_0 = PB[2]*v_210_110_0 - PC2[l]*v_210_110_1;
+        const double v_210_001_0 = PB[2]*v_210_000_0 - PC2[l]*v_210_000_1;
+        const double v_210_001_1 = PB[2]*v_210_000_1 - PC2[l]*v_210_000_2;
+        const double v_210_002_0 = PB[2]*v_210_001_0 - PC2[l]*v_210_001_1 + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_001_2 = PB[2]*v_210_000_2 - PC2[l]*v_210_000_3;
+        const double v_210_002_1 = PB[2]*v_210_001_1 - PC2[l]*v_210_001_2 + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_110_001_0 = PB[2]*v_110_000_0 - PC2[l]*v_110_000_1;
+        const double v_110_001_1 = PB[2]*v_110_000_1 - PC2[l]*v_110_000_2;
+        const double v_110_002_0 = PB[2]*v_110_001_0 - PC2[l]*v_110_001_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_001_2 = PB[2]*v_110_000_2 - PC2[l]*v_110_000_3;
+        const double v_110_002_1 = PB[2]*v_110_001_1 - PC2[l]*v_110_001_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_210_102_0 = PB[0]*v_210_002_0 - PC0[l]*v_210_002_1 + 2*oo2p*(v_110_002_0 - v_110_002_1);
+        const double v_210_030_0 = PB[1]*v_210_020_0 - PC1[l]*v_210_020_1 + 1*oo2p*(v_200_020_0 - v_200_020_1) + 2*oo2p*(v_210_010_0 - v_210_010_1);
+        const double v_210_021_0 = PB[2]*v_210_020_0 - PC2[l]*v_210_020_1;
+        const double v_210_012_0 = PB[1]*v_210_002_0 - PC1[l]*v_210_002_1 + 1*oo2p*(v_200_002_0 - v_200_002_1);
+        const double v_210_003_0 = PB[2]*v_210_002_0 - PC2[l]*v_210_002_1 + 2*oo2p*(v_210_001_0 - v_210_001_1);
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_201_000_1 = PA[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_201_100_0 = PB[0]*v_201_000_0 - PC0[l]*v_201_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_201_000_2 = PA[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_101_000_2 = PA[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_201_100_1 = PB[0]*v_201_000_1 - PC0[l]*v_201_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_101_100_0 = PB[0]*v_101_000_0 - PC0[l]*v_101_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_101_100_1 = PB[0]*v_101_000_1 - PC0[l]*v_101_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_201_200_0 = PB[0]*v_201_100_0 - PC0[l]*v_201_100_1 + 2*oo2p*(v_101_100_0 - v_101_100_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_000_3 = PA[2]*v_200_000_3 - PC2[l]*v_200_000_4;
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_101_000_3 = PA[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_201_100_2 = PB[0]*v_201_000_2 - PC0[l]*v_201_000_3 + 2*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_101_100_2 = PB[0]*v_101_000_2 - PC0[l]*v_101_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_201_200_1 = PB[0]*v_201_100_1 - PC0[l]*v_201_100_2 + 2*oo2p*(v_101_100_1 - v_101_100_2) + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_100_1 = PB[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_200_0 = PB[0]*v_101_100_0 - PC0[l]*v_101_100_1 + 1*oo2p*(v_001_100_0 - v_001_100_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_001_100_2 = PB[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_101_200_1 = PB[0]*v_101_100_1 - PC0[l]*v_101_100_2 + 1*oo2p*(v_001_100_1 - v_001_100_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_201_300_0 = PB[0]*v_201_200_0 - PC0[l]*v_201_200_1 + 2*oo2p*(v_101_200_0 - v_101_200_1) + 2*oo2p*(v_201_100_0 - v_201_100_1);
+        const double v_201_210_0 = PB[1]*v_201_200_0 - PC1[l]*v_201_200_1;
+        const double v_201_201_0 = PB[2]*v_201_200_0 - PC2[l]*v_201_200_1 + 1*oo2p*(v_200_200_0 - v_200_200_1);
+        const double v_201_010_0 = PB[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_201_010_1 = PB[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_201_020_0 = PB[1]*v_201_010_0 - PC1[l]*v_201_010_1 + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_010_2 = PB[1]*v_201_000_2 - PC1[l]*v_201_000_3;
+        const double v_201_020_1 = PB[1]*v_201_010_1 - PC1[l]*v_201_010_2 + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_101_010_0 = PB[1]*v_101_000_0 - PC1[l]*v_101_000_1;
+        const double v_101_010_1 = PB[1]*v_101_000_1 - PC1[l]*v_101_000_2;
+        const double v_101_020_0 = PB[1]*v_101_010_0 - PC1[l]*v_101_010_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_010_2 = PB[1]*v_101_000_2 - PC1[l]*v_101_000_3;
+        const double v_101_020_1 = PB[1]*v_101_010_1 - PC1[l]*v_101_010_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_201_120_0 = PB[0]*v_201_020_0 - PC0[l]*v_201_020_1 + 2*oo2p*(v_101_020_0 - v_101_020_1);
+        const double v_201_001_0 = PB[2]*v_201_000_0 - PC2[l]*v_201_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_201_001_1 = PB[2]*v_201_000_1 - PC2[l]*v_201_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_101_001_0 = PB[2]*v_101_000_0 - PC2[l]*v_101_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_101_001_1 = PB[2]*v_101_000_1 - PC2[l]*v_101_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_201_101_0 = PB[0]*v_201_001_0 - PC0[l]*v_201_001_1 + 2*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_201_001_2 = PB[2]*v_201_000_2 - PC2[l]*v_201_000_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_101_001_2 = PB[2]*v_101_000_2 - PC2[l]*v_101_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_201_101_1 = PB[0]*v_201_001_1 - PC0[l]*v_201_001_2 + 2*oo2p*(v_101_001_1 - v_101_001_2);
+        const double v_201_111_0 = PB[1]*v_201_101_0 - PC1[l]*v_201_101_1;
+        const double v_201_002_0 = PB[2]*v_201_001_0 - PC2[l]*v_201_001_1 + 1*oo2p*(v_200_001_0 - v_200_001_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_002_1 = PB[2]*v_201_001_1 - PC2[l]*v_201_001_2 + 1*oo2p*(v_200_001_1 - v_200_001_2) + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_100_001_1 = PB[2]*v_100_000_1 - PC2[l]*v_100_000_2;
+        const double v_101_002_0 = PB[2]*v_101_001_0 - PC2[l]*v_101_001_1 + 1*oo2p*(v_100_001_0 - v_100_001_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_100_001_2 = PB[2]*v_100_000_2 - PC2[l]*v_100_000_3;
+        const double v_101_002_1 = PB[2]*v_101_001_1 - PC2[l]*v_101_001_2 + 1*oo2p*(v_100_001_1 - v_100_001_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_201_102_0 = PB[0]*v_201_002_0 - PC0[l]*v_201_002_1 + 2*oo2p*(v_101_002_0 - v_101_002_1);
+        const double v_201_030_0 = PB[1]*v_201_020_0 - PC1[l]*v_201_020_1 + 2*oo2p*(v_201_010_0 - v_201_010_1);
+        const double v_201_011_0 = PB[1]*v_201_001_0 - PC1[l]*v_201_001_1;
+        const double v_201_011_1 = PB[1]*v_201_001_1 - PC1[l]*v_201_001_2;
+        const double v_201_021_0 = PB[1]*v_201_011_0 - PC1[l]*v_201_011_1 + 1*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_201_012_0 = PB[1]*v_201_002_0 - PC1[l]*v_201_002_1;
+        const double v_201_003_0 = PB[2]*v_201_002_0 - PC2[l]*v_201_002_1 + 1*oo2p*(v_200_002_0 - v_200_002_1) + 2*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_120_000_1 = PA[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_120_100_0 = PB[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_000_3 = PA[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_120_000_2 = PA[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_120_100_1 = PB[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_100_0 = PB[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_100_1 = PB[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_120_200_0 = PB[0]*v_120_100_0 - PC0[l]*v_120_100_1 + 1*oo2p*(v_020_100_0 - v_020_100_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_010_000_5 = PA[1]*v_000_000_5 - PC1[l]*v_000_000_6;
+        const double v_020_000_4 = PA[1]*v_010_000_4 - PC1[l]*v_010_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_120_000_3 = PA[0]*v_020_000_3 - PC0[l]*v_020_000_4;
+        const double v_120_100_2 = PB[0]*v_120_000_2 - PC0[l]*v_120_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_020_100_2 = PB[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_120_200_1 = PB[0]*v_120_100_1 - PC0[l]*v_120_100_2 + 1*oo2p*(v_020_100_1 - v_020_100_2) + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_020_200_0 = PB[0]*v_020_100_0 - PC0[l]*v_020_100_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_200_1 = PB[0]*v_020_100_1 - PC0[l]*v_020_100_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_120_300_0 = PB[0]*v_120_200_0 - PC0[l]*v_120_200_1 + 1*oo2p*(v_020_200_0 - v_020_200_1) + 2*oo2p*(v_120_100_0 - v_120_100_1);
+        const double v_120_210_0 = PB[1]*v_120_200_0 - PC1[l]*v_120_200_1 + 2*oo2p*(v_110_200_0 - v_110_200_1);
+        const double v_120_201_0 = PB[2]*v_120_200_0 - PC2[l]*v_120_200_1;
+        const double v_120_010_0 = PB[1]*v_120_000_0 - PC1[l]*v_120_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_120_010_1 = PB[1]*v_120_000_1 - PC1[l]*v_120_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_120_020_0 = PB[1]*v_120_010_0 - PC1[l]*v_120_010_1 + 2*oo2p*(v_110_010_0 - v_110_010_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_010_2 = PB[1]*v_120_000_2 - PC1[l]*v_120_000_3 + 2*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_120_020_1 = PB[1]*v_120_010_1 - PC1[l]*v_120_010_2 + 2*oo2p*(v_110_010_1 - v_110_010_2) + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_020_010_0 = PB[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_020_010_1 = PB[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_010_1 = PB[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_020_020_0 = PB[1]*v_020_010_0 - PC1[l]*v_020_010_1 + 2*oo2p*(v_010_010_0 - v_010_010_1) + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_010_2 = PB[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_010_010_2 = PB[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_020_020_1 = PB[1]*v_020_010_1 - PC1[l]*v_020_010_2 + 2*oo2p*(v_010_010_1 - v_010_010_2) + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_120_120_0 = PB[0]*v_120_020_0 - PC0[l]*v_120_020_1 + 1*oo2p*(v_020_020_0 - v_020_020_1);
+        const double v_120_110_0 = PB[0]*v_120_010_0 - PC0[l]*v_120_010_1 + 1*oo2p*(v_020_010_0 - v_020_010_1);
+        const double v_120_110_1 = PB[0]*v_120_010_1 - PC0[l]*v_120_010_2 + 1*oo2p*(v_020_010_1 - v_020_010_2);
+        const double v_120_111_0 = PB[2]*v_120_110_0 - PC2[l]*v_120_110_1;
+        const double v_120_001_0 = PB[2]*v_120_000_0 - PC2[l]*v_120_000_1;
+        const double v_120_001_1 = PB[2]*v_120_000_1 - PC2[l]*v_120_000_2;
+        const double v_120_002_0 = PB[2]*v_120_001_0 - PC2[l]*v_120_001_1 + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_001_2 = PB[2]*v_120_000_2 - PC2[l]*v_120_000_3;
+        const double v_120_002_1 = PB[2]*v_120_001_1 - PC2[l]*v_120_001_2 + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_020_001_0 = PB[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_020_001_1 = PB[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_020_002_0 = PB[2]*v_020_001_0 - PC2[l]*v_020_001_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_001_2 = PB[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_020_002_1 = PB[2]*v_020_001_1 - PC2[l]*v_020_001_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_120_102_0 = PB[0]*v_120_002_0 - PC0[l]*v_120_002_1 + 1*oo2p*(v_020_002_0 - v_020_002_1);
+        const double v_120_030_0 = PB[1]*v_120_020_0 - PC1[l]*v_120_020_1 + 2*oo2p*(v_110_020_0 - v_110_020_1) + 2*oo2p*(v_120_010_0 - v_120_010_1);
+        const double v_120_021_0 = PB[2]*v_120_020_0 - PC2[l]*v_120_020_1;
+        const double v_120_012_0 = PB[1]*v_120_002_0 - PC1[l]*v_120_002_1 + 2*oo2p*(v_110_002_0 - v_110_002_1);
+        const double v_120_003_0 = PB[2]*v_120_002_0 - PC2[l]*v_120_002_1 + 2*oo2p*(v_120_001_0 - v_120_001_1);
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_111_000_0 = PA[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_111_000_1 = PA[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_111_100_0 = PB[0]*v_111_000_0 - PC0[l]*v_111_000_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_000_3 = PA[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_111_000_2 = PA[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_111_100_1 = PB[0]*v_111_000_1 - PC0[l]*v_111_000_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_100_0 = PB[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_100_1 = PB[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_111_200_0 = PB[0]*v_111_100_0 - PC0[l]*v_111_100_1 + 1*oo2p*(v_011_100_0 - v_011_100_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_001_000_5 = PA[2]*v_000_000_5 - PC2[l]*v_000_000_6;
+        const double v_011_000_4 = PA[1]*v_001_000_4 - PC1[l]*v_001_000_5;
+        const double v_111_000_3 = PA[0]*v_011_000_3 - PC0[l]*v_011_000_4;
+        const double v_111_100_2 = PB[0]*v_111_000_2 - PC0[l]*v_111_000_3 + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_011_100_2 = PB[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_111_200_1 = PB[0]*v_111_100_1 - PC0[l]*v_111_100_2 + 1*oo2p*(v_011_100_1 - v_011_100_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_011_200_0 = PB[0]*v_011_100_0 - PC0[l]*v_011_100_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_200_1 = PB[0]*v_011_100_1 - PC0[l]*v_011_100_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_111_300_0 = PB[0]*v_111_200_0 - PC0[l]*v_111_200_1 + 1*oo2p*(v_011_200_0 - v_011_200_1) + 2*oo2p*(v_111_100_0 - v_111_100_1);
+        const double v_111_210_0 = PB[1]*v_111_200_0 - PC1[l]*v_111_200_1 + 1*oo2p*(v_101_200_0 - v_101_200_1);
+        const double v_111_201_0 = PB[2]*v_111_200_0 - PC2[l]*v_111_200_1 + 1*oo2p*(v_110_200_0 - v_110_200_1);
+        const double v_111_010_0 = PB[1]*v_111_000_0 - PC1[l]*v_111_000_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_111_010_1 = PB[1]*v_111_000_1 - PC1[l]*v_111_000_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_111_020_0 = PB[1]*v_111_010_0 - PC1[l]*v_111_010_1 + 1*oo2p*(v_101_010_0 - v_101_010_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_111_010_2 = PB[1]*v_111_000_2 - PC1[l]*v_111_000_3 + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_111_020_1 = PB[1]*v_111_010_1 - PC1[l]*v_111_010_2 + 1*oo2p*(v_101_010_1 - v_101_010_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_011_010_0 = PB[1]*v_011_000_0 - PC1[l]*v_011_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_011_010_1 = PB[1]*v_011_000_1 - PC1[l]*v_011_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_010_1 = PB[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_011_020_0 = PB[1]*v_011_010_0 - PC1[l]*v_011_010_1 + 1*oo2p*(v_001_010_0 - v_001_010_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_010_2 = PB[1]*v_011_000_2 - PC1[l]*v_011_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_010_2 = PB[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_011_020_1 = PB[1]*v_011_010_1 - PC1[l]*v_011_010_2 + 1*oo2p*(v_001_010_1 - v_001_010_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_111_120_0 = PB[0]*v_111_020_0 - PC0[l]*v_111_020_1 + 1*oo2p*(v_011_020_0 - v_011_020_1);
+        const double v_111_001_0 = PB[2]*v_111_000_0 - PC2[l]*v_111_000_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_111_001_1 = PB[2]*v_111_000_1 - PC2[l]*v_111_000_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_111_011_0 = PB[1]*v_111_001_0 - PC1[l]*v_111_001_1 + 1*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_111_001_2 = PB[2]*v_111_000_2 - PC2[l]*v_111_000_3 + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_111_011_1 = PB[1]*v_111_001_1 - PC1[l]*v_111_001_2 + 1*oo2p*(v_101_001_1 - v_101_001_2);
+        const double v_011_001_0 = PB[2]*v_011_000_0 - PC2[l]*v_011_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_011_001_1 = PB[2]*v_011_000_1 - PC2[l]*v_011_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_001_1 = PB[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_011_011_0 = PB[1]*v_011_001_0 - PC1[l]*v_011_001_1 + 1*oo2p*(v_001_001_0 - v_001_001_1);
+        const double v_011_001_2 = PB[2]*v_011_000_2 - PC2[l]*v_011_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_001_001_2 = PB[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_011_011_1 = PB[1]*v_011_001_1 - PC1[l]*v_011_001_2 + 1*oo2p*(v_001_001_1 - v_001_001_2);
+        const double v_111_111_0 = PB[0]*v_111_011_0 - PC0[l]*v_111_011_1 + 1*oo2p*(v_011_011_0 - v_011_011_1);
+        const double v_111_002_0 = PB[2]*v_111_001_0 - PC2[l]*v_111_001_1 + 1*oo2p*(v_110_001_0 - v_110_001_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_111_002_1 = PB[2]*v_111_001_1 - PC2[l]*v_111_001_2 + 1*oo2p*(v_110_001_1 - v_110_001_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_010_001_1 = PB[2]*v_010_000_1 - PC2[l]*v_010_000_2;
+        const double v_011_002_0 = PB[2]*v_011_001_0 - PC2[l]*v_011_001_1 + 1*oo2p*(v_010_001_0 - v_010_001_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_010_001_2 = PB[2]*v_010_000_2 - PC2[l]*v_010_000_3;
+        const double v_011_002_1 = PB[2]*v_011_001_1 - PC2[l]*v_011_001_2 + 1*oo2p*(v_010_001_1 - v_010_001_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_111_102_0 = PB[0]*v_111_002_0 - PC0[l]*v_111_002_1 + 1*oo2p*(v_011_002_0 - v_011_002_1);
+        const double v_111_030_0 = PB[1]*v_111_020_0 - PC1[l]*v_111_020_1 + 1*oo2p*(v_101_020_0 - v_101_020_1) + 2*oo2p*(v_111_010_0 - v_111_010_1);
+        const double v_111_021_0 = PB[2]*v_111_020_0 - PC2[l]*v_111_020_1 + 1*oo2p*(v_110_020_0 - v_110_020_1);
+        const double v_111_012_0 = PB[1]*v_111_002_0 - PC1[l]*v_111_002_1 + 1*oo2p*(v_101_002_0 - v_101_002_1);
+        const double v_111_003_0 = PB[2]*v_111_002_0 - PC2[l]*v_111_002_1 + 1*oo2p*(v_110_002_0 - v_110_002_1) + 2*oo2p*(v_111_001_0 - v_111_001_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_102_000_1 = PA[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_102_100_0 = PB[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_000_3 = PA[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_102_000_2 = PA[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_102_100_1 = PB[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_100_0 = PB[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_100_1 = PB[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_102_200_0 = PB[0]*v_102_100_0 - PC0[l]*v_102_100_1 + 1*oo2p*(v_002_100_0 - v_002_100_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_002_000_4 = PA[2]*v_001_000_4 - PC2[l]*v_001_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_102_000_3 = PA[0]*v_002_000_3 - PC0[l]*v_002_000_4;
+        const double v_102_100_2 = PB[0]*v_102_000_2 - PC0[l]*v_102_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_002_100_2 = PB[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_102_200_1 = PB[0]*v_102_100_1 - PC0[l]*v_102_100_2 + 1*oo2p*(v_002_100_1 - v_002_100_2) + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_002_200_0 = PB[0]*v_002_100_0 - PC0[l]*v_002_100_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_200_1 = PB[0]*v_002_100_1 - PC0[l]*v_002_100_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_102_300_0 = PB[0]*v_102_200_0 - PC0[l]*v_102_200_1 + 1*oo2p*(v_002_200_0 - v_002_200_1) + 2*oo2p*(v_102_100_0 - v_102_100_1);
+        const double v_102_210_0 = PB[1]*v_102_200_0 - PC1[l]*v_102_200_1;
+        const double v_102_201_0 = PB[2]*v_102_200_0 - PC2[l]*v_102_200_1 + 2*oo2p*(v_101_200_0 - v_101_200_1);
+        const double v_102_010_0 = PB[1]*v_102_000_0 - PC1[l]*v_102_000_1;
+        const double v_102_010_1 = PB[1]*v_102_000_1 - PC1[l]*v_102_000_2;
+        const double v_102_020_0 = PB[1]*v_102_010_0 - PC1[l]*v_102_010_1 + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_010_2 = PB[1]*v_102_000_2 - PC1[l]*v_102_000_3;
+        const double v_102_020_1 = PB[1]*v_102_010_1 - PC1[l]*v_102_010_2 + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_002_010_0 = PB[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_002_010_1 = PB[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_002_020_0 = PB[1]*v_002_010_0 - PC1[l]*v_002_010_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_010_2 = PB[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_002_020_1 = PB[1]*v_002_010_1 - PC1[l]*v_002_010_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_102_120_0 = PB[0]*v_102_020_0 - PC0[l]*v_102_020_1 + 1*oo2p*(v_002_020_0 - v_002_020_1);
+        const double v_102_001_0 = PB[2]*v_102_000_0 - PC2[l]*v_102_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_102_001_1 = PB[2]*v_102_000_1 - PC2[l]*v_102_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_002_001_0 = PB[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_002_001_1 = PB[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_102_101_0 = PB[0]*v_102_001_0 - PC0[l]*v_102_001_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_102_001_2 = PB[2]*v_102_000_2 - PC2[l]*v_102_000_3 + 2*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_002_001_2 = PB[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_102_101_1 = PB[0]*v_102_001_1 - PC0[l]*v_102_001_2 + 1*oo2p*(v_002_001_1 - v_002_001_2);
+        const double v_102_111_0 = PB[1]*v_102_101_0 - PC1[l]*v_102_101_1;
+        const double v_102_002_0 = PB[2]*v_102_001_0 - PC2[l]*v_102_001_1 + 2*oo2p*(v_101_001_0 - v_101_001_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_002_1 = PB[2]*v_102_001_1 - PC2[l]*v_102_001_2 + 2*oo2p*(v_101_001_1 - v_101_001_2) + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_002_002_0 = PB[2]*v_002_001_0 - PC2[l]*v_002_001_1 + 2*oo2p*(v_001_001_0 - v_001_001_1) + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_002_1 = PB[2]*v_002_001_1 - PC2[l]*v_002_001_2 + 2*oo2p*(v_001_001_1 - v_001_001_2) + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_102_102_0 = PB[0]*v_102_002_0 - PC0[l]*v_102_002_1 + 1*oo2p*(v_002_002_0 - v_002_002_1);
+        const double v_102_030_0 = PB[1]*v_102_020_0 - PC1[l]*v_102_020_1 + 2*oo2p*(v_102_010_0 - v_102_010_1);
+        const double v_102_011_0 = PB[1]*v_102_001_0 - PC1[l]*v_102_001_1;
+        const double v_102_011_1 = PB[1]*v_102_001_1 - PC1[l]*v_102_001_2;
+        const double v_102_021_0 = PB[1]*v_102_011_0 - PC1[l]*v_102_011_1 + 1*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_102_012_0 = PB[1]*v_102_002_0 - PC1[l]*v_102_002_1;
+        const double v_102_003_0 = PB[2]*v_102_002_0 - PC2[l]*v_102_002_1 + 2*oo2p*(v_101_002_0 - v_101_002_1) + 2*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_030_000_1 = PA[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_030_100_0 = PB[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_000_2 = PA[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_030_100_1 = PB[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_030_200_0 = PB[0]*v_030_100_0 - PC0[l]*v_030_100_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_000_3 = PA[1]*v_020_000_3 - PC1[l]*v_020_000_4 + 2*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_030_100_2 = PB[0]*v_030_000_2 - PC0[l]*v_030_000_3;
+        const double v_030_200_1 = PB[0]*v_030_100_1 - PC0[l]*v_030_100_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_030_300_0 = PB[0]*v_030_200_0 - PC0[l]*v_030_200_1 + 2*oo2p*(v_030_100_0 - v_030_100_1);
+        const double v_030_010_0 = PB[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_030_010_1 = PB[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_030_110_0 = PB[0]*v_030_010_0 - PC0[l]*v_030_010_1;
+        const double v_030_010_2 = PB[1]*v_030_000_2 - PC1[l]*v_030_000_3 + 3*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_030_110_1 = PB[0]*v_030_010_1 - PC0[l]*v_030_010_2;
+        const double v_030_210_0 = PB[0]*v_030_110_0 - PC0[l]*v_030_110_1 + 1*oo2p*(v_030_010_0 - v_030_010_1);
+        const double v_030_201_0 = PB[2]*v_030_200_0 - PC2[l]*v_030_200_1;
+        const double v_030_020_0 = PB[1]*v_030_010_0 - PC1[l]*v_030_010_1 + 3*oo2p*(v_020_010_0 - v_020_010_1) + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_020_1 = PB[1]*v_030_010_1 - PC1[l]*v_030_010_2 + 3*oo2p*(v_020_010_1 - v_020_010_2) + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_030_120_0 = PB[0]*v_030_020_0 - PC0[l]*v_030_020_1;
+        const double v_030_011_0 = PB[2]*v_030_010_0 - PC2[l]*v_030_010_1;
+        const double v_030_011_1 = PB[2]*v_030_010_1 - PC2[l]*v_030_010_2;
+        const double v_030_111_0 = PB[0]*v_030_011_0 - PC0[l]*v_030_011_1;
+        const double v_030_001_0 = PB[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_030_001_1 = PB[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_030_002_0 = PB[2]*v_030_001_0 - PC2[l]*v_030_001_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_001_2 = PB[2]*v_030_000_2 - PC2[l]*v_030_000_3;
+        const double v_030_002_1 = PB[2]*v_030_001_1 - PC2[l]*v_030_001_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_030_102_0 = PB[0]*v_030_002_0 - PC0[l]*v_030_002_1;
+        const double v_030_030_0 = PB[1]*v_030_020_0 - PC1[l]*v_030_020_1 + 3*oo2p*(v_020_020_0 - v_020_020_1) + 2*oo2p*(v_030_010_0 - v_030_010_1);
+        const double v_030_021_0 = PB[2]*v_030_020_0 - PC2[l]*v_030_020_1;
+        const double v_030_012_0 = PB[1]*v_030_002_0 - PC1[l]*v_030_002_1 + 3*oo2p*(v_020_002_0 - v_020_002_1);
+        const double v_030_003_0 = PB[2]*v_030_002_0 - PC2[l]*v_030_002_1 + 2*oo2p*(v_030_001_0 - v_030_001_1);
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_021_000_1 = PA[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_021_100_0 = PB[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_000_2 = PA[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_021_100_1 = PB[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_021_200_0 = PB[0]*v_021_100_0 - PC0[l]*v_021_100_1 + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_000_3 = PA[2]*v_020_000_3 - PC2[l]*v_020_000_4;
+        const double v_021_100_2 = PB[0]*v_021_000_2 - PC0[l]*v_021_000_3;
+        const double v_021_200_1 = PB[0]*v_021_100_1 - PC0[l]*v_021_100_2 + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_021_300_0 = PB[0]*v_021_200_0 - PC0[l]*v_021_200_1 + 2*oo2p*(v_021_100_0 - v_021_100_1);
+        const double v_021_010_0 = PB[1]*v_021_000_0 - PC1[l]*v_021_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_021_010_1 = PB[1]*v_021_000_1 - PC1[l]*v_021_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_021_110_0 = PB[0]*v_021_010_0 - PC0[l]*v_021_010_1;
+        const double v_021_010_2 = PB[1]*v_021_000_2 - PC1[l]*v_021_000_3 + 2*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_021_110_1 = PB[0]*v_021_010_1 - PC0[l]*v_021_010_2;
+        const double v_021_210_0 = PB[0]*v_021_110_0 - PC0[l]*v_021_110_1 + 1*oo2p*(v_021_010_0 - v_021_010_1);
+        const double v_021_001_0 = PB[2]*v_021_000_0 - PC2[l]*v_021_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_021_001_1 = PB[2]*v_021_000_1 - PC2[l]*v_021_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_021_101_0 = PB[0]*v_021_001_0 - PC0[l]*v_021_001_1;
+        const double v_021_001_2 = PB[2]*v_021_000_2 - PC2[l]*v_021_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_021_101_1 = PB[0]*v_021_001_1 - PC0[l]*v_021_001_2;
+        const double v_021_201_0 = PB[0]*v_021_101_0 - PC0[l]*v_021_101_1 + 1*oo2p*(v_021_001_0 - v_021_001_1);
+        const double v_021_020_0 = PB[1]*v_021_010_0 - PC1[l]*v_021_010_1 + 2*oo2p*(v_011_010_0 - v_011_010_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_020_1 = PB[1]*v_021_010_1 - PC1[l]*v_021_010_2 + 2*oo2p*(v_011_010_1 - v_011_010_2) + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_021_120_0 = PB[0]*v_021_020_0 - PC0[l]*v_021_020_1;
+        const double v_021_011_0 = PB[1]*v_021_001_0 - PC1[l]*v_021_001_1 + 2*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_021_011_1 = PB[1]*v_021_001_1 - PC1[l]*v_021_001_2 + 2*oo2p*(v_011_001_1 - v_011_001_2);
+        const double v_021_111_0 = PB[0]*v_021_011_0 - PC0[l]*v_021_011_1;
+        const double v_021_002_0 = PB[2]*v_021_001_0 - PC2[l]*v_021_001_1 + 1*oo2p*(v_020_001_0 - v_020_001_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_002_1 = PB[2]*v_021_001_1 - PC2[l]*v_021_001_2 + 1*oo2p*(v_020_001_1 - v_020_001_2) + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_021_102_0 = PB[0]*v_021_002_0 - PC0[l]*v_021_002_1;
+        const double v_021_030_0 = PB[1]*v_021_020_0 - PC1[l]*v_021_020_1 + 2*oo2p*(v_011_020_0 - v_011_020_1) + 2*oo2p*(v_021_010_0 - v_021_010_1);
+        const double v_021_021_0 = PB[2]*v_021_020_0 - PC2[l]*v_021_020_1 + 1*oo2p*(v_020_020_0 - v_020_020_1);
+        const double v_021_012_0 = PB[1]*v_021_002_0 - PC1[l]*v_021_002_1 + 2*oo2p*(v_011_002_0 - v_011_002_1);
+        const double v_021_003_0 = PB[2]*v_021_002_0 - PC2[l]*v_021_002_1 + 1*oo2p*(v_020_002_0 - v_020_002_1) + 2*oo2p*(v_021_001_0 - v_021_001_1);
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_012_000_1 = PA[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_012_100_0 = PB[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_000_2 = PA[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_012_100_1 = PB[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_012_200_0 = PB[0]*v_012_100_0 - PC0[l]*v_012_100_1 + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_000_3 = PA[1]*v_002_000_3 - PC1[l]*v_002_000_4;
+        const double v_012_100_2 = PB[0]*v_012_000_2 - PC0[l]*v_012_000_3;
+        const double v_012_200_1 = PB[0]*v_012_100_1 - PC0[l]*v_012_100_2 + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_012_300_0 = PB[0]*v_012_200_0 - PC0[l]*v_012_200_1 + 2*oo2p*(v_012_100_0 - v_012_100_1);
+        const double v_012_010_0 = PB[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_012_010_1 = PB[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_012_110_0 = PB[0]*v_012_010_0 - PC0[l]*v_012_010_1;
+        const double v_012_010_2 = PB[1]*v_012_000_2 - PC1[l]*v_012_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_012_110_1 = PB[0]*v_012_010_1 - PC0[l]*v_012_010_2;
+        const double v_012_210_0 = PB[0]*v_012_110_0 - PC0[l]*v_012_110_1 + 1*oo2p*(v_012_010_0 - v_012_010_1);
+        const double v_012_001_0 = PB[2]*v_012_000_0 - PC2[l]*v_012_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_012_001_1 = PB[2]*v_012_000_1 - PC2[l]*v_012_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_012_101_0 = PB[0]*v_012_001_0 - PC0[l]*v_012_001_1;
+        const double v_012_001_2 = PB[2]*v_012_000_2 - PC2[l]*v_012_000_3 + 2*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_012_101_1 = PB[0]*v_012_001_1 - PC0[l]*v_012_001_2;
+        const double v_012_201_0 = PB[0]*v_012_101_0 - PC0[l]*v_012_101_1 + 1*oo2p*(v_012_001_0 - v_012_001_1);
+        const double v_012_020_0 = PB[1]*v_012_010_0 - PC1[l]*v_012_010_1 + 1*oo2p*(v_002_010_0 - v_002_010_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_020_1 = PB[1]*v_012_010_1 - PC1[l]*v_012_010_2 + 1*oo2p*(v_002_010_1 - v_002_010_2) + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_012_120_0 = PB[0]*v_012_020_0 - PC0[l]*v_012_020_1;
+        const double v_012_011_0 = PB[1]*v_012_001_0 - PC1[l]*v_012_001_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_012_011_1 = PB[1]*v_012_001_1 - PC1[l]*v_012_001_2 + 1*oo2p*(v_002_001_1 - v_002_001_2);
+        const double v_012_111_0 = PB[0]*v_012_011_0 - PC0[l]*v_012_011_1;
+        const double v_012_002_0 = PB[2]*v_012_001_0 - PC2[l]*v_012_001_1 + 2*oo2p*(v_011_001_0 - v_011_001_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_002_1 = PB[2]*v_012_001_1 - PC2[l]*v_012_001_2 + 2*oo2p*(v_011_001_1 - v_011_001_2) + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_012_102_0 = PB[0]*v_012_002_0 - PC0[l]*v_012_002_1;
+        const double v_012_030_0 = PB[1]*v_012_020_0 - PC1[l]*v_012_020_1 + 1*oo2p*(v_002_020_0 - v_002_020_1) + 2*oo2p*(v_012_010_0 - v_012_010_1);
+        const double v_012_021_0 = PB[2]*v_012_020_0 - PC2[l]*v_012_020_1 + 2*oo2p*(v_011_020_0 - v_011_020_1);
+        const double v_012_012_0 = PB[1]*v_012_002_0 - PC1[l]*v_012_002_1 + 1*oo2p*(v_002_002_0 - v_002_002_1);
+        const double v_012_003_0 = PB[2]*v_012_002_0 - PC2[l]*v_012_002_1 + 2*oo2p*(v_011_002_0 - v_011_002_1) + 2*oo2p*(v_012_001_0 - v_012_001_1);
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_003_000_1 = PA[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_003_100_0 = PB[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_000_2 = PA[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_003_100_1 = PB[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_003_200_0 = PB[0]*v_003_100_0 - PC0[l]*v_003_100_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_000_3 = PA[2]*v_002_000_3 - PC2[l]*v_002_000_4 + 2*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_003_100_2 = PB[0]*v_003_000_2 - PC0[l]*v_003_000_3;
+        const double v_003_200_1 = PB[0]*v_003_100_1 - PC0[l]*v_003_100_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_300_0 = PB[0]*v_003_200_0 - PC0[l]*v_003_200_1 + 2*oo2p*(v_003_100_0 - v_003_100_1);
+        const double v_003_210_0 = PB[1]*v_003_200_0 - PC1[l]*v_003_200_1;
+        const double v_003_001_0 = PB[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_003_001_1 = PB[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_003_101_0 = PB[0]*v_003_001_0 - PC0[l]*v_003_001_1;
+        const double v_003_001_2 = PB[2]*v_003_000_2 - PC2[l]*v_003_000_3 + 3*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_003_101_1 = PB[0]*v_003_001_1 - PC0[l]*v_003_001_2;
+        const double v_003_201_0 = PB[0]*v_003_101_0 - PC0[l]*v_003_101_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_003_010_0 = PB[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_003_010_1 = PB[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_003_020_0 = PB[1]*v_003_010_0 - PC1[l]*v_003_010_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_010_2 = PB[1]*v_003_000_2 - PC1[l]*v_003_000_3;
+        const double v_003_020_1 = PB[1]*v_003_010_1 - PC1[l]*v_003_010_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_120_0 = PB[0]*v_003_020_0 - PC0[l]*v_003_020_1;
+        const double v_003_011_0 = PB[1]*v_003_001_0 - PC1[l]*v_003_001_1;
+        const double v_003_011_1 = PB[1]*v_003_001_1 - PC1[l]*v_003_001_2;
+        const double v_003_111_0 = PB[0]*v_003_011_0 - PC0[l]*v_003_011_1;
+        const double v_003_002_0 = PB[2]*v_003_001_0 - PC2[l]*v_003_001_1 + 3*oo2p*(v_002_001_0 - v_002_001_1) + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_002_1 = PB[2]*v_003_001_1 - PC2[l]*v_003_001_2 + 3*oo2p*(v_002_001_1 - v_002_001_2) + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_102_0 = PB[0]*v_003_002_0 - PC0[l]*v_003_002_1;
+        const double v_003_030_0 = PB[1]*v_003_020_0 - PC1[l]*v_003_020_1 + 2*oo2p*(v_003_010_0 - v_003_010_1);
+        const double v_003_021_0 = PB[1]*v_003_011_0 - PC1[l]*v_003_011_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_003_012_0 = PB[1]*v_003_002_0 - PC1[l]*v_003_002_1;
+        const double v_003_003_0 = PB[2]*v_003_002_0 - PC2[l]*v_003_002_1 + 3*oo2p*(v_002_002_0 - v_002_002_1) + 2*oo2p*(v_003_001_0 - v_003_001_1);
+
+        sum_0 += q[l]*v_300_300_0;
+        sum_1 += q[l]*v_300_210_0;
+        sum_2 += q[l]*v_300_201_0;
+        sum_3 += q[l]*v_300_120_0;
+        sum_4 += q[l]*v_300_111_0;
+        sum_5 += q[l]*v_300_102_0;
+        sum_6 += q[l]*v_300_030_0;
+        sum_7 += q[l]*v_300_021_0;
+        sum_8 += q[l]*v_300_012_0;
+        sum_9 += q[l]*v_300_003_0;
+        sum_10 += q[l]*v_210_300_0;
+        sum_11 += q[l]*v_210_210_0;
+        sum_12 += q[l]*v_210_201_0;
+        sum_13 += q[l]*v_210_120_0;
+        sum_14 += q[l]*v_210_111_0;
+        sum_15 += q[l]*v_210_102_0;
+        sum_16 += q[l]*v_210_030_0;
+        sum_17 += q[l]*v_210_021_0;
+        sum_18 += q[l]*v_210_012_0;
+        sum_19 += q[l]*v_210_003_0;
+        sum_20 += q[l]*v_201_300_0;
+        sum_21 += q[l]*v_201_210_0;
+        sum_22 += q[l]*v_201_201_0;
+        sum_23 += q[l]*v_201_120_0;
+        sum_24 += q[l]*v_201_111_0;
+        sum_25 += q[l]*v_201_102_0;
+        sum_26 += q[l]*v_201_030_0;
+        sum_27 += q[l]*v_201_021_0;
+        sum_28 += q[l]*v_201_012_0;
+        sum_29 += q[l]*v_201_003_0;
+        sum_30 += q[l]*v_120_300_0;
+        sum_31 += q[l]*v_120_210_0;
+        sum_32 += q[l]*v_120_201_0;
+        sum_33 += q[l]*v_120_120_0;
+        sum_34 += q[l]*v_120_111_0;
+        sum_35 += q[l]*v_120_102_0;
+        sum_36 += q[l]*v_120_030_0;
+        sum_37 += q[l]*v_120_021_0;
+        sum_38 += q[l]*v_120_012_0;
+        sum_39 += q[l]*v_120_003_0;
+        sum_40 += q[l]*v_111_300_0;
+        sum_41 += q[l]*v_111_210_0;
+        sum_42 += q[l]*v_111_201_0;
+        sum_43 += q[l]*v_111_120_0;
+        sum_44 += q[l]*v_111_111_0;
+        sum_45 += q[l]*v_111_102_0;
+        sum_46 += q[l]*v_111_030_0;
+        sum_47 += q[l]*v_111_021_0;
+        sum_48 += q[l]*v_111_012_0;
+        sum_49 += q[l]*v_111_003_0;
+        sum_50 += q[l]*v_102_300_0;
+        sum_51 += q[l]*v_102_210_0;
+        sum_52 += q[l]*v_102_201_0;
+        sum_53 += q[l]*v_102_120_0;
+        sum_54 += q[l]*v_102_111_0;
+        sum_55 += q[l]*v_102_102_0;
+        sum_56 += q[l]*v_102_030_0;
+        sum_57 += q[l]*v_102_021_0;
+        sum_58 += q[l]*v_102_012_0;
+        sum_59 += q[l]*v_102_003_0;
+        sum_60 += q[l]*v_030_300_0;
+        sum_61 += q[l]*v_030_210_0;
+        sum_62 += q[l]*v_030_201_0;
+        sum_63 += q[l]*v_030_120_0;
+        sum_64 += q[l]*v_030_111_0;
+        sum_65 += q[l]*v_030_102_0;
+        sum_66 += q[l]*v_030_030_0;
+        sum_67 += q[l]*v_030_021_0;
+        sum_68 += q[l]*v_030_012_0;
+        sum_69 += q[l]*v_030_003_0;
+        sum_70 += q[l]*v_021_300_0;
+        sum_71 += q[l]*v_021_210_0;
+        sum_72 += q[l]*v_021_201_0;
+        sum_73 += q[l]*v_021_120_0;
+        sum_74 += q[l]*v_021_111_0;
+        sum_75 += q[l]*v_021_102_0;
+        sum_76 += q[l]*v_021_030_0;
+        sum_77 += q[l]*v_021_021_0;
+        sum_78 += q[l]*v_021_012_0;
+        sum_79 += q[l]*v_021_003_0;
+        sum_80 += q[l]*v_012_300_0;
+        sum_81 += q[l]*v_012_210_0;
+        sum_82 += q[l]*v_012_201_0;
+        sum_83 += q[l]*v_012_120_0;
+        sum_84 += q[l]*v_012_111_0;
+        sum_85 += q[l]*v_012_102_0;
+        sum_86 += q[l]*v_012_030_0;
+        sum_87 += q[l]*v_012_021_0;
+        sum_88 += q[l]*v_012_012_0;
+        sum_89 += q[l]*v_012_003_0;
+        sum_90 += q[l]*v_003_300_0;
+        sum_91 += q[l]*v_003_210_0;
+        sum_92 += q[l]*v_003_201_0;
+        sum_93 += q[l]*v_003_120_0;
+        sum_94 += q[l]*v_003_111_0;
+        sum_95 += q[l]*v_003_102_0;
+        sum_96 += q[l]*v_003_030_0;
+        sum_97 += q[l]*v_003_021_0;
+        sum_98 += q[l]*v_003_012_0;
+        sum_99 += q[l]*v_003_003_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+    acc[45] += sum_45;
+    acc[46] += sum_46;
+    acc[47] += sum_47;
+    acc[48] += sum_48;
+    acc[49] += sum_49;
+    acc[50] += sum_50;
+    acc[51] += sum_51;
+    acc[52] += sum_52;
+    acc[53] += sum_53;
+    acc[54] += sum_54;
+    acc[55] += sum_55;
+    acc[56] += sum_56;
+    acc[57] += sum_57;
+    acc[58] += sum_58;
+    acc[59] += sum_59;
+    acc[60] += sum_60;
+    acc[61] += sum_61;
+    acc[62] += sum_62;
+    acc[63] += sum_63;
+    acc[64] += sum_64;
+    acc[65] += sum_65;
+    acc[66] += sum_66;
+    acc[67] += sum_67;
+    acc[68] += sum_68;
+    acc[69] += sum_69;
+    acc[70] += sum_70;
+    acc[71] += sum_71;
+    acc[72] += sum_72;
+    acc[73] += sum_73;
+    acc[74] += sum_74;
+    acc[75] += sum_75;
+    acc[76] += sum_76;
+    acc[77] += sum_77;
+    acc[78] += sum_78;
+    acc[79] += sum_79;
+    acc[80] += sum_80;
+    acc[81] += sum_81;
+    acc[82] += sum_82;
+    acc[83] += sum_83;
+    acc[84] += sum_84;
+    acc[85] += sum_85;
+    acc[86] += sum_86;
+    acc[87] += sum_87;
+    acc[88] += sum_88;
+    acc[89] += sum_89;
+    acc[90] += sum_90;
+    acc[91] += sum_91;
+    acc[92] += sum_92;
+    acc[93] += sum_93;
+    acc[94] += sum_94;
+    acc[95] += sum_95;
+    acc[96] += sum_96;
+    acc[97] += sum_97;
+    acc[98] += sum_98;
+    acc[99] += sum_99;
+}
+
+
+void potential_kernel_3_4(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+    double sum_45 = 0.0;
+    double sum_46 = 0.0;
+    double sum_47 = 0.0;
+    double sum_48 = 0.0;
+    double sum_49 = 0.0;
+    double sum_50 = 0.0;
+    double sum_51 = 0.0;
+    double sum_52 = 0.0;
+    double sum_53 = 0.0;
+    double sum_54 = 0.0;
+    double sum_55 = 0.0;
+    double sum_56 = 0.0;
+    double sum_57 = 0.0;
+    double sum_58 = 0.0;
+    double sum_59 = 0.0;
+    double sum_60 = 0.0;
+    double sum_61 = 0.0;
+    double sum_62 = 0.0;
+    double sum_63 = 0.0;
+    double sum_64 = 0.0;
+    double sum_65 = 0.0;
+    double sum_66 = 0.0;
+    double sum_67 = 0.0;
+    double sum_68 = 0.0;
+    double sum_69 = 0.0;
+    double sum_70 = 0.0;
+    double sum_71 = 0.0;
+    double sum_72 = 0.0;
+    double sum_73 = 0.0;
+    double sum_74 = 0.0;
+    double sum_75 = 0.0;
+    double sum_76 = 0.0;
+    double sum_77 = 0.0;
+    double sum_78 = 0.0;
+    double sum_79 = 0.0;
+    double sum_80 = 0.0;
+    double sum_81 = 0.0;
+    double sum_82 = 0.0;
+    double sum_83 = 0.0;
+    double sum_84 = 0.0;
+    double sum_85 = 0.0;
+    double sum_86 = 0.0;
+    double sum_87 = 0.0;
+    double sum_88 = 0.0;
+    double sum_89 = 0.0;
+    double sum_90 = 0.0;
+    double sum_91 = 0.0;
+    double sum_92 = 0.0;
+    double sum_93 = 0.0;
+    double sum_94 = 0.0;
+    double sum_95 = 0.0;
+    double sum_96 = 0.0;
+    double sum_97 = 0.0;
+    double sum_98 = 0.0;
+    double sum_99 = 0.0;
+    double sum_100 = 0.0;
+    double sum_101 = 0.0;
+    double sum_102 = 0.0;
+    double sum_103 = 0.0;
+    double sum_104 = 0.0;
+    double sum_105 = 0.0;
+    double sum_106 = 0.0;
+    double sum_107 = 0.0;
+    double sum_108 = 0.0;
+    double sum_109 = 0.0;
+    double sum_110 = 0.0;
+    double sum_111 = 0.0;
+    double sum_112 = 0.0;
+    double sum_113 = 0.0;
+    double sum_114 = 0.0;
+    double sum_115 = 0.0;
+    double sum_116 = 0.0;
+    double sum_117 = 0.0;
+    double sum_118 = 0.0;
+    double sum_119 = 0.0;
+    double sum_120 = 0.0;
+    double sum_121 = 0.0;
+    double sum_122 = 0.0;
+    double sum_123 = 0.0;
+    double sum_124 = 0.0;
+    double sum_125 = 0.0;
+    double sum_126 = 0.0;
+    double sum_127 = 0.0;
+    double sum_128 = 0.0;
+    double sum_129 = 0.0;
+    double sum_130 = 0.0;
+    double sum_131 = 0.0;
+    double sum_132 = 0.0;
+    double sum_133 = 0.0;
+    double sum_134 = 0.0;
+    double sum_135 = 0.0;
+    double sum_136 = 0.0;
+    double sum_137 = 0.0;
+    double sum_138 = 0.0;
+    double sum_139 = 0.0;
+    double sum_140 = 0.0;
+    double sum_141 = 0.0;
+    double sum_142 = 0.0;
+    double sum_143 = 0.0;
+    double sum_144 = 0.0;
+    double sum_145 = 0.0;
+    double sum_146 = 0.0;
+    double sum_147 = 0.0;
+    double sum_148 = 0.0;
+    double sum_149 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_300_000_1 = PA[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_300_100_0 = PB[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_200_000_3 = PA[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_300_000_2 = PA[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_300_100_1 = PB[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_200_100_0 = PB[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_200_100_1 = PB[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_300_200_0 = PB[0]*v_300_100_0 - PC0[l]*v_300_100_1 + 3*oo2p*(v_200_100_0 - v_200_100_1) + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_000_000_6 = F[6*nb + l];
+        const double v_100_000_5 = PA[0]*v_000_000_5 - PC0[l]*v_000_000_6;
+        const double v_200_000_4 = PA[0]*v_100_000_4 - PC0[l]*v_100_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_300_000_3 = PA[0]*v_200_000_3 - PC0[l]*v_200_000_4 + 2*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_300_100_2 = PB[0]*v_300_000_2 - PC0[l]*v_300_000_3 + 3*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_200_100_2 = PB[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_300_200_1 = PB[0]*v_300_100_1 - PC0[l]*v_300_100_2 + 3*oo2p*(v_200_100_1 - v_200_100_2) + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_100_100_1 = PB[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_200_0 = PB[0]*v_200_100_0 - PC0[l]*v_200_100_1 + 2*oo2p*(v_100_100_0 - v_100_100_1) + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_100_100_2 = PB[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_200_200_1 = PB[0]*v_200_100_1 - PC0[l]*v_200_100_2 + 2*oo2p*(v_100_100_1 - v_100_100_2) + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_300_300_0 = PB[0]*v_300_200_0 - PC0[l]*v_300_200_1 + 3*oo2p*(v_200_200_0 - v_200_200_1) + 2*oo2p*(v_300_100_0 - v_300_100_1);
+        const double v_000_000_7 = F[7*nb + l];
+        const double v_100_000_6 = PA[0]*v_000_000_6 - PC0[l]*v_000_000_7;
+        const double v_200_000_5 = PA[0]*v_100_000_5 - PC0[l]*v_100_000_6 + 1*oo2p*(v_000_000_5 - v_000_000_6);
+        const double v_300_000_4 = PA[0]*v_200_000_4 - PC0[l]*v_200_000_5 + 2*oo2p*(v_100_000_4 - v_100_000_5);
+        const double v_300_100_3 = PB[0]*v_300_000_3 - PC0[l]*v_300_000_4 + 3*oo2p*(v_200_000_3 - v_200_000_4);
+        const double v_200_100_3 = PB[0]*v_200_000_3 - PC0[l]*v_200_000_4 + 2*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_300_200_2 = PB[0]*v_300_100_2 - PC0[l]*v_300_100_3 + 3*oo2p*(v_200_100_2 - v_200_100_3) + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_100_100_3 = PB[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_200_200_2 = PB[0]*v_200_100_2 - PC0[l]*v_200_100_3 + 2*oo2p*(v_100_100_2 - v_100_100_3) + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_300_300_1 = PB[0]*v_300_200_1 - PC0[l]*v_300_200_2 + 3*oo2p*(v_200_200_1 - v_200_200_2) + 2*oo2p*(v_300_100_1 - v_300_100_2);
+        const double v_000_100_0 = PB[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_100_1 = PB[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_100_200_0 = PB[0]*v_100_100_0 - PC0[l]*v_100_100_1 + 1*oo2p*(v_000_100_0 - v_000_100_1) + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_100_2 = PB[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_100_200_1 = PB[0]*v_100_100_1 - PC0[l]*v_100_100_2 + 1*oo2p*(v_000_100_1 - v_000_100_2) + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_200_300_0 = PB[0]*v_200_200_0 - PC0[l]*v_200_200_1 + 2*oo2p*(v_100_200_0 - v_100_200_1) + 2*oo2p*(v_200_100_0 - v_200_100_1);
+        const double v_000_100_3 = PB[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_100_200_2 = PB[0]*v_100_100_2 - PC0[l]*v_100_100_3 + 1*oo2p*(v_000_100_2 - v_000_100_3) + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_200_300_1 = PB[0]*v_200_200_1 - PC0[l]*v_200_200_2 + 2*oo2p*(v_100_200_1 - v_100_200_2) + 2*oo2p*(v_200_100_1 - v_200_100_2);
+        const double v_300_400_0 = PB[0]*v_300_300_0 - PC0[l]*v_300_300_1 + 3*oo2p*(v_200_300_0 - v_200_300_1) + 3*oo2p*(v_300_200_0 - v_300_200_1);
+        const double v_300_310_0 = PB[1]*v_300_300_0 - PC1[l]*v_300_300_1;
+        const double v_300_301_0 = PB[2]*v_300_300_0 - PC2[l]*v_300_300_1;
+        const double v_300_210_0 = PB[1]*v_300_200_0 - PC1[l]*v_300_200_1;
+        const double v_300_210_1 = PB[1]*v_300_200_1 - PC1[l]*v_300_200_2;
+        const double v_300_220_0 = PB[1]*v_300_210_0 - PC1[l]*v_300_210_1 + 1*oo2p*(v_300_200_0 - v_300_200_1);
+        const double v_300_201_0 = PB[2]*v_300_200_0 - PC2[l]*v_300_200_1;
+        const double v_300_201_1 = PB[2]*v_300_200_1 - PC2[l]*v_300_200_2;
+        const double v_300_211_0 = PB[1]*v_300_201_0 - PC1[l]*v_300_201_1;
+        const double v_300_202_0 = PB[2]*v_300_201_0 - PC2[l]*v_300_201_1 + 1*oo2p*(v_300_200_0 - v_300_200_1);
+        const double v_300_010_0 = PB[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_300_010_1 = PB[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_300_020_0 = PB[1]*v_300_010_0 - PC1[l]*v_300_010_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_010_2 = PB[1]*v_300_000_2 - PC1[l]*v_300_000_3;
+        const double v_300_020_1 = PB[1]*v_300_010_1 - PC1[l]*v_300_010_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_300_030_0 = PB[1]*v_300_020_0 - PC1[l]*v_300_020_1 + 2*oo2p*(v_300_010_0 - v_300_010_1);
+        const double v_300_010_3 = PB[1]*v_300_000_3 - PC1[l]*v_300_000_4;
+        const double v_300_020_2 = PB[1]*v_300_010_2 - PC1[l]*v_300_010_3 + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_300_030_1 = PB[1]*v_300_020_1 - PC1[l]*v_300_020_2 + 2*oo2p*(v_300_010_1 - v_300_010_2);
+        const double v_200_010_0 = PB[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_200_010_1 = PB[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_200_020_0 = PB[1]*v_200_010_0 - PC1[l]*v_200_010_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_010_2 = PB[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_200_020_1 = PB[1]*v_200_010_1 - PC1[l]*v_200_010_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_200_030_0 = PB[1]*v_200_020_0 - PC1[l]*v_200_020_1 + 2*oo2p*(v_200_010_0 - v_200_010_1);
+        const double v_200_010_3 = PB[1]*v_200_000_3 - PC1[l]*v_200_000_4;
+        const double v_200_020_2 = PB[1]*v_200_010_2 - PC1[l]*v_200_010_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_200_030_1 = PB[1]*v_200_020_1 - PC1[l]*v_200_020_2 + 2*oo2p*(v_200_010_1 - v_200_010_2);
+        const double v_300_130_0 = PB[0]*v_300_030_0 - PC0[l]*v_300_030_1 + 3*oo2p*(v_200_030_0 - v_200_030_1);
+        const double v_300_120_0 = PB[0]*v_300_020_0 - PC0[l]*v_300_020_1 + 3*oo2p*(v_200_020_0 - v_200_020_1);
+        const double v_300_120_1 = PB[0]*v_300_020_1 - PC0[l]*v_300_020_2 + 3*oo2p*(v_200_020_1 - v_200_020_2);
+        const double v_300_121_0 = PB[2]*v_300_120_0 - PC2[l]*v_300_120_1;
+        const double v_300_001_0 = PB[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_300_001_1 = PB[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_300_002_0 = PB[2]*v_300_001_0 - PC2[l]*v_300_001_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_001_2 = PB[2]*v_300_000_2 - PC2[l]*v_300_000_3;
+        const double v_300_002_1 = PB[2]*v_300_001_1 - PC2[l]*v_300_001_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_200_001_0 = PB[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_200_001_1 = PB[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_200_002_0 = PB[2]*v_200_001_0 - PC2[l]*v_200_001_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_001_2 = PB[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_200_002_1 = PB[2]*v_200_001_1 - PC2[l]*v_200_001_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_300_102_0 = PB[0]*v_300_002_0 - PC0[l]*v_300_002_1 + 3*oo2p*(v_200_002_0 - v_200_002_1);
+        const double v_300_001_3 = PB[2]*v_300_000_3 - PC2[l]*v_300_000_4;
+        const double v_300_002_2 = PB[2]*v_300_001_2 - PC2[l]*v_300_001_3 + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_200_001_3 = PB[2]*v_200_000_3 - PC2[l]*v_200_000_4;
+        const double v_200_002_2 = PB[2]*v_200_001_2 - PC2[l]*v_200_001_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_300_102_1 = PB[0]*v_300_002_1 - PC0[l]*v_300_002_2 + 3*oo2p*(v_200_002_1 - v_200_002_2);
+        const double v_300_112_0 = PB[1]*v_300_102_0 - PC1[l]*v_300_102_1;
+        const double v_300_003_0 = PB[2]*v_300_002_0 - PC2[l]*v_300_002_1 + 2*oo2p*(v_300_001_0 - v_300_001_1);
+        const double v_300_003_1 = PB[2]*v_300_002_1 - PC2[l]*v_300_002_2 + 2*oo2p*(v_300_001_1 - v_300_001_2);
+        const double v_200_003_0 = PB[2]*v_200_002_0 - PC2[l]*v_200_002_1 + 2*oo2p*(v_200_001_0 - v_200_001_1);
+        const double v_200_003_1 = PB[2]*v_200_002_1 - PC2[l]*v_200_002_2 + 2*oo2p*(v_200_001_1 - v_200_001_2);
+        const double v_300_103_0 = PB[0]*v_300_003_0 - PC0[l]*v_300_003_1 + 3*oo2p*(v_200_003_0 - v_200_003_1);
+        const double v_300_040_0 = PB[1]*v_300_030_0 - PC1[l]*v_300_030_1 + 3*oo2p*(v_300_020_0 - v_300_020_1);
+        const double v_300_031_0 = PB[2]*v_300_030_0 - PC2[l]*v_300_030_1;
+        const double v_300_012_0 = PB[1]*v_300_002_0 - PC1[l]*v_300_002_1;
+        const double v_300_012_1 = PB[1]*v_300_002_1 - PC1[l]*v_300_002_2;
+        const double v_300_022_0 = PB[1]*v_300_012_0 - PC1[l]*v_300_012_1 + 1*oo2p*(v_300_002_0 - v_300_002_1);
+        const double v_300_013_0 = PB[1]*v_300_003_0 - PC1[l]*v_300_003_1;
+        const double v_300_004_0 = PB[2]*v_300_003_0 - PC2[l]*v_300_003_1 + 3*oo2p*(v_300_002_0 - v_300_002_1);
+        const double v_210_000_0 = PA[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_210_000_1 = PA[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_210_100_0 = PB[0]*v_210_000_0 - PC0[l]*v_210_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_210_000_2 = PA[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_110_000_2 = PA[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_210_100_1 = PB[0]*v_210_000_1 - PC0[l]*v_210_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_110_100_0 = PB[0]*v_110_000_0 - PC0[l]*v_110_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_110_100_1 = PB[0]*v_110_000_1 - PC0[l]*v_110_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_210_200_0 = PB[0]*v_210_100_0 - PC0[l]*v_210_100_1 + 2*oo2p*(v_110_100_0 - v_110_100_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_000_3 = PA[1]*v_200_000_3 - PC1[l]*v_200_000_4;
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_110_000_3 = PA[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_210_100_2 = PB[0]*v_210_000_2 - PC0[l]*v_210_000_3 + 2*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_110_100_2 = PB[0]*v_110_000_2 - PC0[l]*v_110_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_210_200_1 = PB[0]*v_210_100_1 - PC0[l]*v_210_100_2 + 2*oo2p*(v_110_100_1 - v_110_100_2) + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_100_1 = PB[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_200_0 = PB[0]*v_110_100_0 - PC0[l]*v_110_100_1 + 1*oo2p*(v_010_100_0 - v_010_100_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_010_100_2 = PB[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_110_200_1 = PB[0]*v_110_100_1 - PC0[l]*v_110_100_2 + 1*oo2p*(v_010_100_1 - v_010_100_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_210_300_0 = PB[0]*v_210_200_0 - PC0[l]*v_210_200_1 + 2*oo2p*(v_110_200_0 - v_110_200_1) + 2*oo2p*(v_210_100_0 - v_210_100_1);
+        const double v_210_000_4 = PA[1]*v_200_000_4 - PC1[l]*v_200_000_5;
+        const double v_010_000_5 = PA[1]*v_000_000_5 - PC1[l]*v_000_000_6;
+        const double v_110_000_4 = PA[0]*v_010_000_4 - PC0[l]*v_010_000_5;
+        const double v_210_100_3 = PB[0]*v_210_000_3 - PC0[l]*v_210_000_4 + 2*oo2p*(v_110_000_3 - v_110_000_4);
+        const double v_110_100_3 = PB[0]*v_110_000_3 - PC0[l]*v_110_000_4 + 1*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_210_200_2 = PB[0]*v_210_100_2 - PC0[l]*v_210_100_3 + 2*oo2p*(v_110_100_2 - v_110_100_3) + 1*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_010_100_3 = PB[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_110_200_2 = PB[0]*v_110_100_2 - PC0[l]*v_110_100_3 + 1*oo2p*(v_010_100_2 - v_010_100_3) + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_210_300_1 = PB[0]*v_210_200_1 - PC0[l]*v_210_200_2 + 2*oo2p*(v_110_200_1 - v_110_200_2) + 2*oo2p*(v_210_100_1 - v_210_100_2);
+        const double v_010_200_0 = PB[0]*v_010_100_0 - PC0[l]*v_010_100_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_200_1 = PB[0]*v_010_100_1 - PC0[l]*v_010_100_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_110_300_0 = PB[0]*v_110_200_0 - PC0[l]*v_110_200_1 + 1*oo2p*(v_010_200_0 - v_010_200_1) + 2*oo2p*(v_110_100_0 - v_110_100_1);
+        const double v_010_200_2 = PB[0]*v_010_100_2 - PC0[l]*v_010_100_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_110_300_1 = PB[0]*v_110_200_1 - PC0[l]*v_110_200_2 + 1*oo2p*(v_010_200_1 - v_010_200_2) + 2*oo2p*(v_110_100_1 - v_110_100_2);
+        const double v_210_400_0 = PB[0]*v_210_300_0 - PC0[l]*v_210_300_1 + 2*oo2p*(v_110_300_0 - v_110_300_1) + 3*oo2p*(v_210_200_0 - v_210_200_1);
+        const double v_210_310_0 = PB[1]*v_210_300_0 - PC1[l]*v_210_300_1 + 1*oo2p*(v_200_300_0 - v_200_300_1);
+        const double v_210_301_0 = PB[2]*v_210_300_0 - PC2[l]*v_210_300_1;
+        const double v_210_010_0 = PB[1]*v_210_000_0 - PC1[l]*v_210_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_210_010_1 = PB[1]*v_210_000_1 - PC1[l]*v_210_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_210_020_0 = PB[1]*v_210_010_0 - PC1[l]*v_210_010_1 + 1*oo2p*(v_200_010_0 - v_200_010_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_010_2 = PB[1]*v_210_000_2 - PC1[l]*v_210_000_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_210_020_1 = PB[1]*v_210_010_1 - PC1[l]*v_210_010_2 + 1*oo2p*(v_200_010_1 - v_200_010_2) + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_110_010_0 = PB[1]*v_110_000_0 - PC1[l]*v_110_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_110_010_1 = PB[1]*v_110_000_1 - PC1[l]*v_110_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_010_1 = PB[1]*v_100_000_1 - PC1[l]*v_100_000_2;
+        const double v_110_020_0 = PB[1]*v_110_010_0 - PC1[l]*v_110_010_1 + 1*oo2p*(v_100_010_0 - v_100_010_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_010_2 = PB[1]*v_110_000_2 - PC1[l]*v_110_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_100_010_2 = PB[1]*v_100_000_2 - PC1[l]*v_100_000_3;
+        const double v_110_020_1 = PB[1]*v_110_010_1 - PC1[l]*v_110_010_2 + 1*oo2p*(v_100_010_1 - v_100_010_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_210_120_0 = PB[0]*v_210_020_0 - PC0[l]*v_210_020_1 + 2*oo2p*(v_110_020_0 - v_110_020_1);
+        const double v_210_010_3 = PB[1]*v_210_000_3 - PC1[l]*v_210_000_4 + 1*oo2p*(v_200_000_3 - v_200_000_4);
+        const double v_210_020_2 = PB[1]*v_210_010_2 - PC1[l]*v_210_010_3 + 1*oo2p*(v_200_010_2 - v_200_010_3) + 1*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_110_010_3 = PB[1]*v_110_000_3 - PC1[l]*v_110_000_4 + 1*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_100_010_3 = PB[1]*v_100_000_3 - PC1[l]*v_100_000_4;
+        const double v_110_020_2 = PB[1]*v_110_010_2 - PC1[l]*v_110_010_3 + 1*oo2p*(v_100_010_2 - v_100_010_3) + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_210_120_1 = PB[0]*v_210_020_1 - PC0[l]*v_210_020_2 + 2*oo2p*(v_110_020_1 - v_110_020_2);
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_010_1 = PB[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_010_0 = PB[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_000_010_1 = PB[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_010_020_0 = PB[1]*v_010_010_0 - PC1[l]*v_010_010_1 + 1*oo2p*(v_000_010_0 - v_000_010_1) + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_010_2 = PB[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_010_2 = PB[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_010_020_1 = PB[1]*v_010_010_1 - PC1[l]*v_010_010_2 + 1*oo2p*(v_000_010_1 - v_000_010_2) + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_110_120_0 = PB[0]*v_110_020_0 - PC0[l]*v_110_020_1 + 1*oo2p*(v_010_020_0 - v_010_020_1);
+        const double v_010_010_3 = PB[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_000_010_3 = PB[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_010_020_2 = PB[1]*v_010_010_2 - PC1[l]*v_010_010_3 + 1*oo2p*(v_000_010_2 - v_000_010_3) + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_110_120_1 = PB[0]*v_110_020_1 - PC0[l]*v_110_020_2 + 1*oo2p*(v_010_020_1 - v_010_020_2);
+        const double v_210_220_0 = PB[0]*v_210_120_0 - PC0[l]*v_210_120_1 + 2*oo2p*(v_110_120_0 - v_110_120_1) + 1*oo2p*(v_210_020_0 - v_210_020_1);
+        const double v_210_210_0 = PB[1]*v_210_200_0 - PC1[l]*v_210_200_1 + 1*oo2p*(v_200_200_0 - v_200_200_1);
+        const double v_210_210_1 = PB[1]*v_210_200_1 - PC1[l]*v_210_200_2 + 1*oo2p*(v_200_200_1 - v_200_200_2);
+        const double v_210_211_0 = PB[2]*v_210_210_0 - PC2[l]*v_210_210_1;
+        const double v_210_201_0 = PB[2]*v_210_200_0 - PC2[l]*v_210_200_1;
+        const double v_210_201_1 = PB[2]*v_210_200_1 - PC2[l]*v_210_200_2;
+        const double v_210_202_0 = PB[2]*v_210_201_0 - PC2[l]*v_210_201_1 + 1*oo2p*(v_210_200_0 - v_210_200_1);
+        const double v_210_030_0 = PB[1]*v_210_020_0 - PC1[l]*v_210_020_1 + 1*oo2p*(v_200_020_0 - v_200_020_1) + 2*oo2p*(v_210_010_0 - v_210_010_1);
+        const double v_210_030_1 = PB[1]*v_210_020_1 - PC1[l]*v_210_020_2 + 1*oo2p*(v_200_020_1 - v_200_020_2) + 2*oo2p*(v_210_010_1 - v_210_010_2);
+        const double v_100_020_0 = PB[1]*v_100_010_0 - PC1[l]*v_100_010_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_020_1 = PB[1]*v_100_010_1 - PC1[l]*v_100_010_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_110_030_0 = PB[1]*v_110_020_0 - PC1[l]*v_110_020_1 + 1*oo2p*(v_100_020_0 - v_100_020_1) + 2*oo2p*(v_110_010_0 - v_110_010_1);
+        const double v_100_020_2 = PB[1]*v_100_010_2 - PC1[l]*v_100_010_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_110_030_1 = PB[1]*v_110_020_1 - PC1[l]*v_110_020_2 + 1*oo2p*(v_100_020_1 - v_100_020_2) + 2*oo2p*(v_110_010_1 - v_110_010_2);
+        const double v_210_130_0 = PB[0]*v_210_030_0 - PC0[l]*v_210_030_1 + 2*oo2p*(v_110_030_0 - v_110_030_1);
+        const double v_210_121_0 = PB[2]*v_210_120_0 - PC2[l]*v_210_120_1;
+        const double v_210_001_0 = PB[2]*v_210_000_0 - PC2[l]*v_210_000_1;
+        const double v_210_001_1 = PB[2]*v_210_000_1 - PC2[l]*v_210_000_2;
+        const double v_210_002_0 = PB[2]*v_210_001_0 - PC2[l]*v_210_001_1 + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_001_2 = PB[2]*v_210_000_2 - PC2[l]*v_210_000_3;
+        const double v_210_002_1 = PB[2]*v_210_001_1 - PC2[l]*v_210_001_2 + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_210_012_0 = PB[1]*v_210_002_0 - PC1[l]*v_210_002_1 + 1*oo2p*(v_200_002_0 - v_200_002_1);
+        const double v_210_001_3 = PB[2]*v_210_000_3 - PC2[l]*v_210_000_4;
+        const double v_210_002_2 = PB[2]*v_210_001_2 - PC2[l]*v_210_001_3 + 1*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_210_012_1 = PB[1]*v_210_002_1 - PC1[l]*v_210_002_2 + 1*oo2p*(v_200_002_1 - v_200_002_2);
+        const double v_110_001_0 = PB[2]*v_110_000_0 - PC2[l]*v_110_000_1;
+        const double v_110_001_1 = PB[2]*v_110_000_1 - PC2[l]*v_110_000_2;
+        const double v_110_002_0 = PB[2]*v_110_001_0 - PC2[l]*v_110_001_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_001_2 = PB[2]*v_110_000_2 - PC2[l]*v_110_000_3;
+        const double v_110_002_1 = PB[2]*v_110_001_1 - PC2[l]*v_110_001_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_100_001_1 = PB[2]*v_100_000_1 - PC2[l]*v_100_000_2;
+        const double v_100_002_0 = PB[2]*v_100_001_0 - PC2[l]*v_100_001_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_100_001_2 = PB[2]*v_100_000_2 - PC2[l]*v_100_000_3;
+        const double v_100_002_1 = PB[2]*v_100_001_1 - PC2[l]*v_100_001_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_110_012_0 = PB[1]*v_110_002_0 - PC1[l]*v_110_002_1 + 1*oo2p*(v_100_002_0 - v_100_002_1);
+        const double v_110_001_3 = PB[2]*v_110_000_3 - PC2[l]*v_110_000_4;
+        const double v_110_002_2 = PB[2]*v_110_001_2 - PC2[l]*v_110_001_3 + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_100_001_3 = PB[2]*v_100_000_3 - PC2[l]*v_100_000_4;
+        const double v_100_002_2 = PB[2]*v_100_001_2 - PC2[l]*v_100_001_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_110_012_1 = PB[1]*v_110_002_1 - PC1[l]*v_110_002_2 + 1*oo2p*(v_100_002_1 - v_100_002_2);
+        const double v_210_112_0 = PB[0]*v_210_012_0 - PC0[l]*v_210_012_1 + 2*oo2p*(v_110_012_0 - v_110_012_1);
+        const double v_210_003_0 = PB[2]*v_210_002_0 - PC2[l]*v_210_002_1 + 2*oo2p*(v_210_001_0 - v_210_001_1);
+        const double v_210_003_1 = PB[2]*v_210_002_1 - PC2[l]*v_210_002_2 + 2*oo2p*(v_210_001_1 - v_210_001_2);
+        const double v_110_003_0 = PB[2]*v_110_002_0 - PC2[l]*v_110_002_1 + 2*oo2p*(v_110_001_0 - v_110_001_1);
+        const double v_110_003_1 = PB[2]*v_110_002_1 - PC2[l]*v_110_002_2 + 2*oo2p*(v_110_001_1 - v_110_001_2);
+        const double v_210_103_0 = PB[0]*v_210_003_0 - PC0[l]*v_210_003_1 + 2*oo2p*(v_110_003_0 - v_110_003_1);
+        const double v_210_040_0 = PB[1]*v_210_030_0 - PC1[l]*v_210_030_1 + 1*oo2p*(v_200_030_0 - v_200_030_1) + 3*oo2p*(v_210_020_0 - v_210_020_1);
+        const double v_210_031_0 = PB[2]*v_210_030_0 - PC2[l]*v_210_030_1;
+        const double v_210_021_0 = PB[2]*v_210_020_0 - PC2[l]*v_210_020_1;
+        const double v_210_021_1 = PB[2]*v_210_020_1 - PC2[l]*v_210_020_2;
+        const double v_210_022_0 = PB[2]*v_210_021_0 - PC2[l]*v_210_021_1 + 1*oo2p*(v_210_020_0 - v_210_020_1);
+        const double v_210_013_0 = PB[1]*v_210_003_0 - PC1[l]*v_210_003_1 + 1*oo2p*(v_200_003_0 - v_200_003_1);
+        const double v_210_004_0 = PB[2]*v_210_003_0 - PC2[l]*v_210_003_1 + 3*oo2p*(v_210_002_0 - v_210_002_1);
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_201_000_1 = PA[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_201_100_0 = PB[0]*v_201_000_0 - PC0[l]*v_201_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_201_000_2 = PA[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_101_000_2 = PA[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_201_100_1 = PB[0]*v_201_000_1 - PC0[l]*v_201_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_101_100_0 = PB[0]*v_101_000_0 - PC0[l]*v_101_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_101_100_1 = PB[0]*v_101_000_1 - PC0[l]*v_101_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_201_200_0 = PB[0]*v_201_100_0 - PC0[l]*v_201_100_1 + 2*oo2p*(v_101_100_0 - v_101_100_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_000_3 = PA[2]*v_200_000_3 - PC2[l]*v_200_000_4;
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_101_000_3 = PA[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_201_100_2 = PB[0]*v_201_000_2 - PC0[l]*v_201_000_3 + 2*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_101_100_2 = PB[0]*v_101_000_2 - PC0[l]*v_101_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_201_200_1 = PB[0]*v_201_100_1 - PC0[l]*v_201_100_2 + 2*oo2p*(v_101_100_1 - v_101_100_2) + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_100_1 = PB[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_200_0 = PB[0]*v_101_100_0 - PC0[l]*v_101_100_1 + 1*oo2p*(v_001_100_0 - v_001_100_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_001_100_2 = PB[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_101_200_1 = PB[0]*v_101_100_1 - PC0[l]*v_101_100_2 + 1*oo2p*(v_001_100_1 - v_001_100_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_201_300_0 = PB[0]*v_201_200_0 - PC0[l]*v_201_200_1 + 2*oo2p*(v_101_200_0 - v_101_200_1) + 2*oo2p*(v_201_100_0 - v_201_100_1);
+        const double v_201_000_4 = PA[2]*v_200_000_4 - PC2[l]*v_200_000_5;
+        const double v_001_000_5 = PA[2]*v_000_000_5 - PC2[l]*v_000_000_6;
+        const double v_101_000_4 = PA[0]*v_001_000_4 - PC0[l]*v_001_000_5;
+        const double v_201_100_3 = PB[0]*v_201_000_3 - PC0[l]*v_201_000_4 + 2*oo2p*(v_101_000_3 - v_101_000_4);
+        const double v_101_100_3 = PB[0]*v_101_000_3 - PC0[l]*v_101_000_4 + 1*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_201_200_2 = PB[0]*v_201_100_2 - PC0[l]*v_201_100_3 + 2*oo2p*(v_101_100_2 - v_101_100_3) + 1*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_001_100_3 = PB[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_101_200_2 = PB[0]*v_101_100_2 - PC0[l]*v_101_100_3 + 1*oo2p*(v_001_100_2 - v_001_100_3) + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_201_300_1 = PB[0]*v_201_200_1 - PC0[l]*v_201_200_2 + 2*oo2p*(v_101_200_1 - v_101_200_2) + 2*oo2p*(v_201_100_1 - v_201_100_2);
+        const double v_001_200_0 = PB[0]*v_001_100_0 - PC0[l]*v_001_100_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_200_1 = PB[0]*v_001_100_1 - PC0[l]*v_001_100_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_101_300_0 = PB[0]*v_101_200_0 - PC0[l]*v_101_200_1 + 1*oo2p*(v_001_200_0 - v_001_200_1) + 2*oo2p*(v_101_100_0 - v_101_100_1);
+        const double v_001_200_2 = PB[0]*v_001_100_2 - PC0[l]*v_001_100_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_101_300_1 = PB[0]*v_101_200_1 - PC0[l]*v_101_200_2 + 1*oo2p*(v_001_200_1 - v_001_200_2) + 2*oo2p*(v_101_100_1 - v_101_100_2);
+        const double v_201_400_0 = PB[0]*v_201_300_0 - PC0[l]*v_201_300_1 + 2*oo2p*(v_101_300_0 - v_101_300_1) + 3*oo2p*(v_201_200_0 - v_201_200_1);
+        const double v_201_310_0 = PB[1]*v_201_300_0 - PC1[l]*v_201_300_1;
+        const double v_201_301_0 = PB[2]*v_201_300_0 - PC2[l]*v_201_300_1 + 1*oo2p*(v_200_300_0 - v_200_300_1);
+        const double v_201_210_0 = PB[1]*v_201_200_0 - PC1[l]*v_201_200_1;
+        const double v_201_210_1 = PB[1]*v_201_200_1 - PC1[l]*v_201_200_2;
+        const double v_201_220_0 = PB[1]*v_201_210_0 - PC1[l]*v_201_210_1 + 1*oo2p*(v_201_200_0 - v_201_200_1);
+        const double v_201_201_0 = PB[2]*v_201_200_0 - PC2[l]*v_201_200_1 + 1*oo2p*(v_200_200_0 - v_200_200_1);
+        const double v_201_201_1 = PB[2]*v_201_200_1 - PC2[l]*v_201_200_2 + 1*oo2p*(v_200_200_1 - v_200_200_2);
+        const double v_201_211_0 = PB[1]*v_201_201_0 - PC1[l]*v_201_201_1;
+        const double v_201_001_0 = PB[2]*v_201_000_0 - PC2[l]*v_201_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_201_001_1 = PB[2]*v_201_000_1 - PC2[l]*v_201_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_201_002_0 = PB[2]*v_201_001_0 - PC2[l]*v_201_001_1 + 1*oo2p*(v_200_001_0 - v_200_001_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_001_2 = PB[2]*v_201_000_2 - PC2[l]*v_201_000_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_201_002_1 = PB[2]*v_201_001_1 - PC2[l]*v_201_001_2 + 1*oo2p*(v_200_001_1 - v_200_001_2) + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_101_001_0 = PB[2]*v_101_000_0 - PC2[l]*v_101_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_101_001_1 = PB[2]*v_101_000_1 - PC2[l]*v_101_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_101_002_0 = PB[2]*v_101_001_0 - PC2[l]*v_101_001_1 + 1*oo2p*(v_100_001_0 - v_100_001_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_001_2 = PB[2]*v_101_000_2 - PC2[l]*v_101_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_101_002_1 = PB[2]*v_101_001_1 - PC2[l]*v_101_001_2 + 1*oo2p*(v_100_001_1 - v_100_001_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_201_102_0 = PB[0]*v_201_002_0 - PC0[l]*v_201_002_1 + 2*oo2p*(v_101_002_0 - v_101_002_1);
+        const double v_201_001_3 = PB[2]*v_201_000_3 - PC2[l]*v_201_000_4 + 1*oo2p*(v_200_000_3 - v_200_000_4);
+        const double v_201_002_2 = PB[2]*v_201_001_2 - PC2[l]*v_201_001_3 + 1*oo2p*(v_200_001_2 - v_200_001_3) + 1*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_101_001_3 = PB[2]*v_101_000_3 - PC2[l]*v_101_000_4 + 1*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_101_002_2 = PB[2]*v_101_001_2 - PC2[l]*v_101_001_3 + 1*oo2p*(v_100_001_2 - v_100_001_3) + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_201_102_1 = PB[0]*v_201_002_1 - PC0[l]*v_201_002_2 + 2*oo2p*(v_101_002_1 - v_101_002_2);
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_001_1 = PB[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_000_001_0 = PB[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_000_001_1 = PB[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_001_002_0 = PB[2]*v_001_001_0 - PC2[l]*v_001_001_1 + 1*oo2p*(v_000_001_0 - v_000_001_1) + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_001_2 = PB[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_000_001_2 = PB[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_001_002_1 = PB[2]*v_001_001_1 - PC2[l]*v_001_001_2 + 1*oo2p*(v_000_001_1 - v_000_001_2) + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_101_102_0 = PB[0]*v_101_002_0 - PC0[l]*v_101_002_1 + 1*oo2p*(v_001_002_0 - v_001_002_1);
+        const double v_001_001_3 = PB[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_000_001_3 = PB[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_001_002_2 = PB[2]*v_001_001_2 - PC2[l]*v_001_001_3 + 1*oo2p*(v_000_001_2 - v_000_001_3) + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_101_102_1 = PB[0]*v_101_002_1 - PC0[l]*v_101_002_2 + 1*oo2p*(v_001_002_1 - v_001_002_2);
+        const double v_201_202_0 = PB[0]*v_201_102_0 - PC0[l]*v_201_102_1 + 2*oo2p*(v_101_102_0 - v_101_102_1) + 1*oo2p*(v_201_002_0 - v_201_002_1);
+        const double v_201_010_0 = PB[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_201_010_1 = PB[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_201_020_0 = PB[1]*v_201_010_0 - PC1[l]*v_201_010_1 + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_010_2 = PB[1]*v_201_000_2 - PC1[l]*v_201_000_3;
+        const double v_201_020_1 = PB[1]*v_201_010_1 - PC1[l]*v_201_010_2 + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_201_030_0 = PB[1]*v_201_020_0 - PC1[l]*v_201_020_1 + 2*oo2p*(v_201_010_0 - v_201_010_1);
+        const double v_201_010_3 = PB[1]*v_201_000_3 - PC1[l]*v_201_000_4;
+        const double v_201_020_2 = PB[1]*v_201_010_2 - PC1[l]*v_201_010_3 + 1*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_201_030_1 = PB[1]*v_201_020_1 - PC1[l]*v_201_020_2 + 2*oo2p*(v_201_010_1 - v_201_010_2);
+        const double v_101_010_0 = PB[1]*v_101_000_0 - PC1[l]*v_101_000_1;
+        const double v_101_010_1 = PB[1]*v_101_000_1 - PC1[l]*v_101_000_2;
+        const double v_101_020_0 = PB[1]*v_101_010_0 - PC1[l]*v_101_010_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_010_2 = PB[1]*v_101_000_2 - PC1[l]*v_101_000_3;
+        const double v_101_020_1 = PB[1]*v_101_010_1 - PC1[l]*v_101_010_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_101_030_0 = PB[1]*v_101_020_0 - PC1[l]*v_101_020_1 + 2*oo2p*(v_101_010_0 - v_101_010_1);
+        const double v_101_010_3 = PB[1]*v_101_000_3 - PC1[l]*v_101_000_4;
+        const double v_101_020_2 = PB[1]*v_101_010_2 - PC1[l]*v_101_010_3 + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_101_030_1 = PB[1]*v_101_020_1 - PC1[l]*v_101_020_2 + 2*oo2p*(v_101_010_1 - v_101_010_2);
+        const double v_201_130_0 = PB[0]*v_201_030_0 - PC0[l]*v_201_030_1 + 2*oo2p*(v_101_030_0 - v_101_030_1);
+        const double v_201_011_0 = PB[1]*v_201_001_0 - PC1[l]*v_201_001_1;
+        const double v_201_011_1 = PB[1]*v_201_001_1 - PC1[l]*v_201_001_2;
+        const double v_201_021_0 = PB[1]*v_201_011_0 - PC1[l]*v_201_011_1 + 1*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_201_011_2 = PB[1]*v_201_001_2 - PC1[l]*v_201_001_3;
+        const double v_201_021_1 = PB[1]*v_201_011_1 - PC1[l]*v_201_011_2 + 1*oo2p*(v_201_001_1 - v_201_001_2);
+        const double v_101_011_0 = PB[1]*v_101_001_0 - PC1[l]*v_101_001_1;
+        const double v_101_011_1 = PB[1]*v_101_001_1 - PC1[l]*v_101_001_2;
+        const double v_101_021_0 = PB[1]*v_101_011_0 - PC1[l]*v_101_011_1 + 1*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_101_011_2 = PB[1]*v_101_001_2 - PC1[l]*v_101_001_3;
+        const double v_101_021_1 = PB[1]*v_101_011_1 - PC1[l]*v_101_011_2 + 1*oo2p*(v_101_001_1 - v_101_001_2);
+        const double v_201_121_0 = PB[0]*v_201_021_0 - PC0[l]*v_201_021_1 + 2*oo2p*(v_101_021_0 - v_101_021_1);
+        const double v_201_112_0 = PB[1]*v_201_102_0 - PC1[l]*v_201_102_1;
+        const double v_201_003_0 = PB[2]*v_201_002_0 - PC2[l]*v_201_002_1 + 1*oo2p*(v_200_002_0 - v_200_002_1) + 2*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_201_003_1 = PB[2]*v_201_002_1 - PC2[l]*v_201_002_2 + 1*oo2p*(v_200_002_1 - v_200_002_2) + 2*oo2p*(v_201_001_1 - v_201_001_2);
+        const double v_101_003_0 = PB[2]*v_101_002_0 - PC2[l]*v_101_002_1 + 1*oo2p*(v_100_002_0 - v_100_002_1) + 2*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_101_003_1 = PB[2]*v_101_002_1 - PC2[l]*v_101_002_2 + 1*oo2p*(v_100_002_1 - v_100_002_2) + 2*oo2p*(v_101_001_1 - v_101_001_2);
+        const double v_201_103_0 = PB[0]*v_201_003_0 - PC0[l]*v_201_003_1 + 2*oo2p*(v_101_003_0 - v_101_003_1);
+        const double v_201_040_0 = PB[1]*v_201_030_0 - PC1[l]*v_201_030_1 + 3*oo2p*(v_201_020_0 - v_201_020_1);
+        const double v_201_031_0 = PB[1]*v_201_021_0 - PC1[l]*v_201_021_1 + 2*oo2p*(v_201_011_0 - v_201_011_1);
+        const double v_201_012_0 = PB[1]*v_201_002_0 - PC1[l]*v_201_002_1;
+        const double v_201_012_1 = PB[1]*v_201_002_1 - PC1[l]*v_201_002_2;
+        const double v_201_022_0 = PB[1]*v_201_012_0 - PC1[l]*v_201_012_1 + 1*oo2p*(v_201_002_0 - v_201_002_1);
+        const double v_201_013_0 = PB[1]*v_201_003_0 - PC1[l]*v_201_003_1;
+        const double v_201_004_0 = PB[2]*v_201_003_0 - PC2[l]*v_201_003_1 + 1*oo2p*(v_200_003_0 - v_200_003_1) + 3*oo2p*(v_201_002_0 - v_201_002_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_120_000_1 = PA[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_120_100_0 = PB[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_000_3 = PA[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_120_000_2 = PA[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_120_100_1 = PB[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_100_0 = PB[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_100_1 = PB[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_120_200_0 = PB[0]*v_120_100_0 - PC0[l]*v_120_100_1 + 1*oo2p*(v_020_100_0 - v_020_100_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_020_000_4 = PA[1]*v_010_000_4 - PC1[l]*v_010_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_120_000_3 = PA[0]*v_020_000_3 - PC0[l]*v_020_000_4;
+        const double v_120_100_2 = PB[0]*v_120_000_2 - PC0[l]*v_120_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_020_100_2 = PB[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_120_200_1 = PB[0]*v_120_100_1 - PC0[l]*v_120_100_2 + 1*oo2p*(v_020_100_1 - v_020_100_2) + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_020_200_0 = PB[0]*v_020_100_0 - PC0[l]*v_020_100_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_200_1 = PB[0]*v_020_100_1 - PC0[l]*v_020_100_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_120_300_0 = PB[0]*v_120_200_0 - PC0[l]*v_120_200_1 + 1*oo2p*(v_020_200_0 - v_020_200_1) + 2*oo2p*(v_120_100_0 - v_120_100_1);
+        const double v_010_000_6 = PA[1]*v_000_000_6 - PC1[l]*v_000_000_7;
+        const double v_020_000_5 = PA[1]*v_010_000_5 - PC1[l]*v_010_000_6 + 1*oo2p*(v_000_000_5 - v_000_000_6);
+        const double v_120_000_4 = PA[0]*v_020_000_4 - PC0[l]*v_020_000_5;
+        const double v_120_100_3 = PB[0]*v_120_000_3 - PC0[l]*v_120_000_4 + 1*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_020_100_3 = PB[0]*v_020_000_3 - PC0[l]*v_020_000_4;
+        const double v_120_200_2 = PB[0]*v_120_100_2 - PC0[l]*v_120_100_3 + 1*oo2p*(v_020_100_2 - v_020_100_3) + 1*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_020_200_2 = PB[0]*v_020_100_2 - PC0[l]*v_020_100_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_120_300_1 = PB[0]*v_120_200_1 - PC0[l]*v_120_200_2 + 1*oo2p*(v_020_200_1 - v_020_200_2) + 2*oo2p*(v_120_100_1 - v_120_100_2);
+        const double v_020_300_0 = PB[0]*v_020_200_0 - PC0[l]*v_020_200_1 + 2*oo2p*(v_020_100_0 - v_020_100_1);
+        const double v_020_300_1 = PB[0]*v_020_200_1 - PC0[l]*v_020_200_2 + 2*oo2p*(v_020_100_1 - v_020_100_2);
+        const double v_120_400_0 = PB[0]*v_120_300_0 - PC0[l]*v_120_300_1 + 1*oo2p*(v_020_300_0 - v_020_300_1) + 3*oo2p*(v_120_200_0 - v_120_200_1);
+        const double v_120_310_0 = PB[1]*v_120_300_0 - PC1[l]*v_120_300_1 + 2*oo2p*(v_110_300_0 - v_110_300_1);
+        const double v_120_301_0 = PB[2]*v_120_300_0 - PC2[l]*v_120_300_1;
+        const double v_120_010_0 = PB[1]*v_120_000_0 - PC1[l]*v_120_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_120_010_1 = PB[1]*v_120_000_1 - PC1[l]*v_120_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_120_020_0 = PB[1]*v_120_010_0 - PC1[l]*v_120_010_1 + 2*oo2p*(v_110_010_0 - v_110_010_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_010_2 = PB[1]*v_120_000_2 - PC1[l]*v_120_000_3 + 2*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_120_020_1 = PB[1]*v_120_010_1 - PC1[l]*v_120_010_2 + 2*oo2p*(v_110_010_1 - v_110_010_2) + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_020_010_0 = PB[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_020_010_1 = PB[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_020_020_0 = PB[1]*v_020_010_0 - PC1[l]*v_020_010_1 + 2*oo2p*(v_010_010_0 - v_010_010_1) + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_010_2 = PB[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_020_020_1 = PB[1]*v_020_010_1 - PC1[l]*v_020_010_2 + 2*oo2p*(v_010_010_1 - v_010_010_2) + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_120_120_0 = PB[0]*v_120_020_0 - PC0[l]*v_120_020_1 + 1*oo2p*(v_020_020_0 - v_020_020_1);
+        const double v_120_010_3 = PB[1]*v_120_000_3 - PC1[l]*v_120_000_4 + 2*oo2p*(v_110_000_3 - v_110_000_4);
+        const double v_120_020_2 = PB[1]*v_120_010_2 - PC1[l]*v_120_010_3 + 2*oo2p*(v_110_010_2 - v_110_010_3) + 1*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_020_010_3 = PB[1]*v_020_000_3 - PC1[l]*v_020_000_4 + 2*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_020_020_2 = PB[1]*v_020_010_2 - PC1[l]*v_020_010_3 + 2*oo2p*(v_010_010_2 - v_010_010_3) + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_120_120_1 = PB[0]*v_120_020_1 - PC0[l]*v_120_020_2 + 1*oo2p*(v_020_020_1 - v_020_020_2);
+        const double v_020_120_0 = PB[0]*v_020_020_0 - PC0[l]*v_020_020_1;
+        const double v_020_120_1 = PB[0]*v_020_020_1 - PC0[l]*v_020_020_2;
+        const double v_120_220_0 = PB[0]*v_120_120_0 - PC0[l]*v_120_120_1 + 1*oo2p*(v_020_120_0 - v_020_120_1) + 1*oo2p*(v_120_020_0 - v_120_020_1);
+        const double v_120_210_0 = PB[1]*v_120_200_0 - PC1[l]*v_120_200_1 + 2*oo2p*(v_110_200_0 - v_110_200_1);
+        const double v_120_210_1 = PB[1]*v_120_200_1 - PC1[l]*v_120_200_2 + 2*oo2p*(v_110_200_1 - v_110_200_2);
+        const double v_120_211_0 = PB[2]*v_120_210_0 - PC2[l]*v_120_210_1;
+        const double v_120_201_0 = PB[2]*v_120_200_0 - PC2[l]*v_120_200_1;
+        const double v_120_201_1 = PB[2]*v_120_200_1 - PC2[l]*v_120_200_2;
+        const double v_120_202_0 = PB[2]*v_120_201_0 - PC2[l]*v_120_201_1 + 1*oo2p*(v_120_200_0 - v_120_200_1);
+        const double v_120_030_0 = PB[1]*v_120_020_0 - PC1[l]*v_120_020_1 + 2*oo2p*(v_110_020_0 - v_110_020_1) + 2*oo2p*(v_120_010_0 - v_120_010_1);
+        const double v_120_030_1 = PB[1]*v_120_020_1 - PC1[l]*v_120_020_2 + 2*oo2p*(v_110_020_1 - v_110_020_2) + 2*oo2p*(v_120_010_1 - v_120_010_2);
+        const double v_020_030_0 = PB[1]*v_020_020_0 - PC1[l]*v_020_020_1 + 2*oo2p*(v_010_020_0 - v_010_020_1) + 2*oo2p*(v_020_010_0 - v_020_010_1);
+        const double v_020_030_1 = PB[1]*v_020_020_1 - PC1[l]*v_020_020_2 + 2*oo2p*(v_010_020_1 - v_010_020_2) + 2*oo2p*(v_020_010_1 - v_020_010_2);
+        const double v_120_130_0 = PB[0]*v_120_030_0 - PC0[l]*v_120_030_1 + 1*oo2p*(v_020_030_0 - v_020_030_1);
+        const double v_120_121_0 = PB[2]*v_120_120_0 - PC2[l]*v_120_120_1;
+        const double v_120_001_0 = PB[2]*v_120_000_0 - PC2[l]*v_120_000_1;
+        const double v_120_001_1 = PB[2]*v_120_000_1 - PC2[l]*v_120_000_2;
+        const double v_120_002_0 = PB[2]*v_120_001_0 - PC2[l]*v_120_001_1 + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_001_2 = PB[2]*v_120_000_2 - PC2[l]*v_120_000_3;
+        const double v_120_002_1 = PB[2]*v_120_001_1 - PC2[l]*v_120_001_2 + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_120_012_0 = PB[1]*v_120_002_0 - PC1[l]*v_120_002_1 + 2*oo2p*(v_110_002_0 - v_110_002_1);
+        const double v_120_001_3 = PB[2]*v_120_000_3 - PC2[l]*v_120_000_4;
+        const double v_120_002_2 = PB[2]*v_120_001_2 - PC2[l]*v_120_001_3 + 1*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_120_012_1 = PB[1]*v_120_002_1 - PC1[l]*v_120_002_2 + 2*oo2p*(v_110_002_1 - v_110_002_2);
+        const double v_020_001_0 = PB[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_020_001_1 = PB[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_020_002_0 = PB[2]*v_020_001_0 - PC2[l]*v_020_001_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_001_2 = PB[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_020_002_1 = PB[2]*v_020_001_1 - PC2[l]*v_020_001_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_010_001_1 = PB[2]*v_010_000_1 - PC2[l]*v_010_000_2;
+        const double v_010_002_0 = PB[2]*v_010_001_0 - PC2[l]*v_010_001_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_010_001_2 = PB[2]*v_010_000_2 - PC2[l]*v_010_000_3;
+        const double v_010_002_1 = PB[2]*v_010_001_1 - PC2[l]*v_010_001_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_020_012_0 = PB[1]*v_020_002_0 - PC1[l]*v_020_002_1 + 2*oo2p*(v_010_002_0 - v_010_002_1);
+        const double v_020_001_3 = PB[2]*v_020_000_3 - PC2[l]*v_020_000_4;
+        const double v_020_002_2 = PB[2]*v_020_001_2 - PC2[l]*v_020_001_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_010_001_3 = PB[2]*v_010_000_3 - PC2[l]*v_010_000_4;
+        const double v_010_002_2 = PB[2]*v_010_001_2 - PC2[l]*v_010_001_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_020_012_1 = PB[1]*v_020_002_1 - PC1[l]*v_020_002_2 + 2*oo2p*(v_010_002_1 - v_010_002_2);
+        const double v_120_112_0 = PB[0]*v_120_012_0 - PC0[l]*v_120_012_1 + 1*oo2p*(v_020_012_0 - v_020_012_1);
+        const double v_120_003_0 = PB[2]*v_120_002_0 - PC2[l]*v_120_002_1 + 2*oo2p*(v_120_001_0 - v_120_001_1);
+        const double v_120_003_1 = PB[2]*v_120_002_1 - PC2[l]*v_120_002_2 + 2*oo2p*(v_120_001_1 - v_120_001_2);
+        const double v_020_003_0 = PB[2]*v_020_002_0 - PC2[l]*v_020_002_1 + 2*oo2p*(v_020_001_0 - v_020_001_1);
+        const double v_020_003_1 = PB[2]*v_020_002_1 - PC2[l]*v_020_002_2 + 2*oo2p*(v_020_001_1 - v_020_001_2);
+        const double v_120_103_0 = PB[0]*v_120_003_0 - PC0[l]*v_120_003_1 + 1*oo2p*(v_020_003_0 - v_020_003_1);
+        const double v_120_040_0 = PB[1]*v_120_030_0 - PC1[l]*v_120_030_1 + 2*oo2p*(v_110_030_0 - v_110_030_1) + 3*oo2p*(v_120_020_0 - v_120_020_1);
+        const double v_120_031_0 = PB[2]*v_120_030_0 - PC2[l]*v_120_030_1;
+        const double v_120_021_0 = PB[2]*v_120_020_0 - PC2[l]*v_120_020_1;
+        const double v_120_021_1 = PB[2]*v_120_020_1 - PC2[l]*v_120_020_2;
+        const double v_120_022_0 = PB[2]*v_120_021_0 - PC2[l]*v_120_021_1 + 1*oo2p*(v_120_020_0 - v_120_020_1);
+        const double v_120_013_0 = PB[1]*v_120_003_0 - PC1[l]*v_120_003_1 + 2*oo2p*(v_110_003_0 - v_110_003_1);
+        const double v_120_004_0 = PB[2]*v_120_003_0 - PC2[l]*v_120_003_1 + 3*oo2p*(v_120_002_0 - v_120_002_1);
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_111_000_0 = PA[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_111_000_1 = PA[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_111_100_0 = PB[0]*v_111_000_0 - PC0[l]*v_111_000_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_000_3 = PA[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_111_000_2 = PA[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_111_100_1 = PB[0]*v_111_000_1 - PC0[l]*v_111_000_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_100_0 = PB[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_100_1 = PB[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_111_200_0 = PB[0]*v_111_100_0 - PC0[l]*v_111_100_1 + 1*oo2p*(v_011_100_0 - v_011_100_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_011_000_4 = PA[1]*v_001_000_4 - PC1[l]*v_001_000_5;
+        const double v_111_000_3 = PA[0]*v_011_000_3 - PC0[l]*v_011_000_4;
+        const double v_111_100_2 = PB[0]*v_111_000_2 - PC0[l]*v_111_000_3 + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_011_100_2 = PB[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_111_200_1 = PB[0]*v_111_100_1 - PC0[l]*v_111_100_2 + 1*oo2p*(v_011_100_1 - v_011_100_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_011_200_0 = PB[0]*v_011_100_0 - PC0[l]*v_011_100_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_200_1 = PB[0]*v_011_100_1 - PC0[l]*v_011_100_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_111_300_0 = PB[0]*v_111_200_0 - PC0[l]*v_111_200_1 + 1*oo2p*(v_011_200_0 - v_011_200_1) + 2*oo2p*(v_111_100_0 - v_111_100_1);
+        const double v_001_000_6 = PA[2]*v_000_000_6 - PC2[l]*v_000_000_7;
+        const double v_011_000_5 = PA[1]*v_001_000_5 - PC1[l]*v_001_000_6;
+        const double v_111_000_4 = PA[0]*v_011_000_4 - PC0[l]*v_011_000_5;
+        const double v_111_100_3 = PB[0]*v_111_000_3 - PC0[l]*v_111_000_4 + 1*oo2p*(v_011_000_3 - v_011_000_4);
+        const double v_011_100_3 = PB[0]*v_011_000_3 - PC0[l]*v_011_000_4;
+        const double v_111_200_2 = PB[0]*v_111_100_2 - PC0[l]*v_111_100_3 + 1*oo2p*(v_011_100_2 - v_011_100_3) + 1*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_011_200_2 = PB[0]*v_011_100_2 - PC0[l]*v_011_100_3 + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_111_300_1 = PB[0]*v_111_200_1 - PC0[l]*v_111_200_2 + 1*oo2p*(v_011_200_1 - v_011_200_2) + 2*oo2p*(v_111_100_1 - v_111_100_2);
+        const double v_011_300_0 = PB[0]*v_011_200_0 - PC0[l]*v_011_200_1 + 2*oo2p*(v_011_100_0 - v_011_100_1);
+        const double v_011_300_1 = PB[0]*v_011_200_1 - PC0[l]*v_011_200_2 + 2*oo2p*(v_011_100_1 - v_011_100_2);
+        const double v_111_400_0 = PB[0]*v_111_300_0 - PC0[l]*v_111_300_1 + 1*oo2p*(v_011_300_0 - v_011_300_1) + 3*oo2p*(v_111_200_0 - v_111_200_1);
+        const double v_111_310_0 = PB[1]*v_111_300_0 - PC1[l]*v_111_300_1 + 1*oo2p*(v_101_300_0 - v_101_300_1);
+        const double v_111_301_0 = PB[2]*v_111_300_0 - PC2[l]*v_111_300_1 + 1*oo2p*(v_110_300_0 - v_110_300_1);
+        const double v_111_010_0 = PB[1]*v_111_000_0 - PC1[l]*v_111_000_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_111_010_1 = PB[1]*v_111_000_1 - PC1[l]*v_111_000_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_111_020_0 = PB[1]*v_111_010_0 - PC1[l]*v_111_010_1 + 1*oo2p*(v_101_010_0 - v_101_010_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_111_010_2 = PB[1]*v_111_000_2 - PC1[l]*v_111_000_3 + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_111_020_1 = PB[1]*v_111_010_1 - PC1[l]*v_111_010_2 + 1*oo2p*(v_101_010_1 - v_101_010_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_011_010_0 = PB[1]*v_011_000_0 - PC1[l]*v_011_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_011_010_1 = PB[1]*v_011_000_1 - PC1[l]*v_011_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_010_1 = PB[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_011_020_0 = PB[1]*v_011_010_0 - PC1[l]*v_011_010_1 + 1*oo2p*(v_001_010_0 - v_001_010_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_010_2 = PB[1]*v_011_000_2 - PC1[l]*v_011_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_010_2 = PB[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_011_020_1 = PB[1]*v_011_010_1 - PC1[l]*v_011_010_2 + 1*oo2p*(v_001_010_1 - v_001_010_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_111_120_0 = PB[0]*v_111_020_0 - PC0[l]*v_111_020_1 + 1*oo2p*(v_011_020_0 - v_011_020_1);
+        const double v_111_010_3 = PB[1]*v_111_000_3 - PC1[l]*v_111_000_4 + 1*oo2p*(v_101_000_3 - v_101_000_4);
+        const double v_111_020_2 = PB[1]*v_111_010_2 - PC1[l]*v_111_010_3 + 1*oo2p*(v_101_010_2 - v_101_010_3) + 1*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_011_010_3 = PB[1]*v_011_000_3 - PC1[l]*v_011_000_4 + 1*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_001_010_3 = PB[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_011_020_2 = PB[1]*v_011_010_2 - PC1[l]*v_011_010_3 + 1*oo2p*(v_001_010_2 - v_001_010_3) + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_111_120_1 = PB[0]*v_111_020_1 - PC0[l]*v_111_020_2 + 1*oo2p*(v_011_020_1 - v_011_020_2);
+        const double v_011_120_0 = PB[0]*v_011_020_0 - PC0[l]*v_011_020_1;
+        const double v_011_120_1 = PB[0]*v_011_020_1 - PC0[l]*v_011_020_2;
+        const double v_111_220_0 = PB[0]*v_111_120_0 - PC0[l]*v_111_120_1 + 1*oo2p*(v_011_120_0 - v_011_120_1) + 1*oo2p*(v_111_020_0 - v_111_020_1);
+        const double v_111_201_0 = PB[2]*v_111_200_0 - PC2[l]*v_111_200_1 + 1*oo2p*(v_110_200_0 - v_110_200_1);
+        const double v_111_201_1 = PB[2]*v_111_200_1 - PC2[l]*v_111_200_2 + 1*oo2p*(v_110_200_1 - v_110_200_2);
+        const double v_101_201_0 = PB[2]*v_101_200_0 - PC2[l]*v_101_200_1 + 1*oo2p*(v_100_200_0 - v_100_200_1);
+        const double v_101_201_1 = PB[2]*v_101_200_1 - PC2[l]*v_101_200_2 + 1*oo2p*(v_100_200_1 - v_100_200_2);
+        const double v_111_211_0 = PB[1]*v_111_201_0 - PC1[l]*v_111_201_1 + 1*oo2p*(v_101_201_0 - v_101_201_1);
+        const double v_111_001_0 = PB[2]*v_111_000_0 - PC2[l]*v_111_000_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_111_001_1 = PB[2]*v_111_000_1 - PC2[l]*v_111_000_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_111_002_0 = PB[2]*v_111_001_0 - PC2[l]*v_111_001_1 + 1*oo2p*(v_110_001_0 - v_110_001_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_111_001_2 = PB[2]*v_111_000_2 - PC2[l]*v_111_000_3 + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_111_002_1 = PB[2]*v_111_001_1 - PC2[l]*v_111_001_2 + 1*oo2p*(v_110_001_1 - v_110_001_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_011_001_0 = PB[2]*v_011_000_0 - PC2[l]*v_011_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_011_001_1 = PB[2]*v_011_000_1 - PC2[l]*v_011_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_011_002_0 = PB[2]*v_011_001_0 - PC2[l]*v_011_001_1 + 1*oo2p*(v_010_001_0 - v_010_001_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_001_2 = PB[2]*v_011_000_2 - PC2[l]*v_011_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_011_002_1 = PB[2]*v_011_001_1 - PC2[l]*v_011_001_2 + 1*oo2p*(v_010_001_1 - v_010_001_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_111_102_0 = PB[0]*v_111_002_0 - PC0[l]*v_111_002_1 + 1*oo2p*(v_011_002_0 - v_011_002_1);
+        const double v_111_001_3 = PB[2]*v_111_000_3 - PC2[l]*v_111_000_4 + 1*oo2p*(v_110_000_3 - v_110_000_4);
+        const double v_111_002_2 = PB[2]*v_111_001_2 - PC2[l]*v_111_001_3 + 1*oo2p*(v_110_001_2 - v_110_001_3) + 1*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_011_001_3 = PB[2]*v_011_000_3 - PC2[l]*v_011_000_4 + 1*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_011_002_2 = PB[2]*v_011_001_2 - PC2[l]*v_011_001_3 + 1*oo2p*(v_010_001_2 - v_010_001_3) + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_111_102_1 = PB[0]*v_111_002_1 - PC0[l]*v_111_002_2 + 1*oo2p*(v_011_002_1 - v_011_002_2);
+        const double v_011_102_0 = PB[0]*v_011_002_0 - PC0[l]*v_011_002_1;
+        const double v_011_102_1 = PB[0]*v_011_002_1 - PC0[l]*v_011_002_2;
+        const double v_111_202_0 = PB[0]*v_111_102_0 - PC0[l]*v_111_102_1 + 1*oo2p*(v_011_102_0 - v_011_102_1) + 1*oo2p*(v_111_002_0 - v_111_002_1);
+        const double v_111_030_0 = PB[1]*v_111_020_0 - PC1[l]*v_111_020_1 + 1*oo2p*(v_101_020_0 - v_101_020_1) + 2*oo2p*(v_111_010_0 - v_111_010_1);
+        const double v_111_030_1 = PB[1]*v_111_020_1 - PC1[l]*v_111_020_2 + 1*oo2p*(v_101_020_1 - v_101_020_2) + 2*oo2p*(v_111_010_1 - v_111_010_2);
+        const double v_001_020_0 = PB[1]*v_001_010_0 - PC1[l]*v_001_010_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_001_020_1 = PB[1]*v_001_010_1 - PC1[l]*v_001_010_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_011_030_0 = PB[1]*v_011_020_0 - PC1[l]*v_011_020_1 + 1*oo2p*(v_001_020_0 - v_001_020_1) + 2*oo2p*(v_011_010_0 - v_011_010_1);
+        const double v_001_020_2 = PB[1]*v_001_010_2 - PC1[l]*v_001_010_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_011_030_1 = PB[1]*v_011_020_1 - PC1[l]*v_011_020_2 + 1*oo2p*(v_001_020_1 - v_001_020_2) + 2*oo2p*(v_011_010_1 - v_011_010_2);
+        const double v_111_130_0 = PB[0]*v_111_030_0 - PC0[l]*v_111_030_1 + 1*oo2p*(v_011_030_0 - v_011_030_1);
+        const double v_111_021_0 = PB[2]*v_111_020_0 - PC2[l]*v_111_020_1 + 1*oo2p*(v_110_020_0 - v_110_020_1);
+        const double v_111_021_1 = PB[2]*v_111_020_1 - PC2[l]*v_111_020_2 + 1*oo2p*(v_110_020_1 - v_110_020_2);
+        const double v_011_021_0 = PB[2]*v_011_020_0 - PC2[l]*v_011_020_1 + 1*oo2p*(v_010_020_0 - v_010_020_1);
+        const double v_011_021_1 = PB[2]*v_011_020_1 - PC2[l]*v_011_020_2 + 1*oo2p*(v_010_020_1 - v_010_020_2);
+        const double v_111_121_0 = PB[0]*v_111_021_0 - PC0[l]*v_111_021_1 + 1*oo2p*(v_011_021_0 - v_011_021_1);
+        const double v_111_012_0 = PB[1]*v_111_002_0 - PC1[l]*v_111_002_1 + 1*oo2p*(v_101_002_0 - v_101_002_1);
+        const double v_111_012_1 = PB[1]*v_111_002_1 - PC1[l]*v_111_002_2 + 1*oo2p*(v_101_002_1 - v_101_002_2);
+        const double v_011_012_0 = PB[1]*v_011_002_0 - PC1[l]*v_011_002_1 + 1*oo2p*(v_001_002_0 - v_001_002_1);
+        const double v_011_012_1 = PB[1]*v_011_002_1 - PC1[l]*v_011_002_2 + 1*oo2p*(v_001_002_1 - v_001_002_2);
+        const double v_111_112_0 = PB[0]*v_111_012_0 - PC0[l]*v_111_012_1 + 1*oo2p*(v_011_012_0 - v_011_012_1);
+        const double v_111_003_0 = PB[2]*v_111_002_0 - PC2[l]*v_111_002_1 + 1*oo2p*(v_110_002_0 - v_110_002_1) + 2*oo2p*(v_111_001_0 - v_111_001_1);
+        const double v_111_003_1 = PB[2]*v_111_002_1 - PC2[l]*v_111_002_2 + 1*oo2p*(v_110_002_1 - v_110_002_2) + 2*oo2p*(v_111_001_1 - v_111_001_2);
+        const double v_011_003_0 = PB[2]*v_011_002_0 - PC2[l]*v_011_002_1 + 1*oo2p*(v_010_002_0 - v_010_002_1) + 2*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_011_003_1 = PB[2]*v_011_002_1 - PC2[l]*v_011_002_2 + 1*oo2p*(v_010_002_1 - v_010_002_2) + 2*oo2p*(v_011_001_1 - v_011_001_2);
+        const double v_111_103_0 = PB[0]*v_111_003_0 - PC0[l]*v_111_003_1 + 1*oo2p*(v_011_003_0 - v_011_003_1);
+        const double v_111_040_0 = PB[1]*v_111_030_0 - PC1[l]*v_111_030_1 + 1*oo2p*(v_101_030_0 - v_101_030_1) + 3*oo2p*(v_111_020_0 - v_111_020_1);
+        const double v_111_031_0 = PB[2]*v_111_030_0 - PC2[l]*v_111_030_1 + 1*oo2p*(v_110_030_0 - v_110_030_1);
+        const double v_101_012_0 = PB[1]*v_101_002_0 - PC1[l]*v_101_002_1;
+        const double v_101_012_1 = PB[1]*v_101_002_1 - PC1[l]*v_101_002_2;
+        const double v_111_022_0 = PB[1]*v_111_012_0 - PC1[l]*v_111_012_1 + 1*oo2p*(v_101_012_0 - v_101_012_1) + 1*oo2p*(v_111_002_0 - v_111_002_1);
+        const double v_111_013_0 = PB[1]*v_111_003_0 - PC1[l]*v_111_003_1 + 1*oo2p*(v_101_003_0 - v_101_003_1);
+        const double v_111_004_0 = PB[2]*v_111_003_0 - PC2[l]*v_111_003_1 + 1*oo2p*(v_110_003_0 - v_110_003_1) + 3*oo2p*(v_111_002_0 - v_111_002_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_102_000_1 = PA[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_102_100_0 = PB[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_000_3 = PA[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_102_000_2 = PA[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_102_100_1 = PB[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_100_0 = PB[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_100_1 = PB[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_102_200_0 = PB[0]*v_102_100_0 - PC0[l]*v_102_100_1 + 1*oo2p*(v_002_100_0 - v_002_100_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_002_000_4 = PA[2]*v_001_000_4 - PC2[l]*v_001_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_102_000_3 = PA[0]*v_002_000_3 - PC0[l]*v_002_000_4;
+        const double v_102_100_2 = PB[0]*v_102_000_2 - PC0[l]*v_102_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_002_100_2 = PB[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_102_200_1 = PB[0]*v_102_100_1 - PC0[l]*v_102_100_2 + 1*oo2p*(v_002_100_1 - v_002_100_2) + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_002_200_0 = PB[0]*v_002_100_0 - PC0[l]*v_002_100_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_200_1 = PB[0]*v_002_100_1 - PC0[l]*v_002_100_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_102_300_0 = PB[0]*v_102_200_0 - PC0[l]*v_102_200_1 + 1*oo2p*(v_002_200_0 - v_002_200_1) + 2*oo2p*(v_102_100_0 - v_102_100_1);
+        const double v_002_000_5 = PA[2]*v_001_000_5 - PC2[l]*v_001_000_6 + 1*oo2p*(v_000_000_5 - v_000_000_6);
+        const double v_102_000_4 = PA[0]*v_002_000_4 - PC0[l]*v_002_000_5;
+        const double v_102_100_3 = PB[0]*v_102_000_3 - PC0[l]*v_102_000_4 + 1*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_002_100_3 = PB[0]*v_002_000_3 - PC0[l]*v_002_000_4;
+        const double v_102_200_2 = PB[0]*v_102_100_2 - PC0[l]*v_102_100_3 + 1*oo2p*(v_002_100_2 - v_002_100_3) + 1*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_002_200_2 = PB[0]*v_002_100_2 - PC0[l]*v_002_100_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_102_300_1 = PB[0]*v_102_200_1 - PC0[l]*v_102_200_2 + 1*oo2p*(v_002_200_1 - v_002_200_2) + 2*oo2p*(v_102_100_1 - v_102_100_2);
+        const double v_002_300_0 = PB[0]*v_002_200_0 - PC0[l]*v_002_200_1 + 2*oo2p*(v_002_100_0 - v_002_100_1);
+        const double v_002_300_1 = PB[0]*v_002_200_1 - PC0[l]*v_002_200_2 + 2*oo2p*(v_002_100_1 - v_002_100_2);
+        const double v_102_400_0 = PB[0]*v_102_300_0 - PC0[l]*v_102_300_1 + 1*oo2p*(v_002_300_0 - v_002_300_1) + 3*oo2p*(v_102_200_0 - v_102_200_1);
+        const double v_102_310_0 = PB[1]*v_102_300_0 - PC1[l]*v_102_300_1;
+        const double v_102_301_0 = PB[2]*v_102_300_0 - PC2[l]*v_102_300_1 + 2*oo2p*(v_101_300_0 - v_101_300_1);
+        const double v_102_210_0 = PB[1]*v_102_200_0 - PC1[l]*v_102_200_1;
+        const double v_102_210_1 = PB[1]*v_102_200_1 - PC1[l]*v_102_200_2;
+        const double v_102_220_0 = PB[1]*v_102_210_0 - PC1[l]*v_102_210_1 + 1*oo2p*(v_102_200_0 - v_102_200_1);
+        const double v_102_201_0 = PB[2]*v_102_200_0 - PC2[l]*v_102_200_1 + 2*oo2p*(v_101_200_0 - v_101_200_1);
+        const double v_102_201_1 = PB[2]*v_102_200_1 - PC2[l]*v_102_200_2 + 2*oo2p*(v_101_200_1 - v_101_200_2);
+        const double v_102_211_0 = PB[1]*v_102_201_0 - PC1[l]*v_102_201_1;
+        const double v_102_001_0 = PB[2]*v_102_000_0 - PC2[l]*v_102_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_102_001_1 = PB[2]*v_102_000_1 - PC2[l]*v_102_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_102_002_0 = PB[2]*v_102_001_0 - PC2[l]*v_102_001_1 + 2*oo2p*(v_101_001_0 - v_101_001_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_001_2 = PB[2]*v_102_000_2 - PC2[l]*v_102_000_3 + 2*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_102_002_1 = PB[2]*v_102_001_1 - PC2[l]*v_102_001_2 + 2*oo2p*(v_101_001_1 - v_101_001_2) + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_002_001_0 = PB[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_002_001_1 = PB[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_002_002_0 = PB[2]*v_002_001_0 - PC2[l]*v_002_001_1 + 2*oo2p*(v_001_001_0 - v_001_001_1) + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_001_2 = PB[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_002_002_1 = PB[2]*v_002_001_1 - PC2[l]*v_002_001_2 + 2*oo2p*(v_001_001_1 - v_001_001_2) + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_102_102_0 = PB[0]*v_102_002_0 - PC0[l]*v_102_002_1 + 1*oo2p*(v_002_002_0 - v_002_002_1);
+        const double v_102_001_3 = PB[2]*v_102_000_3 - PC2[l]*v_102_000_4 + 2*oo2p*(v_101_000_3 - v_101_000_4);
+        const double v_102_002_2 = PB[2]*v_102_001_2 - PC2[l]*v_102_001_3 + 2*oo2p*(v_101_001_2 - v_101_001_3) + 1*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_002_001_3 = PB[2]*v_002_000_3 - PC2[l]*v_002_000_4 + 2*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_002_002_2 = PB[2]*v_002_001_2 - PC2[l]*v_002_001_3 + 2*oo2p*(v_001_001_2 - v_001_001_3) + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_102_102_1 = PB[0]*v_102_002_1 - PC0[l]*v_102_002_2 + 1*oo2p*(v_002_002_1 - v_002_002_2);
+        const double v_002_102_0 = PB[0]*v_002_002_0 - PC0[l]*v_002_002_1;
+        const double v_002_102_1 = PB[0]*v_002_002_1 - PC0[l]*v_002_002_2;
+        const double v_102_202_0 = PB[0]*v_102_102_0 - PC0[l]*v_102_102_1 + 1*oo2p*(v_002_102_0 - v_002_102_1) + 1*oo2p*(v_102_002_0 - v_102_002_1);
+        const double v_102_010_0 = PB[1]*v_102_000_0 - PC1[l]*v_102_000_1;
+        const double v_102_010_1 = PB[1]*v_102_000_1 - PC1[l]*v_102_000_2;
+        const double v_102_020_0 = PB[1]*v_102_010_0 - PC1[l]*v_102_010_1 + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_010_2 = PB[1]*v_102_000_2 - PC1[l]*v_102_000_3;
+        const double v_102_020_1 = PB[1]*v_102_010_1 - PC1[l]*v_102_010_2 + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_102_030_0 = PB[1]*v_102_020_0 - PC1[l]*v_102_020_1 + 2*oo2p*(v_102_010_0 - v_102_010_1);
+        const double v_102_010_3 = PB[1]*v_102_000_3 - PC1[l]*v_102_000_4;
+        const double v_102_020_2 = PB[1]*v_102_010_2 - PC1[l]*v_102_010_3 + 1*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_102_030_1 = PB[1]*v_102_020_1 - PC1[l]*v_102_020_2 + 2*oo2p*(v_102_010_1 - v_102_010_2);
+        const double v_002_010_0 = PB[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_002_010_1 = PB[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_002_020_0 = PB[1]*v_002_010_0 - PC1[l]*v_002_010_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_010_2 = PB[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_002_020_1 = PB[1]*v_002_010_1 - PC1[l]*v_002_010_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_030_0 = PB[1]*v_002_020_0 - PC1[l]*v_002_020_1 + 2*oo2p*(v_002_010_0 - v_002_010_1);
+        const double v_002_010_3 = PB[1]*v_002_000_3 - PC1[l]*v_002_000_4;
+        const double v_002_020_2 = PB[1]*v_002_010_2 - PC1[l]*v_002_010_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_002_030_1 = PB[1]*v_002_020_1 - PC1[l]*v_002_020_2 + 2*oo2p*(v_002_010_1 - v_002_010_2);
+        const double v_102_130_0 = PB[0]*v_102_030_0 - PC0[l]*v_102_030_1 + 1*oo2p*(v_002_030_0 - v_002_030_1);
+        const double v_102_011_0 = PB[1]*v_102_001_0 - PC1[l]*v_102_001_1;
+        const double v_102_011_1 = PB[1]*v_102_001_1 - PC1[l]*v_102_001_2;
+        const double v_102_021_0 = PB[1]*v_102_011_0 - PC1[l]*v_102_011_1 + 1*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_102_011_2 = PB[1]*v_102_001_2 - PC1[l]*v_102_001_3;
+        const double v_102_021_1 = PB[1]*v_102_011_1 - PC1[l]*v_102_011_2 + 1*oo2p*(v_102_001_1 - v_102_001_2);
+        const double v_002_011_0 = PB[1]*v_002_001_0 - PC1[l]*v_002_001_1;
+        const double v_002_011_1 = PB[1]*v_002_001_1 - PC1[l]*v_002_001_2;
+        const double v_002_021_0 = PB[1]*v_002_011_0 - PC1[l]*v_002_011_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_002_011_2 = PB[1]*v_002_001_2 - PC1[l]*v_002_001_3;
+        const double v_002_021_1 = PB[1]*v_002_011_1 - PC1[l]*v_002_011_2 + 1*oo2p*(v_002_001_1 - v_002_001_2);
+        const double v_102_121_0 = PB[0]*v_102_021_0 - PC0[l]*v_102_021_1 + 1*oo2p*(v_002_021_0 - v_002_021_1);
+        const double v_102_112_0 = PB[1]*v_102_102_0 - PC1[l]*v_102_102_1;
+        const double v_102_003_0 = PB[2]*v_102_002_0 - PC2[l]*v_102_002_1 + 2*oo2p*(v_101_002_0 - v_101_002_1) + 2*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_102_003_1 = PB[2]*v_102_002_1 - PC2[l]*v_102_002_2 + 2*oo2p*(v_101_002_1 - v_101_002_2) + 2*oo2p*(v_102_001_1 - v_102_001_2);
+        const double v_002_003_0 = PB[2]*v_002_002_0 - PC2[l]*v_002_002_1 + 2*oo2p*(v_001_002_0 - v_001_002_1) + 2*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_002_003_1 = PB[2]*v_002_002_1 - PC2[l]*v_002_002_2 + 2*oo2p*(v_001_002_1 - v_001_002_2) + 2*oo2p*(v_002_001_1 - v_002_001_2);
+        const double v_102_103_0 = PB[0]*v_102_003_0 - PC0[l]*v_102_003_1 + 1*oo2p*(v_002_003_0 - v_002_003_1);
+        const double v_102_040_0 = PB[1]*v_102_030_0 - PC1[l]*v_102_030_1 + 3*oo2p*(v_102_020_0 - v_102_020_1);
+        const double v_102_031_0 = PB[1]*v_102_021_0 - PC1[l]*v_102_021_1 + 2*oo2p*(v_102_011_0 - v_102_011_1);
+        const double v_102_012_0 = PB[1]*v_102_002_0 - PC1[l]*v_102_002_1;
+        const double v_102_012_1 = PB[1]*v_102_002_1 - PC1[l]*v_102_002_2;
+        const double v_102_022_0 = PB[1]*v_102_012_0 - PC1[l]*v_102_012_1 + 1*oo2p*(v_102_002_0 - v_102_002_1);
+        const double v_102_013_0 = PB[1]*v_102_003_0 - PC1[l]*v_102_003_1;
+        const double v_102_004_0 = PB[2]*v_102_003_0 - PC2[l]*v_102_003_1 + 2*oo2p*(v_101_003_0 - v_101_003_1) + 3*oo2p*(v_102_002_0 - v_102_002_1);
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_030_000_1 = PA[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_030_100_0 = PB[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_000_2 = PA[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_030_100_1 = PB[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_030_200_0 = PB[0]*v_030_100_0 - PC0[l]*v_030_100_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_000_3 = PA[1]*v_020_000_3 - PC1[l]*v_020_000_4 + 2*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_030_100_2 = PB[0]*v_030_000_2 - PC0[l]*v_030_000_3;
+        const double v_030_200_1 = PB[0]*v_030_100_1 - PC0[l]*v_030_100_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_030_300_0 = PB[0]*v_030_200_0 - PC0[l]*v_030_200_1 + 2*oo2p*(v_030_100_0 - v_030_100_1);
+        const double v_030_000_4 = PA[1]*v_020_000_4 - PC1[l]*v_020_000_5 + 2*oo2p*(v_010_000_4 - v_010_000_5);
+        const double v_030_100_3 = PB[0]*v_030_000_3 - PC0[l]*v_030_000_4;
+        const double v_030_200_2 = PB[0]*v_030_100_2 - PC0[l]*v_030_100_3 + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_030_300_1 = PB[0]*v_030_200_1 - PC0[l]*v_030_200_2 + 2*oo2p*(v_030_100_1 - v_030_100_2);
+        const double v_030_400_0 = PB[0]*v_030_300_0 - PC0[l]*v_030_300_1 + 3*oo2p*(v_030_200_0 - v_030_200_1);
+        const double v_030_010_0 = PB[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_030_010_1 = PB[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_030_110_0 = PB[0]*v_030_010_0 - PC0[l]*v_030_010_1;
+        const double v_030_010_2 = PB[1]*v_030_000_2 - PC1[l]*v_030_000_3 + 3*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_030_110_1 = PB[0]*v_030_010_1 - PC0[l]*v_030_010_2;
+        const double v_030_210_0 = PB[0]*v_030_110_0 - PC0[l]*v_030_110_1 + 1*oo2p*(v_030_010_0 - v_030_010_1);
+        const double v_030_010_3 = PB[1]*v_030_000_3 - PC1[l]*v_030_000_4 + 3*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_030_110_2 = PB[0]*v_030_010_2 - PC0[l]*v_030_010_3;
+        const double v_030_210_1 = PB[0]*v_030_110_1 - PC0[l]*v_030_110_2 + 1*oo2p*(v_030_010_1 - v_030_010_2);
+        const double v_030_310_0 = PB[0]*v_030_210_0 - PC0[l]*v_030_210_1 + 2*oo2p*(v_030_110_0 - v_030_110_1);
+        const double v_030_301_0 = PB[2]*v_030_300_0 - PC2[l]*v_030_300_1;
+        const double v_030_020_0 = PB[1]*v_030_010_0 - PC1[l]*v_030_010_1 + 3*oo2p*(v_020_010_0 - v_020_010_1) + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_020_1 = PB[1]*v_030_010_1 - PC1[l]*v_030_010_2 + 3*oo2p*(v_020_010_1 - v_020_010_2) + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_030_120_0 = PB[0]*v_030_020_0 - PC0[l]*v_030_020_1;
+        const double v_030_020_2 = PB[1]*v_030_010_2 - PC1[l]*v_030_010_3 + 3*oo2p*(v_020_010_2 - v_020_010_3) + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_030_120_1 = PB[0]*v_030_020_1 - PC0[l]*v_030_020_2;
+        const double v_030_220_0 = PB[0]*v_030_120_0 - PC0[l]*v_030_120_1 + 1*oo2p*(v_030_020_0 - v_030_020_1);
+        const double v_030_211_0 = PB[2]*v_030_210_0 - PC2[l]*v_030_210_1;
+        const double v_030_001_0 = PB[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_030_001_1 = PB[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_030_002_0 = PB[2]*v_030_001_0 - PC2[l]*v_030_001_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_001_2 = PB[2]*v_030_000_2 - PC2[l]*v_030_000_3;
+        const double v_030_002_1 = PB[2]*v_030_001_1 - PC2[l]*v_030_001_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_030_102_0 = PB[0]*v_030_002_0 - PC0[l]*v_030_002_1;
+        const double v_030_001_3 = PB[2]*v_030_000_3 - PC2[l]*v_030_000_4;
+        const double v_030_002_2 = PB[2]*v_030_001_2 - PC2[l]*v_030_001_3 + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_030_102_1 = PB[0]*v_030_002_1 - PC0[l]*v_030_002_2;
+        const double v_030_202_0 = PB[0]*v_030_102_0 - PC0[l]*v_030_102_1 + 1*oo2p*(v_030_002_0 - v_030_002_1);
+        const double v_030_030_0 = PB[1]*v_030_020_0 - PC1[l]*v_030_020_1 + 3*oo2p*(v_020_020_0 - v_020_020_1) + 2*oo2p*(v_030_010_0 - v_030_010_1);
+        const double v_030_030_1 = PB[1]*v_030_020_1 - PC1[l]*v_030_020_2 + 3*oo2p*(v_020_020_1 - v_020_020_2) + 2*oo2p*(v_030_010_1 - v_030_010_2);
+        const double v_030_130_0 = PB[0]*v_030_030_0 - PC0[l]*v_030_030_1;
+        const double v_030_021_0 = PB[2]*v_030_020_0 - PC2[l]*v_030_020_1;
+        const double v_030_021_1 = PB[2]*v_030_020_1 - PC2[l]*v_030_020_2;
+        const double v_030_121_0 = PB[0]*v_030_021_0 - PC0[l]*v_030_021_1;
+        const double v_030_012_0 = PB[1]*v_030_002_0 - PC1[l]*v_030_002_1 + 3*oo2p*(v_020_002_0 - v_020_002_1);
+        const double v_030_012_1 = PB[1]*v_030_002_1 - PC1[l]*v_030_002_2 + 3*oo2p*(v_020_002_1 - v_020_002_2);
+        const double v_030_112_0 = PB[0]*v_030_012_0 - PC0[l]*v_030_012_1;
+        const double v_030_003_0 = PB[2]*v_030_002_0 - PC2[l]*v_030_002_1 + 2*oo2p*(v_030_001_0 - v_030_001_1);
+        const double v_030_003_1 = PB[2]*v_030_002_1 - PC2[l]*v_030_002_2 + 2*oo2p*(v_030_001_1 - v_030_001_2);
+        const double v_030_103_0 = PB[0]*v_030_003_0 - PC0[l]*v_030_003_1;
+        const double v_030_040_0 = PB[1]*v_030_030_0 - PC1[l]*v_030_030_1 + 3*oo2p*(v_020_030_0 - v_020_030_1) + 3*oo2p*(v_030_020_0 - v_030_020_1);
+        const double v_030_031_0 = PB[2]*v_030_030_0 - PC2[l]*v_030_030_1;
+        const double v_030_022_0 = PB[2]*v_030_021_0 - PC2[l]*v_030_021_1 + 1*oo2p*(v_030_020_0 - v_030_020_1);
+        const double v_030_013_0 = PB[1]*v_030_003_0 - PC1[l]*v_030_003_1 + 3*oo2p*(v_020_003_0 - v_020_003_1);
+        const double v_030_004_0 = PB[2]*v_030_003_0 - PC2[l]*v_030_003_1 + 3*oo2p*(v_030_002_0 - v_030_002_1);
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_021_000_1 = PA[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_021_100_0 = PB[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_000_2 = PA[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_021_100_1 = PB[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_021_200_0 = PB[0]*v_021_100_0 - PC0[l]*v_021_100_1 + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_000_3 = PA[2]*v_020_000_3 - PC2[l]*v_020_000_4;
+        const double v_021_100_2 = PB[0]*v_021_000_2 - PC0[l]*v_021_000_3;
+        const double v_021_200_1 = PB[0]*v_021_100_1 - PC0[l]*v_021_100_2 + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_021_300_0 = PB[0]*v_021_200_0 - PC0[l]*v_021_200_1 + 2*oo2p*(v_021_100_0 - v_021_100_1);
+        const double v_021_000_4 = PA[2]*v_020_000_4 - PC2[l]*v_020_000_5;
+        const double v_021_100_3 = PB[0]*v_021_000_3 - PC0[l]*v_021_000_4;
+        const double v_021_200_2 = PB[0]*v_021_100_2 - PC0[l]*v_021_100_3 + 1*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_021_300_1 = PB[0]*v_021_200_1 - PC0[l]*v_021_200_2 + 2*oo2p*(v_021_100_1 - v_021_100_2);
+        const double v_021_400_0 = PB[0]*v_021_300_0 - PC0[l]*v_021_300_1 + 3*oo2p*(v_021_200_0 - v_021_200_1);
+        const double v_021_010_0 = PB[1]*v_021_000_0 - PC1[l]*v_021_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_021_010_1 = PB[1]*v_021_000_1 - PC1[l]*v_021_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_021_110_0 = PB[0]*v_021_010_0 - PC0[l]*v_021_010_1;
+        const double v_021_010_2 = PB[1]*v_021_000_2 - PC1[l]*v_021_000_3 + 2*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_021_110_1 = PB[0]*v_021_010_1 - PC0[l]*v_021_010_2;
+        const double v_021_210_0 = PB[0]*v_021_110_0 - PC0[l]*v_021_110_1 + 1*oo2p*(v_021_010_0 - v_021_010_1);
+        const double v_021_010_3 = PB[1]*v_021_000_3 - PC1[l]*v_021_000_4 + 2*oo2p*(v_011_000_3 - v_011_000_4);
+        const double v_021_110_2 = PB[0]*v_021_010_2 - PC0[l]*v_021_010_3;
+        const double v_021_210_1 = PB[0]*v_021_110_1 - PC0[l]*v_021_110_2 + 1*oo2p*(v_021_010_1 - v_021_010_2);
+        const double v_021_310_0 = PB[0]*v_021_210_0 - PC0[l]*v_021_210_1 + 2*oo2p*(v_021_110_0 - v_021_110_1);
+        const double v_021_001_0 = PB[2]*v_021_000_0 - PC2[l]*v_021_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_021_001_1 = PB[2]*v_021_000_1 - PC2[l]*v_021_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_021_101_0 = PB[0]*v_021_001_0 - PC0[l]*v_021_001_1;
+        const double v_021_001_2 = PB[2]*v_021_000_2 - PC2[l]*v_021_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_021_101_1 = PB[0]*v_021_001_1 - PC0[l]*v_021_001_2;
+        const double v_021_201_0 = PB[0]*v_021_101_0 - PC0[l]*v_021_101_1 + 1*oo2p*(v_021_001_0 - v_021_001_1);
+        const double v_021_001_3 = PB[2]*v_021_000_3 - PC2[l]*v_021_000_4 + 1*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_021_101_2 = PB[0]*v_021_001_2 - PC0[l]*v_021_001_3;
+        const double v_021_201_1 = PB[0]*v_021_101_1 - PC0[l]*v_021_101_2 + 1*oo2p*(v_021_001_1 - v_021_001_2);
+        const double v_021_301_0 = PB[0]*v_021_201_0 - PC0[l]*v_021_201_1 + 2*oo2p*(v_021_101_0 - v_021_101_1);
+        const double v_021_020_0 = PB[1]*v_021_010_0 - PC1[l]*v_021_010_1 + 2*oo2p*(v_011_010_0 - v_011_010_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_020_1 = PB[1]*v_021_010_1 - PC1[l]*v_021_010_2 + 2*oo2p*(v_011_010_1 - v_011_010_2) + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_021_120_0 = PB[0]*v_021_020_0 - PC0[l]*v_021_020_1;
+        const double v_021_020_2 = PB[1]*v_021_010_2 - PC1[l]*v_021_010_3 + 2*oo2p*(v_011_010_2 - v_011_010_3) + 1*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_021_120_1 = PB[0]*v_021_020_1 - PC0[l]*v_021_020_2;
+        const double v_021_220_0 = PB[0]*v_021_120_0 - PC0[l]*v_021_120_1 + 1*oo2p*(v_021_020_0 - v_021_020_1);
+        const double v_021_011_0 = PB[1]*v_021_001_0 - PC1[l]*v_021_001_1 + 2*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_021_011_1 = PB[1]*v_021_001_1 - PC1[l]*v_021_001_2 + 2*oo2p*(v_011_001_1 - v_011_001_2);
+        const double v_021_111_0 = PB[0]*v_021_011_0 - PC0[l]*v_021_011_1;
+        const double v_021_011_2 = PB[1]*v_021_001_2 - PC1[l]*v_021_001_3 + 2*oo2p*(v_011_001_2 - v_011_001_3);
+        const double v_021_111_1 = PB[0]*v_021_011_1 - PC0[l]*v_021_011_2;
+        const double v_021_211_0 = PB[0]*v_021_111_0 - PC0[l]*v_021_111_1 + 1*oo2p*(v_021_011_0 - v_021_011_1);
+        const double v_021_002_0 = PB[2]*v_021_001_0 - PC2[l]*v_021_001_1 + 1*oo2p*(v_020_001_0 - v_020_001_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_002_1 = PB[2]*v_021_001_1 - PC2[l]*v_021_001_2 + 1*oo2p*(v_020_001_1 - v_020_001_2) + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_021_102_0 = PB[0]*v_021_002_0 - PC0[l]*v_021_002_1;
+        const double v_021_002_2 = PB[2]*v_021_001_2 - PC2[l]*v_021_001_3 + 1*oo2p*(v_020_001_2 - v_020_001_3) + 1*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_021_102_1 = PB[0]*v_021_002_1 - PC0[l]*v_021_002_2;
+        const double v_021_202_0 = PB[0]*v_021_102_0 - PC0[l]*v_021_102_1 + 1*oo2p*(v_021_002_0 - v_021_002_1);
+        const double v_021_030_0 = PB[1]*v_021_020_0 - PC1[l]*v_021_020_1 + 2*oo2p*(v_011_020_0 - v_011_020_1) + 2*oo2p*(v_021_010_0 - v_021_010_1);
+        const double v_021_030_1 = PB[1]*v_021_020_1 - PC1[l]*v_021_020_2 + 2*oo2p*(v_011_020_1 - v_011_020_2) + 2*oo2p*(v_021_010_1 - v_021_010_2);
+        const double v_021_130_0 = PB[0]*v_021_030_0 - PC0[l]*v_021_030_1;
+        const double v_021_021_0 = PB[2]*v_021_020_0 - PC2[l]*v_021_020_1 + 1*oo2p*(v_020_020_0 - v_020_020_1);
+        const double v_021_021_1 = PB[2]*v_021_020_1 - PC2[l]*v_021_020_2 + 1*oo2p*(v_020_020_1 - v_020_020_2);
+        const double v_021_121_0 = PB[0]*v_021_021_0 - PC0[l]*v_021_021_1;
+        const double v_021_012_0 = PB[1]*v_021_002_0 - PC1[l]*v_021_002_1 + 2*oo2p*(v_011_002_0 - v_011_002_1);
+        const double v_021_012_1 = PB[1]*v_021_002_1 - PC1[l]*v_021_002_2 + 2*oo2p*(v_011_002_1 - v_011_002_2);
+        const double v_021_112_0 = PB[0]*v_021_012_0 - PC0[l]*v_021_012_1;
+        const double v_021_003_0 = PB[2]*v_021_002_0 - PC2[l]*v_021_002_1 + 1*oo2p*(v_020_002_0 - v_020_002_1) + 2*oo2p*(v_021_001_0 - v_021_001_1);
+        const double v_021_003_1 = PB[2]*v_021_002_1 - PC2[l]*v_021_002_2 + 1*oo2p*(v_020_002_1 - v_020_002_2) + 2*oo2p*(v_021_001_1 - v_021_001_2);
+        const double v_021_103_0 = PB[0]*v_021_003_0 - PC0[l]*v_021_003_1;
+        const double v_021_040_0 = PB[1]*v_021_030_0 - PC1[l]*v_021_030_1 + 2*oo2p*(v_011_030_0 - v_011_030_1) + 3*oo2p*(v_021_020_0 - v_021_020_1);
+        const double v_021_031_0 = PB[2]*v_021_030_0 - PC2[l]*v_021_030_1 + 1*oo2p*(v_020_030_0 - v_020_030_1);
+        const double v_021_022_0 = PB[1]*v_021_012_0 - PC1[l]*v_021_012_1 + 2*oo2p*(v_011_012_0 - v_011_012_1) + 1*oo2p*(v_021_002_0 - v_021_002_1);
+        const double v_021_013_0 = PB[1]*v_021_003_0 - PC1[l]*v_021_003_1 + 2*oo2p*(v_011_003_0 - v_011_003_1);
+        const double v_021_004_0 = PB[2]*v_021_003_0 - PC2[l]*v_021_003_1 + 1*oo2p*(v_020_003_0 - v_020_003_1) + 3*oo2p*(v_021_002_0 - v_021_002_1);
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_012_000_1 = PA[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_012_100_0 = PB[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_000_2 = PA[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_012_100_1 = PB[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_012_200_0 = PB[0]*v_012_100_0 - PC0[l]*v_012_100_1 + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_000_3 = PA[1]*v_002_000_3 - PC1[l]*v_002_000_4;
+        const double v_012_100_2 = PB[0]*v_012_000_2 - PC0[l]*v_012_000_3;
+        const double v_012_200_1 = PB[0]*v_012_100_1 - PC0[l]*v_012_100_2 + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_012_300_0 = PB[0]*v_012_200_0 - PC0[l]*v_012_200_1 + 2*oo2p*(v_012_100_0 - v_012_100_1);
+        const double v_012_000_4 = PA[1]*v_002_000_4 - PC1[l]*v_002_000_5;
+        const double v_012_100_3 = PB[0]*v_012_000_3 - PC0[l]*v_012_000_4;
+        const double v_012_200_2 = PB[0]*v_012_100_2 - PC0[l]*v_012_100_3 + 1*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_012_300_1 = PB[0]*v_012_200_1 - PC0[l]*v_012_200_2 + 2*oo2p*(v_012_100_1 - v_012_100_2);
+        const double v_012_400_0 = PB[0]*v_012_300_0 - PC0[l]*v_012_300_1 + 3*oo2p*(v_012_200_0 - v_012_200_1);
+        const double v_012_010_0 = PB[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_012_010_1 = PB[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_012_110_0 = PB[0]*v_012_010_0 - PC0[l]*v_012_010_1;
+        const double v_012_010_2 = PB[1]*v_012_000_2 - PC1[l]*v_012_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_012_110_1 = PB[0]*v_012_010_1 - PC0[l]*v_012_010_2;
+        const double v_012_210_0 = PB[0]*v_012_110_0 - PC0[l]*v_012_110_1 + 1*oo2p*(v_012_010_0 - v_012_010_1);
+        const double v_012_010_3 = PB[1]*v_012_000_3 - PC1[l]*v_012_000_4 + 1*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_012_110_2 = PB[0]*v_012_010_2 - PC0[l]*v_012_010_3;
+        const double v_012_210_1 = PB[0]*v_012_110_1 - PC0[l]*v_012_110_2 + 1*oo2p*(v_012_010_1 - v_012_010_2);
+        const double v_012_310_0 = PB[0]*v_012_210_0 - PC0[l]*v_012_210_1 + 2*oo2p*(v_012_110_0 - v_012_110_1);
+        const double v_012_001_0 = PB[2]*v_012_000_0 - PC2[l]*v_012_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_012_001_1 = PB[2]*v_012_000_1 - PC2[l]*v_012_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_012_101_0 = PB[0]*v_012_001_0 - PC0[l]*v_012_001_1;
+        const double v_012_001_2 = PB[2]*v_012_000_2 - PC2[l]*v_012_000_3 + 2*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_012_101_1 = PB[0]*v_012_001_1 - PC0[l]*v_012_001_2;
+        const double v_012_201_0 = PB[0]*v_012_101_0 - PC0[l]*v_012_101_1 + 1*oo2p*(v_012_001_0 - v_012_001_1);
+        const double v_012_001_3 = PB[2]*v_012_000_3 - PC2[l]*v_012_000_4 + 2*oo2p*(v_011_000_3 - v_011_000_4);
+        const double v_012_101_2 = PB[0]*v_012_001_2 - PC0[l]*v_012_001_3;
+        const double v_012_201_1 = PB[0]*v_012_101_1 - PC0[l]*v_012_101_2 + 1*oo2p*(v_012_001_1 - v_012_001_2);
+        const double v_012_301_0 = PB[0]*v_012_201_0 - PC0[l]*v_012_201_1 + 2*oo2p*(v_012_101_0 - v_012_101_1);
+        const double v_012_020_0 = PB[1]*v_012_010_0 - PC1[l]*v_012_010_1 + 1*oo2p*(v_002_010_0 - v_002_010_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_020_1 = PB[1]*v_012_010_1 - PC1[l]*v_012_010_2 + 1*oo2p*(v_002_010_1 - v_002_010_2) + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_012_120_0 = PB[0]*v_012_020_0 - PC0[l]*v_012_020_1;
+        const double v_012_020_2 = PB[1]*v_012_010_2 - PC1[l]*v_012_010_3 + 1*oo2p*(v_002_010_2 - v_002_010_3) + 1*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_012_120_1 = PB[0]*v_012_020_1 - PC0[l]*v_012_020_2;
+        const double v_012_220_0 = PB[0]*v_012_120_0 - PC0[l]*v_012_120_1 + 1*oo2p*(v_012_020_0 - v_012_020_1);
+        const double v_012_011_0 = PB[1]*v_012_001_0 - PC1[l]*v_012_001_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_012_011_1 = PB[1]*v_012_001_1 - PC1[l]*v_012_001_2 + 1*oo2p*(v_002_001_1 - v_002_001_2);
+        const double v_012_111_0 = PB[0]*v_012_011_0 - PC0[l]*v_012_011_1;
+        const double v_012_011_2 = PB[1]*v_012_001_2 - PC1[l]*v_012_001_3 + 1*oo2p*(v_002_001_2 - v_002_001_3);
+        const double v_012_111_1 = PB[0]*v_012_011_1 - PC0[l]*v_012_011_2;
+        const double v_012_211_0 = PB[0]*v_012_111_0 - PC0[l]*v_012_111_1 + 1*oo2p*(v_012_011_0 - v_012_011_1);
+        const double v_012_002_0 = PB[2]*v_012_001_0 - PC2[l]*v_012_001_1 + 2*oo2p*(v_011_001_0 - v_011_001_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_002_1 = PB[2]*v_012_001_1 - PC2[l]*v_012_001_2 + 2*oo2p*(v_011_001_1 - v_011_001_2) + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_012_102_0 = PB[0]*v_012_002_0 - PC0[l]*v_012_002_1;
+        const double v_012_002_2 = PB[2]*v_012_001_2 - PC2[l]*v_012_001_3 + 2*oo2p*(v_011_001_2 - v_011_001_3) + 1*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_012_102_1 = PB[0]*v_012_002_1 - PC0[l]*v_012_002_2;
+        const double v_012_202_0 = PB[0]*v_012_102_0 - PC0[l]*v_012_102_1 + 1*oo2p*(v_012_002_0 - v_012_002_1);
+        const double v_012_030_0 = PB[1]*v_012_020_0 - PC1[l]*v_012_020_1 + 1*oo2p*(v_002_020_0 - v_002_020_1) + 2*oo2p*(v_012_010_0 - v_012_010_1);
+        const double v_012_030_1 = PB[1]*v_012_020_1 - PC1[l]*v_012_020_2 + 1*oo2p*(v_002_020_1 - v_002_020_2) + 2*oo2p*(v_012_010_1 - v_012_010_2);
+        const double v_012_130_0 = PB[0]*v_012_030_0 - PC0[l]*v_012_030_1;
+        const double v_012_021_0 = PB[2]*v_012_020_0 - PC2[l]*v_012_020_1 + 2*oo2p*(v_011_020_0 - v_011_020_1);
+        const double v_012_021_1 = PB[2]*v_012_020_1 - PC2[l]*v_012_020_2 + 2*oo2p*(v_011_020_1 - v_011_020_2);
+        const double v_012_121_0 = PB[0]*v_012_021_0 - PC0[l]*v_012_021_1;
+        const double v_012_012_0 = PB[1]*v_012_002_0 - PC1[l]*v_012_002_1 + 1*oo2p*(v_002_002_0 - v_002_002_1);
+        const double v_012_012_1 = PB[1]*v_012_002_1 - PC1[l]*v_012_002_2 + 1*oo2p*(v_002_002_1 - v_002_002_2);
+        const double v_012_112_0 = PB[0]*v_012_012_0 - PC0[l]*v_012_012_1;
+        const double v_012_003_0 = PB[2]*v_012_002_0 - PC2[l]*v_012_002_1 + 2*oo2p*(v_011_002_0 - v_011_002_1) + 2*oo2p*(v_012_001_0 - v_012_001_1);
+        const double v_012_003_1 = PB[2]*v_012_002_1 - PC2[l]*v_012_002_2 + 2*oo2p*(v_011_002_1 - v_011_002_2) + 2*oo2p*(v_012_001_1 - v_012_001_2);
+        const double v_012_103_0 = PB[0]*v_012_003_0 - PC0[l]*v_012_003_1;
+        const double v_012_040_0 = PB[1]*v_012_030_0 - PC1[l]*v_012_030_1 + 1*oo2p*(v_002_030_0 - v_002_030_1) + 3*oo2p*(v_012_020_0 - v_012_020_1);
+        const double v_012_031_0 = PB[2]*v_012_030_0 - PC2[l]*v_012_030_1 + 2*oo2p*(v_011_030_0 - v_011_030_1);
+        const double v_002_012_0 = PB[1]*v_002_002_0 - PC1[l]*v_002_002_1;
+        const double v_002_012_1 = PB[1]*v_002_002_1 - PC1[l]*v_002_002_2;
+        const double v_012_022_0 = PB[1]*v_012_012_0 - PC1[l]*v_012_012_1 + 1*oo2p*(v_002_012_0 - v_002_012_1) + 1*oo2p*(v_012_002_0 - v_012_002_1);
+        const double v_012_013_0 = PB[1]*v_012_003_0 - PC1[l]*v_012_003_1 + 1*oo2p*(v_002_003_0 - v_002_003_1);
+        const double v_012_004_0 = PB[2]*v_012_003_0 - PC2[l]*v_012_003_1 + 2*oo2p*(v_011_003_0 - v_011_003_1) + 3*oo2p*(v_012_002_0 - v_012_002_1);
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_003_000_1 = PA[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_003_100_0 = PB[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_000_2 = PA[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_003_100_1 = PB[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_003_200_0 = PB[0]*v_003_100_0 - PC0[l]*v_003_100_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_000_3 = PA[2]*v_002_000_3 - PC2[l]*v_002_000_4 + 2*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_003_100_2 = PB[0]*v_003_000_2 - PC0[l]*v_003_000_3;
+        const double v_003_200_1 = PB[0]*v_003_100_1 - PC0[l]*v_003_100_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_300_0 = PB[0]*v_003_200_0 - PC0[l]*v_003_200_1 + 2*oo2p*(v_003_100_0 - v_003_100_1);
+        const double v_003_000_4 = PA[2]*v_002_000_4 - PC2[l]*v_002_000_5 + 2*oo2p*(v_001_000_4 - v_001_000_5);
+        const double v_003_100_3 = PB[0]*v_003_000_3 - PC0[l]*v_003_000_4;
+        const double v_003_200_2 = PB[0]*v_003_100_2 - PC0[l]*v_003_100_3 + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_003_300_1 = PB[0]*v_003_200_1 - PC0[l]*v_003_200_2 + 2*oo2p*(v_003_100_1 - v_003_100_2);
+        const double v_003_400_0 = PB[0]*v_003_300_0 - PC0[l]*v_003_300_1 + 3*oo2p*(v_003_200_0 - v_003_200_1);
+        const double v_003_310_0 = PB[1]*v_003_300_0 - PC1[l]*v_003_300_1;
+        const double v_003_001_0 = PB[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_003_001_1 = PB[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_003_101_0 = PB[0]*v_003_001_0 - PC0[l]*v_003_001_1;
+        const double v_003_001_2 = PB[2]*v_003_000_2 - PC2[l]*v_003_000_3 + 3*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_003_101_1 = PB[0]*v_003_001_1 - PC0[l]*v_003_001_2;
+        const double v_003_201_0 = PB[0]*v_003_101_0 - PC0[l]*v_003_101_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_003_001_3 = PB[2]*v_003_000_3 - PC2[l]*v_003_000_4 + 3*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_003_101_2 = PB[0]*v_003_001_2 - PC0[l]*v_003_001_3;
+        const double v_003_201_1 = PB[0]*v_003_101_1 - PC0[l]*v_003_101_2 + 1*oo2p*(v_003_001_1 - v_003_001_2);
+        const double v_003_301_0 = PB[0]*v_003_201_0 - PC0[l]*v_003_201_1 + 2*oo2p*(v_003_101_0 - v_003_101_1);
+        const double v_003_010_0 = PB[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_003_010_1 = PB[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_003_020_0 = PB[1]*v_003_010_0 - PC1[l]*v_003_010_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_010_2 = PB[1]*v_003_000_2 - PC1[l]*v_003_000_3;
+        const double v_003_020_1 = PB[1]*v_003_010_1 - PC1[l]*v_003_010_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_120_0 = PB[0]*v_003_020_0 - PC0[l]*v_003_020_1;
+        const double v_003_010_3 = PB[1]*v_003_000_3 - PC1[l]*v_003_000_4;
+        const double v_003_020_2 = PB[1]*v_003_010_2 - PC1[l]*v_003_010_3 + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_003_120_1 = PB[0]*v_003_020_1 - PC0[l]*v_003_020_2;
+        const double v_003_220_0 = PB[0]*v_003_120_0 - PC0[l]*v_003_120_1 + 1*oo2p*(v_003_020_0 - v_003_020_1);
+        const double v_003_211_0 = PB[1]*v_003_201_0 - PC1[l]*v_003_201_1;
+        const double v_003_002_0 = PB[2]*v_003_001_0 - PC2[l]*v_003_001_1 + 3*oo2p*(v_002_001_0 - v_002_001_1) + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_002_1 = PB[2]*v_003_001_1 - PC2[l]*v_003_001_2 + 3*oo2p*(v_002_001_1 - v_002_001_2) + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_102_0 = PB[0]*v_003_002_0 - PC0[l]*v_003_002_1;
+        const double v_003_002_2 = PB[2]*v_003_001_2 - PC2[l]*v_003_001_3 + 3*oo2p*(v_002_001_2 - v_002_001_3) + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_003_102_1 = PB[0]*v_003_002_1 - PC0[l]*v_003_002_2;
+        const double v_003_202_0 = PB[0]*v_003_102_0 - PC0[l]*v_003_102_1 + 1*oo2p*(v_003_002_0 - v_003_002_1);
+        const double v_003_030_0 = PB[1]*v_003_020_0 - PC1[l]*v_003_020_1 + 2*oo2p*(v_003_010_0 - v_003_010_1);
+        const double v_003_030_1 = PB[1]*v_003_020_1 - PC1[l]*v_003_020_2 + 2*oo2p*(v_003_010_1 - v_003_010_2);
+        const double v_003_130_0 = PB[0]*v_003_030_0 - PC0[l]*v_003_030_1;
+        const double v_003_011_0 = PB[1]*v_003_001_0 - PC1[l]*v_003_001_1;
+        const double v_003_011_1 = PB[1]*v_003_001_1 - PC1[l]*v_003_001_2;
+        const double v_003_021_0 = PB[1]*v_003_011_0 - PC1[l]*v_003_011_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_003_011_2 = PB[1]*v_003_001_2 - PC1[l]*v_003_001_3;
+        const double v_003_021_1 = PB[1]*v_003_011_1 - PC1[l]*v_003_011_2 + 1*oo2p*(v_003_001_1 - v_003_001_2);
+        const double v_003_121_0 = PB[0]*v_003_021_0 - PC0[l]*v_003_021_1;
+        const double v_003_012_0 = PB[1]*v_003_002_0 - PC1[l]*v_003_002_1;
+        const double v_003_012_1 = PB[1]*v_003_002_1 - PC1[l]*v_003_002_2;
+        const double v_003_112_0 = PB[0]*v_003_012_0 - PC0[l]*v_003_012_1;
+        const double v_003_003_0 = PB[2]*v_003_002_0 - PC2[l]*v_003_002_1 + 3*oo2p*(v_002_002_0 - v_002_002_1) + 2*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_003_003_1 = PB[2]*v_003_002_1 - PC2[l]*v_003_002_2 + 3*oo2p*(v_002_002_1 - v_002_002_2) + 2*oo2p*(v_003_001_1 - v_003_001_2);
+        const double v_003_103_0 = PB[0]*v_003_003_0 - PC0[l]*v_003_003_1;
+        const double v_003_040_0 = PB[1]*v_003_030_0 - PC1[l]*v_003_030_1 + 3*oo2p*(v_003_020_0 - v_003_020_1);
+        const double v_003_031_0 = PB[1]*v_003_021_0 - PC1[l]*v_003_021_1 + 2*oo2p*(v_003_011_0 - v_003_011_1);
+        const double v_003_022_0 = PB[1]*v_003_012_0 - PC1[l]*v_003_012_1 + 1*oo2p*(v_003_002_0 - v_003_002_1);
+        const double v_003_013_0 = PB[1]*v_003_003_0 - PC1[l]*v_003_003_1;
+        const double v_003_004_0 = PB[2]*v_003_003_0 - PC2[l]*v_003_003_1 + 3*oo2p*(v_002_003_0 - v_002_003_1) + 3*oo2p*(v_003_002_0 - v_003_002_1);
+
+        sum_0 += q[l]*v_300_400_0;
+        sum_1 += q[l]*v_300_310_0;
+        sum_2 += q[l]*v_300_301_0;
+        sum_3 += q[l]*v_300_220_0;
+        sum_4 += q[l]*v_300_211_0;
+        sum_5 += q[l]*v_300_202_0;
+        sum_6 += q[l]*v_300_130_0;
+        sum_7 += q[l]*v_300_121_0;
+        sum_8 += q[l]*v_300_112_0;
+        sum_9 += q[l]*v_300_103_0;
+        sum_10 += q[l]*v_300_040_0;
+        sum_11 += q[l]*v_300_031_0;
+        sum_12 += q[l]*v_300_022_0;
+        sum_13 += q[l]*v_300_013_0;
+        sum_14 += q[l]*v_300_004_0;
+        sum_15 += q[l]*v_210_400_0;
+        sum_16 += q[l]*v_210_310_0;
+        sum_17 += q[l]*v_210_301_0;
+        sum_18 += q[l]*v_210_220_0;
+        sum_19 += q[l]*v_210_211_0;
+        sum_20 += q[l]*v_210_202_0;
+        sum_21 += q[l]*v_210_130_0;
+        sum_22 += q[l]*v_210_121_0;
+        sum_23 += q[l]*v_210_112_0;
+        sum_24 += q[l]*v_210_103_0;
+        sum_25 += q[l]*v_210_040_0;
+        sum_26 += q[l]*v_210_031_0;
+        sum_27 += q[l]*v_210_022_0;
+        sum_28 += q[l]*v_210_013_0;
+        sum_29 += q[l]*v_210_004_0;
+        sum_30 += q[l]*v_201_400_0;
+        sum_31 += q[l]*v_201_310_0;
+        sum_32 += q[l]*v_201_301_0;
+        sum_33 += q[l]*v_201_220_0;
+        sum_34 += q[l]*v_201_211_0;
+        sum_35 += q[l]*v_201_202_0;
+        sum_36 += q[l]*v_201_130_0;
+        sum_37 += q[l]*v_201_121_0;
+        sum_38 += q[l]*v_201_112_0;
+        sum_39 += q[l]*v_201_103_0;
+        sum_40 += q[l]*v_201_040_0;
+        sum_41 += q[l]*v_201_031_0;
+        sum_42 += q[l]*v_201_022_0;
+        sum_43 += q[l]*v_201_013_0;
+        sum_44 += q[l]*v_201_004_0;
+        sum_45 += q[l]*v_120_400_0;
+        sum_46 += q[l]*v_120_310_0;
+        sum_47 += q[l]*v_120_301_0;
+        sum_48 += q[l]*v_120_220_0;
+        sum_49 += q[l]*v_120_211_0;
+        sum_50 += q[l]*v_120_202_0;
+        sum_51 += q[l]*v_120_130_0;
+        sum_52 += q[l]*v_120_121_0;
+        sum_53 += q[l]*v_120_112_0;
+        sum_54 += q[l]*v_120_103_0;
+        sum_55 += q[l]*v_120_040_0;
+        sum_56 += q[l]*v_120_031_0;
+        sum_57 += q[l]*v_120_022_0;
+        sum_58 += q[l]*v_120_013_0;
+        sum_59 += q[l]*v_120_004_0;
+        sum_60 += q[l]*v_111_400_0;
+        sum_61 += q[l]*v_111_310_0;
+        sum_62 += q[l]*v_111_301_0;
+        sum_63 += q[l]*v_111_220_0;
+        sum_64 += q[l]*v_111_211_0;
+        sum_65 += q[l]*v_111_202_0;
+        sum_66 += q[l]*v_111_130_0;
+        sum_67 += q[l]*v_111_121_0;
+        sum_68 += q[l]*v_111_112_0;
+        sum_69 += q[l]*v_111_103_0;
+        sum_70 += q[l]*v_111_040_0;
+        sum_71 += q[l]*v_111_031_0;
+        sum_72 += q[l]*v_111_022_0;
+        sum_73 += q[l]*v_111_013_0;
+        sum_74 += q[l]*v_111_004_0;
+        sum_75 += q[l]*v_102_400_0;
+        sum_76 += q[l]*v_102_310_0;
+        sum_77 += q[l]*v_102_301_0;
+        sum_78 += q[l]*v_102_220_0;
+        sum_79 += q[l]*v_102_211_0;
+        sum_80 += q[l]*v_102_202_0;
+        sum_81 += q[l]*v_102_130_0;
+        sum_82 += q[l]*v_102_121_0;
+        sum_83 += q[l]*v_102_112_0;
+        sum_84 += q[l]*v_102_103_0;
+        sum_85 += q[l]*v_102_040_0;
+        sum_86 += q[l]*v_102_031_0;
+        sum_87 += q[l]*v_102_022_0;
+        sum_88 += q[l]*v_102_013_0;
+        sum_89 += q[l]*v_102_004_0;
+        sum_90 += q[l]*v_030_400_0;
+        sum_91 += q[l]*v_030_310_0;
+        sum_92 += q[l]*v_030_301_0;
+        sum_93 += q[l]*v_030_220_0;
+        sum_94 += q[l]*v_030_211_0;
+        sum_95 += q[l]*v_030_202_0;
+        sum_96 += q[l]*v_030_130_0;
+        sum_97 += q[l]*v_030_121_0;
+        sum_98 += q[l]*v_030_112_0;
+        sum_99 += q[l]*v_030_103_0;
+        sum_100 += q[l]*v_030_040_0;
+        sum_101 += q[l]*v_030_031_0;
+        sum_102 += q[l]*v_030_022_0;
+        sum_103 += q[l]*v_030_013_0;
+        sum_104 += q[l]*v_030_004_0;
+        sum_105 += q[l]*v_021_400_0;
+        sum_106 += q[l]*v_021_310_0;
+        sum_107 += q[l]*v_021_301_0;
+        sum_108 += q[l]*v_021_220_0;
+        sum_109 += q[l]*v_021_211_0;
+        sum_110 += q[l]*v_021_202_0;
+        sum_111 += q[l]*v_021_130_0;
+        sum_112 += q[l]*v_021_121_0;
+        sum_113 += q[l]*v_021_112_0;
+        sum_114 += q[l]*v_021_103_0;
+        sum_115 += q[l]*v_021_040_0;
+        sum_116 += q[l]*v_021_031_0;
+        sum_117 += q[l]*v_021_022_0;
+        sum_118 += q[l]*v_021_013_0;
+        sum_119 += q[l]*v_021_004_0;
+        sum_120 += q[l]*v_012_400_0;
+        sum_121 += q[l]*v_012_310_0;
+        sum_122 += q[l]*v_012_301_0;
+        sum_123 += q[l]*v_012_220_0;
+        sum_124 += q[l]*v_012_211_0;
+        sum_125 += q[l]*v_012_202_0;
+        sum_126 += q[l]*v_012_130_0;
+        sum_127 += q[l]*v_012_121_0;
+        sum_128 += q[l]*v_012_112_0;
+        sum_129 += q[l]*v_012_103_0;
+        sum_130 += q[l]*v_012_040_0;
+        sum_131 += q[l]*v_012_031_0;
+        sum_132 += q[l]*v_012_022_0;
+        sum_133 += q[l]*v_012_013_0;
+        sum_134 += q[l]*v_012_004_0;
+        sum_135 += q[l]*v_003_400_0;
+        sum_136 += q[l]*v_003_310_0;
+        sum_137 += q[l]*v_003_301_0;
+        sum_138 += q[l]*v_003_220_0;
+        sum_139 += q[l]*v_003_211_0;
+        sum_140 += q[l]*v_003_202_0;
+        sum_141 += q[l]*v_003_130_0;
+        sum_142 += q[l]*v_003_121_0;
+        sum_143 += q[l]*v_003_112_0;
+        sum_144 += q[l]*v_003_103_0;
+        sum_145 += q[l]*v_003_040_0;
+        sum_146 += q[l]*v_003_031_0;
+        sum_147 += q[l]*v_003_022_0;
+        sum_148 += q[l]*v_003_013_0;
+        sum_149 += q[l]*v_003_004_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+    acc[45] += sum_45;
+    acc[46] += sum_46;
+    acc[47] += sum_47;
+    acc[48] += sum_48;
+    acc[49] += sum_49;
+    acc[50] += sum_50;
+    acc[51] += sum_51;
+    acc[52] += sum_52;
+    acc[53] += sum_53;
+    acc[54] += sum_54;
+    acc[55] += sum_55;
+    acc[56] += sum_56;
+    acc[57] += sum_57;
+    acc[58] += sum_58;
+    acc[59] += sum_59;
+    acc[60] += sum_60;
+    acc[61] += sum_61;
+    acc[62] += sum_62;
+    acc[63] += sum_63;
+    acc[64] += sum_64;
+    acc[65] += sum_65;
+    acc[66] += sum_66;
+    acc[67] += sum_67;
+    acc[68] += sum_68;
+    acc[69] += sum_69;
+    acc[70] += sum_70;
+    acc[71] += sum_71;
+    acc[72] += sum_72;
+    acc[73] += sum_73;
+    acc[74] += sum_74;
+    acc[75] += sum_75;
+    acc[76] += sum_76;
+    acc[77] += sum_77;
+    acc[78] += sum_78;
+    acc[79] += sum_79;
+    acc[80] += sum_80;
+    acc[81] += sum_81;
+    acc[82] += sum_82;
+    acc[83] += sum_83;
+    acc[84] += sum_84;
+    acc[85] += sum_85;
+    acc[86] += sum_86;
+    acc[87] += sum_87;
+    acc[88] += sum_88;
+    acc[89] += sum_89;
+    acc[90] += sum_90;
+    acc[91] += sum_91;
+    acc[92] += sum_92;
+    acc[93] += sum_93;
+    acc[94] += sum_94;
+    acc[95] += sum_95;
+    acc[96] += sum_96;
+    acc[97] += sum_97;
+    acc[98] += sum_98;
+    acc[99] += sum_99;
+    acc[100] += sum_100;
+    acc[101] += sum_101;
+    acc[102] += sum_102;
+    acc[103] += sum_103;
+    acc[104] += sum_104;
+    acc[105] += sum_105;
+    acc[106] += sum_106;
+    acc[107] += sum_107;
+    acc[108] += sum_108;
+    acc[109] += sum_109;
+    acc[110] += sum_110;
+    acc[111] += sum_111;
+    acc[112] += sum_112;
+    acc[113] += sum_113;
+    acc[114] += sum_114;
+    acc[115] += sum_115;
+    acc[116] += sum_116;
+    acc[117] += sum_117;
+    acc[118] += sum_118;
+    acc[119] += sum_119;
+    acc[120] += sum_120;
+    acc[121] += sum_121;
+    acc[122] += sum_122;
+    acc[123] += sum_123;
+    acc[124] += sum_124;
+    acc[125] += sum_125;
+    acc[126] += sum_126;
+    acc[127] += sum_127;
+    acc[128] += sum_128;
+    acc[129] += sum_129;
+    acc[130] += sum_130;
+    acc[131] += sum_131;
+    acc[132] += sum_132;
+    acc[133] += sum_133;
+    acc[134] += sum_134;
+    acc[135] += sum_135;
+    acc[136] += sum_136;
+    acc[137] += sum_137;
+    acc[138] += sum_138;
+    acc[139] += sum_139;
+    acc[140] += sum_140;
+    acc[141] += sum_141;
+    acc[142] += sum_142;
+    acc[143] += sum_143;
+    acc[144] += sum_144;
+    acc[145] += sum_145;
+    acc[146] += sum_146;
+    acc[147] += sum_147;
+    acc[148] += sum_148;
+    acc[149] += sum_149;
+}
+
+
+void potential_kernel_4_0(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_300_000_1 = PA[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_400_000_0 = PA[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_310_000_0 = PA[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_301_000_0 = PA[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_120_000_1 = PA[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_220_000_0 = PA[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_201_000_1 = PA[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_211_000_0 = PA[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_102_000_1 = PA[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_202_000_0 = PA[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_030_000_1 = PA[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_130_000_0 = PA[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_021_000_1 = PA[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_121_000_0 = PA[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_012_000_1 = PA[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_112_000_0 = PA[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_003_000_1 = PA[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_103_000_0 = PA[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_040_000_0 = PA[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_031_000_0 = PA[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_022_000_0 = PA[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_013_000_0 = PA[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_004_000_0 = PA[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+
+        sum_0 += q[l]*v_400_000_0;
+        sum_1 += q[l]*v_310_000_0;
+        sum_2 += q[l]*v_301_000_0;
+        sum_3 += q[l]*v_220_000_0;
+        sum_4 += q[l]*v_211_000_0;
+        sum_5 += q[l]*v_202_000_0;
+        sum_6 += q[l]*v_130_000_0;
+        sum_7 += q[l]*v_121_000_0;
+        sum_8 += q[l]*v_112_000_0;
+        sum_9 += q[l]*v_103_000_0;
+        sum_10 += q[l]*v_040_000_0;
+        sum_11 += q[l]*v_031_000_0;
+        sum_12 += q[l]*v_022_000_0;
+        sum_13 += q[l]*v_013_000_0;
+        sum_14 += q[l]*v_004_000_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+}
+
+
+void potential_kernel_4_1(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_300_000_1 = PA[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_400_000_0 = PA[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_200_000_3 = PA[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_300_000_2 = PA[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_400_000_1 = PA[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_400_100_0 = PB[0]*v_400_000_0 - PC0[l]*v_400_000_1 + 4*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_400_010_0 = PB[1]*v_400_000_0 - PC1[l]*v_400_000_1;
+        const double v_400_001_0 = PB[2]*v_400_000_0 - PC2[l]*v_400_000_1;
+        const double v_310_000_0 = PA[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_310_000_1 = PA[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_210_000_0 = PA[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_210_000_1 = PA[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_310_100_0 = PB[0]*v_310_000_0 - PC0[l]*v_310_000_1 + 3*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_310_010_0 = PB[1]*v_310_000_0 - PC1[l]*v_310_000_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_310_001_0 = PB[2]*v_310_000_0 - PC2[l]*v_310_000_1;
+        const double v_301_000_0 = PA[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_301_000_1 = PA[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_201_000_1 = PA[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_301_100_0 = PB[0]*v_301_000_0 - PC0[l]*v_301_000_1 + 3*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_301_010_0 = PB[1]*v_301_000_0 - PC1[l]*v_301_000_1;
+        const double v_301_001_0 = PB[2]*v_301_000_0 - PC2[l]*v_301_000_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_120_000_1 = PA[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_220_000_0 = PA[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_020_000_3 = PA[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_120_000_2 = PA[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_220_000_1 = PA[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_220_100_0 = PB[0]*v_220_000_0 - PC0[l]*v_220_000_1 + 2*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_220_010_0 = PB[1]*v_220_000_0 - PC1[l]*v_220_000_1 + 2*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_220_001_0 = PB[2]*v_220_000_0 - PC2[l]*v_220_000_1;
+        const double v_211_000_0 = PA[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_201_000_2 = PA[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_211_000_1 = PA[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_111_000_0 = PA[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_111_000_1 = PA[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_211_100_0 = PB[0]*v_211_000_0 - PC0[l]*v_211_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_211_010_0 = PB[1]*v_211_000_0 - PC1[l]*v_211_000_1 + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_211_001_0 = PB[2]*v_211_000_0 - PC2[l]*v_211_000_1 + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_102_000_1 = PA[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_202_000_0 = PA[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_002_000_3 = PA[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_102_000_2 = PA[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_202_000_1 = PA[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_202_100_0 = PB[0]*v_202_000_0 - PC0[l]*v_202_000_1 + 2*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_202_010_0 = PB[1]*v_202_000_0 - PC1[l]*v_202_000_1;
+        const double v_202_001_0 = PB[2]*v_202_000_0 - PC2[l]*v_202_000_1 + 2*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_030_000_1 = PA[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_130_000_0 = PA[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_000_2 = PA[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_130_000_1 = PA[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_130_100_0 = PB[0]*v_130_000_0 - PC0[l]*v_130_000_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_130_010_0 = PB[1]*v_130_000_0 - PC1[l]*v_130_000_1 + 3*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_130_001_0 = PB[2]*v_130_000_0 - PC2[l]*v_130_000_1;
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_021_000_1 = PA[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_121_000_0 = PA[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_000_2 = PA[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_121_000_1 = PA[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_121_100_0 = PB[0]*v_121_000_0 - PC0[l]*v_121_000_1 + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_121_010_0 = PB[1]*v_121_000_0 - PC1[l]*v_121_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_121_001_0 = PB[2]*v_121_000_0 - PC2[l]*v_121_000_1 + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_012_000_1 = PA[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_112_000_0 = PA[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_000_2 = PA[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_112_000_1 = PA[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_112_100_0 = PB[0]*v_112_000_0 - PC0[l]*v_112_000_1 + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_112_010_0 = PB[1]*v_112_000_0 - PC1[l]*v_112_000_1 + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_112_001_0 = PB[2]*v_112_000_0 - PC2[l]*v_112_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_003_000_1 = PA[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_103_000_0 = PA[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_000_2 = PA[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_103_000_1 = PA[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_103_100_0 = PB[0]*v_103_000_0 - PC0[l]*v_103_000_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_103_010_0 = PB[1]*v_103_000_0 - PC1[l]*v_103_000_1;
+        const double v_103_001_0 = PB[2]*v_103_000_0 - PC2[l]*v_103_000_1 + 3*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_040_000_0 = PA[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_040_000_1 = PA[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_040_100_0 = PB[0]*v_040_000_0 - PC0[l]*v_040_000_1;
+        const double v_040_010_0 = PB[1]*v_040_000_0 - PC1[l]*v_040_000_1 + 4*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_040_001_0 = PB[2]*v_040_000_0 - PC2[l]*v_040_000_1;
+        const double v_031_000_0 = PA[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_031_000_1 = PA[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_031_100_0 = PB[0]*v_031_000_0 - PC0[l]*v_031_000_1;
+        const double v_031_010_0 = PB[1]*v_031_000_0 - PC1[l]*v_031_000_1 + 3*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_031_001_0 = PB[2]*v_031_000_0 - PC2[l]*v_031_000_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_022_000_0 = PA[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_022_000_1 = PA[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_022_100_0 = PB[0]*v_022_000_0 - PC0[l]*v_022_000_1;
+        const double v_022_010_0 = PB[1]*v_022_000_0 - PC1[l]*v_022_000_1 + 2*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_022_001_0 = PB[2]*v_022_000_0 - PC2[l]*v_022_000_1 + 2*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_013_000_0 = PA[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_013_000_1 = PA[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_013_100_0 = PB[0]*v_013_000_0 - PC0[l]*v_013_000_1;
+        const double v_013_010_0 = PB[1]*v_013_000_0 - PC1[l]*v_013_000_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_013_001_0 = PB[2]*v_013_000_0 - PC2[l]*v_013_000_1 + 3*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_004_000_0 = PA[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_004_000_1 = PA[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_004_100_0 = PB[0]*v_004_000_0 - PC0[l]*v_004_000_1;
+        const double v_004_010_0 = PB[1]*v_004_000_0 - PC1[l]*v_004_000_1;
+        const double v_004_001_0 = PB[2]*v_004_000_0 - PC2[l]*v_004_000_1 + 4*oo2p*(v_003_000_0 - v_003_000_1);
+
+        sum_0 += q[l]*v_400_100_0;
+        sum_1 += q[l]*v_400_010_0;
+        sum_2 += q[l]*v_400_001_0;
+        sum_3 += q[l]*v_310_100_0;
+        sum_4 += q[l]*v_310_010_0;
+        sum_5 += q[l]*v_310_001_0;
+        sum_6 += q[l]*v_301_100_0;
+        sum_7 += q[l]*v_301_010_0;
+        sum_8 += q[l]*v_301_001_0;
+        sum_9 += q[l]*v_220_100_0;
+        sum_10 += q[l]*v_220_010_0;
+        sum_11 += q[l]*v_220_001_0;
+        sum_12 += q[l]*v_211_100_0;
+        sum_13 += q[l]*v_211_010_0;
+        sum_14 += q[l]*v_211_001_0;
+        sum_15 += q[l]*v_202_100_0;
+        sum_16 += q[l]*v_202_010_0;
+        sum_17 += q[l]*v_202_001_0;
+        sum_18 += q[l]*v_130_100_0;
+        sum_19 += q[l]*v_130_010_0;
+        sum_20 += q[l]*v_130_001_0;
+        sum_21 += q[l]*v_121_100_0;
+        sum_22 += q[l]*v_121_010_0;
+        sum_23 += q[l]*v_121_001_0;
+        sum_24 += q[l]*v_112_100_0;
+        sum_25 += q[l]*v_112_010_0;
+        sum_26 += q[l]*v_112_001_0;
+        sum_27 += q[l]*v_103_100_0;
+        sum_28 += q[l]*v_103_010_0;
+        sum_29 += q[l]*v_103_001_0;
+        sum_30 += q[l]*v_040_100_0;
+        sum_31 += q[l]*v_040_010_0;
+        sum_32 += q[l]*v_040_001_0;
+        sum_33 += q[l]*v_031_100_0;
+        sum_34 += q[l]*v_031_010_0;
+        sum_35 += q[l]*v_031_001_0;
+        sum_36 += q[l]*v_022_100_0;
+        sum_37 += q[l]*v_022_010_0;
+        sum_38 += q[l]*v_022_001_0;
+        sum_39 += q[l]*v_013_100_0;
+        sum_40 += q[l]*v_013_010_0;
+        sum_41 += q[l]*v_013_001_0;
+        sum_42 += q[l]*v_004_100_0;
+        sum_43 += q[l]*v_004_010_0;
+        sum_44 += q[l]*v_004_001_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+}
+
+
+void potential_kernel_4_2(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+    double sum_45 = 0.0;
+    double sum_46 = 0.0;
+    double sum_47 = 0.0;
+    double sum_48 = 0.0;
+    double sum_49 = 0.0;
+    double sum_50 = 0.0;
+    double sum_51 = 0.0;
+    double sum_52 = 0.0;
+    double sum_53 = 0.0;
+    double sum_54 = 0.0;
+    double sum_55 = 0.0;
+    double sum_56 = 0.0;
+    double sum_57 = 0.0;
+    double sum_58 = 0.0;
+    double sum_59 = 0.0;
+    double sum_60 = 0.0;
+    double sum_61 = 0.0;
+    double sum_62 = 0.0;
+    double sum_63 = 0.0;
+    double sum_64 = 0.0;
+    double sum_65 = 0.0;
+    double sum_66 = 0.0;
+    double sum_67 = 0.0;
+    double sum_68 = 0.0;
+    double sum_69 = 0.0;
+    double sum_70 = 0.0;
+    double sum_71 = 0.0;
+    double sum_72 = 0.0;
+    double sum_73 = 0.0;
+    double sum_74 = 0.0;
+    double sum_75 = 0.0;
+    double sum_76 = 0.0;
+    double sum_77 = 0.0;
+    double sum_78 = 0.0;
+    double sum_79 = 0.0;
+    double sum_80 = 0.0;
+    double sum_81 = 0.0;
+    double sum_82 = 0.0;
+    double sum_83 = 0.0;
+    double sum_84 = 0.0;
+    double sum_85 = 0.0;
+    double sum_86 = 0.0;
+    double sum_87 = 0.0;
+    double sum_88 = 0.0;
+    double sum_89 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_300_000_1 = PA[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_400_000_0 = PA[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_200_000_3 = PA[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_300_000_2 = PA[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_400_000_1 = PA[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_400_100_0 = PB[0]*v_400_000_0 - PC0[l]*v_400_000_1 + 4*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_000_000_6 = F[6*nb + l];
+        const double v_100_000_5 = PA[0]*v_000_000_5 - PC0[l]*v_000_000_6;
+        const double v_200_000_4 = PA[0]*v_100_000_4 - PC0[l]*v_100_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_300_000_3 = PA[0]*v_200_000_3 - PC0[l]*v_200_000_4 + 2*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_400_000_2 = PA[0]*v_300_000_2 - PC0[l]*v_300_000_3 + 3*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_400_100_1 = PB[0]*v_400_000_1 - PC0[l]*v_400_000_2 + 4*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_300_100_0 = PB[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_300_100_1 = PB[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_400_200_0 = PB[0]*v_400_100_0 - PC0[l]*v_400_100_1 + 4*oo2p*(v_300_100_0 - v_300_100_1) + 1*oo2p*(v_400_000_0 - v_400_000_1);
+        const double v_400_110_0 = PB[1]*v_400_100_0 - PC1[l]*v_400_100_1;
+        const double v_400_101_0 = PB[2]*v_400_100_0 - PC2[l]*v_400_100_1;
+        const double v_400_010_0 = PB[1]*v_400_000_0 - PC1[l]*v_400_000_1;
+        const double v_400_010_1 = PB[1]*v_400_000_1 - PC1[l]*v_400_000_2;
+        const double v_400_020_0 = PB[1]*v_400_010_0 - PC1[l]*v_400_010_1 + 1*oo2p*(v_400_000_0 - v_400_000_1);
+        const double v_400_001_0 = PB[2]*v_400_000_0 - PC2[l]*v_400_000_1;
+        const double v_400_001_1 = PB[2]*v_400_000_1 - PC2[l]*v_400_000_2;
+        const double v_400_011_0 = PB[1]*v_400_001_0 - PC1[l]*v_400_001_1;
+        const double v_400_002_0 = PB[2]*v_400_001_0 - PC2[l]*v_400_001_1 + 1*oo2p*(v_400_000_0 - v_400_000_1);
+        const double v_310_000_0 = PA[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_310_000_1 = PA[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_210_000_0 = PA[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_210_000_1 = PA[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_310_100_0 = PB[0]*v_310_000_0 - PC0[l]*v_310_000_1 + 3*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_310_000_2 = PA[1]*v_300_000_2 - PC1[l]*v_300_000_3;
+        const double v_210_000_2 = PA[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_310_100_1 = PB[0]*v_310_000_1 - PC0[l]*v_310_000_2 + 3*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_210_100_0 = PB[0]*v_210_000_0 - PC0[l]*v_210_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_110_000_2 = PA[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_210_100_1 = PB[0]*v_210_000_1 - PC0[l]*v_210_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_310_200_0 = PB[0]*v_310_100_0 - PC0[l]*v_310_100_1 + 3*oo2p*(v_210_100_0 - v_210_100_1) + 1*oo2p*(v_310_000_0 - v_310_000_1);
+        const double v_310_010_0 = PB[1]*v_310_000_0 - PC1[l]*v_310_000_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_310_010_1 = PB[1]*v_310_000_1 - PC1[l]*v_310_000_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_210_010_0 = PB[1]*v_210_000_0 - PC1[l]*v_210_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_210_010_1 = PB[1]*v_210_000_1 - PC1[l]*v_210_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_310_110_0 = PB[0]*v_310_010_0 - PC0[l]*v_310_010_1 + 3*oo2p*(v_210_010_0 - v_210_010_1);
+        const double v_310_101_0 = PB[2]*v_310_100_0 - PC2[l]*v_310_100_1;
+        const double v_300_010_0 = PB[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_300_010_1 = PB[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_310_020_0 = PB[1]*v_310_010_0 - PC1[l]*v_310_010_1 + 1*oo2p*(v_300_010_0 - v_300_010_1) + 1*oo2p*(v_310_000_0 - v_310_000_1);
+        const double v_310_011_0 = PB[2]*v_310_010_0 - PC2[l]*v_310_010_1;
+        const double v_310_001_0 = PB[2]*v_310_000_0 - PC2[l]*v_310_000_1;
+        const double v_310_001_1 = PB[2]*v_310_000_1 - PC2[l]*v_310_000_2;
+        const double v_310_002_0 = PB[2]*v_310_001_0 - PC2[l]*v_310_001_1 + 1*oo2p*(v_310_000_0 - v_310_000_1);
+        const double v_301_000_0 = PA[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_301_000_1 = PA[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_201_000_1 = PA[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_301_100_0 = PB[0]*v_301_000_0 - PC0[l]*v_301_000_1 + 3*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_301_000_2 = PA[2]*v_300_000_2 - PC2[l]*v_300_000_3;
+        const double v_201_000_2 = PA[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_301_100_1 = PB[0]*v_301_000_1 - PC0[l]*v_301_000_2 + 3*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_201_100_0 = PB[0]*v_201_000_0 - PC0[l]*v_201_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_101_000_2 = PA[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_201_100_1 = PB[0]*v_201_000_1 - PC0[l]*v_201_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_301_200_0 = PB[0]*v_301_100_0 - PC0[l]*v_301_100_1 + 3*oo2p*(v_201_100_0 - v_201_100_1) + 1*oo2p*(v_301_000_0 - v_301_000_1);
+        const double v_301_110_0 = PB[1]*v_301_100_0 - PC1[l]*v_301_100_1;
+        const double v_301_001_0 = PB[2]*v_301_000_0 - PC2[l]*v_301_000_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_301_001_1 = PB[2]*v_301_000_1 - PC2[l]*v_301_000_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_201_001_0 = PB[2]*v_201_000_0 - PC2[l]*v_201_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_201_001_1 = PB[2]*v_201_000_1 - PC2[l]*v_201_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_301_101_0 = PB[0]*v_301_001_0 - PC0[l]*v_301_001_1 + 3*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_301_010_0 = PB[1]*v_301_000_0 - PC1[l]*v_301_000_1;
+        const double v_301_010_1 = PB[1]*v_301_000_1 - PC1[l]*v_301_000_2;
+        const double v_301_020_0 = PB[1]*v_301_010_0 - PC1[l]*v_301_010_1 + 1*oo2p*(v_301_000_0 - v_301_000_1);
+        const double v_301_011_0 = PB[1]*v_301_001_0 - PC1[l]*v_301_001_1;
+        const double v_300_001_0 = PB[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_300_001_1 = PB[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_301_002_0 = PB[2]*v_301_001_0 - PC2[l]*v_301_001_1 + 1*oo2p*(v_300_001_0 - v_300_001_1) + 1*oo2p*(v_301_000_0 - v_301_000_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_120_000_1 = PA[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_220_000_0 = PA[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_020_000_3 = PA[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_120_000_2 = PA[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_220_000_1 = PA[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_220_100_0 = PB[0]*v_220_000_0 - PC0[l]*v_220_000_1 + 2*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_010_000_5 = PA[1]*v_000_000_5 - PC1[l]*v_000_000_6;
+        const double v_020_000_4 = PA[1]*v_010_000_4 - PC1[l]*v_010_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_120_000_3 = PA[0]*v_020_000_3 - PC0[l]*v_020_000_4;
+        const double v_220_000_2 = PA[0]*v_120_000_2 - PC0[l]*v_120_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_220_100_1 = PB[0]*v_220_000_1 - PC0[l]*v_220_000_2 + 2*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_120_100_0 = PB[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_120_100_1 = PB[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_220_200_0 = PB[0]*v_220_100_0 - PC0[l]*v_220_100_1 + 2*oo2p*(v_120_100_0 - v_120_100_1) + 1*oo2p*(v_220_000_0 - v_220_000_1);
+        const double v_220_010_0 = PB[1]*v_220_000_0 - PC1[l]*v_220_000_1 + 2*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_220_010_1 = PB[1]*v_220_000_1 - PC1[l]*v_220_000_2 + 2*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_120_010_0 = PB[1]*v_120_000_0 - PC1[l]*v_120_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_120_010_1 = PB[1]*v_120_000_1 - PC1[l]*v_120_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_220_110_0 = PB[0]*v_220_010_0 - PC0[l]*v_220_010_1 + 2*oo2p*(v_120_010_0 - v_120_010_1);
+        const double v_220_101_0 = PB[2]*v_220_100_0 - PC2[l]*v_220_100_1;
+        const double v_220_020_0 = PB[1]*v_220_010_0 - PC1[l]*v_220_010_1 + 2*oo2p*(v_210_010_0 - v_210_010_1) + 1*oo2p*(v_220_000_0 - v_220_000_1);
+        const double v_220_011_0 = PB[2]*v_220_010_0 - PC2[l]*v_220_010_1;
+        const double v_220_001_0 = PB[2]*v_220_000_0 - PC2[l]*v_220_000_1;
+        const double v_220_001_1 = PB[2]*v_220_000_1 - PC2[l]*v_220_000_2;
+        const double v_220_002_0 = PB[2]*v_220_001_0 - PC2[l]*v_220_001_1 + 1*oo2p*(v_220_000_0 - v_220_000_1);
+        const double v_211_000_0 = PA[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_211_000_1 = PA[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_111_000_0 = PA[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_111_000_1 = PA[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_211_100_0 = PB[0]*v_211_000_0 - PC0[l]*v_211_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_201_000_3 = PA[2]*v_200_000_3 - PC2[l]*v_200_000_4;
+        const double v_211_000_2 = PA[1]*v_201_000_2 - PC1[l]*v_201_000_3;
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_011_000_3 = PA[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_111_000_2 = PA[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_211_100_1 = PB[0]*v_211_000_1 - PC0[l]*v_211_000_2 + 2*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_111_100_0 = PB[0]*v_111_000_0 - PC0[l]*v_111_000_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_111_100_1 = PB[0]*v_111_000_1 - PC0[l]*v_111_000_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_211_200_0 = PB[0]*v_211_100_0 - PC0[l]*v_211_100_1 + 2*oo2p*(v_111_100_0 - v_111_100_1) + 1*oo2p*(v_211_000_0 - v_211_000_1);
+        const double v_211_010_0 = PB[1]*v_211_000_0 - PC1[l]*v_211_000_1 + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_211_010_1 = PB[1]*v_211_000_1 - PC1[l]*v_211_000_2 + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_111_010_0 = PB[1]*v_111_000_0 - PC1[l]*v_111_000_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_111_010_1 = PB[1]*v_111_000_1 - PC1[l]*v_111_000_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_211_110_0 = PB[0]*v_211_010_0 - PC0[l]*v_211_010_1 + 2*oo2p*(v_111_010_0 - v_111_010_1);
+        const double v_211_001_0 = PB[2]*v_211_000_0 - PC2[l]*v_211_000_1 + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_211_001_1 = PB[2]*v_211_000_1 - PC2[l]*v_211_000_2 + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_111_001_0 = PB[2]*v_111_000_0 - PC2[l]*v_111_000_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_111_001_1 = PB[2]*v_111_000_1 - PC2[l]*v_111_000_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_211_101_0 = PB[0]*v_211_001_0 - PC0[l]*v_211_001_1 + 2*oo2p*(v_111_001_0 - v_111_001_1);
+        const double v_201_010_0 = PB[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_201_010_1 = PB[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_211_020_0 = PB[1]*v_211_010_0 - PC1[l]*v_211_010_1 + 1*oo2p*(v_201_010_0 - v_201_010_1) + 1*oo2p*(v_211_000_0 - v_211_000_1);
+        const double v_211_011_0 = PB[1]*v_211_001_0 - PC1[l]*v_211_001_1 + 1*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_210_001_0 = PB[2]*v_210_000_0 - PC2[l]*v_210_000_1;
+        const double v_210_001_1 = PB[2]*v_210_000_1 - PC2[l]*v_210_000_2;
+        const double v_211_002_0 = PB[2]*v_211_001_0 - PC2[l]*v_211_001_1 + 1*oo2p*(v_210_001_0 - v_210_001_1) + 1*oo2p*(v_211_000_0 - v_211_000_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_102_000_1 = PA[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_202_000_0 = PA[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_000_3 = PA[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_102_000_2 = PA[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_202_000_1 = PA[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_202_100_0 = PB[0]*v_202_000_0 - PC0[l]*v_202_000_1 + 2*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_001_000_5 = PA[2]*v_000_000_5 - PC2[l]*v_000_000_6;
+        const double v_002_000_4 = PA[2]*v_001_000_4 - PC2[l]*v_001_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_102_000_3 = PA[0]*v_002_000_3 - PC0[l]*v_002_000_4;
+        const double v_202_000_2 = PA[0]*v_102_000_2 - PC0[l]*v_102_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_202_100_1 = PB[0]*v_202_000_1 - PC0[l]*v_202_000_2 + 2*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_102_100_0 = PB[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_102_100_1 = PB[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_202_200_0 = PB[0]*v_202_100_0 - PC0[l]*v_202_100_1 + 2*oo2p*(v_102_100_0 - v_102_100_1) + 1*oo2p*(v_202_000_0 - v_202_000_1);
+        const double v_202_110_0 = PB[1]*v_202_100_0 - PC1[l]*v_202_100_1;
+        const double v_202_001_0 = PB[2]*v_202_000_0 - PC2[l]*v_202_000_1 + 2*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_202_001_1 = PB[2]*v_202_000_1 - PC2[l]*v_202_000_2 + 2*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_102_001_0 = PB[2]*v_102_000_0 - PC2[l]*v_102_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_102_001_1 = PB[2]*v_102_000_1 - PC2[l]*v_102_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_202_101_0 = PB[0]*v_202_001_0 - PC0[l]*v_202_001_1 + 2*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_202_010_0 = PB[1]*v_202_000_0 - PC1[l]*v_202_000_1;
+        const double v_202_010_1 = PB[1]*v_202_000_1 - PC1[l]*v_202_000_2;
+        const double v_202_020_0 = PB[1]*v_202_010_0 - PC1[l]*v_202_010_1 + 1*oo2p*(v_202_000_0 - v_202_000_1);
+        const double v_202_011_0 = PB[1]*v_202_001_0 - PC1[l]*v_202_001_1;
+        const double v_202_002_0 = PB[2]*v_202_001_0 - PC2[l]*v_202_001_1 + 2*oo2p*(v_201_001_0 - v_201_001_1) + 1*oo2p*(v_202_000_0 - v_202_000_1);
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_030_000_1 = PA[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_130_000_0 = PA[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_000_2 = PA[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_130_000_1 = PA[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_130_100_0 = PB[0]*v_130_000_0 - PC0[l]*v_130_000_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_000_3 = PA[1]*v_020_000_3 - PC1[l]*v_020_000_4 + 2*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_130_000_2 = PA[0]*v_030_000_2 - PC0[l]*v_030_000_3;
+        const double v_130_100_1 = PB[0]*v_130_000_1 - PC0[l]*v_130_000_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_030_100_0 = PB[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_100_1 = PB[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_130_200_0 = PB[0]*v_130_100_0 - PC0[l]*v_130_100_1 + 1*oo2p*(v_030_100_0 - v_030_100_1) + 1*oo2p*(v_130_000_0 - v_130_000_1);
+        const double v_130_010_0 = PB[1]*v_130_000_0 - PC1[l]*v_130_000_1 + 3*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_130_010_1 = PB[1]*v_130_000_1 - PC1[l]*v_130_000_2 + 3*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_030_010_0 = PB[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_030_010_1 = PB[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_130_110_0 = PB[0]*v_130_010_0 - PC0[l]*v_130_010_1 + 1*oo2p*(v_030_010_0 - v_030_010_1);
+        const double v_130_101_0 = PB[2]*v_130_100_0 - PC2[l]*v_130_100_1;
+        const double v_130_020_0 = PB[1]*v_130_010_0 - PC1[l]*v_130_010_1 + 3*oo2p*(v_120_010_0 - v_120_010_1) + 1*oo2p*(v_130_000_0 - v_130_000_1);
+        const double v_130_011_0 = PB[2]*v_130_010_0 - PC2[l]*v_130_010_1;
+        const double v_130_001_0 = PB[2]*v_130_000_0 - PC2[l]*v_130_000_1;
+        const double v_130_001_1 = PB[2]*v_130_000_1 - PC2[l]*v_130_000_2;
+        const double v_130_002_0 = PB[2]*v_130_001_0 - PC2[l]*v_130_001_1 + 1*oo2p*(v_130_000_0 - v_130_000_1);
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_021_000_1 = PA[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_121_000_0 = PA[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_000_2 = PA[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_121_000_1 = PA[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_121_100_0 = PB[0]*v_121_000_0 - PC0[l]*v_121_000_1 + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_000_3 = PA[2]*v_020_000_3 - PC2[l]*v_020_000_4;
+        const double v_121_000_2 = PA[0]*v_021_000_2 - PC0[l]*v_021_000_3;
+        const double v_121_100_1 = PB[0]*v_121_000_1 - PC0[l]*v_121_000_2 + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_021_100_0 = PB[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_100_1 = PB[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_121_200_0 = PB[0]*v_121_100_0 - PC0[l]*v_121_100_1 + 1*oo2p*(v_021_100_0 - v_021_100_1) + 1*oo2p*(v_121_000_0 - v_121_000_1);
+        const double v_121_010_0 = PB[1]*v_121_000_0 - PC1[l]*v_121_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_121_010_1 = PB[1]*v_121_000_1 - PC1[l]*v_121_000_2 + 2*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_021_010_0 = PB[1]*v_021_000_0 - PC1[l]*v_021_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_021_010_1 = PB[1]*v_021_000_1 - PC1[l]*v_021_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_121_110_0 = PB[0]*v_121_010_0 - PC0[l]*v_121_010_1 + 1*oo2p*(v_021_010_0 - v_021_010_1);
+        const double v_121_001_0 = PB[2]*v_121_000_0 - PC2[l]*v_121_000_1 + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_121_001_1 = PB[2]*v_121_000_1 - PC2[l]*v_121_000_2 + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_021_001_0 = PB[2]*v_021_000_0 - PC2[l]*v_021_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_021_001_1 = PB[2]*v_021_000_1 - PC2[l]*v_021_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_121_101_0 = PB[0]*v_121_001_0 - PC0[l]*v_121_001_1 + 1*oo2p*(v_021_001_0 - v_021_001_1);
+        const double v_121_020_0 = PB[1]*v_121_010_0 - PC1[l]*v_121_010_1 + 2*oo2p*(v_111_010_0 - v_111_010_1) + 1*oo2p*(v_121_000_0 - v_121_000_1);
+        const double v_121_011_0 = PB[1]*v_121_001_0 - PC1[l]*v_121_001_1 + 2*oo2p*(v_111_001_0 - v_111_001_1);
+        const double v_120_001_0 = PB[2]*v_120_000_0 - PC2[l]*v_120_000_1;
+        const double v_120_001_1 = PB[2]*v_120_000_1 - PC2[l]*v_120_000_2;
+        const double v_121_002_0 = PB[2]*v_121_001_0 - PC2[l]*v_121_001_1 + 1*oo2p*(v_120_001_0 - v_120_001_1) + 1*oo2p*(v_121_000_0 - v_121_000_1);
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_012_000_1 = PA[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_112_000_0 = PA[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_000_2 = PA[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_112_000_1 = PA[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_112_100_0 = PB[0]*v_112_000_0 - PC0[l]*v_112_000_1 + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_000_3 = PA[1]*v_002_000_3 - PC1[l]*v_002_000_4;
+        const double v_112_000_2 = PA[0]*v_012_000_2 - PC0[l]*v_012_000_3;
+        const double v_112_100_1 = PB[0]*v_112_000_1 - PC0[l]*v_112_000_2 + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_012_100_0 = PB[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_100_1 = PB[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_112_200_0 = PB[0]*v_112_100_0 - PC0[l]*v_112_100_1 + 1*oo2p*(v_012_100_0 - v_012_100_1) + 1*oo2p*(v_112_000_0 - v_112_000_1);
+        const double v_112_010_0 = PB[1]*v_112_000_0 - PC1[l]*v_112_000_1 + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_112_010_1 = PB[1]*v_112_000_1 - PC1[l]*v_112_000_2 + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_012_010_0 = PB[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_012_010_1 = PB[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_112_110_0 = PB[0]*v_112_010_0 - PC0[l]*v_112_010_1 + 1*oo2p*(v_012_010_0 - v_012_010_1);
+        const double v_112_001_0 = PB[2]*v_112_000_0 - PC2[l]*v_112_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_112_001_1 = PB[2]*v_112_000_1 - PC2[l]*v_112_000_2 + 2*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_012_001_0 = PB[2]*v_012_000_0 - PC2[l]*v_012_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_012_001_1 = PB[2]*v_012_000_1 - PC2[l]*v_012_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_112_101_0 = PB[0]*v_112_001_0 - PC0[l]*v_112_001_1 + 1*oo2p*(v_012_001_0 - v_012_001_1);
+        const double v_102_010_0 = PB[1]*v_102_000_0 - PC1[l]*v_102_000_1;
+        const double v_102_010_1 = PB[1]*v_102_000_1 - PC1[l]*v_102_000_2;
+        const double v_112_020_0 = PB[1]*v_112_010_0 - PC1[l]*v_112_010_1 + 1*oo2p*(v_102_010_0 - v_102_010_1) + 1*oo2p*(v_112_000_0 - v_112_000_1);
+        const double v_112_011_0 = PB[1]*v_112_001_0 - PC1[l]*v_112_001_1 + 1*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_112_002_0 = PB[2]*v_112_001_0 - PC2[l]*v_112_001_1 + 2*oo2p*(v_111_001_0 - v_111_001_1) + 1*oo2p*(v_112_000_0 - v_112_000_1);
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_003_000_1 = PA[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_103_000_0 = PA[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_000_2 = PA[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_103_000_1 = PA[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_103_100_0 = PB[0]*v_103_000_0 - PC0[l]*v_103_000_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_000_3 = PA[2]*v_002_000_3 - PC2[l]*v_002_000_4 + 2*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_103_000_2 = PA[0]*v_003_000_2 - PC0[l]*v_003_000_3;
+        const double v_103_100_1 = PB[0]*v_103_000_1 - PC0[l]*v_103_000_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_100_0 = PB[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_100_1 = PB[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_103_200_0 = PB[0]*v_103_100_0 - PC0[l]*v_103_100_1 + 1*oo2p*(v_003_100_0 - v_003_100_1) + 1*oo2p*(v_103_000_0 - v_103_000_1);
+        const double v_103_110_0 = PB[1]*v_103_100_0 - PC1[l]*v_103_100_1;
+        const double v_103_001_0 = PB[2]*v_103_000_0 - PC2[l]*v_103_000_1 + 3*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_103_001_1 = PB[2]*v_103_000_1 - PC2[l]*v_103_000_2 + 3*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_003_001_0 = PB[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_003_001_1 = PB[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_103_101_0 = PB[0]*v_103_001_0 - PC0[l]*v_103_001_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_103_010_0 = PB[1]*v_103_000_0 - PC1[l]*v_103_000_1;
+        const double v_103_010_1 = PB[1]*v_103_000_1 - PC1[l]*v_103_000_2;
+        const double v_103_020_0 = PB[1]*v_103_010_0 - PC1[l]*v_103_010_1 + 1*oo2p*(v_103_000_0 - v_103_000_1);
+        const double v_103_011_0 = PB[1]*v_103_001_0 - PC1[l]*v_103_001_1;
+        const double v_103_002_0 = PB[2]*v_103_001_0 - PC2[l]*v_103_001_1 + 3*oo2p*(v_102_001_0 - v_102_001_1) + 1*oo2p*(v_103_000_0 - v_103_000_1);
+        const double v_040_000_0 = PA[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_040_000_1 = PA[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_040_100_0 = PB[0]*v_040_000_0 - PC0[l]*v_040_000_1;
+        const double v_040_000_2 = PA[1]*v_030_000_2 - PC1[l]*v_030_000_3 + 3*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_040_100_1 = PB[0]*v_040_000_1 - PC0[l]*v_040_000_2;
+        const double v_040_200_0 = PB[0]*v_040_100_0 - PC0[l]*v_040_100_1 + 1*oo2p*(v_040_000_0 - v_040_000_1);
+        const double v_040_010_0 = PB[1]*v_040_000_0 - PC1[l]*v_040_000_1 + 4*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_040_010_1 = PB[1]*v_040_000_1 - PC1[l]*v_040_000_2 + 4*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_040_110_0 = PB[0]*v_040_010_0 - PC0[l]*v_040_010_1;
+        const double v_040_001_0 = PB[2]*v_040_000_0 - PC2[l]*v_040_000_1;
+        const double v_040_001_1 = PB[2]*v_040_000_1 - PC2[l]*v_040_000_2;
+        const double v_040_101_0 = PB[0]*v_040_001_0 - PC0[l]*v_040_001_1;
+        const double v_040_020_0 = PB[1]*v_040_010_0 - PC1[l]*v_040_010_1 + 4*oo2p*(v_030_010_0 - v_030_010_1) + 1*oo2p*(v_040_000_0 - v_040_000_1);
+        const double v_040_011_0 = PB[2]*v_040_010_0 - PC2[l]*v_040_010_1;
+        const double v_040_002_0 = PB[2]*v_040_001_0 - PC2[l]*v_040_001_1 + 1*oo2p*(v_040_000_0 - v_040_000_1);
+        const double v_031_000_0 = PA[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_031_000_1 = PA[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_031_100_0 = PB[0]*v_031_000_0 - PC0[l]*v_031_000_1;
+        const double v_031_000_2 = PA[2]*v_030_000_2 - PC2[l]*v_030_000_3;
+        const double v_031_100_1 = PB[0]*v_031_000_1 - PC0[l]*v_031_000_2;
+        const double v_031_200_0 = PB[0]*v_031_100_0 - PC0[l]*v_031_100_1 + 1*oo2p*(v_031_000_0 - v_031_000_1);
+        const double v_031_010_0 = PB[1]*v_031_000_0 - PC1[l]*v_031_000_1 + 3*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_031_010_1 = PB[1]*v_031_000_1 - PC1[l]*v_031_000_2 + 3*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_031_110_0 = PB[0]*v_031_010_0 - PC0[l]*v_031_010_1;
+        const double v_031_001_0 = PB[2]*v_031_000_0 - PC2[l]*v_031_000_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_031_001_1 = PB[2]*v_031_000_1 - PC2[l]*v_031_000_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_031_101_0 = PB[0]*v_031_001_0 - PC0[l]*v_031_001_1;
+        const double v_031_020_0 = PB[1]*v_031_010_0 - PC1[l]*v_031_010_1 + 3*oo2p*(v_021_010_0 - v_021_010_1) + 1*oo2p*(v_031_000_0 - v_031_000_1);
+        const double v_031_011_0 = PB[1]*v_031_001_0 - PC1[l]*v_031_001_1 + 3*oo2p*(v_021_001_0 - v_021_001_1);
+        const double v_030_001_0 = PB[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_030_001_1 = PB[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_031_002_0 = PB[2]*v_031_001_0 - PC2[l]*v_031_001_1 + 1*oo2p*(v_030_001_0 - v_030_001_1) + 1*oo2p*(v_031_000_0 - v_031_000_1);
+        const double v_022_000_0 = PA[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_022_000_1 = PA[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_022_100_0 = PB[0]*v_022_000_0 - PC0[l]*v_022_000_1;
+        const double v_022_000_2 = PA[1]*v_012_000_2 - PC1[l]*v_012_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_022_100_1 = PB[0]*v_022_000_1 - PC0[l]*v_022_000_2;
+        const double v_022_200_0 = PB[0]*v_022_100_0 - PC0[l]*v_022_100_1 + 1*oo2p*(v_022_000_0 - v_022_000_1);
+        const double v_022_010_0 = PB[1]*v_022_000_0 - PC1[l]*v_022_000_1 + 2*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_022_010_1 = PB[1]*v_022_000_1 - PC1[l]*v_022_000_2 + 2*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_022_110_0 = PB[0]*v_022_010_0 - PC0[l]*v_022_010_1;
+        const double v_022_001_0 = PB[2]*v_022_000_0 - PC2[l]*v_022_000_1 + 2*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_022_001_1 = PB[2]*v_022_000_1 - PC2[l]*v_022_000_2 + 2*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_022_101_0 = PB[0]*v_022_001_0 - PC0[l]*v_022_001_1;
+        const double v_022_020_0 = PB[1]*v_022_010_0 - PC1[l]*v_022_010_1 + 2*oo2p*(v_012_010_0 - v_012_010_1) + 1*oo2p*(v_022_000_0 - v_022_000_1);
+        const double v_022_011_0 = PB[1]*v_022_001_0 - PC1[l]*v_022_001_1 + 2*oo2p*(v_012_001_0 - v_012_001_1);
+        const double v_022_002_0 = PB[2]*v_022_001_0 - PC2[l]*v_022_001_1 + 2*oo2p*(v_021_001_0 - v_021_001_1) + 1*oo2p*(v_022_000_0 - v_022_000_1);
+        const double v_013_000_0 = PA[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_013_000_1 = PA[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_013_100_0 = PB[0]*v_013_000_0 - PC0[l]*v_013_000_1;
+        const double v_013_000_2 = PA[1]*v_003_000_2 - PC1[l]*v_003_000_3;
+        const double v_013_100_1 = PB[0]*v_013_000_1 - PC0[l]*v_013_000_2;
+        const double v_013_200_0 = PB[0]*v_013_100_0 - PC0[l]*v_013_100_1 + 1*oo2p*(v_013_000_0 - v_013_000_1);
+        const double v_013_010_0 = PB[1]*v_013_000_0 - PC1[l]*v_013_000_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_013_010_1 = PB[1]*v_013_000_1 - PC1[l]*v_013_000_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_013_110_0 = PB[0]*v_013_010_0 - PC0[l]*v_013_010_1;
+        const double v_013_001_0 = PB[2]*v_013_000_0 - PC2[l]*v_013_000_1 + 3*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_013_001_1 = PB[2]*v_013_000_1 - PC2[l]*v_013_000_2 + 3*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_013_101_0 = PB[0]*v_013_001_0 - PC0[l]*v_013_001_1;
+        const double v_003_010_0 = PB[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_003_010_1 = PB[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_013_020_0 = PB[1]*v_013_010_0 - PC1[l]*v_013_010_1 + 1*oo2p*(v_003_010_0 - v_003_010_1) + 1*oo2p*(v_013_000_0 - v_013_000_1);
+        const double v_013_011_0 = PB[1]*v_013_001_0 - PC1[l]*v_013_001_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_013_002_0 = PB[2]*v_013_001_0 - PC2[l]*v_013_001_1 + 3*oo2p*(v_012_001_0 - v_012_001_1) + 1*oo2p*(v_013_000_0 - v_013_000_1);
+        const double v_004_000_0 = PA[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_004_000_1 = PA[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_004_100_0 = PB[0]*v_004_000_0 - PC0[l]*v_004_000_1;
+        const double v_004_000_2 = PA[2]*v_003_000_2 - PC2[l]*v_003_000_3 + 3*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_004_100_1 = PB[0]*v_004_000_1 - PC0[l]*v_004_000_2;
+        const double v_004_200_0 = PB[0]*v_004_100_0 - PC0[l]*v_004_100_1 + 1*oo2p*(v_004_000_0 - v_004_000_1);
+        const double v_004_010_0 = PB[1]*v_004_000_0 - PC1[l]*v_004_000_1;
+        const double v_004_010_1 = PB[1]*v_004_000_1 - PC1[l]*v_004_000_2;
+        const double v_004_110_0 = PB[0]*v_004_010_0 - PC0[l]*v_004_010_1;
+        const double v_004_001_0 = PB[2]*v_004_000_0 - PC2[l]*v_004_000_1 + 4*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_004_001_1 = PB[2]*v_004_000_1 - PC2[l]*v_004_000_2 + 4*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_004_101_0 = PB[0]*v_004_001_0 - PC0[l]*v_004_001_1;
+        const double v_004_020_0 = PB[1]*v_004_010_0 - PC1[l]*v_004_010_1 + 1*oo2p*(v_004_000_0 - v_004_000_1);
+        const double v_004_011_0 = PB[1]*v_004_001_0 - PC1[l]*v_004_001_1;
+        const double v_004_002_0 = PB[2]*v_004_001_0 - PC2[l]*v_004_001_1 + 4*oo2p*(v_003_001_0 - v_003_001_1) + 1*oo2p*(v_004_000_0 - v_004_000_1);
+
+        sum_0 += q[l]*v_400_200_0;
+        sum_1 += q[l]*v_400_110_0;
+        sum_2 += q[l]*v_400_101_0;
+        sum_3 += q[l]*v_400_020_0;
+        sum_4 += q[l]*v_400_011_0;
+        sum_5 += q[l]*v_400_002_0;
+        sum_6 += q[l]*v_310_200_0;
+        sum_7 += q[l]*v_310_110_0;
+        sum_8 += q[l]*v_310_101_0;
+        sum_9 += q[l]*v_310_020_0;
+        sum_10 += q[l]*v_310_011_0;
+        sum_11 += q[l]*v_310_002_0;
+        sum_12 += q[l]*v_301_200_0;
+        sum_13 += q[l]*v_301_110_0;
+        sum_14 += q[l]*v_301_101_0;
+        sum_15 += q[l]*v_301_020_0;
+        sum_16 += q[l]*v_301_011_0;
+        sum_17 += q[l]*v_301_002_0;
+        sum_18 += q[l]*v_220_200_0;
+        sum_19 += q[l]*v_220_110_0;
+        sum_20 += q[l]*v_220_101_0;
+        sum_21 += q[l]*v_220_020_0;
+        sum_22 += q[l]*v_220_011_0;
+        sum_23 += q[l]*v_220_002_0;
+        sum_24 += q[l]*v_211_200_0;
+        sum_25 += q[l]*v_211_110_0;
+        sum_26 += q[l]*v_211_101_0;
+        sum_27 += q[l]*v_211_020_0;
+        sum_28 += q[l]*v_211_011_0;
+        sum_29 += q[l]*v_211_002_0;
+        sum_30 += q[l]*v_202_200_0;
+        sum_31 += q[l]*v_202_110_0;
+        sum_32 += q[l]*v_202_101_0;
+        sum_33 += q[l]*v_202_020_0;
+        sum_34 += q[l]*v_202_011_0;
+        sum_35 += q[l]*v_202_002_0;
+        sum_36 += q[l]*v_130_200_0;
+        sum_37 += q[l]*v_130_110_0;
+        sum_38 += q[l]*v_130_101_0;
+        sum_39 += q[l]*v_130_020_0;
+        sum_40 += q[l]*v_130_011_0;
+        sum_41 += q[l]*v_130_002_0;
+        sum_42 += q[l]*v_121_200_0;
+        sum_43 += q[l]*v_121_110_0;
+        sum_44 += q[l]*v_121_101_0;
+        sum_45 += q[l]*v_121_020_0;
+        sum_46 += q[l]*v_121_011_0;
+        sum_47 += q[l]*v_121_002_0;
+        sum_48 += q[l]*v_112_200_0;
+        sum_49 += q[l]*v_112_110_0;
+        sum_50 += q[l]*v_112_101_0;
+        sum_51 += q[l]*v_112_020_0;
+        sum_52 += q[l]*v_112_011_0;
+        sum_53 += q[l]*v_112_002_0;
+        sum_54 += q[l]*v_103_200_0;
+        sum_55 += q[l]*v_103_110_0;
+        sum_56 += q[l]*v_103_101_0;
+        sum_57 += q[l]*v_103_020_0;
+        sum_58 += q[l]*v_103_011_0;
+        sum_59 += q[l]*v_103_002_0;
+        sum_60 += q[l]*v_040_200_0;
+        sum_61 += q[l]*v_040_110_0;
+        sum_62 += q[l]*v_040_101_0;
+        sum_63 += q[l]*v_040_020_0;
+        sum_64 += q[l]*v_040_011_0;
+        sum_65 += q[l]*v_040_002_0;
+        sum_66 += q[l]*v_031_200_0;
+        sum_67 += q[l]*v_031_110_0;
+        sum_68 += q[l]*v_031_101_0;
+        sum_69 += q[l]*v_031_020_0;
+        sum_70 += q[l]*v_031_011_0;
+        sum_71 += q[l]*v_031_002_0;
+        sum_72 += q[l]*v_022_200_0;
+        sum_73 += q[l]*v_022_110_0;
+        sum_74 += q[l]*v_022_101_0;
+        sum_75 += q[l]*v_022_020_0;
+        sum_76 += q[l]*v_022_011_0;
+        sum_77 += q[l]*v_022_002_0;
+        sum_78 += q[l]*v_013_200_0;
+        sum_79 += q[l]*v_013_110_0;
+        sum_80 += q[l]*v_013_101_0;
+        sum_81 += q[l]*v_013_020_0;
+        sum_82 += q[l]*v_013_011_0;
+        sum_83 += q[l]*v_013_002_0;
+        sum_84 += q[l]*v_004_200_0;
+        sum_85 += q[l]*v_004_110_0;
+        sum_86 += q[l]*v_004_101_0;
+        sum_87 += q[l]*v_004_020_0;
+        sum_88 += q[l]*v_004_011_0;
+        sum_89 += q[l]*v_004_002_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+    acc[45] += sum_45;
+    acc[46] += sum_46;
+    acc[47] += sum_47;
+    acc[48] += sum_48;
+    acc[49] += sum_49;
+    acc[50] += sum_50;
+    acc[51] += sum_51;
+    acc[52] += sum_52;
+    acc[53] += sum_53;
+    acc[54] += sum_54;
+    acc[55] += sum_55;
+    acc[56] += sum_56;
+    acc[57] += sum_57;
+    acc[58] += sum_58;
+    acc[59] += sum_59;
+    acc[60] += sum_60;
+    acc[61] += sum_61;
+    acc[62] += sum_62;
+    acc[63] += sum_63;
+    acc[64] += sum_64;
+    acc[65] += sum_65;
+    acc[66] += sum_66;
+    acc[67] += sum_67;
+    acc[68] += sum_68;
+    acc[69] += sum_69;
+    acc[70] += sum_70;
+    acc[71] += sum_71;
+    acc[72] += sum_72;
+    acc[73] += sum_73;
+    acc[74] += sum_74;
+    acc[75] += sum_75;
+    acc[76] += sum_76;
+    acc[77] += sum_77;
+    acc[78] += sum_78;
+    acc[79] += sum_79;
+    acc[80] += sum_80;
+    acc[81] += sum_81;
+    acc[82] += sum_82;
+    acc[83] += sum_83;
+    acc[84] += sum_84;
+    acc[85] += sum_85;
+    acc[86] += sum_86;
+    acc[87] += sum_87;
+    acc[88] += sum_88;
+    acc[89] += sum_89;
+}
+
+
+void potential_kernel_4_3(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+    double sum_45 = 0.0;
+    double sum_46 = 0.0;
+    double sum_47 = 0.0;
+    double sum_48 = 0.0;
+    double sum_49 = 0.0;
+    double sum_50 = 0.0;
+    double sum_51 = 0.0;
+    double sum_52 = 0.0;
+    double sum_53 = 0.0;
+    double sum_54 = 0.0;
+    double sum_55 = 0.0;
+    double sum_56 = 0.0;
+    double sum_57 = 0.0;
+    double sum_58 = 0.0;
+    double sum_59 = 0.0;
+    double sum_60 = 0.0;
+    double sum_61 = 0.0;
+    double sum_62 = 0.0;
+    double sum_63 = 0.0;
+    double sum_64 = 0.0;
+    double sum_65 = 0.0;
+    double sum_66 = 0.0;
+    double sum_67 = 0.0;
+    double sum_68 = 0.0;
+    double sum_69 = 0.0;
+    double sum_70 = 0.0;
+    double sum_71 = 0.0;
+    double sum_72 = 0.0;
+    double sum_73 = 0.0;
+    double sum_74 = 0.0;
+    double sum_75 = 0.0;
+    double sum_76 = 0.0;
+    double sum_77 = 0.0;
+    double sum_78 = 0.0;
+    double sum_79 = 0.0;
+    double sum_80 = 0.0;
+    double sum_81 = 0.0;
+    double sum_82 = 0.0;
+    double sum_83 = 0.0;
+    double sum_84 = 0.0;
+    double sum_85 = 0.0;
+    double sum_86 = 0.0;
+    double sum_87 = 0.0;
+    double sum_88 = 0.0;
+    double sum_89 = 0.0;
+    double sum_90 = 0.0;
+    double sum_91 = 0.0;
+    double sum_92 = 0.0;
+    double sum_93 = 0.0;
+    double sum_94 = 0.0;
+    double sum_95 = 0.0;
+    double sum_96 = 0.0;
+    double sum_97 = 0.0;
+    double sum_98 = 0.0;
+    double sum_99 = 0.0;
+    double sum_100 = 0.0;
+    double sum_101 = 0.0;
+    double sum_102 = 0.0;
+    double sum_103 = 0.0;
+    double sum_104 = 0.0;
+    double sum_105 = 0.0;
+    double sum_106 = 0.0;
+    double sum_107 = 0.0;
+    double sum_108 = 0.0;
+    double sum_109 = 0.0;
+    double sum_110 = 0.0;
+    double sum_111 = 0.0;
+    double sum_112 = 0.0;
+    double sum_113 = 0.0;
+    double sum_114 = 0.0;
+    double sum_115 = 0.0;
+    double sum_116 = 0.0;
+    double sum_117 = 0.0;
+    double sum_118 = 0.0;
+    double sum_119 = 0.0;
+    double sum_120 = 0.0;
+    double sum_121 = 0.0;
+    double sum_122 = 0.0;
+    double sum_123 = 0.0;
+    double sum_124 = 0.0;
+    double sum_125 = 0.0;
+    double sum_126 = 0.0;
+    double sum_127 = 0.0;
+    double sum_128 = 0.0;
+    double sum_129 = 0.0;
+    double sum_130 = 0.0;
+    double sum_131 = 0.0;
+    double sum_132 = 0.0;
+    double sum_133 = 0.0;
+    double sum_134 = 0.0;
+    double sum_135 = 0.0;
+    double sum_136 = 0.0;
+    double sum_137 = 0.0;
+    double sum_138 = 0.0;
+    double sum_139 = 0.0;
+    double sum_140 = 0.0;
+    double sum_141 = 0.0;
+    double sum_142 = 0.0;
+    double sum_143 = 0.0;
+    double sum_144 = 0.0;
+    double sum_145 = 0.0;
+    double sum_146 = 0.0;
+    double sum_147 = 0.0;
+    double sum_148 = 0.0;
+    double sum_149 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_300_000_1 = PA[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_400_000_0 = PA[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_200_000_3 = PA[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_300_000_2 = PA[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_400_000_1 = PA[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_400_100_0 = PB[0]*v_400_000_0 - PC0[l]*v_400_000_1 + 4*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_000_000_6 = F[6*nb + l];
+        const double v_100_000_5 = PA[0]*v_000_000_5 - PC0[l]*v_000_000_6;
+        const double v_200_000_4 = PA[0]*v_100_000_4 - PC0[l]*v_100_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_300_000_3 = PA[0]*v_200_000_3 - PC0[l]*v_200_000_4 + 2*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_400_000_2 = PA[0]*v_300_000_2 - PC0[l]*v_300_000_3 + 3*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_400_100_1 = PB[0]*v_400_000_1 - PC0[l]*v_400_000_2 + 4*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_300_100_0 = PB[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_300_100_1 = PB[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_400_200_0 = PB[0]*v_400_100_0 - PC0[l]*v_400_100_1 + 4*oo2p*(v_300_100_0 - v_300_100_1) + 1*oo2p*(v_400_000_0 - v_400_000_1);
+        const double v_000_000_7 = F[7*nb + l];
+        const double v_100_000_6 = PA[0]*v_000_000_6 - PC0[l]*v_000_000_7;
+        const double v_200_000_5 = PA[0]*v_100_000_5 - PC0[l]*v_100_000_6 + 1*oo2p*(v_000_000_5 - v_000_000_6);
+        const double v_300_000_4 = PA[0]*v_200_000_4 - PC0[l]*v_200_000_5 + 2*oo2p*(v_100_000_4 - v_100_000_5);
+        const double v_400_000_3 = PA[0]*v_300_000_3 - PC0[l]*v_300_000_4 + 3*oo2p*(v_200_000_3 - v_200_000_4);
+        const double v_400_100_2 = PB[0]*v_400_000_2 - PC0[l]*v_400_000_3 + 4*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_300_100_2 = PB[0]*v_300_000_2 - PC0[l]*v_300_000_3 + 3*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_400_200_1 = PB[0]*v_400_100_1 - PC0[l]*v_400_100_2 + 4*oo2p*(v_300_100_1 - v_300_100_2) + 1*oo2p*(v_400_000_1 - v_400_000_2);
+        const double v_200_100_0 = PB[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_200_100_1 = PB[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_300_200_0 = PB[0]*v_300_100_0 - PC0[l]*v_300_100_1 + 3*oo2p*(v_200_100_0 - v_200_100_1) + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_200_100_2 = PB[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_300_200_1 = PB[0]*v_300_100_1 - PC0[l]*v_300_100_2 + 3*oo2p*(v_200_100_1 - v_200_100_2) + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_400_300_0 = PB[0]*v_400_200_0 - PC0[l]*v_400_200_1 + 4*oo2p*(v_300_200_0 - v_300_200_1) + 2*oo2p*(v_400_100_0 - v_400_100_1);
+        const double v_400_210_0 = PB[1]*v_400_200_0 - PC1[l]*v_400_200_1;
+        const double v_400_201_0 = PB[2]*v_400_200_0 - PC2[l]*v_400_200_1;
+        const double v_400_010_0 = PB[1]*v_400_000_0 - PC1[l]*v_400_000_1;
+        const double v_400_010_1 = PB[1]*v_400_000_1 - PC1[l]*v_400_000_2;
+        const double v_400_020_0 = PB[1]*v_400_010_0 - PC1[l]*v_400_010_1 + 1*oo2p*(v_400_000_0 - v_400_000_1);
+        const double v_400_010_2 = PB[1]*v_400_000_2 - PC1[l]*v_400_000_3;
+        const double v_400_020_1 = PB[1]*v_400_010_1 - PC1[l]*v_400_010_2 + 1*oo2p*(v_400_000_1 - v_400_000_2);
+        const double v_300_010_0 = PB[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_300_010_1 = PB[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_300_020_0 = PB[1]*v_300_010_0 - PC1[l]*v_300_010_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_010_2 = PB[1]*v_300_000_2 - PC1[l]*v_300_000_3;
+        const double v_300_020_1 = PB[1]*v_300_010_1 - PC1[l]*v_300_010_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_400_120_0 = PB[0]*v_400_020_0 - PC0[l]*v_400_020_1 + 4*oo2p*(v_300_020_0 - v_300_020_1);
+        const double v_400_101_0 = PB[2]*v_400_100_0 - PC2[l]*v_400_100_1;
+        const double v_400_101_1 = PB[2]*v_400_100_1 - PC2[l]*v_400_100_2;
+        const double v_400_111_0 = PB[1]*v_400_101_0 - PC1[l]*v_400_101_1;
+        const double v_400_001_0 = PB[2]*v_400_000_0 - PC2[l]*v_400_000_1;
+        const double v_400_001_1 = PB[2]*v_400_000_1 - PC2[l]*v_400_000_2;
+        const double v_400_002_0 = PB[2]*v_400_001_0 - PC2[l]*v_400_001_1 + 1*oo2p*(v_400_000_0 - v_400_000_1);
+        const double v_400_001_2 = PB[2]*v_400_000_2 - PC2[l]*v_400_000_3;
+        const double v_400_002_1 = PB[2]*v_400_001_1 - PC2[l]*v_400_001_2 + 1*oo2p*(v_400_000_1 - v_400_000_2);
+        const double v_300_001_0 = PB[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_300_001_1 = PB[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_300_002_0 = PB[2]*v_300_001_0 - PC2[l]*v_300_001_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_001_2 = PB[2]*v_300_000_2 - PC2[l]*v_300_000_3;
+        const double v_300_002_1 = PB[2]*v_300_001_1 - PC2[l]*v_300_001_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_400_102_0 = PB[0]*v_400_002_0 - PC0[l]*v_400_002_1 + 4*oo2p*(v_300_002_0 - v_300_002_1);
+        const double v_400_030_0 = PB[1]*v_400_020_0 - PC1[l]*v_400_020_1 + 2*oo2p*(v_400_010_0 - v_400_010_1);
+        const double v_400_021_0 = PB[2]*v_400_020_0 - PC2[l]*v_400_020_1;
+        const double v_400_012_0 = PB[1]*v_400_002_0 - PC1[l]*v_400_002_1;
+        const double v_400_003_0 = PB[2]*v_400_002_0 - PC2[l]*v_400_002_1 + 2*oo2p*(v_400_001_0 - v_400_001_1);
+        const double v_310_000_0 = PA[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_310_000_1 = PA[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_210_000_0 = PA[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_210_000_1 = PA[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_310_100_0 = PB[0]*v_310_000_0 - PC0[l]*v_310_000_1 + 3*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_310_000_2 = PA[1]*v_300_000_2 - PC1[l]*v_300_000_3;
+        const double v_210_000_2 = PA[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_310_100_1 = PB[0]*v_310_000_1 - PC0[l]*v_310_000_2 + 3*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_210_100_0 = PB[0]*v_210_000_0 - PC0[l]*v_210_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_110_000_2 = PA[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_210_100_1 = PB[0]*v_210_000_1 - PC0[l]*v_210_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_310_200_0 = PB[0]*v_310_100_0 - PC0[l]*v_310_100_1 + 3*oo2p*(v_210_100_0 - v_210_100_1) + 1*oo2p*(v_310_000_0 - v_310_000_1);
+        const double v_310_000_3 = PA[1]*v_300_000_3 - PC1[l]*v_300_000_4;
+        const double v_210_000_3 = PA[1]*v_200_000_3 - PC1[l]*v_200_000_4;
+        const double v_310_100_2 = PB[0]*v_310_000_2 - PC0[l]*v_310_000_3 + 3*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_110_000_3 = PA[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_210_100_2 = PB[0]*v_210_000_2 - PC0[l]*v_210_000_3 + 2*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_310_200_1 = PB[0]*v_310_100_1 - PC0[l]*v_310_100_2 + 3*oo2p*(v_210_100_1 - v_210_100_2) + 1*oo2p*(v_310_000_1 - v_310_000_2);
+        const double v_110_100_0 = PB[0]*v_110_000_0 - PC0[l]*v_110_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_110_100_1 = PB[0]*v_110_000_1 - PC0[l]*v_110_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_210_200_0 = PB[0]*v_210_100_0 - PC0[l]*v_210_100_1 + 2*oo2p*(v_110_100_0 - v_110_100_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_110_100_2 = PB[0]*v_110_000_2 - PC0[l]*v_110_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_210_200_1 = PB[0]*v_210_100_1 - PC0[l]*v_210_100_2 + 2*oo2p*(v_110_100_1 - v_110_100_2) + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_310_300_0 = PB[0]*v_310_200_0 - PC0[l]*v_310_200_1 + 3*oo2p*(v_210_200_0 - v_210_200_1) + 2*oo2p*(v_310_100_0 - v_310_100_1);
+        const double v_310_210_0 = PB[1]*v_310_200_0 - PC1[l]*v_310_200_1 + 1*oo2p*(v_300_200_0 - v_300_200_1);
+        const double v_310_201_0 = PB[2]*v_310_200_0 - PC2[l]*v_310_200_1;
+        const double v_310_010_0 = PB[1]*v_310_000_0 - PC1[l]*v_310_000_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_310_010_1 = PB[1]*v_310_000_1 - PC1[l]*v_310_000_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_310_020_0 = PB[1]*v_310_010_0 - PC1[l]*v_310_010_1 + 1*oo2p*(v_300_010_0 - v_300_010_1) + 1*oo2p*(v_310_000_0 - v_310_000_1);
+        const double v_310_010_2 = PB[1]*v_310_000_2 - PC1[l]*v_310_000_3 + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_310_020_1 = PB[1]*v_310_010_1 - PC1[l]*v_310_010_2 + 1*oo2p*(v_300_010_1 - v_300_010_2) + 1*oo2p*(v_310_000_1 - v_310_000_2);
+        const double v_210_010_0 = PB[1]*v_210_000_0 - PC1[l]*v_210_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_210_010_1 = PB[1]*v_210_000_1 - PC1[l]*v_210_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_200_010_0 = PB[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_200_010_1 = PB[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_210_020_0 = PB[1]*v_210_010_0 - PC1[l]*v_210_010_1 + 1*oo2p*(v_200_010_0 - v_200_010_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_010_2 = PB[1]*v_210_000_2 - PC1[l]*v_210_000_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_200_010_2 = PB[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_210_020_1 = PB[1]*v_210_010_1 - PC1[l]*v_210_010_2 + 1*oo2p*(v_200_010_1 - v_200_010_2) + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_310_120_0 = PB[0]*v_310_020_0 - PC0[l]*v_310_020_1 + 3*oo2p*(v_210_020_0 - v_210_020_1);
+        const double v_310_110_0 = PB[0]*v_310_010_0 - PC0[l]*v_310_010_1 + 3*oo2p*(v_210_010_0 - v_210_010_1);
+        const double v_310_110_1 = PB[0]*v_310_010_1 - PC0[l]*v_310_010_2 + 3*oo2p*(v_210_010_1 - v_210_010_2);
+        const double v_310_111_0 = PB[2]*v_310_110_0 - PC2[l]*v_310_110_1;
+        const double v_310_001_0 = PB[2]*v_310_000_0 - PC2[l]*v_310_000_1;
+        const double v_310_001_1 = PB[2]*v_310_000_1 - PC2[l]*v_310_000_2;
+        const double v_310_002_0 = PB[2]*v_310_001_0 - PC2[l]*v_310_001_1 + 1*oo2p*(v_310_000_0 - v_310_000_1);
+        const double v_310_001_2 = PB[2]*v_310_000_2 - PC2[l]*v_310_000_3;
+        const double v_310_002_1 = PB[2]*v_310_001_1 - PC2[l]*v_310_001_2 + 1*oo2p*(v_310_000_1 - v_310_000_2);
+        const double v_210_001_0 = PB[2]*v_210_000_0 - PC2[l]*v_210_000_1;
+        const double v_210_001_1 = PB[2]*v_210_000_1 - PC2[l]*v_210_000_2;
+        const double v_210_002_0 = PB[2]*v_210_001_0 - PC2[l]*v_210_001_1 + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_001_2 = PB[2]*v_210_000_2 - PC2[l]*v_210_000_3;
+        const double v_210_002_1 = PB[2]*v_210_001_1 - PC2[l]*v_210_001_2 + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_310_102_0 = PB[0]*v_310_002_0 - PC0[l]*v_310_002_1 + 3*oo2p*(v_210_002_0 - v_210_002_1);
+        const double v_310_030_0 = PB[1]*v_310_020_0 - PC1[l]*v_310_020_1 + 1*oo2p*(v_300_020_0 - v_300_020_1) + 2*oo2p*(v_310_010_0 - v_310_010_1);
+        const double v_310_021_0 = PB[2]*v_310_020_0 - PC2[l]*v_310_020_1;
+        const double v_310_012_0 = PB[1]*v_310_002_0 - PC1[l]*v_310_002_1 + 1*oo2p*(v_300_002_0 - v_300_002_1);
+        const double v_310_003_0 = PB[2]*v_310_002_0 - PC2[l]*v_310_002_1 + 2*oo2p*(v_310_001_0 - v_310_001_1);
+        const double v_301_000_0 = PA[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_301_000_1 = PA[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_201_000_1 = PA[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_301_100_0 = PB[0]*v_301_000_0 - PC0[l]*v_301_000_1 + 3*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_301_000_2 = PA[2]*v_300_000_2 - PC2[l]*v_300_000_3;
+        const double v_201_000_2 = PA[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_301_100_1 = PB[0]*v_301_000_1 - PC0[l]*v_301_000_2 + 3*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_201_100_0 = PB[0]*v_201_000_0 - PC0[l]*v_201_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_101_000_2 = PA[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_201_100_1 = PB[0]*v_201_000_1 - PC0[l]*v_201_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_301_200_0 = PB[0]*v_301_100_0 - PC0[l]*v_301_100_1 + 3*oo2p*(v_201_100_0 - v_201_100_1) + 1*oo2p*(v_301_000_0 - v_301_000_1);
+        const double v_301_000_3 = PA[2]*v_300_000_3 - PC2[l]*v_300_000_4;
+        const double v_201_000_3 = PA[2]*v_200_000_3 - PC2[l]*v_200_000_4;
+        const double v_301_100_2 = PB[0]*v_301_000_2 - PC0[l]*v_301_000_3 + 3*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_101_000_3 = PA[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_201_100_2 = PB[0]*v_201_000_2 - PC0[l]*v_201_000_3 + 2*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_301_200_1 = PB[0]*v_301_100_1 - PC0[l]*v_301_100_2 + 3*oo2p*(v_201_100_1 - v_201_100_2) + 1*oo2p*(v_301_000_1 - v_301_000_2);
+        const double v_101_100_0 = PB[0]*v_101_000_0 - PC0[l]*v_101_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_101_100_1 = PB[0]*v_101_000_1 - PC0[l]*v_101_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_201_200_0 = PB[0]*v_201_100_0 - PC0[l]*v_201_100_1 + 2*oo2p*(v_101_100_0 - v_101_100_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_101_100_2 = PB[0]*v_101_000_2 - PC0[l]*v_101_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_201_200_1 = PB[0]*v_201_100_1 - PC0[l]*v_201_100_2 + 2*oo2p*(v_101_100_1 - v_101_100_2) + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_301_300_0 = PB[0]*v_301_200_0 - PC0[l]*v_301_200_1 + 3*oo2p*(v_201_200_0 - v_201_200_1) + 2*oo2p*(v_301_100_0 - v_301_100_1);
+        const double v_301_210_0 = PB[1]*v_301_200_0 - PC1[l]*v_301_200_1;
+        const double v_301_201_0 = PB[2]*v_301_200_0 - PC2[l]*v_301_200_1 + 1*oo2p*(v_300_200_0 - v_300_200_1);
+        const double v_301_010_0 = PB[1]*v_301_000_0 - PC1[l]*v_301_000_1;
+        const double v_301_010_1 = PB[1]*v_301_000_1 - PC1[l]*v_301_000_2;
+        const double v_301_020_0 = PB[1]*v_301_010_0 - PC1[l]*v_301_010_1 + 1*oo2p*(v_301_000_0 - v_301_000_1);
+        const double v_301_010_2 = PB[1]*v_301_000_2 - PC1[l]*v_301_000_3;
+        const double v_301_020_1 = PB[1]*v_301_010_1 - PC1[l]*v_301_010_2 + 1*oo2p*(v_301_000_1 - v_301_000_2);
+        const double v_201_010_0 = PB[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_201_010_1 = PB[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_201_020_0 = PB[1]*v_201_010_0 - PC1[l]*v_201_010_1 + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_010_2 = PB[1]*v_201_000_2 - PC1[l]*v_201_000_3;
+        const double v_201_020_1 = PB[1]*v_201_010_1 - PC1[l]*v_201_010_2 + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_301_120_0 = PB[0]*v_301_020_0 - PC0[l]*v_301_020_1 + 3*oo2p*(v_201_020_0 - v_201_020_1);
+        const double v_301_001_0 = PB[2]*v_301_000_0 - PC2[l]*v_301_000_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_301_001_1 = PB[2]*v_301_000_1 - PC2[l]*v_301_000_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_201_001_0 = PB[2]*v_201_000_0 - PC2[l]*v_201_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_201_001_1 = PB[2]*v_201_000_1 - PC2[l]*v_201_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_301_101_0 = PB[0]*v_301_001_0 - PC0[l]*v_301_001_1 + 3*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_301_001_2 = PB[2]*v_301_000_2 - PC2[l]*v_301_000_3 + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_201_001_2 = PB[2]*v_201_000_2 - PC2[l]*v_201_000_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_301_101_1 = PB[0]*v_301_001_1 - PC0[l]*v_301_001_2 + 3*oo2p*(v_201_001_1 - v_201_001_2);
+        const double v_301_111_0 = PB[1]*v_301_101_0 - PC1[l]*v_301_101_1;
+        const double v_301_002_0 = PB[2]*v_301_001_0 - PC2[l]*v_301_001_1 + 1*oo2p*(v_300_001_0 - v_300_001_1) + 1*oo2p*(v_301_000_0 - v_301_000_1);
+        const double v_301_002_1 = PB[2]*v_301_001_1 - PC2[l]*v_301_001_2 + 1*oo2p*(v_300_001_1 - v_300_001_2) + 1*oo2p*(v_301_000_1 - v_301_000_2);
+        const double v_200_001_0 = PB[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_200_001_1 = PB[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_201_002_0 = PB[2]*v_201_001_0 - PC2[l]*v_201_001_1 + 1*oo2p*(v_200_001_0 - v_200_001_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_200_001_2 = PB[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_201_002_1 = PB[2]*v_201_001_1 - PC2[l]*v_201_001_2 + 1*oo2p*(v_200_001_1 - v_200_001_2) + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_301_102_0 = PB[0]*v_301_002_0 - PC0[l]*v_301_002_1 + 3*oo2p*(v_201_002_0 - v_201_002_1);
+        const double v_301_030_0 = PB[1]*v_301_020_0 - PC1[l]*v_301_020_1 + 2*oo2p*(v_301_010_0 - v_301_010_1);
+        const double v_301_011_0 = PB[1]*v_301_001_0 - PC1[l]*v_301_001_1;
+        const double v_301_011_1 = PB[1]*v_301_001_1 - PC1[l]*v_301_001_2;
+        const double v_301_021_0 = PB[1]*v_301_011_0 - PC1[l]*v_301_011_1 + 1*oo2p*(v_301_001_0 - v_301_001_1);
+        const double v_301_012_0 = PB[1]*v_301_002_0 - PC1[l]*v_301_002_1;
+        const double v_301_003_0 = PB[2]*v_301_002_0 - PC2[l]*v_301_002_1 + 1*oo2p*(v_300_002_0 - v_300_002_1) + 2*oo2p*(v_301_001_0 - v_301_001_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_120_000_1 = PA[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_220_000_0 = PA[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_000_3 = PA[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_120_000_2 = PA[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_220_000_1 = PA[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_220_100_0 = PB[0]*v_220_000_0 - PC0[l]*v_220_000_1 + 2*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_010_000_5 = PA[1]*v_000_000_5 - PC1[l]*v_000_000_6;
+        const double v_020_000_4 = PA[1]*v_010_000_4 - PC1[l]*v_010_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_120_000_3 = PA[0]*v_020_000_3 - PC0[l]*v_020_000_4;
+        const double v_220_000_2 = PA[0]*v_120_000_2 - PC0[l]*v_120_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_220_100_1 = PB[0]*v_220_000_1 - PC0[l]*v_220_000_2 + 2*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_120_100_0 = PB[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_120_100_1 = PB[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_220_200_0 = PB[0]*v_220_100_0 - PC0[l]*v_220_100_1 + 2*oo2p*(v_120_100_0 - v_120_100_1) + 1*oo2p*(v_220_000_0 - v_220_000_1);
+        const double v_010_000_6 = PA[1]*v_000_000_6 - PC1[l]*v_000_000_7;
+        const double v_020_000_5 = PA[1]*v_010_000_5 - PC1[l]*v_010_000_6 + 1*oo2p*(v_000_000_5 - v_000_000_6);
+        const double v_120_000_4 = PA[0]*v_020_000_4 - PC0[l]*v_020_000_5;
+        const double v_220_000_3 = PA[0]*v_120_000_3 - PC0[l]*v_120_000_4 + 1*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_220_100_2 = PB[0]*v_220_000_2 - PC0[l]*v_220_000_3 + 2*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_120_100_2 = PB[0]*v_120_000_2 - PC0[l]*v_120_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_220_200_1 = PB[0]*v_220_100_1 - PC0[l]*v_220_100_2 + 2*oo2p*(v_120_100_1 - v_120_100_2) + 1*oo2p*(v_220_000_1 - v_220_000_2);
+        const double v_020_100_0 = PB[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_100_1 = PB[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_120_200_0 = PB[0]*v_120_100_0 - PC0[l]*v_120_100_1 + 1*oo2p*(v_020_100_0 - v_020_100_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_020_100_2 = PB[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_120_200_1 = PB[0]*v_120_100_1 - PC0[l]*v_120_100_2 + 1*oo2p*(v_020_100_1 - v_020_100_2) + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_220_300_0 = PB[0]*v_220_200_0 - PC0[l]*v_220_200_1 + 2*oo2p*(v_120_200_0 - v_120_200_1) + 2*oo2p*(v_220_100_0 - v_220_100_1);
+        const double v_220_210_0 = PB[1]*v_220_200_0 - PC1[l]*v_220_200_1 + 2*oo2p*(v_210_200_0 - v_210_200_1);
+        const double v_220_201_0 = PB[2]*v_220_200_0 - PC2[l]*v_220_200_1;
+        const double v_220_010_0 = PB[1]*v_220_000_0 - PC1[l]*v_220_000_1 + 2*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_220_010_1 = PB[1]*v_220_000_1 - PC1[l]*v_220_000_2 + 2*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_220_020_0 = PB[1]*v_220_010_0 - PC1[l]*v_220_010_1 + 2*oo2p*(v_210_010_0 - v_210_010_1) + 1*oo2p*(v_220_000_0 - v_220_000_1);
+        const double v_220_010_2 = PB[1]*v_220_000_2 - PC1[l]*v_220_000_3 + 2*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_220_020_1 = PB[1]*v_220_010_1 - PC1[l]*v_220_010_2 + 2*oo2p*(v_210_010_1 - v_210_010_2) + 1*oo2p*(v_220_000_1 - v_220_000_2);
+        const double v_120_010_0 = PB[1]*v_120_000_0 - PC1[l]*v_120_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_120_010_1 = PB[1]*v_120_000_1 - PC1[l]*v_120_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_110_010_0 = PB[1]*v_110_000_0 - PC1[l]*v_110_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_110_010_1 = PB[1]*v_110_000_1 - PC1[l]*v_110_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_120_020_0 = PB[1]*v_120_010_0 - PC1[l]*v_120_010_1 + 2*oo2p*(v_110_010_0 - v_110_010_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_010_2 = PB[1]*v_120_000_2 - PC1[l]*v_120_000_3 + 2*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_110_010_2 = PB[1]*v_110_000_2 - PC1[l]*v_110_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_120_020_1 = PB[1]*v_120_010_1 - PC1[l]*v_120_010_2 + 2*oo2p*(v_110_010_1 - v_110_010_2) + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_220_120_0 = PB[0]*v_220_020_0 - PC0[l]*v_220_020_1 + 2*oo2p*(v_120_020_0 - v_120_020_1);
+        const double v_220_110_0 = PB[0]*v_220_010_0 - PC0[l]*v_220_010_1 + 2*oo2p*(v_120_010_0 - v_120_010_1);
+        const double v_220_110_1 = PB[0]*v_220_010_1 - PC0[l]*v_220_010_2 + 2*oo2p*(v_120_010_1 - v_120_010_2);
+        const double v_220_111_0 = PB[2]*v_220_110_0 - PC2[l]*v_220_110_1;
+        const double v_220_001_0 = PB[2]*v_220_000_0 - PC2[l]*v_220_000_1;
+        const double v_220_001_1 = PB[2]*v_220_000_1 - PC2[l]*v_220_000_2;
+        const double v_220_002_0 = PB[2]*v_220_001_0 - PC2[l]*v_220_001_1 + 1*oo2p*(v_220_000_0 - v_220_000_1);
+        const double v_220_001_2 = PB[2]*v_220_000_2 - PC2[l]*v_220_000_3;
+        const double v_220_002_1 = PB[2]*v_220_001_1 - PC2[l]*v_220_001_2 + 1*oo2p*(v_220_000_1 - v_220_000_2);
+        const double v_120_001_0 = PB[2]*v_120_000_0 - PC2[l]*v_120_000_1;
+        const double v_120_001_1 = PB[2]*v_120_000_1 - PC2[l]*v_120_000_2;
+        const double v_120_002_0 = PB[2]*v_120_001_0 - PC2[l]*v_120_001_1 + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_001_2 = PB[2]*v_120_000_2 - PC2[l]*v_120_000_3;
+        const double v_120_002_1 = PB[2]*v_120_001_1 - PC2[l]*v_120_001_2 + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_220_102_0 = PB[0]*v_220_002_0 - PC0[l]*v_220_002_1 + 2*oo2p*(v_120_002_0 - v_120_002_1);
+        const double v_220_030_0 = PB[1]*v_220_020_0 - PC1[l]*v_220_020_1 + 2*oo2p*(v_210_020_0 - v_210_020_1) + 2*oo2p*(v_220_010_0 - v_220_010_1);
+        const double v_220_021_0 = PB[2]*v_220_020_0 - PC2[l]*v_220_020_1;
+        const double v_220_012_0 = PB[1]*v_220_002_0 - PC1[l]*v_220_002_1 + 2*oo2p*(v_210_002_0 - v_210_002_1);
+        const double v_220_003_0 = PB[2]*v_220_002_0 - PC2[l]*v_220_002_1 + 2*oo2p*(v_220_001_0 - v_220_001_1);
+        const double v_211_000_0 = PA[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_211_000_1 = PA[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_111_000_0 = PA[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_111_000_1 = PA[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_211_100_0 = PB[0]*v_211_000_0 - PC0[l]*v_211_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_211_000_2 = PA[1]*v_201_000_2 - PC1[l]*v_201_000_3;
+        const double v_011_000_3 = PA[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_111_000_2 = PA[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_211_100_1 = PB[0]*v_211_000_1 - PC0[l]*v_211_000_2 + 2*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_111_100_0 = PB[0]*v_111_000_0 - PC0[l]*v_111_000_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_111_100_1 = PB[0]*v_111_000_1 - PC0[l]*v_111_000_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_211_200_0 = PB[0]*v_211_100_0 - PC0[l]*v_211_100_1 + 2*oo2p*(v_111_100_0 - v_111_100_1) + 1*oo2p*(v_211_000_0 - v_211_000_1);
+        const double v_201_000_4 = PA[2]*v_200_000_4 - PC2[l]*v_200_000_5;
+        const double v_211_000_3 = PA[1]*v_201_000_3 - PC1[l]*v_201_000_4;
+        const double v_001_000_5 = PA[2]*v_000_000_5 - PC2[l]*v_000_000_6;
+        const double v_011_000_4 = PA[1]*v_001_000_4 - PC1[l]*v_001_000_5;
+        const double v_111_000_3 = PA[0]*v_011_000_3 - PC0[l]*v_011_000_4;
+        const double v_211_100_2 = PB[0]*v_211_000_2 - PC0[l]*v_211_000_3 + 2*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_111_100_2 = PB[0]*v_111_000_2 - PC0[l]*v_111_000_3 + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_211_200_1 = PB[0]*v_211_100_1 - PC0[l]*v_211_100_2 + 2*oo2p*(v_111_100_1 - v_111_100_2) + 1*oo2p*(v_211_000_1 - v_211_000_2);
+        const double v_011_100_0 = PB[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_100_1 = PB[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_111_200_0 = PB[0]*v_111_100_0 - PC0[l]*v_111_100_1 + 1*oo2p*(v_011_100_0 - v_011_100_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_011_100_2 = PB[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_111_200_1 = PB[0]*v_111_100_1 - PC0[l]*v_111_100_2 + 1*oo2p*(v_011_100_1 - v_011_100_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_211_300_0 = PB[0]*v_211_200_0 - PC0[l]*v_211_200_1 + 2*oo2p*(v_111_200_0 - v_111_200_1) + 2*oo2p*(v_211_100_0 - v_211_100_1);
+        const double v_211_210_0 = PB[1]*v_211_200_0 - PC1[l]*v_211_200_1 + 1*oo2p*(v_201_200_0 - v_201_200_1);
+        const double v_211_201_0 = PB[2]*v_211_200_0 - PC2[l]*v_211_200_1 + 1*oo2p*(v_210_200_0 - v_210_200_1);
+        const double v_211_010_0 = PB[1]*v_211_000_0 - PC1[l]*v_211_000_1 + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_211_010_1 = PB[1]*v_211_000_1 - PC1[l]*v_211_000_2 + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_211_020_0 = PB[1]*v_211_010_0 - PC1[l]*v_211_010_1 + 1*oo2p*(v_201_010_0 - v_201_010_1) + 1*oo2p*(v_211_000_0 - v_211_000_1);
+        const double v_211_010_2 = PB[1]*v_211_000_2 - PC1[l]*v_211_000_3 + 1*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_211_020_1 = PB[1]*v_211_010_1 - PC1[l]*v_211_010_2 + 1*oo2p*(v_201_010_1 - v_201_010_2) + 1*oo2p*(v_211_000_1 - v_211_000_2);
+        const double v_111_010_0 = PB[1]*v_111_000_0 - PC1[l]*v_111_000_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_111_010_1 = PB[1]*v_111_000_1 - PC1[l]*v_111_000_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_101_010_0 = PB[1]*v_101_000_0 - PC1[l]*v_101_000_1;
+        const double v_101_010_1 = PB[1]*v_101_000_1 - PC1[l]*v_101_000_2;
+        const double v_111_020_0 = PB[1]*v_111_010_0 - PC1[l]*v_111_010_1 + 1*oo2p*(v_101_010_0 - v_101_010_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_111_010_2 = PB[1]*v_111_000_2 - PC1[l]*v_111_000_3 + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_101_010_2 = PB[1]*v_101_000_2 - PC1[l]*v_101_000_3;
+        const double v_111_020_1 = PB[1]*v_111_010_1 - PC1[l]*v_111_010_2 + 1*oo2p*(v_101_010_1 - v_101_010_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_211_120_0 = PB[0]*v_211_020_0 - PC0[l]*v_211_020_1 + 2*oo2p*(v_111_020_0 - v_111_020_1);
+        const double v_211_001_0 = PB[2]*v_211_000_0 - PC2[l]*v_211_000_1 + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_211_001_1 = PB[2]*v_211_000_1 - PC2[l]*v_211_000_2 + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_211_011_0 = PB[1]*v_211_001_0 - PC1[l]*v_211_001_1 + 1*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_211_001_2 = PB[2]*v_211_000_2 - PC2[l]*v_211_000_3 + 1*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_211_011_1 = PB[1]*v_211_001_1 - PC1[l]*v_211_001_2 + 1*oo2p*(v_201_001_1 - v_201_001_2);
+        const double v_111_001_0 = PB[2]*v_111_000_0 - PC2[l]*v_111_000_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_111_001_1 = PB[2]*v_111_000_1 - PC2[l]*v_111_000_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_101_001_0 = PB[2]*v_101_000_0 - PC2[l]*v_101_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_101_001_1 = PB[2]*v_101_000_1 - PC2[l]*v_101_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_111_011_0 = PB[1]*v_111_001_0 - PC1[l]*v_111_001_1 + 1*oo2p*(v_101_001_0 - v_101_001_1);
+        const double v_111_001_2 = PB[2]*v_111_000_2 - PC2[l]*v_111_000_3 + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_101_001_2 = PB[2]*v_101_000_2 - PC2[l]*v_101_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_111_011_1 = PB[1]*v_111_001_1 - PC1[l]*v_111_001_2 + 1*oo2p*(v_101_001_1 - v_101_001_2);
+        const double v_211_111_0 = PB[0]*v_211_011_0 - PC0[l]*v_211_011_1 + 2*oo2p*(v_111_011_0 - v_111_011_1);
+        const double v_211_002_0 = PB[2]*v_211_001_0 - PC2[l]*v_211_001_1 + 1*oo2p*(v_210_001_0 - v_210_001_1) + 1*oo2p*(v_211_000_0 - v_211_000_1);
+        const double v_211_002_1 = PB[2]*v_211_001_1 - PC2[l]*v_211_001_2 + 1*oo2p*(v_210_001_1 - v_210_001_2) + 1*oo2p*(v_211_000_1 - v_211_000_2);
+        const double v_110_001_0 = PB[2]*v_110_000_0 - PC2[l]*v_110_000_1;
+        const double v_110_001_1 = PB[2]*v_110_000_1 - PC2[l]*v_110_000_2;
+        const double v_111_002_0 = PB[2]*v_111_001_0 - PC2[l]*v_111_001_1 + 1*oo2p*(v_110_001_0 - v_110_001_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_110_001_2 = PB[2]*v_110_000_2 - PC2[l]*v_110_000_3;
+        const double v_111_002_1 = PB[2]*v_111_001_1 - PC2[l]*v_111_001_2 + 1*oo2p*(v_110_001_1 - v_110_001_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_211_102_0 = PB[0]*v_211_002_0 - PC0[l]*v_211_002_1 + 2*oo2p*(v_111_002_0 - v_111_002_1);
+        const double v_211_030_0 = PB[1]*v_211_020_0 - PC1[l]*v_211_020_1 + 1*oo2p*(v_201_020_0 - v_201_020_1) + 2*oo2p*(v_211_010_0 - v_211_010_1);
+        const double v_211_021_0 = PB[2]*v_211_020_0 - PC2[l]*v_211_020_1 + 1*oo2p*(v_210_020_0 - v_210_020_1);
+        const double v_211_012_0 = PB[1]*v_211_002_0 - PC1[l]*v_211_002_1 + 1*oo2p*(v_201_002_0 - v_201_002_1);
+        const double v_211_003_0 = PB[2]*v_211_002_0 - PC2[l]*v_211_002_1 + 1*oo2p*(v_210_002_0 - v_210_002_1) + 2*oo2p*(v_211_001_0 - v_211_001_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_102_000_1 = PA[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_202_000_0 = PA[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_000_3 = PA[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_102_000_2 = PA[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_202_000_1 = PA[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_202_100_0 = PB[0]*v_202_000_0 - PC0[l]*v_202_000_1 + 2*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_002_000_4 = PA[2]*v_001_000_4 - PC2[l]*v_001_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_102_000_3 = PA[0]*v_002_000_3 - PC0[l]*v_002_000_4;
+        const double v_202_000_2 = PA[0]*v_102_000_2 - PC0[l]*v_102_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_202_100_1 = PB[0]*v_202_000_1 - PC0[l]*v_202_000_2 + 2*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_102_100_0 = PB[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_102_100_1 = PB[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_202_200_0 = PB[0]*v_202_100_0 - PC0[l]*v_202_100_1 + 2*oo2p*(v_102_100_0 - v_102_100_1) + 1*oo2p*(v_202_000_0 - v_202_000_1);
+        const double v_001_000_6 = PA[2]*v_000_000_6 - PC2[l]*v_000_000_7;
+        const double v_002_000_5 = PA[2]*v_001_000_5 - PC2[l]*v_001_000_6 + 1*oo2p*(v_000_000_5 - v_000_000_6);
+        const double v_102_000_4 = PA[0]*v_002_000_4 - PC0[l]*v_002_000_5;
+        const double v_202_000_3 = PA[0]*v_102_000_3 - PC0[l]*v_102_000_4 + 1*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_202_100_2 = PB[0]*v_202_000_2 - PC0[l]*v_202_000_3 + 2*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_102_100_2 = PB[0]*v_102_000_2 - PC0[l]*v_102_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_202_200_1 = PB[0]*v_202_100_1 - PC0[l]*v_202_100_2 + 2*oo2p*(v_102_100_1 - v_102_100_2) + 1*oo2p*(v_202_000_1 - v_202_000_2);
+        const double v_002_100_0 = PB[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_100_1 = PB[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_102_200_0 = PB[0]*v_102_100_0 - PC0[l]*v_102_100_1 + 1*oo2p*(v_002_100_0 - v_002_100_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_002_100_2 = PB[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_102_200_1 = PB[0]*v_102_100_1 - PC0[l]*v_102_100_2 + 1*oo2p*(v_002_100_1 - v_002_100_2) + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_202_300_0 = PB[0]*v_202_200_0 - PC0[l]*v_202_200_1 + 2*oo2p*(v_102_200_0 - v_102_200_1) + 2*oo2p*(v_202_100_0 - v_202_100_1);
+        const double v_202_210_0 = PB[1]*v_202_200_0 - PC1[l]*v_202_200_1;
+        const double v_202_201_0 = PB[2]*v_202_200_0 - PC2[l]*v_202_200_1 + 2*oo2p*(v_201_200_0 - v_201_200_1);
+        const double v_202_010_0 = PB[1]*v_202_000_0 - PC1[l]*v_202_000_1;
+        const double v_202_010_1 = PB[1]*v_202_000_1 - PC1[l]*v_202_000_2;
+        const double v_202_020_0 = PB[1]*v_202_010_0 - PC1[l]*v_202_010_1 + 1*oo2p*(v_202_000_0 - v_202_000_1);
+        const double v_202_010_2 = PB[1]*v_202_000_2 - PC1[l]*v_202_000_3;
+        const double v_202_020_1 = PB[1]*v_202_010_1 - PC1[l]*v_202_010_2 + 1*oo2p*(v_202_000_1 - v_202_000_2);
+        const double v_102_010_0 = PB[1]*v_102_000_0 - PC1[l]*v_102_000_1;
+        const double v_102_010_1 = PB[1]*v_102_000_1 - PC1[l]*v_102_000_2;
+        const double v_102_020_0 = PB[1]*v_102_010_0 - PC1[l]*v_102_010_1 + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_010_2 = PB[1]*v_102_000_2 - PC1[l]*v_102_000_3;
+        const double v_102_020_1 = PB[1]*v_102_010_1 - PC1[l]*v_102_010_2 + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_202_120_0 = PB[0]*v_202_020_0 - PC0[l]*v_202_020_1 + 2*oo2p*(v_102_020_0 - v_102_020_1);
+        const double v_202_001_0 = PB[2]*v_202_000_0 - PC2[l]*v_202_000_1 + 2*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_202_001_1 = PB[2]*v_202_000_1 - PC2[l]*v_202_000_2 + 2*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_102_001_0 = PB[2]*v_102_000_0 - PC2[l]*v_102_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_102_001_1 = PB[2]*v_102_000_1 - PC2[l]*v_102_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_202_101_0 = PB[0]*v_202_001_0 - PC0[l]*v_202_001_1 + 2*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_202_001_2 = PB[2]*v_202_000_2 - PC2[l]*v_202_000_3 + 2*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_102_001_2 = PB[2]*v_102_000_2 - PC2[l]*v_102_000_3 + 2*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_202_101_1 = PB[0]*v_202_001_1 - PC0[l]*v_202_001_2 + 2*oo2p*(v_102_001_1 - v_102_001_2);
+        const double v_202_111_0 = PB[1]*v_202_101_0 - PC1[l]*v_202_101_1;
+        const double v_202_002_0 = PB[2]*v_202_001_0 - PC2[l]*v_202_001_1 + 2*oo2p*(v_201_001_0 - v_201_001_1) + 1*oo2p*(v_202_000_0 - v_202_000_1);
+        const double v_202_002_1 = PB[2]*v_202_001_1 - PC2[l]*v_202_001_2 + 2*oo2p*(v_201_001_1 - v_201_001_2) + 1*oo2p*(v_202_000_1 - v_202_000_2);
+        const double v_102_002_0 = PB[2]*v_102_001_0 - PC2[l]*v_102_001_1 + 2*oo2p*(v_101_001_0 - v_101_001_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_002_1 = PB[2]*v_102_001_1 - PC2[l]*v_102_001_2 + 2*oo2p*(v_101_001_1 - v_101_001_2) + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_202_102_0 = PB[0]*v_202_002_0 - PC0[l]*v_202_002_1 + 2*oo2p*(v_102_002_0 - v_102_002_1);
+        const double v_202_030_0 = PB[1]*v_202_020_0 - PC1[l]*v_202_020_1 + 2*oo2p*(v_202_010_0 - v_202_010_1);
+        const double v_202_011_0 = PB[1]*v_202_001_0 - PC1[l]*v_202_001_1;
+        const double v_202_011_1 = PB[1]*v_202_001_1 - PC1[l]*v_202_001_2;
+        const double v_202_021_0 = PB[1]*v_202_011_0 - PC1[l]*v_202_011_1 + 1*oo2p*(v_202_001_0 - v_202_001_1);
+        const double v_202_012_0 = PB[1]*v_202_002_0 - PC1[l]*v_202_002_1;
+        const double v_202_003_0 = PB[2]*v_202_002_0 - PC2[l]*v_202_002_1 + 2*oo2p*(v_201_002_0 - v_201_002_1) + 2*oo2p*(v_202_001_0 - v_202_001_1);
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_030_000_1 = PA[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_130_000_0 = PA[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_000_2 = PA[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_130_000_1 = PA[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_130_100_0 = PB[0]*v_130_000_0 - PC0[l]*v_130_000_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_000_3 = PA[1]*v_020_000_3 - PC1[l]*v_020_000_4 + 2*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_130_000_2 = PA[0]*v_030_000_2 - PC0[l]*v_030_000_3;
+        const double v_130_100_1 = PB[0]*v_130_000_1 - PC0[l]*v_130_000_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_030_100_0 = PB[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_100_1 = PB[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_130_200_0 = PB[0]*v_130_100_0 - PC0[l]*v_130_100_1 + 1*oo2p*(v_030_100_0 - v_030_100_1) + 1*oo2p*(v_130_000_0 - v_130_000_1);
+        const double v_030_000_4 = PA[1]*v_020_000_4 - PC1[l]*v_020_000_5 + 2*oo2p*(v_010_000_4 - v_010_000_5);
+        const double v_130_000_3 = PA[0]*v_030_000_3 - PC0[l]*v_030_000_4;
+        const double v_130_100_2 = PB[0]*v_130_000_2 - PC0[l]*v_130_000_3 + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_030_100_2 = PB[0]*v_030_000_2 - PC0[l]*v_030_000_3;
+        const double v_130_200_1 = PB[0]*v_130_100_1 - PC0[l]*v_130_100_2 + 1*oo2p*(v_030_100_1 - v_030_100_2) + 1*oo2p*(v_130_000_1 - v_130_000_2);
+        const double v_030_200_0 = PB[0]*v_030_100_0 - PC0[l]*v_030_100_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_200_1 = PB[0]*v_030_100_1 - PC0[l]*v_030_100_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_130_300_0 = PB[0]*v_130_200_0 - PC0[l]*v_130_200_1 + 1*oo2p*(v_030_200_0 - v_030_200_1) + 2*oo2p*(v_130_100_0 - v_130_100_1);
+        const double v_130_210_0 = PB[1]*v_130_200_0 - PC1[l]*v_130_200_1 + 3*oo2p*(v_120_200_0 - v_120_200_1);
+        const double v_130_201_0 = PB[2]*v_130_200_0 - PC2[l]*v_130_200_1;
+        const double v_130_010_0 = PB[1]*v_130_000_0 - PC1[l]*v_130_000_1 + 3*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_130_010_1 = PB[1]*v_130_000_1 - PC1[l]*v_130_000_2 + 3*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_130_020_0 = PB[1]*v_130_010_0 - PC1[l]*v_130_010_1 + 3*oo2p*(v_120_010_0 - v_120_010_1) + 1*oo2p*(v_130_000_0 - v_130_000_1);
+        const double v_130_010_2 = PB[1]*v_130_000_2 - PC1[l]*v_130_000_3 + 3*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_130_020_1 = PB[1]*v_130_010_1 - PC1[l]*v_130_010_2 + 3*oo2p*(v_120_010_1 - v_120_010_2) + 1*oo2p*(v_130_000_1 - v_130_000_2);
+        const double v_030_010_0 = PB[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_030_010_1 = PB[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_020_010_0 = PB[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_020_010_1 = PB[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_030_020_0 = PB[1]*v_030_010_0 - PC1[l]*v_030_010_1 + 3*oo2p*(v_020_010_0 - v_020_010_1) + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_010_2 = PB[1]*v_030_000_2 - PC1[l]*v_030_000_3 + 3*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_020_010_2 = PB[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_030_020_1 = PB[1]*v_030_010_1 - PC1[l]*v_030_010_2 + 3*oo2p*(v_020_010_1 - v_020_010_2) + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_130_120_0 = PB[0]*v_130_020_0 - PC0[l]*v_130_020_1 + 1*oo2p*(v_030_020_0 - v_030_020_1);
+        const double v_130_110_0 = PB[0]*v_130_010_0 - PC0[l]*v_130_010_1 + 1*oo2p*(v_030_010_0 - v_030_010_1);
+        const double v_130_110_1 = PB[0]*v_130_010_1 - PC0[l]*v_130_010_2 + 1*oo2p*(v_030_010_1 - v_030_010_2);
+        const double v_130_111_0 = PB[2]*v_130_110_0 - PC2[l]*v_130_110_1;
+        const double v_130_001_0 = PB[2]*v_130_000_0 - PC2[l]*v_130_000_1;
+        const double v_130_001_1 = PB[2]*v_130_000_1 - PC2[l]*v_130_000_2;
+        const double v_130_002_0 = PB[2]*v_130_001_0 - PC2[l]*v_130_001_1 + 1*oo2p*(v_130_000_0 - v_130_000_1);
+        const double v_130_001_2 = PB[2]*v_130_000_2 - PC2[l]*v_130_000_3;
+        const double v_130_002_1 = PB[2]*v_130_001_1 - PC2[l]*v_130_001_2 + 1*oo2p*(v_130_000_1 - v_130_000_2);
+        const double v_030_001_0 = PB[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_030_001_1 = PB[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_030_002_0 = PB[2]*v_030_001_0 - PC2[l]*v_030_001_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_001_2 = PB[2]*v_030_000_2 - PC2[l]*v_030_000_3;
+        const double v_030_002_1 = PB[2]*v_030_001_1 - PC2[l]*v_030_001_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_130_102_0 = PB[0]*v_130_002_0 - PC0[l]*v_130_002_1 + 1*oo2p*(v_030_002_0 - v_030_002_1);
+        const double v_130_030_0 = PB[1]*v_130_020_0 - PC1[l]*v_130_020_1 + 3*oo2p*(v_120_020_0 - v_120_020_1) + 2*oo2p*(v_130_010_0 - v_130_010_1);
+        const double v_130_021_0 = PB[2]*v_130_020_0 - PC2[l]*v_130_020_1;
+        const double v_130_012_0 = PB[1]*v_130_002_0 - PC1[l]*v_130_002_1 + 3*oo2p*(v_120_002_0 - v_120_002_1);
+        const double v_130_003_0 = PB[2]*v_130_002_0 - PC2[l]*v_130_002_1 + 2*oo2p*(v_130_001_0 - v_130_001_1);
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_021_000_1 = PA[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_121_000_0 = PA[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_000_2 = PA[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_121_000_1 = PA[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_121_100_0 = PB[0]*v_121_000_0 - PC0[l]*v_121_000_1 + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_000_3 = PA[2]*v_020_000_3 - PC2[l]*v_020_000_4;
+        const double v_121_000_2 = PA[0]*v_021_000_2 - PC0[l]*v_021_000_3;
+        const double v_121_100_1 = PB[0]*v_121_000_1 - PC0[l]*v_121_000_2 + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_021_100_0 = PB[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_100_1 = PB[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_121_200_0 = PB[0]*v_121_100_0 - PC0[l]*v_121_100_1 + 1*oo2p*(v_021_100_0 - v_021_100_1) + 1*oo2p*(v_121_000_0 - v_121_000_1);
+        const double v_021_000_4 = PA[2]*v_020_000_4 - PC2[l]*v_020_000_5;
+        const double v_121_000_3 = PA[0]*v_021_000_3 - PC0[l]*v_021_000_4;
+        const double v_121_100_2 = PB[0]*v_121_000_2 - PC0[l]*v_121_000_3 + 1*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_021_100_2 = PB[0]*v_021_000_2 - PC0[l]*v_021_000_3;
+        const double v_121_200_1 = PB[0]*v_121_100_1 - PC0[l]*v_121_100_2 + 1*oo2p*(v_021_100_1 - v_021_100_2) + 1*oo2p*(v_121_000_1 - v_121_000_2);
+        const double v_021_200_0 = PB[0]*v_021_100_0 - PC0[l]*v_021_100_1 + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_200_1 = PB[0]*v_021_100_1 - PC0[l]*v_021_100_2 + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_121_300_0 = PB[0]*v_121_200_0 - PC0[l]*v_121_200_1 + 1*oo2p*(v_021_200_0 - v_021_200_1) + 2*oo2p*(v_121_100_0 - v_121_100_1);
+        const double v_121_210_0 = PB[1]*v_121_200_0 - PC1[l]*v_121_200_1 + 2*oo2p*(v_111_200_0 - v_111_200_1);
+        const double v_121_201_0 = PB[2]*v_121_200_0 - PC2[l]*v_121_200_1 + 1*oo2p*(v_120_200_0 - v_120_200_1);
+        const double v_121_010_0 = PB[1]*v_121_000_0 - PC1[l]*v_121_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_121_010_1 = PB[1]*v_121_000_1 - PC1[l]*v_121_000_2 + 2*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_121_020_0 = PB[1]*v_121_010_0 - PC1[l]*v_121_010_1 + 2*oo2p*(v_111_010_0 - v_111_010_1) + 1*oo2p*(v_121_000_0 - v_121_000_1);
+        const double v_121_010_2 = PB[1]*v_121_000_2 - PC1[l]*v_121_000_3 + 2*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_121_020_1 = PB[1]*v_121_010_1 - PC1[l]*v_121_010_2 + 2*oo2p*(v_111_010_1 - v_111_010_2) + 1*oo2p*(v_121_000_1 - v_121_000_2);
+        const double v_021_010_0 = PB[1]*v_021_000_0 - PC1[l]*v_021_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_021_010_1 = PB[1]*v_021_000_1 - PC1[l]*v_021_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_011_010_0 = PB[1]*v_011_000_0 - PC1[l]*v_011_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_011_010_1 = PB[1]*v_011_000_1 - PC1[l]*v_011_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_021_020_0 = PB[1]*v_021_010_0 - PC1[l]*v_021_010_1 + 2*oo2p*(v_011_010_0 - v_011_010_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_010_2 = PB[1]*v_021_000_2 - PC1[l]*v_021_000_3 + 2*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_011_010_2 = PB[1]*v_011_000_2 - PC1[l]*v_011_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_021_020_1 = PB[1]*v_021_010_1 - PC1[l]*v_021_010_2 + 2*oo2p*(v_011_010_1 - v_011_010_2) + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_121_120_0 = PB[0]*v_121_020_0 - PC0[l]*v_121_020_1 + 1*oo2p*(v_021_020_0 - v_021_020_1);
+        const double v_121_001_0 = PB[2]*v_121_000_0 - PC2[l]*v_121_000_1 + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_121_001_1 = PB[2]*v_121_000_1 - PC2[l]*v_121_000_2 + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_121_011_0 = PB[1]*v_121_001_0 - PC1[l]*v_121_001_1 + 2*oo2p*(v_111_001_0 - v_111_001_1);
+        const double v_121_001_2 = PB[2]*v_121_000_2 - PC2[l]*v_121_000_3 + 1*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_121_011_1 = PB[1]*v_121_001_1 - PC1[l]*v_121_001_2 + 2*oo2p*(v_111_001_1 - v_111_001_2);
+        const double v_021_001_0 = PB[2]*v_021_000_0 - PC2[l]*v_021_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_021_001_1 = PB[2]*v_021_000_1 - PC2[l]*v_021_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_011_001_0 = PB[2]*v_011_000_0 - PC2[l]*v_011_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_011_001_1 = PB[2]*v_011_000_1 - PC2[l]*v_011_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_021_011_0 = PB[1]*v_021_001_0 - PC1[l]*v_021_001_1 + 2*oo2p*(v_011_001_0 - v_011_001_1);
+        const double v_021_001_2 = PB[2]*v_021_000_2 - PC2[l]*v_021_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_011_001_2 = PB[2]*v_011_000_2 - PC2[l]*v_011_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_021_011_1 = PB[1]*v_021_001_1 - PC1[l]*v_021_001_2 + 2*oo2p*(v_011_001_1 - v_011_001_2);
+        const double v_121_111_0 = PB[0]*v_121_011_0 - PC0[l]*v_121_011_1 + 1*oo2p*(v_021_011_0 - v_021_011_1);
+        const double v_121_002_0 = PB[2]*v_121_001_0 - PC2[l]*v_121_001_1 + 1*oo2p*(v_120_001_0 - v_120_001_1) + 1*oo2p*(v_121_000_0 - v_121_000_1);
+        const double v_121_002_1 = PB[2]*v_121_001_1 - PC2[l]*v_121_001_2 + 1*oo2p*(v_120_001_1 - v_120_001_2) + 1*oo2p*(v_121_000_1 - v_121_000_2);
+        const double v_020_001_0 = PB[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_020_001_1 = PB[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_021_002_0 = PB[2]*v_021_001_0 - PC2[l]*v_021_001_1 + 1*oo2p*(v_020_001_0 - v_020_001_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_020_001_2 = PB[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_021_002_1 = PB[2]*v_021_001_1 - PC2[l]*v_021_001_2 + 1*oo2p*(v_020_001_1 - v_020_001_2) + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_121_102_0 = PB[0]*v_121_002_0 - PC0[l]*v_121_002_1 + 1*oo2p*(v_021_002_0 - v_021_002_1);
+        const double v_121_030_0 = PB[1]*v_121_020_0 - PC1[l]*v_121_020_1 + 2*oo2p*(v_111_020_0 - v_111_020_1) + 2*oo2p*(v_121_010_0 - v_121_010_1);
+        const double v_121_021_0 = PB[2]*v_121_020_0 - PC2[l]*v_121_020_1 + 1*oo2p*(v_120_020_0 - v_120_020_1);
+        const double v_121_012_0 = PB[1]*v_121_002_0 - PC1[l]*v_121_002_1 + 2*oo2p*(v_111_002_0 - v_111_002_1);
+        const double v_121_003_0 = PB[2]*v_121_002_0 - PC2[l]*v_121_002_1 + 1*oo2p*(v_120_002_0 - v_120_002_1) + 2*oo2p*(v_121_001_0 - v_121_001_1);
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_012_000_1 = PA[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_112_000_0 = PA[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_000_2 = PA[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_112_000_1 = PA[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_112_100_0 = PB[0]*v_112_000_0 - PC0[l]*v_112_000_1 + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_000_3 = PA[1]*v_002_000_3 - PC1[l]*v_002_000_4;
+        const double v_112_000_2 = PA[0]*v_012_000_2 - PC0[l]*v_012_000_3;
+        const double v_112_100_1 = PB[0]*v_112_000_1 - PC0[l]*v_112_000_2 + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_012_100_0 = PB[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_100_1 = PB[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_112_200_0 = PB[0]*v_112_100_0 - PC0[l]*v_112_100_1 + 1*oo2p*(v_012_100_0 - v_012_100_1) + 1*oo2p*(v_112_000_0 - v_112_000_1);
+        const double v_012_000_4 = PA[1]*v_002_000_4 - PC1[l]*v_002_000_5;
+        const double v_112_000_3 = PA[0]*v_012_000_3 - PC0[l]*v_012_000_4;
+        const double v_112_100_2 = PB[0]*v_112_000_2 - PC0[l]*v_112_000_3 + 1*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_012_100_2 = PB[0]*v_012_000_2 - PC0[l]*v_012_000_3;
+        const double v_112_200_1 = PB[0]*v_112_100_1 - PC0[l]*v_112_100_2 + 1*oo2p*(v_012_100_1 - v_012_100_2) + 1*oo2p*(v_112_000_1 - v_112_000_2);
+        const double v_012_200_0 = PB[0]*v_012_100_0 - PC0[l]*v_012_100_1 + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_200_1 = PB[0]*v_012_100_1 - PC0[l]*v_012_100_2 + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_112_300_0 = PB[0]*v_112_200_0 - PC0[l]*v_112_200_1 + 1*oo2p*(v_012_200_0 - v_012_200_1) + 2*oo2p*(v_112_100_0 - v_112_100_1);
+        const double v_112_210_0 = PB[1]*v_112_200_0 - PC1[l]*v_112_200_1 + 1*oo2p*(v_102_200_0 - v_102_200_1);
+        const double v_112_201_0 = PB[2]*v_112_200_0 - PC2[l]*v_112_200_1 + 2*oo2p*(v_111_200_0 - v_111_200_1);
+        const double v_112_010_0 = PB[1]*v_112_000_0 - PC1[l]*v_112_000_1 + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_112_010_1 = PB[1]*v_112_000_1 - PC1[l]*v_112_000_2 + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_112_020_0 = PB[1]*v_112_010_0 - PC1[l]*v_112_010_1 + 1*oo2p*(v_102_010_0 - v_102_010_1) + 1*oo2p*(v_112_000_0 - v_112_000_1);
+        const double v_112_010_2 = PB[1]*v_112_000_2 - PC1[l]*v_112_000_3 + 1*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_112_020_1 = PB[1]*v_112_010_1 - PC1[l]*v_112_010_2 + 1*oo2p*(v_102_010_1 - v_102_010_2) + 1*oo2p*(v_112_000_1 - v_112_000_2);
+        const double v_012_010_0 = PB[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_012_010_1 = PB[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_010_0 = PB[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_002_010_1 = PB[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_012_020_0 = PB[1]*v_012_010_0 - PC1[l]*v_012_010_1 + 1*oo2p*(v_002_010_0 - v_002_010_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_010_2 = PB[1]*v_012_000_2 - PC1[l]*v_012_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_002_010_2 = PB[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_012_020_1 = PB[1]*v_012_010_1 - PC1[l]*v_012_010_2 + 1*oo2p*(v_002_010_1 - v_002_010_2) + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_112_120_0 = PB[0]*v_112_020_0 - PC0[l]*v_112_020_1 + 1*oo2p*(v_012_020_0 - v_012_020_1);
+        const double v_112_001_0 = PB[2]*v_112_000_0 - PC2[l]*v_112_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_112_001_1 = PB[2]*v_112_000_1 - PC2[l]*v_112_000_2 + 2*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_112_011_0 = PB[1]*v_112_001_0 - PC1[l]*v_112_001_1 + 1*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_112_001_2 = PB[2]*v_112_000_2 - PC2[l]*v_112_000_3 + 2*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_112_011_1 = PB[1]*v_112_001_1 - PC1[l]*v_112_001_2 + 1*oo2p*(v_102_001_1 - v_102_001_2);
+        const double v_012_001_0 = PB[2]*v_012_000_0 - PC2[l]*v_012_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_012_001_1 = PB[2]*v_012_000_1 - PC2[l]*v_012_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_002_001_0 = PB[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_002_001_1 = PB[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_012_011_0 = PB[1]*v_012_001_0 - PC1[l]*v_012_001_1 + 1*oo2p*(v_002_001_0 - v_002_001_1);
+        const double v_012_001_2 = PB[2]*v_012_000_2 - PC2[l]*v_012_000_3 + 2*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_002_001_2 = PB[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_012_011_1 = PB[1]*v_012_001_1 - PC1[l]*v_012_001_2 + 1*oo2p*(v_002_001_1 - v_002_001_2);
+        const double v_112_111_0 = PB[0]*v_112_011_0 - PC0[l]*v_112_011_1 + 1*oo2p*(v_012_011_0 - v_012_011_1);
+        const double v_112_002_0 = PB[2]*v_112_001_0 - PC2[l]*v_112_001_1 + 2*oo2p*(v_111_001_0 - v_111_001_1) + 1*oo2p*(v_112_000_0 - v_112_000_1);
+        const double v_112_002_1 = PB[2]*v_112_001_1 - PC2[l]*v_112_001_2 + 2*oo2p*(v_111_001_1 - v_111_001_2) + 1*oo2p*(v_112_000_1 - v_112_000_2);
+        const double v_012_002_0 = PB[2]*v_012_001_0 - PC2[l]*v_012_001_1 + 2*oo2p*(v_011_001_0 - v_011_001_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_002_1 = PB[2]*v_012_001_1 - PC2[l]*v_012_001_2 + 2*oo2p*(v_011_001_1 - v_011_001_2) + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_112_102_0 = PB[0]*v_112_002_0 - PC0[l]*v_112_002_1 + 1*oo2p*(v_012_002_0 - v_012_002_1);
+        const double v_112_030_0 = PB[1]*v_112_020_0 - PC1[l]*v_112_020_1 + 1*oo2p*(v_102_020_0 - v_102_020_1) + 2*oo2p*(v_112_010_0 - v_112_010_1);
+        const double v_112_021_0 = PB[2]*v_112_020_0 - PC2[l]*v_112_020_1 + 2*oo2p*(v_111_020_0 - v_111_020_1);
+        const double v_112_012_0 = PB[1]*v_112_002_0 - PC1[l]*v_112_002_1 + 1*oo2p*(v_102_002_0 - v_102_002_1);
+        const double v_112_003_0 = PB[2]*v_112_002_0 - PC2[l]*v_112_002_1 + 2*oo2p*(v_111_002_0 - v_111_002_1) + 2*oo2p*(v_112_001_0 - v_112_001_1);
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_003_000_1 = PA[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_103_000_0 = PA[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_000_2 = PA[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_103_000_1 = PA[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_103_100_0 = PB[0]*v_103_000_0 - PC0[l]*v_103_000_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_000_3 = PA[2]*v_002_000_3 - PC2[l]*v_002_000_4 + 2*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_103_000_2 = PA[0]*v_003_000_2 - PC0[l]*v_003_000_3;
+        const double v_103_100_1 = PB[0]*v_103_000_1 - PC0[l]*v_103_000_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_100_0 = PB[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_100_1 = PB[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_103_200_0 = PB[0]*v_103_100_0 - PC0[l]*v_103_100_1 + 1*oo2p*(v_003_100_0 - v_003_100_1) + 1*oo2p*(v_103_000_0 - v_103_000_1);
+        const double v_003_000_4 = PA[2]*v_002_000_4 - PC2[l]*v_002_000_5 + 2*oo2p*(v_001_000_4 - v_001_000_5);
+        const double v_103_000_3 = PA[0]*v_003_000_3 - PC0[l]*v_003_000_4;
+        const double v_103_100_2 = PB[0]*v_103_000_2 - PC0[l]*v_103_000_3 + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_003_100_2 = PB[0]*v_003_000_2 - PC0[l]*v_003_000_3;
+        const double v_103_200_1 = PB[0]*v_103_100_1 - PC0[l]*v_103_100_2 + 1*oo2p*(v_003_100_1 - v_003_100_2) + 1*oo2p*(v_103_000_1 - v_103_000_2);
+        const double v_003_200_0 = PB[0]*v_003_100_0 - PC0[l]*v_003_100_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_200_1 = PB[0]*v_003_100_1 - PC0[l]*v_003_100_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_103_300_0 = PB[0]*v_103_200_0 - PC0[l]*v_103_200_1 + 1*oo2p*(v_003_200_0 - v_003_200_1) + 2*oo2p*(v_103_100_0 - v_103_100_1);
+        const double v_103_210_0 = PB[1]*v_103_200_0 - PC1[l]*v_103_200_1;
+        const double v_103_201_0 = PB[2]*v_103_200_0 - PC2[l]*v_103_200_1 + 3*oo2p*(v_102_200_0 - v_102_200_1);
+        const double v_103_010_0 = PB[1]*v_103_000_0 - PC1[l]*v_103_000_1;
+        const double v_103_010_1 = PB[1]*v_103_000_1 - PC1[l]*v_103_000_2;
+        const double v_103_020_0 = PB[1]*v_103_010_0 - PC1[l]*v_103_010_1 + 1*oo2p*(v_103_000_0 - v_103_000_1);
+        const double v_103_010_2 = PB[1]*v_103_000_2 - PC1[l]*v_103_000_3;
+        const double v_103_020_1 = PB[1]*v_103_010_1 - PC1[l]*v_103_010_2 + 1*oo2p*(v_103_000_1 - v_103_000_2);
+        const double v_003_010_0 = PB[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_003_010_1 = PB[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_003_020_0 = PB[1]*v_003_010_0 - PC1[l]*v_003_010_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_010_2 = PB[1]*v_003_000_2 - PC1[l]*v_003_000_3;
+        const double v_003_020_1 = PB[1]*v_003_010_1 - PC1[l]*v_003_010_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_103_120_0 = PB[0]*v_103_020_0 - PC0[l]*v_103_020_1 + 1*oo2p*(v_003_020_0 - v_003_020_1);
+        const double v_103_001_0 = PB[2]*v_103_000_0 - PC2[l]*v_103_000_1 + 3*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_103_001_1 = PB[2]*v_103_000_1 - PC2[l]*v_103_000_2 + 3*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_003_001_0 = PB[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_003_001_1 = PB[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_103_101_0 = PB[0]*v_103_001_0 - PC0[l]*v_103_001_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_103_001_2 = PB[2]*v_103_000_2 - PC2[l]*v_103_000_3 + 3*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_003_001_2 = PB[2]*v_003_000_2 - PC2[l]*v_003_000_3 + 3*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_103_101_1 = PB[0]*v_103_001_1 - PC0[l]*v_103_001_2 + 1*oo2p*(v_003_001_1 - v_003_001_2);
+        const double v_103_111_0 = PB[1]*v_103_101_0 - PC1[l]*v_103_101_1;
+        const double v_103_002_0 = PB[2]*v_103_001_0 - PC2[l]*v_103_001_1 + 3*oo2p*(v_102_001_0 - v_102_001_1) + 1*oo2p*(v_103_000_0 - v_103_000_1);
+        const double v_103_002_1 = PB[2]*v_103_001_1 - PC2[l]*v_103_001_2 + 3*oo2p*(v_102_001_1 - v_102_001_2) + 1*oo2p*(v_103_000_1 - v_103_000_2);
+        const double v_003_002_0 = PB[2]*v_003_001_0 - PC2[l]*v_003_001_1 + 3*oo2p*(v_002_001_0 - v_002_001_1) + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_002_1 = PB[2]*v_003_001_1 - PC2[l]*v_003_001_2 + 3*oo2p*(v_002_001_1 - v_002_001_2) + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_103_102_0 = PB[0]*v_103_002_0 - PC0[l]*v_103_002_1 + 1*oo2p*(v_003_002_0 - v_003_002_1);
+        const double v_103_030_0 = PB[1]*v_103_020_0 - PC1[l]*v_103_020_1 + 2*oo2p*(v_103_010_0 - v_103_010_1);
+        const double v_103_011_0 = PB[1]*v_103_001_0 - PC1[l]*v_103_001_1;
+        const double v_103_011_1 = PB[1]*v_103_001_1 - PC1[l]*v_103_001_2;
+        const double v_103_021_0 = PB[1]*v_103_011_0 - PC1[l]*v_103_011_1 + 1*oo2p*(v_103_001_0 - v_103_001_1);
+        const double v_103_012_0 = PB[1]*v_103_002_0 - PC1[l]*v_103_002_1;
+        const double v_103_003_0 = PB[2]*v_103_002_0 - PC2[l]*v_103_002_1 + 3*oo2p*(v_102_002_0 - v_102_002_1) + 2*oo2p*(v_103_001_0 - v_103_001_1);
+        const double v_040_000_0 = PA[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_040_000_1 = PA[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_040_100_0 = PB[0]*v_040_000_0 - PC0[l]*v_040_000_1;
+        const double v_040_000_2 = PA[1]*v_030_000_2 - PC1[l]*v_030_000_3 + 3*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_040_100_1 = PB[0]*v_040_000_1 - PC0[l]*v_040_000_2;
+        const double v_040_200_0 = PB[0]*v_040_100_0 - PC0[l]*v_040_100_1 + 1*oo2p*(v_040_000_0 - v_040_000_1);
+        const double v_040_000_3 = PA[1]*v_030_000_3 - PC1[l]*v_030_000_4 + 3*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_040_100_2 = PB[0]*v_040_000_2 - PC0[l]*v_040_000_3;
+        const double v_040_200_1 = PB[0]*v_040_100_1 - PC0[l]*v_040_100_2 + 1*oo2p*(v_040_000_1 - v_040_000_2);
+        const double v_040_300_0 = PB[0]*v_040_200_0 - PC0[l]*v_040_200_1 + 2*oo2p*(v_040_100_0 - v_040_100_1);
+        const double v_040_010_0 = PB[1]*v_040_000_0 - PC1[l]*v_040_000_1 + 4*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_040_010_1 = PB[1]*v_040_000_1 - PC1[l]*v_040_000_2 + 4*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_040_110_0 = PB[0]*v_040_010_0 - PC0[l]*v_040_010_1;
+        const double v_040_010_2 = PB[1]*v_040_000_2 - PC1[l]*v_040_000_3 + 4*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_040_110_1 = PB[0]*v_040_010_1 - PC0[l]*v_040_010_2;
+        const double v_040_210_0 = PB[0]*v_040_110_0 - PC0[l]*v_040_110_1 + 1*oo2p*(v_040_010_0 - v_040_010_1);
+        const double v_040_201_0 = PB[2]*v_040_200_0 - PC2[l]*v_040_200_1;
+        const double v_040_020_0 = PB[1]*v_040_010_0 - PC1[l]*v_040_010_1 + 4*oo2p*(v_030_010_0 - v_030_010_1) + 1*oo2p*(v_040_000_0 - v_040_000_1);
+        const double v_040_020_1 = PB[1]*v_040_010_1 - PC1[l]*v_040_010_2 + 4*oo2p*(v_030_010_1 - v_030_010_2) + 1*oo2p*(v_040_000_1 - v_040_000_2);
+        const double v_040_120_0 = PB[0]*v_040_020_0 - PC0[l]*v_040_020_1;
+        const double v_040_011_0 = PB[2]*v_040_010_0 - PC2[l]*v_040_010_1;
+        const double v_040_011_1 = PB[2]*v_040_010_1 - PC2[l]*v_040_010_2;
+        const double v_040_111_0 = PB[0]*v_040_011_0 - PC0[l]*v_040_011_1;
+        const double v_040_001_0 = PB[2]*v_040_000_0 - PC2[l]*v_040_000_1;
+        const double v_040_001_1 = PB[2]*v_040_000_1 - PC2[l]*v_040_000_2;
+        const double v_040_002_0 = PB[2]*v_040_001_0 - PC2[l]*v_040_001_1 + 1*oo2p*(v_040_000_0 - v_040_000_1);
+        const double v_040_001_2 = PB[2]*v_040_000_2 - PC2[l]*v_040_000_3;
+        const double v_040_002_1 = PB[2]*v_040_001_1 - PC2[l]*v_040_001_2 + 1*oo2p*(v_040_000_1 - v_040_000_2);
+        const double v_040_102_0 = PB[0]*v_040_002_0 - PC0[l]*v_040_002_1;
+        const double v_040_030_0 = PB[1]*v_040_020_0 - PC1[l]*v_040_020_1 + 4*oo2p*(v_030_020_0 - v_030_020_1) + 2*oo2p*(v_040_010_0 - v_040_010_1);
+        const double v_040_021_0 = PB[2]*v_040_020_0 - PC2[l]*v_040_020_1;
+        const double v_040_012_0 = PB[1]*v_040_002_0 - PC1[l]*v_040_002_1 + 4*oo2p*(v_030_002_0 - v_030_002_1);
+        const double v_040_003_0 = PB[2]*v_040_002_0 - PC2[l]*v_040_002_1 + 2*oo2p*(v_040_001_0 - v_040_001_1);
+        const double v_031_000_0 = PA[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_031_000_1 = PA[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_031_100_0 = PB[0]*v_031_000_0 - PC0[l]*v_031_000_1;
+        const double v_031_000_2 = PA[2]*v_030_000_2 - PC2[l]*v_030_000_3;
+        const double v_031_100_1 = PB[0]*v_031_000_1 - PC0[l]*v_031_000_2;
+        const double v_031_200_0 = PB[0]*v_031_100_0 - PC0[l]*v_031_100_1 + 1*oo2p*(v_031_000_0 - v_031_000_1);
+        const double v_031_000_3 = PA[2]*v_030_000_3 - PC2[l]*v_030_000_4;
+        const double v_031_100_2 = PB[0]*v_031_000_2 - PC0[l]*v_031_000_3;
+        const double v_031_200_1 = PB[0]*v_031_100_1 - PC0[l]*v_031_100_2 + 1*oo2p*(v_031_000_1 - v_031_000_2);
+        const double v_031_300_0 = PB[0]*v_031_200_0 - PC0[l]*v_031_200_1 + 2*oo2p*(v_031_100_0 - v_031_100_1);
+        const double v_031_010_0 = PB[1]*v_031_000_0 - PC1[l]*v_031_000_1 + 3*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_031_010_1 = PB[1]*v_031_000_1 - PC1[l]*v_031_000_2 + 3*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_031_110_0 = PB[0]*v_031_010_0 - PC0[l]*v_031_010_1;
+        const double v_031_010_2 = PB[1]*v_031_000_2 - PC1[l]*v_031_000_3 + 3*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_031_110_1 = PB[0]*v_031_010_1 - PC0[l]*v_031_010_2;
+        const double v_031_210_0 = PB[0]*v_031_110_0 - PC0[l]*v_031_110_1 + 1*oo2p*(v_031_010_0 - v_031_010_1);
+        const double v_031_001_0 = PB[2]*v_031_000_0 - PC2[l]*v_031_000_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_031_001_1 = PB[2]*v_031_000_1 - PC2[l]*v_031_000_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_031_101_0 = PB[0]*v_031_001_0 - PC0[l]*v_031_001_1;
+        const double v_031_001_2 = PB[2]*v_031_000_2 - PC2[l]*v_031_000_3 + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_031_101_1 = PB[0]*v_031_001_1 - PC0[l]*v_031_001_2;
+        const double v_031_201_0 = PB[0]*v_031_101_0 - PC0[l]*v_031_101_1 + 1*oo2p*(v_031_001_0 - v_031_001_1);
+        const double v_031_020_0 = PB[1]*v_031_010_0 - PC1[l]*v_031_010_1 + 3*oo2p*(v_021_010_0 - v_021_010_1) + 1*oo2p*(v_031_000_0 - v_031_000_1);
+        const double v_031_020_1 = PB[1]*v_031_010_1 - PC1[l]*v_031_010_2 + 3*oo2p*(v_021_010_1 - v_021_010_2) + 1*oo2p*(v_031_000_1 - v_031_000_2);
+        const double v_031_120_0 = PB[0]*v_031_020_0 - PC0[l]*v_031_020_1;
+        const double v_031_011_0 = PB[1]*v_031_001_0 - PC1[l]*v_031_001_1 + 3*oo2p*(v_021_001_0 - v_021_001_1);
+        const double v_031_011_1 = PB[1]*v_031_001_1 - PC1[l]*v_031_001_2 + 3*oo2p*(v_021_001_1 - v_021_001_2);
+        const double v_031_111_0 = PB[0]*v_031_011_0 - PC0[l]*v_031_011_1;
+        const double v_031_002_0 = PB[2]*v_031_001_0 - PC2[l]*v_031_001_1 + 1*oo2p*(v_030_001_0 - v_030_001_1) + 1*oo2p*(v_031_000_0 - v_031_000_1);
+        const double v_031_002_1 = PB[2]*v_031_001_1 - PC2[l]*v_031_001_2 + 1*oo2p*(v_030_001_1 - v_030_001_2) + 1*oo2p*(v_031_000_1 - v_031_000_2);
+        const double v_031_102_0 = PB[0]*v_031_002_0 - PC0[l]*v_031_002_1;
+        const double v_031_030_0 = PB[1]*v_031_020_0 - PC1[l]*v_031_020_1 + 3*oo2p*(v_021_020_0 - v_021_020_1) + 2*oo2p*(v_031_010_0 - v_031_010_1);
+        const double v_031_021_0 = PB[2]*v_031_020_0 - PC2[l]*v_031_020_1 + 1*oo2p*(v_030_020_0 - v_030_020_1);
+        const double v_031_012_0 = PB[1]*v_031_002_0 - PC1[l]*v_031_002_1 + 3*oo2p*(v_021_002_0 - v_021_002_1);
+        const double v_031_003_0 = PB[2]*v_031_002_0 - PC2[l]*v_031_002_1 + 1*oo2p*(v_030_002_0 - v_030_002_1) + 2*oo2p*(v_031_001_0 - v_031_001_1);
+        const double v_022_000_0 = PA[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_022_000_1 = PA[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_022_100_0 = PB[0]*v_022_000_0 - PC0[l]*v_022_000_1;
+        const double v_022_000_2 = PA[1]*v_012_000_2 - PC1[l]*v_012_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_022_100_1 = PB[0]*v_022_000_1 - PC0[l]*v_022_000_2;
+        const double v_022_200_0 = PB[0]*v_022_100_0 - PC0[l]*v_022_100_1 + 1*oo2p*(v_022_000_0 - v_022_000_1);
+        const double v_022_000_3 = PA[1]*v_012_000_3 - PC1[l]*v_012_000_4 + 1*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_022_100_2 = PB[0]*v_022_000_2 - PC0[l]*v_022_000_3;
+        const double v_022_200_1 = PB[0]*v_022_100_1 - PC0[l]*v_022_100_2 + 1*oo2p*(v_022_000_1 - v_022_000_2);
+        const double v_022_300_0 = PB[0]*v_022_200_0 - PC0[l]*v_022_200_1 + 2*oo2p*(v_022_100_0 - v_022_100_1);
+        const double v_022_010_0 = PB[1]*v_022_000_0 - PC1[l]*v_022_000_1 + 2*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_022_010_1 = PB[1]*v_022_000_1 - PC1[l]*v_022_000_2 + 2*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_022_110_0 = PB[0]*v_022_010_0 - PC0[l]*v_022_010_1;
+        const double v_022_010_2 = PB[1]*v_022_000_2 - PC1[l]*v_022_000_3 + 2*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_022_110_1 = PB[0]*v_022_010_1 - PC0[l]*v_022_010_2;
+        const double v_022_210_0 = PB[0]*v_022_110_0 - PC0[l]*v_022_110_1 + 1*oo2p*(v_022_010_0 - v_022_010_1);
+        const double v_022_001_0 = PB[2]*v_022_000_0 - PC2[l]*v_022_000_1 + 2*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_022_001_1 = PB[2]*v_022_000_1 - PC2[l]*v_022_000_2 + 2*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_022_101_0 = PB[0]*v_022_001_0 - PC0[l]*v_022_001_1;
+        const double v_022_001_2 = PB[2]*v_022_000_2 - PC2[l]*v_022_000_3 + 2*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_022_101_1 = PB[0]*v_022_001_1 - PC0[l]*v_022_001_2;
+        const double v_022_201_0 = PB[0]*v_022_101_0 - PC0[l]*v_022_101_1 + 1*oo2p*(v_022_001_0 - v_022_001_1);
+        const double v_022_020_0 = PB[1]*v_022_010_0 - PC1[l]*v_022_010_1 + 2*oo2p*(v_012_010_0 - v_012_010_1) + 1*oo2p*(v_022_000_0 - v_022_000_1);
+        const double v_022_020_1 = PB[1]*v_022_010_1 - PC1[l]*v_022_010_2 + 2*oo2p*(v_012_010_1 - v_012_010_2) + 1*oo2p*(v_022_000_1 - v_022_000_2);
+        const double v_022_120_0 = PB[0]*v_022_020_0 - PC0[l]*v_022_020_1;
+        const double v_022_011_0 = PB[1]*v_022_001_0 - PC1[l]*v_022_001_1 + 2*oo2p*(v_012_001_0 - v_012_001_1);
+        const double v_022_011_1 = PB[1]*v_022_001_1 - PC1[l]*v_022_001_2 + 2*oo2p*(v_012_001_1 - v_012_001_2);
+        const double v_022_111_0 = PB[0]*v_022_011_0 - PC0[l]*v_022_011_1;
+        const double v_022_002_0 = PB[2]*v_022_001_0 - PC2[l]*v_022_001_1 + 2*oo2p*(v_021_001_0 - v_021_001_1) + 1*oo2p*(v_022_000_0 - v_022_000_1);
+        const double v_022_002_1 = PB[2]*v_022_001_1 - PC2[l]*v_022_001_2 + 2*oo2p*(v_021_001_1 - v_021_001_2) + 1*oo2p*(v_022_000_1 - v_022_000_2);
+        const double v_022_102_0 = PB[0]*v_022_002_0 - PC0[l]*v_022_002_1;
+        const double v_022_030_0 = PB[1]*v_022_020_0 - PC1[l]*v_022_020_1 + 2*oo2p*(v_012_020_0 - v_012_020_1) + 2*oo2p*(v_022_010_0 - v_022_010_1);
+        const double v_022_021_0 = PB[2]*v_022_020_0 - PC2[l]*v_022_020_1 + 2*oo2p*(v_021_020_0 - v_021_020_1);
+        const double v_022_012_0 = PB[1]*v_022_002_0 - PC1[l]*v_022_002_1 + 2*oo2p*(v_012_002_0 - v_012_002_1);
+        const double v_022_003_0 = PB[2]*v_022_002_0 - PC2[l]*v_022_002_1 + 2*oo2p*(v_021_002_0 - v_021_002_1) + 2*oo2p*(v_022_001_0 - v_022_001_1);
+        const double v_013_000_0 = PA[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_013_000_1 = PA[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_013_100_0 = PB[0]*v_013_000_0 - PC0[l]*v_013_000_1;
+        const double v_013_000_2 = PA[1]*v_003_000_2 - PC1[l]*v_003_000_3;
+        const double v_013_100_1 = PB[0]*v_013_000_1 - PC0[l]*v_013_000_2;
+        const double v_013_200_0 = PB[0]*v_013_100_0 - PC0[l]*v_013_100_1 + 1*oo2p*(v_013_000_0 - v_013_000_1);
+        const double v_013_000_3 = PA[1]*v_003_000_3 - PC1[l]*v_003_000_4;
+        const double v_013_100_2 = PB[0]*v_013_000_2 - PC0[l]*v_013_000_3;
+        const double v_013_200_1 = PB[0]*v_013_100_1 - PC0[l]*v_013_100_2 + 1*oo2p*(v_013_000_1 - v_013_000_2);
+        const double v_013_300_0 = PB[0]*v_013_200_0 - PC0[l]*v_013_200_1 + 2*oo2p*(v_013_100_0 - v_013_100_1);
+        const double v_013_010_0 = PB[1]*v_013_000_0 - PC1[l]*v_013_000_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_013_010_1 = PB[1]*v_013_000_1 - PC1[l]*v_013_000_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_013_110_0 = PB[0]*v_013_010_0 - PC0[l]*v_013_010_1;
+        const double v_013_010_2 = PB[1]*v_013_000_2 - PC1[l]*v_013_000_3 + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_013_110_1 = PB[0]*v_013_010_1 - PC0[l]*v_013_010_2;
+        const double v_013_210_0 = PB[0]*v_013_110_0 - PC0[l]*v_013_110_1 + 1*oo2p*(v_013_010_0 - v_013_010_1);
+        const double v_013_001_0 = PB[2]*v_013_000_0 - PC2[l]*v_013_000_1 + 3*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_013_001_1 = PB[2]*v_013_000_1 - PC2[l]*v_013_000_2 + 3*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_013_101_0 = PB[0]*v_013_001_0 - PC0[l]*v_013_001_1;
+        const double v_013_001_2 = PB[2]*v_013_000_2 - PC2[l]*v_013_000_3 + 3*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_013_101_1 = PB[0]*v_013_001_1 - PC0[l]*v_013_001_2;
+        const double v_013_201_0 = PB[0]*v_013_101_0 - PC0[l]*v_013_101_1 + 1*oo2p*(v_013_001_0 - v_013_001_1);
+        const double v_013_020_0 = PB[1]*v_013_010_0 - PC1[l]*v_013_010_1 + 1*oo2p*(v_003_010_0 - v_003_010_1) + 1*oo2p*(v_013_000_0 - v_013_000_1);
+        const double v_013_020_1 = PB[1]*v_013_010_1 - PC1[l]*v_013_010_2 + 1*oo2p*(v_003_010_1 - v_003_010_2) + 1*oo2p*(v_013_000_1 - v_013_000_2);
+        const double v_013_120_0 = PB[0]*v_013_020_0 - PC0[l]*v_013_020_1;
+        const double v_013_011_0 = PB[1]*v_013_001_0 - PC1[l]*v_013_001_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_013_011_1 = PB[1]*v_013_001_1 - PC1[l]*v_013_001_2 + 1*oo2p*(v_003_001_1 - v_003_001_2);
+        const double v_013_111_0 = PB[0]*v_013_011_0 - PC0[l]*v_013_011_1;
+        const double v_013_002_0 = PB[2]*v_013_001_0 - PC2[l]*v_013_001_1 + 3*oo2p*(v_012_001_0 - v_012_001_1) + 1*oo2p*(v_013_000_0 - v_013_000_1);
+        const double v_013_002_1 = PB[2]*v_013_001_1 - PC2[l]*v_013_001_2 + 3*oo2p*(v_012_001_1 - v_012_001_2) + 1*oo2p*(v_013_000_1 - v_013_000_2);
+        const double v_013_102_0 = PB[0]*v_013_002_0 - PC0[l]*v_013_002_1;
+        const double v_013_030_0 = PB[1]*v_013_020_0 - PC1[l]*v_013_020_1 + 1*oo2p*(v_003_020_0 - v_003_020_1) + 2*oo2p*(v_013_010_0 - v_013_010_1);
+        const double v_013_021_0 = PB[2]*v_013_020_0 - PC2[l]*v_013_020_1 + 3*oo2p*(v_012_020_0 - v_012_020_1);
+        const double v_013_012_0 = PB[1]*v_013_002_0 - PC1[l]*v_013_002_1 + 1*oo2p*(v_003_002_0 - v_003_002_1);
+        const double v_013_003_0 = PB[2]*v_013_002_0 - PC2[l]*v_013_002_1 + 3*oo2p*(v_012_002_0 - v_012_002_1) + 2*oo2p*(v_013_001_0 - v_013_001_1);
+        const double v_004_000_0 = PA[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_004_000_1 = PA[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_004_100_0 = PB[0]*v_004_000_0 - PC0[l]*v_004_000_1;
+        const double v_004_000_2 = PA[2]*v_003_000_2 - PC2[l]*v_003_000_3 + 3*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_004_100_1 = PB[0]*v_004_000_1 - PC0[l]*v_004_000_2;
+        const double v_004_200_0 = PB[0]*v_004_100_0 - PC0[l]*v_004_100_1 + 1*oo2p*(v_004_000_0 - v_004_000_1);
+        const double v_004_000_3 = PA[2]*v_003_000_3 - PC2[l]*v_003_000_4 + 3*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_004_100_2 = PB[0]*v_004_000_2 - PC0[l]*v_004_000_3;
+        const double v_004_200_1 = PB[0]*v_004_100_1 - PC0[l]*v_004_100_2 + 1*oo2p*(v_004_000_1 - v_004_000_2);
+        const double v_004_300_0 = PB[0]*v_004_200_0 - PC0[l]*v_004_200_1 + 2*oo2p*(v_004_100_0 - v_004_100_1);
+        const double v_004_210_0 = PB[1]*v_004_200_0 - PC1[l]*v_004_200_1;
+        const double v_004_001_0 = PB[2]*v_004_000_0 - PC2[l]*v_004_000_1 + 4*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_004_001_1 = PB[2]*v_004_000_1 - PC2[l]*v_004_000_2 + 4*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_004_101_0 = PB[0]*v_004_001_0 - PC0[l]*v_004_001_1;
+        const double v_004_001_2 = PB[2]*v_004_000_2 - PC2[l]*v_004_000_3 + 4*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_004_101_1 = PB[0]*v_004_001_1 - PC0[l]*v_004_001_2;
+        const double v_004_201_0 = PB[0]*v_004_101_0 - PC0[l]*v_004_101_1 + 1*oo2p*(v_004_001_0 - v_004_001_1);
+        const double v_004_010_0 = PB[1]*v_004_000_0 - PC1[l]*v_004_000_1;
+        const double v_004_010_1 = PB[1]*v_004_000_1 - PC1[l]*v_004_000_2;
+        const double v_004_020_0 = PB[1]*v_004_010_0 - PC1[l]*v_004_010_1 + 1*oo2p*(v_004_000_0 - v_004_000_1);
+        const double v_004_010_2 = PB[1]*v_004_000_2 - PC1[l]*v_004_000_3;
+        const double v_004_020_1 = PB[1]*v_004_010_1 - PC1[l]*v_004_010_2 + 1*oo2p*(v_004_000_1 - v_004_000_2);
+        const double v_004_120_0 = PB[0]*v_004_020_0 - PC0[l]*v_004_020_1;
+        const double v_004_011_0 = PB[1]*v_004_001_0 - PC1[l]*v_004_001_1;
+        const double v_004_011_1 = PB[1]*v_004_001_1 - PC1[l]*v_004_001_2;
+        const double v_004_111_0 = PB[0]*v_004_011_0 - PC0[l]*v_004_011_1;
+        const double v_004_002_0 = PB[2]*v_004_001_0 - PC2[l]*v_004_001_1 + 4*oo2p*(v_003_001_0 - v_003_001_1) + 1*oo2p*(v_004_000_0 - v_004_000_1);
+        const double v_004_002_1 = PB[2]*v_004_001_1 - PC2[l]*v_004_001_2 + 4*oo2p*(v_003_001_1 - v_003_001_2) + 1*oo2p*(v_004_000_1 - v_004_000_2);
+        const double v_004_102_0 = PB[0]*v_004_002_0 - PC0[l]*v_004_002_1;
+        const double v_004_030_0 = PB[1]*v_004_020_0 - PC1[l]*v_004_020_1 + 2*oo2p*(v_004_010_0 - v_004_010_1);
+        const double v_004_021_0 = PB[1]*v_004_011_0 - PC1[l]*v_004_011_1 + 1*oo2p*(v_004_001_0 - v_004_001_1);
+        const double v_004_012_0 = PB[1]*v_004_002_0 - PC1[l]*v_004_002_1;
+        const double v_004_003_0 = PB[2]*v_004_002_0 - PC2[l]*v_004_002_1 + 4*oo2p*(v_003_002_0 - v_003_002_1) + 2*oo2p*(v_004_001_0 - v_004_001_1);
+
+        sum_0 += q[l]*v_400_300_0;
+        sum_1 += q[l]*v_400_210_0;
+        sum_2 += q[l]*v_400_201_0;
+        sum_3 += q[l]*v_400_120_0;
+        sum_4 += q[l]*v_400_111_0;
+        sum_5 += q[l]*v_400_102_0;
+        sum_6 += q[l]*v_400_030_0;
+        sum_7 += q[l]*v_400_021_0;
+        sum_8 += q[l]*v_400_012_0;
+        sum_9 += q[l]*v_400_003_0;
+        sum_10 += q[l]*v_310_300_0;
+        sum_11 += q[l]*v_310_210_0;
+        sum_12 += q[l]*v_310_201_0;
+        sum_13 += q[l]*v_310_120_0;
+        sum_14 += q[l]*v_310_111_0;
+        sum_15 += q[l]*v_310_102_0;
+        sum_16 += q[l]*v_310_030_0;
+        sum_17 += q[l]*v_310_021_0;
+        sum_18 += q[l]*v_310_012_0;
+        sum_19 += q[l]*v_310_003_0;
+        sum_20 += q[l]*v_301_300_0;
+        sum_21 += q[l]*v_301_210_0;
+        sum_22 += q[l]*v_301_201_0;
+        sum_23 += q[l]*v_301_120_0;
+        sum_24 += q[l]*v_301_111_0;
+        sum_25 += q[l]*v_301_102_0;
+        sum_26 += q[l]*v_301_030_0;
+        sum_27 += q[l]*v_301_021_0;
+        sum_28 += q[l]*v_301_012_0;
+        sum_29 += q[l]*v_301_003_0;
+        sum_30 += q[l]*v_220_300_0;
+        sum_31 += q[l]*v_220_210_0;
+        sum_32 += q[l]*v_220_201_0;
+        sum_33 += q[l]*v_220_120_0;
+        sum_34 += q[l]*v_220_111_0;
+        sum_35 += q[l]*v_220_102_0;
+        sum_36 += q[l]*v_220_030_0;
+        sum_37 += q[l]*v_220_021_0;
+        sum_38 += q[l]*v_220_012_0;
+        sum_39 += q[l]*v_220_003_0;
+        sum_40 += q[l]*v_211_300_0;
+        sum_41 += q[l]*v_211_210_0;
+        sum_42 += q[l]*v_211_201_0;
+        sum_43 += q[l]*v_211_120_0;
+        sum_44 += q[l]*v_211_111_0;
+        sum_45 += q[l]*v_211_102_0;
+        sum_46 += q[l]*v_211_030_0;
+        sum_47 += q[l]*v_211_021_0;
+        sum_48 += q[l]*v_211_012_0;
+        sum_49 += q[l]*v_211_003_0;
+        sum_50 += q[l]*v_202_300_0;
+        sum_51 += q[l]*v_202_210_0;
+        sum_52 += q[l]*v_202_201_0;
+        sum_53 += q[l]*v_202_120_0;
+        sum_54 += q[l]*v_202_111_0;
+        sum_55 += q[l]*v_202_102_0;
+        sum_56 += q[l]*v_202_030_0;
+        sum_57 += q[l]*v_202_021_0;
+        sum_58 += q[l]*v_202_012_0;
+        sum_59 += q[l]*v_202_003_0;
+        sum_60 += q[l]*v_130_300_0;
+        sum_61 += q[l]*v_130_210_0;
+        sum_62 += q[l]*v_130_201_0;
+        sum_63 += q[l]*v_130_120_0;
+        sum_64 += q[l]*v_130_111_0;
+        sum_65 += q[l]*v_130_102_0;
+        sum_66 += q[l]*v_130_030_0;
+        sum_67 += q[l]*v_130_021_0;
+        sum_68 += q[l]*v_130_012_0;
+        sum_69 += q[l]*v_130_003_0;
+        sum_70 += q[l]*v_121_300_0;
+        sum_71 += q[l]*v_121_210_0;
+        sum_72 += q[l]*v_121_201_0;
+        sum_73 += q[l]*v_121_120_0;
+        sum_74 += q[l]*v_121_111_0;
+        sum_75 += q[l]*v_121_102_0;
+        sum_76 += q[l]*v_121_030_0;
+        sum_77 += q[l]*v_121_021_0;
+        sum_78 += q[l]*v_121_012_0;
+        sum_79 += q[l]*v_121_003_0;
+        sum_80 += q[l]*v_112_300_0;
+        sum_81 += q[l]*v_112_210_0;
+        sum_82 += q[l]*v_112_201_0;
+        sum_83 += q[l]*v_112_120_0;
+        sum_84 += q[l]*v_112_111_0;
+        sum_85 += q[l]*v_112_102_0;
+        sum_86 += q[l]*v_112_030_0;
+        sum_87 += q[l]*v_112_021_0;
+        sum_88 += q[l]*v_112_012_0;
+        sum_89 += q[l]*v_112_003_0;
+        sum_90 += q[l]*v_103_300_0;
+        sum_91 += q[l]*v_103_210_0;
+        sum_92 += q[l]*v_103_201_0;
+        sum_93 += q[l]*v_103_120_0;
+        sum_94 += q[l]*v_103_111_0;
+        sum_95 += q[l]*v_103_102_0;
+        sum_96 += q[l]*v_103_030_0;
+        sum_97 += q[l]*v_103_021_0;
+        sum_98 += q[l]*v_103_012_0;
+        sum_99 += q[l]*v_103_003_0;
+        sum_100 += q[l]*v_040_300_0;
+        sum_101 += q[l]*v_040_210_0;
+        sum_102 += q[l]*v_040_201_0;
+        sum_103 += q[l]*v_040_120_0;
+        sum_104 += q[l]*v_040_111_0;
+        sum_105 += q[l]*v_040_102_0;
+        sum_106 += q[l]*v_040_030_0;
+        sum_107 += q[l]*v_040_021_0;
+        sum_108 += q[l]*v_040_012_0;
+        sum_109 += q[l]*v_040_003_0;
+        sum_110 += q[l]*v_031_300_0;
+        sum_111 += q[l]*v_031_210_0;
+        sum_112 += q[l]*v_031_201_0;
+        sum_113 += q[l]*v_031_120_0;
+        sum_114 += q[l]*v_031_111_0;
+        sum_115 += q[l]*v_031_102_0;
+        sum_116 += q[l]*v_031_030_0;
+        sum_117 += q[l]*v_031_021_0;
+        sum_118 += q[l]*v_031_012_0;
+        sum_119 += q[l]*v_031_003_0;
+        sum_120 += q[l]*v_022_300_0;
+        sum_121 += q[l]*v_022_210_0;
+        sum_122 += q[l]*v_022_201_0;
+        sum_123 += q[l]*v_022_120_0;
+        sum_124 += q[l]*v_022_111_0;
+        sum_125 += q[l]*v_022_102_0;
+        sum_126 += q[l]*v_022_030_0;
+        sum_127 += q[l]*v_022_021_0;
+        sum_128 += q[l]*v_022_012_0;
+        sum_129 += q[l]*v_022_003_0;
+        sum_130 += q[l]*v_013_300_0;
+        sum_131 += q[l]*v_013_210_0;
+        sum_132 += q[l]*v_013_201_0;
+        sum_133 += q[l]*v_013_120_0;
+        sum_134 += q[l]*v_013_111_0;
+        sum_135 += q[l]*v_013_102_0;
+        sum_136 += q[l]*v_013_030_0;
+        sum_137 += q[l]*v_013_021_0;
+        sum_138 += q[l]*v_013_012_0;
+        sum_139 += q[l]*v_013_003_0;
+        sum_140 += q[l]*v_004_300_0;
+        sum_141 += q[l]*v_004_210_0;
+        sum_142 += q[l]*v_004_201_0;
+        sum_143 += q[l]*v_004_120_0;
+        sum_144 += q[l]*v_004_111_0;
+        sum_145 += q[l]*v_004_102_0;
+        sum_146 += q[l]*v_004_030_0;
+        sum_147 += q[l]*v_004_021_0;
+        sum_148 += q[l]*v_004_012_0;
+        sum_149 += q[l]*v_004_003_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+    acc[45] += sum_45;
+    acc[46] += sum_46;
+    acc[47] += sum_47;
+    acc[48] += sum_48;
+    acc[49] += sum_49;
+    acc[50] += sum_50;
+    acc[51] += sum_51;
+    acc[52] += sum_52;
+    acc[53] += sum_53;
+    acc[54] += sum_54;
+    acc[55] += sum_55;
+    acc[56] += sum_56;
+    acc[57] += sum_57;
+    acc[58] += sum_58;
+    acc[59] += sum_59;
+    acc[60] += sum_60;
+    acc[61] += sum_61;
+    acc[62] += sum_62;
+    acc[63] += sum_63;
+    acc[64] += sum_64;
+    acc[65] += sum_65;
+    acc[66] += sum_66;
+    acc[67] += sum_67;
+    acc[68] += sum_68;
+    acc[69] += sum_69;
+    acc[70] += sum_70;
+    acc[71] += sum_71;
+    acc[72] += sum_72;
+    acc[73] += sum_73;
+    acc[74] += sum_74;
+    acc[75] += sum_75;
+    acc[76] += sum_76;
+    acc[77] += sum_77;
+    acc[78] += sum_78;
+    acc[79] += sum_79;
+    acc[80] += sum_80;
+    acc[81] += sum_81;
+    acc[82] += sum_82;
+    acc[83] += sum_83;
+    acc[84] += sum_84;
+    acc[85] += sum_85;
+    acc[86] += sum_86;
+    acc[87] += sum_87;
+    acc[88] += sum_88;
+    acc[89] += sum_89;
+    acc[90] += sum_90;
+    acc[91] += sum_91;
+    acc[92] += sum_92;
+    acc[93] += sum_93;
+    acc[94] += sum_94;
+    acc[95] += sum_95;
+    acc[96] += sum_96;
+    acc[97] += sum_97;
+    acc[98] += sum_98;
+    acc[99] += sum_99;
+    acc[100] += sum_100;
+    acc[101] += sum_101;
+    acc[102] += sum_102;
+    acc[103] += sum_103;
+    acc[104] += sum_104;
+    acc[105] += sum_105;
+    acc[106] += sum_106;
+    acc[107] += sum_107;
+    acc[108] += sum_108;
+    acc[109] += sum_109;
+    acc[110] += sum_110;
+    acc[111] += sum_111;
+    acc[112] += sum_112;
+    acc[113] += sum_113;
+    acc[114] += sum_114;
+    acc[115] += sum_115;
+    acc[116] += sum_116;
+    acc[117] += sum_117;
+    acc[118] += sum_118;
+    acc[119] += sum_119;
+    acc[120] += sum_120;
+    acc[121] += sum_121;
+    acc[122] += sum_122;
+    acc[123] += sum_123;
+    acc[124] += sum_124;
+    acc[125] += sum_125;
+    acc[126] += sum_126;
+    acc[127] += sum_127;
+    acc[128] += sum_128;
+    acc[129] += sum_129;
+    acc[130] += sum_130;
+    acc[131] += sum_131;
+    acc[132] += sum_132;
+    acc[133] += sum_133;
+    acc[134] += sum_134;
+    acc[135] += sum_135;
+    acc[136] += sum_136;
+    acc[137] += sum_137;
+    acc[138] += sum_138;
+    acc[139] += sum_139;
+    acc[140] += sum_140;
+    acc[141] += sum_141;
+    acc[142] += sum_142;
+    acc[143] += sum_143;
+    acc[144] += sum_144;
+    acc[145] += sum_145;
+    acc[146] += sum_146;
+    acc[147] += sum_147;
+    acc[148] += sum_148;
+    acc[149] += sum_149;
+}
+
+
+void potential_kernel_4_4(size_t nb, const double * RESTRICT F,
+        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,
+        const double * RESTRICT q, const double PA[3], const double PB[3],
+        const double oo2p, double * RESTRICT acc)
+{
+    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;
+
+    double sum_0 = 0.0;
+    double sum_1 = 0.0;
+    double sum_2 = 0.0;
+    double sum_3 = 0.0;
+    double sum_4 = 0.0;
+    double sum_5 = 0.0;
+    double sum_6 = 0.0;
+    double sum_7 = 0.0;
+    double sum_8 = 0.0;
+    double sum_9 = 0.0;
+    double sum_10 = 0.0;
+    double sum_11 = 0.0;
+    double sum_12 = 0.0;
+    double sum_13 = 0.0;
+    double sum_14 = 0.0;
+    double sum_15 = 0.0;
+    double sum_16 = 0.0;
+    double sum_17 = 0.0;
+    double sum_18 = 0.0;
+    double sum_19 = 0.0;
+    double sum_20 = 0.0;
+    double sum_21 = 0.0;
+    double sum_22 = 0.0;
+    double sum_23 = 0.0;
+    double sum_24 = 0.0;
+    double sum_25 = 0.0;
+    double sum_26 = 0.0;
+    double sum_27 = 0.0;
+    double sum_28 = 0.0;
+    double sum_29 = 0.0;
+    double sum_30 = 0.0;
+    double sum_31 = 0.0;
+    double sum_32 = 0.0;
+    double sum_33 = 0.0;
+    double sum_34 = 0.0;
+    double sum_35 = 0.0;
+    double sum_36 = 0.0;
+    double sum_37 = 0.0;
+    double sum_38 = 0.0;
+    double sum_39 = 0.0;
+    double sum_40 = 0.0;
+    double sum_41 = 0.0;
+    double sum_42 = 0.0;
+    double sum_43 = 0.0;
+    double sum_44 = 0.0;
+    double sum_45 = 0.0;
+    double sum_46 = 0.0;
+    double sum_47 = 0.0;
+    double sum_48 = 0.0;
+    double sum_49 = 0.0;
+    double sum_50 = 0.0;
+    double sum_51 = 0.0;
+    double sum_52 = 0.0;
+    double sum_53 = 0.0;
+    double sum_54 = 0.0;
+    double sum_55 = 0.0;
+    double sum_56 = 0.0;
+    double sum_57 = 0.0;
+    double sum_58 = 0.0;
+    double sum_59 = 0.0;
+    double sum_60 = 0.0;
+    double sum_61 = 0.0;
+    double sum_62 = 0.0;
+    double sum_63 = 0.0;
+    double sum_64 = 0.0;
+    double sum_65 = 0.0;
+    double sum_66 = 0.0;
+    double sum_67 = 0.0;
+    double sum_68 = 0.0;
+    double sum_69 = 0.0;
+    double sum_70 = 0.0;
+    double sum_71 = 0.0;
+    double sum_72 = 0.0;
+    double sum_73 = 0.0;
+    double sum_74 = 0.0;
+    double sum_75 = 0.0;
+    double sum_76 = 0.0;
+    double sum_77 = 0.0;
+    double sum_78 = 0.0;
+    double sum_79 = 0.0;
+    double sum_80 = 0.0;
+    double sum_81 = 0.0;
+    double sum_82 = 0.0;
+    double sum_83 = 0.0;
+    double sum_84 = 0.0;
+    double sum_85 = 0.0;
+    double sum_86 = 0.0;
+    double sum_87 = 0.0;
+    double sum_88 = 0.0;
+    double sum_89 = 0.0;
+    double sum_90 = 0.0;
+    double sum_91 = 0.0;
+    double sum_92 = 0.0;
+    double sum_93 = 0.0;
+    double sum_94 = 0.0;
+    double sum_95 = 0.0;
+    double sum_96 = 0.0;
+    double sum_97 = 0.0;
+    double sum_98 = 0.0;
+    double sum_99 = 0.0;
+    double sum_100 = 0.0;
+    double sum_101 = 0.0;
+    double sum_102 = 0.0;
+    double sum_103 = 0.0;
+    double sum_104 = 0.0;
+    double sum_105 = 0.0;
+    double sum_106 = 0.0;
+    double sum_107 = 0.0;
+    double sum_108 = 0.0;
+    double sum_109 = 0.0;
+    double sum_110 = 0.0;
+    double sum_111 = 0.0;
+    double sum_112 = 0.0;
+    double sum_113 = 0.0;
+    double sum_114 = 0.0;
+    double sum_115 = 0.0;
+    double sum_116 = 0.0;
+    double sum_117 = 0.0;
+    double sum_118 = 0.0;
+    double sum_119 = 0.0;
+    double sum_120 = 0.0;
+    double sum_121 = 0.0;
+    double sum_122 = 0.0;
+    double sum_123 = 0.0;
+    double sum_124 = 0.0;
+    double sum_125 = 0.0;
+    double sum_126 = 0.0;
+    double sum_127 = 0.0;
+    double sum_128 = 0.0;
+    double sum_129 = 0.0;
+    double sum_130 = 0.0;
+    double sum_131 = 0.0;
+    double sum_132 = 0.0;
+    double sum_133 = 0.0;
+    double sum_134 = 0.0;
+    double sum_135 = 0.0;
+    double sum_136 = 0.0;
+    double sum_137 = 0.0;
+    double sum_138 = 0.0;
+    double sum_139 = 0.0;
+    double sum_140 = 0.0;
+    double sum_141 = 0.0;
+    double sum_142 = 0.0;
+    double sum_143 = 0.0;
+    double sum_144 = 0.0;
+    double sum_145 = 0.0;
+    double sum_146 = 0.0;
+    double sum_147 = 0.0;
+    double sum_148 = 0.0;
+    double sum_149 = 0.0;
+    double sum_150 = 0.0;
+    double sum_151 = 0.0;
+    double sum_152 = 0.0;
+    double sum_153 = 0.0;
+    double sum_154 = 0.0;
+    double sum_155 = 0.0;
+    double sum_156 = 0.0;
+    double sum_157 = 0.0;
+    double sum_158 = 0.0;
+    double sum_159 = 0.0;
+    double sum_160 = 0.0;
+    double sum_161 = 0.0;
+    double sum_162 = 0.0;
+    double sum_163 = 0.0;
+    double sum_164 = 0.0;
+    double sum_165 = 0.0;
+    double sum_166 = 0.0;
+    double sum_167 = 0.0;
+    double sum_168 = 0.0;
+    double sum_169 = 0.0;
+    double sum_170 = 0.0;
+    double sum_171 = 0.0;
+    double sum_172 = 0.0;
+    double sum_173 = 0.0;
+    double sum_174 = 0.0;
+    double sum_175 = 0.0;
+    double sum_176 = 0.0;
+    double sum_177 = 0.0;
+    double sum_178 = 0.0;
+    double sum_179 = 0.0;
+    double sum_180 = 0.0;
+    double sum_181 = 0.0;
+    double sum_182 = 0.0;
+    double sum_183 = 0.0;
+    double sum_184 = 0.0;
+    double sum_185 = 0.0;
+    double sum_186 = 0.0;
+    double sum_187 = 0.0;
+    double sum_188 = 0.0;
+    double sum_189 = 0.0;
+    double sum_190 = 0.0;
+    double sum_191 = 0.0;
+    double sum_192 = 0.0;
+    double sum_193 = 0.0;
+    double sum_194 = 0.0;
+    double sum_195 = 0.0;
+    double sum_196 = 0.0;
+    double sum_197 = 0.0;
+    double sum_198 = 0.0;
+    double sum_199 = 0.0;
+    double sum_200 = 0.0;
+    double sum_201 = 0.0;
+    double sum_202 = 0.0;
+    double sum_203 = 0.0;
+    double sum_204 = 0.0;
+    double sum_205 = 0.0;
+    double sum_206 = 0.0;
+    double sum_207 = 0.0;
+    double sum_208 = 0.0;
+    double sum_209 = 0.0;
+    double sum_210 = 0.0;
+    double sum_211 = 0.0;
+    double sum_212 = 0.0;
+    double sum_213 = 0.0;
+    double sum_214 = 0.0;
+    double sum_215 = 0.0;
+    double sum_216 = 0.0;
+    double sum_217 = 0.0;
+    double sum_218 = 0.0;
+    double sum_219 = 0.0;
+    double sum_220 = 0.0;
+    double sum_221 = 0.0;
+    double sum_222 = 0.0;
+    double sum_223 = 0.0;
+    double sum_224 = 0.0;
+
+    for(size_t l = 0; l < nb; l++)
+    {
+        const double v_000_000_0 = F[0*nb + l];
+        const double v_000_000_1 = F[1*nb + l];
+        const double v_100_000_0 = PA[0]*v_000_000_0 - PC0[l]*v_000_000_1;
+        const double v_000_000_2 = F[2*nb + l];
+        const double v_100_000_1 = PA[0]*v_000_000_1 - PC0[l]*v_000_000_2;
+        const double v_200_000_0 = PA[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_000_000_3 = F[3*nb + l];
+        const double v_100_000_2 = PA[0]*v_000_000_2 - PC0[l]*v_000_000_3;
+        const double v_200_000_1 = PA[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_300_000_0 = PA[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_000_000_4 = F[4*nb + l];
+        const double v_100_000_3 = PA[0]*v_000_000_3 - PC0[l]*v_000_000_4;
+        const double v_200_000_2 = PA[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_300_000_1 = PA[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_400_000_0 = PA[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_000_000_5 = F[5*nb + l];
+        const double v_100_000_4 = PA[0]*v_000_000_4 - PC0[l]*v_000_000_5;
+        const double v_200_000_3 = PA[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_300_000_2 = PA[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_400_000_1 = PA[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_400_100_0 = PB[0]*v_400_000_0 - PC0[l]*v_400_000_1 + 4*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_000_000_6 = F[6*nb + l];
+        const double v_100_000_5 = PA[0]*v_000_000_5 - PC0[l]*v_000_000_6;
+        const double v_200_000_4 = PA[0]*v_100_000_4 - PC0[l]*v_100_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_300_000_3 = PA[0]*v_200_000_3 - PC0[l]*v_200_000_4 + 2*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_400_000_2 = PA[0]*v_300_000_2 - PC0[l]*v_300_000_3 + 3*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_400_100_1 = PB[0]*v_400_000_1 - PC0[l]*v_400_000_2 + 4*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_300_100_0 = PB[0]*v_300_000_0 - PC0[l]*v_300_000_1 + 3*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_300_100_1 = PB[0]*v_300_000_1 - PC0[l]*v_300_000_2 + 3*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_400_200_0 = PB[0]*v_400_100_0 - PC0[l]*v_400_100_1 + 4*oo2p*(v_300_100_0 - v_300_100_1) + 1*oo2p*(v_400_000_0 - v_400_000_1);
+        const double v_000_000_7 = F[7*nb + l];
+        const double v_100_000_6 = PA[0]*v_000_000_6 - PC0[l]*v_000_000_7;
+        const double v_200_000_5 = PA[0]*v_100_000_5 - PC0[l]*v_100_000_6 + 1*oo2p*(v_000_000_5 - v_000_000_6);
+        const double v_300_000_4 = PA[0]*v_200_000_4 - PC0[l]*v_200_000_5 + 2*oo2p*(v_100_000_4 - v_100_000_5);
+        const double v_400_000_3 = PA[0]*v_300_000_3 - PC0[l]*v_300_000_4 + 3*oo2p*(v_200_000_3 - v_200_000_4);
+        const double v_400_100_2 = PB[0]*v_400_000_2 - PC0[l]*v_400_000_3 + 4*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_300_100_2 = PB[0]*v_300_000_2 - PC0[l]*v_300_000_3 + 3*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_400_200_1 = PB[0]*v_400_100_1 - PC0[l]*v_400_100_2 + 4*oo2p*(v_300_100_1 - v_300_100_2) + 1*oo2p*(v_400_000_1 - v_400_000_2);
+        const double v_200_100_0 = PB[0]*v_200_000_0 - PC0[l]*v_200_000_1 + 2*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_200_100_1 = PB[0]*v_200_000_1 - PC0[l]*v_200_000_2 + 2*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_300_200_0 = PB[0]*v_300_100_0 - PC0[l]*v_300_100_1 + 3*oo2p*(v_200_100_0 - v_200_100_1) + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_200_100_2 = PB[0]*v_200_000_2 - PC0[l]*v_200_000_3 + 2*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_300_200_1 = PB[0]*v_300_100_1 - PC0[l]*v_300_100_2 + 3*oo2p*(v_200_100_1 - v_200_100_2) + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_400_300_0 = PB[0]*v_400_200_0 - PC0[l]*v_400_200_1 + 4*oo2p*(v_300_200_0 - v_300_200_1) + 2*oo2p*(v_400_100_0 - v_400_100_1);
+        const double v_000_000_8 = F[8*nb + l];
+        const double v_100_000_7 = PA[0]*v_000_000_7 - PC0[l]*v_000_000_8;
+        const double v_200_000_6 = PA[0]*v_100_000_6 - PC0[l]*v_100_000_7 + 1*oo2p*(v_000_000_6 - v_000_000_7);
+        const double v_300_000_5 = PA[0]*v_200_000_5 - PC0[l]*v_200_000_6 + 2*oo2p*(v_100_000_5 - v_100_000_6);
+        const double v_400_000_4 = PA[0]*v_300_000_4 - PC0[l]*v_300_000_5 + 3*oo2p*(v_200_000_4 - v_200_000_5);
+        const double v_400_100_3 = PB[0]*v_400_000_3 - PC0[l]*v_400_000_4 + 4*oo2p*(v_300_000_3 - v_300_000_4);
+        const double v_300_100_3 = PB[0]*v_300_000_3 - PC0[l]*v_300_000_4 + 3*oo2p*(v_200_000_3 - v_200_000_4);
+        const double v_400_200_2 = PB[0]*v_400_100_2 - PC0[l]*v_400_100_3 + 4*oo2p*(v_300_100_2 - v_300_100_3) + 1*oo2p*(v_400_000_2 - v_400_000_3);
+        const double v_200_100_3 = PB[0]*v_200_000_3 - PC0[l]*v_200_000_4 + 2*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_300_200_2 = PB[0]*v_300_100_2 - PC0[l]*v_300_100_3 + 3*oo2p*(v_200_100_2 - v_200_100_3) + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_400_300_1 = PB[0]*v_400_200_1 - PC0[l]*v_400_200_2 + 4*oo2p*(v_300_200_1 - v_300_200_2) + 2*oo2p*(v_400_100_1 - v_400_100_2);
+        const double v_100_100_0 = PB[0]*v_100_000_0 - PC0[l]*v_100_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_100_100_1 = PB[0]*v_100_000_1 - PC0[l]*v_100_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_200_200_0 = PB[0]*v_200_100_0 - PC0[l]*v_200_100_1 + 2*oo2p*(v_100_100_0 - v_100_100_1) + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_100_100_2 = PB[0]*v_100_000_2 - PC0[l]*v_100_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_200_200_1 = PB[0]*v_200_100_1 - PC0[l]*v_200_100_2 + 2*oo2p*(v_100_100_1 - v_100_100_2) + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_300_300_0 = PB[0]*v_300_200_0 - PC0[l]*v_300_200_1 + 3*oo2p*(v_200_200_0 - v_200_200_1) + 2*oo2p*(v_300_100_0 - v_300_100_1);
+        const double v_100_100_3 = PB[0]*v_100_000_3 - PC0[l]*v_100_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_200_200_2 = PB[0]*v_200_100_2 - PC0[l]*v_200_100_3 + 2*oo2p*(v_100_100_2 - v_100_100_3) + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_300_300_1 = PB[0]*v_300_200_1 - PC0[l]*v_300_200_2 + 3*oo2p*(v_200_200_1 - v_200_200_2) + 2*oo2p*(v_300_100_1 - v_300_100_2);
+        const double v_400_400_0 = PB[0]*v_400_300_0 - PC0[l]*v_400_300_1 + 4*oo2p*(v_300_300_0 - v_300_300_1) + 3*oo2p*(v_400_200_0 - v_400_200_1);
+        const double v_400_310_0 = PB[1]*v_400_300_0 - PC1[l]*v_400_300_1;
+        const double v_400_301_0 = PB[2]*v_400_300_0 - PC2[l]*v_400_300_1;
+        const double v_400_210_0 = PB[1]*v_400_200_0 - PC1[l]*v_400_200_1;
+        const double v_400_210_1 = PB[1]*v_400_200_1 - PC1[l]*v_400_200_2;
+        const double v_400_220_0 = PB[1]*v_400_210_0 - PC1[l]*v_400_210_1 + 1*oo2p*(v_400_200_0 - v_400_200_1);
+        const double v_400_201_0 = PB[2]*v_400_200_0 - PC2[l]*v_400_200_1;
+        const double v_400_201_1 = PB[2]*v_400_200_1 - PC2[l]*v_400_200_2;
+        const double v_400_211_0 = PB[1]*v_400_201_0 - PC1[l]*v_400_201_1;
+        const double v_400_202_0 = PB[2]*v_400_201_0 - PC2[l]*v_400_201_1 + 1*oo2p*(v_400_200_0 - v_400_200_1);
+        const double v_400_010_0 = PB[1]*v_400_000_0 - PC1[l]*v_400_000_1;
+        const double v_400_010_1 = PB[1]*v_400_000_1 - PC1[l]*v_400_000_2;
+        const double v_400_020_0 = PB[1]*v_400_010_0 - PC1[l]*v_400_010_1 + 1*oo2p*(v_400_000_0 - v_400_000_1);
+        const double v_400_010_2 = PB[1]*v_400_000_2 - PC1[l]*v_400_000_3;
+        const double v_400_020_1 = PB[1]*v_400_010_1 - PC1[l]*v_400_010_2 + 1*oo2p*(v_400_000_1 - v_400_000_2);
+        const double v_400_030_0 = PB[1]*v_400_020_0 - PC1[l]*v_400_020_1 + 2*oo2p*(v_400_010_0 - v_400_010_1);
+        const double v_400_010_3 = PB[1]*v_400_000_3 - PC1[l]*v_400_000_4;
+        const double v_400_020_2 = PB[1]*v_400_010_2 - PC1[l]*v_400_010_3 + 1*oo2p*(v_400_000_2 - v_400_000_3);
+        const double v_400_030_1 = PB[1]*v_400_020_1 - PC1[l]*v_400_020_2 + 2*oo2p*(v_400_010_1 - v_400_010_2);
+        const double v_300_010_0 = PB[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_300_010_1 = PB[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_300_020_0 = PB[1]*v_300_010_0 - PC1[l]*v_300_010_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_010_2 = PB[1]*v_300_000_2 - PC1[l]*v_300_000_3;
+        const double v_300_020_1 = PB[1]*v_300_010_1 - PC1[l]*v_300_010_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_300_030_0 = PB[1]*v_300_020_0 - PC1[l]*v_300_020_1 + 2*oo2p*(v_300_010_0 - v_300_010_1);
+        const double v_300_010_3 = PB[1]*v_300_000_3 - PC1[l]*v_300_000_4;
+        const double v_300_020_2 = PB[1]*v_300_010_2 - PC1[l]*v_300_010_3 + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_300_030_1 = PB[1]*v_300_020_1 - PC1[l]*v_300_020_2 + 2*oo2p*(v_300_010_1 - v_300_010_2);
+        const double v_400_130_0 = PB[0]*v_400_030_0 - PC0[l]*v_400_030_1 + 4*oo2p*(v_300_030_0 - v_300_030_1);
+        const double v_400_120_0 = PB[0]*v_400_020_0 - PC0[l]*v_400_020_1 + 4*oo2p*(v_300_020_0 - v_300_020_1);
+        const double v_400_120_1 = PB[0]*v_400_020_1 - PC0[l]*v_400_020_2 + 4*oo2p*(v_300_020_1 - v_300_020_2);
+        const double v_400_121_0 = PB[2]*v_400_120_0 - PC2[l]*v_400_120_1;
+        const double v_400_001_0 = PB[2]*v_400_000_0 - PC2[l]*v_400_000_1;
+        const double v_400_001_1 = PB[2]*v_400_000_1 - PC2[l]*v_400_000_2;
+        const double v_400_002_0 = PB[2]*v_400_001_0 - PC2[l]*v_400_001_1 + 1*oo2p*(v_400_000_0 - v_400_000_1);
+        const double v_400_001_2 = PB[2]*v_400_000_2 - PC2[l]*v_400_000_3;
+        const double v_400_002_1 = PB[2]*v_400_001_1 - PC2[l]*v_400_001_2 + 1*oo2p*(v_400_000_1 - v_400_000_2);
+        const double v_300_001_0 = PB[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_300_001_1 = PB[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_300_002_0 = PB[2]*v_300_001_0 - PC2[l]*v_300_001_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_300_001_2 = PB[2]*v_300_000_2 - PC2[l]*v_300_000_3;
+        const double v_300_002_1 = PB[2]*v_300_001_1 - PC2[l]*v_300_001_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_400_102_0 = PB[0]*v_400_002_0 - PC0[l]*v_400_002_1 + 4*oo2p*(v_300_002_0 - v_300_002_1);
+        const double v_400_001_3 = PB[2]*v_400_000_3 - PC2[l]*v_400_000_4;
+        const double v_400_002_2 = PB[2]*v_400_001_2 - PC2[l]*v_400_001_3 + 1*oo2p*(v_400_000_2 - v_400_000_3);
+        const double v_300_001_3 = PB[2]*v_300_000_3 - PC2[l]*v_300_000_4;
+        const double v_300_002_2 = PB[2]*v_300_001_2 - PC2[l]*v_300_001_3 + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_400_102_1 = PB[0]*v_400_002_1 - PC0[l]*v_400_002_2 + 4*oo2p*(v_300_002_1 - v_300_002_2);
+        const double v_400_112_0 = PB[1]*v_400_102_0 - PC1[l]*v_400_102_1;
+        const double v_400_003_0 = PB[2]*v_400_002_0 - PC2[l]*v_400_002_1 + 2*oo2p*(v_400_001_0 - v_400_001_1);
+        const double v_400_003_1 = PB[2]*v_400_002_1 - PC2[l]*v_400_002_2 + 2*oo2p*(v_400_001_1 - v_400_001_2);
+        const double v_300_003_0 = PB[2]*v_300_002_0 - PC2[l]*v_300_002_1 + 2*oo2p*(v_300_001_0 - v_300_001_1);
+        const double v_300_003_1 = PB[2]*v_300_002_1 - PC2[l]*v_300_002_2 + 2*oo2p*(v_300_001_1 - v_300_001_2);
+        const double v_400_103_0 = PB[0]*v_400_003_0 - PC0[l]*v_400_003_1 + 4*oo2p*(v_300_003_0 - v_300_003_1);
+        const double v_400_040_0 = PB[1]*v_400_030_0 - PC1[l]*v_400_030_1 + 3*oo2p*(v_400_020_0 - v_400_020_1);
+        const double v_400_031_0 = PB[2]*v_400_030_0 - PC2[l]*v_400_030_1;
+        const double v_400_012_0 = PB[1]*v_400_002_0 - PC1[l]*v_400_002_1;
+        const double v_400_012_1 = PB[1]*v_400_002_1 - PC1[l]*v_400_002_2;
+        const double v_400_022_0 = PB[1]*v_400_012_0 - PC1[l]*v_400_012_1 + 1*oo2p*(v_400_002_0 - v_400_002_1);
+        const double v_400_013_0 = PB[1]*v_400_003_0 - PC1[l]*v_400_003_1;
+        const double v_400_004_0 = PB[2]*v_400_003_0 - PC2[l]*v_400_003_1 + 3*oo2p*(v_400_002_0 - v_400_002_1);
+        const double v_310_000_0 = PA[1]*v_300_000_0 - PC1[l]*v_300_000_1;
+        const double v_310_000_1 = PA[1]*v_300_000_1 - PC1[l]*v_300_000_2;
+        const double v_210_000_0 = PA[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_210_000_1 = PA[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_310_100_0 = PB[0]*v_310_000_0 - PC0[l]*v_310_000_1 + 3*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_310_000_2 = PA[1]*v_300_000_2 - PC1[l]*v_300_000_3;
+        const double v_210_000_2 = PA[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_310_100_1 = PB[0]*v_310_000_1 - PC0[l]*v_310_000_2 + 3*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_010_000_0 = PA[1]*v_000_000_0 - PC1[l]*v_000_000_1;
+        const double v_010_000_1 = PA[1]*v_000_000_1 - PC1[l]*v_000_000_2;
+        const double v_110_000_0 = PA[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_000_2 = PA[1]*v_000_000_2 - PC1[l]*v_000_000_3;
+        const double v_110_000_1 = PA[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_210_100_0 = PB[0]*v_210_000_0 - PC0[l]*v_210_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_010_000_3 = PA[1]*v_000_000_3 - PC1[l]*v_000_000_4;
+        const double v_110_000_2 = PA[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_210_100_1 = PB[0]*v_210_000_1 - PC0[l]*v_210_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_310_200_0 = PB[0]*v_310_100_0 - PC0[l]*v_310_100_1 + 3*oo2p*(v_210_100_0 - v_210_100_1) + 1*oo2p*(v_310_000_0 - v_310_000_1);
+        const double v_310_000_3 = PA[1]*v_300_000_3 - PC1[l]*v_300_000_4;
+        const double v_210_000_3 = PA[1]*v_200_000_3 - PC1[l]*v_200_000_4;
+        const double v_310_100_2 = PB[0]*v_310_000_2 - PC0[l]*v_310_000_3 + 3*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_010_000_4 = PA[1]*v_000_000_4 - PC1[l]*v_000_000_5;
+        const double v_110_000_3 = PA[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_210_100_2 = PB[0]*v_210_000_2 - PC0[l]*v_210_000_3 + 2*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_310_200_1 = PB[0]*v_310_100_1 - PC0[l]*v_310_100_2 + 3*oo2p*(v_210_100_1 - v_210_100_2) + 1*oo2p*(v_310_000_1 - v_310_000_2);
+        const double v_110_100_0 = PB[0]*v_110_000_0 - PC0[l]*v_110_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_110_100_1 = PB[0]*v_110_000_1 - PC0[l]*v_110_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_210_200_0 = PB[0]*v_210_100_0 - PC0[l]*v_210_100_1 + 2*oo2p*(v_110_100_0 - v_110_100_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_110_100_2 = PB[0]*v_110_000_2 - PC0[l]*v_110_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_210_200_1 = PB[0]*v_210_100_1 - PC0[l]*v_210_100_2 + 2*oo2p*(v_110_100_1 - v_110_100_2) + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_310_300_0 = PB[0]*v_310_200_0 - PC0[l]*v_310_200_1 + 3*oo2p*(v_210_200_0 - v_210_200_1) + 2*oo2p*(v_310_100_0 - v_310_100_1);
+        const double v_310_000_4 = PA[1]*v_300_000_4 - PC1[l]*v_300_000_5;
+        const double v_210_000_4 = PA[1]*v_200_000_4 - PC1[l]*v_200_000_5;
+        const double v_310_100_3 = PB[0]*v_310_000_3 - PC0[l]*v_310_000_4 + 3*oo2p*(v_210_000_3 - v_210_000_4);
+        const double v_010_000_5 = PA[1]*v_000_000_5 - PC1[l]*v_000_000_6;
+        const double v_110_000_4 = PA[0]*v_010_000_4 - PC0[l]*v_010_000_5;
+        const double v_210_100_3 = PB[0]*v_210_000_3 - PC0[l]*v_210_000_4 + 2*oo2p*(v_110_000_3 - v_110_000_4);
+        const double v_310_200_2 = PB[0]*v_310_100_2 - PC0[l]*v_310_100_3 + 3*oo2p*(v_210_100_2 - v_210_100_3) + 1*oo2p*(v_310_000_2 - v_310_000_3);
+        const double v_110_100_3 = PB[0]*v_110_000_3 - PC0[l]*v_110_000_4 + 1*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_210_200_2 = PB[0]*v_210_100_2 - PC0[l]*v_210_100_3 + 2*oo2p*(v_110_100_2 - v_110_100_3) + 1*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_310_300_1 = PB[0]*v_310_200_1 - PC0[l]*v_310_200_2 + 3*oo2p*(v_210_200_1 - v_210_200_2) + 2*oo2p*(v_310_100_1 - v_310_100_2);
+        const double v_010_100_0 = PB[0]*v_010_000_0 - PC0[l]*v_010_000_1;
+        const double v_010_100_1 = PB[0]*v_010_000_1 - PC0[l]*v_010_000_2;
+        const double v_110_200_0 = PB[0]*v_110_100_0 - PC0[l]*v_110_100_1 + 1*oo2p*(v_010_100_0 - v_010_100_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_010_100_2 = PB[0]*v_010_000_2 - PC0[l]*v_010_000_3;
+        const double v_110_200_1 = PB[0]*v_110_100_1 - PC0[l]*v_110_100_2 + 1*oo2p*(v_010_100_1 - v_010_100_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_210_300_0 = PB[0]*v_210_200_0 - PC0[l]*v_210_200_1 + 2*oo2p*(v_110_200_0 - v_110_200_1) + 2*oo2p*(v_210_100_0 - v_210_100_1);
+        const double v_010_100_3 = PB[0]*v_010_000_3 - PC0[l]*v_010_000_4;
+        const double v_110_200_2 = PB[0]*v_110_100_2 - PC0[l]*v_110_100_3 + 1*oo2p*(v_010_100_2 - v_010_100_3) + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_210_300_1 = PB[0]*v_210_200_1 - PC0[l]*v_210_200_2 + 2*oo2p*(v_110_200_1 - v_110_200_2) + 2*oo2p*(v_210_100_1 - v_210_100_2);
+        const double v_310_400_0 = PB[0]*v_310_300_0 - PC0[l]*v_310_300_1 + 3*oo2p*(v_210_300_0 - v_210_300_1) + 3*oo2p*(v_310_200_0 - v_310_200_1);
+        const double v_310_310_0 = PB[1]*v_310_300_0 - PC1[l]*v_310_300_1 + 1*oo2p*(v_300_300_0 - v_300_300_1);
+        const double v_310_301_0 = PB[2]*v_310_300_0 - PC2[l]*v_310_300_1;
+        const double v_310_010_0 = PB[1]*v_310_000_0 - PC1[l]*v_310_000_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_310_010_1 = PB[1]*v_310_000_1 - PC1[l]*v_310_000_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_310_020_0 = PB[1]*v_310_010_0 - PC1[l]*v_310_010_1 + 1*oo2p*(v_300_010_0 - v_300_010_1) + 1*oo2p*(v_310_000_0 - v_310_000_1);
+        const double v_310_010_2 = PB[1]*v_310_000_2 - PC1[l]*v_310_000_3 + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_310_020_1 = PB[1]*v_310_010_1 - PC1[l]*v_310_010_2 + 1*oo2p*(v_300_010_1 - v_300_010_2) + 1*oo2p*(v_310_000_1 - v_310_000_2);
+        const double v_210_010_0 = PB[1]*v_210_000_0 - PC1[l]*v_210_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_210_010_1 = PB[1]*v_210_000_1 - PC1[l]*v_210_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_200_010_0 = PB[1]*v_200_000_0 - PC1[l]*v_200_000_1;
+        const double v_200_010_1 = PB[1]*v_200_000_1 - PC1[l]*v_200_000_2;
+        const double v_210_020_0 = PB[1]*v_210_010_0 - PC1[l]*v_210_010_1 + 1*oo2p*(v_200_010_0 - v_200_010_1) + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_010_2 = PB[1]*v_210_000_2 - PC1[l]*v_210_000_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_200_010_2 = PB[1]*v_200_000_2 - PC1[l]*v_200_000_3;
+        const double v_210_020_1 = PB[1]*v_210_010_1 - PC1[l]*v_210_010_2 + 1*oo2p*(v_200_010_1 - v_200_010_2) + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_310_120_0 = PB[0]*v_310_020_0 - PC0[l]*v_310_020_1 + 3*oo2p*(v_210_020_0 - v_210_020_1);
+        const double v_310_010_3 = PB[1]*v_310_000_3 - PC1[l]*v_310_000_4 + 1*oo2p*(v_300_000_3 - v_300_000_4);
+        const double v_310_020_2 = PB[1]*v_310_010_2 - PC1[l]*v_310_010_3 + 1*oo2p*(v_300_010_2 - v_300_010_3) + 1*oo2p*(v_310_000_2 - v_310_000_3);
+        const double v_210_010_3 = PB[1]*v_210_000_3 - PC1[l]*v_210_000_4 + 1*oo2p*(v_200_000_3 - v_200_000_4);
+        const double v_200_010_3 = PB[1]*v_200_000_3 - PC1[l]*v_200_000_4;
+        const double v_210_020_2 = PB[1]*v_210_010_2 - PC1[l]*v_210_010_3 + 1*oo2p*(v_200_010_2 - v_200_010_3) + 1*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_310_120_1 = PB[0]*v_310_020_1 - PC0[l]*v_310_020_2 + 3*oo2p*(v_210_020_1 - v_210_020_2);
+        const double v_110_010_0 = PB[1]*v_110_000_0 - PC1[l]*v_110_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_110_010_1 = PB[1]*v_110_000_1 - PC1[l]*v_110_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_100_010_0 = PB[1]*v_100_000_0 - PC1[l]*v_100_000_1;
+        const double v_100_010_1 = PB[1]*v_100_000_1 - PC1[l]*v_100_000_2;
+        const double v_110_020_0 = PB[1]*v_110_010_0 - PC1[l]*v_110_010_1 + 1*oo2p*(v_100_010_0 - v_100_010_1) + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_010_2 = PB[1]*v_110_000_2 - PC1[l]*v_110_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_100_010_2 = PB[1]*v_100_000_2 - PC1[l]*v_100_000_3;
+        const double v_110_020_1 = PB[1]*v_110_010_1 - PC1[l]*v_110_010_2 + 1*oo2p*(v_100_010_1 - v_100_010_2) + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_210_120_0 = PB[0]*v_210_020_0 - PC0[l]*v_210_020_1 + 2*oo2p*(v_110_020_0 - v_110_020_1);
+        const double v_110_010_3 = PB[1]*v_110_000_3 - PC1[l]*v_110_000_4 + 1*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_100_010_3 = PB[1]*v_100_000_3 - PC1[l]*v_100_000_4;
+        const double v_110_020_2 = PB[1]*v_110_010_2 - PC1[l]*v_110_010_3 + 1*oo2p*(v_100_010_2 - v_100_010_3) + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_210_120_1 = PB[0]*v_210_020_1 - PC0[l]*v_210_020_2 + 2*oo2p*(v_110_020_1 - v_110_020_2);
+        const double v_310_220_0 = PB[0]*v_310_120_0 - PC0[l]*v_310_120_1 + 3*oo2p*(v_210_120_0 - v_210_120_1) + 1*oo2p*(v_310_020_0 - v_310_020_1);
+        const double v_310_210_0 = PB[1]*v_310_200_0 - PC1[l]*v_310_200_1 + 1*oo2p*(v_300_200_0 - v_300_200_1);
+        const double v_310_210_1 = PB[1]*v_310_200_1 - PC1[l]*v_310_200_2 + 1*oo2p*(v_300_200_1 - v_300_200_2);
+        const double v_310_211_0 = PB[2]*v_310_210_0 - PC2[l]*v_310_210_1;
+        const double v_310_201_0 = PB[2]*v_310_200_0 - PC2[l]*v_310_200_1;
+        const double v_310_201_1 = PB[2]*v_310_200_1 - PC2[l]*v_310_200_2;
+        const double v_310_202_0 = PB[2]*v_310_201_0 - PC2[l]*v_310_201_1 + 1*oo2p*(v_310_200_0 - v_310_200_1);
+        const double v_310_030_0 = PB[1]*v_310_020_0 - PC1[l]*v_310_020_1 + 1*oo2p*(v_300_020_0 - v_300_020_1) + 2*oo2p*(v_310_010_0 - v_310_010_1);
+        const double v_310_030_1 = PB[1]*v_310_020_1 - PC1[l]*v_310_020_2 + 1*oo2p*(v_300_020_1 - v_300_020_2) + 2*oo2p*(v_310_010_1 - v_310_010_2);
+        const double v_200_020_0 = PB[1]*v_200_010_0 - PC1[l]*v_200_010_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_020_1 = PB[1]*v_200_010_1 - PC1[l]*v_200_010_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_210_030_0 = PB[1]*v_210_020_0 - PC1[l]*v_210_020_1 + 1*oo2p*(v_200_020_0 - v_200_020_1) + 2*oo2p*(v_210_010_0 - v_210_010_1);
+        const double v_200_020_2 = PB[1]*v_200_010_2 - PC1[l]*v_200_010_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_210_030_1 = PB[1]*v_210_020_1 - PC1[l]*v_210_020_2 + 1*oo2p*(v_200_020_1 - v_200_020_2) + 2*oo2p*(v_210_010_1 - v_210_010_2);
+        const double v_310_130_0 = PB[0]*v_310_030_0 - PC0[l]*v_310_030_1 + 3*oo2p*(v_210_030_0 - v_210_030_1);
+        const double v_310_121_0 = PB[2]*v_310_120_0 - PC2[l]*v_310_120_1;
+        const double v_310_001_0 = PB[2]*v_310_000_0 - PC2[l]*v_310_000_1;
+        const double v_310_001_1 = PB[2]*v_310_000_1 - PC2[l]*v_310_000_2;
+        const double v_310_002_0 = PB[2]*v_310_001_0 - PC2[l]*v_310_001_1 + 1*oo2p*(v_310_000_0 - v_310_000_1);
+        const double v_310_001_2 = PB[2]*v_310_000_2 - PC2[l]*v_310_000_3;
+        const double v_310_002_1 = PB[2]*v_310_001_1 - PC2[l]*v_310_001_2 + 1*oo2p*(v_310_000_1 - v_310_000_2);
+        const double v_310_012_0 = PB[1]*v_310_002_0 - PC1[l]*v_310_002_1 + 1*oo2p*(v_300_002_0 - v_300_002_1);
+        const double v_310_001_3 = PB[2]*v_310_000_3 - PC2[l]*v_310_000_4;
+        const double v_310_002_2 = PB[2]*v_310_001_2 - PC2[l]*v_310_001_3 + 1*oo2p*(v_310_000_2 - v_310_000_3);
+        const double v_310_012_1 = PB[1]*v_310_002_1 - PC1[l]*v_310_002_2 + 1*oo2p*(v_300_002_1 - v_300_002_2);
+        const double v_210_001_0 = PB[2]*v_210_000_0 - PC2[l]*v_210_000_1;
+        const double v_210_001_1 = PB[2]*v_210_000_1 - PC2[l]*v_210_000_2;
+        const double v_210_002_0 = PB[2]*v_210_001_0 - PC2[l]*v_210_001_1 + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_210_001_2 = PB[2]*v_210_000_2 - PC2[l]*v_210_000_3;
+        const double v_210_002_1 = PB[2]*v_210_001_1 - PC2[l]*v_210_001_2 + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_200_001_0 = PB[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_200_001_1 = PB[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_200_002_0 = PB[2]*v_200_001_0 - PC2[l]*v_200_001_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_200_001_2 = PB[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_200_002_1 = PB[2]*v_200_001_1 - PC2[l]*v_200_001_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_210_012_0 = PB[1]*v_210_002_0 - PC1[l]*v_210_002_1 + 1*oo2p*(v_200_002_0 - v_200_002_1);
+        const double v_210_001_3 = PB[2]*v_210_000_3 - PC2[l]*v_210_000_4;
+        const double v_210_002_2 = PB[2]*v_210_001_2 - PC2[l]*v_210_001_3 + 1*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_200_001_3 = PB[2]*v_200_000_3 - PC2[l]*v_200_000_4;
+        const double v_200_002_2 = PB[2]*v_200_001_2 - PC2[l]*v_200_001_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_210_012_1 = PB[1]*v_210_002_1 - PC1[l]*v_210_002_2 + 1*oo2p*(v_200_002_1 - v_200_002_2);
+        const double v_310_112_0 = PB[0]*v_310_012_0 - PC0[l]*v_310_012_1 + 3*oo2p*(v_210_012_0 - v_210_012_1);
+        const double v_310_003_0 = PB[2]*v_310_002_0 - PC2[l]*v_310_002_1 + 2*oo2p*(v_310_001_0 - v_310_001_1);
+        const double v_310_003_1 = PB[2]*v_310_002_1 - PC2[l]*v_310_002_2 + 2*oo2p*(v_310_001_1 - v_310_001_2);
+        const double v_210_003_0 = PB[2]*v_210_002_0 - PC2[l]*v_210_002_1 + 2*oo2p*(v_210_001_0 - v_210_001_1);
+        const double v_210_003_1 = PB[2]*v_210_002_1 - PC2[l]*v_210_002_2 + 2*oo2p*(v_210_001_1 - v_210_001_2);
+        const double v_310_103_0 = PB[0]*v_310_003_0 - PC0[l]*v_310_003_1 + 3*oo2p*(v_210_003_0 - v_210_003_1);
+        const double v_310_040_0 = PB[1]*v_310_030_0 - PC1[l]*v_310_030_1 + 1*oo2p*(v_300_030_0 - v_300_030_1) + 3*oo2p*(v_310_020_0 - v_310_020_1);
+        const double v_310_031_0 = PB[2]*v_310_030_0 - PC2[l]*v_310_030_1;
+        const double v_310_021_0 = PB[2]*v_310_020_0 - PC2[l]*v_310_020_1;
+        const double v_310_021_1 = PB[2]*v_310_020_1 - PC2[l]*v_310_020_2;
+        const double v_310_022_0 = PB[2]*v_310_021_0 - PC2[l]*v_310_021_1 + 1*oo2p*(v_310_020_0 - v_310_020_1);
+        const double v_310_013_0 = PB[1]*v_310_003_0 - PC1[l]*v_310_003_1 + 1*oo2p*(v_300_003_0 - v_300_003_1);
+        const double v_310_004_0 = PB[2]*v_310_003_0 - PC2[l]*v_310_003_1 + 3*oo2p*(v_310_002_0 - v_310_002_1);
+        const double v_301_000_0 = PA[2]*v_300_000_0 - PC2[l]*v_300_000_1;
+        const double v_301_000_1 = PA[2]*v_300_000_1 - PC2[l]*v_300_000_2;
+        const double v_201_000_0 = PA[2]*v_200_000_0 - PC2[l]*v_200_000_1;
+        const double v_201_000_1 = PA[2]*v_200_000_1 - PC2[l]*v_200_000_2;
+        const double v_301_100_0 = PB[0]*v_301_000_0 - PC0[l]*v_301_000_1 + 3*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_301_000_2 = PA[2]*v_300_000_2 - PC2[l]*v_300_000_3;
+        const double v_201_000_2 = PA[2]*v_200_000_2 - PC2[l]*v_200_000_3;
+        const double v_301_100_1 = PB[0]*v_301_000_1 - PC0[l]*v_301_000_2 + 3*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_001_000_0 = PA[2]*v_000_000_0 - PC2[l]*v_000_000_1;
+        const double v_001_000_1 = PA[2]*v_000_000_1 - PC2[l]*v_000_000_2;
+        const double v_101_000_0 = PA[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_000_2 = PA[2]*v_000_000_2 - PC2[l]*v_000_000_3;
+        const double v_101_000_1 = PA[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_201_100_0 = PB[0]*v_201_000_0 - PC0[l]*v_201_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_001_000_3 = PA[2]*v_000_000_3 - PC2[l]*v_000_000_4;
+        const double v_101_000_2 = PA[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_201_100_1 = PB[0]*v_201_000_1 - PC0[l]*v_201_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_301_200_0 = PB[0]*v_301_100_0 - PC0[l]*v_301_100_1 + 3*oo2p*(v_201_100_0 - v_201_100_1) + 1*oo2p*(v_301_000_0 - v_301_000_1);
+        const double v_301_000_3 = PA[2]*v_300_000_3 - PC2[l]*v_300_000_4;
+        const double v_201_000_3 = PA[2]*v_200_000_3 - PC2[l]*v_200_000_4;
+        const double v_301_100_2 = PB[0]*v_301_000_2 - PC0[l]*v_301_000_3 + 3*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_001_000_4 = PA[2]*v_000_000_4 - PC2[l]*v_000_000_5;
+        const double v_101_000_3 = PA[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_201_100_2 = PB[0]*v_201_000_2 - PC0[l]*v_201_000_3 + 2*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_301_200_1 = PB[0]*v_301_100_1 - PC0[l]*v_301_100_2 + 3*oo2p*(v_201_100_1 - v_201_100_2) + 1*oo2p*(v_301_000_1 - v_301_000_2);
+        const double v_101_100_0 = PB[0]*v_101_000_0 - PC0[l]*v_101_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_101_100_1 = PB[0]*v_101_000_1 - PC0[l]*v_101_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_201_200_0 = PB[0]*v_201_100_0 - PC0[l]*v_201_100_1 + 2*oo2p*(v_101_100_0 - v_101_100_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_101_100_2 = PB[0]*v_101_000_2 - PC0[l]*v_101_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_201_200_1 = PB[0]*v_201_100_1 - PC0[l]*v_201_100_2 + 2*oo2p*(v_101_100_1 - v_101_100_2) + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_301_300_0 = PB[0]*v_301_200_0 - PC0[l]*v_301_200_1 + 3*oo2p*(v_201_200_0 - v_201_200_1) + 2*oo2p*(v_301_100_0 - v_301_100_1);
+        const double v_301_000_4 = PA[2]*v_300_000_4 - PC2[l]*v_300_000_5;
+        const double v_201_000_4 = PA[2]*v_200_000_4 - PC2[l]*v_200_000_5;
+        const double v_301_100_3 = PB[0]*v_301_000_3 - PC0[l]*v_301_000_4 + 3*oo2p*(v_201_000_3 - v_201_000_4);
+        const double v_001_000_5 = PA[2]*v_000_000_5 - PC2[l]*v_000_000_6;
+        const double v_101_000_4 = PA[0]*v_001_000_4 - PC0[l]*v_001_000_5;
+        const double v_201_100_3 = PB[0]*v_201_000_3 - PC0[l]*v_201_000_4 + 2*oo2p*(v_101_000_3 - v_101_000_4);
+        const double v_301_200_2 = PB[0]*v_301_100_2 - PC0[l]*v_301_100_3 + 3*oo2p*(v_201_100_2 - v_201_100_3) + 1*oo2p*(v_301_000_2 - v_301_000_3);
+        const double v_101_100_3 = PB[0]*v_101_000_3 - PC0[l]*v_101_000_4 + 1*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_201_200_2 = PB[0]*v_201_100_2 - PC0[l]*v_201_100_3 + 2*oo2p*(v_101_100_2 - v_101_100_3) + 1*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_301_300_1 = PB[0]*v_301_200_1 - PC0[l]*v_301_200_2 + 3*oo2p*(v_201_200_1 - v_201_200_2) + 2*oo2p*(v_301_100_1 - v_301_100_2);
+        const double v_001_100_0 = PB[0]*v_001_000_0 - PC0[l]*v_001_000_1;
+        const double v_001_100_1 = PB[0]*v_001_000_1 - PC0[l]*v_001_000_2;
+        const double v_101_200_0 = PB[0]*v_101_100_0 - PC0[l]*v_101_100_1 + 1*oo2p*(v_001_100_0 - v_001_100_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_001_100_2 = PB[0]*v_001_000_2 - PC0[l]*v_001_000_3;
+        const double v_101_200_1 = PB[0]*v_101_100_1 - PC0[l]*v_101_100_2 + 1*oo2p*(v_001_100_1 - v_001_100_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_201_300_0 = PB[0]*v_201_200_0 - PC0[l]*v_201_200_1 + 2*oo2p*(v_101_200_0 - v_101_200_1) + 2*oo2p*(v_201_100_0 - v_201_100_1);
+        const double v_001_100_3 = PB[0]*v_001_000_3 - PC0[l]*v_001_000_4;
+        const double v_101_200_2 = PB[0]*v_101_100_2 - PC0[l]*v_101_100_3 + 1*oo2p*(v_001_100_2 - v_001_100_3) + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_201_300_1 = PB[0]*v_201_200_1 - PC0[l]*v_201_200_2 + 2*oo2p*(v_101_200_1 - v_101_200_2) + 2*oo2p*(v_201_100_1 - v_201_100_2);
+        const double v_301_400_0 = PB[0]*v_301_300_0 - PC0[l]*v_301_300_1 + 3*oo2p*(v_201_300_0 - v_201_300_1) + 3*oo2p*(v_301_200_0 - v_301_200_1);
+        const double v_301_310_0 = PB[1]*v_301_300_0 - PC1[l]*v_301_300_1;
+        const double v_301_301_0 = PB[2]*v_301_300_0 - PC2[l]*v_301_300_1 + 1*oo2p*(v_300_300_0 - v_300_300_1);
+        const double v_301_210_0 = PB[1]*v_301_200_0 - PC1[l]*v_301_200_1;
+        const double v_301_210_1 = PB[1]*v_301_200_1 - PC1[l]*v_301_200_2;
+        const double v_301_220_0 = PB[1]*v_301_210_0 - PC1[l]*v_301_210_1 + 1*oo2p*(v_301_200_0 - v_301_200_1);
+        const double v_301_201_0 = PB[2]*v_301_200_0 - PC2[l]*v_301_200_1 + 1*oo2p*(v_300_200_0 - v_300_200_1);
+        const double v_301_201_1 = PB[2]*v_301_200_1 - PC2[l]*v_301_200_2 + 1*oo2p*(v_300_200_1 - v_300_200_2);
+        const double v_301_211_0 = PB[1]*v_301_201_0 - PC1[l]*v_301_201_1;
+        const double v_301_001_0 = PB[2]*v_301_000_0 - PC2[l]*v_301_000_1 + 1*oo2p*(v_300_000_0 - v_300_000_1);
+        const double v_301_001_1 = PB[2]*v_301_000_1 - PC2[l]*v_301_000_2 + 1*oo2p*(v_300_000_1 - v_300_000_2);
+        const double v_301_002_0 = PB[2]*v_301_001_0 - PC2[l]*v_301_001_1 + 1*oo2p*(v_300_001_0 - v_300_001_1) + 1*oo2p*(v_301_000_0 - v_301_000_1);
+        const double v_301_001_2 = PB[2]*v_301_000_2 - PC2[l]*v_301_000_3 + 1*oo2p*(v_300_000_2 - v_300_000_3);
+        const double v_301_002_1 = PB[2]*v_301_001_1 - PC2[l]*v_301_001_2 + 1*oo2p*(v_300_001_1 - v_300_001_2) + 1*oo2p*(v_301_000_1 - v_301_000_2);
+        const double v_201_001_0 = PB[2]*v_201_000_0 - PC2[l]*v_201_000_1 + 1*oo2p*(v_200_000_0 - v_200_000_1);
+        const double v_201_001_1 = PB[2]*v_201_000_1 - PC2[l]*v_201_000_2 + 1*oo2p*(v_200_000_1 - v_200_000_2);
+        const double v_201_002_0 = PB[2]*v_201_001_0 - PC2[l]*v_201_001_1 + 1*oo2p*(v_200_001_0 - v_200_001_1) + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_001_2 = PB[2]*v_201_000_2 - PC2[l]*v_201_000_3 + 1*oo2p*(v_200_000_2 - v_200_000_3);
+        const double v_201_002_1 = PB[2]*v_201_001_1 - PC2[l]*v_201_001_2 + 1*oo2p*(v_200_001_1 - v_200_001_2) + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_301_102_0 = PB[0]*v_301_002_0 - PC0[l]*v_301_002_1 + 3*oo2p*(v_201_002_0 - v_201_002_1);
+        const double v_301_001_3 = PB[2]*v_301_000_3 - PC2[l]*v_301_000_4 + 1*oo2p*(v_300_000_3 - v_300_000_4);
+        const double v_301_002_2 = PB[2]*v_301_001_2 - PC2[l]*v_301_001_3 + 1*oo2p*(v_300_001_2 - v_300_001_3) + 1*oo2p*(v_301_000_2 - v_301_000_3);
+        const double v_201_001_3 = PB[2]*v_201_000_3 - PC2[l]*v_201_000_4 + 1*oo2p*(v_200_000_3 - v_200_000_4);
+        const double v_201_002_2 = PB[2]*v_201_001_2 - PC2[l]*v_201_001_3 + 1*oo2p*(v_200_001_2 - v_200_001_3) + 1*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_301_102_1 = PB[0]*v_301_002_1 - PC0[l]*v_301_002_2 + 3*oo2p*(v_201_002_1 - v_201_002_2);
+        const double v_101_001_0 = PB[2]*v_101_000_0 - PC2[l]*v_101_000_1 + 1*oo2p*(v_100_000_0 - v_100_000_1);
+        const double v_101_001_1 = PB[2]*v_101_000_1 - PC2[l]*v_101_000_2 + 1*oo2p*(v_100_000_1 - v_100_000_2);
+        const double v_100_001_0 = PB[2]*v_100_000_0 - PC2[l]*v_100_000_1;
+        const double v_100_001_1 = PB[2]*v_100_000_1 - PC2[l]*v_100_000_2;
+        const double v_101_002_0 = PB[2]*v_101_001_0 - PC2[l]*v_101_001_1 + 1*oo2p*(v_100_001_0 - v_100_001_1) + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_001_2 = PB[2]*v_101_000_2 - PC2[l]*v_101_000_3 + 1*oo2p*(v_100_000_2 - v_100_000_3);
+        const double v_100_001_2 = PB[2]*v_100_000_2 - PC2[l]*v_100_000_3;
+        const double v_101_002_1 = PB[2]*v_101_001_1 - PC2[l]*v_101_001_2 + 1*oo2p*(v_100_001_1 - v_100_001_2) + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_201_102_0 = PB[0]*v_201_002_0 - PC0[l]*v_201_002_1 + 2*oo2p*(v_101_002_0 - v_101_002_1);
+        const double v_101_001_3 = PB[2]*v_101_000_3 - PC2[l]*v_101_000_4 + 1*oo2p*(v_100_000_3 - v_100_000_4);
+        const double v_100_001_3 = PB[2]*v_100_000_3 - PC2[l]*v_100_000_4;
+        const double v_101_002_2 = PB[2]*v_101_001_2 - PC2[l]*v_101_001_3 + 1*oo2p*(v_100_001_2 - v_100_001_3) + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_201_102_1 = PB[0]*v_201_002_1 - PC0[l]*v_201_002_2 + 2*oo2p*(v_101_002_1 - v_101_002_2);
+        const double v_301_202_0 = PB[0]*v_301_102_0 - PC0[l]*v_301_102_1 + 3*oo2p*(v_201_102_0 - v_201_102_1) + 1*oo2p*(v_301_002_0 - v_301_002_1);
+        const double v_301_010_0 = PB[1]*v_301_000_0 - PC1[l]*v_301_000_1;
+        const double v_301_010_1 = PB[1]*v_301_000_1 - PC1[l]*v_301_000_2;
+        const double v_301_020_0 = PB[1]*v_301_010_0 - PC1[l]*v_301_010_1 + 1*oo2p*(v_301_000_0 - v_301_000_1);
+        const double v_301_010_2 = PB[1]*v_301_000_2 - PC1[l]*v_301_000_3;
+        const double v_301_020_1 = PB[1]*v_301_010_1 - PC1[l]*v_301_010_2 + 1*oo2p*(v_301_000_1 - v_301_000_2);
+        const double v_301_030_0 = PB[1]*v_301_020_0 - PC1[l]*v_301_020_1 + 2*oo2p*(v_301_010_0 - v_301_010_1);
+        const double v_301_010_3 = PB[1]*v_301_000_3 - PC1[l]*v_301_000_4;
+        const double v_301_020_2 = PB[1]*v_301_010_2 - PC1[l]*v_301_010_3 + 1*oo2p*(v_301_000_2 - v_301_000_3);
+        const double v_301_030_1 = PB[1]*v_301_020_1 - PC1[l]*v_301_020_2 + 2*oo2p*(v_301_010_1 - v_301_010_2);
+        const double v_201_010_0 = PB[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_201_010_1 = PB[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_201_020_0 = PB[1]*v_201_010_0 - PC1[l]*v_201_010_1 + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_201_010_2 = PB[1]*v_201_000_2 - PC1[l]*v_201_000_3;
+        const double v_201_020_1 = PB[1]*v_201_010_1 - PC1[l]*v_201_010_2 + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_201_030_0 = PB[1]*v_201_020_0 - PC1[l]*v_201_020_1 + 2*oo2p*(v_201_010_0 - v_201_010_1);
+        const double v_201_010_3 = PB[1]*v_201_000_3 - PC1[l]*v_201_000_4;
+        const double v_201_020_2 = PB[1]*v_201_010_2 - PC1[l]*v_201_010_3 + 1*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_201_030_1 = PB[1]*v_201_020_1 - PC1[l]*v_201_020_2 + 2*oo2p*(v_201_010_1 - v_201_010_2);
+        const double v_301_130_0 = PB[0]*v_301_030_0 - PC0[l]*v_301_030_1 + 3*oo2p*(v_201_030_0 - v_201_030_1);
+        const double v_301_011_0 = PB[1]*v_301_001_0 - PC1[l]*v_301_001_1;
+        const double v_301_011_1 = PB[1]*v_301_001_1 - PC1[l]*v_301_001_2;
+        const double v_301_021_0 = PB[1]*v_301_011_0 - PC1[l]*v_301_011_1 + 1*oo2p*(v_301_001_0 - v_301_001_1);
+        const double v_301_011_2 = PB[1]*v_301_001_2 - PC1[l]*v_301_001_3;
+        const double v_301_021_1 = PB[1]*v_301_011_1 - PC1[l]*v_301_011_2 + 1*oo2p*(v_301_001_1 - v_301_001_2);
+        const double v_201_011_0 = PB[1]*v_201_001_0 - PC1[l]*v_201_001_1;
+        const double v_201_011_1 = PB[1]*v_201_001_1 - PC1[l]*v_201_001_2;
+        const double v_201_021_0 = PB[1]*v_201_011_0 - PC1[l]*v_201_011_1 + 1*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_201_011_2 = PB[1]*v_201_001_2 - PC1[l]*v_201_001_3;
+        const double v_201_021_1 = PB[1]*v_201_011_1 - PC1[l]*v_201_011_2 + 1*oo2p*(v_201_001_1 - v_201_001_2);
+        const double v_301_121_0 = PB[0]*v_301_021_0 - PC0[l]*v_301_021_1 + 3*oo2p*(v_201_021_0 - v_201_021_1);
+        const double v_301_112_0 = PB[1]*v_301_102_0 - PC1[l]*v_301_102_1;
+        const double v_301_003_0 = PB[2]*v_301_002_0 - PC2[l]*v_301_002_1 + 1*oo2p*(v_300_002_0 - v_300_002_1) + 2*oo2p*(v_301_001_0 - v_301_001_1);
+        const double v_301_003_1 = PB[2]*v_301_002_1 - PC2[l]*v_301_002_2 + 1*oo2p*(v_300_002_1 - v_300_002_2) + 2*oo2p*(v_301_001_1 - v_301_001_2);
+        const double v_201_003_0 = PB[2]*v_201_002_0 - PC2[l]*v_201_002_1 + 1*oo2p*(v_200_002_0 - v_200_002_1) + 2*oo2p*(v_201_001_0 - v_201_001_1);
+        const double v_201_003_1 = PB[2]*v_201_002_1 - PC2[l]*v_201_002_2 + 1*oo2p*(v_200_002_1 - v_200_002_2) + 2*oo2p*(v_201_001_1 - v_201_001_2);
+        const double v_301_103_0 = PB[0]*v_301_003_0 - PC0[l]*v_301_003_1 + 3*oo2p*(v_201_003_0 - v_201_003_1);
+        const double v_301_040_0 = PB[1]*v_301_030_0 - PC1[l]*v_301_030_1 + 3*oo2p*(v_301_020_0 - v_301_020_1);
+        const double v_301_031_0 = PB[1]*v_301_021_0 - PC1[l]*v_301_021_1 + 2*oo2p*(v_301_011_0 - v_301_011_1);
+        const double v_301_012_0 = PB[1]*v_301_002_0 - PC1[l]*v_301_002_1;
+        const double v_301_012_1 = PB[1]*v_301_002_1 - PC1[l]*v_301_002_2;
+        const double v_301_022_0 = PB[1]*v_301_012_0 - PC1[l]*v_301_012_1 + 1*oo2p*(v_301_002_0 - v_301_002_1);
+        const double v_301_013_0 = PB[1]*v_301_003_0 - PC1[l]*v_301_003_1;
+        const double v_301_004_0 = PB[2]*v_301_003_0 - PC2[l]*v_301_003_1 + 1*oo2p*(v_300_003_0 - v_300_003_1) + 3*oo2p*(v_301_002_0 - v_301_002_1);
+        const double v_020_000_0 = PA[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_020_000_1 = PA[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_120_000_0 = PA[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_000_2 = PA[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_120_000_1 = PA[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_220_000_0 = PA[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_000_3 = PA[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_120_000_2 = PA[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_220_000_1 = PA[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_220_100_0 = PB[0]*v_220_000_0 - PC0[l]*v_220_000_1 + 2*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_020_000_4 = PA[1]*v_010_000_4 - PC1[l]*v_010_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_120_000_3 = PA[0]*v_020_000_3 - PC0[l]*v_020_000_4;
+        const double v_220_000_2 = PA[0]*v_120_000_2 - PC0[l]*v_120_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_220_100_1 = PB[0]*v_220_000_1 - PC0[l]*v_220_000_2 + 2*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_120_100_0 = PB[0]*v_120_000_0 - PC0[l]*v_120_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_120_100_1 = PB[0]*v_120_000_1 - PC0[l]*v_120_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_220_200_0 = PB[0]*v_220_100_0 - PC0[l]*v_220_100_1 + 2*oo2p*(v_120_100_0 - v_120_100_1) + 1*oo2p*(v_220_000_0 - v_220_000_1);
+        const double v_010_000_6 = PA[1]*v_000_000_6 - PC1[l]*v_000_000_7;
+        const double v_020_000_5 = PA[1]*v_010_000_5 - PC1[l]*v_010_000_6 + 1*oo2p*(v_000_000_5 - v_000_000_6);
+        const double v_120_000_4 = PA[0]*v_020_000_4 - PC0[l]*v_020_000_5;
+        const double v_220_000_3 = PA[0]*v_120_000_3 - PC0[l]*v_120_000_4 + 1*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_220_100_2 = PB[0]*v_220_000_2 - PC0[l]*v_220_000_3 + 2*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_120_100_2 = PB[0]*v_120_000_2 - PC0[l]*v_120_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_220_200_1 = PB[0]*v_220_100_1 - PC0[l]*v_220_100_2 + 2*oo2p*(v_120_100_1 - v_120_100_2) + 1*oo2p*(v_220_000_1 - v_220_000_2);
+        const double v_020_100_0 = PB[0]*v_020_000_0 - PC0[l]*v_020_000_1;
+        const double v_020_100_1 = PB[0]*v_020_000_1 - PC0[l]*v_020_000_2;
+        const double v_120_200_0 = PB[0]*v_120_100_0 - PC0[l]*v_120_100_1 + 1*oo2p*(v_020_100_0 - v_020_100_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_020_100_2 = PB[0]*v_020_000_2 - PC0[l]*v_020_000_3;
+        const double v_120_200_1 = PB[0]*v_120_100_1 - PC0[l]*v_120_100_2 + 1*oo2p*(v_020_100_1 - v_020_100_2) + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_220_300_0 = PB[0]*v_220_200_0 - PC0[l]*v_220_200_1 + 2*oo2p*(v_120_200_0 - v_120_200_1) + 2*oo2p*(v_220_100_0 - v_220_100_1);
+        const double v_010_000_7 = PA[1]*v_000_000_7 - PC1[l]*v_000_000_8;
+        const double v_020_000_6 = PA[1]*v_010_000_6 - PC1[l]*v_010_000_7 + 1*oo2p*(v_000_000_6 - v_000_000_7);
+        const double v_120_000_5 = PA[0]*v_020_000_5 - PC0[l]*v_020_000_6;
+        const double v_220_000_4 = PA[0]*v_120_000_4 - PC0[l]*v_120_000_5 + 1*oo2p*(v_020_000_4 - v_020_000_5);
+        const double v_220_100_3 = PB[0]*v_220_000_3 - PC0[l]*v_220_000_4 + 2*oo2p*(v_120_000_3 - v_120_000_4);
+        const double v_120_100_3 = PB[0]*v_120_000_3 - PC0[l]*v_120_000_4 + 1*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_220_200_2 = PB[0]*v_220_100_2 - PC0[l]*v_220_100_3 + 2*oo2p*(v_120_100_2 - v_120_100_3) + 1*oo2p*(v_220_000_2 - v_220_000_3);
+        const double v_020_100_3 = PB[0]*v_020_000_3 - PC0[l]*v_020_000_4;
+        const double v_120_200_2 = PB[0]*v_120_100_2 - PC0[l]*v_120_100_3 + 1*oo2p*(v_020_100_2 - v_020_100_3) + 1*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_220_300_1 = PB[0]*v_220_200_1 - PC0[l]*v_220_200_2 + 2*oo2p*(v_120_200_1 - v_120_200_2) + 2*oo2p*(v_220_100_1 - v_220_100_2);
+        const double v_020_200_0 = PB[0]*v_020_100_0 - PC0[l]*v_020_100_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_200_1 = PB[0]*v_020_100_1 - PC0[l]*v_020_100_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_120_300_0 = PB[0]*v_120_200_0 - PC0[l]*v_120_200_1 + 1*oo2p*(v_020_200_0 - v_020_200_1) + 2*oo2p*(v_120_100_0 - v_120_100_1);
+        const double v_020_200_2 = PB[0]*v_020_100_2 - PC0[l]*v_020_100_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_120_300_1 = PB[0]*v_120_200_1 - PC0[l]*v_120_200_2 + 1*oo2p*(v_020_200_1 - v_020_200_2) + 2*oo2p*(v_120_100_1 - v_120_100_2);
+        const double v_220_400_0 = PB[0]*v_220_300_0 - PC0[l]*v_220_300_1 + 2*oo2p*(v_120_300_0 - v_120_300_1) + 3*oo2p*(v_220_200_0 - v_220_200_1);
+        const double v_220_310_0 = PB[1]*v_220_300_0 - PC1[l]*v_220_300_1 + 2*oo2p*(v_210_300_0 - v_210_300_1);
+        const double v_220_301_0 = PB[2]*v_220_300_0 - PC2[l]*v_220_300_1;
+        const double v_220_010_0 = PB[1]*v_220_000_0 - PC1[l]*v_220_000_1 + 2*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_220_010_1 = PB[1]*v_220_000_1 - PC1[l]*v_220_000_2 + 2*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_220_020_0 = PB[1]*v_220_010_0 - PC1[l]*v_220_010_1 + 2*oo2p*(v_210_010_0 - v_210_010_1) + 1*oo2p*(v_220_000_0 - v_220_000_1);
+        const double v_220_010_2 = PB[1]*v_220_000_2 - PC1[l]*v_220_000_3 + 2*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_220_020_1 = PB[1]*v_220_010_1 - PC1[l]*v_220_010_2 + 2*oo2p*(v_210_010_1 - v_210_010_2) + 1*oo2p*(v_220_000_1 - v_220_000_2);
+        const double v_120_010_0 = PB[1]*v_120_000_0 - PC1[l]*v_120_000_1 + 2*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_120_010_1 = PB[1]*v_120_000_1 - PC1[l]*v_120_000_2 + 2*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_120_020_0 = PB[1]*v_120_010_0 - PC1[l]*v_120_010_1 + 2*oo2p*(v_110_010_0 - v_110_010_1) + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_010_2 = PB[1]*v_120_000_2 - PC1[l]*v_120_000_3 + 2*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_120_020_1 = PB[1]*v_120_010_1 - PC1[l]*v_120_010_2 + 2*oo2p*(v_110_010_1 - v_110_010_2) + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_220_120_0 = PB[0]*v_220_020_0 - PC0[l]*v_220_020_1 + 2*oo2p*(v_120_020_0 - v_120_020_1);
+        const double v_220_010_3 = PB[1]*v_220_000_3 - PC1[l]*v_220_000_4 + 2*oo2p*(v_210_000_3 - v_210_000_4);
+        const double v_220_020_2 = PB[1]*v_220_010_2 - PC1[l]*v_220_010_3 + 2*oo2p*(v_210_010_2 - v_210_010_3) + 1*oo2p*(v_220_000_2 - v_220_000_3);
+        const double v_120_010_3 = PB[1]*v_120_000_3 - PC1[l]*v_120_000_4 + 2*oo2p*(v_110_000_3 - v_110_000_4);
+        const double v_120_020_2 = PB[1]*v_120_010_2 - PC1[l]*v_120_010_3 + 2*oo2p*(v_110_010_2 - v_110_010_3) + 1*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_220_120_1 = PB[0]*v_220_020_1 - PC0[l]*v_220_020_2 + 2*oo2p*(v_120_020_1 - v_120_020_2);
+        const double v_020_010_0 = PB[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_020_010_1 = PB[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_010_0 = PB[1]*v_010_000_0 - PC1[l]*v_010_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_010_010_1 = PB[1]*v_010_000_1 - PC1[l]*v_010_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_020_020_0 = PB[1]*v_020_010_0 - PC1[l]*v_020_010_1 + 2*oo2p*(v_010_010_0 - v_010_010_1) + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_010_2 = PB[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_010_010_2 = PB[1]*v_010_000_2 - PC1[l]*v_010_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_020_020_1 = PB[1]*v_020_010_1 - PC1[l]*v_020_010_2 + 2*oo2p*(v_010_010_1 - v_010_010_2) + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_120_120_0 = PB[0]*v_120_020_0 - PC0[l]*v_120_020_1 + 1*oo2p*(v_020_020_0 - v_020_020_1);
+        const double v_020_010_3 = PB[1]*v_020_000_3 - PC1[l]*v_020_000_4 + 2*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_010_010_3 = PB[1]*v_010_000_3 - PC1[l]*v_010_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_020_020_2 = PB[1]*v_020_010_2 - PC1[l]*v_020_010_3 + 2*oo2p*(v_010_010_2 - v_010_010_3) + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_120_120_1 = PB[0]*v_120_020_1 - PC0[l]*v_120_020_2 + 1*oo2p*(v_020_020_1 - v_020_020_2);
+        const double v_220_220_0 = PB[0]*v_220_120_0 - PC0[l]*v_220_120_1 + 2*oo2p*(v_120_120_0 - v_120_120_1) + 1*oo2p*(v_220_020_0 - v_220_020_1);
+        const double v_220_210_0 = PB[1]*v_220_200_0 - PC1[l]*v_220_200_1 + 2*oo2p*(v_210_200_0 - v_210_200_1);
+        const double v_220_210_1 = PB[1]*v_220_200_1 - PC1[l]*v_220_200_2 + 2*oo2p*(v_210_200_1 - v_210_200_2);
+        const double v_220_211_0 = PB[2]*v_220_210_0 - PC2[l]*v_220_210_1;
+        const double v_220_201_0 = PB[2]*v_220_200_0 - PC2[l]*v_220_200_1;
+        const double v_220_201_1 = PB[2]*v_220_200_1 - PC2[l]*v_220_200_2;
+        const double v_220_202_0 = PB[2]*v_220_201_0 - PC2[l]*v_220_201_1 + 1*oo2p*(v_220_200_0 - v_220_200_1);
+        const double v_220_030_0 = PB[1]*v_220_020_0 - PC1[l]*v_220_020_1 + 2*oo2p*(v_210_020_0 - v_210_020_1) + 2*oo2p*(v_220_010_0 - v_220_010_1);
+        const double v_220_030_1 = PB[1]*v_220_020_1 - PC1[l]*v_220_020_2 + 2*oo2p*(v_210_020_1 - v_210_020_2) + 2*oo2p*(v_220_010_1 - v_220_010_2);
+        const double v_120_030_0 = PB[1]*v_120_020_0 - PC1[l]*v_120_020_1 + 2*oo2p*(v_110_020_0 - v_110_020_1) + 2*oo2p*(v_120_010_0 - v_120_010_1);
+        const double v_120_030_1 = PB[1]*v_120_020_1 - PC1[l]*v_120_020_2 + 2*oo2p*(v_110_020_1 - v_110_020_2) + 2*oo2p*(v_120_010_1 - v_120_010_2);
+        const double v_220_130_0 = PB[0]*v_220_030_0 - PC0[l]*v_220_030_1 + 2*oo2p*(v_120_030_0 - v_120_030_1);
+        const double v_220_121_0 = PB[2]*v_220_120_0 - PC2[l]*v_220_120_1;
+        const double v_220_001_0 = PB[2]*v_220_000_0 - PC2[l]*v_220_000_1;
+        const double v_220_001_1 = PB[2]*v_220_000_1 - PC2[l]*v_220_000_2;
+        const double v_220_002_0 = PB[2]*v_220_001_0 - PC2[l]*v_220_001_1 + 1*oo2p*(v_220_000_0 - v_220_000_1);
+        const double v_220_001_2 = PB[2]*v_220_000_2 - PC2[l]*v_220_000_3;
+        const double v_220_002_1 = PB[2]*v_220_001_1 - PC2[l]*v_220_001_2 + 1*oo2p*(v_220_000_1 - v_220_000_2);
+        const double v_220_012_0 = PB[1]*v_220_002_0 - PC1[l]*v_220_002_1 + 2*oo2p*(v_210_002_0 - v_210_002_1);
+        const double v_220_001_3 = PB[2]*v_220_000_3 - PC2[l]*v_220_000_4;
+        const double v_220_002_2 = PB[2]*v_220_001_2 - PC2[l]*v_220_001_3 + 1*oo2p*(v_220_000_2 - v_220_000_3);
+        const double v_220_012_1 = PB[1]*v_220_002_1 - PC1[l]*v_220_002_2 + 2*oo2p*(v_210_002_1 - v_210_002_2);
+        const double v_120_001_0 = PB[2]*v_120_000_0 - PC2[l]*v_120_000_1;
+        const double v_120_001_1 = PB[2]*v_120_000_1 - PC2[l]*v_120_000_2;
+        const double v_120_002_0 = PB[2]*v_120_001_0 - PC2[l]*v_120_001_1 + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_120_001_2 = PB[2]*v_120_000_2 - PC2[l]*v_120_000_3;
+        const double v_120_002_1 = PB[2]*v_120_001_1 - PC2[l]*v_120_001_2 + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_110_001_0 = PB[2]*v_110_000_0 - PC2[l]*v_110_000_1;
+        const double v_110_001_1 = PB[2]*v_110_000_1 - PC2[l]*v_110_000_2;
+        const double v_110_002_0 = PB[2]*v_110_001_0 - PC2[l]*v_110_001_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_110_001_2 = PB[2]*v_110_000_2 - PC2[l]*v_110_000_3;
+        const double v_110_002_1 = PB[2]*v_110_001_1 - PC2[l]*v_110_001_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_120_012_0 = PB[1]*v_120_002_0 - PC1[l]*v_120_002_1 + 2*oo2p*(v_110_002_0 - v_110_002_1);
+        const double v_120_001_3 = PB[2]*v_120_000_3 - PC2[l]*v_120_000_4;
+        const double v_120_002_2 = PB[2]*v_120_001_2 - PC2[l]*v_120_001_3 + 1*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_110_001_3 = PB[2]*v_110_000_3 - PC2[l]*v_110_000_4;
+        const double v_110_002_2 = PB[2]*v_110_001_2 - PC2[l]*v_110_001_3 + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_120_012_1 = PB[1]*v_120_002_1 - PC1[l]*v_120_002_2 + 2*oo2p*(v_110_002_1 - v_110_002_2);
+        const double v_220_112_0 = PB[0]*v_220_012_0 - PC0[l]*v_220_012_1 + 2*oo2p*(v_120_012_0 - v_120_012_1);
+        const double v_220_003_0 = PB[2]*v_220_002_0 - PC2[l]*v_220_002_1 + 2*oo2p*(v_220_001_0 - v_220_001_1);
+        const double v_220_003_1 = PB[2]*v_220_002_1 - PC2[l]*v_220_002_2 + 2*oo2p*(v_220_001_1 - v_220_001_2);
+        const double v_120_003_0 = PB[2]*v_120_002_0 - PC2[l]*v_120_002_1 + 2*oo2p*(v_120_001_0 - v_120_001_1);
+        const double v_120_003_1 = PB[2]*v_120_002_1 - PC2[l]*v_120_002_2 + 2*oo2p*(v_120_001_1 - v_120_001_2);
+        const double v_220_103_0 = PB[0]*v_220_003_0 - PC0[l]*v_220_003_1 + 2*oo2p*(v_120_003_0 - v_120_003_1);
+        const double v_220_040_0 = PB[1]*v_220_030_0 - PC1[l]*v_220_030_1 + 2*oo2p*(v_210_030_0 - v_210_030_1) + 3*oo2p*(v_220_020_0 - v_220_020_1);
+        const double v_220_031_0 = PB[2]*v_220_030_0 - PC2[l]*v_220_030_1;
+        const double v_220_021_0 = PB[2]*v_220_020_0 - PC2[l]*v_220_020_1;
+        const double v_220_021_1 = PB[2]*v_220_020_1 - PC2[l]*v_220_020_2;
+        const double v_220_022_0 = PB[2]*v_220_021_0 - PC2[l]*v_220_021_1 + 1*oo2p*(v_220_020_0 - v_220_020_1);
+        const double v_220_013_0 = PB[1]*v_220_003_0 - PC1[l]*v_220_003_1 + 2*oo2p*(v_210_003_0 - v_210_003_1);
+        const double v_220_004_0 = PB[2]*v_220_003_0 - PC2[l]*v_220_003_1 + 3*oo2p*(v_220_002_0 - v_220_002_1);
+        const double v_211_000_0 = PA[1]*v_201_000_0 - PC1[l]*v_201_000_1;
+        const double v_211_000_1 = PA[1]*v_201_000_1 - PC1[l]*v_201_000_2;
+        const double v_011_000_0 = PA[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_011_000_1 = PA[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_111_000_0 = PA[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_000_2 = PA[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_111_000_1 = PA[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_211_100_0 = PB[0]*v_211_000_0 - PC0[l]*v_211_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_211_000_2 = PA[1]*v_201_000_2 - PC1[l]*v_201_000_3;
+        const double v_011_000_3 = PA[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_111_000_2 = PA[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_211_100_1 = PB[0]*v_211_000_1 - PC0[l]*v_211_000_2 + 2*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_111_100_0 = PB[0]*v_111_000_0 - PC0[l]*v_111_000_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_111_100_1 = PB[0]*v_111_000_1 - PC0[l]*v_111_000_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_211_200_0 = PB[0]*v_211_100_0 - PC0[l]*v_211_100_1 + 2*oo2p*(v_111_100_0 - v_111_100_1) + 1*oo2p*(v_211_000_0 - v_211_000_1);
+        const double v_211_000_3 = PA[1]*v_201_000_3 - PC1[l]*v_201_000_4;
+        const double v_011_000_4 = PA[1]*v_001_000_4 - PC1[l]*v_001_000_5;
+        const double v_111_000_3 = PA[0]*v_011_000_3 - PC0[l]*v_011_000_4;
+        const double v_211_100_2 = PB[0]*v_211_000_2 - PC0[l]*v_211_000_3 + 2*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_111_100_2 = PB[0]*v_111_000_2 - PC0[l]*v_111_000_3 + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_211_200_1 = PB[0]*v_211_100_1 - PC0[l]*v_211_100_2 + 2*oo2p*(v_111_100_1 - v_111_100_2) + 1*oo2p*(v_211_000_1 - v_211_000_2);
+        const double v_011_100_0 = PB[0]*v_011_000_0 - PC0[l]*v_011_000_1;
+        const double v_011_100_1 = PB[0]*v_011_000_1 - PC0[l]*v_011_000_2;
+        const double v_111_200_0 = PB[0]*v_111_100_0 - PC0[l]*v_111_100_1 + 1*oo2p*(v_011_100_0 - v_011_100_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_011_100_2 = PB[0]*v_011_000_2 - PC0[l]*v_011_000_3;
+        const double v_111_200_1 = PB[0]*v_111_100_1 - PC0[l]*v_111_100_2 + 1*oo2p*(v_011_100_1 - v_011_100_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_211_300_0 = PB[0]*v_211_200_0 - PC0[l]*v_211_200_1 + 2*oo2p*(v_111_200_0 - v_111_200_1) + 2*oo2p*(v_211_100_0 - v_211_100_1);
+        const double v_201_000_5 = PA[2]*v_200_000_5 - PC2[l]*v_200_000_6;
+        const double v_211_000_4 = PA[1]*v_201_000_4 - PC1[l]*v_201_000_5;
+        const double v_001_000_6 = PA[2]*v_000_000_6 - PC2[l]*v_000_000_7;
+        const double v_011_000_5 = PA[1]*v_001_000_5 - PC1[l]*v_001_000_6;
+        const double v_111_000_4 = PA[0]*v_011_000_4 - PC0[l]*v_011_000_5;
+        const double v_211_100_3 = PB[0]*v_211_000_3 - PC0[l]*v_211_000_4 + 2*oo2p*(v_111_000_3 - v_111_000_4);
+        const double v_111_100_3 = PB[0]*v_111_000_3 - PC0[l]*v_111_000_4 + 1*oo2p*(v_011_000_3 - v_011_000_4);
+        const double v_211_200_2 = PB[0]*v_211_100_2 - PC0[l]*v_211_100_3 + 2*oo2p*(v_111_100_2 - v_111_100_3) + 1*oo2p*(v_211_000_2 - v_211_000_3);
+        const double v_011_100_3 = PB[0]*v_011_000_3 - PC0[l]*v_011_000_4;
+        const double v_111_200_2 = PB[0]*v_111_100_2 - PC0[l]*v_111_100_3 + 1*oo2p*(v_011_100_2 - v_011_100_3) + 1*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_211_300_1 = PB[0]*v_211_200_1 - PC0[l]*v_211_200_2 + 2*oo2p*(v_111_200_1 - v_111_200_2) + 2*oo2p*(v_211_100_1 - v_211_100_2);
+        const double v_011_200_0 = PB[0]*v_011_100_0 - PC0[l]*v_011_100_1 + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_200_1 = PB[0]*v_011_100_1 - PC0[l]*v_011_100_2 + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_111_300_0 = PB[0]*v_111_200_0 - PC0[l]*v_111_200_1 + 1*oo2p*(v_011_200_0 - v_011_200_1) + 2*oo2p*(v_111_100_0 - v_111_100_1);
+        const double v_011_200_2 = PB[0]*v_011_100_2 - PC0[l]*v_011_100_3 + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_111_300_1 = PB[0]*v_111_200_1 - PC0[l]*v_111_200_2 + 1*oo2p*(v_011_200_1 - v_011_200_2) + 2*oo2p*(v_111_100_1 - v_111_100_2);
+        const double v_211_400_0 = PB[0]*v_211_300_0 - PC0[l]*v_211_300_1 + 2*oo2p*(v_111_300_0 - v_111_300_1) + 3*oo2p*(v_211_200_0 - v_211_200_1);
+        const double v_211_310_0 = PB[1]*v_211_300_0 - PC1[l]*v_211_300_1 + 1*oo2p*(v_201_300_0 - v_201_300_1);
+        const double v_211_301_0 = PB[2]*v_211_300_0 - PC2[l]*v_211_300_1 + 1*oo2p*(v_210_300_0 - v_210_300_1);
+        const double v_211_010_0 = PB[1]*v_211_000_0 - PC1[l]*v_211_000_1 + 1*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_211_010_1 = PB[1]*v_211_000_1 - PC1[l]*v_211_000_2 + 1*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_211_020_0 = PB[1]*v_211_010_0 - PC1[l]*v_211_010_1 + 1*oo2p*(v_201_010_0 - v_201_010_1) + 1*oo2p*(v_211_000_0 - v_211_000_1);
+        const double v_211_010_2 = PB[1]*v_211_000_2 - PC1[l]*v_211_000_3 + 1*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_211_020_1 = PB[1]*v_211_010_1 - PC1[l]*v_211_010_2 + 1*oo2p*(v_201_010_1 - v_201_010_2) + 1*oo2p*(v_211_000_1 - v_211_000_2);
+        const double v_111_010_0 = PB[1]*v_111_000_0 - PC1[l]*v_111_000_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_111_010_1 = PB[1]*v_111_000_1 - PC1[l]*v_111_000_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_101_010_0 = PB[1]*v_101_000_0 - PC1[l]*v_101_000_1;
+        const double v_101_010_1 = PB[1]*v_101_000_1 - PC1[l]*v_101_000_2;
+        const double v_111_020_0 = PB[1]*v_111_010_0 - PC1[l]*v_111_010_1 + 1*oo2p*(v_101_010_0 - v_101_010_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_111_010_2 = PB[1]*v_111_000_2 - PC1[l]*v_111_000_3 + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_101_010_2 = PB[1]*v_101_000_2 - PC1[l]*v_101_000_3;
+        const double v_111_020_1 = PB[1]*v_111_010_1 - PC1[l]*v_111_010_2 + 1*oo2p*(v_101_010_1 - v_101_010_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_211_120_0 = PB[0]*v_211_020_0 - PC0[l]*v_211_020_1 + 2*oo2p*(v_111_020_0 - v_111_020_1);
+        const double v_211_010_3 = PB[1]*v_211_000_3 - PC1[l]*v_211_000_4 + 1*oo2p*(v_201_000_3 - v_201_000_4);
+        const double v_211_020_2 = PB[1]*v_211_010_2 - PC1[l]*v_211_010_3 + 1*oo2p*(v_201_010_2 - v_201_010_3) + 1*oo2p*(v_211_000_2 - v_211_000_3);
+        const double v_111_010_3 = PB[1]*v_111_000_3 - PC1[l]*v_111_000_4 + 1*oo2p*(v_101_000_3 - v_101_000_4);
+        const double v_101_010_3 = PB[1]*v_101_000_3 - PC1[l]*v_101_000_4;
+        const double v_111_020_2 = PB[1]*v_111_010_2 - PC1[l]*v_111_010_3 + 1*oo2p*(v_101_010_2 - v_101_010_3) + 1*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_211_120_1 = PB[0]*v_211_020_1 - PC0[l]*v_211_020_2 + 2*oo2p*(v_111_020_1 - v_111_020_2);
+        const double v_011_010_0 = PB[1]*v_011_000_0 - PC1[l]*v_011_000_1 + 1*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_011_010_1 = PB[1]*v_011_000_1 - PC1[l]*v_011_000_2 + 1*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_010_0 = PB[1]*v_001_000_0 - PC1[l]*v_001_000_1;
+        const double v_001_010_1 = PB[1]*v_001_000_1 - PC1[l]*v_001_000_2;
+        const double v_011_020_0 = PB[1]*v_011_010_0 - PC1[l]*v_011_010_1 + 1*oo2p*(v_001_010_0 - v_001_010_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_010_2 = PB[1]*v_011_000_2 - PC1[l]*v_011_000_3 + 1*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_010_2 = PB[1]*v_001_000_2 - PC1[l]*v_001_000_3;
+        const double v_011_020_1 = PB[1]*v_011_010_1 - PC1[l]*v_011_010_2 + 1*oo2p*(v_001_010_1 - v_001_010_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_111_120_0 = PB[0]*v_111_020_0 - PC0[l]*v_111_020_1 + 1*oo2p*(v_011_020_0 - v_011_020_1);
+        const double v_011_010_3 = PB[1]*v_011_000_3 - PC1[l]*v_011_000_4 + 1*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_001_010_3 = PB[1]*v_001_000_3 - PC1[l]*v_001_000_4;
+        const double v_011_020_2 = PB[1]*v_011_010_2 - PC1[l]*v_011_010_3 + 1*oo2p*(v_001_010_2 - v_001_010_3) + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_111_120_1 = PB[0]*v_111_020_1 - PC0[l]*v_111_020_2 + 1*oo2p*(v_011_020_1 - v_011_020_2);
+        const double v_211_220_0 = PB[0]*v_211_120_0 - PC0[l]*v_211_120_1 + 2*oo2p*(v_111_120_0 - v_111_120_1) + 1*oo2p*(v_211_020_0 - v_211_020_1);
+        const double v_211_201_0 = PB[2]*v_211_200_0 - PC2[l]*v_211_200_1 + 1*oo2p*(v_210_200_0 - v_210_200_1);
+        const double v_211_201_1 = PB[2]*v_211_200_1 - PC2[l]*v_211_200_2 + 1*oo2p*(v_210_200_1 - v_210_200_2);
+        const double v_201_201_0 = PB[2]*v_201_200_0 - PC2[l]*v_201_200_1 + 1*oo2p*(v_200_200_0 - v_200_200_1);
+        const double v_201_201_1 = PB[2]*v_201_200_1 - PC2[l]*v_201_200_2 + 1*oo2p*(v_200_200_1 - v_200_200_2);
+        const double v_211_211_0 = PB[1]*v_211_201_0 - PC1[l]*v_211_201_1 + 1*oo2p*(v_201_201_0 - v_201_201_1);
+        const double v_211_001_0 = PB[2]*v_211_000_0 - PC2[l]*v_211_000_1 + 1*oo2p*(v_210_000_0 - v_210_000_1);
+        const double v_211_001_1 = PB[2]*v_211_000_1 - PC2[l]*v_211_000_2 + 1*oo2p*(v_210_000_1 - v_210_000_2);
+        const double v_211_002_0 = PB[2]*v_211_001_0 - PC2[l]*v_211_001_1 + 1*oo2p*(v_210_001_0 - v_210_001_1) + 1*oo2p*(v_211_000_0 - v_211_000_1);
+        const double v_211_001_2 = PB[2]*v_211_000_2 - PC2[l]*v_211_000_3 + 1*oo2p*(v_210_000_2 - v_210_000_3);
+        const double v_211_002_1 = PB[2]*v_211_001_1 - PC2[l]*v_211_001_2 + 1*oo2p*(v_210_001_1 - v_210_001_2) + 1*oo2p*(v_211_000_1 - v_211_000_2);
+        const double v_111_001_0 = PB[2]*v_111_000_0 - PC2[l]*v_111_000_1 + 1*oo2p*(v_110_000_0 - v_110_000_1);
+        const double v_111_001_1 = PB[2]*v_111_000_1 - PC2[l]*v_111_000_2 + 1*oo2p*(v_110_000_1 - v_110_000_2);
+        const double v_111_002_0 = PB[2]*v_111_001_0 - PC2[l]*v_111_001_1 + 1*oo2p*(v_110_001_0 - v_110_001_1) + 1*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_111_001_2 = PB[2]*v_111_000_2 - PC2[l]*v_111_000_3 + 1*oo2p*(v_110_000_2 - v_110_000_3);
+        const double v_111_002_1 = PB[2]*v_111_001_1 - PC2[l]*v_111_001_2 + 1*oo2p*(v_110_001_1 - v_110_001_2) + 1*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_211_102_0 = PB[0]*v_211_002_0 - PC0[l]*v_211_002_1 + 2*oo2p*(v_111_002_0 - v_111_002_1);
+        const double v_211_001_3 = PB[2]*v_211_000_3 - PC2[l]*v_211_000_4 + 1*oo2p*(v_210_000_3 - v_210_000_4);
+        const double v_211_002_2 = PB[2]*v_211_001_2 - PC2[l]*v_211_001_3 + 1*oo2p*(v_210_001_2 - v_210_001_3) + 1*oo2p*(v_211_000_2 - v_211_000_3);
+        const double v_111_001_3 = PB[2]*v_111_000_3 - PC2[l]*v_111_000_4 + 1*oo2p*(v_110_000_3 - v_110_000_4);
+        const double v_111_002_2 = PB[2]*v_111_001_2 - PC2[l]*v_111_001_3 + 1*oo2p*(v_110_001_2 - v_110_001_3) + 1*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_211_102_1 = PB[0]*v_211_002_1 - PC0[l]*v_211_002_2 + 2*oo2p*(v_111_002_1 - v_111_002_2);
+        const double v_011_001_0 = PB[2]*v_011_000_0 - PC2[l]*v_011_000_1 + 1*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_011_001_1 = PB[2]*v_011_000_1 - PC2[l]*v_011_000_2 + 1*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_010_001_0 = PB[2]*v_010_000_0 - PC2[l]*v_010_000_1;
+        const double v_010_001_1 = PB[2]*v_010_000_1 - PC2[l]*v_010_000_2;
+        const double v_011_002_0 = PB[2]*v_011_001_0 - PC2[l]*v_011_001_1 + 1*oo2p*(v_010_001_0 - v_010_001_1) + 1*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_011_001_2 = PB[2]*v_011_000_2 - PC2[l]*v_011_000_3 + 1*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_010_001_2 = PB[2]*v_010_000_2 - PC2[l]*v_010_000_3;
+        const double v_011_002_1 = PB[2]*v_011_001_1 - PC2[l]*v_011_001_2 + 1*oo2p*(v_010_001_1 - v_010_001_2) + 1*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_111_102_0 = PB[0]*v_111_002_0 - PC0[l]*v_111_002_1 + 1*oo2p*(v_011_002_0 - v_011_002_1);
+        const double v_011_001_3 = PB[2]*v_011_000_3 - PC2[l]*v_011_000_4 + 1*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_010_001_3 = PB[2]*v_010_000_3 - PC2[l]*v_010_000_4;
+        const double v_011_002_2 = PB[2]*v_011_001_2 - PC2[l]*v_011_001_3 + 1*oo2p*(v_010_001_2 - v_010_001_3) + 1*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_111_102_1 = PB[0]*v_111_002_1 - PC0[l]*v_111_002_2 + 1*oo2p*(v_011_002_1 - v_011_002_2);
+        const double v_211_202_0 = PB[0]*v_211_102_0 - PC0[l]*v_211_102_1 + 2*oo2p*(v_111_102_0 - v_111_102_1) + 1*oo2p*(v_211_002_0 - v_211_002_1);
+        const double v_211_030_0 = PB[1]*v_211_020_0 - PC1[l]*v_211_020_1 + 1*oo2p*(v_201_020_0 - v_201_020_1) + 2*oo2p*(v_211_010_0 - v_211_010_1);
+        const double v_211_030_1 = PB[1]*v_211_020_1 - PC1[l]*v_211_020_2 + 1*oo2p*(v_201_020_1 - v_201_020_2) + 2*oo2p*(v_211_010_1 - v_211_010_2);
+        const double v_101_020_0 = PB[1]*v_101_010_0 - PC1[l]*v_101_010_1 + 1*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_101_020_1 = PB[1]*v_101_010_1 - PC1[l]*v_101_010_2 + 1*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_111_030_0 = PB[1]*v_111_020_0 - PC1[l]*v_111_020_1 + 1*oo2p*(v_101_020_0 - v_101_020_1) + 2*oo2p*(v_111_010_0 - v_111_010_1);
+        const double v_101_020_2 = PB[1]*v_101_010_2 - PC1[l]*v_101_010_3 + 1*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_111_030_1 = PB[1]*v_111_020_1 - PC1[l]*v_111_020_2 + 1*oo2p*(v_101_020_1 - v_101_020_2) + 2*oo2p*(v_111_010_1 - v_111_010_2);
+        const double v_211_130_0 = PB[0]*v_211_030_0 - PC0[l]*v_211_030_1 + 2*oo2p*(v_111_030_0 - v_111_030_1);
+        const double v_211_021_0 = PB[2]*v_211_020_0 - PC2[l]*v_211_020_1 + 1*oo2p*(v_210_020_0 - v_210_020_1);
+        const double v_211_021_1 = PB[2]*v_211_020_1 - PC2[l]*v_211_020_2 + 1*oo2p*(v_210_020_1 - v_210_020_2);
+        const double v_111_021_0 = PB[2]*v_111_020_0 - PC2[l]*v_111_020_1 + 1*oo2p*(v_110_020_0 - v_110_020_1);
+        const double v_111_021_1 = PB[2]*v_111_020_1 - PC2[l]*v_111_020_2 + 1*oo2p*(v_110_020_1 - v_110_020_2);
+        const double v_211_121_0 = PB[0]*v_211_021_0 - PC0[l]*v_211_021_1 + 2*oo2p*(v_111_021_0 - v_111_021_1);
+        const double v_211_012_0 = PB[1]*v_211_002_0 - PC1[l]*v_211_002_1 + 1*oo2p*(v_201_002_0 - v_201_002_1);
+        const double v_211_012_1 = PB[1]*v_211_002_1 - PC1[l]*v_211_002_2 + 1*oo2p*(v_201_002_1 - v_201_002_2);
+        const double v_111_012_0 = PB[1]*v_111_002_0 - PC1[l]*v_111_002_1 + 1*oo2p*(v_101_002_0 - v_101_002_1);
+        const double v_111_012_1 = PB[1]*v_111_002_1 - PC1[l]*v_111_002_2 + 1*oo2p*(v_101_002_1 - v_101_002_2);
+        const double v_211_112_0 = PB[0]*v_211_012_0 - PC0[l]*v_211_012_1 + 2*oo2p*(v_111_012_0 - v_111_012_1);
+        const double v_211_003_0 = PB[2]*v_211_002_0 - PC2[l]*v_211_002_1 + 1*oo2p*(v_210_002_0 - v_210_002_1) + 2*oo2p*(v_211_001_0 - v_211_001_1);
+        const double v_211_003_1 = PB[2]*v_211_002_1 - PC2[l]*v_211_002_2 + 1*oo2p*(v_210_002_1 - v_210_002_2) + 2*oo2p*(v_211_001_1 - v_211_001_2);
+        const double v_111_003_0 = PB[2]*v_111_002_0 - PC2[l]*v_111_002_1 + 1*oo2p*(v_110_002_0 - v_110_002_1) + 2*oo2p*(v_111_001_0 - v_111_001_1);
+        const double v_111_003_1 = PB[2]*v_111_002_1 - PC2[l]*v_111_002_2 + 1*oo2p*(v_110_002_1 - v_110_002_2) + 2*oo2p*(v_111_001_1 - v_111_001_2);
+        const double v_211_103_0 = PB[0]*v_211_003_0 - PC0[l]*v_211_003_1 + 2*oo2p*(v_111_003_0 - v_111_003_1);
+        const double v_211_040_0 = PB[1]*v_211_030_0 - PC1[l]*v_211_030_1 + 1*oo2p*(v_201_030_0 - v_201_030_1) + 3*oo2p*(v_211_020_0 - v_211_020_1);
+        const double v_211_031_0 = PB[2]*v_211_030_0 - PC2[l]*v_211_030_1 + 1*oo2p*(v_210_030_0 - v_210_030_1);
+        const double v_201_012_0 = PB[1]*v_201_002_0 - PC1[l]*v_201_002_1;
+        const double v_201_012_1 = PB[1]*v_201_002_1 - PC1[l]*v_201_002_2;
+        const double v_211_022_0 = PB[1]*v_211_012_0 - PC1[l]*v_211_012_1 + 1*oo2p*(v_201_012_0 - v_201_012_1) + 1*oo2p*(v_211_002_0 - v_211_002_1);
+        const double v_211_013_0 = PB[1]*v_211_003_0 - PC1[l]*v_211_003_1 + 1*oo2p*(v_201_003_0 - v_201_003_1);
+        const double v_211_004_0 = PB[2]*v_211_003_0 - PC2[l]*v_211_003_1 + 1*oo2p*(v_210_003_0 - v_210_003_1) + 3*oo2p*(v_211_002_0 - v_211_002_1);
+        const double v_002_000_0 = PA[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_002_000_1 = PA[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_102_000_0 = PA[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_000_2 = PA[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_102_000_1 = PA[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_202_000_0 = PA[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_000_3 = PA[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_102_000_2 = PA[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_202_000_1 = PA[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_202_100_0 = PB[0]*v_202_000_0 - PC0[l]*v_202_000_1 + 2*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_002_000_4 = PA[2]*v_001_000_4 - PC2[l]*v_001_000_5 + 1*oo2p*(v_000_000_4 - v_000_000_5);
+        const double v_102_000_3 = PA[0]*v_002_000_3 - PC0[l]*v_002_000_4;
+        const double v_202_000_2 = PA[0]*v_102_000_2 - PC0[l]*v_102_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_202_100_1 = PB[0]*v_202_000_1 - PC0[l]*v_202_000_2 + 2*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_102_100_0 = PB[0]*v_102_000_0 - PC0[l]*v_102_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_102_100_1 = PB[0]*v_102_000_1 - PC0[l]*v_102_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_202_200_0 = PB[0]*v_202_100_0 - PC0[l]*v_202_100_1 + 2*oo2p*(v_102_100_0 - v_102_100_1) + 1*oo2p*(v_202_000_0 - v_202_000_1);
+        const double v_002_000_5 = PA[2]*v_001_000_5 - PC2[l]*v_001_000_6 + 1*oo2p*(v_000_000_5 - v_000_000_6);
+        const double v_102_000_4 = PA[0]*v_002_000_4 - PC0[l]*v_002_000_5;
+        const double v_202_000_3 = PA[0]*v_102_000_3 - PC0[l]*v_102_000_4 + 1*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_202_100_2 = PB[0]*v_202_000_2 - PC0[l]*v_202_000_3 + 2*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_102_100_2 = PB[0]*v_102_000_2 - PC0[l]*v_102_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_202_200_1 = PB[0]*v_202_100_1 - PC0[l]*v_202_100_2 + 2*oo2p*(v_102_100_1 - v_102_100_2) + 1*oo2p*(v_202_000_1 - v_202_000_2);
+        const double v_002_100_0 = PB[0]*v_002_000_0 - PC0[l]*v_002_000_1;
+        const double v_002_100_1 = PB[0]*v_002_000_1 - PC0[l]*v_002_000_2;
+        const double v_102_200_0 = PB[0]*v_102_100_0 - PC0[l]*v_102_100_1 + 1*oo2p*(v_002_100_0 - v_002_100_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_002_100_2 = PB[0]*v_002_000_2 - PC0[l]*v_002_000_3;
+        const double v_102_200_1 = PB[0]*v_102_100_1 - PC0[l]*v_102_100_2 + 1*oo2p*(v_002_100_1 - v_002_100_2) + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_202_300_0 = PB[0]*v_202_200_0 - PC0[l]*v_202_200_1 + 2*oo2p*(v_102_200_0 - v_102_200_1) + 2*oo2p*(v_202_100_0 - v_202_100_1);
+        const double v_001_000_7 = PA[2]*v_000_000_7 - PC2[l]*v_000_000_8;
+        const double v_002_000_6 = PA[2]*v_001_000_6 - PC2[l]*v_001_000_7 + 1*oo2p*(v_000_000_6 - v_000_000_7);
+        const double v_102_000_5 = PA[0]*v_002_000_5 - PC0[l]*v_002_000_6;
+        const double v_202_000_4 = PA[0]*v_102_000_4 - PC0[l]*v_102_000_5 + 1*oo2p*(v_002_000_4 - v_002_000_5);
+        const double v_202_100_3 = PB[0]*v_202_000_3 - PC0[l]*v_202_000_4 + 2*oo2p*(v_102_000_3 - v_102_000_4);
+        const double v_102_100_3 = PB[0]*v_102_000_3 - PC0[l]*v_102_000_4 + 1*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_202_200_2 = PB[0]*v_202_100_2 - PC0[l]*v_202_100_3 + 2*oo2p*(v_102_100_2 - v_102_100_3) + 1*oo2p*(v_202_000_2 - v_202_000_3);
+        const double v_002_100_3 = PB[0]*v_002_000_3 - PC0[l]*v_002_000_4;
+        const double v_102_200_2 = PB[0]*v_102_100_2 - PC0[l]*v_102_100_3 + 1*oo2p*(v_002_100_2 - v_002_100_3) + 1*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_202_300_1 = PB[0]*v_202_200_1 - PC0[l]*v_202_200_2 + 2*oo2p*(v_102_200_1 - v_102_200_2) + 2*oo2p*(v_202_100_1 - v_202_100_2);
+        const double v_002_200_0 = PB[0]*v_002_100_0 - PC0[l]*v_002_100_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_200_1 = PB[0]*v_002_100_1 - PC0[l]*v_002_100_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_102_300_0 = PB[0]*v_102_200_0 - PC0[l]*v_102_200_1 + 1*oo2p*(v_002_200_0 - v_002_200_1) + 2*oo2p*(v_102_100_0 - v_102_100_1);
+        const double v_002_200_2 = PB[0]*v_002_100_2 - PC0[l]*v_002_100_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_102_300_1 = PB[0]*v_102_200_1 - PC0[l]*v_102_200_2 + 1*oo2p*(v_002_200_1 - v_002_200_2) + 2*oo2p*(v_102_100_1 - v_102_100_2);
+        const double v_202_400_0 = PB[0]*v_202_300_0 - PC0[l]*v_202_300_1 + 2*oo2p*(v_102_300_0 - v_102_300_1) + 3*oo2p*(v_202_200_0 - v_202_200_1);
+        const double v_202_310_0 = PB[1]*v_202_300_0 - PC1[l]*v_202_300_1;
+        const double v_202_301_0 = PB[2]*v_202_300_0 - PC2[l]*v_202_300_1 + 2*oo2p*(v_201_300_0 - v_201_300_1);
+        const double v_202_210_0 = PB[1]*v_202_200_0 - PC1[l]*v_202_200_1;
+        const double v_202_210_1 = PB[1]*v_202_200_1 - PC1[l]*v_202_200_2;
+        const double v_202_220_0 = PB[1]*v_202_210_0 - PC1[l]*v_202_210_1 + 1*oo2p*(v_202_200_0 - v_202_200_1);
+        const double v_202_201_0 = PB[2]*v_202_200_0 - PC2[l]*v_202_200_1 + 2*oo2p*(v_201_200_0 - v_201_200_1);
+        const double v_202_201_1 = PB[2]*v_202_200_1 - PC2[l]*v_202_200_2 + 2*oo2p*(v_201_200_1 - v_201_200_2);
+        const double v_202_211_0 = PB[1]*v_202_201_0 - PC1[l]*v_202_201_1;
+        const double v_202_001_0 = PB[2]*v_202_000_0 - PC2[l]*v_202_000_1 + 2*oo2p*(v_201_000_0 - v_201_000_1);
+        const double v_202_001_1 = PB[2]*v_202_000_1 - PC2[l]*v_202_000_2 + 2*oo2p*(v_201_000_1 - v_201_000_2);
+        const double v_202_002_0 = PB[2]*v_202_001_0 - PC2[l]*v_202_001_1 + 2*oo2p*(v_201_001_0 - v_201_001_1) + 1*oo2p*(v_202_000_0 - v_202_000_1);
+        const double v_202_001_2 = PB[2]*v_202_000_2 - PC2[l]*v_202_000_3 + 2*oo2p*(v_201_000_2 - v_201_000_3);
+        const double v_202_002_1 = PB[2]*v_202_001_1 - PC2[l]*v_202_001_2 + 2*oo2p*(v_201_001_1 - v_201_001_2) + 1*oo2p*(v_202_000_1 - v_202_000_2);
+        const double v_102_001_0 = PB[2]*v_102_000_0 - PC2[l]*v_102_000_1 + 2*oo2p*(v_101_000_0 - v_101_000_1);
+        const double v_102_001_1 = PB[2]*v_102_000_1 - PC2[l]*v_102_000_2 + 2*oo2p*(v_101_000_1 - v_101_000_2);
+        const double v_102_002_0 = PB[2]*v_102_001_0 - PC2[l]*v_102_001_1 + 2*oo2p*(v_101_001_0 - v_101_001_1) + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_001_2 = PB[2]*v_102_000_2 - PC2[l]*v_102_000_3 + 2*oo2p*(v_101_000_2 - v_101_000_3);
+        const double v_102_002_1 = PB[2]*v_102_001_1 - PC2[l]*v_102_001_2 + 2*oo2p*(v_101_001_1 - v_101_001_2) + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_202_102_0 = PB[0]*v_202_002_0 - PC0[l]*v_202_002_1 + 2*oo2p*(v_102_002_0 - v_102_002_1);
+        const double v_202_001_3 = PB[2]*v_202_000_3 - PC2[l]*v_202_000_4 + 2*oo2p*(v_201_000_3 - v_201_000_4);
+        const double v_202_002_2 = PB[2]*v_202_001_2 - PC2[l]*v_202_001_3 + 2*oo2p*(v_201_001_2 - v_201_001_3) + 1*oo2p*(v_202_000_2 - v_202_000_3);
+        const double v_102_001_3 = PB[2]*v_102_000_3 - PC2[l]*v_102_000_4 + 2*oo2p*(v_101_000_3 - v_101_000_4);
+        const double v_102_002_2 = PB[2]*v_102_001_2 - PC2[l]*v_102_001_3 + 2*oo2p*(v_101_001_2 - v_101_001_3) + 1*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_202_102_1 = PB[0]*v_202_002_1 - PC0[l]*v_202_002_2 + 2*oo2p*(v_102_002_1 - v_102_002_2);
+        const double v_002_001_0 = PB[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_002_001_1 = PB[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_001_001_0 = PB[2]*v_001_000_0 - PC2[l]*v_001_000_1 + 1*oo2p*(v_000_000_0 - v_000_000_1);
+        const double v_001_001_1 = PB[2]*v_001_000_1 - PC2[l]*v_001_000_2 + 1*oo2p*(v_000_000_1 - v_000_000_2);
+        const double v_002_002_0 = PB[2]*v_002_001_0 - PC2[l]*v_002_001_1 + 2*oo2p*(v_001_001_0 - v_001_001_1) + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_001_2 = PB[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_001_001_2 = PB[2]*v_001_000_2 - PC2[l]*v_001_000_3 + 1*oo2p*(v_000_000_2 - v_000_000_3);
+        const double v_002_002_1 = PB[2]*v_002_001_1 - PC2[l]*v_002_001_2 + 2*oo2p*(v_001_001_1 - v_001_001_2) + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_102_102_0 = PB[0]*v_102_002_0 - PC0[l]*v_102_002_1 + 1*oo2p*(v_002_002_0 - v_002_002_1);
+        const double v_002_001_3 = PB[2]*v_002_000_3 - PC2[l]*v_002_000_4 + 2*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_001_001_3 = PB[2]*v_001_000_3 - PC2[l]*v_001_000_4 + 1*oo2p*(v_000_000_3 - v_000_000_4);
+        const double v_002_002_2 = PB[2]*v_002_001_2 - PC2[l]*v_002_001_3 + 2*oo2p*(v_001_001_2 - v_001_001_3) + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_102_102_1 = PB[0]*v_102_002_1 - PC0[l]*v_102_002_2 + 1*oo2p*(v_002_002_1 - v_002_002_2);
+        const double v_202_202_0 = PB[0]*v_202_102_0 - PC0[l]*v_202_102_1 + 2*oo2p*(v_102_102_0 - v_102_102_1) + 1*oo2p*(v_202_002_0 - v_202_002_1);
+        const double v_202_010_0 = PB[1]*v_202_000_0 - PC1[l]*v_202_000_1;
+        const double v_202_010_1 = PB[1]*v_202_000_1 - PC1[l]*v_202_000_2;
+        const double v_202_020_0 = PB[1]*v_202_010_0 - PC1[l]*v_202_010_1 + 1*oo2p*(v_202_000_0 - v_202_000_1);
+        const double v_202_010_2 = PB[1]*v_202_000_2 - PC1[l]*v_202_000_3;
+        const double v_202_020_1 = PB[1]*v_202_010_1 - PC1[l]*v_202_010_2 + 1*oo2p*(v_202_000_1 - v_202_000_2);
+        const double v_202_030_0 = PB[1]*v_202_020_0 - PC1[l]*v_202_020_1 + 2*oo2p*(v_202_010_0 - v_202_010_1);
+        const double v_202_010_3 = PB[1]*v_202_000_3 - PC1[l]*v_202_000_4;
+        const double v_202_020_2 = PB[1]*v_202_010_2 - PC1[l]*v_202_010_3 + 1*oo2p*(v_202_000_2 - v_202_000_3);
+        const double v_202_030_1 = PB[1]*v_202_020_1 - PC1[l]*v_202_020_2 + 2*oo2p*(v_202_010_1 - v_202_010_2);
+        const double v_102_010_0 = PB[1]*v_102_000_0 - PC1[l]*v_102_000_1;
+        const double v_102_010_1 = PB[1]*v_102_000_1 - PC1[l]*v_102_000_2;
+        const double v_102_020_0 = PB[1]*v_102_010_0 - PC1[l]*v_102_010_1 + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_102_010_2 = PB[1]*v_102_000_2 - PC1[l]*v_102_000_3;
+        const double v_102_020_1 = PB[1]*v_102_010_1 - PC1[l]*v_102_010_2 + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_102_030_0 = PB[1]*v_102_020_0 - PC1[l]*v_102_020_1 + 2*oo2p*(v_102_010_0 - v_102_010_1);
+        const double v_102_010_3 = PB[1]*v_102_000_3 - PC1[l]*v_102_000_4;
+        const double v_102_020_2 = PB[1]*v_102_010_2 - PC1[l]*v_102_010_3 + 1*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_102_030_1 = PB[1]*v_102_020_1 - PC1[l]*v_102_020_2 + 2*oo2p*(v_102_010_1 - v_102_010_2);
+        const double v_202_130_0 = PB[0]*v_202_030_0 - PC0[l]*v_202_030_1 + 2*oo2p*(v_102_030_0 - v_102_030_1);
+        const double v_202_011_0 = PB[1]*v_202_001_0 - PC1[l]*v_202_001_1;
+        const double v_202_011_1 = PB[1]*v_202_001_1 - PC1[l]*v_202_001_2;
+        const double v_202_021_0 = PB[1]*v_202_011_0 - PC1[l]*v_202_011_1 + 1*oo2p*(v_202_001_0 - v_202_001_1);
+        const double v_202_011_2 = PB[1]*v_202_001_2 - PC1[l]*v_202_001_3;
+        const double v_202_021_1 = PB[1]*v_202_011_1 - PC1[l]*v_202_011_2 + 1*oo2p*(v_202_001_1 - v_202_001_2);
+        const double v_102_011_0 = PB[1]*v_102_001_0 - PC1[l]*v_102_001_1;
+        const double v_102_011_1 = PB[1]*v_102_001_1 - PC1[l]*v_102_001_2;
+        const double v_102_021_0 = PB[1]*v_102_011_0 - PC1[l]*v_102_011_1 + 1*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_102_011_2 = PB[1]*v_102_001_2 - PC1[l]*v_102_001_3;
+        const double v_102_021_1 = PB[1]*v_102_011_1 - PC1[l]*v_102_011_2 + 1*oo2p*(v_102_001_1 - v_102_001_2);
+        const double v_202_121_0 = PB[0]*v_202_021_0 - PC0[l]*v_202_021_1 + 2*oo2p*(v_102_021_0 - v_102_021_1);
+        const double v_202_112_0 = PB[1]*v_202_102_0 - PC1[l]*v_202_102_1;
+        const double v_202_003_0 = PB[2]*v_202_002_0 - PC2[l]*v_202_002_1 + 2*oo2p*(v_201_002_0 - v_201_002_1) + 2*oo2p*(v_202_001_0 - v_202_001_1);
+        const double v_202_003_1 = PB[2]*v_202_002_1 - PC2[l]*v_202_002_2 + 2*oo2p*(v_201_002_1 - v_201_002_2) + 2*oo2p*(v_202_001_1 - v_202_001_2);
+        const double v_102_003_0 = PB[2]*v_102_002_0 - PC2[l]*v_102_002_1 + 2*oo2p*(v_101_002_0 - v_101_002_1) + 2*oo2p*(v_102_001_0 - v_102_001_1);
+        const double v_102_003_1 = PB[2]*v_102_002_1 - PC2[l]*v_102_002_2 + 2*oo2p*(v_101_002_1 - v_101_002_2) + 2*oo2p*(v_102_001_1 - v_102_001_2);
+        const double v_202_103_0 = PB[0]*v_202_003_0 - PC0[l]*v_202_003_1 + 2*oo2p*(v_102_003_0 - v_102_003_1);
+        const double v_202_040_0 = PB[1]*v_202_030_0 - PC1[l]*v_202_030_1 + 3*oo2p*(v_202_020_0 - v_202_020_1);
+        const double v_202_031_0 = PB[1]*v_202_021_0 - PC1[l]*v_202_021_1 + 2*oo2p*(v_202_011_0 - v_202_011_1);
+        const double v_202_012_0 = PB[1]*v_202_002_0 - PC1[l]*v_202_002_1;
+        const double v_202_012_1 = PB[1]*v_202_002_1 - PC1[l]*v_202_002_2;
+        const double v_202_022_0 = PB[1]*v_202_012_0 - PC1[l]*v_202_012_1 + 1*oo2p*(v_202_002_0 - v_202_002_1);
+        const double v_202_013_0 = PB[1]*v_202_003_0 - PC1[l]*v_202_003_1;
+        const double v_202_004_0 = PB[2]*v_202_003_0 - PC2[l]*v_202_003_1 + 2*oo2p*(v_201_003_0 - v_201_003_1) + 3*oo2p*(v_202_002_0 - v_202_002_1);
+        const double v_030_000_0 = PA[1]*v_020_000_0 - PC1[l]*v_020_000_1 + 2*oo2p*(v_010_000_0 - v_010_000_1);
+        const double v_030_000_1 = PA[1]*v_020_000_1 - PC1[l]*v_020_000_2 + 2*oo2p*(v_010_000_1 - v_010_000_2);
+        const double v_130_000_0 = PA[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_000_2 = PA[1]*v_020_000_2 - PC1[l]*v_020_000_3 + 2*oo2p*(v_010_000_2 - v_010_000_3);
+        const double v_130_000_1 = PA[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_130_100_0 = PB[0]*v_130_000_0 - PC0[l]*v_130_000_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_000_3 = PA[1]*v_020_000_3 - PC1[l]*v_020_000_4 + 2*oo2p*(v_010_000_3 - v_010_000_4);
+        const double v_130_000_2 = PA[0]*v_030_000_2 - PC0[l]*v_030_000_3;
+        const double v_130_100_1 = PB[0]*v_130_000_1 - PC0[l]*v_130_000_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_030_100_0 = PB[0]*v_030_000_0 - PC0[l]*v_030_000_1;
+        const double v_030_100_1 = PB[0]*v_030_000_1 - PC0[l]*v_030_000_2;
+        const double v_130_200_0 = PB[0]*v_130_100_0 - PC0[l]*v_130_100_1 + 1*oo2p*(v_030_100_0 - v_030_100_1) + 1*oo2p*(v_130_000_0 - v_130_000_1);
+        const double v_030_000_4 = PA[1]*v_020_000_4 - PC1[l]*v_020_000_5 + 2*oo2p*(v_010_000_4 - v_010_000_5);
+        const double v_130_000_3 = PA[0]*v_030_000_3 - PC0[l]*v_030_000_4;
+        const double v_130_100_2 = PB[0]*v_130_000_2 - PC0[l]*v_130_000_3 + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_030_100_2 = PB[0]*v_030_000_2 - PC0[l]*v_030_000_3;
+        const double v_130_200_1 = PB[0]*v_130_100_1 - PC0[l]*v_130_100_2 + 1*oo2p*(v_030_100_1 - v_030_100_2) + 1*oo2p*(v_130_000_1 - v_130_000_2);
+        const double v_030_200_0 = PB[0]*v_030_100_0 - PC0[l]*v_030_100_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_200_1 = PB[0]*v_030_100_1 - PC0[l]*v_030_100_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_130_300_0 = PB[0]*v_130_200_0 - PC0[l]*v_130_200_1 + 1*oo2p*(v_030_200_0 - v_030_200_1) + 2*oo2p*(v_130_100_0 - v_130_100_1);
+        const double v_030_000_5 = PA[1]*v_020_000_5 - PC1[l]*v_020_000_6 + 2*oo2p*(v_010_000_5 - v_010_000_6);
+        const double v_130_000_4 = PA[0]*v_030_000_4 - PC0[l]*v_030_000_5;
+        const double v_130_100_3 = PB[0]*v_130_000_3 - PC0[l]*v_130_000_4 + 1*oo2p*(v_030_000_3 - v_030_000_4);
+        const double v_030_100_3 = PB[0]*v_030_000_3 - PC0[l]*v_030_000_4;
+        const double v_130_200_2 = PB[0]*v_130_100_2 - PC0[l]*v_130_100_3 + 1*oo2p*(v_030_100_2 - v_030_100_3) + 1*oo2p*(v_130_000_2 - v_130_000_3);
+        const double v_030_200_2 = PB[0]*v_030_100_2 - PC0[l]*v_030_100_3 + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_130_300_1 = PB[0]*v_130_200_1 - PC0[l]*v_130_200_2 + 1*oo2p*(v_030_200_1 - v_030_200_2) + 2*oo2p*(v_130_100_1 - v_130_100_2);
+        const double v_030_300_0 = PB[0]*v_030_200_0 - PC0[l]*v_030_200_1 + 2*oo2p*(v_030_100_0 - v_030_100_1);
+        const double v_030_300_1 = PB[0]*v_030_200_1 - PC0[l]*v_030_200_2 + 2*oo2p*(v_030_100_1 - v_030_100_2);
+        const double v_130_400_0 = PB[0]*v_130_300_0 - PC0[l]*v_130_300_1 + 1*oo2p*(v_030_300_0 - v_030_300_1) + 3*oo2p*(v_130_200_0 - v_130_200_1);
+        const double v_130_310_0 = PB[1]*v_130_300_0 - PC1[l]*v_130_300_1 + 3*oo2p*(v_120_300_0 - v_120_300_1);
+        const double v_130_301_0 = PB[2]*v_130_300_0 - PC2[l]*v_130_300_1;
+        const double v_130_010_0 = PB[1]*v_130_000_0 - PC1[l]*v_130_000_1 + 3*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_130_010_1 = PB[1]*v_130_000_1 - PC1[l]*v_130_000_2 + 3*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_130_020_0 = PB[1]*v_130_010_0 - PC1[l]*v_130_010_1 + 3*oo2p*(v_120_010_0 - v_120_010_1) + 1*oo2p*(v_130_000_0 - v_130_000_1);
+        const double v_130_010_2 = PB[1]*v_130_000_2 - PC1[l]*v_130_000_3 + 3*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_130_020_1 = PB[1]*v_130_010_1 - PC1[l]*v_130_010_2 + 3*oo2p*(v_120_010_1 - v_120_010_2) + 1*oo2p*(v_130_000_1 - v_130_000_2);
+        const double v_030_010_0 = PB[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_030_010_1 = PB[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_030_020_0 = PB[1]*v_030_010_0 - PC1[l]*v_030_010_1 + 3*oo2p*(v_020_010_0 - v_020_010_1) + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_010_2 = PB[1]*v_030_000_2 - PC1[l]*v_030_000_3 + 3*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_030_020_1 = PB[1]*v_030_010_1 - PC1[l]*v_030_010_2 + 3*oo2p*(v_020_010_1 - v_020_010_2) + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_130_120_0 = PB[0]*v_130_020_0 - PC0[l]*v_130_020_1 + 1*oo2p*(v_030_020_0 - v_030_020_1);
+        const double v_130_010_3 = PB[1]*v_130_000_3 - PC1[l]*v_130_000_4 + 3*oo2p*(v_120_000_3 - v_120_000_4);
+        const double v_130_020_2 = PB[1]*v_130_010_2 - PC1[l]*v_130_010_3 + 3*oo2p*(v_120_010_2 - v_120_010_3) + 1*oo2p*(v_130_000_2 - v_130_000_3);
+        const double v_030_010_3 = PB[1]*v_030_000_3 - PC1[l]*v_030_000_4 + 3*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_030_020_2 = PB[1]*v_030_010_2 - PC1[l]*v_030_010_3 + 3*oo2p*(v_020_010_2 - v_020_010_3) + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_130_120_1 = PB[0]*v_130_020_1 - PC0[l]*v_130_020_2 + 1*oo2p*(v_030_020_1 - v_030_020_2);
+        const double v_030_120_0 = PB[0]*v_030_020_0 - PC0[l]*v_030_020_1;
+        const double v_030_120_1 = PB[0]*v_030_020_1 - PC0[l]*v_030_020_2;
+        const double v_130_220_0 = PB[0]*v_130_120_0 - PC0[l]*v_130_120_1 + 1*oo2p*(v_030_120_0 - v_030_120_1) + 1*oo2p*(v_130_020_0 - v_130_020_1);
+        const double v_130_210_0 = PB[1]*v_130_200_0 - PC1[l]*v_130_200_1 + 3*oo2p*(v_120_200_0 - v_120_200_1);
+        const double v_130_210_1 = PB[1]*v_130_200_1 - PC1[l]*v_130_200_2 + 3*oo2p*(v_120_200_1 - v_120_200_2);
+        const double v_130_211_0 = PB[2]*v_130_210_0 - PC2[l]*v_130_210_1;
+        const double v_130_201_0 = PB[2]*v_130_200_0 - PC2[l]*v_130_200_1;
+        const double v_130_201_1 = PB[2]*v_130_200_1 - PC2[l]*v_130_200_2;
+        const double v_130_202_0 = PB[2]*v_130_201_0 - PC2[l]*v_130_201_1 + 1*oo2p*(v_130_200_0 - v_130_200_1);
+        const double v_130_030_0 = PB[1]*v_130_020_0 - PC1[l]*v_130_020_1 + 3*oo2p*(v_120_020_0 - v_120_020_1) + 2*oo2p*(v_130_010_0 - v_130_010_1);
+        const double v_130_030_1 = PB[1]*v_130_020_1 - PC1[l]*v_130_020_2 + 3*oo2p*(v_120_020_1 - v_120_020_2) + 2*oo2p*(v_130_010_1 - v_130_010_2);
+        const double v_030_030_0 = PB[1]*v_030_020_0 - PC1[l]*v_030_020_1 + 3*oo2p*(v_020_020_0 - v_020_020_1) + 2*oo2p*(v_030_010_0 - v_030_010_1);
+        const double v_030_030_1 = PB[1]*v_030_020_1 - PC1[l]*v_030_020_2 + 3*oo2p*(v_020_020_1 - v_020_020_2) + 2*oo2p*(v_030_010_1 - v_030_010_2);
+        const double v_130_130_0 = PB[0]*v_130_030_0 - PC0[l]*v_130_030_1 + 1*oo2p*(v_030_030_0 - v_030_030_1);
+        const double v_130_121_0 = PB[2]*v_130_120_0 - PC2[l]*v_130_120_1;
+        const double v_130_001_0 = PB[2]*v_130_000_0 - PC2[l]*v_130_000_1;
+        const double v_130_001_1 = PB[2]*v_130_000_1 - PC2[l]*v_130_000_2;
+        const double v_130_002_0 = PB[2]*v_130_001_0 - PC2[l]*v_130_001_1 + 1*oo2p*(v_130_000_0 - v_130_000_1);
+        const double v_130_001_2 = PB[2]*v_130_000_2 - PC2[l]*v_130_000_3;
+        const double v_130_002_1 = PB[2]*v_130_001_1 - PC2[l]*v_130_001_2 + 1*oo2p*(v_130_000_1 - v_130_000_2);
+        const double v_130_012_0 = PB[1]*v_130_002_0 - PC1[l]*v_130_002_1 + 3*oo2p*(v_120_002_0 - v_120_002_1);
+        const double v_130_001_3 = PB[2]*v_130_000_3 - PC2[l]*v_130_000_4;
+        const double v_130_002_2 = PB[2]*v_130_001_2 - PC2[l]*v_130_001_3 + 1*oo2p*(v_130_000_2 - v_130_000_3);
+        const double v_130_012_1 = PB[1]*v_130_002_1 - PC1[l]*v_130_002_2 + 3*oo2p*(v_120_002_1 - v_120_002_2);
+        const double v_030_001_0 = PB[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_030_001_1 = PB[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_030_002_0 = PB[2]*v_030_001_0 - PC2[l]*v_030_001_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_030_001_2 = PB[2]*v_030_000_2 - PC2[l]*v_030_000_3;
+        const double v_030_002_1 = PB[2]*v_030_001_1 - PC2[l]*v_030_001_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_020_001_0 = PB[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_020_001_1 = PB[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_020_002_0 = PB[2]*v_020_001_0 - PC2[l]*v_020_001_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_020_001_2 = PB[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_020_002_1 = PB[2]*v_020_001_1 - PC2[l]*v_020_001_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_030_012_0 = PB[1]*v_030_002_0 - PC1[l]*v_030_002_1 + 3*oo2p*(v_020_002_0 - v_020_002_1);
+        const double v_030_001_3 = PB[2]*v_030_000_3 - PC2[l]*v_030_000_4;
+        const double v_030_002_2 = PB[2]*v_030_001_2 - PC2[l]*v_030_001_3 + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_020_001_3 = PB[2]*v_020_000_3 - PC2[l]*v_020_000_4;
+        const double v_020_002_2 = PB[2]*v_020_001_2 - PC2[l]*v_020_001_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_030_012_1 = PB[1]*v_030_002_1 - PC1[l]*v_030_002_2 + 3*oo2p*(v_020_002_1 - v_020_002_2);
+        const double v_130_112_0 = PB[0]*v_130_012_0 - PC0[l]*v_130_012_1 + 1*oo2p*(v_030_012_0 - v_030_012_1);
+        const double v_130_003_0 = PB[2]*v_130_002_0 - PC2[l]*v_130_002_1 + 2*oo2p*(v_130_001_0 - v_130_001_1);
+        const double v_130_003_1 = PB[2]*v_130_002_1 - PC2[l]*v_130_002_2 + 2*oo2p*(v_130_001_1 - v_130_001_2);
+        const double v_030_003_0 = PB[2]*v_030_002_0 - PC2[l]*v_030_002_1 + 2*oo2p*(v_030_001_0 - v_030_001_1);
+        const double v_030_003_1 = PB[2]*v_030_002_1 - PC2[l]*v_030_002_2 + 2*oo2p*(v_030_001_1 - v_030_001_2);
+        const double v_130_103_0 = PB[0]*v_130_003_0 - PC0[l]*v_130_003_1 + 1*oo2p*(v_030_003_0 - v_030_003_1);
+        const double v_130_040_0 = PB[1]*v_130_030_0 - PC1[l]*v_130_030_1 + 3*oo2p*(v_120_030_0 - v_120_030_1) + 3*oo2p*(v_130_020_0 - v_130_020_1);
+        const double v_130_031_0 = PB[2]*v_130_030_0 - PC2[l]*v_130_030_1;
+        const double v_130_021_0 = PB[2]*v_130_020_0 - PC2[l]*v_130_020_1;
+        const double v_130_021_1 = PB[2]*v_130_020_1 - PC2[l]*v_130_020_2;
+        const double v_130_022_0 = PB[2]*v_130_021_0 - PC2[l]*v_130_021_1 + 1*oo2p*(v_130_020_0 - v_130_020_1);
+        const double v_130_013_0 = PB[1]*v_130_003_0 - PC1[l]*v_130_003_1 + 3*oo2p*(v_120_003_0 - v_120_003_1);
+        const double v_130_004_0 = PB[2]*v_130_003_0 - PC2[l]*v_130_003_1 + 3*oo2p*(v_130_002_0 - v_130_002_1);
+        const double v_021_000_0 = PA[2]*v_020_000_0 - PC2[l]*v_020_000_1;
+        const double v_021_000_1 = PA[2]*v_020_000_1 - PC2[l]*v_020_000_2;
+        const double v_121_000_0 = PA[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_000_2 = PA[2]*v_020_000_2 - PC2[l]*v_020_000_3;
+        const double v_121_000_1 = PA[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_121_100_0 = PB[0]*v_121_000_0 - PC0[l]*v_121_000_1 + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_000_3 = PA[2]*v_020_000_3 - PC2[l]*v_020_000_4;
+        const double v_121_000_2 = PA[0]*v_021_000_2 - PC0[l]*v_021_000_3;
+        const double v_121_100_1 = PB[0]*v_121_000_1 - PC0[l]*v_121_000_2 + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_021_100_0 = PB[0]*v_021_000_0 - PC0[l]*v_021_000_1;
+        const double v_021_100_1 = PB[0]*v_021_000_1 - PC0[l]*v_021_000_2;
+        const double v_121_200_0 = PB[0]*v_121_100_0 - PC0[l]*v_121_100_1 + 1*oo2p*(v_021_100_0 - v_021_100_1) + 1*oo2p*(v_121_000_0 - v_121_000_1);
+        const double v_021_000_4 = PA[2]*v_020_000_4 - PC2[l]*v_020_000_5;
+        const double v_121_000_3 = PA[0]*v_021_000_3 - PC0[l]*v_021_000_4;
+        const double v_121_100_2 = PB[0]*v_121_000_2 - PC0[l]*v_121_000_3 + 1*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_021_100_2 = PB[0]*v_021_000_2 - PC0[l]*v_021_000_3;
+        const double v_121_200_1 = PB[0]*v_121_100_1 - PC0[l]*v_121_100_2 + 1*oo2p*(v_021_100_1 - v_021_100_2) + 1*oo2p*(v_121_000_1 - v_121_000_2);
+        const double v_021_200_0 = PB[0]*v_021_100_0 - PC0[l]*v_021_100_1 + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_200_1 = PB[0]*v_021_100_1 - PC0[l]*v_021_100_2 + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_121_300_0 = PB[0]*v_121_200_0 - PC0[l]*v_121_200_1 + 1*oo2p*(v_021_200_0 - v_021_200_1) + 2*oo2p*(v_121_100_0 - v_121_100_1);
+        const double v_021_000_5 = PA[2]*v_020_000_5 - PC2[l]*v_020_000_6;
+        const double v_121_000_4 = PA[0]*v_021_000_4 - PC0[l]*v_021_000_5;
+        const double v_121_100_3 = PB[0]*v_121_000_3 - PC0[l]*v_121_000_4 + 1*oo2p*(v_021_000_3 - v_021_000_4);
+        const double v_021_100_3 = PB[0]*v_021_000_3 - PC0[l]*v_021_000_4;
+        const double v_121_200_2 = PB[0]*v_121_100_2 - PC0[l]*v_121_100_3 + 1*oo2p*(v_021_100_2 - v_021_100_3) + 1*oo2p*(v_121_000_2 - v_121_000_3);
+        const double v_021_200_2 = PB[0]*v_021_100_2 - PC0[l]*v_021_100_3 + 1*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_121_300_1 = PB[0]*v_121_200_1 - PC0[l]*v_121_200_2 + 1*oo2p*(v_021_200_1 - v_021_200_2) + 2*oo2p*(v_121_100_1 - v_121_100_2);
+        const double v_021_300_0 = PB[0]*v_021_200_0 - PC0[l]*v_021_200_1 + 2*oo2p*(v_021_100_0 - v_021_100_1);
+        const double v_021_300_1 = PB[0]*v_021_200_1 - PC0[l]*v_021_200_2 + 2*oo2p*(v_021_100_1 - v_021_100_2);
+        const double v_121_400_0 = PB[0]*v_121_300_0 - PC0[l]*v_121_300_1 + 1*oo2p*(v_021_300_0 - v_021_300_1) + 3*oo2p*(v_121_200_0 - v_121_200_1);
+        const double v_121_310_0 = PB[1]*v_121_300_0 - PC1[l]*v_121_300_1 + 2*oo2p*(v_111_300_0 - v_111_300_1);
+        const double v_121_301_0 = PB[2]*v_121_300_0 - PC2[l]*v_121_300_1 + 1*oo2p*(v_120_300_0 - v_120_300_1);
+        const double v_121_010_0 = PB[1]*v_121_000_0 - PC1[l]*v_121_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_121_010_1 = PB[1]*v_121_000_1 - PC1[l]*v_121_000_2 + 2*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_121_020_0 = PB[1]*v_121_010_0 - PC1[l]*v_121_010_1 + 2*oo2p*(v_111_010_0 - v_111_010_1) + 1*oo2p*(v_121_000_0 - v_121_000_1);
+        const double v_121_010_2 = PB[1]*v_121_000_2 - PC1[l]*v_121_000_3 + 2*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_121_020_1 = PB[1]*v_121_010_1 - PC1[l]*v_121_010_2 + 2*oo2p*(v_111_010_1 - v_111_010_2) + 1*oo2p*(v_121_000_1 - v_121_000_2);
+        const double v_021_010_0 = PB[1]*v_021_000_0 - PC1[l]*v_021_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_021_010_1 = PB[1]*v_021_000_1 - PC1[l]*v_021_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_021_020_0 = PB[1]*v_021_010_0 - PC1[l]*v_021_010_1 + 2*oo2p*(v_011_010_0 - v_011_010_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_010_2 = PB[1]*v_021_000_2 - PC1[l]*v_021_000_3 + 2*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_021_020_1 = PB[1]*v_021_010_1 - PC1[l]*v_021_010_2 + 2*oo2p*(v_011_010_1 - v_011_010_2) + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_121_120_0 = PB[0]*v_121_020_0 - PC0[l]*v_121_020_1 + 1*oo2p*(v_021_020_0 - v_021_020_1);
+        const double v_121_010_3 = PB[1]*v_121_000_3 - PC1[l]*v_121_000_4 + 2*oo2p*(v_111_000_3 - v_111_000_4);
+        const double v_121_020_2 = PB[1]*v_121_010_2 - PC1[l]*v_121_010_3 + 2*oo2p*(v_111_010_2 - v_111_010_3) + 1*oo2p*(v_121_000_2 - v_121_000_3);
+        const double v_021_010_3 = PB[1]*v_021_000_3 - PC1[l]*v_021_000_4 + 2*oo2p*(v_011_000_3 - v_011_000_4);
+        const double v_021_020_2 = PB[1]*v_021_010_2 - PC1[l]*v_021_010_3 + 2*oo2p*(v_011_010_2 - v_011_010_3) + 1*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_121_120_1 = PB[0]*v_121_020_1 - PC0[l]*v_121_020_2 + 1*oo2p*(v_021_020_1 - v_021_020_2);
+        const double v_021_120_0 = PB[0]*v_021_020_0 - PC0[l]*v_021_020_1;
+        const double v_021_120_1 = PB[0]*v_021_020_1 - PC0[l]*v_021_020_2;
+        const double v_121_220_0 = PB[0]*v_121_120_0 - PC0[l]*v_121_120_1 + 1*oo2p*(v_021_120_0 - v_021_120_1) + 1*oo2p*(v_121_020_0 - v_121_020_1);
+        const double v_121_201_0 = PB[2]*v_121_200_0 - PC2[l]*v_121_200_1 + 1*oo2p*(v_120_200_0 - v_120_200_1);
+        const double v_121_201_1 = PB[2]*v_121_200_1 - PC2[l]*v_121_200_2 + 1*oo2p*(v_120_200_1 - v_120_200_2);
+        const double v_111_201_0 = PB[2]*v_111_200_0 - PC2[l]*v_111_200_1 + 1*oo2p*(v_110_200_0 - v_110_200_1);
+        const double v_111_201_1 = PB[2]*v_111_200_1 - PC2[l]*v_111_200_2 + 1*oo2p*(v_110_200_1 - v_110_200_2);
+        const double v_121_211_0 = PB[1]*v_121_201_0 - PC1[l]*v_121_201_1 + 2*oo2p*(v_111_201_0 - v_111_201_1);
+        const double v_121_001_0 = PB[2]*v_121_000_0 - PC2[l]*v_121_000_1 + 1*oo2p*(v_120_000_0 - v_120_000_1);
+        const double v_121_001_1 = PB[2]*v_121_000_1 - PC2[l]*v_121_000_2 + 1*oo2p*(v_120_000_1 - v_120_000_2);
+        const double v_121_002_0 = PB[2]*v_121_001_0 - PC2[l]*v_121_001_1 + 1*oo2p*(v_120_001_0 - v_120_001_1) + 1*oo2p*(v_121_000_0 - v_121_000_1);
+        const double v_121_001_2 = PB[2]*v_121_000_2 - PC2[l]*v_121_000_3 + 1*oo2p*(v_120_000_2 - v_120_000_3);
+        const double v_121_002_1 = PB[2]*v_121_001_1 - PC2[l]*v_121_001_2 + 1*oo2p*(v_120_001_1 - v_120_001_2) + 1*oo2p*(v_121_000_1 - v_121_000_2);
+        const double v_021_001_0 = PB[2]*v_021_000_0 - PC2[l]*v_021_000_1 + 1*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_021_001_1 = PB[2]*v_021_000_1 - PC2[l]*v_021_000_2 + 1*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_021_002_0 = PB[2]*v_021_001_0 - PC2[l]*v_021_001_1 + 1*oo2p*(v_020_001_0 - v_020_001_1) + 1*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_021_001_2 = PB[2]*v_021_000_2 - PC2[l]*v_021_000_3 + 1*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_021_002_1 = PB[2]*v_021_001_1 - PC2[l]*v_021_001_2 + 1*oo2p*(v_020_001_1 - v_020_001_2) + 1*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_121_102_0 = PB[0]*v_121_002_0 - PC0[l]*v_121_002_1 + 1*oo2p*(v_021_002_0 - v_021_002_1);
+        const double v_121_001_3 = PB[2]*v_121_000_3 - PC2[l]*v_121_000_4 + 1*oo2p*(v_120_000_3 - v_120_000_4);
+        const double v_121_002_2 = PB[2]*v_121_001_2 - PC2[l]*v_121_001_3 + 1*oo2p*(v_120_001_2 - v_120_001_3) + 1*oo2p*(v_121_000_2 - v_121_000_3);
+        const double v_021_001_3 = PB[2]*v_021_000_3 - PC2[l]*v_021_000_4 + 1*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_021_002_2 = PB[2]*v_021_001_2 - PC2[l]*v_021_001_3 + 1*oo2p*(v_020_001_2 - v_020_001_3) + 1*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_121_102_1 = PB[0]*v_121_002_1 - PC0[l]*v_121_002_2 + 1*oo2p*(v_021_002_1 - v_021_002_2);
+        const double v_021_102_0 = PB[0]*v_021_002_0 - PC0[l]*v_021_002_1;
+        const double v_021_102_1 = PB[0]*v_021_002_1 - PC0[l]*v_021_002_2;
+        const double v_121_202_0 = PB[0]*v_121_102_0 - PC0[l]*v_121_102_1 + 1*oo2p*(v_021_102_0 - v_021_102_1) + 1*oo2p*(v_121_002_0 - v_121_002_1);
+        const double v_121_030_0 = PB[1]*v_121_020_0 - PC1[l]*v_121_020_1 + 2*oo2p*(v_111_020_0 - v_111_020_1) + 2*oo2p*(v_121_010_0 - v_121_010_1);
+        const double v_121_030_1 = PB[1]*v_121_020_1 - PC1[l]*v_121_020_2 + 2*oo2p*(v_111_020_1 - v_111_020_2) + 2*oo2p*(v_121_010_1 - v_121_010_2);
+        const double v_021_030_0 = PB[1]*v_021_020_0 - PC1[l]*v_021_020_1 + 2*oo2p*(v_011_020_0 - v_011_020_1) + 2*oo2p*(v_021_010_0 - v_021_010_1);
+        const double v_021_030_1 = PB[1]*v_021_020_1 - PC1[l]*v_021_020_2 + 2*oo2p*(v_011_020_1 - v_011_020_2) + 2*oo2p*(v_021_010_1 - v_021_010_2);
+        const double v_121_130_0 = PB[0]*v_121_030_0 - PC0[l]*v_121_030_1 + 1*oo2p*(v_021_030_0 - v_021_030_1);
+        const double v_121_021_0 = PB[2]*v_121_020_0 - PC2[l]*v_121_020_1 + 1*oo2p*(v_120_020_0 - v_120_020_1);
+        const double v_121_021_1 = PB[2]*v_121_020_1 - PC2[l]*v_121_020_2 + 1*oo2p*(v_120_020_1 - v_120_020_2);
+        const double v_021_021_0 = PB[2]*v_021_020_0 - PC2[l]*v_021_020_1 + 1*oo2p*(v_020_020_0 - v_020_020_1);
+        const double v_021_021_1 = PB[2]*v_021_020_1 - PC2[l]*v_021_020_2 + 1*oo2p*(v_020_020_1 - v_020_020_2);
+        const double v_121_121_0 = PB[0]*v_121_021_0 - PC0[l]*v_121_021_1 + 1*oo2p*(v_021_021_0 - v_021_021_1);
+        const double v_121_012_0 = PB[1]*v_121_002_0 - PC1[l]*v_121_002_1 + 2*oo2p*(v_111_002_0 - v_111_002_1);
+        const double v_121_012_1 = PB[1]*v_121_002_1 - PC1[l]*v_121_002_2 + 2*oo2p*(v_111_002_1 - v_111_002_2);
+        const double v_021_012_0 = PB[1]*v_021_002_0 - PC1[l]*v_021_002_1 + 2*oo2p*(v_011_002_0 - v_011_002_1);
+        const double v_021_012_1 = PB[1]*v_021_002_1 - PC1[l]*v_021_002_2 + 2*oo2p*(v_011_002_1 - v_011_002_2);
+        const double v_121_112_0 = PB[0]*v_121_012_0 - PC0[l]*v_121_012_1 + 1*oo2p*(v_021_012_0 - v_021_012_1);
+        const double v_121_003_0 = PB[2]*v_121_002_0 - PC2[l]*v_121_002_1 + 1*oo2p*(v_120_002_0 - v_120_002_1) + 2*oo2p*(v_121_001_0 - v_121_001_1);
+        const double v_121_003_1 = PB[2]*v_121_002_1 - PC2[l]*v_121_002_2 + 1*oo2p*(v_120_002_1 - v_120_002_2) + 2*oo2p*(v_121_001_1 - v_121_001_2);
+        const double v_021_003_0 = PB[2]*v_021_002_0 - PC2[l]*v_021_002_1 + 1*oo2p*(v_020_002_0 - v_020_002_1) + 2*oo2p*(v_021_001_0 - v_021_001_1);
+        const double v_021_003_1 = PB[2]*v_021_002_1 - PC2[l]*v_021_002_2 + 1*oo2p*(v_020_002_1 - v_020_002_2) + 2*oo2p*(v_021_001_1 - v_021_001_2);
+        const double v_121_103_0 = PB[0]*v_121_003_0 - PC0[l]*v_121_003_1 + 1*oo2p*(v_021_003_0 - v_021_003_1);
+        const double v_121_040_0 = PB[1]*v_121_030_0 - PC1[l]*v_121_030_1 + 2*oo2p*(v_111_030_0 - v_111_030_1) + 3*oo2p*(v_121_020_0 - v_121_020_1);
+        const double v_121_031_0 = PB[2]*v_121_030_0 - PC2[l]*v_121_030_1 + 1*oo2p*(v_120_030_0 - v_120_030_1);
+        const double v_121_022_0 = PB[1]*v_121_012_0 - PC1[l]*v_121_012_1 + 2*oo2p*(v_111_012_0 - v_111_012_1) + 1*oo2p*(v_121_002_0 - v_121_002_1);
+        const double v_121_013_0 = PB[1]*v_121_003_0 - PC1[l]*v_121_003_1 + 2*oo2p*(v_111_003_0 - v_111_003_1);
+        const double v_121_004_0 = PB[2]*v_121_003_0 - PC2[l]*v_121_003_1 + 1*oo2p*(v_120_003_0 - v_120_003_1) + 3*oo2p*(v_121_002_0 - v_121_002_1);
+        const double v_012_000_0 = PA[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_012_000_1 = PA[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_112_000_0 = PA[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_000_2 = PA[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_112_000_1 = PA[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_112_100_0 = PB[0]*v_112_000_0 - PC0[l]*v_112_000_1 + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_000_3 = PA[1]*v_002_000_3 - PC1[l]*v_002_000_4;
+        const double v_112_000_2 = PA[0]*v_012_000_2 - PC0[l]*v_012_000_3;
+        const double v_112_100_1 = PB[0]*v_112_000_1 - PC0[l]*v_112_000_2 + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_012_100_0 = PB[0]*v_012_000_0 - PC0[l]*v_012_000_1;
+        const double v_012_100_1 = PB[0]*v_012_000_1 - PC0[l]*v_012_000_2;
+        const double v_112_200_0 = PB[0]*v_112_100_0 - PC0[l]*v_112_100_1 + 1*oo2p*(v_012_100_0 - v_012_100_1) + 1*oo2p*(v_112_000_0 - v_112_000_1);
+        const double v_012_000_4 = PA[1]*v_002_000_4 - PC1[l]*v_002_000_5;
+        const double v_112_000_3 = PA[0]*v_012_000_3 - PC0[l]*v_012_000_4;
+        const double v_112_100_2 = PB[0]*v_112_000_2 - PC0[l]*v_112_000_3 + 1*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_012_100_2 = PB[0]*v_012_000_2 - PC0[l]*v_012_000_3;
+        const double v_112_200_1 = PB[0]*v_112_100_1 - PC0[l]*v_112_100_2 + 1*oo2p*(v_012_100_1 - v_012_100_2) + 1*oo2p*(v_112_000_1 - v_112_000_2);
+        const double v_012_200_0 = PB[0]*v_012_100_0 - PC0[l]*v_012_100_1 + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_200_1 = PB[0]*v_012_100_1 - PC0[l]*v_012_100_2 + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_112_300_0 = PB[0]*v_112_200_0 - PC0[l]*v_112_200_1 + 1*oo2p*(v_012_200_0 - v_012_200_1) + 2*oo2p*(v_112_100_0 - v_112_100_1);
+        const double v_012_000_5 = PA[1]*v_002_000_5 - PC1[l]*v_002_000_6;
+        const double v_112_000_4 = PA[0]*v_012_000_4 - PC0[l]*v_012_000_5;
+        const double v_112_100_3 = PB[0]*v_112_000_3 - PC0[l]*v_112_000_4 + 1*oo2p*(v_012_000_3 - v_012_000_4);
+        const double v_012_100_3 = PB[0]*v_012_000_3 - PC0[l]*v_012_000_4;
+        const double v_112_200_2 = PB[0]*v_112_100_2 - PC0[l]*v_112_100_3 + 1*oo2p*(v_012_100_2 - v_012_100_3) + 1*oo2p*(v_112_000_2 - v_112_000_3);
+        const double v_012_200_2 = PB[0]*v_012_100_2 - PC0[l]*v_012_100_3 + 1*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_112_300_1 = PB[0]*v_112_200_1 - PC0[l]*v_112_200_2 + 1*oo2p*(v_012_200_1 - v_012_200_2) + 2*oo2p*(v_112_100_1 - v_112_100_2);
+        const double v_012_300_0 = PB[0]*v_012_200_0 - PC0[l]*v_012_200_1 + 2*oo2p*(v_012_100_0 - v_012_100_1);
+        const double v_012_300_1 = PB[0]*v_012_200_1 - PC0[l]*v_012_200_2 + 2*oo2p*(v_012_100_1 - v_012_100_2);
+        const double v_112_400_0 = PB[0]*v_112_300_0 - PC0[l]*v_112_300_1 + 1*oo2p*(v_012_300_0 - v_012_300_1) + 3*oo2p*(v_112_200_0 - v_112_200_1);
+        const double v_112_310_0 = PB[1]*v_112_300_0 - PC1[l]*v_112_300_1 + 1*oo2p*(v_102_300_0 - v_102_300_1);
+        const double v_112_301_0 = PB[2]*v_112_300_0 - PC2[l]*v_112_300_1 + 2*oo2p*(v_111_300_0 - v_111_300_1);
+        const double v_112_010_0 = PB[1]*v_112_000_0 - PC1[l]*v_112_000_1 + 1*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_112_010_1 = PB[1]*v_112_000_1 - PC1[l]*v_112_000_2 + 1*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_112_020_0 = PB[1]*v_112_010_0 - PC1[l]*v_112_010_1 + 1*oo2p*(v_102_010_0 - v_102_010_1) + 1*oo2p*(v_112_000_0 - v_112_000_1);
+        const double v_112_010_2 = PB[1]*v_112_000_2 - PC1[l]*v_112_000_3 + 1*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_112_020_1 = PB[1]*v_112_010_1 - PC1[l]*v_112_010_2 + 1*oo2p*(v_102_010_1 - v_102_010_2) + 1*oo2p*(v_112_000_1 - v_112_000_2);
+        const double v_012_010_0 = PB[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_012_010_1 = PB[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_002_010_0 = PB[1]*v_002_000_0 - PC1[l]*v_002_000_1;
+        const double v_002_010_1 = PB[1]*v_002_000_1 - PC1[l]*v_002_000_2;
+        const double v_012_020_0 = PB[1]*v_012_010_0 - PC1[l]*v_012_010_1 + 1*oo2p*(v_002_010_0 - v_002_010_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_010_2 = PB[1]*v_012_000_2 - PC1[l]*v_012_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_002_010_2 = PB[1]*v_002_000_2 - PC1[l]*v_002_000_3;
+        const double v_012_020_1 = PB[1]*v_012_010_1 - PC1[l]*v_012_010_2 + 1*oo2p*(v_002_010_1 - v_002_010_2) + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_112_120_0 = PB[0]*v_112_020_0 - PC0[l]*v_112_020_1 + 1*oo2p*(v_012_020_0 - v_012_020_1);
+        const double v_112_010_3 = PB[1]*v_112_000_3 - PC1[l]*v_112_000_4 + 1*oo2p*(v_102_000_3 - v_102_000_4);
+        const double v_112_020_2 = PB[1]*v_112_010_2 - PC1[l]*v_112_010_3 + 1*oo2p*(v_102_010_2 - v_102_010_3) + 1*oo2p*(v_112_000_2 - v_112_000_3);
+        const double v_012_010_3 = PB[1]*v_012_000_3 - PC1[l]*v_012_000_4 + 1*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_002_010_3 = PB[1]*v_002_000_3 - PC1[l]*v_002_000_4;
+        const double v_012_020_2 = PB[1]*v_012_010_2 - PC1[l]*v_012_010_3 + 1*oo2p*(v_002_010_2 - v_002_010_3) + 1*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_112_120_1 = PB[0]*v_112_020_1 - PC0[l]*v_112_020_2 + 1*oo2p*(v_012_020_1 - v_012_020_2);
+        const double v_012_120_0 = PB[0]*v_012_020_0 - PC0[l]*v_012_020_1;
+        const double v_012_120_1 = PB[0]*v_012_020_1 - PC0[l]*v_012_020_2;
+        const double v_112_220_0 = PB[0]*v_112_120_0 - PC0[l]*v_112_120_1 + 1*oo2p*(v_012_120_0 - v_012_120_1) + 1*oo2p*(v_112_020_0 - v_112_020_1);
+        const double v_112_201_0 = PB[2]*v_112_200_0 - PC2[l]*v_112_200_1 + 2*oo2p*(v_111_200_0 - v_111_200_1);
+        const double v_112_201_1 = PB[2]*v_112_200_1 - PC2[l]*v_112_200_2 + 2*oo2p*(v_111_200_1 - v_111_200_2);
+        const double v_102_201_0 = PB[2]*v_102_200_0 - PC2[l]*v_102_200_1 + 2*oo2p*(v_101_200_0 - v_101_200_1);
+        const double v_102_201_1 = PB[2]*v_102_200_1 - PC2[l]*v_102_200_2 + 2*oo2p*(v_101_200_1 - v_101_200_2);
+        const double v_112_211_0 = PB[1]*v_112_201_0 - PC1[l]*v_112_201_1 + 1*oo2p*(v_102_201_0 - v_102_201_1);
+        const double v_112_001_0 = PB[2]*v_112_000_0 - PC2[l]*v_112_000_1 + 2*oo2p*(v_111_000_0 - v_111_000_1);
+        const double v_112_001_1 = PB[2]*v_112_000_1 - PC2[l]*v_112_000_2 + 2*oo2p*(v_111_000_1 - v_111_000_2);
+        const double v_112_002_0 = PB[2]*v_112_001_0 - PC2[l]*v_112_001_1 + 2*oo2p*(v_111_001_0 - v_111_001_1) + 1*oo2p*(v_112_000_0 - v_112_000_1);
+        const double v_112_001_2 = PB[2]*v_112_000_2 - PC2[l]*v_112_000_3 + 2*oo2p*(v_111_000_2 - v_111_000_3);
+        const double v_112_002_1 = PB[2]*v_112_001_1 - PC2[l]*v_112_001_2 + 2*oo2p*(v_111_001_1 - v_111_001_2) + 1*oo2p*(v_112_000_1 - v_112_000_2);
+        const double v_012_001_0 = PB[2]*v_012_000_0 - PC2[l]*v_012_000_1 + 2*oo2p*(v_011_000_0 - v_011_000_1);
+        const double v_012_001_1 = PB[2]*v_012_000_1 - PC2[l]*v_012_000_2 + 2*oo2p*(v_011_000_1 - v_011_000_2);
+        const double v_012_002_0 = PB[2]*v_012_001_0 - PC2[l]*v_012_001_1 + 2*oo2p*(v_011_001_0 - v_011_001_1) + 1*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_012_001_2 = PB[2]*v_012_000_2 - PC2[l]*v_012_000_3 + 2*oo2p*(v_011_000_2 - v_011_000_3);
+        const double v_012_002_1 = PB[2]*v_012_001_1 - PC2[l]*v_012_001_2 + 2*oo2p*(v_011_001_1 - v_011_001_2) + 1*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_112_102_0 = PB[0]*v_112_002_0 - PC0[l]*v_112_002_1 + 1*oo2p*(v_012_002_0 - v_012_002_1);
+        const double v_112_001_3 = PB[2]*v_112_000_3 - PC2[l]*v_112_000_4 + 2*oo2p*(v_111_000_3 - v_111_000_4);
+        const double v_112_002_2 = PB[2]*v_112_001_2 - PC2[l]*v_112_001_3 + 2*oo2p*(v_111_001_2 - v_111_001_3) + 1*oo2p*(v_112_000_2 - v_112_000_3);
+        const double v_012_001_3 = PB[2]*v_012_000_3 - PC2[l]*v_012_000_4 + 2*oo2p*(v_011_000_3 - v_011_000_4);
+        const double v_012_002_2 = PB[2]*v_012_001_2 - PC2[l]*v_012_001_3 + 2*oo2p*(v_011_001_2 - v_011_001_3) + 1*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_112_102_1 = PB[0]*v_112_002_1 - PC0[l]*v_112_002_2 + 1*oo2p*(v_012_002_1 - v_012_002_2);
+        const double v_012_102_0 = PB[0]*v_012_002_0 - PC0[l]*v_012_002_1;
+        const double v_012_102_1 = PB[0]*v_012_002_1 - PC0[l]*v_012_002_2;
+        const double v_112_202_0 = PB[0]*v_112_102_0 - PC0[l]*v_112_102_1 + 1*oo2p*(v_012_102_0 - v_012_102_1) + 1*oo2p*(v_112_002_0 - v_112_002_1);
+        const double v_112_030_0 = PB[1]*v_112_020_0 - PC1[l]*v_112_020_1 + 1*oo2p*(v_102_020_0 - v_102_020_1) + 2*oo2p*(v_112_010_0 - v_112_010_1);
+        const double v_112_030_1 = PB[1]*v_112_020_1 - PC1[l]*v_112_020_2 + 1*oo2p*(v_102_020_1 - v_102_020_2) + 2*oo2p*(v_112_010_1 - v_112_010_2);
+        const double v_002_020_0 = PB[1]*v_002_010_0 - PC1[l]*v_002_010_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_002_020_1 = PB[1]*v_002_010_1 - PC1[l]*v_002_010_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_012_030_0 = PB[1]*v_012_020_0 - PC1[l]*v_012_020_1 + 1*oo2p*(v_002_020_0 - v_002_020_1) + 2*oo2p*(v_012_010_0 - v_012_010_1);
+        const double v_002_020_2 = PB[1]*v_002_010_2 - PC1[l]*v_002_010_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_012_030_1 = PB[1]*v_012_020_1 - PC1[l]*v_012_020_2 + 1*oo2p*(v_002_020_1 - v_002_020_2) + 2*oo2p*(v_012_010_1 - v_012_010_2);
+        const double v_112_130_0 = PB[0]*v_112_030_0 - PC0[l]*v_112_030_1 + 1*oo2p*(v_012_030_0 - v_012_030_1);
+        const double v_112_021_0 = PB[2]*v_112_020_0 - PC2[l]*v_112_020_1 + 2*oo2p*(v_111_020_0 - v_111_020_1);
+        const double v_112_021_1 = PB[2]*v_112_020_1 - PC2[l]*v_112_020_2 + 2*oo2p*(v_111_020_1 - v_111_020_2);
+        const double v_012_021_0 = PB[2]*v_012_020_0 - PC2[l]*v_012_020_1 + 2*oo2p*(v_011_020_0 - v_011_020_1);
+        const double v_012_021_1 = PB[2]*v_012_020_1 - PC2[l]*v_012_020_2 + 2*oo2p*(v_011_020_1 - v_011_020_2);
+        const double v_112_121_0 = PB[0]*v_112_021_0 - PC0[l]*v_112_021_1 + 1*oo2p*(v_012_021_0 - v_012_021_1);
+        const double v_112_012_0 = PB[1]*v_112_002_0 - PC1[l]*v_112_002_1 + 1*oo2p*(v_102_002_0 - v_102_002_1);
+        const double v_112_012_1 = PB[1]*v_112_002_1 - PC1[l]*v_112_002_2 + 1*oo2p*(v_102_002_1 - v_102_002_2);
+        const double v_012_012_0 = PB[1]*v_012_002_0 - PC1[l]*v_012_002_1 + 1*oo2p*(v_002_002_0 - v_002_002_1);
+        const double v_012_012_1 = PB[1]*v_012_002_1 - PC1[l]*v_012_002_2 + 1*oo2p*(v_002_002_1 - v_002_002_2);
+        const double v_112_112_0 = PB[0]*v_112_012_0 - PC0[l]*v_112_012_1 + 1*oo2p*(v_012_012_0 - v_012_012_1);
+        const double v_112_003_0 = PB[2]*v_112_002_0 - PC2[l]*v_112_002_1 + 2*oo2p*(v_111_002_0 - v_111_002_1) + 2*oo2p*(v_112_001_0 - v_112_001_1);
+        const double v_112_003_1 = PB[2]*v_112_002_1 - PC2[l]*v_112_002_2 + 2*oo2p*(v_111_002_1 - v_111_002_2) + 2*oo2p*(v_112_001_1 - v_112_001_2);
+        const double v_012_003_0 = PB[2]*v_012_002_0 - PC2[l]*v_012_002_1 + 2*oo2p*(v_011_002_0 - v_011_002_1) + 2*oo2p*(v_012_001_0 - v_012_001_1);
+        const double v_012_003_1 = PB[2]*v_012_002_1 - PC2[l]*v_012_002_2 + 2*oo2p*(v_011_002_1 - v_011_002_2) + 2*oo2p*(v_012_001_1 - v_012_001_2);
+        const double v_112_103_0 = PB[0]*v_112_003_0 - PC0[l]*v_112_003_1 + 1*oo2p*(v_012_003_0 - v_012_003_1);
+        const double v_112_040_0 = PB[1]*v_112_030_0 - PC1[l]*v_112_030_1 + 1*oo2p*(v_102_030_0 - v_102_030_1) + 3*oo2p*(v_112_020_0 - v_112_020_1);
+        const double v_112_031_0 = PB[2]*v_112_030_0 - PC2[l]*v_112_030_1 + 2*oo2p*(v_111_030_0 - v_111_030_1);
+        const double v_102_012_0 = PB[1]*v_102_002_0 - PC1[l]*v_102_002_1;
+        const double v_102_012_1 = PB[1]*v_102_002_1 - PC1[l]*v_102_002_2;
+        const double v_112_022_0 = PB[1]*v_112_012_0 - PC1[l]*v_112_012_1 + 1*oo2p*(v_102_012_0 - v_102_012_1) + 1*oo2p*(v_112_002_0 - v_112_002_1);
+        const double v_112_013_0 = PB[1]*v_112_003_0 - PC1[l]*v_112_003_1 + 1*oo2p*(v_102_003_0 - v_102_003_1);
+        const double v_112_004_0 = PB[2]*v_112_003_0 - PC2[l]*v_112_003_1 + 2*oo2p*(v_111_003_0 - v_111_003_1) + 3*oo2p*(v_112_002_0 - v_112_002_1);
+        const double v_003_000_0 = PA[2]*v_002_000_0 - PC2[l]*v_002_000_1 + 2*oo2p*(v_001_000_0 - v_001_000_1);
+        const double v_003_000_1 = PA[2]*v_002_000_1 - PC2[l]*v_002_000_2 + 2*oo2p*(v_001_000_1 - v_001_000_2);
+        const double v_103_000_0 = PA[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_000_2 = PA[2]*v_002_000_2 - PC2[l]*v_002_000_3 + 2*oo2p*(v_001_000_2 - v_001_000_3);
+        const double v_103_000_1 = PA[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_103_100_0 = PB[0]*v_103_000_0 - PC0[l]*v_103_000_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_000_3 = PA[2]*v_002_000_3 - PC2[l]*v_002_000_4 + 2*oo2p*(v_001_000_3 - v_001_000_4);
+        const double v_103_000_2 = PA[0]*v_003_000_2 - PC0[l]*v_003_000_3;
+        const double v_103_100_1 = PB[0]*v_103_000_1 - PC0[l]*v_103_000_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_100_0 = PB[0]*v_003_000_0 - PC0[l]*v_003_000_1;
+        const double v_003_100_1 = PB[0]*v_003_000_1 - PC0[l]*v_003_000_2;
+        const double v_103_200_0 = PB[0]*v_103_100_0 - PC0[l]*v_103_100_1 + 1*oo2p*(v_003_100_0 - v_003_100_1) + 1*oo2p*(v_103_000_0 - v_103_000_1);
+        const double v_003_000_4 = PA[2]*v_002_000_4 - PC2[l]*v_002_000_5 + 2*oo2p*(v_001_000_4 - v_001_000_5);
+        const double v_103_000_3 = PA[0]*v_003_000_3 - PC0[l]*v_003_000_4;
+        const double v_103_100_2 = PB[0]*v_103_000_2 - PC0[l]*v_103_000_3 + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_003_100_2 = PB[0]*v_003_000_2 - PC0[l]*v_003_000_3;
+        const double v_103_200_1 = PB[0]*v_103_100_1 - PC0[l]*v_103_100_2 + 1*oo2p*(v_003_100_1 - v_003_100_2) + 1*oo2p*(v_103_000_1 - v_103_000_2);
+        const double v_003_200_0 = PB[0]*v_003_100_0 - PC0[l]*v_003_100_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_200_1 = PB[0]*v_003_100_1 - PC0[l]*v_003_100_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_103_300_0 = PB[0]*v_103_200_0 - PC0[l]*v_103_200_1 + 1*oo2p*(v_003_200_0 - v_003_200_1) + 2*oo2p*(v_103_100_0 - v_103_100_1);
+        const double v_003_000_5 = PA[2]*v_002_000_5 - PC2[l]*v_002_000_6 + 2*oo2p*(v_001_000_5 - v_001_000_6);
+        const double v_103_000_4 = PA[0]*v_003_000_4 - PC0[l]*v_003_000_5;
+        const double v_103_100_3 = PB[0]*v_103_000_3 - PC0[l]*v_103_000_4 + 1*oo2p*(v_003_000_3 - v_003_000_4);
+        const double v_003_100_3 = PB[0]*v_003_000_3 - PC0[l]*v_003_000_4;
+        const double v_103_200_2 = PB[0]*v_103_100_2 - PC0[l]*v_103_100_3 + 1*oo2p*(v_003_100_2 - v_003_100_3) + 1*oo2p*(v_103_000_2 - v_103_000_3);
+        const double v_003_200_2 = PB[0]*v_003_100_2 - PC0[l]*v_003_100_3 + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_103_300_1 = PB[0]*v_103_200_1 - PC0[l]*v_103_200_2 + 1*oo2p*(v_003_200_1 - v_003_200_2) + 2*oo2p*(v_103_100_1 - v_103_100_2);
+        const double v_003_300_0 = PB[0]*v_003_200_0 - PC0[l]*v_003_200_1 + 2*oo2p*(v_003_100_0 - v_003_100_1);
+        const double v_003_300_1 = PB[0]*v_003_200_1 - PC0[l]*v_003_200_2 + 2*oo2p*(v_003_100_1 - v_003_100_2);
+        const double v_103_400_0 = PB[0]*v_103_300_0 - PC0[l]*v_103_300_1 + 1*oo2p*(v_003_300_0 - v_003_300_1) + 3*oo2p*(v_103_200_0 - v_103_200_1);
+        const double v_103_310_0 = PB[1]*v_103_300_0 - PC1[l]*v_103_300_1;
+        const double v_103_301_0 = PB[2]*v_103_300_0 - PC2[l]*v_103_300_1 + 3*oo2p*(v_102_300_0 - v_102_300_1);
+        const double v_103_210_0 = PB[1]*v_103_200_0 - PC1[l]*v_103_200_1;
+        const double v_103_210_1 = PB[1]*v_103_200_1 - PC1[l]*v_103_200_2;
+        const double v_103_220_0 = PB[1]*v_103_210_0 - PC1[l]*v_103_210_1 + 1*oo2p*(v_103_200_0 - v_103_200_1);
+        const double v_103_201_0 = PB[2]*v_103_200_0 - PC2[l]*v_103_200_1 + 3*oo2p*(v_102_200_0 - v_102_200_1);
+        const double v_103_201_1 = PB[2]*v_103_200_1 - PC2[l]*v_103_200_2 + 3*oo2p*(v_102_200_1 - v_102_200_2);
+        const double v_103_211_0 = PB[1]*v_103_201_0 - PC1[l]*v_103_201_1;
+        const double v_103_001_0 = PB[2]*v_103_000_0 - PC2[l]*v_103_000_1 + 3*oo2p*(v_102_000_0 - v_102_000_1);
+        const double v_103_001_1 = PB[2]*v_103_000_1 - PC2[l]*v_103_000_2 + 3*oo2p*(v_102_000_1 - v_102_000_2);
+        const double v_103_002_0 = PB[2]*v_103_001_0 - PC2[l]*v_103_001_1 + 3*oo2p*(v_102_001_0 - v_102_001_1) + 1*oo2p*(v_103_000_0 - v_103_000_1);
+        const double v_103_001_2 = PB[2]*v_103_000_2 - PC2[l]*v_103_000_3 + 3*oo2p*(v_102_000_2 - v_102_000_3);
+        const double v_103_002_1 = PB[2]*v_103_001_1 - PC2[l]*v_103_001_2 + 3*oo2p*(v_102_001_1 - v_102_001_2) + 1*oo2p*(v_103_000_1 - v_103_000_2);
+        const double v_003_001_0 = PB[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_003_001_1 = PB[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_003_002_0 = PB[2]*v_003_001_0 - PC2[l]*v_003_001_1 + 3*oo2p*(v_002_001_0 - v_002_001_1) + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_001_2 = PB[2]*v_003_000_2 - PC2[l]*v_003_000_3 + 3*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_003_002_1 = PB[2]*v_003_001_1 - PC2[l]*v_003_001_2 + 3*oo2p*(v_002_001_1 - v_002_001_2) + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_103_102_0 = PB[0]*v_103_002_0 - PC0[l]*v_103_002_1 + 1*oo2p*(v_003_002_0 - v_003_002_1);
+        const double v_103_001_3 = PB[2]*v_103_000_3 - PC2[l]*v_103_000_4 + 3*oo2p*(v_102_000_3 - v_102_000_4);
+        const double v_103_002_2 = PB[2]*v_103_001_2 - PC2[l]*v_103_001_3 + 3*oo2p*(v_102_001_2 - v_102_001_3) + 1*oo2p*(v_103_000_2 - v_103_000_3);
+        const double v_003_001_3 = PB[2]*v_003_000_3 - PC2[l]*v_003_000_4 + 3*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_003_002_2 = PB[2]*v_003_001_2 - PC2[l]*v_003_001_3 + 3*oo2p*(v_002_001_2 - v_002_001_3) + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_103_102_1 = PB[0]*v_103_002_1 - PC0[l]*v_103_002_2 + 1*oo2p*(v_003_002_1 - v_003_002_2);
+        const double v_003_102_0 = PB[0]*v_003_002_0 - PC0[l]*v_003_002_1;
+        const double v_003_102_1 = PB[0]*v_003_002_1 - PC0[l]*v_003_002_2;
+        const double v_103_202_0 = PB[0]*v_103_102_0 - PC0[l]*v_103_102_1 + 1*oo2p*(v_003_102_0 - v_003_102_1) + 1*oo2p*(v_103_002_0 - v_103_002_1);
+        const double v_103_010_0 = PB[1]*v_103_000_0 - PC1[l]*v_103_000_1;
+        const double v_103_010_1 = PB[1]*v_103_000_1 - PC1[l]*v_103_000_2;
+        const double v_103_020_0 = PB[1]*v_103_010_0 - PC1[l]*v_103_010_1 + 1*oo2p*(v_103_000_0 - v_103_000_1);
+        const double v_103_010_2 = PB[1]*v_103_000_2 - PC1[l]*v_103_000_3;
+        const double v_103_020_1 = PB[1]*v_103_010_1 - PC1[l]*v_103_010_2 + 1*oo2p*(v_103_000_1 - v_103_000_2);
+        const double v_103_030_0 = PB[1]*v_103_020_0 - PC1[l]*v_103_020_1 + 2*oo2p*(v_103_010_0 - v_103_010_1);
+        const double v_103_010_3 = PB[1]*v_103_000_3 - PC1[l]*v_103_000_4;
+        const double v_103_020_2 = PB[1]*v_103_010_2 - PC1[l]*v_103_010_3 + 1*oo2p*(v_103_000_2 - v_103_000_3);
+        const double v_103_030_1 = PB[1]*v_103_020_1 - PC1[l]*v_103_020_2 + 2*oo2p*(v_103_010_1 - v_103_010_2);
+        const double v_003_010_0 = PB[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_003_010_1 = PB[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_003_020_0 = PB[1]*v_003_010_0 - PC1[l]*v_003_010_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_003_010_2 = PB[1]*v_003_000_2 - PC1[l]*v_003_000_3;
+        const double v_003_020_1 = PB[1]*v_003_010_1 - PC1[l]*v_003_010_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_003_030_0 = PB[1]*v_003_020_0 - PC1[l]*v_003_020_1 + 2*oo2p*(v_003_010_0 - v_003_010_1);
+        const double v_003_010_3 = PB[1]*v_003_000_3 - PC1[l]*v_003_000_4;
+        const double v_003_020_2 = PB[1]*v_003_010_2 - PC1[l]*v_003_010_3 + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_003_030_1 = PB[1]*v_003_020_1 - PC1[l]*v_003_020_2 + 2*oo2p*(v_003_010_1 - v_003_010_2);
+        const double v_103_130_0 = PB[0]*v_103_030_0 - PC0[l]*v_103_030_1 + 1*oo2p*(v_003_030_0 - v_003_030_1);
+        const double v_103_011_0 = PB[1]*v_103_001_0 - PC1[l]*v_103_001_1;
+        const double v_103_011_1 = PB[1]*v_103_001_1 - PC1[l]*v_103_001_2;
+        const double v_103_021_0 = PB[1]*v_103_011_0 - PC1[l]*v_103_011_1 + 1*oo2p*(v_103_001_0 - v_103_001_1);
+        const double v_103_011_2 = PB[1]*v_103_001_2 - PC1[l]*v_103_001_3;
+        const double v_103_021_1 = PB[1]*v_103_011_1 - PC1[l]*v_103_011_2 + 1*oo2p*(v_103_001_1 - v_103_001_2);
+        const double v_003_011_0 = PB[1]*v_003_001_0 - PC1[l]*v_003_001_1;
+        const double v_003_011_1 = PB[1]*v_003_001_1 - PC1[l]*v_003_001_2;
+        const double v_003_021_0 = PB[1]*v_003_011_0 - PC1[l]*v_003_011_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_003_011_2 = PB[1]*v_003_001_2 - PC1[l]*v_003_001_3;
+        const double v_003_021_1 = PB[1]*v_003_011_1 - PC1[l]*v_003_011_2 + 1*oo2p*(v_003_001_1 - v_003_001_2);
+        const double v_103_121_0 = PB[0]*v_103_021_0 - PC0[l]*v_103_021_1 + 1*oo2p*(v_003_021_0 - v_003_021_1);
+        const double v_103_112_0 = PB[1]*v_103_102_0 - PC1[l]*v_103_102_1;
+        const double v_103_003_0 = PB[2]*v_103_002_0 - PC2[l]*v_103_002_1 + 3*oo2p*(v_102_002_0 - v_102_002_1) + 2*oo2p*(v_103_001_0 - v_103_001_1);
+        const double v_103_003_1 = PB[2]*v_103_002_1 - PC2[l]*v_103_002_2 + 3*oo2p*(v_102_002_1 - v_102_002_2) + 2*oo2p*(v_103_001_1 - v_103_001_2);
+        const double v_003_003_0 = PB[2]*v_003_002_0 - PC2[l]*v_003_002_1 + 3*oo2p*(v_002_002_0 - v_002_002_1) + 2*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_003_003_1 = PB[2]*v_003_002_1 - PC2[l]*v_003_002_2 + 3*oo2p*(v_002_002_1 - v_002_002_2) + 2*oo2p*(v_003_001_1 - v_003_001_2);
+        const double v_103_103_0 = PB[0]*v_103_003_0 - PC0[l]*v_103_003_1 + 1*oo2p*(v_003_003_0 - v_003_003_1);
+        const double v_103_040_0 = PB[1]*v_103_030_0 - PC1[l]*v_103_030_1 + 3*oo2p*(v_103_020_0 - v_103_020_1);
+        const double v_103_031_0 = PB[1]*v_103_021_0 - PC1[l]*v_103_021_1 + 2*oo2p*(v_103_011_0 - v_103_011_1);
+        const double v_103_012_0 = PB[1]*v_103_002_0 - PC1[l]*v_103_002_1;
+        const double v_103_012_1 = PB[1]*v_103_002_1 - PC1[l]*v_103_002_2;
+        const double v_103_022_0 = PB[1]*v_103_012_0 - PC1[l]*v_103_012_1 + 1*oo2p*(v_103_002_0 - v_103_002_1);
+        const double v_103_013_0 = PB[1]*v_103_003_0 - PC1[l]*v_103_003_1;
+        const double v_103_004_0 = PB[2]*v_103_003_0 - PC2[l]*v_103_003_1 + 3*oo2p*(v_102_003_0 - v_102_003_1) + 3*oo2p*(v_103_002_0 - v_103_002_1);
+        const double v_040_000_0 = PA[1]*v_030_000_0 - PC1[l]*v_030_000_1 + 3*oo2p*(v_020_000_0 - v_020_000_1);
+        const double v_040_000_1 = PA[1]*v_030_000_1 - PC1[l]*v_030_000_2 + 3*oo2p*(v_020_000_1 - v_020_000_2);
+        const double v_040_100_0 = PB[0]*v_040_000_0 - PC0[l]*v_040_000_1;
+        const double v_040_000_2 = PA[1]*v_030_000_2 - PC1[l]*v_030_000_3 + 3*oo2p*(v_020_000_2 - v_020_000_3);
+        const double v_040_100_1 = PB[0]*v_040_000_1 - PC0[l]*v_040_000_2;
+        const double v_040_200_0 = PB[0]*v_040_100_0 - PC0[l]*v_040_100_1 + 1*oo2p*(v_040_000_0 - v_040_000_1);
+        const double v_040_000_3 = PA[1]*v_030_000_3 - PC1[l]*v_030_000_4 + 3*oo2p*(v_020_000_3 - v_020_000_4);
+        const double v_040_100_2 = PB[0]*v_040_000_2 - PC0[l]*v_040_000_3;
+        const double v_040_200_1 = PB[0]*v_040_100_1 - PC0[l]*v_040_100_2 + 1*oo2p*(v_040_000_1 - v_040_000_2);
+        const double v_040_300_0 = PB[0]*v_040_200_0 - PC0[l]*v_040_200_1 + 2*oo2p*(v_040_100_0 - v_040_100_1);
+        const double v_040_000_4 = PA[1]*v_030_000_4 - PC1[l]*v_030_000_5 + 3*oo2p*(v_020_000_4 - v_020_000_5);
+        const double v_040_100_3 = PB[0]*v_040_000_3 - PC0[l]*v_040_000_4;
+        const double v_040_200_2 = PB[0]*v_040_100_2 - PC0[l]*v_040_100_3 + 1*oo2p*(v_040_000_2 - v_040_000_3);
+        const double v_040_300_1 = PB[0]*v_040_200_1 - PC0[l]*v_040_200_2 + 2*oo2p*(v_040_100_1 - v_040_100_2);
+        const double v_040_400_0 = PB[0]*v_040_300_0 - PC0[l]*v_040_300_1 + 3*oo2p*(v_040_200_0 - v_040_200_1);
+        const double v_040_010_0 = PB[1]*v_040_000_0 - PC1[l]*v_040_000_1 + 4*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_040_010_1 = PB[1]*v_040_000_1 - PC1[l]*v_040_000_2 + 4*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_040_110_0 = PB[0]*v_040_010_0 - PC0[l]*v_040_010_1;
+        const double v_040_010_2 = PB[1]*v_040_000_2 - PC1[l]*v_040_000_3 + 4*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_040_110_1 = PB[0]*v_040_010_1 - PC0[l]*v_040_010_2;
+        const double v_040_210_0 = PB[0]*v_040_110_0 - PC0[l]*v_040_110_1 + 1*oo2p*(v_040_010_0 - v_040_010_1);
+        const double v_040_010_3 = PB[1]*v_040_000_3 - PC1[l]*v_040_000_4 + 4*oo2p*(v_030_000_3 - v_030_000_4);
+        const double v_040_110_2 = PB[0]*v_040_010_2 - PC0[l]*v_040_010_3;
+        const double v_040_210_1 = PB[0]*v_040_110_1 - PC0[l]*v_040_110_2 + 1*oo2p*(v_040_010_1 - v_040_010_2);
+        const double v_040_310_0 = PB[0]*v_040_210_0 - PC0[l]*v_040_210_1 + 2*oo2p*(v_040_110_0 - v_040_110_1);
+        const double v_040_301_0 = PB[2]*v_040_300_0 - PC2[l]*v_040_300_1;
+        const double v_040_020_0 = PB[1]*v_040_010_0 - PC1[l]*v_040_010_1 + 4*oo2p*(v_030_010_0 - v_030_010_1) + 1*oo2p*(v_040_000_0 - v_040_000_1);
+        const double v_040_020_1 = PB[1]*v_040_010_1 - PC1[l]*v_040_010_2 + 4*oo2p*(v_030_010_1 - v_030_010_2) + 1*oo2p*(v_040_000_1 - v_040_000_2);
+        const double v_040_120_0 = PB[0]*v_040_020_0 - PC0[l]*v_040_020_1;
+        const double v_040_020_2 = PB[1]*v_040_010_2 - PC1[l]*v_040_010_3 + 4*oo2p*(v_030_010_2 - v_030_010_3) + 1*oo2p*(v_040_000_2 - v_040_000_3);
+        const double v_040_120_1 = PB[0]*v_040_020_1 - PC0[l]*v_040_020_2;
+        const double v_040_220_0 = PB[0]*v_040_120_0 - PC0[l]*v_040_120_1 + 1*oo2p*(v_040_020_0 - v_040_020_1);
+        const double v_040_211_0 = PB[2]*v_040_210_0 - PC2[l]*v_040_210_1;
+        const double v_040_001_0 = PB[2]*v_040_000_0 - PC2[l]*v_040_000_1;
+        const double v_040_001_1 = PB[2]*v_040_000_1 - PC2[l]*v_040_000_2;
+        const double v_040_002_0 = PB[2]*v_040_001_0 - PC2[l]*v_040_001_1 + 1*oo2p*(v_040_000_0 - v_040_000_1);
+        const double v_040_001_2 = PB[2]*v_040_000_2 - PC2[l]*v_040_000_3;
+        const double v_040_002_1 = PB[2]*v_040_001_1 - PC2[l]*v_040_001_2 + 1*oo2p*(v_040_000_1 - v_040_000_2);
+        const double v_040_102_0 = PB[0]*v_040_002_0 - PC0[l]*v_040_002_1;
+        const double v_040_001_3 = PB[2]*v_040_000_3 - PC2[l]*v_040_000_4;
+        const double v_040_002_2 = PB[2]*v_040_001_2 - PC2[l]*v_040_001_3 + 1*oo2p*(v_040_000_2 - v_040_000_3);
+        const double v_040_102_1 = PB[0]*v_040_002_1 - PC0[l]*v_040_002_2;
+        const double v_040_202_0 = PB[0]*v_040_102_0 - PC0[l]*v_040_102_1 + 1*oo2p*(v_040_002_0 - v_040_002_1);
+        const double v_040_030_0 = PB[1]*v_040_020_0 - PC1[l]*v_040_020_1 + 4*oo2p*(v_030_020_0 - v_030_020_1) + 2*oo2p*(v_040_010_0 - v_040_010_1);
+        const double v_040_030_1 = PB[1]*v_040_020_1 - PC1[l]*v_040_020_2 + 4*oo2p*(v_030_020_1 - v_030_020_2) + 2*oo2p*(v_040_010_1 - v_040_010_2);
+        const double v_040_130_0 = PB[0]*v_040_030_0 - PC0[l]*v_040_030_1;
+        const double v_040_021_0 = PB[2]*v_040_020_0 - PC2[l]*v_040_020_1;
+        const double v_040_021_1 = PB[2]*v_040_020_1 - PC2[l]*v_040_020_2;
+        const double v_040_121_0 = PB[0]*v_040_021_0 - PC0[l]*v_040_021_1;
+        const double v_040_012_0 = PB[1]*v_040_002_0 - PC1[l]*v_040_002_1 + 4*oo2p*(v_030_002_0 - v_030_002_1);
+        const double v_040_012_1 = PB[1]*v_040_002_1 - PC1[l]*v_040_002_2 + 4*oo2p*(v_030_002_1 - v_030_002_2);
+        const double v_040_112_0 = PB[0]*v_040_012_0 - PC0[l]*v_040_012_1;
+        const double v_040_003_0 = PB[2]*v_040_002_0 - PC2[l]*v_040_002_1 + 2*oo2p*(v_040_001_0 - v_040_001_1);
+        const double v_040_003_1 = PB[2]*v_040_002_1 - PC2[l]*v_040_002_2 + 2*oo2p*(v_040_001_1 - v_040_001_2);
+        const double v_040_103_0 = PB[0]*v_040_003_0 - PC0[l]*v_040_003_1;
+        const double v_040_040_0 = PB[1]*v_040_030_0 - PC1[l]*v_040_030_1 + 4*oo2p*(v_030_030_0 - v_030_030_1) + 3*oo2p*(v_040_020_0 - v_040_020_1);
+        const double v_040_031_0 = PB[2]*v_040_030_0 - PC2[l]*v_040_030_1;
+        const double v_040_022_0 = PB[2]*v_040_021_0 - PC2[l]*v_040_021_1 + 1*oo2p*(v_040_020_0 - v_040_020_1);
+        const double v_040_013_0 = PB[1]*v_040_003_0 - PC1[l]*v_040_003_1 + 4*oo2p*(v_030_003_0 - v_030_003_1);
+        const double v_040_004_0 = PB[2]*v_040_003_0 - PC2[l]*v_040_003_1 + 3*oo2p*(v_040_002_0 - v_040_002_1);
+        const double v_031_000_0 = PA[2]*v_030_000_0 - PC2[l]*v_030_000_1;
+        const double v_031_000_1 = PA[2]*v_030_000_1 - PC2[l]*v_030_000_2;
+        const double v_031_100_0 = PB[0]*v_031_000_0 - PC0[l]*v_031_000_1;
+        const double v_031_000_2 = PA[2]*v_030_000_2 - PC2[l]*v_030_000_3;
+        const double v_031_100_1 = PB[0]*v_031_000_1 - PC0[l]*v_031_000_2;
+        const double v_031_200_0 = PB[0]*v_031_100_0 - PC0[l]*v_031_100_1 + 1*oo2p*(v_031_000_0 - v_031_000_1);
+        const double v_031_000_3 = PA[2]*v_030_000_3 - PC2[l]*v_030_000_4;
+        const double v_031_100_2 = PB[0]*v_031_000_2 - PC0[l]*v_031_000_3;
+        const double v_031_200_1 = PB[0]*v_031_100_1 - PC0[l]*v_031_100_2 + 1*oo2p*(v_031_000_1 - v_031_000_2);
+        const double v_031_300_0 = PB[0]*v_031_200_0 - PC0[l]*v_031_200_1 + 2*oo2p*(v_031_100_0 - v_031_100_1);
+        const double v_031_000_4 = PA[2]*v_030_000_4 - PC2[l]*v_030_000_5;
+        const double v_031_100_3 = PB[0]*v_031_000_3 - PC0[l]*v_031_000_4;
+        const double v_031_200_2 = PB[0]*v_031_100_2 - PC0[l]*v_031_100_3 + 1*oo2p*(v_031_000_2 - v_031_000_3);
+        const double v_031_300_1 = PB[0]*v_031_200_1 - PC0[l]*v_031_200_2 + 2*oo2p*(v_031_100_1 - v_031_100_2);
+        const double v_031_400_0 = PB[0]*v_031_300_0 - PC0[l]*v_031_300_1 + 3*oo2p*(v_031_200_0 - v_031_200_1);
+        const double v_031_010_0 = PB[1]*v_031_000_0 - PC1[l]*v_031_000_1 + 3*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_031_010_1 = PB[1]*v_031_000_1 - PC1[l]*v_031_000_2 + 3*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_031_110_0 = PB[0]*v_031_010_0 - PC0[l]*v_031_010_1;
+        const double v_031_010_2 = PB[1]*v_031_000_2 - PC1[l]*v_031_000_3 + 3*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_031_110_1 = PB[0]*v_031_010_1 - PC0[l]*v_031_010_2;
+        const double v_031_210_0 = PB[0]*v_031_110_0 - PC0[l]*v_031_110_1 + 1*oo2p*(v_031_010_0 - v_031_010_1);
+        const double v_031_010_3 = PB[1]*v_031_000_3 - PC1[l]*v_031_000_4 + 3*oo2p*(v_021_000_3 - v_021_000_4);
+        const double v_031_110_2 = PB[0]*v_031_010_2 - PC0[l]*v_031_010_3;
+        const double v_031_210_1 = PB[0]*v_031_110_1 - PC0[l]*v_031_110_2 + 1*oo2p*(v_031_010_1 - v_031_010_2);
+        const double v_031_310_0 = PB[0]*v_031_210_0 - PC0[l]*v_031_210_1 + 2*oo2p*(v_031_110_0 - v_031_110_1);
+        const double v_031_001_0 = PB[2]*v_031_000_0 - PC2[l]*v_031_000_1 + 1*oo2p*(v_030_000_0 - v_030_000_1);
+        const double v_031_001_1 = PB[2]*v_031_000_1 - PC2[l]*v_031_000_2 + 1*oo2p*(v_030_000_1 - v_030_000_2);
+        const double v_031_101_0 = PB[0]*v_031_001_0 - PC0[l]*v_031_001_1;
+        const double v_031_001_2 = PB[2]*v_031_000_2 - PC2[l]*v_031_000_3 + 1*oo2p*(v_030_000_2 - v_030_000_3);
+        const double v_031_101_1 = PB[0]*v_031_001_1 - PC0[l]*v_031_001_2;
+        const double v_031_201_0 = PB[0]*v_031_101_0 - PC0[l]*v_031_101_1 + 1*oo2p*(v_031_001_0 - v_031_001_1);
+        const double v_031_001_3 = PB[2]*v_031_000_3 - PC2[l]*v_031_000_4 + 1*oo2p*(v_030_000_3 - v_030_000_4);
+        const double v_031_101_2 = PB[0]*v_031_001_2 - PC0[l]*v_031_001_3;
+        const double v_031_201_1 = PB[0]*v_031_101_1 - PC0[l]*v_031_101_2 + 1*oo2p*(v_031_001_1 - v_031_001_2);
+        const double v_031_301_0 = PB[0]*v_031_201_0 - PC0[l]*v_031_201_1 + 2*oo2p*(v_031_101_0 - v_031_101_1);
+        const double v_031_020_0 = PB[1]*v_031_010_0 - PC1[l]*v_031_010_1 + 3*oo2p*(v_021_010_0 - v_021_010_1) + 1*oo2p*(v_031_000_0 - v_031_000_1);
+        const double v_031_020_1 = PB[1]*v_031_010_1 - PC1[l]*v_031_010_2 + 3*oo2p*(v_021_010_1 - v_021_010_2) + 1*oo2p*(v_031_000_1 - v_031_000_2);
+        const double v_031_120_0 = PB[0]*v_031_020_0 - PC0[l]*v_031_020_1;
+        const double v_031_020_2 = PB[1]*v_031_010_2 - PC1[l]*v_031_010_3 + 3*oo2p*(v_021_010_2 - v_021_010_3) + 1*oo2p*(v_031_000_2 - v_031_000_3);
+        const double v_031_120_1 = PB[0]*v_031_020_1 - PC0[l]*v_031_020_2;
+        const double v_031_220_0 = PB[0]*v_031_120_0 - PC0[l]*v_031_120_1 + 1*oo2p*(v_031_020_0 - v_031_020_1);
+        const double v_031_011_0 = PB[1]*v_031_001_0 - PC1[l]*v_031_001_1 + 3*oo2p*(v_021_001_0 - v_021_001_1);
+        const double v_031_011_1 = PB[1]*v_031_001_1 - PC1[l]*v_031_001_2 + 3*oo2p*(v_021_001_1 - v_021_001_2);
+        const double v_031_111_0 = PB[0]*v_031_011_0 - PC0[l]*v_031_011_1;
+        const double v_031_011_2 = PB[1]*v_031_001_2 - PC1[l]*v_031_001_3 + 3*oo2p*(v_021_001_2 - v_021_001_3);
+        const double v_031_111_1 = PB[0]*v_031_011_1 - PC0[l]*v_031_011_2;
+        const double v_031_211_0 = PB[0]*v_031_111_0 - PC0[l]*v_031_111_1 + 1*oo2p*(v_031_011_0 - v_031_011_1);
+        const double v_031_002_0 = PB[2]*v_031_001_0 - PC2[l]*v_031_001_1 + 1*oo2p*(v_030_001_0 - v_030_001_1) + 1*oo2p*(v_031_000_0 - v_031_000_1);
+        const double v_031_002_1 = PB[2]*v_031_001_1 - PC2[l]*v_031_001_2 + 1*oo2p*(v_030_001_1 - v_030_001_2) + 1*oo2p*(v_031_000_1 - v_031_000_2);
+        const double v_031_102_0 = PB[0]*v_031_002_0 - PC0[l]*v_031_002_1;
+        const double v_031_002_2 = PB[2]*v_031_001_2 - PC2[l]*v_031_001_3 + 1*oo2p*(v_030_001_2 - v_030_001_3) + 1*oo2p*(v_031_000_2 - v_031_000_3);
+        const double v_031_102_1 = PB[0]*v_031_002_1 - PC0[l]*v_031_002_2;
+        const double v_031_202_0 = PB[0]*v_031_102_0 - PC0[l]*v_031_102_1 + 1*oo2p*(v_031_002_0 - v_031_002_1);
+        const double v_031_030_0 = PB[1]*v_031_020_0 - PC1[l]*v_031_020_1 + 3*oo2p*(v_021_020_0 - v_021_020_1) + 2*oo2p*(v_031_010_0 - v_031_010_1);
+        const double v_031_030_1 = PB[1]*v_031_020_1 - PC1[l]*v_031_020_2 + 3*oo2p*(v_021_020_1 - v_021_020_2) + 2*oo2p*(v_031_010_1 - v_031_010_2);
+        const double v_031_130_0 = PB[0]*v_031_030_0 - PC0[l]*v_031_030_1;
+        const double v_031_021_0 = PB[2]*v_031_020_0 - PC2[l]*v_031_020_1 + 1*oo2p*(v_030_020_0 - v_030_020_1);
+        const double v_031_021_1 = PB[2]*v_031_020_1 - PC2[l]*v_031_020_2 + 1*oo2p*(v_030_020_1 - v_030_020_2);
+        const double v_031_121_0 = PB[0]*v_031_021_0 - PC0[l]*v_031_021_1;
+        const double v_031_012_0 = PB[1]*v_031_002_0 - PC1[l]*v_031_002_1 + 3*oo2p*(v_021_002_0 - v_021_002_1);
+        const double v_031_012_1 = PB[1]*v_031_002_1 - PC1[l]*v_031_002_2 + 3*oo2p*(v_021_002_1 - v_021_002_2);
+        const double v_031_112_0 = PB[0]*v_031_012_0 - PC0[l]*v_031_012_1;
+        const double v_031_003_0 = PB[2]*v_031_002_0 - PC2[l]*v_031_002_1 + 1*oo2p*(v_030_002_0 - v_030_002_1) + 2*oo2p*(v_031_001_0 - v_031_001_1);
+        const double v_031_003_1 = PB[2]*v_031_002_1 - PC2[l]*v_031_002_2 + 1*oo2p*(v_030_002_1 - v_030_002_2) + 2*oo2p*(v_031_001_1 - v_031_001_2);
+        const double v_031_103_0 = PB[0]*v_031_003_0 - PC0[l]*v_031_003_1;
+        const double v_031_040_0 = PB[1]*v_031_030_0 - PC1[l]*v_031_030_1 + 3*oo2p*(v_021_030_0 - v_021_030_1) + 3*oo2p*(v_031_020_0 - v_031_020_1);
+        const double v_031_031_0 = PB[2]*v_031_030_0 - PC2[l]*v_031_030_1 + 1*oo2p*(v_030_030_0 - v_030_030_1);
+        const double v_031_022_0 = PB[1]*v_031_012_0 - PC1[l]*v_031_012_1 + 3*oo2p*(v_021_012_0 - v_021_012_1) + 1*oo2p*(v_031_002_0 - v_031_002_1);
+        const double v_031_013_0 = PB[1]*v_031_003_0 - PC1[l]*v_031_003_1 + 3*oo2p*(v_021_003_0 - v_021_003_1);
+        const double v_031_004_0 = PB[2]*v_031_003_0 - PC2[l]*v_031_003_1 + 1*oo2p*(v_030_003_0 - v_030_003_1) + 3*oo2p*(v_031_002_0 - v_031_002_1);
+        const double v_022_000_0 = PA[1]*v_012_000_0 - PC1[l]*v_012_000_1 + 1*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_022_000_1 = PA[1]*v_012_000_1 - PC1[l]*v_012_000_2 + 1*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_022_100_0 = PB[0]*v_022_000_0 - PC0[l]*v_022_000_1;
+        const double v_022_000_2 = PA[1]*v_012_000_2 - PC1[l]*v_012_000_3 + 1*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_022_100_1 = PB[0]*v_022_000_1 - PC0[l]*v_022_000_2;
+        const double v_022_200_0 = PB[0]*v_022_100_0 - PC0[l]*v_022_100_1 + 1*oo2p*(v_022_000_0 - v_022_000_1);
+        const double v_022_000_3 = PA[1]*v_012_000_3 - PC1[l]*v_012_000_4 + 1*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_022_100_2 = PB[0]*v_022_000_2 - PC0[l]*v_022_000_3;
+        const double v_022_200_1 = PB[0]*v_022_100_1 - PC0[l]*v_022_100_2 + 1*oo2p*(v_022_000_1 - v_022_000_2);
+        const double v_022_300_0 = PB[0]*v_022_200_0 - PC0[l]*v_022_200_1 + 2*oo2p*(v_022_100_0 - v_022_100_1);
+        const double v_022_000_4 = PA[1]*v_012_000_4 - PC1[l]*v_012_000_5 + 1*oo2p*(v_002_000_4 - v_002_000_5);
+        const double v_022_100_3 = PB[0]*v_022_000_3 - PC0[l]*v_022_000_4;
+        const double v_022_200_2 = PB[0]*v_022_100_2 - PC0[l]*v_022_100_3 + 1*oo2p*(v_022_000_2 - v_022_000_3);
+        const double v_022_300_1 = PB[0]*v_022_200_1 - PC0[l]*v_022_200_2 + 2*oo2p*(v_022_100_1 - v_022_100_2);
+        const double v_022_400_0 = PB[0]*v_022_300_0 - PC0[l]*v_022_300_1 + 3*oo2p*(v_022_200_0 - v_022_200_1);
+        const double v_022_010_0 = PB[1]*v_022_000_0 - PC1[l]*v_022_000_1 + 2*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_022_010_1 = PB[1]*v_022_000_1 - PC1[l]*v_022_000_2 + 2*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_022_110_0 = PB[0]*v_022_010_0 - PC0[l]*v_022_010_1;
+        const double v_022_010_2 = PB[1]*v_022_000_2 - PC1[l]*v_022_000_3 + 2*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_022_110_1 = PB[0]*v_022_010_1 - PC0[l]*v_022_010_2;
+        const double v_022_210_0 = PB[0]*v_022_110_0 - PC0[l]*v_022_110_1 + 1*oo2p*(v_022_010_0 - v_022_010_1);
+        const double v_022_010_3 = PB[1]*v_022_000_3 - PC1[l]*v_022_000_4 + 2*oo2p*(v_012_000_3 - v_012_000_4);
+        const double v_022_110_2 = PB[0]*v_022_010_2 - PC0[l]*v_022_010_3;
+        const double v_022_210_1 = PB[0]*v_022_110_1 - PC0[l]*v_022_110_2 + 1*oo2p*(v_022_010_1 - v_022_010_2);
+        const double v_022_310_0 = PB[0]*v_022_210_0 - PC0[l]*v_022_210_1 + 2*oo2p*(v_022_110_0 - v_022_110_1);
+        const double v_022_001_0 = PB[2]*v_022_000_0 - PC2[l]*v_022_000_1 + 2*oo2p*(v_021_000_0 - v_021_000_1);
+        const double v_022_001_1 = PB[2]*v_022_000_1 - PC2[l]*v_022_000_2 + 2*oo2p*(v_021_000_1 - v_021_000_2);
+        const double v_022_101_0 = PB[0]*v_022_001_0 - PC0[l]*v_022_001_1;
+        const double v_022_001_2 = PB[2]*v_022_000_2 - PC2[l]*v_022_000_3 + 2*oo2p*(v_021_000_2 - v_021_000_3);
+        const double v_022_101_1 = PB[0]*v_022_001_1 - PC0[l]*v_022_001_2;
+        const double v_022_201_0 = PB[0]*v_022_101_0 - PC0[l]*v_022_101_1 + 1*oo2p*(v_022_001_0 - v_022_001_1);
+        const double v_022_001_3 = PB[2]*v_022_000_3 - PC2[l]*v_022_000_4 + 2*oo2p*(v_021_000_3 - v_021_000_4);
+        const double v_022_101_2 = PB[0]*v_022_001_2 - PC0[l]*v_022_001_3;
+        const double v_022_201_1 = PB[0]*v_022_101_1 - PC0[l]*v_022_101_2 + 1*oo2p*(v_022_001_1 - v_022_001_2);
+        const double v_022_301_0 = PB[0]*v_022_201_0 - PC0[l]*v_022_201_1 + 2*oo2p*(v_022_101_0 - v_022_101_1);
+        const double v_022_020_0 = PB[1]*v_022_010_0 - PC1[l]*v_022_010_1 + 2*oo2p*(v_012_010_0 - v_012_010_1) + 1*oo2p*(v_022_000_0 - v_022_000_1);
+        const double v_022_020_1 = PB[1]*v_022_010_1 - PC1[l]*v_022_010_2 + 2*oo2p*(v_012_010_1 - v_012_010_2) + 1*oo2p*(v_022_000_1 - v_022_000_2);
+        const double v_022_120_0 = PB[0]*v_022_020_0 - PC0[l]*v_022_020_1;
+        const double v_022_020_2 = PB[1]*v_022_010_2 - PC1[l]*v_022_010_3 + 2*oo2p*(v_012_010_2 - v_012_010_3) + 1*oo2p*(v_022_000_2 - v_022_000_3);
+        const double v_022_120_1 = PB[0]*v_022_020_1 - PC0[l]*v_022_020_2;
+        const double v_022_220_0 = PB[0]*v_022_120_0 - PC0[l]*v_022_120_1 + 1*oo2p*(v_022_020_0 - v_022_020_1);
+        const double v_022_011_0 = PB[1]*v_022_001_0 - PC1[l]*v_022_001_1 + 2*oo2p*(v_012_001_0 - v_012_001_1);
+        const double v_022_011_1 = PB[1]*v_022_001_1 - PC1[l]*v_022_001_2 + 2*oo2p*(v_012_001_1 - v_012_001_2);
+        const double v_022_111_0 = PB[0]*v_022_011_0 - PC0[l]*v_022_011_1;
+        const double v_022_011_2 = PB[1]*v_022_001_2 - PC1[l]*v_022_001_3 + 2*oo2p*(v_012_001_2 - v_012_001_3);
+        const double v_022_111_1 = PB[0]*v_022_011_1 - PC0[l]*v_022_011_2;
+        const double v_022_211_0 = PB[0]*v_022_111_0 - PC0[l]*v_022_111_1 + 1*oo2p*(v_022_011_0 - v_022_011_1);
+        const double v_022_002_0 = PB[2]*v_022_001_0 - PC2[l]*v_022_001_1 + 2*oo2p*(v_021_001_0 - v_021_001_1) + 1*oo2p*(v_022_000_0 - v_022_000_1);
+        const double v_022_002_1 = PB[2]*v_022_001_1 - PC2[l]*v_022_001_2 + 2*oo2p*(v_021_001_1 - v_021_001_2) + 1*oo2p*(v_022_000_1 - v_022_000_2);
+        const double v_022_102_0 = PB[0]*v_022_002_0 - PC0[l]*v_022_002_1;
+        const double v_022_002_2 = PB[2]*v_022_001_2 - PC2[l]*v_022_001_3 + 2*oo2p*(v_021_001_2 - v_021_001_3) + 1*oo2p*(v_022_000_2 - v_022_000_3);
+        const double v_022_102_1 = PB[0]*v_022_002_1 - PC0[l]*v_022_002_2;
+        const double v_022_202_0 = PB[0]*v_022_102_0 - PC0[l]*v_022_102_1 + 1*oo2p*(v_022_002_0 - v_022_002_1);
+        const double v_022_030_0 = PB[1]*v_022_020_0 - PC1[l]*v_022_020_1 + 2*oo2p*(v_012_020_0 - v_012_020_1) + 2*oo2p*(v_022_010_0 - v_022_010_1);
+        const double v_022_030_1 = PB[1]*v_022_020_1 - PC1[l]*v_022_020_2 + 2*oo2p*(v_012_020_1 - v_012_020_2) + 2*oo2p*(v_022_010_1 - v_022_010_2);
+        const double v_022_130_0 = PB[0]*v_022_030_0 - PC0[l]*v_022_030_1;
+        const double v_022_021_0 = PB[2]*v_022_020_0 - PC2[l]*v_022_020_1 + 2*oo2p*(v_021_020_0 - v_021_020_1);
+        const double v_022_021_1 = PB[2]*v_022_020_1 - PC2[l]*v_022_020_2 + 2*oo2p*(v_021_020_1 - v_021_020_2);
+        const double v_022_121_0 = PB[0]*v_022_021_0 - PC0[l]*v_022_021_1;
+        const double v_022_012_0 = PB[1]*v_022_002_0 - PC1[l]*v_022_002_1 + 2*oo2p*(v_012_002_0 - v_012_002_1);
+        const double v_022_012_1 = PB[1]*v_022_002_1 - PC1[l]*v_022_002_2 + 2*oo2p*(v_012_002_1 - v_012_002_2);
+        const double v_022_112_0 = PB[0]*v_022_012_0 - PC0[l]*v_022_012_1;
+        const double v_022_003_0 = PB[2]*v_022_002_0 - PC2[l]*v_022_002_1 + 2*oo2p*(v_021_002_0 - v_021_002_1) + 2*oo2p*(v_022_001_0 - v_022_001_1);
+        const double v_022_003_1 = PB[2]*v_022_002_1 - PC2[l]*v_022_002_2 + 2*oo2p*(v_021_002_1 - v_021_002_2) + 2*oo2p*(v_022_001_1 - v_022_001_2);
+        const double v_022_103_0 = PB[0]*v_022_003_0 - PC0[l]*v_022_003_1;
+        const double v_022_040_0 = PB[1]*v_022_030_0 - PC1[l]*v_022_030_1 + 2*oo2p*(v_012_030_0 - v_012_030_1) + 3*oo2p*(v_022_020_0 - v_022_020_1);
+        const double v_022_031_0 = PB[2]*v_022_030_0 - PC2[l]*v_022_030_1 + 2*oo2p*(v_021_030_0 - v_021_030_1);
+        const double v_022_022_0 = PB[1]*v_022_012_0 - PC1[l]*v_022_012_1 + 2*oo2p*(v_012_012_0 - v_012_012_1) + 1*oo2p*(v_022_002_0 - v_022_002_1);
+        const double v_022_013_0 = PB[1]*v_022_003_0 - PC1[l]*v_022_003_1 + 2*oo2p*(v_012_003_0 - v_012_003_1);
+        const double v_022_004_0 = PB[2]*v_022_003_0 - PC2[l]*v_022_003_1 + 2*oo2p*(v_021_003_0 - v_021_003_1) + 3*oo2p*(v_022_002_0 - v_022_002_1);
+        const double v_013_000_0 = PA[1]*v_003_000_0 - PC1[l]*v_003_000_1;
+        const double v_013_000_1 = PA[1]*v_003_000_1 - PC1[l]*v_003_000_2;
+        const double v_013_100_0 = PB[0]*v_013_000_0 - PC0[l]*v_013_000_1;
+        const double v_013_000_2 = PA[1]*v_003_000_2 - PC1[l]*v_003_000_3;
+        const double v_013_100_1 = PB[0]*v_013_000_1 - PC0[l]*v_013_000_2;
+        const double v_013_200_0 = PB[0]*v_013_100_0 - PC0[l]*v_013_100_1 + 1*oo2p*(v_013_000_0 - v_013_000_1);
+        const double v_013_000_3 = PA[1]*v_003_000_3 - PC1[l]*v_003_000_4;
+        const double v_013_100_2 = PB[0]*v_013_000_2 - PC0[l]*v_013_000_3;
+        const double v_013_200_1 = PB[0]*v_013_100_1 - PC0[l]*v_013_100_2 + 1*oo2p*(v_013_000_1 - v_013_000_2);
+        const double v_013_300_0 = PB[0]*v_013_200_0 - PC0[l]*v_013_200_1 + 2*oo2p*(v_013_100_0 - v_013_100_1);
+        const double v_013_000_4 = PA[1]*v_003_000_4 - PC1[l]*v_003_000_5;
+        const double v_013_100_3 = PB[0]*v_013_000_3 - PC0[l]*v_013_000_4;
+        const double v_013_200_2 = PB[0]*v_013_100_2 - PC0[l]*v_013_100_3 + 1*oo2p*(v_013_000_2 - v_013_000_3);
+        const double v_013_300_1 = PB[0]*v_013_200_1 - PC0[l]*v_013_200_2 + 2*oo2p*(v_013_100_1 - v_013_100_2);
+        const double v_013_400_0 = PB[0]*v_013_300_0 - PC0[l]*v_013_300_1 + 3*oo2p*(v_013_200_0 - v_013_200_1);
+        const double v_013_010_0 = PB[1]*v_013_000_0 - PC1[l]*v_013_000_1 + 1*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_013_010_1 = PB[1]*v_013_000_1 - PC1[l]*v_013_000_2 + 1*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_013_110_0 = PB[0]*v_013_010_0 - PC0[l]*v_013_010_1;
+        const double v_013_010_2 = PB[1]*v_013_000_2 - PC1[l]*v_013_000_3 + 1*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_013_110_1 = PB[0]*v_013_010_1 - PC0[l]*v_013_010_2;
+        const double v_013_210_0 = PB[0]*v_013_110_0 - PC0[l]*v_013_110_1 + 1*oo2p*(v_013_010_0 - v_013_010_1);
+        const double v_013_010_3 = PB[1]*v_013_000_3 - PC1[l]*v_013_000_4 + 1*oo2p*(v_003_000_3 - v_003_000_4);
+        const double v_013_110_2 = PB[0]*v_013_010_2 - PC0[l]*v_013_010_3;
+        const double v_013_210_1 = PB[0]*v_013_110_1 - PC0[l]*v_013_110_2 + 1*oo2p*(v_013_010_1 - v_013_010_2);
+        const double v_013_310_0 = PB[0]*v_013_210_0 - PC0[l]*v_013_210_1 + 2*oo2p*(v_013_110_0 - v_013_110_1);
+        const double v_013_001_0 = PB[2]*v_013_000_0 - PC2[l]*v_013_000_1 + 3*oo2p*(v_012_000_0 - v_012_000_1);
+        const double v_013_001_1 = PB[2]*v_013_000_1 - PC2[l]*v_013_000_2 + 3*oo2p*(v_012_000_1 - v_012_000_2);
+        const double v_013_101_0 = PB[0]*v_013_001_0 - PC0[l]*v_013_001_1;
+        const double v_013_001_2 = PB[2]*v_013_000_2 - PC2[l]*v_013_000_3 + 3*oo2p*(v_012_000_2 - v_012_000_3);
+        const double v_013_101_1 = PB[0]*v_013_001_1 - PC0[l]*v_013_001_2;
+        const double v_013_201_0 = PB[0]*v_013_101_0 - PC0[l]*v_013_101_1 + 1*oo2p*(v_013_001_0 - v_013_001_1);
+        const double v_013_001_3 = PB[2]*v_013_000_3 - PC2[l]*v_013_000_4 + 3*oo2p*(v_012_000_3 - v_012_000_4);
+        const double v_013_101_2 = PB[0]*v_013_001_2 - PC0[l]*v_013_001_3;
+        const double v_013_201_1 = PB[0]*v_013_101_1 - PC0[l]*v_013_101_2 + 1*oo2p*(v_013_001_1 - v_013_001_2);
+        const double v_013_301_0 = PB[0]*v_013_201_0 - PC0[l]*v_013_201_1 + 2*oo2p*(v_013_101_0 - v_013_101_1);
+        const double v_013_020_0 = PB[1]*v_013_010_0 - PC1[l]*v_013_010_1 + 1*oo2p*(v_003_010_0 - v_003_010_1) + 1*oo2p*(v_013_000_0 - v_013_000_1);
+        const double v_013_020_1 = PB[1]*v_013_010_1 - PC1[l]*v_013_010_2 + 1*oo2p*(v_003_010_1 - v_003_010_2) + 1*oo2p*(v_013_000_1 - v_013_000_2);
+        const double v_013_120_0 = PB[0]*v_013_020_0 - PC0[l]*v_013_020_1;
+        const double v_013_020_2 = PB[1]*v_013_010_2 - PC1[l]*v_013_010_3 + 1*oo2p*(v_003_010_2 - v_003_010_3) + 1*oo2p*(v_013_000_2 - v_013_000_3);
+        const double v_013_120_1 = PB[0]*v_013_020_1 - PC0[l]*v_013_020_2;
+        const double v_013_220_0 = PB[0]*v_013_120_0 - PC0[l]*v_013_120_1 + 1*oo2p*(v_013_020_0 - v_013_020_1);
+        const double v_013_011_0 = PB[1]*v_013_001_0 - PC1[l]*v_013_001_1 + 1*oo2p*(v_003_001_0 - v_003_001_1);
+        const double v_013_011_1 = PB[1]*v_013_001_1 - PC1[l]*v_013_001_2 + 1*oo2p*(v_003_001_1 - v_003_001_2);
+        const double v_013_111_0 = PB[0]*v_013_011_0 - PC0[l]*v_013_011_1;
+        const double v_013_011_2 = PB[1]*v_013_001_2 - PC1[l]*v_013_001_3 + 1*oo2p*(v_003_001_2 - v_003_001_3);
+        const double v_013_111_1 = PB[0]*v_013_011_1 - PC0[l]*v_013_011_2;
+        const double v_013_211_0 = PB[0]*v_013_111_0 - PC0[l]*v_013_111_1 + 1*oo2p*(v_013_011_0 - v_013_011_1);
+        const double v_013_002_0 = PB[2]*v_013_001_0 - PC2[l]*v_013_001_1 + 3*oo2p*(v_012_001_0 - v_012_001_1) + 1*oo2p*(v_013_000_0 - v_013_000_1);
+        const double v_013_002_1 = PB[2]*v_013_001_1 - PC2[l]*v_013_001_2 + 3*oo2p*(v_012_001_1 - v_012_001_2) + 1*oo2p*(v_013_000_1 - v_013_000_2);
+        const double v_013_102_0 = PB[0]*v_013_002_0 - PC0[l]*v_013_002_1;
+        const double v_013_002_2 = PB[2]*v_013_001_2 - PC2[l]*v_013_001_3 + 3*oo2p*(v_012_001_2 - v_012_001_3) + 1*oo2p*(v_013_000_2 - v_013_000_3);
+        const double v_013_102_1 = PB[0]*v_013_002_1 - PC0[l]*v_013_002_2;
+        const double v_013_202_0 = PB[0]*v_013_102_0 - PC0[l]*v_013_102_1 + 1*oo2p*(v_013_002_0 - v_013_002_1);
+        const double v_013_030_0 = PB[1]*v_013_020_0 - PC1[l]*v_013_020_1 + 1*oo2p*(v_003_020_0 - v_003_020_1) + 2*oo2p*(v_013_010_0 - v_013_010_1);
+        const double v_013_030_1 = PB[1]*v_013_020_1 - PC1[l]*v_013_020_2 + 1*oo2p*(v_003_020_1 - v_003_020_2) + 2*oo2p*(v_013_010_1 - v_013_010_2);
+        const double v_013_130_0 = PB[0]*v_013_030_0 - PC0[l]*v_013_030_1;
+        const double v_013_021_0 = PB[2]*v_013_020_0 - PC2[l]*v_013_020_1 + 3*oo2p*(v_012_020_0 - v_012_020_1);
+        const double v_013_021_1 = PB[2]*v_013_020_1 - PC2[l]*v_013_020_2 + 3*oo2p*(v_012_020_1 - v_012_020_2);
+        const double v_013_121_0 = PB[0]*v_013_021_0 - PC0[l]*v_013_021_1;
+        const double v_013_012_0 = PB[1]*v_013_002_0 - PC1[l]*v_013_002_1 + 1*oo2p*(v_003_002_0 - v_003_002_1);
+        const double v_013_012_1 = PB[1]*v_013_002_1 - PC1[l]*v_013_002_2 + 1*oo2p*(v_003_002_1 - v_003_002_2);
+        const double v_013_112_0 = PB[0]*v_013_012_0 - PC0[l]*v_013_012_1;
+        const double v_013_003_0 = PB[2]*v_013_002_0 - PC2[l]*v_013_002_1 + 3*oo2p*(v_012_002_0 - v_012_002_1) + 2*oo2p*(v_013_001_0 - v_013_001_1);
+        const double v_013_003_1 = PB[2]*v_013_002_1 - PC2[l]*v_013_002_2 + 3*oo2p*(v_012_002_1 - v_012_002_2) + 2*oo2p*(v_013_001_1 - v_013_001_2);
+        const double v_013_103_0 = PB[0]*v_013_003_0 - PC0[l]*v_013_003_1;
+        const double v_013_040_0 = PB[1]*v_013_030_0 - PC1[l]*v_013_030_1 + 1*oo2p*(v_003_030_0 - v_003_030_1) + 3*oo2p*(v_013_020_0 - v_013_020_1);
+        const double v_013_031_0 = PB[2]*v_013_030_0 - PC2[l]*v_013_030_1 + 3*oo2p*(v_012_030_0 - v_012_030_1);
+        const double v_003_012_0 = PB[1]*v_003_002_0 - PC1[l]*v_003_002_1;
+        const double v_003_012_1 = PB[1]*v_003_002_1 - PC1[l]*v_003_002_2;
+        const double v_013_022_0 = PB[1]*v_013_012_0 - PC1[l]*v_013_012_1 + 1*oo2p*(v_003_012_0 - v_003_012_1) + 1*oo2p*(v_013_002_0 - v_013_002_1);
+        const double v_013_013_0 = PB[1]*v_013_003_0 - PC1[l]*v_013_003_1 + 1*oo2p*(v_003_003_0 - v_003_003_1);
+        const double v_013_004_0 = PB[2]*v_013_003_0 - PC2[l]*v_013_003_1 + 3*oo2p*(v_012_003_0 - v_012_003_1) + 3*oo2p*(v_013_002_0 - v_013_002_1);
+        const double v_004_000_0 = PA[2]*v_003_000_0 - PC2[l]*v_003_000_1 + 3*oo2p*(v_002_000_0 - v_002_000_1);
+        const double v_004_000_1 = PA[2]*v_003_000_1 - PC2[l]*v_003_000_2 + 3*oo2p*(v_002_000_1 - v_002_000_2);
+        const double v_004_100_0 = PB[0]*v_004_000_0 - PC0[l]*v_004_000_1;
+        const double v_004_000_2 = PA[2]*v_003_000_2 - PC2[l]*v_003_000_3 + 3*oo2p*(v_002_000_2 - v_002_000_3);
+        const double v_004_100_1 = PB[0]*v_004_000_1 - PC0[l]*v_004_000_2;
+        const double v_004_200_0 = PB[0]*v_004_100_0 - PC0[l]*v_004_100_1 + 1*oo2p*(v_004_000_0 - v_004_000_1);
+        const double v_004_000_3 = PA[2]*v_003_000_3 - PC2[l]*v_003_000_4 + 3*oo2p*(v_002_000_3 - v_002_000_4);
+        const double v_004_100_2 = PB[0]*v_004_000_2 - PC0[l]*v_004_000_3;
+        const double v_004_200_1 = PB[0]*v_004_100_1 - PC0[l]*v_004_100_2 + 1*oo2p*(v_004_000_1 - v_004_000_2);
+        const double v_004_300_0 = PB[0]*v_004_200_0 - PC0[l]*v_004_200_1 + 2*oo2p*(v_004_100_0 - v_004_100_1);
+        const double v_004_000_4 = PA[2]*v_003_000_4 - PC2[l]*v_003_000_5 + 3*oo2p*(v_002_000_4 - v_002_000_5);
+        const double v_004_100_3 = PB[0]*v_004_000_3 - PC0[l]*v_004_000_4;
+        const double v_004_200_2 = PB[0]*v_004_100_2 - PC0[l]*v_004_100_3 + 1*oo2p*(v_004_000_2 - v_004_000_3);
+        const double v_004_300_1 = PB[0]*v_004_200_1 - PC0[l]*v_004_200_2 + 2*oo2p*(v_004_100_1 - v_004_100_2);
+        const double v_004_400_0 = PB[0]*v_004_300_0 - PC0[l]*v_004_300_1 + 3*oo2p*(v_004_200_0 - v_004_200_1);
+        const double v_004_310_0 = PB[1]*v_004_300_0 - PC1[l]*v_004_300_1;
+        const double v_004_001_0 = PB[2]*v_004_000_0 - PC2[l]*v_004_000_1 + 4*oo2p*(v_003_000_0 - v_003_000_1);
+        const double v_004_001_1 = PB[2]*v_004_000_1 - PC2[l]*v_004_000_2 + 4*oo2p*(v_003_000_1 - v_003_000_2);
+        const double v_004_101_0 = PB[0]*v_004_001_0 - PC0[l]*v_004_001_1;
+        const double v_004_001_2 = PB[2]*v_004_000_2 - PC2[l]*v_004_000_3 + 4*oo2p*(v_003_000_2 - v_003_000_3);
+        const double v_004_101_1 = PB[0]*v_004_001_1 - PC0[l]*v_004_001_2;
+        const double v_004_201_0 = PB[0]*v_004_101_0 - PC0[l]*v_004_101_1 + 1*oo2p*(v_004_001_0 - v_004_001_1);
+        const double v_004_001_3 = PB[2]*v_004_000_3 - PC2[l]*v_004_000_4 + 4*oo2p*(v_003_000_3 - v_003_000_4);
+        const double v_004_101_2 = PB[0]*v_004_001_2 - PC0[l]*v_004_001_3;
+        const double v_004_201_1 = PB[0]*v_004_101_1 - PC0[l]*v_004_101_2 + 1*oo2p*(v_004_001_1 - v_004_001_2);
+        const double v_004_301_0 = PB[0]*v_004_201_0 - PC0[l]*v_004_201_1 + 2*oo2p*(v_004_101_0 - v_004_101_1);
+        const double v_004_010_0 = PB[1]*v_004_000_0 - PC1[l]*v_004_000_1;
+        const double v_004_010_1 = PB[1]*v_004_000_1 - PC1[l]*v_004_000_2;
+        const double v_004_020_0 = PB[1]*v_004_010_0 - PC1[l]*v_004_010_1 + 1*oo2p*(v_004_000_0 - v_004_000_1);
+        const double v_004_010_2 = PB[1]*v_004_000_2 - PC1[l]*v_004_000_3;
+        const double v_004_020_1 = PB[1]*v_004_010_1 - PC1[l]*v_004_010_2 + 1*oo2p*(v_004_000_1 - v_004_000_2);
+        const double v_004_120_0 = PB[0]*v_004_020_0 - PC0[l]*v_004_020_1;
+        const double v_004_010_3 = PB[1]*v_004_000_3 - PC1[l]*v_004_000_4;
+        const double v_004_020_2 = PB[1]*v_004_010_2 - PC1[l]*v_004_010_3 + 1*oo2p*(v_004_000_2 - v_004_000_3);
+        const double v_004_120_1 = PB[0]*v_004_020_1 - PC0[l]*v_004_020_2;
+        const double v_004_220_0 = PB[0]*v_004_120_0 - PC0[l]*v_004_120_1 + 1*oo2p*(v_004_020_0 - v_004_020_1);
+        const double v_004_211_0 = PB[1]*v_004_201_0 - PC1[l]*v_004_201_1;
+        const double v_004_002_0 = PB[2]*v_004_001_0 - PC2[l]*v_004_001_1 + 4*oo2p*(v_003_001_0 - v_003_001_1) + 1*oo2p*(v_004_000_0 - v_004_000_1);
+        const double v_004_002_1 = PB[2]*v_004_001_1 - PC2[l]*v_004_001_2 + 4*oo2p*(v_003_001_1 - v_003_001_2) + 1*oo2p*(v_004_000_1 - v_004_000_2);
+        const double v_004_102_0 = PB[0]*v_004_002_0 - PC0[l]*v_004_002_1;
+        const double v_004_002_2 = PB[2]*v_004_001_2 - PC2[l]*v_004_001_3 + 4*oo2p*(v_003_001_2 - v_003_001_3) + 1*oo2p*(v_004_000_2 - v_004_000_3);
+        const double v_004_102_1 = PB[0]*v_004_002_1 - PC0[l]*v_004_002_2;
+        const double v_004_202_0 = PB[0]*v_004_102_0 - PC0[l]*v_004_102_1 + 1*oo2p*(v_004_002_0 - v_004_002_1);
+        const double v_004_030_0 = PB[1]*v_004_020_0 - PC1[l]*v_004_020_1 + 2*oo2p*(v_004_010_0 - v_004_010_1);
+        const double v_004_030_1 = PB[1]*v_004_020_1 - PC1[l]*v_004_020_2 + 2*oo2p*(v_004_010_1 - v_004_010_2);
+        const double v_004_130_0 = PB[0]*v_004_030_0 - PC0[l]*v_004_030_1;
+        const double v_004_011_0 = PB[1]*v_004_001_0 - PC1[l]*v_004_001_1;
+        const double v_004_011_1 = PB[1]*v_004_001_1 - PC1[l]*v_004_001_2;
+        const double v_004_021_0 = PB[1]*v_004_011_0 - PC1[l]*v_004_011_1 + 1*oo2p*(v_004_001_0 - v_004_001_1);
+        const double v_004_011_2 = PB[1]*v_004_001_2 - PC1[l]*v_004_001_3;
+        const double v_004_021_1 = PB[1]*v_004_011_1 - PC1[l]*v_004_011_2 + 1*oo2p*(v_004_001_1 - v_004_001_2);
+        const double v_004_121_0 = PB[0]*v_004_021_0 - PC0[l]*v_004_021_1;
+        const double v_004_012_0 = PB[1]*v_004_002_0 - PC1[l]*v_004_002_1;
+        const double v_004_012_1 = PB[1]*v_004_002_1 - PC1[l]*v_004_002_2;
+        const double v_004_112_0 = PB[0]*v_004_012_0 - PC0[l]*v_004_012_1;
+        const double v_004_003_0 = PB[2]*v_004_002_0 - PC2[l]*v_004_002_1 + 4*oo2p*(v_003_002_0 - v_003_002_1) + 2*oo2p*(v_004_001_0 - v_004_001_1);
+        const double v_004_003_1 = PB[2]*v_004_002_1 - PC2[l]*v_004_002_2 + 4*oo2p*(v_003_002_1 - v_003_002_2) + 2*oo2p*(v_004_001_1 - v_004_001_2);
+        const double v_004_103_0 = PB[0]*v_004_003_0 - PC0[l]*v_004_003_1;
+        const double v_004_040_0 = PB[1]*v_004_030_0 - PC1[l]*v_004_030_1 + 3*oo2p*(v_004_020_0 - v_004_020_1);
+        const double v_004_031_0 = PB[1]*v_004_021_0 - PC1[l]*v_004_021_1 + 2*oo2p*(v_004_011_0 - v_004_011_1);
+        const double v_004_022_0 = PB[1]*v_004_012_0 - PC1[l]*v_004_012_1 + 1*oo2p*(v_004_002_0 - v_004_002_1);
+        const double v_004_013_0 = PB[1]*v_004_003_0 - PC1[l]*v_004_003_1;
+        const double v_004_004_0 = PB[2]*v_004_003_0 - PC2[l]*v_004_003_1 + 4*oo2p*(v_003_003_0 - v_003_003_1) + 3*oo2p*(v_004_002_0 - v_004_002_1);
+
+        sum_0 += q[l]*v_400_400_0;
+        sum_1 += q[l]*v_400_310_0;
+        sum_2 += q[l]*v_400_301_0;
+        sum_3 += q[l]*v_400_220_0;
+        sum_4 += q[l]*v_400_211_0;
+        sum_5 += q[l]*v_400_202_0;
+        sum_6 += q[l]*v_400_130_0;
+        sum_7 += q[l]*v_400_121_0;
+        sum_8 += q[l]*v_400_112_0;
+        sum_9 += q[l]*v_400_103_0;
+        sum_10 += q[l]*v_400_040_0;
+        sum_11 += q[l]*v_400_031_0;
+        sum_12 += q[l]*v_400_022_0;
+        sum_13 += q[l]*v_400_013_0;
+        sum_14 += q[l]*v_400_004_0;
+        sum_15 += q[l]*v_310_400_0;
+        sum_16 += q[l]*v_310_310_0;
+        sum_17 += q[l]*v_310_301_0;
+        sum_18 += q[l]*v_310_220_0;
+        sum_19 += q[l]*v_310_211_0;
+        sum_20 += q[l]*v_310_202_0;
+        sum_21 += q[l]*v_310_130_0;
+        sum_22 += q[l]*v_310_121_0;
+        sum_23 += q[l]*v_310_112_0;
+        sum_24 += q[l]*v_310_103_0;
+        sum_25 += q[l]*v_310_040_0;
+        sum_26 += q[l]*v_310_031_0;
+        sum_27 += q[l]*v_310_022_0;
+        sum_28 += q[l]*v_310_013_0;
+        sum_29 += q[l]*v_310_004_0;
+        sum_30 += q[l]*v_301_400_0;
+        sum_31 += q[l]*v_301_310_0;
+        sum_32 += q[l]*v_301_301_0;
+        sum_33 += q[l]*v_301_220_0;
+        sum_34 += q[l]*v_301_211_0;
+        sum_35 += q[l]*v_301_202_0;
+        sum_36 += q[l]*v_301_130_0;
+        sum_37 += q[l]*v_301_121_0;
+        sum_38 += q[l]*v_301_112_0;
+        sum_39 += q[l]*v_301_103_0;
+        sum_40 += q[l]*v_301_040_0;
+        sum_41 += q[l]*v_301_031_0;
+        sum_42 += q[l]*v_301_022_0;
+        sum_43 += q[l]*v_301_013_0;
+        sum_44 += q[l]*v_301_004_0;
+        sum_45 += q[l]*v_220_400_0;
+        sum_46 += q[l]*v_220_310_0;
+        sum_47 += q[l]*v_220_301_0;
+        sum_48 += q[l]*v_220_220_0;
+        sum_49 += q[l]*v_220_211_0;
+        sum_50 += q[l]*v_220_202_0;
+        sum_51 += q[l]*v_220_130_0;
+        sum_52 += q[l]*v_220_121_0;
+        sum_53 += q[l]*v_220_112_0;
+        sum_54 += q[l]*v_220_103_0;
+        sum_55 += q[l]*v_220_040_0;
+        sum_56 += q[l]*v_220_031_0;
+        sum_57 += q[l]*v_220_022_0;
+        sum_58 += q[l]*v_220_013_0;
+        sum_59 += q[l]*v_220_004_0;
+        sum_60 += q[l]*v_211_400_0;
+        sum_61 += q[l]*v_211_310_0;
+        sum_62 += q[l]*v_211_301_0;
+        sum_63 += q[l]*v_211_220_0;
+        sum_64 += q[l]*v_211_211_0;
+        sum_65 += q[l]*v_211_202_0;
+        sum_66 += q[l]*v_211_130_0;
+        sum_67 += q[l]*v_211_121_0;
+        sum_68 += q[l]*v_211_112_0;
+        sum_69 += q[l]*v_211_103_0;
+        sum_70 += q[l]*v_211_040_0;
+        sum_71 += q[l]*v_211_031_0;
+        sum_72 += q[l]*v_211_022_0;
+        sum_73 += q[l]*v_211_013_0;
+        sum_74 += q[l]*v_211_004_0;
+        sum_75 += q[l]*v_202_400_0;
+        sum_76 += q[l]*v_202_310_0;
+        sum_77 += q[l]*v_202_301_0;
+        sum_78 += q[l]*v_202_220_0;
+        sum_79 += q[l]*v_202_211_0;
+        sum_80 += q[l]*v_202_202_0;
+        sum_81 += q[l]*v_202_130_0;
+        sum_82 += q[l]*v_202_121_0;
+        sum_83 += q[l]*v_202_112_0;
+        sum_84 += q[l]*v_202_103_0;
+        sum_85 += q[l]*v_202_040_0;
+        sum_86 += q[l]*v_202_031_0;
+        sum_87 += q[l]*v_202_022_0;
+        sum_88 += q[l]*v_202_013_0;
+        sum_89 += q[l]*v_202_004_0;
+        sum_90 += q[l]*v_130_400_0;
+        sum_91 += q[l]*v_130_310_0;
+        sum_92 += q[l]*v_130_301_0;
+        sum_93 += q[l]*v_130_220_0;
+        sum_94 += q[l]*v_130_211_0;
+        sum_95 += q[l]*v_130_202_0;
+        sum_96 += q[l]*v_130_130_0;
+        sum_97 += q[l]*v_130_121_0;
+        sum_98 += q[l]*v_130_112_0;
+        sum_99 += q[l]*v_130_103_0;
+        sum_100 += q[l]*v_130_040_0;
+        sum_101 += q[l]*v_130_031_0;
+        sum_102 += q[l]*v_130_022_0;
+        sum_103 += q[l]*v_130_013_0;
+        sum_104 += q[l]*v_130_004_0;
+        sum_105 += q[l]*v_121_400_0;
+        sum_106 += q[l]*v_121_310_0;
+        sum_107 += q[l]*v_121_301_0;
+        sum_108 += q[l]*v_121_220_0;
+        sum_109 += q[l]*v_121_211_0;
+        sum_110 += q[l]*v_121_202_0;
+        sum_111 += q[l]*v_121_130_0;
+        sum_112 += q[l]*v_121_121_0;
+        sum_113 += q[l]*v_121_112_0;
+        sum_114 += q[l]*v_121_103_0;
+        sum_115 += q[l]*v_121_040_0;
+        sum_116 += q[l]*v_121_031_0;
+        sum_117 += q[l]*v_121_022_0;
+        sum_118 += q[l]*v_121_013_0;
+        sum_119 += q[l]*v_121_004_0;
+        sum_120 += q[l]*v_112_400_0;
+        sum_121 += q[l]*v_112_310_0;
+        sum_122 += q[l]*v_112_301_0;
+        sum_123 += q[l]*v_112_220_0;
+        sum_124 += q[l]*v_112_211_0;
+        sum_125 += q[l]*v_112_202_0;
+        sum_126 += q[l]*v_112_130_0;
+        sum_127 += q[l]*v_112_121_0;
+        sum_128 += q[l]*v_112_112_0;
+        sum_129 += q[l]*v_112_103_0;
+        sum_130 += q[l]*v_112_040_0;
+        sum_131 += q[l]*v_112_031_0;
+        sum_132 += q[l]*v_112_022_0;
+        sum_133 += q[l]*v_112_013_0;
+        sum_134 += q[l]*v_112_004_0;
+        sum_135 += q[l]*v_103_400_0;
+        sum_136 += q[l]*v_103_310_0;
+        sum_137 += q[l]*v_103_301_0;
+        sum_138 += q[l]*v_103_220_0;
+        sum_139 += q[l]*v_103_211_0;
+        sum_140 += q[l]*v_103_202_0;
+        sum_141 += q[l]*v_103_130_0;
+        sum_142 += q[l]*v_103_121_0;
+        sum_143 += q[l]*v_103_112_0;
+        sum_144 += q[l]*v_103_103_0;
+        sum_145 += q[l]*v_103_040_0;
+        sum_146 += q[l]*v_103_031_0;
+        sum_147 += q[l]*v_103_022_0;
+        sum_148 += q[l]*v_103_013_0;
+        sum_149 += q[l]*v_103_004_0;
+        sum_150 += q[l]*v_040_400_0;
+        sum_151 += q[l]*v_040_310_0;
+        sum_152 += q[l]*v_040_301_0;
+        sum_153 += q[l]*v_040_220_0;
+        sum_154 += q[l]*v_040_211_0;
+        sum_155 += q[l]*v_040_202_0;
+        sum_156 += q[l]*v_040_130_0;
+        sum_157 += q[l]*v_040_121_0;
+        sum_158 += q[l]*v_040_112_0;
+        sum_159 += q[l]*v_040_103_0;
+        sum_160 += q[l]*v_040_040_0;
+        sum_161 += q[l]*v_040_031_0;
+        sum_162 += q[l]*v_040_022_0;
+        sum_163 += q[l]*v_040_013_0;
+        sum_164 += q[l]*v_040_004_0;
+        sum_165 += q[l]*v_031_400_0;
+        sum_166 += q[l]*v_031_310_0;
+        sum_167 += q[l]*v_031_301_0;
+        sum_168 += q[l]*v_031_220_0;
+        sum_169 += q[l]*v_031_211_0;
+        sum_170 += q[l]*v_031_202_0;
+        sum_171 += q[l]*v_031_130_0;
+        sum_172 += q[l]*v_031_121_0;
+        sum_173 += q[l]*v_031_112_0;
+        sum_174 += q[l]*v_031_103_0;
+        sum_175 += q[l]*v_031_040_0;
+        sum_176 += q[l]*v_031_031_0;
+        sum_177 += q[l]*v_031_022_0;
+        sum_178 += q[l]*v_031_013_0;
+        sum_179 += q[l]*v_031_004_0;
+        sum_180 += q[l]*v_022_400_0;
+        sum_181 += q[l]*v_022_310_0;
+        sum_182 += q[l]*v_022_301_0;
+        sum_183 += q[l]*v_022_220_0;
+        sum_184 += q[l]*v_022_211_0;
+        sum_185 += q[l]*v_022_202_0;
+        sum_186 += q[l]*v_022_130_0;
+        sum_187 += q[l]*v_022_121_0;
+        sum_188 += q[l]*v_022_112_0;
+        sum_189 += q[l]*v_022_103_0;
+        sum_190 += q[l]*v_022_040_0;
+        sum_191 += q[l]*v_022_031_0;
+        sum_192 += q[l]*v_022_022_0;
+        sum_193 += q[l]*v_022_013_0;
+        sum_194 += q[l]*v_022_004_0;
+        sum_195 += q[l]*v_013_400_0;
+        sum_196 += q[l]*v_013_310_0;
+        sum_197 += q[l]*v_013_301_0;
+        sum_198 += q[l]*v_013_220_0;
+        sum_199 += q[l]*v_013_211_0;
+        sum_200 += q[l]*v_013_202_0;
+        sum_201 += q[l]*v_013_130_0;
+        sum_202 += q[l]*v_013_121_0;
+        sum_203 += q[l]*v_013_112_0;
+        sum_204 += q[l]*v_013_103_0;
+        sum_205 += q[l]*v_013_040_0;
+        sum_206 += q[l]*v_013_031_0;
+        sum_207 += q[l]*v_013_022_0;
+        sum_208 += q[l]*v_013_013_0;
+        sum_209 += q[l]*v_013_004_0;
+        sum_210 += q[l]*v_004_400_0;
+        sum_211 += q[l]*v_004_310_0;
+        sum_212 += q[l]*v_004_301_0;
+        sum_213 += q[l]*v_004_220_0;
+        sum_214 += q[l]*v_004_211_0;
+        sum_215 += q[l]*v_004_202_0;
+        sum_216 += q[l]*v_004_130_0;
+        sum_217 += q[l]*v_004_121_0;
+        sum_218 += q[l]*v_004_112_0;
+        sum_219 += q[l]*v_004_103_0;
+        sum_220 += q[l]*v_004_040_0;
+        sum_221 += q[l]*v_004_031_0;
+        sum_222 += q[l]*v_004_022_0;
+        sum_223 += q[l]*v_004_013_0;
+        sum_224 += q[l]*v_004_004_0;
+    }
+
+    acc[0] += sum_0;
+    acc[1] += sum_1;
+    acc[2] += sum_2;
+    acc[3] += sum_3;
+    acc[4] += sum_4;
+    acc[5] += sum_5;
+    acc[6] += sum_6;
+    acc[7] += sum_7;
+    acc[8] += sum_8;
+    acc[9] += sum_9;
+    acc[10] += sum_10;
+    acc[11] += sum_11;
+    acc[12] += sum_12;
+    acc[13] += sum_13;
+    acc[14] += sum_14;
+    acc[15] += sum_15;
+    acc[16] += sum_16;
+    acc[17] += sum_17;
+    acc[18] += sum_18;
+    acc[19] += sum_19;
+    acc[20] += sum_20;
+    acc[21] += sum_21;
+    acc[22] += sum_22;
+    acc[23] += sum_23;
+    acc[24] += sum_24;
+    acc[25] += sum_25;
+    acc[26] += sum_26;
+    acc[27] += sum_27;
+    acc[28] += sum_28;
+    acc[29] += sum_29;
+    acc[30] += sum_30;
+    acc[31] += sum_31;
+    acc[32] += sum_32;
+    acc[33] += sum_33;
+    acc[34] += sum_34;
+    acc[35] += sum_35;
+    acc[36] += sum_36;
+    acc[37] += sum_37;
+    acc[38] += sum_38;
+    acc[39] += sum_39;
+    acc[40] += sum_40;
+    acc[41] += sum_41;
+    acc[42] += sum_42;
+    acc[43] += sum_43;
+    acc[44] += sum_44;
+    acc[45] += sum_45;
+    acc[46] += sum_46;
+    acc[47] += sum_47;
+    acc[48] += sum_48;
+    acc[49] += sum_49;
+    acc[50] += sum_50;
+    acc[51] += sum_51;
+    acc[52] += sum_52;
+    acc[53] += sum_53;
+    acc[54] += sum_54;
+    acc[55] += sum_55;
+    acc[56] += sum_56;
+    acc[57] += sum_57;
+    acc[58] += sum_58;
+    acc[59] += sum_59;
+    acc[60] += sum_60;
+    acc[61] += sum_61;
+    acc[62] += sum_62;
+    acc[63] += sum_63;
+    acc[64] += sum_64;
+    acc[65] += sum_65;
+    acc[66] += sum_66;
+    acc[67] += sum_67;
+    acc[68] += sum_68;
+    acc[69] += sum_69;
+    acc[70] += sum_70;
+    acc[71] += sum_71;
+    acc[72] += sum_72;
+    acc[73] += sum_73;
+    acc[74] += sum_74;
+    acc[75] += sum_75;
+    acc[76] += sum_76;
+    acc[77] += sum_77;
+    acc[78] += sum_78;
+    acc[79] += sum_79;
+    acc[80] += sum_80;
+    acc[81] += sum_81;
+    acc[82] += sum_82;
+    acc[83] += sum_83;
+    acc[84] += sum_84;
+    acc[85] += sum_85;
+    acc[86] += sum_86;
+    acc[87] += sum_87;
+    acc[88] += sum_88;
+    acc[89] += sum_89;
+    acc[90] += sum_90;
+    acc[91] += sum_91;
+    acc[92] += sum_92;
+    acc[93] += sum_93;
+    acc[94] += sum_94;
+    acc[95] += sum_95;
+    acc[96] += sum_96;
+    acc[97] += sum_97;
+    acc[98] += sum_98;
+    acc[99] += sum_99;
+    acc[100] += sum_100;
+    acc[101] += sum_101;
+    acc[102] += sum_102;
+    acc[103] += sum_103;
+    acc[104] += sum_104;
+    acc[105] += sum_105;
+    acc[106] += sum_106;
+    acc[107] += sum_107;
+    acc[108] += sum_108;
+    acc[109] += sum_109;
+    acc[110] += sum_110;
+    acc[111] += sum_111;
+    acc[112] += sum_112;
+    acc[113] += sum_113;
+    acc[114] += sum_114;
+    acc[115] += sum_115;
+    acc[116] += sum_116;
+    acc[117] += sum_117;
+    acc[118] += sum_118;
+    acc[119] += sum_119;
+    acc[120] += sum_120;
+    acc[121] += sum_121;
+    acc[122] += sum_122;
+    acc[123] += sum_123;
+    acc[124] += sum_124;
+    acc[125] += sum_125;
+    acc[126] += sum_126;
+    acc[127] += sum_127;
+    acc[128] += sum_128;
+    acc[129] += sum_129;
+    acc[130] += sum_130;
+    acc[131] += sum_131;
+    acc[132] += sum_132;
+    acc[133] += sum_133;
+    acc[134] += sum_134;
+    acc[135] += sum_135;
+    acc[136] += sum_136;
+    acc[137] += sum_137;
+    acc[138] += sum_138;
+    acc[139] += sum_139;
+    acc[140] += sum_140;
+    acc[141] += sum_141;
+    acc[142] += sum_142;
+    acc[143] += sum_143;
+    acc[144] += sum_144;
+    acc[145] += sum_145;
+    acc[146] += sum_146;
+    acc[147] += sum_147;
+    acc[148] += sum_148;
+    acc[149] += sum_149;
+    acc[150] += sum_150;
+    acc[151] += sum_151;
+    acc[152] += sum_152;
+    acc[153] += sum_153;
+    acc[154] += sum_154;
+    acc[155] += sum_155;
+    acc[156] += sum_156;
+    acc[157] += sum_157;
+    acc[158] += sum_158;
+    acc[159] += sum_159;
+    acc[160] += sum_160;
+    acc[161] += sum_161;
+    acc[162] += sum_162;
+    acc[163] += sum_163;
+    acc[164] += sum_164;
+    acc[165] += sum_165;
+    acc[166] += sum_166;
+    acc[167] += sum_167;
+    acc[168] += sum_168;
+    acc[169] += sum_169;
+    acc[170] += sum_170;
+    acc[171] += sum_171;
+    acc[172] += sum_172;
+    acc[173] += sum_173;
+    acc[174] += sum_174;
+    acc[175] += sum_175;
+    acc[176] += sum_176;
+    acc[177] += sum_177;
+    acc[178] += sum_178;
+    acc[179] += sum_179;
+    acc[180] += sum_180;
+    acc[181] += sum_181;
+    acc[182] += sum_182;
+    acc[183] += sum_183;
+    acc[184] += sum_184;
+    acc[185] += sum_185;
+    acc[186] += sum_186;
+    acc[187] += sum_187;
+    acc[188] += sum_188;
+    acc[189] += sum_189;
+    acc[190] += sum_190;
+    acc[191] += sum_191;
+    acc[192] += sum_192;
+    acc[193] += sum_193;
+    acc[194] += sum_194;
+    acc[195] += sum_195;
+    acc[196] += sum_196;
+    acc[197] += sum_197;
+    acc[198] += sum_198;
+    acc[199] += sum_199;
+    acc[200] += sum_200;
+    acc[201] += sum_201;
+    acc[202] += sum_202;
+    acc[203] += sum_203;
+    acc[204] += sum_204;
+    acc[205] += sum_205;
+    acc[206] += sum_206;
+    acc[207] += sum_207;
+    acc[208] += sum_208;
+    acc[209] += sum_209;
+    acc[210] += sum_210;
+    acc[211] += sum_211;
+    acc[212] += sum_212;
+    acc[213] += sum_213;
+    acc[214] += sum_214;
+    acc[215] += sum_215;
+    acc[216] += sum_216;
+    acc[217] += sum_217;
+    acc[218] += sum_218;
+    acc[219] += sum_219;
+    acc[220] += sum_220;
+    acc[221] += sum_221;
+    acc[222] += sum_222;
+    acc[223] += sum_223;
+    acc[224] += sum_224;
+}
+
+
+const psr_modules::integrals::detail::PotentialKernel potential_kernels[5][5] = 
+{
+    { potential_kernel_0_0, potential_kernel_0_1, potential_kernel_0_2, potential_kernel_0_3, potential_kernel_0_4 },
+    { potential_kernel_1_0, potential_kernel_1_1, potential_kernel_1_2, potential_kernel_1_3, potential_kernel_1_4 },
+    { potential_kernel_2_0, potential_kernel_2_1, potential_kernel_2_2, potential_kernel_2_3, potential_kernel_2_4 },
+    { potential_kernel_3_0, potential_kernel_3_1, potential_kernel_3_2, potential_kernel_3_3, potential_kernel_3_4 },
+    { potential_kernel_4_0, potential_kernel_4_1, potential_kernel_4_2, potential_kernel_4_3, potential_kernel_4_4 },
+};
+
+} // close anonymous namespace
+
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+PotentialKernel potential_kernel(int am1, int am2)
+{
+    if(am1 < 0 || am2 < 0 || am1 > PSR_MODULES_POTENTIAL_KERNEL_MAXAM || am2 > PSR_MODULES_POTENTIAL_KERNEL_MAXAM)
+        return nullptr;
+    return potential_kernels[am1][am2];
+}
+
+} // closing namespace detail
+} // closing namespace integrals
+} // closing namespace psr_modules
+
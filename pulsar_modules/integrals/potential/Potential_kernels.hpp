@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+#define PSR_MODULES_POTENTIAL_KERNEL_MAXAM 4
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+/* An unrolled kernel for the potential integrals of a (la, lb) class
+ *
+ * For a block of nb point charges, this forms (a|A(0)|b) for all cartesians
+ * of the class via the Obara-Saika recurrence, and adds the sum over
+ * the block (weighted by the charges q) to acc, stored as [cart_a*ncart_b + cart_b].
+ * The cartesians are in the same order as lut::am_recur_map.
+ *
+ * F holds the Boys function for orders [0, la+lb], stored as F[m*nb + lane],
+ * and PC0, PC1, PC2 are the x, y, and z components of P - C for each charge.
+ */
+typedef void (*PotentialKernel)(size_t nb, const double * F,
+                                const double * PC0, const double * PC1, const double * PC2,
+                                const double * q, const double PA[3], const double PB[3],
+                                const double oo2p, double * acc);
+
+/* Returns the kernel for a pair of angular momenta, or nullptr if there isn't one */
+PotentialKernel potential_kernel(int am1, int am2);
+
+} // closing namespace detail
+} // closing namespace integrals
+} // closing namespace psr_modules
+
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+
+#######################################
+# Generates unrolled kernels for the
+# Obara-Saika vertical recurrence of the
+# nuclear attraction (potential) integrals
+#
+# One kernel is generated for each pair of angular
+# momenta (la, lb) up to the maximum. Each kernel forms
+# all the (a|A(0)|b) integrals for a block of point charges
+# as straight-line code, with every recurrence term and
+# index resolved here rather than at run time.
+#
+# Only the intermediates actually needed for the target
+# class are generated. For each intermediate, the direction
+# of the recurrence is chosen to give the fewest terms.
+#######################################
+
+import argparse
+import sys
+
+
+# Cartesian exponents for an angular momentum, in
+# the same order as lut::am_recur_map
+def CartesianOrdering(l):
+    ret = []
+    for i in range(l, -1, -1):
+        for j in range(l-i, -1, -1):
+            ret.append((i, j, l-i-j))
+    return ret
+
+
+def Decrement(ijk, d, n = 1):
+    ret = list(ijk)
+    ret[d] -= n
+    return tuple(ret)
+
+
+class KernelWriter:
+    def __init__(self):
+        self.lines = []
+        self.done = {}
+        self.nboys = 0
+
+    @staticmethod
+    def Name(a, b, m):
+        return "v_{}{}{}_{}{}{}_{}".format(a[0], a[1], a[2], b[0], b[1], b[2], m)
+
+    # Returns the variable name of (a|b)^(m), generating
+    # it (and everything it depends on) if needed
+    def Get(self, a, b, m):
+        if min(a) < 0 or min(b) < 0:
+            return None
+
+        key = (a, b, m)
+        if key in self.done:
+            return self.done[key]
+
+        name = KernelWriter.Name(a, b, m)
+
+        if sum(a) == 0 and sum(b) == 0:
+            # the boys function
+            self.nboys = max(self.nboys, m+1)
+            self.lines.append("const double {} = F[{}*nb + l];".format(name, m))
+
+        elif sum(b) > 0:
+            # decrement b in the direction with the fewest terms
+            d = min(range(3), key = lambda x: (b[x] == 0, (a[x] > 0) + (b[x] > 1)))
+            b1 = Decrement(b, d)
+            b2 = Decrement(b, d, 2)
+            a1 = Decrement(a, d)
+
+            expr = "PB[{0}]*{1} - PC{0}[l]*{2}".format(d, self.Get(a, b1, m), self.Get(a, b1, m+1))
+            if a[d] > 0:
+                expr += " + {}*oo2p*({} - {})".format(a[d], self.Get(a1, b1, m), self.Get(a1, b1, m+1))
+            if b[d] > 1:
+                expr += " + {}*oo2p*({} - {})".format(b[d]-1, self.Get(a, b2, m), self.Get(a, b2, m+1))
+            self.lines.append("const double {} = {};".format(name, expr))
+
+        else:
+            # decrement a in the direction with the fewest terms
+            d = min(range(3), key = lambda x: (a[x] == 0, a[x] > 1))
+            a1 = Decrement(a, d)
+            a2 = Decrement(a, d, 2)
+
+            expr = "PA[{0}]*{1} - PC{0}[l]*{2}".format(d, self.Get(a1, b, m), self.Get(a1, b, m+1))
+            if a[d] > 1:
+                expr += " + {}*oo2p*({} - {})".format(a[d]-1, self.Get(a2, b, m), self.Get(a2, b, m+1))
+            self.lines.append("const double {} = {};".format(name, expr))
+
+        self.done[key] = name
+        return name
+
+
+def KernelName(la, lb):
+    return "potential_kernel_{}_{}".format(la, lb)
+
+
+def WriteKernel(f, la, lb):
+    writer = KernelWriter()
+    targets = []
+    for a in CartesianOrdering(la):
+        for b in CartesianOrdering(lb):
+            targets.append(writer.Get(a, b, 0))
+
+    f.write("void {}(size_t nb, const double * RESTRICT F,\n".format(KernelName(la, lb)))
+    f.write("        const double * RESTRICT PC0, const double * RESTRICT PC1, const double * RESTRICT PC2,\n")
+    f.write("        const double * RESTRICT q, const double PA[3], const double PB[3],\n")
+    f.write("        const double oo2p, double * RESTRICT acc)\n")
+    f.write("{\n")
+
+    # silence unused parameter warnings for the simple classes
+    f.write("    (void)PC0; (void)PC1; (void)PC2; (void)PA; (void)PB; (void)oo2p;\n\n")
+
+    for i in range(len(targets)):
+        f.write("    double sum_{} = 0.0;\n".format(i))
+
+    f.write("\n")
+    f.write("    for(size_t l = 0; l < nb; l++)\n")
+    f.write("    {\n")
+    for line in writer.lines:
+        f.write("        " + line + "\n")
+    f.write("\n")
+    for i,t in enumerate(targets):
+        f.write("        sum_{} += q[l]*{};\n".format(i, t))
+    f.write("    }\n\n")
+
+    for i in range(len(targets)):
+        f.write("    acc[{0}] += sum_{0};\n".format(i))
+    f.write("}\n\n\n")
+
+
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--filename", type=str, required=True, help="Output file name base (no extension)")
+parser.add_argument("--max-am",   type=int, required=True, help="Maximum angular momentum of each shell")
+args = parser.parse_args()
+
+maxam = args.max_am
+
+with open(args.filename + ".cpp", 'w') as f:
+  f.write("/*\n")
+  f.write(" Generated with:\n")
+  f.write("   " + " ".join(sys.argv[:]))
+  f.write("\n")
+  f.write("------------------------------------\n")
+  f.write("Unrolled Obara-Saika kernels for the\n")
+  f.write("potential integrals\n")
+  f.write("    Max AM: {}\n".format(maxam))
+  f.write("------------------------------------\n")
+  f.write("*/\n\n")
+
+  f.write("#include \"Integrals/potential/{}.hpp\"\n".format(args.filename.split("/")[-1]))
+  f.write("\n")
+  f.write("namespace {\n")
+  f.write("\n")
+
+  for la in range(0, maxam+1):
+    for lb in range(0, maxam+1):
+      WriteKernel(f, la, lb)
+
+  f.write("const psr_modules::integrals::detail::PotentialKernel potential_kernels[{0}][{0}] = \n".format(maxam+1))
+  f.write("{\n")
+  for la in range(0, maxam+1):
+    f.write("    { " + ", ".join([ KernelName(la, lb) for lb in range(0, maxam+1) ]) + " },\n")
+  f.write("};\n")
+  f.write("\n")
+  f.write("} // close anonymous namespace\n")
+  f.write("\n\n")
+
+  f.write("namespace psr_modules {\n")
+  f.write("namespace integrals {\n")
+  f.write("namespace detail {\n")
+  f.write("\n")
+  f.write("PotentialKernel potential_kernel(int am1, int am2)\n")
+  f.write("{\n")
+  f.write("    if(am1 < 0 || am2 < 0 || am1 > PSR_MODULES_POTENTIAL_KERNEL_MAXAM || am2 > PSR_MODULES_POTENTIAL_KERNEL_MAXAM)\n")
+  f.write("        return nullptr;\n")
+  f.write("    return potential_kernels[am1][am2];\n")
+  f.write("}\n")
+  f.write("\n")
+  f.write("} // closing namespace detail\n")
+  f.write("} // closing namespace integrals\n")
+  f.write("} // closing namespace psr_modules\n")
+  f.write("\n")
+
+
+with open(args.filename + ".hpp", 'w') as f:
+  f.write("#pragma once\n")
+  f.write("\n")
+  f.write("#include <cstddef>\n")
+  f.write("\n")
+  f.write("#define PSR_MODULES_POTENTIAL_KERNEL_MAXAM {}\n".format(maxam))
+  f.write("\n")
+  f.write("namespace psr_modules {\n")
+  f.write("namespace integrals {\n")
+  f.write("namespace detail {\n")
+  f.write("\n")
+  f.write("/* An unrolled kernel for the potential integrals of a (la, lb) class\n")
+  f.write(" *\n")
+  f.write(" * For a block of nb point charges, this forms (a|A(0)|b) for all cartesians\n")
+  f.write(" * of the class via the Obara-Saika recurrence, and adds the sum over\n")
+  f.write(" * the block (weighted by the charges q) to acc, stored as [cart_a*ncart_b + cart_b].\n")
+  f.write(" * The cartesians are in the same order as lut::am_recur_map.\n")
+  f.write(" *\n")
+  f.write(" * F holds the Boys function for orders [0, la+lb], stored as F[m*nb + lane],\n")
+  f.write(" * and PC0, PC1, PC2 are the x, y, and z components of P - C for each charge.\n")
+  f.write(" */\n")
+  f.write("typedef void (*PotentialKernel)(size_t nb, const double * F,\n")
+  f.write("                                const double * PC0, const double * PC1, const double * PC2,\n")
+  f.write("                                const double * q, const double PA[3], const double PB[3],\n")
+  f.write("                                const double oo2p, double * acc);\n")
+  f.write("\n")
+  f.write("/* Returns the kernel for a pair of angular momenta, or nullptr if there isn't one */\n")
+  f.write("PotentialKernel potential_kernel(int am1, int am2);\n")
+  f.write("\n")
+  f.write("} // closing namespace detail\n")
+  f.write("} // closing namespace integrals\n")
+  f.write("} // closing namespace psr_modules\n")
+  f.write("\n")
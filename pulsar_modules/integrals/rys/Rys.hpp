@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Integrals/rys/Rys_fit.hpp"
+
+#include <cmath>
+
+namespace psr_modules {
+namespace integrals {
+namespace detail {
+
+
+/*! \brief Calculate the roots and weights for Rys quadrature
+ *
+ * The roots \f$ u_i = t_i^2 \f$ and weights \f$ w_i \f$ satisfy
+ *
+ * \f[
+ *     F_m(x) = \sum_{i=1}^{n} w_i u_i^m
+ * \f]
+ *
+ * for \f$ m \in [0, 2n-1] \f$, where \f$ F_m \f$ is the Boys function.
+ *
+ * For small x, the roots and weights are obtained from a piecewise polynomial
+ * fit. For large x, they are obtained from the scaled (half-range) Gauss-Hermite
+ * roots and weights.
+ *
+ * \warning \p n must not be larger than PSR_MODULES_RYS_MAXROOTS
+ *
+ * \param [in] n Number of roots
+ * \param [in] x The value of x (as would be passed to the Boys function)
+ * \param [out] u Output buffer for the roots. Size must be n elements
+ * \param [out] w Output buffer for the weights. Size must be n elements
+ */
+inline void rys_roots(int n, double x, double * const RESTRICT u, double * const RESTRICT w)
+{
+    if(x < lut::rys_fit_xmax[n])
+    {
+        // index of the segment and distance from its center
+        const int seg = (int)(x*PSR_MODULES_RYS_LOOKUPFAC);
+        const double v = x - ((double)seg + 0.5)*PSR_MODULES_RYS_SPACE;
+        double const * RESTRICT c = lut::rys_fit + lut::rys_fit_offset[n]
+                                                 + (seg*n*2)*(PSR_MODULES_RYS_ORDER+1);
+
+        for(int i = 0; i < n; i++)
+        {
+            double r = c[PSR_MODULES_RYS_ORDER];
+            for(int k = PSR_MODULES_RYS_ORDER-1; k >= 0; k--)
+                r = r*v + c[k];
+            c += PSR_MODULES_RYS_ORDER+1;
+
+            double s = c[PSR_MODULES_RYS_ORDER];
+            for(int k = PSR_MODULES_RYS_ORDER-1; k >= 0; k--)
+                s = s*v + c[k];
+            c += PSR_MODULES_RYS_ORDER+1;
+
+            u[i] = r;
+            w[i] = s;
+        }
+    }
+    else
+    {
+        const double oox = 1.0/x;
+        const double oosqrtx = sqrt(oox);
+        const int start = (n*(n-1))/2;
+
+        for(int i = 0; i < n; i++)
+        {
+            u[i] = lut::rys_asym_root[start+i] * oox;
+            w[i] = lut::rys_asym_weight[start+i] * oosqrtx;
+        }
+    }
+}
+
+
+} // close namespace detail
+} // close namespace integrals
+} // close namespace psr_modules
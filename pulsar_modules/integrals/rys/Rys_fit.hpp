@@ -0,0 +1,39 @@
+#pragma once
+
+#define PSR_MODULES_RYS_MAXROOTS 9
+#define PSR_MODULES_RYS_SPACE 2.0
+#define PSR_MODULES_RYS_ORDER 13
+#define PSR_MODULES_RYS_LOOKUPFAC 0.5
+
+namespace psr_modules {
+namespace integrals {
+namespace lut {
+
+/*! Number of segments in the fit for each number of roots */
+extern const int rys_fit_nseg[PSR_MODULES_RYS_MAXROOTS+1];
+
+/*! Value of x past which the asymptotic form is used, for each number of roots */
+extern const double rys_fit_xmax[PSR_MODULES_RYS_MAXROOTS+1];
+
+/*! Start of the coefficients for each number of roots in rys_fit */
+extern const unsigned int rys_fit_offset[PSR_MODULES_RYS_MAXROOTS+1];
+
+/*! Piecewise polynomial fits of the Rys roots and weights
+ *
+ * For n roots, segment s covers [s*SPACE, (s+1)*SPACE). The coefficients
+ * for root i start at rys_fit_offset[n] + ((s*n + i)*2)*(ORDER+1), and are followed
+ * by the coefficients for weight i. They are in the power basis of
+ * u = x - (s+0.5)*SPACE, lowest power first.
+ */
+extern const double rys_fit[];
+
+/*! Asymptotic roots (x*root as x -> infinity). Roots for n start at n*(n-1)/2 */
+extern const double rys_asym_root[];
+
+/*! Asymptotic weights (sqrt(x)*weight as x -> infinity). Weights for n start at n*(n-1)/2 */
+extern const double rys_asym_weight[];
+
+} // closing namespace lut
+} // closing namespace integrals
+} // closing namespace psr_modules
+
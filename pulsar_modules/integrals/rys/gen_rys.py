@@ -0,0 +1,345 @@
+#!/usr/bin/env python3
+
+#######################################
+# Generates piecewise polynomial fits
+# of the roots and weights for Rys quadrature
+#
+# For a given x, the n roots u_i = t_i^2 and weights w_i
+# satisfy
+#
+#   Fm(x) = sum_i w_i u_i^m     (m = 0 ... 2n-1)
+#
+# where Fm is the Boys function. At each x, they are calculated
+# exactly (to the requested precision) by obtaining the recurrence
+# coefficients of the orthogonal polynomials from the moments Fm(x)
+# (Chebyshev algorithm, see Gautschi, "Orthogonal Polynomials:
+# Computation and Approximation", 2004) and then diagonalizing the
+# Jacobi matrix (Golub-Welsch).
+#
+# The range [0, xmax) is split into segments of equal width. On each
+# segment, each root and weight is interpolated at the Chebyshev nodes,
+# and the resulting polynomial is stored in the power basis of
+# u = x - (segment center), so that it can be evaluated with Horner's rule.
+#
+# For x >= xmax, the roots and weights are those of the (half-range)
+# Gauss-Hermite quadrature, scaled by 1/x and 1/sqrt(x), respectively.
+# xmax is chosen separately for each number of roots, so that this
+# asymptotic form is accurate to the requested tolerance.
+#######################################
+
+import argparse
+import sys
+from mpmath import mp # arbitrary-precision math
+
+
+# A slow but accurate way of calculating the boys function
+# via the incomplete gamma function
+def BoysValue(n, x):
+    if x == mp.mpf("0"):
+        return mp.mpf(1.0)/(mp.mpf(2.0*n+1))
+    else:
+        N = n+mp.mpf("0.5")
+        return mp.gammainc(N, 0, x) * 1.0/(2.0 * mp.power(x, N))
+
+
+# Roots and weights from the eigen decomposition of a Jacobi matrix
+def GolubWelsch(a, b, mu0):
+    n = len(a)
+    J = mp.zeros(n, n)
+    for i in range(n):
+        J[i,i] = a[i]
+        if i+1 < n:
+            J[i,i+1] = J[i+1,i] = mp.sqrt(b[i+1])
+    E,Q = mp.eigsy(J)
+    ret = [ (E[i], mu0*Q[0,i]**2) for i in range(n) ]
+    ret.sort()
+    return ret
+
+
+# Exact roots and weights for a given x
+def RysValue(n, x):
+    mom = [ BoysValue(k, x) for k in range(2*n) ]
+
+    # Chebyshev algorithm for the recurrence coefficients
+    a = [mp.mpf(0)]*n
+    b = [mp.mpf(0)]*n
+    sig_prev = [mp.mpf(0)]*(2*n)
+    sig = mom[:]
+    a[0] = mom[1]/mom[0]
+    b[0] = mom[0]
+
+    for k in range(1, n):
+        signew = [mp.mpf(0)]*(2*n)
+        for l in range(k, 2*n-k):
+            signew[l] = sig[l+1] - a[k-1]*sig[l] - b[k-1]*sig_prev[l]
+        a[k] = signew[k+1]/signew[k] - sig[k]/sig[k-1]
+        b[k] = signew[k]/sig[k-1]
+        sig_prev, sig = sig, signew
+
+    return GolubWelsch(a, b, mom[0])
+
+
+# Asymptotic roots and weights (ie, x * u_i and sqrt(x) * w_i as x -> infinity).
+# These are the squares of the positive roots of H_2n, and
+# the corresponding Gauss-Hermite weights
+def RysAsymptotic(n):
+    m = 2*n
+    a = [mp.mpf(0)]*m
+    b = [mp.sqrt(mp.pi)] + [ mp.mpf(k)/2 for k in range(1, m) ]
+    herm = GolubWelsch(a, b, mp.sqrt(mp.pi))
+    ret = [ (r**2, w) for r,w in herm if r > 0 ]
+    ret.sort()
+    return ret
+
+
+# Maximum relative error between the exact and asymptotic values
+def AsymptoticError(n, x, asym):
+    exact = RysValue(n, x)
+    err = mp.mpf(0)
+    for (ar,aw),(r,w) in zip(asym, exact):
+        err = max(err, abs(ar/x - r)/r, abs(aw/mp.sqrt(x) - w)/w)
+    return err
+
+
+# Coefficients of the Chebyshev polynomials T_j in the power basis
+def ChebyshevPowerCoefficients(order):
+    T = [ [mp.mpf(1)], [mp.mpf(0), mp.mpf(1)] ]
+    for j in range(2, order+1):
+        p = [mp.mpf(0)]*(j+1)
+        for i,v in enumerate(T[j-1]):
+            p[i+1] += 2*v
+        for i,v in enumerate(T[j-2]):
+            p[i] -= v
+        T.append(p)
+    return T[:order+1]
+
+
+# Fit all roots and weights on one segment [center-halfwidth, center+halfwidth]
+# Returns the coefficients in the power basis of u = x - center, as
+# a list (over roots) of pairs (root coefficients, weight coefficients)
+def FitSegment(n, center, halfwidth, order, T):
+    npts = order+1
+    nodes = [ mp.cos(mp.pi*(k+mp.mpf("0.5"))/npts) for k in range(npts) ]
+    vals = [ RysValue(n, center + halfwidth*t) for t in nodes ]
+
+    ret = []
+    for i in range(n):
+        pair = []
+        for comp in range(2):
+            cheb = []
+            for j in range(npts):
+                cheb.append(2*mp.fsum(vals[k][i][comp]*mp.cos(mp.pi*j*(k+mp.mpf("0.5"))/npts) for k in range(npts))/npts)
+            cheb[0] /= 2
+
+            # convert to power basis in t = u/halfwidth, then in u
+            power = [mp.mpf(0)]*npts
+            for j in range(npts):
+                for l,v in enumerate(T[j]):
+                    power[l] += cheb[j]*v
+
+            pair.append([ power[l]/mp.power(halfwidth, l) for l in range(npts) ])
+        ret.append(pair)
+    return ret
+
+
+def Horner(c, u):
+    val = mp.mpf(0)
+    for v in reversed(c):
+        val = val*u + v
+    return val
+
+
+
+# Note that types are being stored as a string. This is so mpmath
+# can parse it without turning it into a (possibly) lesser-precision float
+parser = argparse.ArgumentParser()
+parser.add_argument("--filename",  type=str, required=True,                 help="Output file name base (no extension)")
+parser.add_argument("--max-roots", type=int, required=True,                 help="Maximum number of roots")
+parser.add_argument("--spacing",   type=str, required=True,                 help="Width of each segment")
+parser.add_argument("--order",     type=int, required=True,                 help="Order of the polynomial on each segment")
+parser.add_argument("--asym-tol",  type=str, required=False, default="1e-15", help="Tolerance for switching to the asymptotic form")
+parser.add_argument("--dps",       type=int, required=False, default=50,    help="Decimal precision/sig figs to use/calculate")
+parser.add_argument("--ncheck",    type=int, required=False, default=8,     help="Number of points per segment to check the fit at")
+args = parser.parse_args()
+
+# Set the dps option
+mp.dps = args.dps
+
+# Convert stuff to mpmath
+inc = mp.mpf(args.spacing)
+tol = mp.mpf(args.asym_tol)
+maxroots = args.max_roots
+order = args.order
+T = ChebyshevPowerCoefficients(order)
+
+asym = {}
+nseg = {}
+coefs = {}
+worst = {}
+
+for n in range(1, maxroots+1):
+    asym[n] = RysAsymptotic(n)
+
+    # find where the asymptotic form is good enough
+    s = 1
+    while AsymptoticError(n, inc*s, asym[n]) > tol:
+        s += 1
+    nseg[n] = s
+
+    coefs[n] = []
+    worst[n] = mp.mpf(0)
+
+    for s in range(nseg[n]):
+        center = inc*s + inc/2
+        c = FitSegment(n, center, inc/2, order, T)
+        coefs[n].append(c)
+
+        # check the fit, using the coefficients as they will be stored (ie, as doubles)
+        for k in range(args.ncheck+1):
+            u = -inc/2 + inc*k/args.ncheck
+            ref = RysValue(n, center+u)
+            for i in range(n):
+                for comp in range(2):
+                    cd = [ mp.mpf(float(v)) for v in c[i][comp] ]
+                    val = Horner(cd, u)
+                    worst[n] = max(worst[n], abs((val-ref[i][comp])/ref[i][comp]))
+
+
+# offsets into the flattened arrays
+fit_offset = []
+asym_offset = []
+fo = 0
+ao = 0
+for n in range(1, maxroots+1):
+    fit_offset.append(fo)
+    asym_offset.append(ao)
+    fo += nseg[n]*n*2*(order+1)
+    ao += n
+nfit = fo
+nasym = ao
+
+
+# Output to file
+with open(args.filename + ".cpp", 'w') as f:
+  f.write("/*\n")
+  f.write(" Generated with:\n")
+  f.write("   " + " ".join(sys.argv[:]))
+  f.write("\n")
+  f.write("------------------------------------\n")
+  f.write("Options for piecewise fit of Rys roots and weights:\n")
+  f.write("  Max roots: {}\n".format(maxroots))
+  f.write("    Spacing: {}\n".format(inc))
+  f.write("      Order: {}\n".format(order))
+  f.write("  Asym. tol: {}\n".format(mp.nstr(tol, 4)))
+  f.write("        DPS: {}\n".format(args.dps))
+  for n in range(1, maxroots+1):
+    f.write("  n = {:3}: {:4} segments, max x = {:8}, max rel. error of fit: {}\n".format(n, nseg[n], mp.nstr(inc*nseg[n], 4), mp.nstr(worst[n], 4)))
+  f.write("------------------------------------\n")
+  f.write("*/\n\n")
+
+  f.write("namespace psr_modules {\n")
+  f.write("namespace integrals {\n")
+  f.write("namespace lut {\n")
+
+  f.write("\n")
+  f.write("extern const int rys_fit_nseg[{}] = \n".format(maxroots+1))
+  f.write("{\n")
+  f.write("/* n = {:4} */  {},\n".format(0, 0))
+  for n in range(1, maxroots+1):
+    f.write("/* n = {:4} */  {},\n".format(n, nseg[n]))
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("extern const double rys_fit_xmax[{}] = \n".format(maxroots+1))
+  f.write("{\n")
+  f.write("/* n = {:4} */  {},\n".format(0, "0.0"))
+  for n in range(1, maxroots+1):
+    f.write("/* n = {:4} */  {},\n".format(n, mp.nstr(inc*nseg[n], 18)))
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("extern const unsigned int rys_fit_offset[{}] = \n".format(maxroots+1))
+  f.write("{\n")
+  f.write("/* n = {:4} */  {},\n".format(0, 0))
+  for n in range(1, maxroots+1):
+    f.write("/* n = {:4} */  {},\n".format(n, fit_offset[n-1]))
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("extern const double rys_fit[{}] = \n".format(nfit))
+  f.write("{\n")
+  for n in range(1, maxroots+1):
+    for s,c in enumerate(coefs[n]):
+      for i in range(n):
+        for comp,name in enumerate(["root", "weight"]):
+          f.write("/* n = {:2}, x = {:8}, {:6} {:2} */  ".format(n, mp.nstr(inc*s, 4), name, i))
+          for v in c[i][comp]:
+            f.write("{:26}, ".format(mp.nstr(v, 18)))
+          f.write("\n")
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("extern const double rys_asym_root[{}] = \n".format(nasym))
+  f.write("{\n")
+  for n in range(1, maxroots+1):
+    for i,(r,w) in enumerate(asym[n]):
+      f.write("/* n = {:2}, i = {:2} */  {},\n".format(n, i, mp.nstr(r, 18)))
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("extern const double rys_asym_weight[{}] = \n".format(nasym))
+  f.write("{\n")
+  for n in range(1, maxroots+1):
+    for i,(r,w) in enumerate(asym[n]):
+      f.write("/* n = {:2}, i = {:2} */  {},\n".format(n, i, mp.nstr(w, 18)))
+  f.write("};\n")
+
+  f.write("\n")
+  f.write("} // closing namespace lut\n")
+  f.write("} // closing namespace integrals\n")
+  f.write("} // closing namespace psr_modules\n")
+  f.write("\n")
+
+with open(args.filename + ".hpp", 'w') as f:
+  f.write("#pragma once\n")
+  f.write("\n")
+  f.write("#define PSR_MODULES_RYS_MAXROOTS {}\n".format(maxroots))
+  f.write("#define PSR_MODULES_RYS_SPACE {}\n".format(inc))
+  f.write("#define PSR_MODULES_RYS_ORDER {}\n".format(order))
+  f.write("#define PSR_MODULES_RYS_LOOKUPFAC {}\n".format(1.0/inc))
+  f.write("\n")
+
+  f.write("namespace psr_modules {\n")
+  f.write("namespace integrals {\n")
+  f.write("namespace lut {\n")
+  f.write("\n")
+
+  f.write("/*! Number of segments in the fit for each number of roots */\n")
+  f.write("extern const int rys_fit_nseg[PSR_MODULES_RYS_MAXROOTS+1];\n")
+  f.write("\n")
+  f.write("/*! Value of x past which the asymptotic form is used, for each number of roots */\n")
+  f.write("extern const double rys_fit_xmax[PSR_MODULES_RYS_MAXROOTS+1];\n")
+  f.write("\n")
+  f.write("/*! Start of the coefficients for each number of roots in rys_fit */\n")
+  f.write("extern const unsigned int rys_fit_offset[PSR_MODULES_RYS_MAXROOTS+1];\n")
+  f.write("\n")
+  f.write("/*! Piecewise polynomial fits of the Rys roots and weights\n")
+  f.write(" *\n")
+  f.write(" * For n roots, segment s covers [s*SPACE, (s+1)*SPACE). The coefficients\n")
+  f.write(" * for root i start at rys_fit_offset[n] + ((s*n + i)*2)*(ORDER+1), and are followed\n")
+  f.write(" * by the coefficients for weight i. They are in the power basis of\n")
+  f.write(" * u = x - (s+0.5)*SPACE, lowest power first.\n")
+  f.write(" */\n")
+  f.write("extern const double rys_fit[];\n")
+  f.write("\n")
+  f.write("/*! Asymptotic roots (x*root as x -> infinity). Roots for n start at n*(n-1)/2 */\n")
+  f.write("extern const double rys_asym_root[];\n")
+  f.write("\n")
+  f.write("/*! Asymptotic weights (sqrt(x)*weight as x -> infinity). Weights for n start at n*(n-1)/2 */\n")
+  f.write("extern const double rys_asym_weight[];\n")
+
+  f.write("\n")
+  f.write("} // closing namespace lut\n")
+  f.write("} // closing namespace integrals\n")
+  f.write("} // closing namespace psr_modules\n")
+  f.write("\n")
@@ -0,0 +1,308 @@
+#include "Methods/SCF/DirectFockBuild.hpp"
+#include "pulsar_modules/common/ParallelCommon.hpp"
+
+#include <pulsar/modulebase/All.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using Eigen::MatrixXd;
+
+using namespace pulsar;
+
+namespace pulsarmethods {
+
+
+void DirectFockBuild::initialize_(unsigned int deriv, const Wavefunction & wfn,
+                                  const BasisSet & bs)
+{
+    if(!wfn.system)
+        throw PulsarException("System is not set!");
+
+    const size_t nthread = ResolveNThreads(options().get<size_t>("NTHREADS"));
+
+    ///////////////////////////////////////////
+    // ERI modules (one for each thread)
+    ///////////////////////////////////////////
+    eri_mods_ = MakeThreadModules(nthread, [&](void)
+    {
+        auto mod = create_child_from_option<TwoElectronIntegral>("KEY_AO_ERI");
+        mod->initialize(0, wfn, bs, bs, bs, bs);
+        return mod;
+    });
+
+    const size_t maxnfunc = bs.max_n_functions();
+    bufsize_ = maxnfunc*maxnfunc*maxnfunc*maxnfunc;
+
+
+    //////////////////////
+    // Shell information
+    //////////////////////
+    const size_t nshell = bs.n_shell();
+    shell_start_.resize(nshell);
+    shell_nfunc_.resize(nshell);
+    shellpairs_.clear();
+
+    size_t start = 0;
+    for(size_t i = 0; i < nshell; i++)
+    {
+        shell_start_[i] = start;
+        shell_nfunc_[i] = bs.shell(i).n_functions();
+        start += shell_nfunc_[i];
+
+        for(size_t j = 0; j <= i; j++)
+            shellpairs_.emplace_back(i, j);
+    }
+
+
+    ///////////////////
+    // Schwarz bounds
+    ///////////////////
+    schwarz_ = SchwarzBounds(*eri_mods_[0], bs);
+    max_schwarz_ = (nshell > 0) ? schwarz_.maxCoeff() : 0.0;
+
+
+    /////////////////////////////////////
+    // The one-electron integral cacher
+    /////////////////////////////////////
+    auto mod_ao_cache = create_child_from_option<OneElectronMatrix>("KEY_ONEEL_MAT");
+
+    ////////////////////////////
+    // One-electron hamiltonian
+    ///////////////////////
+    const std::string ao_build_key = options().get<std::string>("KEY_AO_COREBUILD");
+    auto Hcoreimpl = mod_ao_cache->calculate(ao_build_key, 0, wfn, bs, bs);
+    Hcore_ = convert_to_eigen(Hcoreimpl.at(0));  // .at(0) = first (and only) component
+
+    // Start from scratch
+    nincremental_ = 0;
+    prev_spins_.clear();
+    prev_D_.clear();
+    prev_J_.clear();
+    prev_K_.clear();
+}
+
+
+MatrixXd DirectFockBuild::shell_block_max_(const std::vector<const MatrixXd *> & D) const
+{
+    const size_t nshell = shell_start_.size();
+    MatrixXd Dmax = MatrixXd::Zero(nshell, nshell);
+
+    for(const MatrixXd * Dd : D)
+    for(size_t P = 0; P < nshell; P++)
+    for(size_t Q = 0; Q < nshell; Q++)
+    {
+        const double m = Dd->block(shell_start_[P], shell_start_[Q],
+                                   shell_nfunc_[P], shell_nfunc_[Q]).cwiseAbs().maxCoeff();
+        Dmax(P, Q) = std::max(Dmax(P, Q), m);
+    }
+
+    return Dmax;
+}
+
+
+JKMatrices DirectFockBuild::build_jk_(const std::vector<const MatrixXd *> & D,
+                                      size_t & ncalculated, size_t & nscreened)
+{
+    const size_t nao = Hcore_->rows();
+    const size_t npair = shellpairs_.size();
+    const double threshold = options().get<double>("SCREEN_THRESHOLD");
+
+    const MatrixXd Dmax = shell_block_max_(D);
+    const double max_density = (Dmax.size() > 0) ? Dmax.maxCoeff() : 0.0;
+
+    JKMatrices jk(D.size(), nao);
+
+    size_t ncalc = 0;
+    size_t nskip = 0;
+
+    ParallelErrors errors;
+
+    #pragma omp parallel num_threads(static_cast<int>(eri_mods_.size())) reduction(+:ncalc,nskip)
+    {
+        TwoElectronIntegral & mod = *eri_mods_[ThreadIndex()];
+        std::vector<double> eribuf(bufsize_);
+        JKMatrices myjk(D.size(), nao);
+
+        #pragma omp for schedule(dynamic)
+        for(size_t PQ = 0; PQ < npair; PQ++)
+        {
+            errors.Run([&](void)
+            {
+                const size_t P = shellpairs_[PQ].first;
+                const size_t Q = shellpairs_[PQ].second;
+                const double schwarz_pq = schwarz_(P, Q);
+
+                // Nothing in this bra can survive screening
+                if(schwarz_pq * max_schwarz_ * max_density < threshold)
+                {
+                    nskip += PQ + 1;
+                    return;
+                }
+
+                const size_t nf1 = shell_nfunc_[P];
+                const size_t nf2 = shell_nfunc_[Q];
+                const size_t start1 = shell_start_[P];
+                const size_t start2 = shell_start_[Q];
+
+                for(size_t RS = 0; RS <= PQ; RS++)
+                {
+                    // Nothing more to do once any thread has failed
+                    if(errors.Failed())
+                        return;
+
+                    const size_t R = shellpairs_[RS].first;
+                    const size_t S = shellpairs_[RS].second;
+
+                    // Largest density element that this quartet
+                    // contributes to J or K with
+                    const double dmax = std::max({Dmax(P, Q), Dmax(R, S),
+                                                  Dmax(P, R), Dmax(P, S),
+                                                  Dmax(Q, R), Dmax(Q, S)});
+
+                    if(schwarz_pq * schwarz_(R, S) * dmax < threshold)
+                    {
+                        nskip++;
+                        continue;
+                    }
+
+                    const size_t nf3 = shell_nfunc_[R];
+                    const size_t nf4 = shell_nfunc_[S];
+                    const size_t start3 = shell_start_[R];
+                    const size_t start4 = shell_start_[S];
+
+                    const uint64_t n = mod.calculate(P, Q, R, S, eribuf.data(), bufsize_);
+                    if(n != nf1*nf2*nf3*nf4)
+                        throw PulsarException("Bad number of integrals returned",
+                                              "ncalc", n, "expected", nf1*nf2*nf3*nf4);
+                    ncalc++;
+
+                    // Within diagonal shell pairs and quartets, only
+                    // the unique function quartets are used
+                    const double * eri = eribuf.data();
+                    for(size_t f1 = 0; f1 < nf1; f1++)
+                    for(size_t f2 = 0; f2 < nf2; f2++)
+                    for(size_t f3 = 0; f3 < nf3; f3++)
+                    for(size_t f4 = 0; f4 < nf4; f4++, eri++)
+                    {
+                        const size_t i = start1 + f1;
+                        const size_t j = start2 + f2;
+                        const size_t k = start3 + f3;
+                        const size_t l = start4 + f4;
+
+                        if(j > i || l > k)
+                            continue;
+                        if(RS == PQ && (k*(k+1))/2 + l > (i*(i+1))/2 + j)
+                            continue;
+
+                        const double value = (*eri) * UniqueERIDegeneracy(i, j, k, l);
+                        AddUniqueERI(i, j, k, l, value, D, myjk);
+                    }
+                }
+            });
+        }
+
+        #pragma omp critical
+        jk.Add(myjk);
+    }
+
+    errors.Rethrow();
+
+    jk.Finalize();
+
+    ncalculated += ncalc;
+    nscreened += nskip;
+    return jk;
+}
+
+
+IrrepSpinMatrixD DirectFockBuild::calculate_(const Wavefunction & wfn)
+{
+    if(!wfn.opdm)
+        throw PulsarException("Missing OPDM");
+
+    const size_t nao = Hcore_->rows();
+    const size_t rebuild = static_cast<size_t>(options().get<int>("FULL_REBUILD"));
+
+    // Rebuild everything from the full density this time?
+    const bool full = (nincremental_ >= rebuild);
+    bool anyfull = full;
+
+    size_t ncalculated = 0;
+    size_t nscreened = 0;
+
+    // the fock matrix we are returning
+    IrrepSpinMatrixD Fmat;
+
+    for(auto ir : wfn.opdm->get_irreps())
+    {
+        const auto & spinset = wfn.opdm->get_spins(ir);
+        const std::vector<int> spins(spinset.begin(), spinset.end());
+
+        std::vector<MatrixXd> Dcur;
+        for(int s : spins)
+            Dcur.push_back(*convert_to_eigen(wfn.opdm->get(ir, s)));
+
+        for(const auto & Dd : Dcur)
+        {
+            if(static_cast<size_t>(Dd.rows()) != nao || static_cast<size_t>(Dd.cols()) != nao)
+                throw PulsarException("Density matrix has the wrong dimensions",
+                                      "rows", Dd.rows(), "cols", Dd.cols(), "nao", nao);
+        }
+
+        // Can only do an incremental build if we have
+        // the same structure as last time
+        const bool irfull = full || !prev_spins_.count(ir) || prev_spins_.at(ir) != spins;
+
+        // Densities that J and K are built from
+        std::vector<MatrixXd> Dbuild;
+        if(irfull)
+            Dbuild = Dcur;
+        else
+        {
+            const auto & Dprev = prev_D_.at(ir);
+            for(size_t s = 0; s < spins.size(); s++)
+                Dbuild.push_back(Dcur[s] - Dprev[s]);
+        }
+
+        std::vector<const MatrixXd *> D;
+        for(const auto & Dd : Dbuild)
+            D.push_back(&Dd);
+
+        JKMatrices jk = build_jk_(D, ncalculated, nscreened);
+
+        if(!irfull)
+        {
+            // J and K are linear in the density
+            const auto & Jprev = prev_J_.at(ir);
+            const auto & Kprev = prev_K_.at(ir);
+            for(size_t s = 0; s < spins.size(); s++)
+            {
+                jk.J[s] += Jprev[s];
+                jk.K[s] += Kprev[s];
+            }
+        }
+        else
+            anyfull = true;
+
+        FormFockFromJK(*Hcore_, ir, spins, jk, Fmat);
+
+        prev_spins_[ir] = spins;
+        prev_D_[ir] = std::move(Dcur);
+        prev_J_[ir] = std::move(jk.J);
+        prev_K_[ir] = std::move(jk.K);
+    }
+
+    if(anyfull)
+        nincremental_ = 0;
+    else
+        nincremental_++;
+
+    out.output("Direct Fock build (%?): calculated %? shell quartets, screened %?\n",
+               anyfull ? "full" : "incremental", ncalculated, nscreened);
+
+    return Fmat;
+}
+
+
+} // close namespace pulsarmethods
@@ -0,0 +1,70 @@
+#ifndef PULSAR_GUARD_SCF__DIRECTFOCKBUILD_HPP_
+#define PULSAR_GUARD_SCF__DIRECTFOCKBUILD_HPP_
+
+#include "Methods/SCF/JKCommon.hpp"
+
+#include <pulsar/modulebase/FockBuilder.hpp>
+
+#include <map>
+#include <utility>
+#include <vector>
+#include <Eigen/Dense>
+
+namespace pulsarmethods {
+
+/*! \brief Direct Fock builder
+ *
+ * The ERI are not stored. Instead, the unique shell quartets are
+ * recalculated on every call, skipping those whose Schwarz bound
+ * multiplied by the largest relevant density element is below
+ * SCREEN_THRESHOLD.
+ *
+ * J and K from the previous call are kept, and only the contribution
+ * from the change in the density is built. Since this change becomes small
+ * as the SCF converges, more quartets are screened out. To keep the
+ * accumulated error in check, J and K are rebuilt from the full density
+ * every FULL_REBUILD calls.
+ */
+class DirectFockBuild : public pulsar::FockBuilder
+{
+    public:
+        DirectFockBuild(ID_t id) :  pulsar::FockBuilder(id) { }
+
+        virtual void initialize_(unsigned int deriv,
+                                 const pulsar::Wavefunction & wfn,
+                                 const pulsar::BasisSet & bs);
+
+        virtual pulsar::IrrepSpinMatrixD calculate_(const pulsar::Wavefunction & wfn);
+
+
+    private:
+        // One ERI module for each thread
+        std::vector<pulsar::ModulePtr<pulsar::TwoElectronIntegral>> eri_mods_;
+        size_t bufsize_;
+
+        // Shell information
+        std::vector<size_t> shell_start_;
+        std::vector<size_t> shell_nfunc_;
+        std::vector<std::pair<size_t, size_t>> shellpairs_;  //!< Canonical shell pairs, in order
+
+        Eigen::MatrixXd schwarz_;  //!< sqrt(max |(PQ|PQ)|) for each shell pair
+        double max_schwarz_;
+
+        std::shared_ptr<const Eigen::MatrixXd> Hcore_;
+
+        // From the previous call, for each irrep
+        size_t nincremental_ = 0;
+        std::map<pulsar::Irrep, std::vector<int>> prev_spins_;
+        std::map<pulsar::Irrep, std::vector<Eigen::MatrixXd>> prev_D_, prev_J_, prev_K_;
+
+        //! Largest absolute element of each shell block, over all densities
+        Eigen::MatrixXd shell_block_max_(const std::vector<const Eigen::MatrixXd *> & D) const;
+
+        //! Build (finalized) J and K from the given densities, with screening
+        JKMatrices build_jk_(const std::vector<const Eigen::MatrixXd *> & D,
+                             size_t & ncalculated, size_t & nscreened);
+};
+
+}
+
+#endif
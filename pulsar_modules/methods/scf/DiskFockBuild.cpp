@@ -0,0 +1,385 @@
+#include "Methods/SCF/DiskFockBuild.hpp"
+#include "pulsar_modules/common/ParallelCommon.hpp"
+
+#include <pulsar/modulebase/All.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <limits>
+
+#include <unistd.h>
+
+using Eigen::MatrixXd;
+
+using namespace pulsar;
+
+
+// A file name that is unique to this process and module instance
+static std::string ScratchFileName_(const std::string & dir)
+{
+    static std::atomic<unsigned int> counter(0);
+    return dir + "/psr_eri_" + std::to_string(getpid()) + "_"
+               + std::to_string(counter++) + ".dat";
+}
+
+
+namespace pulsarmethods {
+
+
+// Split a block into the integrals whose value fits in a PackedERI
+// (in units of quantum) and those that have to be stored in full
+static void PackBlock_(const std::vector<StoredERI> & block, double quantum,
+                       std::vector<PackedERI> & packed, std::vector<StoredERI> & full)
+{
+    packed.clear();
+    full.clear();
+
+    const double maxq = static_cast<double>(std::numeric_limits<int32_t>::max());
+
+    for(const auto & eri : block)
+    {
+        const double q = (quantum > 0.0) ? std::round(eri.value / quantum) : 0.0;
+
+        if(quantum > 0.0 && std::fabs(q) <= maxq)
+            packed.push_back(PackedERI{static_cast<int32_t>(q), eri.i, eri.j, eri.k, eri.l});
+        else
+            full.push_back(eri);
+    }
+}
+
+
+// Write one block: the number of each kind of integral, then the integrals
+static void WriteBlock_(std::ofstream & file, const std::vector<PackedERI> & packed,
+                        const std::vector<StoredERI> & full)
+{
+    const uint64_t n[2] = { packed.size(), full.size() };
+    file.write(reinterpret_cast<const char *>(n), sizeof(n));
+    file.write(reinterpret_cast<const char *>(packed.data()),
+               static_cast<std::streamsize>(n[0]*sizeof(PackedERI)));
+    file.write(reinterpret_cast<const char *>(full.data()),
+               static_cast<std::streamsize>(n[1]*sizeof(StoredERI)));
+}
+
+
+DiskFockBuild::~DiskFockBuild()
+{
+    if(!path_.empty())
+        std::remove(path_.c_str());
+}
+
+
+void DiskFockBuild::initialize_(unsigned int deriv, const Wavefunction & wfn,
+                                const BasisSet & bs)
+{
+    if(!wfn.system)
+        throw PulsarException("System is not set!");
+
+    nthread_ = ResolveNThreads(options().get<size_t>("NTHREADS"));
+
+    blocksize_ = options().get<size_t>("BLOCK_SIZE");
+    if(blocksize_ == 0)
+        throw PulsarException("BLOCK_SIZE must be greater than zero");
+
+    // indices are stored in 16 bits
+    if(bs.n_functions() > std::numeric_limits<uint16_t>::max())
+        throw PulsarException("Too many basis functions for the ERI stored on disk",
+                              "nao", bs.n_functions());
+
+    // Start with a new file
+    if(!path_.empty())
+        std::remove(path_.c_str());
+    path_ = ScratchFileName_(options().get<std::string>("SCRATCH_DIR"));
+
+    write_eri_(wfn, bs);
+
+
+    /////////////////////////////////////
+    // The one-electron integral cacher
+    /////////////////////////////////////
+    auto mod_ao_cache = create_child_from_option<OneElectronMatrix>("KEY_ONEEL_MAT");
+
+    ////////////////////////////
+    // One-electron hamiltonian
+    ///////////////////////
+    const std::string ao_build_key = options().get<std::string>("KEY_AO_COREBUILD");
+    auto Hcoreimpl = mod_ao_cache->calculate(ao_build_key, 0, wfn, bs, bs);
+    Hcore_ = convert_to_eigen(Hcoreimpl.at(0));  // .at(0) = first (and only) component
+}
+
+
+void DiskFockBuild::write_eri_(const Wavefunction & wfn, const BasisSet & bs)
+{
+    const double threshold = options().get<double>("STORE_THRESHOLD");
+
+    // One ERI module for each thread
+    auto eri_mods = MakeThreadModules(nthread_, [&](void)
+    {
+        auto mod = create_child_from_option<TwoElectronIntegral>("KEY_AO_ERI");
+        mod->initialize(0, wfn, bs, bs, bs, bs);
+        return mod;
+    });
+
+    const MatrixXd schwarz = SchwarzBounds(*eri_mods[0], bs);
+
+    const size_t nshell = bs.n_shell();
+    const size_t maxnfunc = bs.max_n_functions();
+    const size_t bufsize = maxnfunc*maxnfunc*maxnfunc*maxnfunc;
+
+    std::vector<size_t> shell_start(nshell);
+    std::vector<std::pair<size_t, size_t>> shellpairs;
+    for(size_t P = 0, start = 0; P < nshell; P++)
+    {
+        shell_start[P] = start;
+        start += bs.shell(P).n_functions();
+
+        for(size_t Q = 0; Q <= P; Q++)
+            shellpairs.emplace_back(P, Q);
+    }
+
+    std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+    if(!file)
+        throw PulsarException("Unable to open file for the ERI", "path", path_);
+
+    nblocks_ = 0;
+    quantum_ = threshold;
+    size_t nstored = 0;
+    size_t npacked = 0;
+
+    // What is left over from each thread, so that
+    // only the last block is partly filled
+    std::vector<StoredERI> tail;
+    tail.reserve(blocksize_);
+
+    ParallelErrors errors;
+
+    #pragma omp parallel num_threads(static_cast<int>(nthread_)) reduction(+:nstored,npacked)
+    {
+        TwoElectronIntegral & mod = *eri_mods[ThreadIndex()];
+        std::vector<double> eribuf(bufsize);
+        std::vector<StoredERI> block;
+        block.reserve(blocksize_);
+
+        std::vector<PackedERI> packed;
+        std::vector<StoredERI> full;
+        packed.reserve(blocksize_);
+        full.reserve(blocksize_);
+
+        auto write_block = [&](std::vector<StoredERI> & b)
+        {
+            PackBlock_(b, quantum_, packed, full);
+
+            #pragma omp critical(DiskFockBuild_write)
+            {
+                WriteBlock_(file, packed, full);
+                nblocks_++;
+            }
+
+            nstored += b.size();
+            npacked += packed.size();
+            b.clear();
+        };
+
+        #pragma omp for schedule(dynamic)
+        for(size_t PQ = 0; PQ < shellpairs.size(); PQ++)
+        {
+            errors.Run([&](void)
+            {
+                const size_t P = shellpairs[PQ].first;
+                const size_t Q = shellpairs[PQ].second;
+                const size_t nf1 = bs.shell(P).n_functions();
+                const size_t nf2 = bs.shell(Q).n_functions();
+
+                for(size_t RS = 0; RS <= PQ; RS++)
+                {
+                    // Nothing more to do once any thread has failed
+                    if(errors.Failed())
+                        return;
+
+                    const size_t R = shellpairs[RS].first;
+                    const size_t S = shellpairs[RS].second;
+
+                    if(schwarz(P, Q) * schwarz(R, S) < threshold)
+                        continue;
+
+                    const size_t nf3 = bs.shell(R).n_functions();
+                    const size_t nf4 = bs.shell(S).n_functions();
+
+                    const uint64_t n = mod.calculate(P, Q, R, S, eribuf.data(), bufsize);
+                    if(n != nf1*nf2*nf3*nf4)
+                        throw PulsarException("Bad number of integrals returned",
+                                              "ncalc", n, "expected", nf1*nf2*nf3*nf4);
+
+                    // Within diagonal shell pairs and quartets, only
+                    // the unique function quartets are stored
+                    const double * eri = eribuf.data();
+                    for(size_t f1 = 0; f1 < nf1; f1++)
+                    for(size_t f2 = 0; f2 < nf2; f2++)
+                    for(size_t f3 = 0; f3 < nf3; f3++)
+                    for(size_t f4 = 0; f4 < nf4; f4++, eri++)
+                    {
+                        const size_t i = shell_start[P] + f1;
+                        const size_t j = shell_start[Q] + f2;
+                        const size_t k = shell_start[R] + f3;
+                        const size_t l = shell_start[S] + f4;
+
+                        if(j > i || l > k)
+                            continue;
+                        if(RS == PQ && (k*(k+1))/2 + l > (i*(i+1))/2 + j)
+                            continue;
+                        if(std::fabs(*eri) < threshold)
+                            continue;
+
+                        block.push_back(StoredERI{(*eri) * UniqueERIDegeneracy(i, j, k, l),
+                                                  static_cast<uint16_t>(i), static_cast<uint16_t>(j),
+                                                  static_cast<uint16_t>(k), static_cast<uint16_t>(l)});
+
+                        if(block.size() == blocksize_)
+                            write_block(block);
+                    }
+                }
+            });
+        }
+
+        #pragma omp critical(DiskFockBuild_tail)
+        {
+            for(const auto & eri : block)
+            {
+                tail.push_back(eri);
+                if(tail.size() == blocksize_)
+                    write_block(tail);
+            }
+        }
+
+        #pragma omp barrier
+
+        #pragma omp single
+        {
+            if(tail.size())
+                write_block(tail);
+        }
+    }
+
+    errors.Rethrow();
+
+    file.close();
+    if(!file)
+        throw PulsarException("Error writing the ERI to disk", "path", path_);
+
+    const double mb = static_cast<double>(nblocks_*2*sizeof(uint64_t)
+                                        + npacked*sizeof(PackedERI)
+                                        + (nstored-npacked)*sizeof(StoredERI))
+                    / (1024.0*1024.0);
+    out.output("Stored %? integrals (%? packed) in %? blocks (%? MB) in %?\n",
+               nstored, npacked, nblocks_, mb, path_);
+}
+
+
+JKMatrices DiskFockBuild::build_jk_(const std::vector<const MatrixXd *> & D) const
+{
+    const size_t nao = Hcore_->rows();
+
+    std::ifstream file(path_, std::ios::binary);
+    if(!file)
+        throw PulsarException("Unable to open file with the ERI", "path", path_);
+
+    // Double buffering. One block is read while the
+    // other one is being contracted
+    std::vector<StoredERI> buffers[2];
+    buffers[0].resize(blocksize_);
+    buffers[1].resize(blocksize_);
+
+    // Only one block is read at a time, so this can be shared
+    std::vector<PackedERI> packed(blocksize_);
+
+    // The packed integrals are unpacked to the start of the
+    // buffer, and the full ones are read in after them
+    auto read_block = [&](int b) -> uint64_t
+    {
+        uint64_t n[2] = { 0, 0 };
+        file.read(reinterpret_cast<char *>(n), sizeof(n));
+        if(!file || n[0] > blocksize_ || n[1] > blocksize_ - n[0])
+            throw PulsarException("Error reading the ERI from disk", "path", path_);
+
+        StoredERI * eri = buffers[b].data();
+
+        file.read(reinterpret_cast<char *>(packed.data()),
+                  static_cast<std::streamsize>(n[0]*sizeof(PackedERI)));
+        file.read(reinterpret_cast<char *>(eri + n[0]),
+                  static_cast<std::streamsize>(n[1]*sizeof(StoredERI)));
+        if(!file)
+            throw PulsarException("Error reading the ERI from disk", "path", path_);
+
+        for(uint64_t x = 0; x < n[0]; x++)
+            eri[x] = StoredERI{packed[x].value * quantum_,
+                               packed[x].i, packed[x].j, packed[x].k, packed[x].l};
+
+        return n[0] + n[1];
+    };
+
+    std::vector<JKMatrices> threadjk(nthread_, JKMatrices(D.size(), nao));
+
+    std::future<uint64_t> next;
+    if(nblocks_ > 0)
+        next = std::async(std::launch::async, read_block, 0);
+
+    for(size_t b = 0; b < nblocks_; b++)
+    {
+        const int cur = static_cast<int>(b % 2);
+        const uint64_t n = next.get(); // rethrows any error from reading
+
+        if(b + 1 < nblocks_)
+            next = std::async(std::launch::async, read_block, 1 - cur);
+
+        const StoredERI * eri = buffers[cur].data();
+
+        #pragma omp parallel num_threads(static_cast<int>(nthread_))
+        {
+            JKMatrices & myjk = threadjk[ThreadIndex()];
+
+            #pragma omp for schedule(static)
+            for(uint64_t x = 0; x < n; x++)
+                AddUniqueERI(eri[x].i, eri[x].j, eri[x].k, eri[x].l, eri[x].value, D, myjk);
+        }
+    }
+
+    JKMatrices jk(D.size(), nao);
+    for(const auto & tjk : threadjk)
+        jk.Add(tjk);
+    jk.Finalize();
+    return jk;
+}
+
+
+IrrepSpinMatrixD DiskFockBuild::calculate_(const Wavefunction & wfn)
+{
+    if(!wfn.opdm)
+        throw PulsarException("Missing OPDM");
+
+    // the fock matrix we are returning
+    IrrepSpinMatrixD Fmat;
+
+    for(auto ir : wfn.opdm->get_irreps())
+    {
+        const auto & spinset = wfn.opdm->get_spins(ir);
+        const std::vector<int> spins(spinset.begin(), spinset.end());
+
+        std::vector<std::shared_ptr<const MatrixXd>> Dptrs;
+        std::vector<const MatrixXd *> D;
+        for(int s : spins)
+        {
+            Dptrs.push_back(convert_to_eigen(wfn.opdm->get(ir, s)));
+            D.push_back(Dptrs.back().get());
+        }
+
+        const JKMatrices jk = build_jk_(D);
+        FormFockFromJK(*Hcore_, ir, spins, jk, Fmat);
+    }
+
+    return Fmat;
+}
+
+
+} // close namespace pulsarmethods
@@ -0,0 +1,89 @@
+#ifndef PULSAR_GUARD_SCF__DISKFOCKBUILD_HPP_
+#define PULSAR_GUARD_SCF__DISKFOCKBUILD_HPP_
+
+#include "Methods/SCF/JKCommon.hpp"
+
+#include <pulsar/modulebase/FockBuilder.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <Eigen/Dense>
+
+namespace pulsarmethods {
+
+
+/*! \brief A permutationally-unique ERI, as stored on disk
+ *
+ * The value already includes the degeneracy (see UniqueERIDegeneracy),
+ * and the indices are packed into 16 bits each.
+ */
+struct StoredERI
+{
+    double value;
+    uint16_t i, j, k, l;
+};
+
+
+/*! \brief A StoredERI with the value packed into an integer
+ *
+ * The value is stored as a multiple of STORE_THRESHOLD,
+ * so it is within half of the threshold of the actual value.
+ */
+struct PackedERI
+{
+    int32_t value;
+    uint16_t i, j, k, l;
+};
+
+
+/*! \brief Fock builder using ERI stored on disk
+ *
+ * On initialization, the unique integrals that survive Schwarz screening
+ * and are larger than STORE_THRESHOLD are written to a file in
+ * SCRATCH_DIR. The file is made of blocks of BLOCK_SIZE integrals
+ * (only the last block may have fewer). Each block starts with the
+ * number of PackedERI and of StoredERI it contains, followed by
+ * those integrals. Integrals that fit are stored as a PackedERI
+ * (12 bytes), and the rest as a StoredERI (16 bytes). If
+ * STORE_THRESHOLD is zero, all integrals are stored as StoredERI.
+ *
+ * Each call streams the blocks back in. The next block is read and
+ * unpacked in the background while the current one is being contracted
+ * (split between threads, each with its own J and K).
+ *
+ * The file is removed when the module is destroyed.
+ */
+class DiskFockBuild : public pulsar::FockBuilder
+{
+    public:
+        DiskFockBuild(ID_t id) :  pulsar::FockBuilder(id) { }
+
+        ~DiskFockBuild();
+
+        virtual void initialize_(unsigned int deriv,
+                                 const pulsar::Wavefunction & wfn,
+                                 const pulsar::BasisSet & bs);
+
+        virtual pulsar::IrrepSpinMatrixD calculate_(const pulsar::Wavefunction & wfn);
+
+
+    private:
+        size_t nthread_;
+        std::string path_;     //!< Path to the file with the integrals
+        size_t blocksize_;     //!< Number of integrals in each block
+        size_t nblocks_;       //!< Number of blocks in the file
+        double quantum_;       //!< Value of one unit of PackedERI::value (zero if unused)
+
+        std::shared_ptr<const Eigen::MatrixXd> Hcore_;
+
+        //! Calculate the integrals and write them to disk
+        void write_eri_(const pulsar::Wavefunction & wfn, const pulsar::BasisSet & bs);
+
+        //! Build (finalized) J and K by streaming the integrals from disk
+        JKMatrices build_jk_(const std::vector<const Eigen::MatrixXd *> & D) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,104 @@
+#include "Methods/SCF/JKCommon.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using Eigen::MatrixXd;
+
+using namespace pulsar;
+
+namespace pulsarmethods {
+
+
+JKMatrices::JKMatrices(size_t ndens, size_t nao)
+    : J(ndens, MatrixXd::Zero(nao, nao)),
+      K(ndens, MatrixXd::Zero(nao, nao))
+{ }
+
+
+void JKMatrices::Add(const JKMatrices & rhs)
+{
+    for(size_t d = 0; d < J.size(); d++)
+    {
+        J[d] += rhs.J[d];
+        K[d] += rhs.K[d];
+    }
+}
+
+
+void JKMatrices::Finalize(void)
+{
+    // Each of the eight permutations of a unique integral was
+    // added to only one triangle, with the full degeneracy
+    for(size_t d = 0; d < J.size(); d++)
+    {
+        MatrixXd Jsym = 0.25 * (J[d] + J[d].transpose());
+        MatrixXd Ksym = 0.125 * (K[d] + K[d].transpose());
+        J[d] = std::move(Jsym);
+        K[d] = std::move(Ksym);
+    }
+}
+
+
+MatrixXd SchwarzBounds(TwoElectronIntegral & mod, const BasisSet & bs)
+{
+    const size_t nshell = bs.n_shell();
+    const size_t maxnfunc = bs.max_n_functions();
+    const size_t bufsize = maxnfunc*maxnfunc*maxnfunc*maxnfunc;
+
+    MatrixXd schwarz = MatrixXd::Zero(nshell, nshell);
+    std::vector<double> eribuf(bufsize);
+
+    for(size_t P = 0; P < nshell; P++)
+    for(size_t Q = 0; Q <= P; Q++)
+    {
+        const size_t nf1 = bs.shell(P).n_functions();
+        const size_t nf2 = bs.shell(Q).n_functions();
+
+        uint64_t ncalc = mod.calculate(P, Q, P, Q, eribuf.data(), bufsize);
+        if(ncalc != nf1*nf2*nf1*nf2)
+            throw PulsarException("Bad number of integrals returned",
+                                  "ncalc", ncalc, "expected", nf1*nf2*nf1*nf2);
+
+        // diagonal elements (pq|pq)
+        double maxval = 0.0;
+        for(size_t f1 = 0; f1 < nf1; f1++)
+        for(size_t f2 = 0; f2 < nf2; f2++)
+        {
+            const size_t idx = ((f1*nf2 + f2)*nf1 + f1)*nf2 + f2;
+            maxval = std::max(maxval, std::fabs(eribuf[idx]));
+        }
+
+        schwarz(P, Q) = schwarz(Q, P) = std::sqrt(maxval);
+    }
+
+    return schwarz;
+}
+
+
+void FormFockFromJK(const MatrixXd & Hcore,
+                    Irrep ir, const std::vector<int> & spins,
+                    const JKMatrices & jk, IrrepSpinMatrixD & Fmat)
+{
+    if(spins == std::vector<int>{0})
+    {
+        // Restricted
+        MatrixXd F = Hcore + jk.J[0] - 0.5*jk.K[0];
+        Fmat.set(ir, 0, std::make_shared<EigenMatrixImpl>(std::move(F)));
+        return;
+    }
+
+    // Unrestricted. Coulomb is from the total density
+    MatrixXd Jtot = MatrixXd::Zero(Hcore.rows(), Hcore.cols());
+    for(const auto & J : jk.J)
+        Jtot += J;
+
+    for(size_t s = 0; s < spins.size(); s++)
+    {
+        MatrixXd F = Hcore + Jtot - jk.K[s];
+        Fmat.set(ir, spins[s], std::make_shared<EigenMatrixImpl>(std::move(F)));
+    }
+}
+
+
+} // close namespace pulsarmethods
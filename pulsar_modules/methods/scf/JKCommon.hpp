@@ -0,0 +1,103 @@
+#ifndef PULSAR_GUARD_SCF__JKCOMMON_HPP_
+#define PULSAR_GUARD_SCF__JKCOMMON_HPP_
+
+#include "Methods/SCF/SCFCommon.hpp"
+
+#include <vector>
+#include <Eigen/Dense>
+
+namespace pulsarmethods {
+
+
+/*! \brief Accumulated Coulomb and exchange matrices for a set of densities
+ *
+ * During accumulation, J and K are not symmetric and are missing
+ * some factors (see AddUniqueERI). Finalize() turns them into
+ *
+ *   J_mn = sum_ls (mn|ls) D_ls
+ *   K_mn = sum_ls (ml|ns) D_ls
+ *
+ * Each thread accumulates into its own JKMatrices, which are then
+ * combined with Add().
+ */
+struct JKMatrices
+{
+    std::vector<Eigen::MatrixXd> J;  //!< Coulomb matrix for each density
+    std::vector<Eigen::MatrixXd> K;  //!< Exchange matrix for each density
+
+    JKMatrices(size_t ndens, size_t nao);
+
+    //! Add (unfinalized) matrices from another thread
+    void Add(const JKMatrices & rhs);
+
+    //! Symmetrize and scale the accumulated matrices
+    void Finalize(void);
+};
+
+
+/*! \brief Degeneracy of a unique ERI (ij|kl)
+ *
+ * The indices must satisfy i >= j and k >= l. Since (ij|kl) and (kl|ij)
+ * are the same integral, only one of them may be used.
+ */
+inline double UniqueERIDegeneracy(size_t i, size_t j, size_t k, size_t l)
+{
+    double deg = 1.0;
+    if(i != j)
+        deg *= 2.0;
+    if(k != l)
+        deg *= 2.0;
+    if(i != k || j != l)
+        deg *= 2.0;
+    return deg;
+}
+
+
+/*! \brief Scatter a unique ERI into J and K for all densities
+ *
+ * \p value must already be multiplied by UniqueERIDegeneracy(). All
+ * permutations of (ij|kl) are accounted for once the matrices are
+ * finalized.
+ */
+inline void AddUniqueERI(size_t i, size_t j, size_t k, size_t l, double value,
+                         const std::vector<const Eigen::MatrixXd *> & D,
+                         JKMatrices & jk)
+{
+    for(size_t d = 0; d < D.size(); d++)
+    {
+        const Eigen::MatrixXd & Dd = *D[d];
+        Eigen::MatrixXd & J = jk.J[d];
+        Eigen::MatrixXd & K = jk.K[d];
+
+        J(i, j) += Dd(k, l) * value;
+        J(k, l) += Dd(i, j) * value;
+        K(i, k) += Dd(j, l) * value;
+        K(j, l) += Dd(i, k) * value;
+        K(i, l) += Dd(j, k) * value;
+        K(j, k) += Dd(i, l) * value;
+    }
+}
+
+
+/*! \brief Schwarz bounds for all pairs of shells of a basis set
+ *
+ * Element (P, Q) is sqrt(max |(PQ|PQ)|). \p mod must be initialized
+ * with \p bs on all four centers.
+ */
+Eigen::MatrixXd SchwarzBounds(pulsar::TwoElectronIntegral & mod, const pulsar::BasisSet & bs);
+
+
+/*! \brief Form the Fock matrices of an irrep from finalized J and K
+ *
+ * If \p spins is {0}, the single density is the total density and
+ * F = H + J - K/2. Otherwise, there is a density for each spin and
+ * F_s = H + sum_s' J_s' - K_s.
+ */
+void FormFockFromJK(const Eigen::MatrixXd & Hcore,
+                    pulsar::Irrep ir, const std::vector<int> & spins,
+                    const JKMatrices & jk, pulsar::IrrepSpinMatrixD & Fmat);
+
+
+} // close namespace pulsarmethods
+
+#endif
@@ -0,0 +1,303 @@
+#include "Methods/SCF/RIFockBuild.hpp"
+#include "pulsar_modules/common/ParallelCommon.hpp"
+
+#include <pulsar/modulebase/All.hpp>
+
+#include <algorithm>
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+using namespace pulsar;
+
+
+// A basis set with only the unit shell (a single s primitive with a zero
+// exponent and a coefficient of one). Used in place of a center of the
+// 4-center ERI to get 3- and 2-center integrals
+static BasisSet UnitBasisSet_(void)
+{
+    BasisShellInfo shell(ShellType::CartesianGaussian, 0, 1, 1, {0.0}, {1.0});
+    BasisSet unit(1, 1, 1, 3);
+    unit.add_shell(shell, {0.0, 0.0, 0.0});
+    return unit;
+}
+
+
+namespace pulsarmethods {
+
+
+void RIFockBuild::initialize_(unsigned int deriv, const Wavefunction & wfn,
+                              const BasisSet & bs)
+{
+    if(!wfn.system)
+        throw PulsarException("System is not set!");
+
+    nthread_ = ResolveNThreads(options().get<size_t>("NTHREADS"));
+
+    const std::string auxtag = options().get<std::string>("AUX_BASIS_SET");
+    const BasisSet auxbs = wfn.system->get_basis_set(auxtag);
+    const BasisSet unitbs = UnitBasisSet_();
+
+    nao_ = bs.n_functions();
+    naux_ = auxbs.n_functions();
+    const size_t npair = (nao_*(nao_+1))/2;
+
+    ////////////////////////////////////////
+    // Memory. B has to fit, and the rest
+    // is used for batches of K
+    ////////////////////////////////////////
+    const double memory = options().get<double>("MEMORY") * 1024.0 * 1024.0;
+    const double bsize = static_cast<double>(npair * naux_ * sizeof(double));
+    const double batchsize = static_cast<double>(2 * nao_ * nao_ * sizeof(double) * nthread_);
+
+    if(bsize + batchsize > memory)
+        throw PulsarException("Not enough memory for the 3-index integrals",
+                              "needed (MB)", (bsize + batchsize)/(1024.0*1024.0),
+                              "MEMORY", memory/(1024.0*1024.0));
+
+    // Batches of K are split between threads, so
+    // there should be at least one for each thread
+    kbatch_ = static_cast<size_t>((memory - bsize) / batchsize);
+    kbatch_ = std::min(kbatch_, (naux_ + nthread_ - 1) / nthread_);
+    kbatch_ = std::max<size_t>(1, kbatch_);
+
+    out.output("RI-JK: %? basis functions, %? auxiliary functions\n", nao_, naux_);
+    out.output("       3-index integrals: %? MB, %? auxiliary functions per batch of K\n",
+               bsize/(1024.0*1024.0), kbatch_);
+
+
+    // Starting function of each shell
+    std::vector<size_t> ao_start, aux_start;
+    for(size_t i = 0, start = 0; i < bs.n_shell(); i++)
+    {
+        ao_start.push_back(start);
+        start += bs.shell(i).n_functions();
+    }
+    for(size_t i = 0, start = 0; i < auxbs.n_shell(); i++)
+    {
+        aux_start.push_back(start);
+        start += auxbs.shell(i).n_functions();
+    }
+
+
+    ///////////////////////////////////
+    // 3-index integrals (Q 1|mn),
+    // with one ERI module per thread
+    ///////////////////////////////////
+    auto eri_mods = MakeThreadModules(nthread_, [&](void)
+    {
+        auto mod = create_child_from_option<TwoElectronIntegral>("KEY_AO_ERI");
+        mod->initialize(0, wfn, auxbs, unitbs, bs, bs);
+        return mod;
+    });
+
+    B_ = MatrixXd::Zero(npair, naux_);
+
+    const size_t maxnfunc = std::max(bs.max_n_functions(), auxbs.max_n_functions());
+    const size_t bufsize = maxnfunc*maxnfunc*maxnfunc;
+
+    ParallelErrors errors;
+
+    #pragma omp parallel num_threads(static_cast<int>(nthread_))
+    {
+        TwoElectronIntegral & mod = *eri_mods[ThreadIndex()];
+        std::vector<double> eribuf(bufsize);
+
+        #pragma omp for schedule(dynamic)
+        for(size_t Q = 0; Q < auxbs.n_shell(); Q++)
+        {
+            errors.Run([&](void)
+            {
+                const size_t nfq = auxbs.shell(Q).n_functions();
+
+                for(size_t M = 0; M < bs.n_shell(); M++)
+                for(size_t N = 0; N <= M; N++)
+                {
+                    const size_t nfm = bs.shell(M).n_functions();
+                    const size_t nfn = bs.shell(N).n_functions();
+
+                    const uint64_t ncalc = mod.calculate(Q, 0, M, N, eribuf.data(), bufsize);
+                    if(ncalc != nfq*nfm*nfn)
+                        throw PulsarException("Bad number of integrals returned",
+                                              "ncalc", ncalc, "expected", nfq*nfm*nfn);
+
+                    const double * eri = eribuf.data();
+                    for(size_t fq = 0; fq < nfq; fq++)
+                    for(size_t fm = 0; fm < nfm; fm++)
+                    for(size_t fn = 0; fn < nfn; fn++, eri++)
+                    {
+                        const size_t m = ao_start[M] + fm;
+                        const size_t n = ao_start[N] + fn;
+                        if(n <= m)
+                            B_((m*(m+1))/2 + n, aux_start[Q] + fq) = *eri;
+                    }
+                }
+            });
+        }
+    }
+
+    errors.Rethrow();
+
+
+    ///////////////////////////////////
+    // Coulomb metric (P 1|Q 1)
+    ///////////////////////////////////
+    auto mod_metric = create_child_from_option<TwoElectronIntegral>("KEY_AO_ERI");
+    mod_metric->initialize(0, wfn, auxbs, unitbs, auxbs, unitbs);
+
+    MatrixXd V(naux_, naux_);
+    std::vector<double> eribuf(bufsize);
+
+    for(size_t P = 0; P < auxbs.n_shell(); P++)
+    for(size_t Q = 0; Q <= P; Q++)
+    {
+        const size_t nfp = auxbs.shell(P).n_functions();
+        const size_t nfq = auxbs.shell(Q).n_functions();
+
+        const uint64_t ncalc = mod_metric->calculate(P, 0, Q, 0, eribuf.data(), bufsize);
+        if(ncalc != nfp*nfq)
+            throw PulsarException("Bad number of integrals returned",
+                                  "ncalc", ncalc, "expected", nfp*nfq);
+
+        for(size_t fp = 0; fp < nfp; fp++)
+        for(size_t fq = 0; fq < nfq; fq++)
+        {
+            const size_t p = aux_start[P] + fp;
+            const size_t q = aux_start[Q] + fq;
+            V(p, q) = V(q, p) = eribuf[fp*nfq + fq];
+        }
+    }
+
+    Eigen::LLT<MatrixXd> llt(V);
+    if(llt.info() != Eigen::Success)
+        throw PulsarException("Coulomb metric of the auxiliary basis is not positive definite",
+                              "auxbasis", auxtag);
+
+    // B = (Q|mn) L^-T, ie B^T = L^-1 (Q|mn)^T
+    llt.matrixU().solveInPlace<Eigen::OnTheRight>(B_);
+
+
+    /////////////////////////////////////
+    // The one-electron integral cacher
+    /////////////////////////////////////
+    auto mod_ao_cache = create_child_from_option<OneElectronMatrix>("KEY_ONEEL_MAT");
+
+    ////////////////////////////
+    // One-electron hamiltonian
+    ///////////////////////
+    const std::string ao_build_key = options().get<std::string>("KEY_AO_COREBUILD");
+    auto Hcoreimpl = mod_ao_cache->calculate(ao_build_key, 0, wfn, bs, bs);
+    Hcore_ = convert_to_eigen(Hcoreimpl.at(0));  // .at(0) = first (and only) component
+}
+
+
+void RIFockBuild::unpack_(size_t Q, Eigen::Ref<MatrixXd> out) const
+{
+    const double * b = B_.col(Q).data();
+    for(size_t m = 0; m < nao_; m++)
+    for(size_t n = 0; n <= m; n++)
+        out(m, n) = out(n, m) = *b++;
+}
+
+
+JKMatrices RIFockBuild::build_jk_(const std::vector<const MatrixXd *> & D) const
+{
+    const size_t npair = B_.rows();
+    const size_t nbatch = (naux_ + kbatch_ - 1) / kbatch_;
+
+    // J and K are formed directly (there is nothing to finalize)
+    JKMatrices jk(D.size(), nao_);
+
+    for(size_t d = 0; d < D.size(); d++)
+    {
+        const MatrixXd & Dd = *D[d];
+
+        ///////////////
+        // Coulomb
+        ///////////////
+        // Packed density, with off-diagonal elements doubled
+        VectorXd Dpacked(npair);
+        for(size_t m = 0, mn = 0; m < nao_; m++)
+        for(size_t n = 0; n <= m; n++, mn++)
+            Dpacked(mn) = (m == n) ? Dd(m, n) : Dd(m, n) + Dd(n, m);
+
+        const VectorXd gamma = B_.transpose() * Dpacked;
+        const VectorXd Jpacked = B_ * gamma;
+
+        MatrixXd & J = jk.J[d];
+        for(size_t m = 0, mn = 0; m < nao_; m++)
+        for(size_t n = 0; n <= m; n++, mn++)
+            J(m, n) = J(n, m) = Jpacked(mn);
+
+
+        ///////////////
+        // Exchange
+        ///////////////
+        MatrixXd & K = jk.K[d];
+
+        #pragma omp parallel num_threads(static_cast<int>(nthread_))
+        {
+            MatrixXd myK = MatrixXd::Zero(nao_, nao_);
+            MatrixXd Bbatch(nao_, kbatch_*nao_);
+            MatrixXd DB(nao_, kbatch_*nao_);
+
+            #pragma omp for schedule(dynamic)
+            for(size_t b = 0; b < nbatch; b++)
+            {
+                const size_t Qstart = b*kbatch_;
+                const size_t nQ = std::min(kbatch_, naux_ - Qstart);
+
+                for(size_t q = 0; q < nQ; q++)
+                    unpack_(Qstart + q, Bbatch.middleCols(q*nao_, nao_));
+
+                DB.leftCols(nQ*nao_).noalias() = Dd * Bbatch.leftCols(nQ*nao_);
+
+                for(size_t q = 0; q < nQ; q++)
+                    myK.noalias() += Bbatch.middleCols(q*nao_, nao_) * DB.middleCols(q*nao_, nao_);
+            }
+
+            #pragma omp critical
+            K += myK;
+        }
+    }
+
+    return jk;
+}
+
+
+IrrepSpinMatrixD RIFockBuild::calculate_(const Wavefunction & wfn)
+{
+    if(!wfn.opdm)
+        throw PulsarException("Missing OPDM");
+
+    // the fock matrix we are returning
+    IrrepSpinMatrixD Fmat;
+
+    for(auto ir : wfn.opdm->get_irreps())
+    {
+        const auto & spinset = wfn.opdm->get_spins(ir);
+        const std::vector<int> spins(spinset.begin(), spinset.end());
+
+        std::vector<std::shared_ptr<const MatrixXd>> Dptrs;
+        std::vector<const MatrixXd *> D;
+        for(int s : spins)
+        {
+            Dptrs.push_back(convert_to_eigen(wfn.opdm->get(ir, s)));
+            D.push_back(Dptrs.back().get());
+
+            if(static_cast<size_t>(D.back()->rows()) != nao_ ||
+               static_cast<size_t>(D.back()->cols()) != nao_)
+                throw PulsarException("Density matrix has the wrong dimensions",
+                                      "rows", D.back()->rows(), "cols", D.back()->cols(),
+                                      "nao", nao_);
+        }
+
+        const JKMatrices jk = build_jk_(D);
+        FormFockFromJK(*Hcore_, ir, spins, jk, Fmat);
+    }
+
+    return Fmat;
+}
+
+
+} // close namespace pulsarmethods
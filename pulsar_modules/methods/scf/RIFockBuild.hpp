@@ -0,0 +1,62 @@
+#ifndef PULSAR_GUARD_SCF__RIFOCKBUILD_HPP_
+#define PULSAR_GUARD_SCF__RIFOCKBUILD_HPP_
+
+#include "Methods/SCF/JKCommon.hpp"
+
+#include <pulsar/modulebase/FockBuilder.hpp>
+
+#include <vector>
+#include <Eigen/Dense>
+
+namespace pulsarmethods {
+
+/*! \brief Fock builder using density fitting (RI-JK)
+ *
+ * The 3-index integrals (Q|mn) over the auxiliary basis (AUX_BASIS_SET)
+ * and the Coulomb metric (P|Q) are calculated once, using the 4-center
+ * ERI module with a unit shell in place of the missing centers. The
+ * metric is Cholesky factored (V = L L^T), and
+ *
+ *   B_Q,mn = sum_P [L^-1]_QP (P|mn)
+ *
+ * is stored for the unique pairs mn. Then
+ *
+ *   J_mn = sum_Q B_Q,mn (sum_ls B_Q,ls D_ls)
+ *   K_mn = sum_Q (B_Q D B_Q)_mn
+ *
+ * B must fit within MEMORY. Whatever is left determines how many auxiliary
+ * functions are unpacked at once when forming K.
+ */
+class RIFockBuild : public pulsar::FockBuilder
+{
+    public:
+        RIFockBuild(ID_t id) :  pulsar::FockBuilder(id) { }
+
+        virtual void initialize_(unsigned int deriv,
+                                 const pulsar::Wavefunction & wfn,
+                                 const pulsar::BasisSet & bs);
+
+        virtual pulsar::IrrepSpinMatrixD calculate_(const pulsar::Wavefunction & wfn);
+
+
+    private:
+        size_t nthread_;
+        size_t nao_;
+        size_t naux_;
+        size_t kbatch_;   //!< Number of auxiliary functions per batch when forming K
+
+        //! L^-1 (Q|mn). Each column is one auxiliary function, with mn packed (m >= n)
+        Eigen::MatrixXd B_;
+
+        std::shared_ptr<const Eigen::MatrixXd> Hcore_;
+
+        //! Unpack column \p Q of B_ into a full (symmetric) matrix
+        void unpack_(size_t Q, Eigen::Ref<Eigen::MatrixXd> out) const;
+
+        //! Build J and K from the given densities
+        JKMatrices build_jk_(const std::vector<const Eigen::MatrixXd *> & D) const;
+};
+
+}
+
+#endif
@@ -1,5 +1,8 @@
-//#include <pulsar/system/AOIterator.hpp>
 #include "Methods/SCF/SCFCommon.hpp"
+#include "pulsar_modules/common/ParallelCommon.hpp"
+
+#include <algorithm>
+#include <functional>
 
 using Eigen::SelfAdjointEigenSolver;
 using Eigen::MatrixXd;
@@ -11,11 +14,12 @@ using namespace pulsar;
 namespace pulsarmethods{
 
 
-std::vector<double>
-FillTwoElectronVector(ModulePtr<TwoElectronIntegral> & mod,
-                      const BasisSet & bs)
+// Does the work of FillTwoElectronVector, with one thread for each module
+static std::vector<double>
+FillTwoElectronVector_(const std::vector<TwoElectronIntegral *> & mods,
+                       const BasisSet & bs)
 {
-    /*const size_t nao = bs.n_functions();
+    const size_t nao = bs.n_functions();
     const size_t nshell = bs.n_shell();
     const size_t maxnfunc = bs.max_n_functions();
 
@@ -23,60 +27,136 @@ FillTwoElectronVector(ModulePtr<TwoElectronIntegral> & mod,
     const size_t nao1234 = (nao12*(nao12+1))/2;
     const size_t bufsize = maxnfunc*maxnfunc*maxnfunc*maxnfunc;
 
-    std::vector<double> eri(nao1234);
-    std::vector<double> eribuf(bufsize);
+    // Shell information. The cost of a shell pair is
+    // estimated from the number of primitives and functions
+    std::vector<size_t> shell_start(nshell);
+    std::vector<size_t> shell_nfunc(nshell);
+    std::vector<std::pair<size_t, size_t>> shellpairs;
+    std::vector<double> paircost;
 
-    size_t i_start = 0;
-    for(size_t i = 0; i < nshell; i++)
+    for(size_t P = 0, start = 0; P < nshell; P++)
     {
-        const auto & sh1 = bs.shell(i);
-        size_t j_start = 0;
+        const auto & sh = bs.shell(P);
+        shell_start[P] = start;
+        shell_nfunc[P] = sh.n_functions();
+        start += shell_nfunc[P];
 
-        for(size_t j = 0; j <= i; j++)
+        for(size_t Q = 0; Q <= P; Q++)
         {
-            const auto & sh2 = bs.shell(j);
-            size_t k_start = 0;
+            const auto & sh2 = bs.shell(Q);
+            shellpairs.emplace_back(P, Q);
+            paircost.push_back(static_cast<double>(sh.n_primitives() * sh2.n_primitives()
+                                                 * sh.n_functions() * sh2.n_functions()));
+        }
+    }
 
-            for(size_t k = 0; k < nshell; k++)
-            {
-                const auto & sh3 = bs.shell(k);
-                size_t l_start = 0;
+    // Each task is a bra pair PQ, with all ket pairs RS <= PQ. The
+    // cost of a quartet is the product of the costs of its pairs, so
+    // the cost of a task uses the running sum of the pair costs.
+    // The most expensive tasks are handed out first
+    const size_t npair = shellpairs.size();
+    std::vector<std::pair<double, size_t>> tasks(npair);
+    double kettotal = 0.0;
+    for(size_t PQ = 0; PQ < npair; PQ++)
+    {
+        kettotal += paircost[PQ];
+        tasks[PQ] = std::make_pair(paircost[PQ] * kettotal, PQ);
+    }
+    std::sort(tasks.begin(), tasks.end(), std::greater<std::pair<double, size_t>>());
 
-                for(size_t l = 0; l <= k; l++)
-                {
-                    if(INDEX2(k,l) > INDEX2(i,j))
-                        continue;
+    std::vector<double> eri(nao1234);
+    double * const eridata = eri.data();
 
-                    const auto & sh4 = bs.shell(l);
+    ParallelErrors errors;
 
-                    uint64_t ncalc = mod->calculate(i, j, k, l, eribuf.data(), bufsize); 
+    #pragma omp parallel num_threads(static_cast<int>(mods.size()))
+    {
+        TwoElectronIntegral & mod = *mods[ThreadIndex()];
+        std::vector<double> eribuf(bufsize);
 
-                    AOIterator<4> aoit({sh1, sh2, sh3, sh4}, false);
+        #pragma omp for schedule(dynamic)
+        for(size_t t = 0; t < npair; t++)
+        {
+            errors.Run([&](void)
+            {
+                const size_t PQ = tasks[t].second;
+                const size_t P = shellpairs[PQ].first;
+                const size_t Q = shellpairs[PQ].second;
+                const size_t nf1 = shell_nfunc[P];
+                const size_t nf2 = shell_nfunc[Q];
 
-                    // make sure the right number of integrals was returned
-                    if(ncalc != aoit.n_functions())
-                        throw PulsarException("Bad number of integrals returned",
-                                               "ncalc", ncalc, "expected", aoit.n_functions());
+                for(size_t RS = 0; RS <= PQ; RS++)
+                {
+                    // Nothing more to do once any thread has failed
+                    if(errors.Failed())
+                        return;
 
-                    do { 
-                        const size_t full_i = i_start+aoit.shell_function_idx<0>();
-                        const size_t full_j = j_start+aoit.shell_function_idx<1>();
-                        const size_t full_k = k_start+aoit.shell_function_idx<2>();
-                        const size_t full_l = l_start+aoit.shell_function_idx<3>();
+                    const size_t R = shellpairs[RS].first;
+                    const size_t S = shellpairs[RS].second;
+                    const size_t nf3 = shell_nfunc[R];
+                    const size_t nf4 = shell_nfunc[S];
 
-                        eri.at(INDEX4(full_i, full_j, full_k, full_l)) = eribuf.at(aoit.total_idx());
-                    } while(aoit.next());
+                    const uint64_t ncalc = mod.calculate(P, Q, R, S, eribuf.data(), bufsize);
 
-                    l_start += sh4.n_functions();   
+                    // make sure the right number of integrals was returned
+                    if(ncalc != nf1*nf2*nf3*nf4)
+                        throw PulsarException("Bad number of integrals returned",
+                                               "ncalc", ncalc, "expected", nf1*nf2*nf3*nf4);
+
+                    // Every element goes to its canonical position. Each unique
+                    // integral belongs to exactly one unique shell quartet, so
+                    // no two threads write to the same element. Within diagonal
+                    // shell quartets, the same value may be written more than once.
+                    const double * val = eribuf.data();
+                    for(size_t f1 = 0; f1 < nf1; f1++)
+                    for(size_t f2 = 0; f2 < nf2; f2++)
+                    {
+                        const size_t i = shell_start[P] + f1;
+                        const size_t j = shell_start[Q] + f2;
+                        const size_t ij = INDEX2(i, j);
+
+                        for(size_t f3 = 0; f3 < nf3; f3++)
+                        for(size_t f4 = 0; f4 < nf4; f4++, val++)
+                        {
+                            const size_t k = shell_start[R] + f3;
+                            const size_t l = shell_start[S] + f4;
+                            const size_t kl = INDEX2(k, l);
+                            const size_t ijkl = (ij >= kl) ? (ij*(ij+1))/2 + kl
+                                                           : (kl*(kl+1))/2 + ij;
+                            eridata[ijkl] = *val;
+                        }
+                    }
                 }
-                k_start += sh3.n_functions();
-            }
-            j_start += sh2.n_functions();
+            });
         }
-        i_start += sh1.n_functions();
     }
 
-    return std::move(eri);*/
+    errors.Rethrow();
+
+    return eri;
+}
+
+
+std::vector<double>
+FillTwoElectronVector(std::vector<ModulePtr<TwoElectronIntegral>> & mods,
+                      const BasisSet & bs)
+{
+    if(mods.size() == 0)
+        throw PulsarException("No ERI modules given to FillTwoElectronVector");
+
+    std::vector<TwoElectronIntegral *> modptrs;
+    for(auto & mod : mods)
+        modptrs.push_back(&(*mod));
+
+    return FillTwoElectronVector_(modptrs, bs);
+}
+
+
+std::vector<double>
+FillTwoElectronVector(ModulePtr<TwoElectronIntegral> & mod,
+                      const BasisSet & bs)
+{
+    return FillTwoElectronVector_({&(*mod)}, bs);
 }
 
 
@@ -13,6 +13,18 @@
 
 namespace pulsarmethods {
 
+/*! \brief Calculate all permutationally-unique ERI over a basis set
+ *
+ * The integrals are stored in canonical order, ie (ij|kl) is at
+ * INDEX4(i,j,k,l). The work is split between threads, one for each
+ * module in \p mods (which must all be initialized with \p bs on
+ * all four centers).
+ */
+std::vector<double>
+FillTwoElectronVector(std::vector<pulsar::ModulePtr<pulsar::TwoElectronIntegral>> & mods,
+                      const pulsar::BasisSet & bs);
+
+//! Calculate all permutationally-unique ERI with a single module (and thread)
 std::vector<double>
 FillTwoElectronVector(pulsar::ModulePtr<pulsar::TwoElectronIntegral> & mod,
                       const pulsar::BasisSet & bs);
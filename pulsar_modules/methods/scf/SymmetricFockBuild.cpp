@@ -0,0 +1,122 @@
+#include "Methods/SCF/SymmetricFockBuild.hpp"
+#include "Methods/SCF/JKCommon.hpp"
+#include "pulsar_modules/common/ParallelCommon.hpp"
+
+#include <pulsar/modulebase/All.hpp>
+
+using Eigen::MatrixXd;
+
+using namespace pulsar;
+
+namespace pulsarmethods {
+
+
+void SymmetricFockBuild::initialize_(unsigned int deriv, const Wavefunction & wfn,
+                                     const BasisSet & bs)
+{
+    if(!wfn.system)
+        throw PulsarException("System is not set!");
+
+    const size_t nthread = ResolveNThreads(options().get<size_t>("NTHREADS"));
+
+    /////////////////////////////////////////////
+    // Load the ERI to core (one module per thread)
+    /////////////////////////////////////////////
+    auto mod_ao_eri = MakeThreadModules(nthread, [&](void)
+    {
+        auto mod = create_child_from_option<TwoElectronIntegral>("KEY_AO_ERI");
+        mod->initialize(0, wfn, bs, bs, bs, bs);
+        return mod;
+    });
+    eri_ = FillTwoElectronVector(mod_ao_eri, bs);
+
+    // Canonical pairs, in storage order
+    const size_t nao = bs.n_functions();
+    pairs_.clear();
+    pairs_.reserve((nao*(nao+1))/2);
+    for(size_t i = 0; i < nao; i++)
+    for(size_t j = 0; j <= i; j++)
+        pairs_.emplace_back(i, j);
+
+
+    /////////////////////////////////////
+    // The one-electron integral cacher
+    /////////////////////////////////////
+    auto mod_ao_cache = create_child_from_option<OneElectronMatrix>("KEY_ONEEL_MAT");
+
+    ////////////////////////////
+    // One-electron hamiltonian
+    ///////////////////////
+    const std::string ao_build_key = options().get<std::string>("KEY_AO_COREBUILD");
+    auto Hcoreimpl = mod_ao_cache->calculate(ao_build_key, 0, wfn, bs, bs);
+    Hcore_ = convert_to_eigen(Hcoreimpl.at(0));  // .at(0) = first (and only) component
+}
+
+
+IrrepSpinMatrixD SymmetricFockBuild::calculate_(const Wavefunction & wfn)
+{
+    if(!wfn.opdm)
+        throw PulsarException("Missing OPDM");
+
+    const size_t nao = Hcore_->rows();
+    const size_t npair = pairs_.size();
+
+    if(npair != (nao*(nao+1))/2)
+        throw PulsarException("Size of the core hamiltonian doesn't match the ERI",
+                              "nao", nao, "npair", npair);
+
+    const size_t nthread = ResolveNThreads(options().get<size_t>("NTHREADS"));
+
+    // the fock matrix we are returning
+    IrrepSpinMatrixD Fmat;
+
+    for(auto ir : wfn.opdm->get_irreps())
+    {
+        const auto & spinset = wfn.opdm->get_spins(ir);
+        const std::vector<int> spins(spinset.begin(), spinset.end());
+
+        std::vector<std::shared_ptr<const MatrixXd>> Dptrs;
+        std::vector<const MatrixXd *> D;
+        for(int s : spins)
+        {
+            Dptrs.push_back(convert_to_eigen(wfn.opdm->get(ir, s)));
+            D.push_back(Dptrs.back().get());
+        }
+
+        JKMatrices jk(D.size(), nao);
+
+        #pragma omp parallel num_threads(static_cast<int>(nthread))
+        {
+            JKMatrices myjk(D.size(), nao);
+
+            // Integrals for bra pair ij start at ij*(ij+1)/2, and the
+            // work for a bra pair grows with ij
+            #pragma omp for schedule(dynamic)
+            for(size_t ij = 0; ij < npair; ij++)
+            {
+                const size_t i = pairs_[ij].first;
+                const size_t j = pairs_[ij].second;
+                const double * eri = eri_.data() + (ij*(ij+1))/2;
+
+                for(size_t kl = 0; kl <= ij; kl++)
+                {
+                    const size_t k = pairs_[kl].first;
+                    const size_t l = pairs_[kl].second;
+                    const double value = eri[kl] * UniqueERIDegeneracy(i, j, k, l);
+                    AddUniqueERI(i, j, k, l, value, D, myjk);
+                }
+            }
+
+            #pragma omp critical
+            jk.Add(myjk);
+        }
+
+        jk.Finalize();
+        FormFockFromJK(*Hcore_, ir, spins, jk, Fmat);
+    }
+
+    return Fmat;
+}
+
+
+} // close namespace pulsarmethods
@@ -0,0 +1,44 @@
+#ifndef PULSAR_GUARD_SCF__SYMMETRICFOCKBUILD_HPP_
+#define PULSAR_GUARD_SCF__SYMMETRICFOCKBUILD_HPP_
+
+#include "Methods/SCF/SCFCommon.hpp"
+
+#include <pulsar/modulebase/FockBuilder.hpp>
+
+#include <utility>
+#include <vector>
+#include <Eigen/Dense>
+
+namespace pulsarmethods {
+
+/*! \brief Fock builder using the stored, permutationally-unique ERI
+ *
+ * Each unique integral (ij|kl) is read once (in storage order) and
+ * scattered into the Coulomb and exchange matrices for all of its
+ * permutations. The bra pairs are split between threads, each
+ * accumulating its own J and K.
+ */
+class SymmetricFockBuild : public pulsar::FockBuilder
+{
+    public:
+        SymmetricFockBuild(ID_t id) :  pulsar::FockBuilder(id) { }
+
+        virtual void initialize_(unsigned int deriv,
+                                 const pulsar::Wavefunction & wfn,
+                                 const pulsar::BasisSet & bs);
+
+        virtual pulsar::IrrepSpinMatrixD calculate_(const pulsar::Wavefunction & wfn);
+
+
+    private:
+        std::vector<double> eri_;
+
+        //! (i,j) for each canonical pair index ij = i*(i+1)/2 + j
+        std::vector<std::pair<size_t, size_t>> pairs_;
+
+        std::shared_ptr<const Eigen::MatrixXd> Hcore_;
+};
+
+}
+
+#endif
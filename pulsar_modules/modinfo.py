@@ -237,6 +237,100 @@ minfo["EEQMMM"]["options"]={
 #                            "Key of the ERI module to use"),
 #                    }
 #  },
+#  "SymmetricFockBuild" :
+#  {
+#    "type"        : "c_module",
+#    "base"        : "FockBuilder",
+#    "modpath"     : "Methods.so",
+#    "version"     : "0.1a",
+#    "description" : "Fock build from stored ERI, using each permutationally-unique integral once",
+#    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
+#    "refs"        : [""],
+#    "options"     : {
+#                        "KEY_AO_COREBUILD": (OptionType.String, None, True, None,
+#                            "Key of the core builder module to use"),
+#                        "KEY_ONEEL_MAT": (OptionType.String, None, True, None,
+#                            "Key of the one-electron integral cacher"),
+#                        "KEY_AO_ERI": (OptionType.String, None, True, None,
+#                            "Key of the ERI module to use"),
+#                        "NTHREADS": (OptionType.Int, 0, False, None,
+#                            "Number of threads to use (0 = all available OpenMP threads)"),
+#                    }
+#  },
+#  "DirectFockBuild" :
+#  {
+#    "type"        : "c_module",
+#    "base"        : "FockBuilder",
+#    "modpath"     : "Methods.so",
+#    "version"     : "0.1a",
+#    "description" : "Direct Fock build, recalculating screened ERI from the change in the density",
+#    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
+#    "refs"        : [""],
+#    "options"     : {
+#                        "KEY_AO_COREBUILD": (OptionType.String, None, True, None,
+#                            "Key of the core builder module to use"),
+#                        "KEY_ONEEL_MAT": (OptionType.String, None, True, None,
+#                            "Key of the one-electron integral cacher"),
+#                        "KEY_AO_ERI": (OptionType.String, None, True, None,
+#                            "Key of the ERI module to use"),
+#                        "SCREEN_THRESHOLD": (OptionType.Float, 1e-12, False, None,
+#                            "Shell quartets with a Schwarz bound times density below this are skipped"),
+#                        "FULL_REBUILD": (OptionType.Int, 8, False, None,
+#                            "Number of incremental builds between full rebuilds (0 = always rebuild)"),
+#                        "NTHREADS": (OptionType.Int, 0, False, None,
+#                            "Number of threads to use (0 = all available OpenMP threads)"),
+#                    }
+#  },
+#  "RIFockBuild" :
+#  {
+#    "type"        : "c_module",
+#    "base"        : "FockBuilder",
+#    "modpath"     : "Methods.so",
+#    "version"     : "0.1a",
+#    "description" : "Fock build using density fitting (RI-JK) with an auxiliary basis",
+#    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
+#    "refs"        : [""],
+#    "options"     : {
+#                        "KEY_AO_COREBUILD": (OptionType.String, None, True, None,
+#                            "Key of the core builder module to use"),
+#                        "KEY_ONEEL_MAT": (OptionType.String, None, True, None,
+#                            "Key of the one-electron integral cacher"),
+#                        "KEY_AO_ERI": (OptionType.String, None, True, None,
+#                            "Key of the ERI module to use (for the 3- and 2-center integrals)"),
+#                        "AUX_BASIS_SET": (OptionType.String, "Fitting", False, None,
+#                            "Tag representing the auxiliary basis set in the system"),
+#                        "MEMORY": (OptionType.Float, 2048.0, False, None,
+#                            "Memory (in MB) for the 3-index integrals and the exchange batches"),
+#                        "NTHREADS": (OptionType.Int, 0, False, None,
+#                            "Number of threads to use (0 = all available OpenMP threads)"),
+#                    }
+#  },
+#  "DiskFockBuild" :
+#  {
+#    "type"        : "c_module",
+#    "base"        : "FockBuilder",
+#    "modpath"     : "Methods.so",
+#    "version"     : "0.1a",
+#    "description" : "Fock build from permutationally-unique ERI stored on disk",
+#    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
+#    "refs"        : [""],
+#    "options"     : {
+#                        "KEY_AO_COREBUILD": (OptionType.String, None, True, None,
+#                            "Key of the core builder module to use"),
+#                        "KEY_ONEEL_MAT": (OptionType.String, None, True, None,
+#                            "Key of the one-electron integral cacher"),
+#                        "KEY_AO_ERI": (OptionType.String, None, True, None,
+#                            "Key of the ERI module to use"),
+#                        "SCRATCH_DIR": (OptionType.String, ".", False, None,
+#                            "Directory for the file holding the ERI"),
+#                        "BLOCK_SIZE": (OptionType.Int, 131072, False, None,
+#                            "Number of integrals in each block read from or written to disk"),
+#                        "STORE_THRESHOLD": (OptionType.Float, 1e-14, False, None,
+#                            "Integrals (and Schwarz bounds) smaller than this are not stored, and the rest are stored to within half of this"),
+#                        "NTHREADS": (OptionType.Int, 0, False, None,
+#                            "Number of threads to use (0 = all available OpenMP threads)"),
+#                    }
+#  },
 #  "Damping" :
 #  {
 #    "type"        : "c_module",
@@ -327,6 +421,7 @@ minfo["EEQMMM"]["options"]={
 #    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
 #    "refs"        : [],
 #    "options"     : {
+#                        "SCREEN_THRESHOLD":   ( OptionType.Float,  1e-15, False, None,  "Primitive and shell pairs with an estimated overlap below this are skipped" )
 #                    }
 #  },
 #
@@ -340,6 +435,7 @@ minfo["EEQMMM"]["options"]={
 #    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
 #    "refs"        : [],
 #    "options"     : {
+#                        "SCREEN_THRESHOLD":   ( OptionType.Float,  1e-15, False, None,  "Primitive and shell pairs with an estimated dipole integral below this are skipped" )
 #                    }
 #  },
 #
@@ -353,6 +449,7 @@ minfo["EEQMMM"]["options"]={
 #    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
 #    "refs"        : [],
 #    "options"     : {
+#                        "SCREEN_THRESHOLD":   ( OptionType.Float,  1e-15, False, None,  "Primitive and shell pairs with an estimated kinetic energy integral below this are skipped" )
 #                    }
 #  },
 #
@@ -366,7 +463,34 @@ minfo["EEQMMM"]["options"]={
 #    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
 #    "refs"        : [],
 #    "options"     : {
-#                        "GRID":   ( OptionType.String,  None, True, None,  "Grid of point charges to calculate the potential with" )
+#                        "GRID":   ( OptionType.String,  None, True, None,  "Grid of point charges to calculate the potential with (ATOMS, EXTERNAL, or ALL)" ),
+#                        "EXTERNAL_CHARGES":   ( OptionType.ListFloat,  [], False, None,  "External point charges, given as x, y, z, charge for each point" ),
+#                        "BOYS_ENGINE":   ( OptionType.String,  "DEFAULT", False, None,  "How to evaluate the Boys function (DEFAULT, SHORTGRID, or PIECEWISE)" ),
+#                        "SCREEN_THRESHOLD":   ( OptionType.Float,  1e-15, False, None,  "Primitive and shell pairs with an estimated potential integral (summed over all point charges) below this are skipped" ),
+#                        "FAR_FIELD":   ( OptionType.Bool,  False, False, None,  "Treat distant point charges via an octree multipole expansion" ),
+#                        "FAR_FIELD_ORDER":   ( OptionType.Int,  8, False, None,  "Maximum order of the far-field multipole expansion" ),
+#                        "FAR_FIELD_THETA":   ( OptionType.Float,  0.4, False, None,  "Separation criterion for the far-field approximation (between 0 and 1, smaller is more accurate)" )
+#                    }
+#  },
+#
+#  "OSOneElectronFused" :
+#  {
+#    "type"        : "c_module",
+#    "base"        : "OneElectronIntegral",
+#    "modpath"     : "Integrals.so",
+#    "version"     : "0.1a",
+#    "description" : "Calculation of AO overlap, kinetic, potential, and dipole integrals in a single pass",
+#    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
+#    "refs"        : [],
+#    "options"     : {
+#                        "GRID":   ( OptionType.String,  None, True, None,  "Grid of point charges to calculate the potential with (ATOMS, EXTERNAL, or ALL)" ),
+#                        "EXTERNAL_CHARGES":   ( OptionType.ListFloat,  [], False, None,  "External point charges, given as x, y, z, charge for each point" ),
+#                        "BOYS_ENGINE":   ( OptionType.String,  "DEFAULT", False, None,  "How to evaluate the Boys function (DEFAULT, SHORTGRID, or PIECEWISE)" ),
+#                        "SCREEN_THRESHOLD":   ( OptionType.Float,  1e-15, False, None,  "Primitive and shell pairs with estimated integrals (of all the operators calculated) below this are skipped" ),
+#                        "FAR_FIELD":   ( OptionType.Bool,  False, False, None,  "Treat distant point charges via an octree multipole expansion" ),
+#                        "FAR_FIELD_ORDER":   ( OptionType.Int,  8, False, None,  "Maximum order of the far-field multipole expansion" ),
+#                        "FAR_FIELD_THETA":   ( OptionType.Float,  0.4, False, None,  "Separation criterion for the far-field approximation (between 0 and 1, smaller is more accurate)" ),
+#                        "DIPOLE":   ( OptionType.Bool,  False, False, None,  "Also calculate the (x, y, z) dipole integrals" )
 #                    }
 #  },
 #
@@ -394,6 +518,7 @@ minfo["EEQMMM"]["options"]={
 #    "refs"        : [],
 #    "options"     : {
 #                        "KEY_ONEEL_MOD":   ( OptionType.String,  None, True, None,  "Key of which one electron integral to use"),
+#                        "SYMMETRIC":       ( OptionType.Bool,  False, False, None,  "The operator is known to be symmetric. Only the upper triangle is calculated if both basis sets are the same"),
 #                    }
 #  },
 #  "OneElectron_Eigen" :
@@ -407,6 +532,8 @@ minfo["EEQMMM"]["options"]={
 #    "refs"        : [],
 #    "options"     : {
 #                        "CACHE_RESULTS":   ( OptionType.Bool,  True, False, None,  "Cache the results between instantiations"),
+#                        "NTHREADS":        ( OptionType.Int,   0,    False, None,  "Number of threads to use (0 = all available OpenMP threads)"),
+#                        "SYMMETRIC":       ( OptionType.Bool,  False, False, None,  "The operator is known to be symmetric. Only the upper triangle is calculated if both basis sets are the same"),
 #                    }
 #  },
 #
@@ -420,6 +547,67 @@ minfo["EEQMMM"]["options"]={
 #    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
 #    "refs"        : [],
 #    "options"     : {
+#                        "FAST":   ( OptionType.Bool,  False, False, None,  "Evaluate all cartesian components of a primitive quartet at once, using precomputed tables"),
+#                    }
+#  },
+#
+#  "HGPERI" :
+#  {
+#    "type"        : "c_module",
+#    "base"        : "TwoElectronIntegral",
+#    "modpath"     : "Integrals.so",
+#    "version"     : "0.1a",
+#    "description" : "Calculation of ERI via the Head-Gordon-Pople (VRR+HRR) algorithm",
+#    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
+#    "refs"        : ["M. Head-Gordon and J. A. Pople, J. Chem. Phys. 89, 5777 (1988)"],
+#    "options"     : {
+#                        "BOYS_ENGINE":   ( OptionType.String,  "DEFAULT", False, None,  "How to evaluate the Boys function (DEFAULT, SHORTGRID, or PIECEWISE)" )
+#                    }
+#  },
+#
+#  "RysERI" :
+#  {
+#    "type"        : "c_module",
+#    "base"        : "TwoElectronIntegral",
+#    "modpath"     : "Integrals.so",
+#    "version"     : "0.1a",
+#    "description" : "Calculation of ERI via Rys quadrature",
+#    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
+#    "refs"        : ["M. Dupuis, J. Rys, and H. F. King, J. Chem. Phys. 65, 111 (1976)"],
+#    "options"     : {
+#                    }
+#  },
+#
+#  "ERIBenchmark" :
+#  {
+#    "type"        : "c_module",
+#    "base"        : "PropertyCalculator",
+#    "modpath"     : "Integrals.so",
+#    "version"     : "0.1a",
+#    "description" : "Compares timings of ERI modules for each angular momentum class",
+#    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
+#    "refs"        : [],
+#    "options"     : {
+#                        "KEY_ERI_MODULES":   ( OptionType.ListString,  None, True, None,  "Keys of the ERI modules to compare. The first is used as the reference"),
+#                        "NREPEAT":   ( OptionType.Int,  1, False, None,  "Number of times to calculate each shell quartet"),
+#                    }
+#  },
+#
+#  "ERIValidation" :
+#  {
+#    "type"        : "c_module",
+#    "base"        : "PropertyCalculator",
+#    "modpath"     : "Integrals.so",
+#    "version"     : "0.1a",
+#    "description" : "Compares ERI modules against a reference module over all shell quartets",
+#    "authors"     : ["Benjamin Pritchard <ben@bennyp.org>"],
+#    "refs"        : [],
+#    "options"     : {
+#                        "KEY_REFERENCE_ERI":   ( OptionType.String,  None, True, None,  "Key of the reference ERI module (usually ReferenceERI with FAST)"),
+#                        "KEY_ERI_MODULES":   ( OptionType.ListString,  None, True, None,  "Keys of the ERI modules to validate"),
+#                        "TOLERANCE":   ( OptionType.Float,  1e-10, False, None,  "Largest acceptable absolute deviation from the reference"),
+#                        "ALL_PERMUTATIONS":   ( OptionType.Bool,  False, False, None,  "Check every permutation of the shells, rather than only the unique quartets"),
+#                        "NTHREADS":   ( OptionType.Int,  0, False, None,  "Number of threads to use (0 = all available OpenMP threads)"),
 #                    }
 #  },
 #